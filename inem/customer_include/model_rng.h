@@ -68,6 +68,23 @@ namespace Model {
                  */
                 TRNG,
 
+                /**
+                 * Indicates the model is to use the counter based Philox4x32-10 algorithm.
+                 */
+                PHILOX4X32_10,
+
+                /**
+                 * Indicates the model is to use eight interleaved XOR/shift/rotate+ 256 generators.  The algorithm
+                 * fills arrays several times faster than XORSHIRO256_PLUS on processors with vector units.
+                 */
+                XORSHIRO256_PLUS_X8,
+
+                /**
+                 * Indicates the model is to use eight interleaved XOR/shift/rotate** 256 generators.  The algorithm
+                 * fills arrays several times faster than XORSHIRO256_STARS on processors with vector units.
+                 */
+                XORSHIRO256_STARS_X8,
+
                 /**
                  * Value used to determine the number of supported random number generators.
                  */
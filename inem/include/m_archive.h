@@ -0,0 +1,154 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This header defines the \ref M::Archive class.
+***********************************************************************************************************************/
+
+/* .. sphinx-project inem */
+
+#ifndef M_ARCHIVE_H
+#define M_ARCHIVE_H
+
+#include <string>
+#include <vector>
+
+#include "m_common.h"
+#include "m_api_types.h"
+
+namespace M {
+    class Variant;
+
+    /**
+     * Class that stores named values in a single archive file.  Entries can be booleans, integers, reals, complex
+     * values, sets, tuples, or any of the four matrix types.
+     *
+     * Entries are appended to the end of the file as they are written.  A directory index, keyed by entry name, is
+     * written when the archive is closed.  If the archive is not closed cleanly, the index is rebuilt by scanning the
+     * entries when the archive is next opened.  Appending an entry using an existing name replaces the earlier entry.
+     *
+     * Archives opened for reading are memory mapped.  Lookups by name take constant time and values are decoded
+     * directly from the mapped file.
+     */
+    class M_PUBLIC_API Archive {
+        public:
+            Archive();
+
+            ~Archive();
+
+            Archive(const Archive& other) = delete;
+
+            Archive& operator=(const Archive& other) = delete;
+
+            /**
+             * Method you can use to open an archive so new entries can be appended.  The archive is created if it
+             * does not exist.  This method will throw an exception if an error occurs and the associated exception is
+             * enabled.
+             *
+             * \param[in] filename The name of the archive file.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool openForAppend(const std::string& filename);
+
+            /**
+             * Method you can use to open an existing archive for reading.  This method will throw an exception if an
+             * error occurs and the associated exception is enabled.
+             *
+             * \param[in] filename The name of the archive file.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool openForRead(const std::string& filename);
+
+            /**
+             * Method you can use to close the archive.  Archives opened for appending will have their directory index
+             * written.  This method will throw an exception if an error occurs and the associated exception is
+             * enabled.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool close();
+
+            /**
+             * Method you can use to determine if the archive is open.
+             *
+             * \return Returns true if the archive is open.  Returns false if the archive is closed.
+             */
+            bool isOpen() const;
+
+            /**
+             * Method you can use to determine if the archive holds an entry.
+             *
+             * \param[in] name The name of the entry.
+             *
+             * \return Returns true if the entry exists.  Returns false if the entry does not exist.
+             */
+            bool contains(const std::string& name) const;
+
+            /**
+             * Method you can use to determine the type of an entry.
+             *
+             * \param[in] name The name of the entry.
+             *
+             * \return Returns the type of the entry.  Returns ValueType::NONE if the entry does not exist.
+             */
+            ValueType valueType(const std::string& name) const;
+
+            /**
+             * Method you can use to obtain the names of every entry in the archive, in the order the entries were
+             * first written.
+             *
+             * \return Returns a list of entry names.
+             */
+            std::vector<std::string> names() const;
+
+            /**
+             * Method you can use to append an entry to the archive.  This method will throw an exception if an error
+             * occurs and the associated exception is enabled.
+             *
+             * \param[in] name  The name of the entry.
+             *
+             * \param[in] value The value to be stored.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool append(const std::string& name, const Variant& value);
+
+            /**
+             * Method you can use to read an entry from the archive.  This method will throw an exception if an error
+             * occurs and the associated exception is enabled.
+             *
+             * \param[in] name The name of the entry.
+             *
+             * \return Returns the stored value.  An empty variant is returned on error.
+             */
+            Variant value(const std::string& name) const;
+
+        private:
+            class Private;
+            Private* impl;
+    };
+}
+
+#endif
@@ -0,0 +1,335 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+*
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This header defines the \ref M::IterativeSolver class.
+***********************************************************************************************************************/
+
+/* .. sphinx-project inem */
+
+#ifndef M_ITERATIVE_SOLVER_H
+#define M_ITERATIVE_SOLVER_H
+
+#include "m_common.h"
+#include "m_intrinsic_types.h"
+#include "m_matrix_real.h"
+#include "m_matrix_complex.h"
+
+namespace M {
+    /**
+     * Class that solves systems of linear equations of the form \f[ A \times X = Y \f] using iterative Krylov
+     * subspace methods.  The class works with both dense and sparse real and complex matrices.
+     *
+     * Unlike the direct methods provided by \ref M::MatrixReal::solve and \ref M::MatrixComplex::solve, iterative
+     * methods can start from an initial guess.  Models that repeatedly solve slowly changing systems can therefore
+     * pass the previous solution to reduce the number of iterations needed.
+     *
+     * Each column of Y is solved independently.  The convergence details reported by the class reflect the worst
+     * case across all columns of the last solve.
+     */
+    class M_PUBLIC_API IterativeSolver {
+        public:
+            /**
+             * Enumeration of supported iterative methods.
+             */
+            enum class Method {
+                /**
+                 * Indicates the conjugate gradient method.  The method requires A to be Hermitian positive definite.
+                 */
+                CONJUGATE_GRADIENT,
+
+                /**
+                 * Indicates the stabilized bi-conjugate gradient method.  The method supports general square
+                 * matrices.
+                 */
+                BICGSTAB,
+
+                /**
+                 * Indicates the restarted generalized minimal residual method.  The method supports general square
+                 * matrices.
+                 */
+                GMRES
+            };
+
+            /**
+             * Enumeration of supported preconditioners.
+             */
+            enum class Preconditioner {
+                /**
+                 * Indicates no preconditioning.
+                 */
+                NONE,
+
+                /**
+                 * Indicates Jacobi (diagonal) preconditioning.
+                 */
+                JACOBI,
+
+                /**
+                 * Indicates an incomplete LU factorization with no fill, ILU(0).
+                 */
+                ILU0,
+
+                /**
+                 * Indicates an incomplete Cholesky factorization with no fill, IC(0).  The preconditioner requires
+                 * A to be Hermitian positive definite.  Only the lower triangle of A is used.
+                 */
+                INCOMPLETE_CHOLESKY
+            };
+
+            /**
+             * The default relative residual tolerance.
+             */
+            static constexpr Real defaultTolerance = 1.0E-10;
+
+            /**
+             * The default maximum number of iterations.
+             */
+            static constexpr unsigned long defaultMaximumIterations = 1000;
+
+            /**
+             * The default number of GMRES iterations between restarts.
+             */
+            static constexpr unsigned long defaultRestart = 30;
+
+            /**
+             * Constructor
+             *
+             * \param[in] method            The iterative method to use.
+             *
+             * \param[in] preconditioner    The preconditioner to use.
+             *
+             * \param[in] tolerance         The relative residual tolerance.  Iteration stops once the 2-norm of the
+             *                              residual is at or below this value times the 2-norm of the right hand
+             *                              side.
+             *
+             * \param[in] maximumIterations The maximum number of iterations per right hand side.
+             */
+            IterativeSolver(
+                Method         method = Method::GMRES,
+                Preconditioner preconditioner = Preconditioner::NONE,
+                Real           tolerance = defaultTolerance,
+                unsigned long  maximumIterations = defaultMaximumIterations
+            );
+
+            ~IterativeSolver();
+
+            /**
+             * Method you can use to set the iterative method.
+             *
+             * \param[in] newMethod The new iterative method.
+             */
+            void setMethod(Method newMethod);
+
+            /**
+             * Method you can use to determine the iterative method.
+             *
+             * \return Returns the current iterative method.
+             */
+            Method method() const;
+
+            /**
+             * Method you can use to set the preconditioner.
+             *
+             * \param[in] newPreconditioner The new preconditioner.
+             */
+            void setPreconditioner(Preconditioner newPreconditioner);
+
+            /**
+             * Method you can use to determine the preconditioner.
+             *
+             * \return Returns the current preconditioner.
+             */
+            Preconditioner preconditioner() const;
+
+            /**
+             * Method you can use to set the relative residual tolerance.
+             *
+             * \param[in] newTolerance The new relative residual tolerance.
+             */
+            void setTolerance(Real newTolerance);
+
+            /**
+             * Method you can use to determine the relative residual tolerance.
+             *
+             * \return Returns the current relative residual tolerance.
+             */
+            Real tolerance() const;
+
+            /**
+             * Method you can use to set the maximum number of iterations per right hand side.
+             *
+             * \param[in] newMaximumIterations The new maximum number of iterations.
+             */
+            void setMaximumIterations(unsigned long newMaximumIterations);
+
+            /**
+             * Method you can use to determine the maximum number of iterations per right hand side.
+             *
+             * \return Returns the current maximum number of iterations.
+             */
+            unsigned long maximumIterations() const;
+
+            /**
+             * Method you can use to set the number of GMRES iterations between restarts.  This value is ignored by
+             * the other methods.
+             *
+             * \param[in] newRestart The new restart length.  A value of 0 is treated as 1.
+             */
+            void setRestart(unsigned long newRestart);
+
+            /**
+             * Method you can use to determine the number of GMRES iterations between restarts.
+             *
+             * \return Returns the current restart length.
+             */
+            unsigned long restart() const;
+
+            /**
+             * Method you can use to solve a real system of linear equations starting from a zero initial guess.
+             *
+             * \param[in] a The square coefficient matrix.
+             *
+             * \param[in] y The right hand side.  Each column is solved independently.
+             *
+             * \return Returns the approximate solution.  The last iterate is returned if the method did not converge.
+             */
+            MatrixReal solve(const MatrixReal& a, const MatrixReal& y);
+
+            /**
+             * Method you can use to solve a real system of linear equations starting from an initial guess.
+             *
+             * \param[in] a            The square coefficient matrix.
+             *
+             * \param[in] y            The right hand side.  Each column is solved independently.
+             *
+             * \param[in] initialGuess The initial guess.  The initial guess must have the same dimensions as the
+             *                         solution.
+             *
+             * \return Returns the approximate solution.  The last iterate is returned if the method did not converge.
+             */
+            MatrixReal solve(const MatrixReal& a, const MatrixReal& y, const MatrixReal& initialGuess);
+
+            /**
+             * Method you can use to solve a complex system of linear equations starting from a zero initial guess.
+             *
+             * \param[in] a The square coefficient matrix.
+             *
+             * \param[in] y The right hand side.  Each column is solved independently.
+             *
+             * \return Returns the approximate solution.  The last iterate is returned if the method did not converge.
+             */
+            MatrixComplex solve(const MatrixComplex& a, const MatrixComplex& y);
+
+            /**
+             * Method you can use to solve a complex system of linear equations starting from an initial guess.
+             *
+             * \param[in] a            The square coefficient matrix.
+             *
+             * \param[in] y            The right hand side.  Each column is solved independently.
+             *
+             * \param[in] initialGuess The initial guess.  The initial guess must have the same dimensions as the
+             *                         solution.
+             *
+             * \return Returns the approximate solution.  The last iterate is returned if the method did not converge.
+             */
+            MatrixComplex solve(const MatrixComplex& a, const MatrixComplex& y, const MatrixComplex& initialGuess);
+
+            /**
+             * Method you can use to determine if the last solve converged for every right hand side.
+             *
+             * \return Returns true if the last solve converged.  Returns false if the last solve did not converge.
+             */
+            bool converged() const;
+
+            /**
+             * Method you can use to determine the number of iterations used by the last solve.
+             *
+             * \return Returns the largest number of iterations needed for any right hand side.
+             */
+            unsigned long numberIterations() const;
+
+            /**
+             * Method you can use to determine the relative residual reached by the last solve.
+             *
+             * \return Returns the largest relative residual across all right hand sides.
+             */
+            Real relativeResidual() const;
+
+        private:
+            /**
+             * Template method that performs the solve for either real or complex matrices.
+             *
+             * \param[in] a            The square coefficient matrix.
+             *
+             * \param[in] y            The right hand side.
+             *
+             * \param[in] initialGuess Pointer to the initial guess.  A null pointer indicates a zero initial guess.
+             *
+             * \return Returns the approximate solution.
+             */
+            template<typename T> T solveSystem(const T& a, const T& y, const T* initialGuess);
+
+            /**
+             * The current iterative method.
+             */
+            Method currentMethod;
+
+            /**
+             * The current preconditioner.
+             */
+            Preconditioner currentPreconditioner;
+
+            /**
+             * The current relative residual tolerance.
+             */
+            Real currentTolerance;
+
+            /**
+             * The current maximum number of iterations.
+             */
+            unsigned long currentMaximumIterations;
+
+            /**
+             * The current GMRES restart length.
+             */
+            unsigned long currentRestart;
+
+            /**
+             * Flag indicating if the last solve converged.
+             */
+            bool lastConverged;
+
+            /**
+             * The number of iterations used by the last solve.
+             */
+            unsigned long lastNumberIterations;
+
+            /**
+             * The relative residual reached by the last solve.
+             */
+            Real lastRelativeResidual;
+    };
+}
+
+#endif
@@ -30,6 +30,8 @@
 #ifndef M_MATRIX_BOOLEAN_H
 #define M_MATRIX_BOOLEAN_H
 
+#include <memory>
+
 #include "m_common.h"
 #include "m_api_types.h"
 #include "m_intrinsics.h"
@@ -502,6 +504,16 @@ namespace M {
                 return MatrixBoolean(numberRowColumns, numberRowColumns);
             }
 
+            /**
+             * Method you can use to obtain an empty sparse matrix of a specified size.  All coefficients of the
+             * returned matrix are false and no storage is consumed for the coefficients.
+             *
+             * \param[in] numberRows    The number of rows in the matrix.
+             *
+             * \param[in] numberColumns The number of columns in the matrix.
+             */
+            static MatrixBoolean sparse(Index numberRows, Index numberColumns);
+
             /**
              * Method you can use to obtain a one's matrix of a specified size.
              *
@@ -2046,6 +2058,187 @@ namespace M {
              */
             MatrixType matrixType() const override;
 
+            /**
+             * Method you can use to obtain a copy of this matrix using compressed sparse column storage.  Only
+             * true coefficients are stored.
+             *
+             * \return Returns a sparse copy of this matrix.
+             */
+            MatrixBoolean toSparse() const;
+
+            /**
+             * Method you can use to obtain a copy of this matrix using dense storage.
+             *
+             * \return Returns a dense copy of this matrix.
+             */
+            MatrixBoolean toDense() const;
+
+            /**
+             * Method you can use to obtain every coefficient in a column.  Coefficients are unpacked from the
+             * underlying storage a word at a time.  Sparse matrices will be converted to dense storage by this
+             * method.  This method will throw an exception if the column is invalid.
+             *
+             * \param[in]  column The one based column number.
+             *
+             * \param[out] values Array to receive the column coefficients.  The array must hold at least
+             *                    \ref M::MatrixBoolean::numberRows entries.
+             */
+            void columnValues(Index column, Scalar* values) const;
+
+            /**
+             * Method you can use to replace every coefficient in a column.  Coefficients are packed into the
+             * underlying storage a word at a time.  Sparse matrices will be converted to dense storage by this
+             * method.  This method will throw an exception if the column is invalid.
+             *
+             * \param[in] column The one based column number.
+             *
+             * \param[in] values Array holding the new column coefficients.  The array must hold at least
+             *                   \ref M::MatrixBoolean::numberRows entries.
+             */
+            void updateColumn(Index column, const Scalar* values);
+
+            /**
+             * Method you can use to visit every coefficient in column major order.  Dense matrices are unpacked one
+             * column at a time.  Sparse matrices are visited by position and are not converted to dense storage.
+             *
+             * \param[in] function The function to call.  The function is called with each coefficient.
+             */
+            template<typename F> M_PUBLIC_TEMPLATE_METHOD void forEach(F function) const {
+                Index nr = numberRows();
+                Index nc = numberColumns();
+
+                if (matrixType() == MatrixType::SPARSE) {
+                    for (Index column=1 ; column<=nc ; ++column) {
+                        for (Index row=1 ; row<=nr ; ++row) {
+                            function(at(row, column));
+                        }
+                    }
+                } else {
+                    std::unique_ptr<Scalar[]> values(new Scalar[nr]);
+                    for (Index column=1 ; column<=nc ; ++column) {
+                        columnValues(column, values.get());
+                        for (Index row=0 ; row<nr ; ++row) {
+                            function(values[row]);
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Method you can use to replace every coefficient, in place and in column major order, with the value
+             * returned by a function.  Sparse matrices will be converted to dense storage by this method.
+             *
+             * \param[in] function The function to call.  The function is called with each coefficient and must
+             *                     return the new coefficient value.
+             */
+            template<typename F> M_PUBLIC_TEMPLATE_METHOD void transform(F function) {
+                Index nr = numberRows();
+                Index nc = numberColumns();
+
+                std::unique_ptr<Scalar[]> values(new Scalar[nr]);
+                for (Index column=1 ; column<=nc ; ++column) {
+                    columnValues(column, values.get());
+                    for (Index row=0 ; row<nr ; ++row) {
+                        values[row] = function(values[row]);
+                    }
+
+                    updateColumn(column, values.get());
+                }
+            }
+
+            /**
+             * Method that calculates the element-wise logical AND of this matrix and another matrix.  Dense storage
+             * is used and 64 entries are processed per operation.
+             *
+             * \param[in] other The other matrix.  The matrix must have the same dimensions as this matrix.
+             *
+             * \return Returns the element-wise logical AND of the two matrices.
+             */
+            MatrixBoolean logicalAnd(const MatrixBoolean& other) const;
+
+            /**
+             * Method that calculates the element-wise logical OR of this matrix and another matrix.  Dense storage
+             * is used and 64 entries are processed per operation.
+             *
+             * \param[in] other The other matrix.  The matrix must have the same dimensions as this matrix.
+             *
+             * \return Returns the element-wise logical OR of the two matrices.
+             */
+            MatrixBoolean logicalOr(const MatrixBoolean& other) const;
+
+            /**
+             * Method that calculates the element-wise logical exclusive OR of this matrix and another matrix.  Dense
+             * storage is used and 64 entries are processed per operation.
+             *
+             * \param[in] other The other matrix.  The matrix must have the same dimensions as this matrix.
+             *
+             * \return Returns the element-wise logical exclusive OR of the two matrices.
+             */
+            MatrixBoolean logicalExclusiveOr(const MatrixBoolean& other) const;
+
+            /**
+             * Method that calculates the element-wise logical complement of this matrix.
+             *
+             * \return Returns the element-wise logical complement of this matrix.
+             */
+            MatrixBoolean logicalNot() const;
+
+            /**
+             * Method that calculates the product of this matrix and another matrix over the boolean semiring.  Each
+             * result entry is true if any term of the corresponding row and column are both true.  Applied to an
+             * adjacency matrix, the product identifies vertices reachable by paths of combined length.
+             *
+             * Note that the \ref operator* on two boolean matrices returns an integer matrix holding the number of
+             * true terms.
+             *
+             * \param[in] multiplicand The multiplicand.  The number of rows must match the number of columns in
+             *                         this matrix.
+             *
+             * \return Returns the boolean product of the two matrices.
+             */
+            MatrixBoolean booleanProduct(const MatrixBoolean& multiplicand) const;
+
+            /**
+             * Method that calculates the product of this matrix and another matrix over GF(2).  Each result entry is
+             * true if an odd number of terms of the corresponding row and column are both true.
+             *
+             * \param[in] multiplicand The multiplicand.  The number of rows must match the number of columns in
+             *                         this matrix.
+             *
+             * \return Returns the GF(2) product of the two matrices.
+             */
+            MatrixBoolean gf2Product(const MatrixBoolean& multiplicand) const;
+
+            /**
+             * Method that calculates the transitive closure of this matrix, treated as the adjacency matrix of a
+             * directed graph.  Entry (i, j) of the result is true if vertex j can be reached from vertex i.
+             *
+             * \return Returns the transitive closure of this matrix.
+             */
+            MatrixBoolean transitiveClosure() const;
+
+            /**
+             * Method that performs one step of a breadth first search over the directed graph described by this
+             * adjacency matrix.  Entry (i, j) of this matrix indicates an edge from vertex i to vertex j.
+             *
+             * \param[in] frontier The column vector of vertices in the current frontier.
+             *
+             * \param[in] visited  The column vector of vertices that have already been visited.
+             *
+             * \return Returns a column vector holding the unvisited vertices reachable by a single edge from the
+             *         frontier.
+             */
+            MatrixBoolean expandFrontier(const MatrixBoolean& frontier, const MatrixBoolean& visited) const;
+
+            /**
+             * Method that labels the connected components of the graph described by this adjacency matrix.  Edge
+             * direction is ignored.
+             *
+             * \return Returns a column vector holding the one based component label of each vertex.  Components
+             *         are numbered in order of their lowest vertex.
+             */
+            MatrixInteger connectedComponents() const;
+
             /**
              * Assignment operator
              *
@@ -2171,6 +2364,48 @@ namespace M {
                 return !operator==(other);
             }
 
+            /**
+             * Element-wise logical AND operator.
+             *
+             * \param[in] other The other matrix.
+             *
+             * \return Returns the element-wise logical AND of the two matrices.
+             */
+            inline MatrixBoolean operator&&(const MatrixBoolean& other) const {
+                return logicalAnd(other);
+            }
+
+            /**
+             * Element-wise logical OR operator.
+             *
+             * \param[in] other The other matrix.
+             *
+             * \return Returns the element-wise logical OR of the two matrices.
+             */
+            inline MatrixBoolean operator||(const MatrixBoolean& other) const {
+                return logicalOr(other);
+            }
+
+            /**
+             * Element-wise logical exclusive OR operator.
+             *
+             * \param[in] other The other matrix.
+             *
+             * \return Returns the element-wise logical exclusive OR of the two matrices.
+             */
+            inline MatrixBoolean operator^(const MatrixBoolean& other) const {
+                return logicalExclusiveOr(other);
+            }
+
+            /**
+             * Element-wise logical complement operator.
+             *
+             * \return Returns the element-wise logical complement of this matrix.
+             */
+            inline MatrixBoolean operator!() const {
+                return logicalNot();
+            }
+
             /**
              * Array subscript operator.
              *
@@ -2305,6 +2540,19 @@ namespace M {
              */
             void applyTransform() const;
 
+            /**
+             * Method that returns a version of this matrix backed by a dense data store with no pending transpose.
+             * Dense matrices share their data store with the returned matrix.
+             *
+             * \return Returns a dense version of this matrix.
+             */
+            MatrixBoolean denseUntransposed() const;
+
+            /**
+             * Method that converts this matrix to dense storage, in place, applying any pending transpose.
+             */
+            void convertToDenseDataStore() const;
+
             /**
              * Instance that provides the underlying data store for the matrix.
              */
@@ -5352,6 +5352,351 @@ namespace M {
     M_PUBLIC_API inline MatrixReal imag(const MatrixComplex& matrix) {
         return matrix.imag();
     }
+
+    /**
+     * Function that calculates the exponential of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the exponential of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal exp(const MatrixReal& matrix) {
+        return matrix.exp();
+    }
+
+    /**
+     * Function that calculates the sine of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the sine of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal sine(const MatrixReal& matrix) {
+        return matrix.sine();
+    }
+
+    /**
+     * Function that calculates the cosine of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the cosine of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal cosine(const MatrixReal& matrix) {
+        return matrix.cosine();
+    }
+
+    /**
+     * Function that calculates the tangent of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the tangent of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal tangent(const MatrixReal& matrix) {
+        return matrix.tangent();
+    }
+
+    /**
+     * Function that calculates the inverse sine of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the inverse sine of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal arcsine(const MatrixReal& matrix) {
+        return matrix.arcsine();
+    }
+
+    /**
+     * Function that calculates the inverse cosine of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the inverse cosine of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal arccosine(const MatrixReal& matrix) {
+        return matrix.arccosine();
+    }
+
+    /**
+     * Function that calculates the inverse tangent of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the inverse tangent of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal arctangent(const MatrixReal& matrix) {
+        return matrix.arctangent();
+    }
+
+    /**
+     * Function that calculates the hyperbolic sine of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the hyperbolic sine of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal hyperbolicSine(const MatrixReal& matrix) {
+        return matrix.hyperbolicSine();
+    }
+
+    /**
+     * Function that calculates the hyperbolic cosine of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the hyperbolic cosine of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal hyperbolicCosine(const MatrixReal& matrix) {
+        return matrix.hyperbolicCosine();
+    }
+
+    /**
+     * Function that calculates the hyperbolic tangent of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the hyperbolic tangent of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal hyperbolicTangent(const MatrixReal& matrix) {
+        return matrix.hyperbolicTangent();
+    }
+
+    /**
+     * Function that calculates the error function of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the error function of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal erf(const MatrixReal& matrix) {
+        return matrix.erf();
+    }
+
+    /**
+     * Function that calculates the complementary error function of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the complementary error function of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal erfc(const MatrixReal& matrix) {
+        return matrix.erfc();
+    }
+
+    /**
+     * Function that calculates the gamma function of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the gamma function of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal gamma(const MatrixReal& matrix) {
+        return matrix.gamma();
+    }
+
+    /**
+     * Function that calculates the natural log of the gamma function of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the natural log of the gamma function of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixReal lnGamma(const MatrixReal& matrix) {
+        return matrix.lnGamma();
+    }
+
+    /**
+     * Function that calculates the natural log of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the natural log of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex ln(const MatrixReal& matrix) {
+        return matrix.ln();
+    }
+
+    /**
+     * Function that calculates the square root of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the square root of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex sqrt(const MatrixReal& matrix) {
+        return matrix.sqrt();
+    }
+
+    /**
+     * Function that calculates the exponential of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the exponential of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex exp(const MatrixComplex& matrix) {
+        return matrix.exp();
+    }
+
+    /**
+     * Function that calculates the natural log of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the natural log of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex ln(const MatrixComplex& matrix) {
+        return matrix.ln();
+    }
+
+    /**
+     * Function that calculates the square root of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the square root of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex sqrt(const MatrixComplex& matrix) {
+        return matrix.sqrt();
+    }
+
+    /**
+     * Function that calculates the sine of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the sine of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex sine(const MatrixComplex& matrix) {
+        return matrix.sine();
+    }
+
+    /**
+     * Function that calculates the cosine of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the cosine of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex cosine(const MatrixComplex& matrix) {
+        return matrix.cosine();
+    }
+
+    /**
+     * Function that calculates the tangent of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the tangent of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex tangent(const MatrixComplex& matrix) {
+        return matrix.tangent();
+    }
+
+    /**
+     * Function that calculates the inverse sine of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the inverse sine of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex arcsine(const MatrixComplex& matrix) {
+        return matrix.arcsine();
+    }
+
+    /**
+     * Function that calculates the inverse cosine of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the inverse cosine of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex arccosine(const MatrixComplex& matrix) {
+        return matrix.arccosine();
+    }
+
+    /**
+     * Function that calculates the inverse tangent of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the inverse tangent of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex arctangent(const MatrixComplex& matrix) {
+        return matrix.arctangent();
+    }
+
+    /**
+     * Function that calculates the hyperbolic sine of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the hyperbolic sine of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex hyperbolicSine(const MatrixComplex& matrix) {
+        return matrix.hyperbolicSine();
+    }
+
+    /**
+     * Function that calculates the hyperbolic cosine of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the hyperbolic cosine of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex hyperbolicCosine(const MatrixComplex& matrix) {
+        return matrix.hyperbolicCosine();
+    }
+
+    /**
+     * Function that calculates the hyperbolic tangent of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the hyperbolic tangent of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex hyperbolicTangent(const MatrixComplex& matrix) {
+        return matrix.hyperbolicTangent();
+    }
+
+    /**
+     * Function that calculates the gamma function of each value in a matrix.
+     *
+     * \param[in] matrix The matrix to operate on.
+     *
+     * \return Returns a matrix holding the gamma function of each coefficient.
+     */
+    M_PUBLIC_API inline MatrixComplex gamma(const MatrixComplex& matrix) {
+        return matrix.gamma();
+    }
+
+    /**
+     * Function that raises each value in a matrix to a power.
+     *
+     * \param[in] base     The matrix to operate on.
+     *
+     * \param[in] exponent The exponent to apply.
+     *
+     * \return Returns a complex matrix holding each coefficient raised to the exponent.
+     */
+    M_PUBLIC_API inline MatrixComplex pow(const MatrixReal& base, Real exponent) {
+        return base.pow(exponent);
+    }
+
+    /**
+     * Function that raises each value in a matrix to a power.
+     *
+     * \param[in] base     The matrix to operate on.
+     *
+     * \param[in] exponent The exponent to apply.
+     *
+     * \return Returns a complex matrix holding each coefficient raised to the exponent.
+     */
+    M_PUBLIC_API inline MatrixComplex pow(const MatrixComplex& base, const Complex& exponent) {
+        return base.pow(exponent);
+    }
 }
 
 
@@ -323,6 +323,16 @@ namespace M {
                 return MatrixInteger(numberRowColumns, numberRowColumns);
             }
 
+            /**
+             * Method you can use to obtain an empty sparse matrix of a specified size.  All coefficients of the
+             * returned matrix are zero and no storage is consumed for the coefficients.
+             *
+             * \param[in] numberRows    The number of rows in the matrix.
+             *
+             * \param[in] numberColumns The number of columns in the matrix.
+             */
+            static MatrixInteger sparse(Index numberRows, Index numberColumns);
+
             /**
              * Method you can use to obtain a one's matrix of a specified size.
              *
@@ -1708,8 +1718,9 @@ namespace M {
             Variant at(const Variant& index) const;
 
             /**
-             * Method you can use to obtain a pointer to a coefficient value.  This method will throw an exception if
-             * the specified row or column is invalid.
+             * Method you can use to obtain a pointer to a coefficient value.  Sparse matrices will be converted to
+             * dense storage by this method.  This method will throw an exception if the specified row or column is
+             * invalid.
              *
              * \param[in] row    The one based row number.
              *
@@ -1901,19 +1912,126 @@ namespace M {
             MatrixType matrixType() const override;
 
             /**
-             * Method you can use to access and update the underlying raw matrix data.
+             * Method you can use to determine how many coefficients are held by the underlying data store.  Sparse
+             * matrices report the number of stored entries.  Dense matrices report the total number of coefficients.
+             *
+             * \return Returns the number of stored coefficients.
+             */
+            unsigned long long numberStoredCoefficients() const;
+
+            /**
+             * Method you can use to obtain a copy of this matrix using compressed sparse column storage.  Only
+             * non-zero coefficients are stored.
+             *
+             * \return Returns a sparse copy of this matrix.
+             */
+            MatrixInteger toSparse() const;
+
+            /**
+             * Method you can use to obtain a copy of this matrix using dense storage.
+             *
+             * \return Returns a dense copy of this matrix.
+             */
+            MatrixInteger toDense() const;
+
+            /**
+             * Method you can use to access and update the underlying raw matrix data.  Sparse matrices will be
+             * converted to dense storage by this method.
              *
              * \return Returns a pointer to the underlying raw matrix data.
              */
             Scalar* data();
 
             /**
-             * Method you can use to access the underlying raw matrix data.
+             * Method you can use to access the underlying raw matrix data.  Sparse matrices will be converted to dense
+             * storage by this method.
              *
              * \return Returns a pointer to the underlying raw matrix data.
              */
             const Scalar* data() const;
 
+            /**
+             * Method you can use to determine the distance between the first coefficients of adjacent columns in the
+             * raw matrix data.  Coefficients are stored in column major order with the coefficients of each column
+             * contiguous in memory.  Sparse matrices will be converted to dense storage by this method.
+             *
+             * \return Returns the column spacing, in coefficients.
+             */
+            unsigned long long columnSpacingInMemory() const;
+
+            /**
+             * Method you can use to access the raw data for a single column.  Sparse matrices will be converted to
+             * dense storage by this method.  This method will throw an exception if the column is invalid.
+             *
+             * \param[in] column The one based column number.
+             *
+             * \return Returns a pointer to the first coefficient of the column.
+             */
+            Scalar* columnData(Index column);
+
+            /**
+             * Method you can use to access the raw data for a single column.  Sparse matrices will be converted to
+             * dense storage by this method.  This method will throw an exception if the column is invalid.
+             *
+             * \param[in] column The one based column number.
+             *
+             * \return Returns a pointer to the first coefficient of the column.
+             */
+            const Scalar* columnData(Index column) const;
+
+            /**
+             * Method you can use to visit every coefficient in column major order.  Dense matrices are read directly
+             * from the raw matrix data, one column at a time.  Sparse matrices are visited by position and are not
+             * converted to dense storage.
+             *
+             * \param[in] function The function to call.  The function is called with each coefficient.
+             */
+            template<typename F> M_PUBLIC_TEMPLATE_METHOD void forEach(F function) const {
+                if (matrixType() == MatrixType::SPARSE) {
+                    Index nr = numberRows();
+                    Index nc = numberColumns();
+
+                    for (Index column=1 ; column<=nc ; ++column) {
+                        for (Index row=1 ; row<=nr ; ++row) {
+                            function(at(row, column));
+                        }
+                    }
+                } else {
+                    const Scalar*      d             = data();
+                    unsigned long      nr            = static_cast<unsigned long>(numberRows());
+                    unsigned long      nc            = static_cast<unsigned long>(numberColumns());
+                    unsigned long long columnSpacing = columnSpacingInMemory();
+
+                    for (unsigned long columnIndex=0 ; columnIndex<nc ; ++columnIndex) {
+                        const Scalar* column = d + columnSpacing * columnIndex;
+                        for (unsigned long rowIndex=0 ; rowIndex<nr ; ++rowIndex) {
+                            function(column[rowIndex]);
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Method you can use to replace every coefficient, in place and in column major order, with the value
+             * returned by a function.  Sparse matrices will be converted to dense storage by this method.
+             *
+             * \param[in] function The function to call.  The function is called with each coefficient and must
+             *                     return the new coefficient value.
+             */
+            template<typename F> M_PUBLIC_TEMPLATE_METHOD void transform(F function) {
+                Scalar*            d             = data();
+                unsigned long      nr            = static_cast<unsigned long>(numberRows());
+                unsigned long      nc            = static_cast<unsigned long>(numberColumns());
+                unsigned long long columnSpacing = columnSpacingInMemory();
+
+                for (unsigned long columnIndex=0 ; columnIndex<nc ; ++columnIndex) {
+                    Scalar* column = d + columnSpacing * columnIndex;
+                    for (unsigned long rowIndex=0 ; rowIndex<nr ; ++rowIndex) {
+                        column[rowIndex] = function(column[rowIndex]);
+                    }
+                }
+            }
+
             /**
              * Method you can use to generate an arbitrary matrix containing random integers.
              *
@@ -2343,11 +2461,28 @@ namespace M {
              */
             void assignExistingDataStore(Data* newDataStore, bool unlock) const;
 
+            /**
+             * Method that determines if results can be accumulated directly into this matrix's data store.  The data
+             * store must be dense, must not be shared with any other matrix, and must not have a pending transpose.
+             *
+             * \param[in] operand The data store of another operand taking part in the operation.
+             *
+             * \return Returns true if the data store can be updated in place.  Returns false if a new data store is
+             *         needed.
+             */
+            bool canAccumulateInPlace(const Data* operand) const;
+
             /**
              * Method that applies any pending lazy operations on this matrix.
              */
             void applyLazyTransformsAndScaling() const;
 
+            /**
+             * Method that converts the underlying data store to dense storage, if needed.  Any pending lazy operations
+             * are also applied.
+             */
+            void convertToDenseDataStore() const;
+
             /**
              * Instance that provides the underlying data store for the matrix.
              */
@@ -0,0 +1,198 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This header defines the \ref M::MatrixMemoryPool class.
+***********************************************************************************************************************/
+
+/* .. sphinx-project inem */
+
+#ifndef M_MATRIX_MEMORY_POOL_H
+#define M_MATRIX_MEMORY_POOL_H
+
+#include <string>
+
+#include "m_common.h"
+
+extern "C" typedef struct _MatApi MatApi;
+
+namespace M {
+    class MatrixPrivateBase;
+
+    /**
+     * Class that maintains a per-thread pool of memory blocks used by matrix data stores.  Freed blocks are kept in
+     * free lists, keyed by size class, so that temporaries created by expressions can be reused without calling back
+     * into the matrix API.
+     *
+     * Size classes are spaced at quarter powers of two.  Blocks larger than
+     * \ref M::MatrixMemoryPool::largestPooledBlock are never pooled.  Each thread caches at most
+     * \ref M::MatrixMemoryPool::maximumCachedBytes bytes.  When this limit would be exceeded, the pool is trimmed,
+     * releasing the largest blocks first.
+     *
+     * When out-of-core storage is enabled, blocks that cannot be allocated by the matrix API, or that are at least
+     * \ref M::MatrixMemoryPool::outOfCoreThresholdBytes in size, are placed in unlinked scratch files that are mapped
+     * into memory.  The operating system then pages these blocks to and from disk on demand, keeping the most recently
+     * used pages resident, so matrices larger than physical memory can be processed by the existing column major
+     * kernels.
+     */
+    class M_PUBLIC_API MatrixMemoryPool {
+        friend class MatrixPrivateBase;
+
+        public:
+            /**
+             * Structure holding pool usage counters for a single thread.
+             */
+            struct Statistics {
+                /**
+                 * The number of allocations requested.
+                 */
+                unsigned long long numberAllocations;
+
+                /**
+                 * The number of allocations satisfied from the pool.
+                 */
+                unsigned long long numberPoolHits;
+
+                /**
+                 * The number of blocks released.
+                 */
+                unsigned long long numberReleases;
+
+                /**
+                 * The number of released blocks that were placed in the pool.
+                 */
+                unsigned long long numberPooledReleases;
+
+                /**
+                 * The number of pooled blocks returned to the matrix API by trimming.
+                 */
+                unsigned long long numberTrimmedBlocks;
+
+                /**
+                 * The number of bytes currently held by the pool.
+                 */
+                unsigned long long cachedBytes;
+
+                /**
+                 * The number of allocations placed in disk backed scratch files.
+                 */
+                unsigned long long numberOutOfCoreAllocations;
+            };
+
+            /**
+             * The default maximum number of bytes cached by each thread.
+             */
+            static constexpr unsigned long long defaultMaximumCachedBytes = 64 * 1024 * 1024;
+
+            /**
+             * The largest block, in bytes, that will be pooled.
+             */
+            static constexpr unsigned long long largestPooledBlock = 16 * 1024 * 1024;
+
+            /**
+             * Method you can use to set the maximum number of bytes cached by each thread.  The new limit is applied
+             * by each thread the next time it releases a block.
+             *
+             * \param[in] newMaximumCachedBytes The new limit, in bytes.  A value of 0 disables pooling.
+             */
+            static void setMaximumCachedBytes(unsigned long long newMaximumCachedBytes);
+
+            /**
+             * Method you can use to determine the maximum number of bytes cached by each thread.
+             *
+             * \return Returns the current limit, in bytes.
+             */
+            static unsigned long long maximumCachedBytes();
+
+            /**
+             * Method you can use to set the size above which blocks are placed in disk backed scratch files.
+             *
+             * \param[in] newThresholdBytes The new threshold, in bytes.  A value of 0 disables scratch files so that
+             *                              blocks the matrix API can not allocate are reported as insufficient memory.
+             */
+            static void setOutOfCoreThresholdBytes(unsigned long long newThresholdBytes);
+
+            /**
+             * Method you can use to determine the size above which blocks are placed in disk backed scratch files.
+             *
+             * \return Returns the current threshold, in bytes.  A value of 0 indicates that scratch files are disabled.
+             */
+            static unsigned long long outOfCoreThresholdBytes();
+
+            /**
+             * Method you can use to set the directory used to hold scratch files.
+             *
+             * \param[in] newDirectory The new directory.  An empty string selects the system temporary directory.
+             */
+            static void setOutOfCoreDirectory(const std::string& newDirectory);
+
+            /**
+             * Method you can use to determine the directory used to hold scratch files.
+             *
+             * \return Returns the directory.  An empty string indicates the system temporary directory.
+             */
+            static std::string outOfCoreDirectory();
+
+            /**
+             * Method you can use to release every block cached by the calling thread.
+             */
+            static void trim();
+
+            /**
+             * Method you can use to obtain the pool counters for the calling thread.
+             *
+             * \return Returns the pool counters for the calling thread.
+             */
+            static Statistics statistics();
+
+            /**
+             * Method you can use to reset the pool counters for the calling thread.  The cached byte count is not
+             * modified.
+             */
+            static void resetStatistics();
+
+        private:
+            /**
+             * Method that allocates a block, using a pooled block when possible.
+             *
+             * \param[in] matrixApi The matrix API used to allocate new blocks.
+             *
+             * \param[in] space     The required space, in bytes.
+             *
+             * \return Returns a pointer to the allocated block.  A null pointer is returned if the matrix API could
+             *         not allocate the block.
+             */
+            static void* allocate(const MatApi* matrixApi, unsigned long long space);
+
+            /**
+             * Method that releases a block previously allocated by \ref M::MatrixMemoryPool::allocate.
+             *
+             * \param[in] matrixApi The matrix API used to release blocks.
+             *
+             * \param[in] p         Pointer to the block to be released.
+             */
+            static void release(const MatApi* matrixApi, void* p);
+    };
+}
+
+#endif
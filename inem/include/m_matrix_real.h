@@ -50,12 +50,17 @@ namespace M {
 
     /**
      * Matrix class holding real values.  This class uses copy-on-write semantics to reduce memory utilization as well
-     * as lazy evaluation of expressions to reduce processing overhead.
+     * as lazy evaluation of expressions to reduce processing overhead.  Dense matrices with no more than four rows and
+     * columns are held directly within the class instance and only moved to a separately allocated data store when
+     * they grow or when an operation requires one.  Submatrices selected by integer ranges are returned as views that
+     * read the coefficients of the source matrix in place.  A view is copied into its own data store when it is
+     * modified or used by an operation that needs one.
      */
     class M_PUBLIC_API MatrixReal:public Model::Matrix {
         friend class MatrixBoolean;
         friend class MatrixInteger;
         friend class MatrixComplex;
+        friend class IterativeSolver;
 
         public:
             /**
@@ -135,6 +140,13 @@ namespace M {
              */
             MatrixReal(const MatrixReal& other);
 
+            /**
+             * Move constructor.  The moved-from instance is left as an empty matrix.
+             *
+             * \param[in] other The instance to be moved.
+             */
+            MatrixReal(MatrixReal&& other) noexcept;
+
             /**
              * Copy constructor
              *
@@ -322,9 +334,72 @@ namespace M {
              * \param[in] numberRowColumns The number of rows in the matrix.
              */
             static inline MatrixReal zero(Index numberRowColumns) {
-                return MatrixReal(numberRowColumns, numberRowColumns);
+                return zero(numberRowColumns, numberRowColumns);
             }
 
+            /**
+             * Method you can use to obtain an empty sparse matrix of a specified size.  All coefficients of the
+             * returned matrix are zero and no storage is consumed for the coefficients.
+             *
+             * \param[in] numberRows    The number of rows in the matrix.
+             *
+             * \param[in] numberColumns The number of columns in the matrix.
+             */
+            static MatrixReal sparse(Index numberRows, Index numberColumns);
+
+            /**
+             * Method you can use to set the density at or below which large dense matrices are converted to sparse
+             * storage.  Counting the non-zero coefficients of a dense matrix requires a pass over the entire matrix so
+             * the density is only checked when matrices are loaded from a file and by \ref applyDensityThresholds.
+             * Results of arithmetic and matrices updated in place keep dense storage.  A value of 0 disables
+             * conversion to sparse storage.
+             *
+             * \param[in] newThreshold The new threshold, as a fraction of the matrix coefficients between 0 and 1.
+             */
+            static void setSparseDensityThreshold(Real newThreshold);
+
+            /**
+             * Method you can use to determine the density at or below which large dense matrices are converted to
+             * sparse storage.
+             *
+             * \return Returns the current sparse density threshold.
+             */
+            static Real sparseDensityThreshold();
+
+            /**
+             * Method you can use to set the density above which large sparse matrices are automatically converted to
+             * dense storage.  This value should be larger than the sparse density threshold so that matrices near the
+             * thresholds do not switch representation repeatedly.  A value of 1 or larger disables automatic
+             * conversion to dense storage.
+             *
+             * \param[in] newThreshold The new threshold, as a fraction of the matrix coefficients between 0 and 1.
+             */
+            static void setDenseDensityThreshold(Real newThreshold);
+
+            /**
+             * Method you can use to determine the density above which large sparse matrices are automatically
+             * converted to dense storage.
+             *
+             * \return Returns the current dense density threshold.
+             */
+            static Real denseDensityThreshold();
+
+            /**
+             * Method you can use to set the number of coefficients a matrix must have before its storage will be
+             * changed automatically.  Smaller matrices always keep the storage they were created with.
+             *
+             * \param[in] newMinimum The new minimum number of coefficients.
+             */
+            static void setAutomaticStorageMinimumCoefficients(unsigned long long newMinimum);
+
+            /**
+             * Method you can use to determine the number of coefficients a matrix must have before its storage will
+             * be changed automatically.
+             *
+             * \return Returns the current minimum number of coefficients.
+             */
+            static unsigned long long automaticStorageMinimumCoefficients();
+
             /**
              * Method you can use to obtain a one's matrix of a specified size.
              *
@@ -1710,8 +1785,9 @@ namespace M {
             Variant at(const Variant& index) const;
 
             /**
-             * Method you can use to obtain a pointer to a coefficient value.  This method will throw an exception if
-             * the specified row or column is invalid.
+             * Method you can use to obtain a pointer to a coefficient value.  Sparse matrices will be converted to
+             * dense storage by this method.  This method will throw an exception if the specified row or column is
+             * invalid.
              *
              * \param[in] row    The one based row number.
              *
@@ -2152,6 +2228,27 @@ namespace M {
              */
             MatrixReal kronecker(const MatrixReal& other) const;
 
+            /**
+             * Method that accumulates a matrix product into this matrix, calculating
+             * \f$ this = multiplier \times multiplicand + accumulatorScalar \times this \f$.  Pending transposes and
+             * scalar multipliers on all three matrices are folded into a single GEMM call that writes directly into
+             * this matrix's data store whenever that data store is dense and not shared.  Otherwise the result is
+             * calculated out of place.
+             *
+             * \param[in] multiplier        The left hand side of the product.
+             *
+             * \param[in] multiplicand      The right hand side of the product.
+             *
+             * \param[in] accumulatorScalar The value this matrix is scaled by before the product is added.
+             *
+             * \return Returns a reference to this instance.
+             */
+            MatrixReal& multiplyAccumulate(
+                const MatrixReal& multiplier,
+                const MatrixReal& multiplicand,
+                Scalar            accumulatorScalar = Scalar(1)
+            );
+
             /**
              * Method you can use to determine the underlying memory layout for the matrix.
              *
@@ -2160,19 +2257,134 @@ namespace M {
             MatrixType matrixType() const override;
 
             /**
-             * Method you can use to access the underlying raw matrix data.
+             * Method you can use to convert this matrix to the storage recommended by the density thresholds.  Large
+             * dense matrices at or below the sparse density threshold are converted to sparse storage and large sparse
+             * matrices above the dense density threshold are converted to dense storage.  This method requires a pass
+             * over every coefficient of a dense matrix.
+             */
+            void applyDensityThresholds();
+
+            /**
+             * Method you can use to determine how many coefficients are held by the underlying data store.  Sparse
+             * matrices report the number of stored entries.  Dense matrices report the total number of coefficients.
+             *
+             * \return Returns the number of stored coefficients.
+             */
+            unsigned long long numberStoredCoefficients() const;
+
+            /**
+             * Method you can use to obtain a copy of this matrix using compressed sparse column storage.  Only
+             * non-zero coefficients are stored.
+             *
+             * \return Returns a sparse copy of this matrix.
+             */
+            MatrixReal toSparse() const;
+
+            /**
+             * Method you can use to obtain a copy of this matrix using dense storage.
+             *
+             * \return Returns a dense copy of this matrix.
+             */
+            MatrixReal toDense() const;
+
+            /**
+             * Method you can use to access the underlying raw matrix data.  Sparse matrices will be converted to dense
+             * storage by this method.
              *
              * \return Returns a pointer to the underlying raw matrix data.
              */
             Scalar* data();
 
             /**
-             * Method you can use to access the underlying raw matrix data.
+             * Method you can use to access the underlying raw matrix data.  Sparse matrices will be converted to dense
+             * storage by this method.
              *
              * \return Returns a pointer to the underlying raw matrix data.
              */
             const Scalar* data() const;
 
+            /**
+             * Method you can use to determine the distance between the first coefficients of adjacent columns in the
+             * raw matrix data.  Coefficients are stored in column major order with the coefficients of each column
+             * contiguous in memory.  Sparse matrices will be converted to dense storage by this method.
+             *
+             * \return Returns the column spacing, in coefficients.
+             */
+            unsigned long long columnSpacingInMemory() const;
+
+            /**
+             * Method you can use to access the raw data for a single column.  Sparse matrices will be converted to
+             * dense storage by this method.  This method will throw an exception if the column is invalid.
+             *
+             * \param[in] column The one based column number.
+             *
+             * \return Returns a pointer to the first coefficient of the column.
+             */
+            Scalar* columnData(Index column);
+
+            /**
+             * Method you can use to access the raw data for a single column.  Sparse matrices will be converted to
+             * dense storage by this method.  This method will throw an exception if the column is invalid.
+             *
+             * \param[in] column The one based column number.
+             *
+             * \return Returns a pointer to the first coefficient of the column.
+             */
+            const Scalar* columnData(Index column) const;
+
+            /**
+             * Method you can use to visit every coefficient in column major order.  Dense matrices are read directly
+             * from the raw matrix data, one column at a time.  Sparse matrices are visited by position and are not
+             * converted to dense storage.
+             *
+             * \param[in] function The function to call.  The function is called with each coefficient.
+             */
+            template<typename F> M_PUBLIC_TEMPLATE_METHOD void forEach(F function) const {
+                if (matrixType() == MatrixType::SPARSE) {
+                    Index nr = numberRows();
+                    Index nc = numberColumns();
+
+                    for (Index column=1 ; column<=nc ; ++column) {
+                        for (Index row=1 ; row<=nr ; ++row) {
+                            function(at(row, column));
+                        }
+                    }
+                } else {
+                    const Scalar*      d             = data();
+                    unsigned long      nr            = static_cast<unsigned long>(numberRows());
+                    unsigned long      nc            = static_cast<unsigned long>(numberColumns());
+                    unsigned long long columnSpacing = columnSpacingInMemory();
+
+                    for (unsigned long columnIndex=0 ; columnIndex<nc ; ++columnIndex) {
+                        const Scalar* column = d + columnSpacing * columnIndex;
+                        for (unsigned long rowIndex=0 ; rowIndex<nr ; ++rowIndex) {
+                            function(column[rowIndex]);
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Method you can use to replace every coefficient, in place and in column major order, with the value
+             * returned by a function.  Sparse matrices will be converted to dense storage by this method.
+             *
+             * \param[in] function The function to call.  The function is called with each coefficient and must
+             *                     return the new coefficient value.
+             */
+            template<typename F> M_PUBLIC_TEMPLATE_METHOD void transform(F function) {
+                Scalar*            d             = data();
+                unsigned long      nr            = static_cast<unsigned long>(numberRows());
+                unsigned long      nc            = static_cast<unsigned long>(numberColumns());
+                unsigned long long columnSpacing = columnSpacingInMemory();
+
+                for (unsigned long columnIndex=0 ; columnIndex<nc ; ++columnIndex) {
+                    Scalar* column = d + columnSpacing * columnIndex;
+                    for (unsigned long rowIndex=0 ; rowIndex<nr ; ++rowIndex) {
+                        column[rowIndex] = function(column[rowIndex]);
+                    }
+                }
+            }
+
             /**
              * Method you can use to obtain a matrix holding the floor of each value in the matrix.
              *
@@ -2229,6 +2441,129 @@ namespace M {
              */
             MatrixInteger nintToInteger() const;
 
+            /**
+             * Method you can use to obtain a matrix holding the exponential of each value in the matrix.
+             *
+             * \return Returns a real matrix holding the exponential of each coefficient.
+             */
+            MatrixReal exp() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the sine of each value in the matrix.
+             *
+             * \return Returns a real matrix holding the sine of each coefficient.
+             */
+            MatrixReal sine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the cosine of each value in the matrix.
+             *
+             * \return Returns a real matrix holding the cosine of each coefficient.
+             */
+            MatrixReal cosine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the tangent of each value in the matrix.
+             *
+             * \return Returns a real matrix holding the tangent of each coefficient.
+             */
+            MatrixReal tangent() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the inverse sine of each value in the matrix.
+             *
+             * \return Returns a real matrix holding the inverse sine of each coefficient.
+             */
+            MatrixReal arcsine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the inverse cosine of each value in the matrix.
+             *
+             * \return Returns a real matrix holding the inverse cosine of each coefficient.
+             */
+            MatrixReal arccosine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the inverse tangent of each value in the matrix.
+             *
+             * \return Returns a real matrix holding the inverse tangent of each coefficient.
+             */
+            MatrixReal arctangent() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the hyperbolic sine of each value in the matrix.
+             *
+             * \return Returns a real matrix holding the hyperbolic sine of each coefficient.
+             */
+            MatrixReal hyperbolicSine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the hyperbolic cosine of each value in the matrix.
+             *
+             * \return Returns a real matrix holding the hyperbolic cosine of each coefficient.
+             */
+            MatrixReal hyperbolicCosine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the hyperbolic tangent of each value in the matrix.
+             *
+             * \return Returns a real matrix holding the hyperbolic tangent of each coefficient.
+             */
+            MatrixReal hyperbolicTangent() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the error function of each value in the matrix.
+             *
+             * \return Returns a real matrix holding the error function of each coefficient.
+             */
+            MatrixReal erf() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the complementary error function of each value in the
+             * matrix.
+             *
+             * \return Returns a real matrix holding the complementary error function of each coefficient.
+             */
+            MatrixReal erfc() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the gamma function of each value in the matrix.
+             *
+             * \return Returns a real matrix holding the gamma function of each coefficient.
+             */
+            MatrixReal gamma() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the natural log of the gamma function of each value in the
+             * matrix.
+             *
+             * \return Returns a real matrix holding the natural log of the gamma function of each coefficient.
+             */
+            MatrixReal lnGamma() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the natural log of each value in the matrix.
+             *
+             * \return Returns a complex matrix holding the natural log of each coefficient.
+             */
+            MatrixComplex ln() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the square root of each value in the matrix.
+             *
+             * \return Returns a complex matrix holding the square root of each coefficient.
+             */
+            MatrixComplex sqrt() const;
+
+            /**
+             * Method you can use to obtain a matrix holding each value raised to a power of each value in the matrix.
+             *
+             * \param[in] exponent The exponent to apply.
+             *
+             * \return Returns a complex matrix holding each value raised to a power of each coefficient.
+             */
+            MatrixComplex pow(Real exponent) const;
+
             /**
              * Method you can use to generate an arbitrary matrix containing uniform random values between 0 and 1,
              * inclusive.
@@ -2481,6 +2816,15 @@ namespace M {
              */
             MatrixReal& operator=(const MatrixReal& other);
 
+            /**
+             * Move assignment operator.  The moved-from instance is left as an empty matrix.
+             *
+             * \param[in] other The instance to be moved.
+             *
+             * \return Returns a reference to this instance.
+             */
+            MatrixReal& operator=(MatrixReal&& other) noexcept;
+
             /**
              * Assignment operator
              *
@@ -2620,7 +2964,19 @@ namespace M {
              *
              * \return Returns a matrix representing the sum.
              */
-            MatrixReal operator+(const MatrixReal& v) const;
+            MatrixReal operator+(const MatrixReal& v) const &;
+
+            /**
+             * Addition operator.  This version is used when this matrix is a temporary, such as an intermediate
+             * result in a longer expression.  Where possible the result is accumulated directly into the temporary's
+             * data store so chains such as \f$ a X + b Y + c Z \f$ are evaluated without allocating a new data
+             * store for each term.
+             *
+             * \param[in] v The value to add to this value.
+             *
+             * \return Returns a matrix representing the sum.
+             */
+            MatrixReal operator+(const MatrixReal& v) &&;
 
             /**
              * Subtraction operator.
@@ -2647,7 +3003,19 @@ namespace M {
              *
              * \return Returns a matrix representing the difference.
              */
-            MatrixReal operator-(const MatrixReal& v) const;
+            MatrixReal operator-(const MatrixReal& v) const &;
+
+            /**
+             * Subtraction operator.  This version is used when this matrix is a temporary, such as an intermediate
+             * result in a longer expression.  Where possible the result is accumulated directly into the temporary's
+             * data store so chains such as \f$ a X - b Y - c Z \f$ are evaluated without allocating a new data
+             * store for each term.
+             *
+             * \param[in] v The value to subtract from this value.
+             *
+             * \return Returns a matrix representing the difference.
+             */
+            MatrixReal operator-(const MatrixReal& v) &&;
 
             /**
              * Multiplication operator.
@@ -2854,6 +3222,52 @@ namespace M {
             class SparseData;
             class DenseData;
 
+            /**
+             * The largest number of rows or columns that can be held in the inline small matrix storage.
+             */
+            static constexpr unsigned smallMatrixMaximumDimension = 4;
+
+            /**
+             * Structure describing an evenly strided submatrix of a dense data store.
+             */
+            struct SubmatrixView {
+                /**
+                 * The dense data store holding the coefficients.  The view holds a reference to the data store.  A
+                 * null pointer indicates that the matrix is not a submatrix view.
+                 */
+                DenseData* parent;
+
+                /**
+                 * The zero based index of the first row of the data store included in the view.
+                 */
+                unsigned long firstRow;
+
+                /**
+                 * The signed distance between successive rows of the data store included in the view.
+                 */
+                long long rowStride;
+
+                /**
+                 * The number of rows in the view.
+                 */
+                unsigned long numberRows;
+
+                /**
+                 * The zero based index of the first column of the data store included in the view.
+                 */
+                unsigned long firstColumn;
+
+                /**
+                 * The signed distance between successive columns of the data store included in the view.
+                 */
+                long long columnStride;
+
+                /**
+                 * The number of columns in the view.
+                 */
+                unsigned long numberColumns;
+            };
+
             /**
              * Constructor
              *
@@ -2890,6 +3304,176 @@ namespace M {
              */
             void releaseDataStore(Data* dataStore) const;
 
+            /**
+             * Method that obtains the data store backing this matrix.  A matrix held in the inline small matrix storage
+             * or a submatrix view is first moved into a newly created dense data store.
+             *
+             * \return Returns the data store backing this matrix.
+             */
+            inline Data* dataStore() const {
+                if (currentData == nullptr) {
+                    materializeDataStore();
+                }
+
+                return currentData;
+            }
+
+            /**
+             * Method that determines if this matrix is held in the inline small matrix storage.
+             *
+             * \return Returns true if the matrix is held in the inline small matrix storage.  Returns false if the
+             *         matrix has a data store or is a submatrix view.
+             */
+            inline bool hasSmallStorage() const {
+                return currentData == nullptr && currentView.parent == nullptr;
+            }
+
+            /**
+             * Method that moves the contents of the inline small matrix storage or of a submatrix view into a newly
+             * created dense data store.  A submatrix view releases its reference to the source data store.  Any pending
+             * lazy operations are retained.
+             */
+            void materializeDataStore() const;
+
+            /**
+             * Method that makes this matrix share the contents of another matrix.  Any existing storage must have
+             * already been released.  Data stores and submatrix views are shared by reference, inline small matrix
+             * storage is copied.  Pending lazy operations are also copied.
+             *
+             * \param[in] other The matrix to be copied.
+             */
+            void copyStorage(const MatrixReal& other);
+
+            /**
+             * Method that moves the contents of another matrix into this matrix, leaving the other matrix as an empty
+             * matrix.  Any existing storage must have already been released.  Pending lazy operations are also moved.
+             *
+             * \param[in] other The matrix to be moved.
+             */
+            void moveStorage(MatrixReal& other) noexcept;
+
+            /**
+             * Method that releases the data store and any submatrix view held by this matrix.  The matrix must be
+             * assigned new storage after this call.
+             */
+            void releaseStorage() const;
+
+            /**
+             * Method that obtains a stored coefficient, ignoring any pending lazy operations.  The indexes must lie
+             * within the stored matrix.
+             *
+             * \param[in] rowIndex    The zero based row index.
+             *
+             * \param[in] columnIndex The zero based column index.
+             *
+             * \return Returns the stored coefficient.
+             */
+            Scalar storedCoefficient(unsigned long rowIndex, unsigned long columnIndex) const;
+
+            /**
+             * Method that creates an evenly strided submatrix of this matrix.  Small results are copied into the inline
+             * small matrix storage.  Larger results are returned as submatrix views of this matrix's dense data store.
+             * Pending lazy operations must have already been applied and the indexes must lie within the matrix.
+             *
+             * \param[in] firstRow      The zero based index of the first row.
+             *
+             * \param[in] rowStride     The signed distance between successive rows.
+             *
+             * \param[in] rowCount      The number of rows.
+             *
+             * \param[in] firstColumn   The zero based index of the first column.
+             *
+             * \param[in] columnStride  The signed distance between successive columns.
+             *
+             * \param[in] columnCount   The number of columns.
+             *
+             * \return Returns the submatrix.
+             */
+            MatrixReal submatrix(
+                unsigned long firstRow,
+                long long     rowStride,
+                unsigned long rowCount,
+                unsigned long firstColumn,
+                long long     columnStride,
+                unsigned long columnCount
+            ) const;
+
+            /**
+             * Method that switches this matrix to the inline small matrix storage.  Any existing data store must have
+             * already been released.  Pending lazy operations are discarded and coefficient values are left
+             * uninitialized.
+             *
+             * \param[in] newNumberRows    The new number of rows.  The value must not exceed
+             *                             \ref smallMatrixMaximumDimension.
+             *
+             * \param[in] newNumberColumns The new number of columns.  The value must not exceed
+             *                             \ref smallMatrixMaximumDimension.
+             */
+            void configureSmallStorage(unsigned long newNumberRows, unsigned long newNumberColumns) const;
+
+            /**
+             * Method that copies the inline small matrix storage of another matrix into this matrix.  Any existing data
+             * store must have already been released.  Pending lazy operations are not copied.
+             *
+             * \param[in] other The matrix to be copied.  The matrix must be held in the inline small matrix storage.
+             */
+            void copySmallStorage(const MatrixReal& other);
+
+            /**
+             * Method that resizes the inline small matrix storage, preserving existing coefficients and zero filling
+             * any new coefficients.  Any pending lazy operations must have already been applied.
+             *
+             * \param[in] newNumberRows    The new number of rows.  The value must not exceed
+             *                             \ref smallMatrixMaximumDimension.
+             *
+             * \param[in] newNumberColumns The new number of columns.  The value must not exceed
+             *                             \ref smallMatrixMaximumDimension.
+             */
+            void resizeSmallStorage(unsigned long newNumberRows, unsigned long newNumberColumns);
+
+            /**
+             * Method that determines if this matrix and another matrix can be added using the inline small matrix
+             * storage.
+             *
+             * \param[in] other The other operand.
+             *
+             * \return Returns true if both matrices use the inline small matrix storage and have the same dimensions.
+             */
+            bool canAddInline(const MatrixReal& other) const;
+
+            /**
+             * Method that determines if this matrix can be multiplied by another matrix using the inline small matrix
+             * storage.
+             *
+             * \param[in] other The multiplicand.
+             *
+             * \return Returns true if both matrices use the inline small matrix storage and have compatible, non-zero,
+             *         dimensions.
+             */
+            bool canMultiplyInline(const MatrixReal& other) const;
+
+            /**
+             * Method that places the scaled sum of two matrices held in the inline small matrix storage into this
+             * matrix.  Either operand may be this matrix.
+             *
+             * \param[in] augend   The augend.  The augend's pending scale factor is applied.
+             *
+             * \param[in] addend   The addend.  The addend's pending scale factor is applied.
+             *
+             * \param[in] subtract If true, the addend is subtracted from the augend.
+             */
+            void addSmallStorage(const MatrixReal& augend, const MatrixReal& addend, bool subtract);
+
+            /**
+             * Method that places the product of two matrices held in the inline small matrix storage into this matrix.
+             * Either operand may be this matrix.
+             *
+             * \param[in] multiplier   The multiplier.
+             *
+             * \param[in] multiplicand The multiplicand.
+             */
+            void multiplySmallStorage(const MatrixReal& multiplier, const MatrixReal& multiplicand);
+
             /**
              * Method that assigns a new data store to this class.  This version will not increment the reference count
              * of the data store.
@@ -2910,16 +3494,48 @@ namespace M {
              */
             void assignExistingDataStore(Data* newDataStore, bool unlock) const;
 
+            /**
+             * Method that determines if results can be accumulated directly into this matrix's data store.  The data
+             * store must be dense, must not be shared with any other matrix, and must not have a pending transpose.
+             *
+             * \param[in] operand The data store of another operand taking part in the operation.
+             *
+             * \return Returns true if the data store can be updated in place.  Returns false if a new data store is
+             *         needed.
+             */
+            bool canAccumulateInPlace(const Data* operand) const;
+
             /**
              * Method that applies any pending lazy operations on this matrix.
              */
             void applyLazyTransformsAndScaling() const;
 
             /**
-             * Instance that provides the underlying data store for the matrix.
+             * Method that converts the underlying data store to dense storage, if needed.  Any pending lazy operations
+             * are also applied.
+             */
+            void convertToDenseDataStore() const;
+
+            /**
+             * Method that converts the underlying data store between dense and sparse storage based on the current
+             * matrix density and the configured density thresholds.  Dense data stores are only checked if
+             * checkDense is true as counting the non-zero coefficients requires a pass over the entire matrix.
+             *
+             * \param[in] checkDense If true, dense data stores will be checked for conversion to sparse storage.
+             */
+            void applyStoragePolicy(bool checkDense = true) const;
+
+            /**
+             * Instance that provides the underlying data store for the matrix.  A null pointer indicates that the
+             * matrix is held in the inline small matrix storage or is a submatrix view.
              */
             mutable Data* currentData;
 
+            /**
+             * The submatrix view describing this matrix.  Only used when there is no data store.
+             */
+            mutable SubmatrixView currentView;
+
             /**
              * True if there is a pending transpose on the matrix.
              */
@@ -2929,6 +3545,22 @@ namespace M {
              * Current scaler value.
              */
             mutable Scalar pendingScalarValue;
+
+            /**
+             * The number of rows held in the inline small matrix storage.
+             */
+            mutable unsigned char smallNumberRows;
+
+            /**
+             * The number of columns held in the inline small matrix storage.
+             */
+            mutable unsigned char smallNumberColumns;
+
+            /**
+             * The inline small matrix storage.  Coefficients are stored in column major order with no padding between
+             * columns.  Only used when there is no data store.
+             */
+            mutable Scalar smallCoefficients[smallMatrixMaximumDimension * smallMatrixMaximumDimension];
     };
 
     /**
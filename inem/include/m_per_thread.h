@@ -352,6 +352,35 @@ namespace M {
              */
             void fillArray(void* array, unsigned long numberValues);
 
+            /**
+             * Method you can use to advance the RNG by 2^128 values.  Identically seeded instances advanced by a
+             * different number of jumps produce non-overlapping sequences.
+             *
+             * \return Returns true on success.  Returns false if the selected RNG does not support jump-ahead.
+             */
+            bool jump();
+
+            /**
+             * Method you can use to advance the RNG by 2^192 values.  You can use this method to create groups of
+             * substreams, each of which can be further divided using \ref M::PerThread::jump.
+             *
+             * \return Returns true on success.  Returns false if the selected RNG does not support jump-ahead.
+             */
+            bool longJump();
+
+            /**
+             * Method you can use to seed the RNG and then move it to a numbered substream.  Substreams are separated
+             * by 2^128 values so instances given the same seed and different substreams never overlap.
+             *
+             * \param[in] rngSeed   The RNG seed to apply.
+             *
+             * \param[in] substream The zero based substream index.
+             *
+             * \return Returns true on success.  Returns false if the selected RNG does not support jump-ahead.  The RNG
+             *         is left unchanged in that case.
+             */
+            bool selectSubstream(const RngSeed& rngSeed, unsigned substream);
+
             /**
              * Method that is called by a model to report immediate output.  You can use this to stream output from
              * the model to a given device and channel.  This method is called from the same thread(s) that the model
@@ -450,11 +479,31 @@ namespace M {
              */
             class XorShiRo256Stars;
 
+            /**
+             * Private base class for the eight lane XORSHIRO256+ and XORSHIRO256** RNGs.
+             */
+            class XorShiRo256X8Base;
+
+            /**
+             * Private eight lane XORSHIRO256+ RNG instance.
+             */
+            class XorShiRo256PlusX8;
+
+            /**
+             * Private eight lane XORSHIRO256** RNG instance.
+             */
+            class XorShiRo256StarsX8;
+
             /**
              * Private TRNG instance.
              */
             class TRNG;
 
+            /**
+             * Private Philox4x32-10 RNG instance.
+             */
+            class Philox;
+
             /**
              * Method you can call to create a new RNG instance.
              *
@@ -549,11 +598,6 @@ namespace M {
              */
             Model::Status* currentStatusInstance;
 
-            /**
-             * Flag used during generation of gaussian random deviates to reduce the number of extracted random values.
-             */
-            bool gaussianHasSpareValue;
-
             /**
              * The last shape term used for Gamma random deviates.  We store the values to reduce some of the
              * computation between passes.
@@ -565,11 +609,6 @@ namespace M {
              */
             Real gammaLastC;
 
-            /**
-             * The spare value for the gaussian value.
-             */
-            Real gaussianSpare;
-
             /**
              * The last rate provided to the Poisson distribution.  Used to cache calculated parameters.
              */
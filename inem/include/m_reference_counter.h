@@ -30,27 +30,53 @@
 #ifndef M_REFERENCE_COUNTER_H
 #define M_REFERENCE_COUNTER_H
 
+#include <atomic>
+
 #include "m_common.h"
 
 namespace M {
     /**
      * Base class you can used for reference counted types.  The reference count will be initialized to 1.
+     *
+     * The reference count is maintained atomically so instances can be shared between threads.  The class also
+     * provides a recursive lock that can be used to make a sequence of operations, such as a copy-on-write check,
+     * atomic.  The lock spins briefly before yielding so uncontended locks never enter the kernel.
      */
     class M_PUBLIC_API ReferenceCounter {
         public:
             ReferenceCounter();
 
+            /**
+             * Copy constructor.  The new instance starts with a reference count of 1 and is unlocked.
+             *
+             * \param[in] other The instance to be copied.
+             */
+            ReferenceCounter(const ReferenceCounter& other);
+
             ~ReferenceCounter();
 
             /**
-             * Method you can call to lock the reference to make operations atomic.
+             * Method you can call to lock the reference to make operations atomic.  The lock is recursive so a thread
+             * that already holds the lock can lock it again.  Each call must be balanced by a call to
+             * \ref M::ReferenceCounter::unlock.
              */
-            inline void lock() {}
+            void lock() const;
 
             /**
              * Method you can call to unlock the reference after performing atomic operations.
              */
-            inline void unlock() {}
+            void unlock() const;
+
+            /**
+             * Method you can call to lock two instances.  Instances are always locked in the same order so that two
+             * threads locking the same pair of instances can not deadlock.  The instances may be the same, in which
+             * case the instance is locked twice.  Each instance must be unlocked separately.
+             *
+             * \param[in] first  The first instance to be locked.
+             *
+             * \param[in] second The second instance to be locked.
+             */
+            static void lockPair(const ReferenceCounter* first, const ReferenceCounter* second);
 
             /**
              * Method you can call to increase the reference count on this class.  Note that this method may be called
@@ -74,11 +100,31 @@ namespace M {
              */
             bool removeReference() const;
 
+            /**
+             * Assignment operator.  The reference count and lock state of this instance are not modified.
+             *
+             * \param[in] other The instance to be copied.
+             *
+             * \return Returns a reference to this instance.
+             */
+            ReferenceCounter& operator=(const ReferenceCounter& other);
+
         private:
             /**
              * The internal reference count.
              */
-            mutable unsigned currentReferenceCount;
+            mutable std::atomic<unsigned> currentReferenceCount;
+
+            /**
+             * Value identifying the thread currently holding the lock.  A null pointer indicates that the lock is not
+             * held.
+             */
+            mutable std::atomic<const void*> currentLockOwner;
+
+            /**
+             * The number of times the lock owner has locked this instance.  Only accessed by the lock owner.
+             */
+            mutable unsigned currentLockDepth;
     };
 };
 
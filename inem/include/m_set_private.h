@@ -51,7 +51,7 @@ namespace M {
              *
              * \param[in] other The instance to be copied.
              */
-            SetPrivate(const SetPrivate<T>& other):OrderedSet<T>(other) {}
+            SetPrivate(const SetPrivate<T>& other):ReferenceCounter(),OrderedSet<T>(other) {}
 
             /**
              * Copy constructor (move semantics)
@@ -82,7 +82,7 @@ namespace M {
              *
              * \param[in] other The instance to be copied.
              */
-            SetPrivate(const SetPrivate<signed int>& other):OrderedSet<signed int>(other) {}
+            SetPrivate(const SetPrivate<signed int>& other):ReferenceCounter(),OrderedSet<signed int>(other) {}
 
             /**
              * Copy constructor (move semantics)
@@ -113,7 +113,7 @@ namespace M {
              *
              * \param[in] other The instance to be copied.
              */
-            SetPrivate(const SetPrivate<unsigned int>& other):OrderedSet<unsigned int>(other) {}
+            SetPrivate(const SetPrivate<unsigned int>& other):ReferenceCounter(),OrderedSet<unsigned int>(other) {}
 
             /**
              * Copy constructor (move semantics)
@@ -144,7 +144,7 @@ namespace M {
              *
              * \param[in] other The instance to be copied.
              */
-            SetPrivate(const SetPrivate<signed long>& other):OrderedSet<signed long>(other) {}
+            SetPrivate(const SetPrivate<signed long>& other):ReferenceCounter(),OrderedSet<signed long>(other) {}
 
             /**
              * Copy constructor (move semantics)
@@ -175,7 +175,7 @@ namespace M {
              *
              * \param[in] other The instance to be copied.
              */
-            SetPrivate(const SetPrivate<unsigned long>& other):OrderedSet<unsigned long>(other) {}
+            SetPrivate(const SetPrivate<unsigned long>& other):ReferenceCounter(),OrderedSet<unsigned long>(other) {}
 
             /**
              * Copy constructor (move semantics)
@@ -206,7 +206,11 @@ namespace M {
              *
              * \param[in] other The instance to be copied.
              */
-            SetPrivate(const SetPrivate<signed long long>& other):OrderedSet<signed long long>(other) {}
+            SetPrivate(
+                    const SetPrivate<signed long long>& other
+                ):ReferenceCounter(),OrderedSet<signed long long>(
+                    other
+                ) {}
 
             /**
              * Copy constructor (move semantics)
@@ -237,7 +241,11 @@ namespace M {
              *
              * \param[in] other The instance to be copied.
              */
-            SetPrivate(const SetPrivate<unsigned long long>& other):OrderedSet<unsigned long long>(other) {}
+            SetPrivate(
+                    const SetPrivate<unsigned long long>& other
+                ):ReferenceCounter(),OrderedSet<unsigned long long>(
+                    other
+                ) {}
 
             /**
              * Copy constructor (move semantics)
@@ -268,7 +276,7 @@ namespace M {
              *
              * \param[in] other The instance to be copied.
              */
-            SetPrivate(const SetPrivate<float>& other):OrderedSet<float>(other) {}
+            SetPrivate(const SetPrivate<float>& other):ReferenceCounter(),OrderedSet<float>(other) {}
 
             /**
              * Copy constructor (move semantics)
@@ -299,7 +307,7 @@ namespace M {
              *
              * \param[in] other The instance to be copied.
              */
-            SetPrivate(const SetPrivate<double>& other):OrderedSet<double>(other) {}
+            SetPrivate(const SetPrivate<double>& other):ReferenceCounter(),OrderedSet<double>(other) {}
 
             /**
              * Copy constructor (move semantics)
@@ -330,7 +338,7 @@ namespace M {
              *
              * \param[in] other The instance to be copied.
              */
-            SetPrivate(const SetPrivate<long double>& other):OrderedSet<long double>(other) {}
+            SetPrivate(const SetPrivate<long double>& other):ReferenceCounter(),OrderedSet<long double>(other) {}
 
             /**
              * Copy constructor (move semantics)
@@ -137,6 +137,7 @@ API_HEADERS = include/m_common.h \
               include/m_type_conversion_template.h \
               include/m_exceptions.h \
               include/m_reference_counter.h \
+              include/m_matrix_memory_pool.h \
               include/m_variant.h \
               include/m_variant_operators.h \
               include/m_variant_functions.h \
@@ -162,6 +163,7 @@ API_HEADERS = include/m_common.h \
               include/m_matrix_integer.h \
               include/m_matrix_real.h \
               include/m_matrix_complex.h \
+              include/m_iterative_solver.h \
               include/m_implicit_ordering.h \
               include/m_special_values.h \
               include/m_assignment_functions.h \
@@ -178,6 +180,7 @@ API_HEADERS = include/m_common.h \
               include/m_trigonometric_functions.h \
               include/m_hyperbolic_functions.h \
               include/m_file_functions.h \
+              include/m_archive.h \
               include/m_summation_operator.h \
               include/m_console.h \
 
@@ -222,14 +225,22 @@ SOURCES = source/model_exceptions.cpp \
           source/m_set_iterator.cpp \
           source/m_set.cpp \
           source/m_matrix_private_base.cpp \
+          source/m_matrix_memory_pool.cpp \
           source/m_matrix_dense_private_base.cpp \
+          source/m_matrix_sparse_private_base.cpp \
+          source/m_matrix_sparse_solver.cpp \
+          source/m_iterative_solver.cpp \
           source/m_matrix_complex_dense_data.cpp \
+          source/m_matrix_complex_sparse_data.cpp \
           source/m_matrix_complex.cpp \
           source/m_matrix_real_dense_data.cpp \
+          source/m_matrix_real_sparse_data.cpp \
           source/m_matrix_real.cpp \
           source/m_matrix_integer_dense_data.cpp \
+          source/m_matrix_integer_sparse_data.cpp \
           source/m_matrix_integer.cpp \
           source/m_matrix_boolean_dense_data.cpp \
+          source/m_matrix_boolean_sparse_data.cpp \
           source/m_matrix_boolean.cpp \
           source/m_implicit_ordering.cpp \
           source/m_matrix_functions.cpp \
@@ -257,10 +268,17 @@ SOURCES = source/model_exceptions.cpp \
           source/m_per_thread_xorshiro256_base.cpp \
           source/m_per_thread_xorshiro256_plus.cpp \
           source/m_per_thread_xorshiro256_stars.cpp \
+          source/m_per_thread_xorshiro256_x8_base.cpp \
+          source/m_per_thread_xorshiro256_plus_x8.cpp \
+          source/m_per_thread_xorshiro256_stars_x8.cpp \
           source/m_per_thread_trng.cpp \
+          source/m_per_thread_philox.cpp \
+          source/m_ziggurat.cpp \
           source/m_trigonometric_functions.cpp \
           source/m_hyperbolic_functions.cpp \
           source/m_file_functions.cpp \
+          source/m_archive.cpp \
+          source/m_archive_private.cpp \
           source/m_summation_operator.cpp \
           source/m_console.cpp \
 
@@ -287,11 +305,16 @@ PRIVATE_HEADERS = source/m_compiler_abstraction.h \
                   source/model_identifier_database_iterator_private.h \
                   source/model_identifier_database_private.h \
                   source/m_api_private.h \
+                  source/m_archive_private.h \
                   source/m_matrix_helpers.h \
                   source/m_matrix_private_base.h \
                   source/m_matrix_dense_private_base.h \
+                  source/m_matrix_sparse_private_base.h \
                   source/m_matrix_dense_private.h \
                   source/m_matrix_sparse_private.h \
+                  source/m_matrix_small_private.h \
+                  source/m_matrix_sparse_solver.h \
+                  source/m_iterative_solver_private.h \
                   source/m_matrix_complex_data.h \
                   source/m_matrix_complex_dense_data.h \
                   source/m_matrix_complex_sparse_data.h \
@@ -311,7 +334,12 @@ PRIVATE_HEADERS = source/m_compiler_abstraction.h \
                   source/m_per_thread_xorshiro256_base.h \
                   source/m_per_thread_xorshiro256_plus.h \
                   source/m_per_thread_xorshiro256_stars.h \
+                  source/m_per_thread_xorshiro256_x8_base.h \
+                  source/m_per_thread_xorshiro256_plus_x8.h \
+                  source/m_per_thread_xorshiro256_stars_x8.h \
                   source/m_per_thread_trng.h \
+                  source/m_per_thread_philox.h \
+                  source/m_ziggurat.h \
 
 ########################################################################################################################
 # Setup headers and installation
@@ -93,6 +93,11 @@ namespace M {
             unsigned numberParallelThreads = currentModel->numberThreads();
             numberActiveThreads = numberParallelThreads;
 
+            // Each thread is seeded independently here.  Threads whose RNG supports jump-ahead are then moved to a
+            // disjoint substream of currentRngSeed, one substream per thread, by Api::Private::execute.
+
+            std::memcpy(currentRngSeed, rngSeed, sizeof(Model::Rng::RngSeed));
+
             Model::Rng::RngSeed workingSeeds;
             std::memcpy(workingSeeds, rngSeed, sizeof(Model::Rng::RngSeed));
 
@@ -299,6 +304,9 @@ namespace M {
 
         fesetround(FE_TONEAREST);
 
+        // Positioning is done here, rather than in Api::Private::start, so the jumps for each thread run in parallel.
+        perThreadInstance->selectSubstream(impl->currentRngSeed, threadId);
+
         if (statusInstance != nullptr) {
             statusInstance->threadStarted(currentApi, threadId);
         }
@@ -320,6 +320,12 @@ namespace M {
              */
             Model::Status* currentStatusInstance;
 
+            /**
+             * The seed supplied when the model was started.  Threads using RNGs that support jump-ahead are seeded
+             * with this value and then moved to their own substream.
+             */
+            Model::Rng::RngSeed currentRngSeed;
+
             /**
              * The current model operating state.
              */
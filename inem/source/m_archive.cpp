@@ -0,0 +1,88 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::Archive class.
+***********************************************************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "m_api_types.h"
+#include "m_variant.h"
+#include "m_archive_private.h"
+#include "m_archive.h"
+
+namespace M {
+    Archive::Archive():impl(new Private) {}
+
+
+    Archive::~Archive() {
+        delete impl;
+    }
+
+
+    bool Archive::openForAppend(const std::string& filename) {
+        return impl->openForAppend(filename);
+    }
+
+
+    bool Archive::openForRead(const std::string& filename) {
+        return impl->openForRead(filename);
+    }
+
+
+    bool Archive::close() {
+        return impl->close();
+    }
+
+
+    bool Archive::isOpen() const {
+        return impl->isOpen();
+    }
+
+
+    bool Archive::contains(const std::string& name) const {
+        return impl->contains(name);
+    }
+
+
+    ValueType Archive::valueType(const std::string& name) const {
+        return impl->valueType(name);
+    }
+
+
+    std::vector<std::string> Archive::names() const {
+        return impl->names();
+    }
+
+
+    bool Archive::append(const std::string& name, const Variant& value) {
+        return impl->append(name, value);
+    }
+
+
+    Variant Archive::value(const std::string& name) const {
+        return impl->value(name);
+    }
+}
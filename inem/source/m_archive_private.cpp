@@ -0,0 +1,1096 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::Archive::Private class.
+***********************************************************************************************************************/
+
+#define _FILE_OFFSET_BITS (64) // Creates 64-bit seek on POSIX
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#if (defined(_MSC_VER))
+
+    #include <io.h>
+
+    #define FSEEK(_f, _offset, _whence) _fseeki64((_f), (_offset), (_whence))
+    #define FTELL(_f) _ftelli64((_f))
+    #define FTRUNCATE(_f, _size) _chsize_s(_fileno((_f)), (_size))
+
+#else
+
+    #include <unistd.h>
+
+    #define FSEEK(_f, _offset, _whence) fseeko((_f), (_offset), (_whence))
+    #define FTELL(_f) ftello((_f))
+    #define FTRUNCATE(_f, _size) ftruncate(fileno((_f)), (_size))
+
+#endif
+
+#include "m_api_types.h"
+#include "m_intrinsic_types.h"
+#include "m_exceptions.h"
+#include "m_set_iterator.h"
+#include "m_set.h"
+#include "m_tuple.h"
+#include "m_matrix_boolean.h"
+#include "m_matrix_integer.h"
+#include "m_matrix_real.h"
+#include "m_matrix_complex.h"
+#include "m_variant.h"
+#include "m_matrix_private_base.h"
+#include "m_archive.h"
+#include "m_archive_private.h"
+
+namespace M {
+    /**
+     * Marker at the start of every archive file.
+     */
+    static const char archiveMarker[] = "INEARC";
+
+    /**
+     * Marker at the start of every record.
+     */
+    static const char recordMarker[] = "INER";
+
+    /**
+     * Marker at the end of the index payload, including the terminating null.
+     */
+    static const char indexMarker[] = "INEAEND";
+
+    /**
+     * The current archive format version.
+     */
+    static constexpr std::uint8_t archiveVersion = 1;
+
+    constexpr unsigned Archive::Private::fileHeaderSizeInBytes;
+    constexpr unsigned Archive::Private::recordHeaderSizeInBytes;
+    constexpr unsigned Archive::Private::indexTrailerSizeInBytes;
+
+    Archive::Private::Reader::Reader(
+            const std::uint8_t* begin,
+            const std::uint8_t* end
+        ):current(
+            begin
+        ),end(
+            end
+        ),valid(
+            true
+        ) {}
+
+
+    bool Archive::Private::Reader::isValid() const {
+        return valid;
+    }
+
+
+    unsigned long long Archive::Private::Reader::remaining() const {
+        return valid ? static_cast<unsigned long long>(end - current) : 0;
+    }
+
+
+    std::uint8_t Archive::Private::Reader::readByte() {
+        const std::uint8_t* p = readBytes(1);
+        return p != nullptr ? *p : 0;
+    }
+
+
+    std::uint64_t Archive::Private::Reader::readUnsigned64() {
+        std::uint64_t       result = 0;
+        const std::uint8_t* p      = readBytes(8);
+
+        if (p != nullptr) {
+            for (unsigned i=0 ; i<8 ; ++i) {
+                result |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+            }
+        }
+
+        return result;
+    }
+
+
+    const std::uint8_t* Archive::Private::Reader::readBytes(unsigned long long sizeInBytes) {
+        const std::uint8_t* result = nullptr;
+
+        if (sizeInBytes <= remaining()) {
+            result   = current;
+            current += sizeInBytes;
+        } else {
+            valid = false;
+        }
+
+        return result;
+    }
+
+
+    Variant Archive::Private::Reader::readValue(ValueType valueType) {
+        Variant result;
+
+        switch (valueType) {
+            case ValueType::BOOLEAN: {
+                result = Variant(Boolean(readByte() != 0));
+                break;
+            }
+
+            case ValueType::INTEGER: {
+                result = Variant(static_cast<Integer>(readUnsigned64()));
+                break;
+            }
+
+            case ValueType::REAL: {
+                std::uint64_t bits = readUnsigned64();
+                Real          value;
+
+                std::memcpy(&value, &bits, sizeof(Real));
+                result = Variant(value);
+
+                break;
+            }
+
+            case ValueType::COMPLEX: {
+                std::uint64_t realBits      = readUnsigned64();
+                std::uint64_t imaginaryBits = readUnsigned64();
+                Real          realValue;
+                Real          imaginaryValue;
+
+                std::memcpy(&realValue, &realBits, sizeof(Real));
+                std::memcpy(&imaginaryValue, &imaginaryBits, sizeof(Real));
+                result = Variant(Complex(realValue, imaginaryValue));
+
+                break;
+            }
+
+            case ValueType::SET: {
+                Set           set;
+                std::uint64_t numberElements = readUnsigned64();
+
+                // Every element needs at least one byte so a corrupt count can not cause an excessively long loop.
+
+                if (numberElements > remaining()) {
+                    valid = false;
+                }
+
+                for (std::uint64_t i=0 ; valid && i<numberElements ; ++i) {
+                    ValueType elementType = static_cast<ValueType>(readByte());
+                    Variant   element     = readValue(elementType);
+
+                    if (valid) {
+                        set.insert(element);
+                    }
+                }
+
+                result = Variant(set);
+                break;
+            }
+
+            case ValueType::TUPLE: {
+                Tuple         tuple;
+                std::uint64_t numberElements = readUnsigned64();
+
+                if (numberElements > remaining()) {
+                    valid = false;
+                }
+
+                for (std::uint64_t i=0 ; valid && i<numberElements ; ++i) {
+                    ValueType elementType = static_cast<ValueType>(readByte());
+                    Variant   element     = readValue(elementType);
+
+                    if (valid) {
+                        tuple.append(element);
+                    }
+                }
+
+                result = Variant(tuple);
+                break;
+            }
+
+            case ValueType::MATRIX_BOOLEAN: {
+                std::uint64_t numberRows    = readUnsigned64();
+                std::uint64_t numberColumns = readUnsigned64();
+
+                if (numberRows > static_cast<std::uint64_t>(std::numeric_limits<Integer>::max())    ||
+                    numberColumns > static_cast<std::uint64_t>(std::numeric_limits<Integer>::max()) ||
+                    (numberColumns != 0 && numberRows > remaining() / numberColumns)                   ) {
+                    valid = false;
+                } else {
+                    const std::uint8_t* d = readBytes(numberRows * numberColumns);
+                    if (d != nullptr) {
+                        Integer                    rows    = static_cast<Integer>(numberRows);
+                        Integer                    columns = static_cast<Integer>(numberColumns);
+                        MatrixBoolean              matrix(rows, columns);
+                        std::unique_ptr<Boolean[]> column(new Boolean[numberRows]);
+
+                        for (std::uint64_t columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+                            for (std::uint64_t rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                                column[rowIndex] = (d[columnIndex * numberRows + rowIndex] != 0);
+                            }
+
+                            matrix.updateColumn(static_cast<Integer>(columnIndex + 1), column.get());
+                        }
+
+                        result = Variant(matrix);
+                    }
+                }
+
+                break;
+            }
+
+            case ValueType::MATRIX_INTEGER: {
+                result = readMatrix<MatrixInteger>();
+                break;
+            }
+
+            case ValueType::MATRIX_REAL: {
+                result = readMatrix<MatrixReal>();
+                break;
+            }
+
+            case ValueType::MATRIX_COMPLEX: {
+                result = readMatrix<MatrixComplex>();
+                break;
+            }
+
+            default: {
+                valid = false;
+                break;
+            }
+        }
+
+        if (!valid) {
+            result = Variant();
+        }
+
+        return result;
+    }
+
+
+    template<typename MT> Variant Archive::Private::Reader::readMatrix() {
+        typedef typename MT::Scalar Scalar;
+
+        Variant       result;
+        std::uint64_t numberRows    = readUnsigned64();
+        std::uint64_t numberColumns = readUnsigned64();
+
+        if (numberRows > static_cast<std::uint64_t>(std::numeric_limits<Integer>::max())    ||
+            numberColumns > static_cast<std::uint64_t>(std::numeric_limits<Integer>::max()) ||
+            (numberColumns != 0 && numberRows > remaining() / numberColumns / sizeof(Scalar))  ) {
+            valid = false;
+        } else {
+            unsigned long long  columnSizeInBytes = numberRows * sizeof(Scalar);
+            const std::uint8_t* d                 = readBytes(columnSizeInBytes * numberColumns);
+
+            if (d != nullptr) {
+                MT matrix(static_cast<Integer>(numberRows), static_cast<Integer>(numberColumns));
+
+                for (std::uint64_t columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+                    std::memcpy(
+                        static_cast<void*>(matrix.columnData(static_cast<Integer>(columnIndex + 1))),
+                        d + columnIndex * columnSizeInBytes,
+                        columnSizeInBytes
+                    );
+                }
+
+                result = Variant(matrix);
+            }
+        }
+
+        return result;
+    }
+
+
+    Archive::Private::Private() {
+        fileHandle = nullptr;
+        reset();
+    }
+
+
+    Archive::Private::~Private() {
+        if (currentMode != Mode::CLOSED) {
+            close();
+        }
+    }
+
+
+    bool Archive::Private::openForAppend(const std::string& filename) {
+        bool success = true;
+
+        if (currentMode != Mode::CLOSED) {
+            success = close();
+        }
+
+        if (success) {
+            const char* fn = filename.c_str();
+
+            fileHandle = std::fopen(fn, "r+b");
+            if (fileHandle == nullptr) {
+                fileHandle = std::fopen(fn, "w+b");
+            }
+
+            if (fileHandle == nullptr) {
+                internalTriggerFileOpenError(fn, errno);
+                success = false;
+            } else if (FSEEK(fileHandle, 0, SEEK_END) != 0) {
+                internalTriggerFileSeekError(0, fn, errno);
+                success = false;
+            } else {
+                unsigned long long sizeInBytes = static_cast<unsigned long long>(FTELL(fileHandle));
+
+                if (sizeInBytes == 0) {
+                    std::uint8_t header[fileHeaderSizeInBytes];
+
+                    std::memset(header, 0, fileHeaderSizeInBytes);
+                    std::memcpy(header, archiveMarker, 6);
+                    header[6] = archiveVersion;
+
+                    success = writeBytes(header, fileHeaderSizeInBytes);
+                    if (!success) {
+                        internalTriggerFileWriteError(fn, errno);
+                    }
+
+                    fileSizeInBytes = fileHeaderSizeInBytes;
+                } else {
+                    unsigned long long regionSize = 0;
+                    void*              region     = MatrixPrivateBase::mapFile(fn, regionSize);
+
+                    if (region == nullptr) {
+                        internalTriggerFileReadError(fn, errno);
+                        success = false;
+                    } else {
+                        bool indexFound = false;
+
+                        success = loadDirectory(
+                            reinterpret_cast<const std::uint8_t*>(region),
+                            regionSize,
+                            fileSizeInBytes,
+                            indexFound
+                        );
+
+                        MatrixPrivateBase::unmapFile(region, regionSize);
+
+                        // Without a valid index, the index is rebuilt when the archive is closed.  Any incomplete
+                        // record left behind by an earlier failure is discarded.
+
+                        if (success && fileSizeInBytes < regionSize) {
+                            success = (FTRUNCATE(fileHandle, static_cast<long long>(fileSizeInBytes)) == 0);
+                            if (!success) {
+                                internalTriggerFileWriteError(fn, errno);
+                            }
+                        } else if (!success) {
+                            internalTriggerUnknownFileTypeError(fn);
+                        }
+
+                        modified = !indexFound;
+                    }
+                }
+            }
+
+            if (success) {
+                currentMode     = Mode::APPEND;
+                currentFilename = filename;
+            } else {
+                if (fileHandle != nullptr) {
+                    std::fclose(fileHandle);
+                }
+
+                reset();
+            }
+        }
+
+        return success;
+    }
+
+
+    bool Archive::Private::openForRead(const std::string& filename) {
+        bool success = true;
+
+        if (currentMode != Mode::CLOSED) {
+            success = close();
+        }
+
+        if (success) {
+            const char*        fn         = filename.c_str();
+            unsigned long long regionSize = 0;
+            void*              region     = MatrixPrivateBase::mapFile(fn, regionSize);
+
+            if (region == nullptr) {
+                internalTriggerFileOpenError(fn, errno);
+                success = false;
+            } else {
+                unsigned long long validSizeInBytes;
+                bool               indexFound;
+
+                success = loadDirectory(
+                    reinterpret_cast<const std::uint8_t*>(region),
+                    regionSize,
+                    validSizeInBytes,
+                    indexFound
+                );
+
+                if (success) {
+                    currentMode             = Mode::READ;
+                    currentFilename         = filename;
+                    mappedRegion            = region;
+                    mappedRegionSizeInBytes = regionSize;
+                } else {
+                    MatrixPrivateBase::unmapFile(region, regionSize);
+                    reset();
+
+                    internalTriggerUnknownFileTypeError(fn);
+                }
+            }
+        }
+
+        return success;
+    }
+
+
+    bool Archive::Private::close() {
+        bool success = true;
+
+        if (currentMode == Mode::APPEND) {
+            const char* fn = currentFilename.c_str();
+
+            if (modified) {
+                success = writeIndex();
+                if (!success) {
+                    internalTriggerFileWriteError(fn, errno);
+                }
+            }
+
+            if (std::fclose(fileHandle) != 0 && success) {
+                internalTriggerFileCloseError(fn, errno);
+                success = false;
+            }
+        } else if (currentMode == Mode::READ) {
+            MatrixPrivateBase::unmapFile(mappedRegion, mappedRegionSizeInBytes);
+        }
+
+        reset();
+        return success;
+    }
+
+
+    bool Archive::Private::isOpen() const {
+        return currentMode != Mode::CLOSED;
+    }
+
+
+    bool Archive::Private::contains(const std::string& name) const {
+        return directory.find(name) != directory.end();
+    }
+
+
+    ValueType Archive::Private::valueType(const std::string& name) const {
+        std::unordered_map<std::string, Entry>::const_iterator it = directory.find(name);
+        return it != directory.end() ? it->second.valueType : ValueType::NONE;
+    }
+
+
+    std::vector<std::string> Archive::Private::names() const {
+        return entryNames;
+    }
+
+
+    bool Archive::Private::append(const std::string& name, const Variant& value) {
+        bool               success;
+        unsigned long long payloadSizeInBytes;
+
+        if (currentMode != Mode::APPEND || !encodedSize(value, payloadSizeInBytes)) {
+            internalTriggerInvalidParameterValueError();
+            success = false;
+        } else {
+            Entry entry;
+            entry.valueType          = value.valueType();
+            entry.recordOffset       = fileSizeInBytes;
+            entry.payloadOffset      = fileSizeInBytes + recordHeaderSizeInBytes + name.size();
+            entry.payloadSizeInBytes = payloadSizeInBytes;
+
+            success = (
+                   FSEEK(fileHandle, static_cast<long long>(entry.recordOffset), SEEK_SET) == 0
+                && writeRecordHeader('E', entry.valueType, name.size(), payloadSizeInBytes)
+                && writeBytes(name.data(), name.size())
+                && writeValue(value)
+            );
+
+            if (success) {
+                insertEntry(name, entry);
+
+                fileSizeInBytes = entry.payloadOffset + payloadSizeInBytes;
+                modified        = true;
+            } else {
+                internalTriggerFileWriteError(currentFilename.c_str(), errno);
+            }
+        }
+
+        return success;
+    }
+
+
+    Variant Archive::Private::value(const std::string& name) const {
+        Variant                                                result;
+        std::unordered_map<std::string, Entry>::const_iterator it = directory.find(name);
+
+        if (it == directory.end()) {
+            internalTriggerInvalidParameterValueError();
+        } else {
+            const Entry& entry = it->second;
+
+            if (currentMode == Mode::READ) {
+                const std::uint8_t* payload = reinterpret_cast<const std::uint8_t*>(mappedRegion) + entry.payloadOffset;
+                Reader              reader(payload, payload + entry.payloadSizeInBytes);
+
+                result = reader.readValue(entry.valueType);
+                if (!reader.isValid()) {
+                    internalTriggerFileReadError(currentFilename.c_str(), 1);
+                }
+            } else {
+                // Entries written during this session are read back through the file handle.  The next append seeks
+                // to the end of the file before writing.
+
+                std::vector<std::uint8_t> payload(static_cast<std::size_t>(entry.payloadSizeInBytes));
+
+                if (FSEEK(fileHandle, static_cast<long long>(entry.payloadOffset), SEEK_SET) != 0           ||
+                    std::fread(payload.data(), 1, payload.size(), fileHandle) != payload.size()             ) {
+                    internalTriggerFileReadError(currentFilename.c_str(), errno);
+                } else {
+                    Reader reader(payload.data(), payload.data() + payload.size());
+
+                    result = reader.readValue(entry.valueType);
+                    if (!reader.isValid()) {
+                        internalTriggerFileReadError(currentFilename.c_str(), 1);
+                    }
+                }
+            }
+        }
+
+        return result;
+    }
+
+
+    void Archive::Private::writeLittleEndian(std::uint8_t* destination, std::uint64_t value) {
+        for (unsigned i=0 ; i<8 ; ++i) {
+            destination[i] = static_cast<std::uint8_t>(value >> (8 * i));
+        }
+    }
+
+
+    bool Archive::Private::encodedSize(const Variant& value, unsigned long long& sizeInBytes) {
+        bool success = true;
+
+        switch (value.valueType()) {
+            case ValueType::BOOLEAN: {
+                sizeInBytes = 1;
+                break;
+            }
+
+            case ValueType::INTEGER:
+            case ValueType::REAL: {
+                sizeInBytes = 8;
+                break;
+            }
+
+            case ValueType::COMPLEX: {
+                sizeInBytes = 16;
+                break;
+            }
+
+            case ValueType::SET: {
+                const Set& set = value.toSet();
+
+                sizeInBytes = 8;
+                for (  SetIterator elementIterator = set.constBegin(), elementEndIterator = set.constEnd()
+                     ; success && elementIterator != elementEndIterator
+                     ; ++elementIterator
+                    ) {
+                    unsigned long long elementSizeInBytes;
+                    success      = encodedSize(elementIterator.constReference(), elementSizeInBytes);
+                    sizeInBytes += 1 + elementSizeInBytes;
+                }
+
+                break;
+            }
+
+            case ValueType::TUPLE: {
+                const Tuple& tuple = value.toTuple();
+
+                sizeInBytes = 8;
+                for (  Tuple::ConstIterator elementIterator = tuple.constBegin(), elementEndIterator = tuple.constEnd()
+                     ; success && elementIterator != elementEndIterator
+                     ; ++elementIterator
+                    ) {
+                    unsigned long long elementSizeInBytes;
+                    success      = encodedSize(elementIterator.constReference(), elementSizeInBytes);
+                    sizeInBytes += 1 + elementSizeInBytes;
+                }
+
+                break;
+            }
+
+            case ValueType::MATRIX_BOOLEAN: {
+                MatrixBoolean matrix = value.toMatrixBoolean();
+                sizeInBytes = 16 + static_cast<unsigned long long>(matrix.numberRows() * matrix.numberColumns());
+
+                break;
+            }
+
+            case ValueType::MATRIX_INTEGER: {
+                MatrixInteger matrix = value.toMatrixInteger();
+                sizeInBytes = (
+                      16
+                    + sizeof(MatrixInteger::Scalar)
+                      * static_cast<unsigned long long>(matrix.numberRows() * matrix.numberColumns())
+                );
+
+                break;
+            }
+
+            case ValueType::MATRIX_REAL: {
+                MatrixReal matrix = value.toMatrixReal();
+                sizeInBytes = (
+                      16
+                    + sizeof(MatrixReal::Scalar)
+                      * static_cast<unsigned long long>(matrix.numberRows() * matrix.numberColumns())
+                );
+
+                break;
+            }
+
+            case ValueType::MATRIX_COMPLEX: {
+                MatrixComplex matrix = value.toMatrixComplex();
+                sizeInBytes = (
+                      16
+                    + sizeof(MatrixComplex::Scalar)
+                      * static_cast<unsigned long long>(matrix.numberRows() * matrix.numberColumns())
+                );
+
+                break;
+            }
+
+            default: {
+                success = false;
+                break;
+            }
+        }
+
+        return success;
+    }
+
+
+    bool Archive::Private::writeBytes(const void* data, unsigned long long sizeInBytes) {
+        return (
+               sizeInBytes == 0
+            || std::fwrite(data, 1, static_cast<std::size_t>(sizeInBytes), fileHandle) == sizeInBytes
+        );
+    }
+
+
+    bool Archive::Private::writeByte(std::uint8_t value) {
+        return writeBytes(&value, 1);
+    }
+
+
+    bool Archive::Private::writeUnsigned64(std::uint64_t value) {
+        std::uint8_t buffer[8];
+        writeLittleEndian(buffer, value);
+
+        return writeBytes(buffer, 8);
+    }
+
+
+    bool Archive::Private::writeValue(const Variant& value) {
+        bool success = true;
+
+        switch (value.valueType()) {
+            case ValueType::BOOLEAN: {
+                success = writeByte(value.toBoolean() ? 1 : 0);
+                break;
+            }
+
+            case ValueType::INTEGER: {
+                success = writeUnsigned64(static_cast<std::uint64_t>(value.toInteger()));
+                break;
+            }
+
+            case ValueType::REAL: {
+                Real          realValue = value.toReal();
+                std::uint64_t bits;
+
+                std::memcpy(&bits, &realValue, sizeof(Real));
+                success = writeUnsigned64(bits);
+
+                break;
+            }
+
+            case ValueType::COMPLEX: {
+                Complex       complexValue   = value.toComplex();
+                Real          realValue      = complexValue.real();
+                Real          imaginaryValue = complexValue.imag();
+                std::uint64_t realBits;
+                std::uint64_t imaginaryBits;
+
+                std::memcpy(&realBits, &realValue, sizeof(Real));
+                std::memcpy(&imaginaryBits, &imaginaryValue, sizeof(Real));
+                success = writeUnsigned64(realBits) && writeUnsigned64(imaginaryBits);
+
+                break;
+            }
+
+            case ValueType::SET: {
+                const Set& set = value.toSet();
+
+                success = writeUnsigned64(static_cast<std::uint64_t>(set.size()));
+                for (  SetIterator elementIterator = set.constBegin(), elementEndIterator = set.constEnd()
+                     ; success && elementIterator != elementEndIterator
+                     ; ++elementIterator
+                    ) {
+                    const Variant& element = elementIterator.constReference();
+                    success = writeByte(static_cast<std::uint8_t>(element.valueType())) && writeValue(element);
+                }
+
+                break;
+            }
+
+            case ValueType::TUPLE: {
+                const Tuple& tuple = value.toTuple();
+
+                success = writeUnsigned64(static_cast<std::uint64_t>(tuple.size()));
+                for (  Tuple::ConstIterator elementIterator = tuple.constBegin(), elementEndIterator = tuple.constEnd()
+                     ; success && elementIterator != elementEndIterator
+                     ; ++elementIterator
+                    ) {
+                    const Variant& element = elementIterator.constReference();
+                    success = writeByte(static_cast<std::uint8_t>(element.valueType())) && writeValue(element);
+                }
+
+                break;
+            }
+
+            case ValueType::MATRIX_BOOLEAN: {
+                MatrixBoolean matrix        = value.toMatrixBoolean();
+                Integer       numberRows    = matrix.numberRows();
+                Integer       numberColumns = matrix.numberColumns();
+
+                success = (
+                       writeUnsigned64(static_cast<std::uint64_t>(numberRows))
+                    && writeUnsigned64(static_cast<std::uint64_t>(numberColumns))
+                );
+
+                std::unique_ptr<Boolean[]>      column(new Boolean[numberRows]);
+                std::unique_ptr<std::uint8_t[]> bytes(new std::uint8_t[numberRows]);
+
+                for (Integer columnIndex=1 ; success && columnIndex<=numberColumns ; ++columnIndex) {
+                    matrix.columnValues(columnIndex, column.get());
+                    for (Integer rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                        bytes[rowIndex] = column[rowIndex] ? 1 : 0;
+                    }
+
+                    success = writeBytes(bytes.get(), static_cast<unsigned long long>(numberRows));
+                }
+
+                break;
+            }
+
+            case ValueType::MATRIX_INTEGER: {
+                success = writeMatrix(value.toMatrixInteger());
+                break;
+            }
+
+            case ValueType::MATRIX_REAL: {
+                success = writeMatrix(value.toMatrixReal());
+                break;
+            }
+
+            case ValueType::MATRIX_COMPLEX: {
+                success = writeMatrix(value.toMatrixComplex());
+                break;
+            }
+
+            default: {
+                success = false;
+                break;
+            }
+        }
+
+        return success;
+    }
+
+
+    template<typename MT> bool Archive::Private::writeMatrix(const MT& matrix) {
+        typedef typename MT::Scalar Scalar;
+
+        Integer            numberRows        = matrix.numberRows();
+        Integer            numberColumns     = matrix.numberColumns();
+        unsigned long long columnSizeInBytes = static_cast<unsigned long long>(numberRows) * sizeof(Scalar);
+
+        bool success = (
+               writeUnsigned64(static_cast<std::uint64_t>(numberRows))
+            && writeUnsigned64(static_cast<std::uint64_t>(numberColumns))
+        );
+
+        for (Integer columnIndex=1 ; success && columnIndex<=numberColumns ; ++columnIndex) {
+            success = writeBytes(matrix.columnData(columnIndex), columnSizeInBytes);
+        }
+
+        return success;
+    }
+
+
+    bool Archive::Private::writeRecordHeader(
+            char               kind,
+            ValueType          valueType,
+            unsigned long long nameSizeInBytes,
+            unsigned long long payloadSizeInBytes
+        ) {
+        std::uint8_t header[recordHeaderSizeInBytes];
+
+        std::memset(header, 0, recordHeaderSizeInBytes);
+        std::memcpy(header, recordMarker, 4);
+        header[4] = static_cast<std::uint8_t>(kind);
+        header[5] = static_cast<std::uint8_t>(valueType);
+
+        writeLittleEndian(header +  8, nameSizeInBytes);
+        writeLittleEndian(header + 16, payloadSizeInBytes);
+
+        return writeBytes(header, recordHeaderSizeInBytes);
+    }
+
+
+    bool Archive::Private::writeIndex() {
+        unsigned long long indexOffset        = fileSizeInBytes;
+        unsigned long long payloadSizeInBytes = 8 + indexTrailerSizeInBytes;
+
+        for (const std::string& name : entryNames) {
+            payloadSizeInBytes += 8 + name.size() + 1 + 8;
+        }
+
+        bool success = (
+               FSEEK(fileHandle, static_cast<long long>(indexOffset), SEEK_SET) == 0
+            && writeRecordHeader('I', ValueType::NONE, 0, payloadSizeInBytes)
+            && writeUnsigned64(entryNames.size())
+        );
+
+        std::vector<std::string>::const_iterator nameIterator    = entryNames.cbegin();
+        std::vector<std::string>::const_iterator nameEndIterator = entryNames.cend();
+        while (success && nameIterator != nameEndIterator) {
+            const std::string& name  = *nameIterator;
+            const Entry&       entry = directory.at(name);
+
+            success = (
+                   writeUnsigned64(name.size())
+                && writeBytes(name.data(), name.size())
+                && writeByte(static_cast<std::uint8_t>(entry.valueType))
+                && writeUnsigned64(entry.recordOffset)
+            );
+
+            ++nameIterator;
+        }
+
+        success = success && writeUnsigned64(indexOffset) && writeBytes(indexMarker, 8);
+
+        if (success) {
+            fileSizeInBytes = indexOffset + recordHeaderSizeInBytes + payloadSizeInBytes;
+        }
+
+        return success;
+    }
+
+
+    bool Archive::Private::loadDirectory(
+            const std::uint8_t* image,
+            unsigned long long  sizeInBytes,
+            unsigned long long& validSizeInBytes,
+            bool&               indexFound
+        ) {
+        bool success = (
+               sizeInBytes >= fileHeaderSizeInBytes
+            && std::memcmp(image, archiveMarker, 6) == 0
+            && image[6] == archiveVersion
+        );
+
+        if (success) {
+            indexFound = loadIndex(image, sizeInBytes);
+            if (indexFound) {
+                validSizeInBytes = sizeInBytes;
+            } else {
+                validSizeInBytes = scanRecords(image, sizeInBytes);
+            }
+        }
+
+        return success;
+    }
+
+
+    bool Archive::Private::loadIndex(const std::uint8_t* image, unsigned long long sizeInBytes) {
+        bool success = false;
+
+        if (sizeInBytes >= fileHeaderSizeInBytes + recordHeaderSizeInBytes + indexTrailerSizeInBytes) {
+            const std::uint8_t* trailer = image + sizeInBytes - indexTrailerSizeInBytes;
+
+            if (std::memcmp(trailer + 8, indexMarker, 8) == 0) {
+                Reader             trailerReader(trailer, trailer + 8);
+                unsigned long long indexOffset = trailerReader.readUnsigned64();
+                char               kind;
+                Entry              indexEntry;
+                std::string        unusedName;
+
+                if (indexOffset >= fileHeaderSizeInBytes                                                     &&
+                    decodeRecordHeader(image, sizeInBytes, indexOffset, kind, indexEntry, unusedName)          &&
+                    kind == 'I'                                                                                &&
+                    indexEntry.payloadOffset + indexEntry.payloadSizeInBytes == sizeInBytes                       ) {
+                    Reader reader(image + indexEntry.payloadOffset, trailer);
+
+                    std::uint64_t numberEntries = reader.readUnsigned64();
+                    success = reader.isValid();
+
+                    for (std::uint64_t i=0 ; success && i<numberEntries ; ++i) {
+                        std::uint64_t       nameSizeInBytes = reader.readUnsigned64();
+                        const std::uint8_t* name            = reader.readBytes(nameSizeInBytes);
+                        ValueType           valueType       = static_cast<ValueType>(reader.readByte());
+                        std::uint64_t       recordOffset    = reader.readUnsigned64();
+
+                        // Entries are validated against their own record headers and must precede the index.
+
+                        Entry       entry;
+                        std::string recordName;
+
+                        success = (
+                               reader.isValid()
+                            && decodeRecordHeader(image, indexOffset, recordOffset, kind, entry, recordName)
+                            && kind == 'E'
+                            && entry.valueType == valueType
+                            && recordName.size() == nameSizeInBytes
+                            && std::memcmp(recordName.data(), name, nameSizeInBytes) == 0
+                        );
+
+                        if (success) {
+                            insertEntry(recordName, entry);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (!success) {
+            directory.clear();
+            entryNames.clear();
+        }
+
+        return success;
+    }
+
+
+    unsigned long long Archive::Private::scanRecords(const std::uint8_t* image, unsigned long long sizeInBytes) {
+        unsigned long long recordOffset = fileHeaderSizeInBytes;
+        bool               valid        = true;
+
+        while (valid) {
+            char        kind;
+            Entry       entry;
+            std::string name;
+
+            valid = (
+                   decodeRecordHeader(image, sizeInBytes, recordOffset, kind, entry, name)
+                && (kind == 'E' || kind == 'I')
+            );
+
+            if (valid) {
+                if (kind == 'E') {
+                    insertEntry(name, entry);
+                }
+
+                recordOffset = entry.payloadOffset + entry.payloadSizeInBytes;
+            }
+        }
+
+        return recordOffset;
+    }
+
+
+    bool Archive::Private::decodeRecordHeader(
+            const std::uint8_t* image,
+            unsigned long long  sizeInBytes,
+            unsigned long long  recordOffset,
+            char&               kind,
+            Entry&              entry,
+            std::string&        name
+        ) {
+        bool success = false;
+
+        if (recordOffset <= sizeInBytes                                     &&
+            sizeInBytes - recordOffset >= recordHeaderSizeInBytes           &&
+            std::memcmp(image + recordOffset, recordMarker, 4) == 0            ) {
+            const std::uint8_t* header = image + recordOffset;
+            Reader              reader(header + 8, header + recordHeaderSizeInBytes);
+            unsigned long long  nameSizeInBytes    = reader.readUnsigned64();
+            unsigned long long  payloadSizeInBytes = reader.readUnsigned64();
+            unsigned long long  available          = sizeInBytes - recordOffset - recordHeaderSizeInBytes;
+
+            if (nameSizeInBytes <= available && payloadSizeInBytes <= available - nameSizeInBytes) {
+                kind = static_cast<char>(header[4]);
+                name.assign(reinterpret_cast<const char*>(header + recordHeaderSizeInBytes), nameSizeInBytes);
+
+                entry.valueType          = static_cast<ValueType>(header[5]);
+                entry.recordOffset       = recordOffset;
+                entry.payloadOffset      = recordOffset + recordHeaderSizeInBytes + nameSizeInBytes;
+                entry.payloadSizeInBytes = payloadSizeInBytes;
+
+                success = true;
+            }
+        }
+
+        return success;
+    }
+
+
+    void Archive::Private::insertEntry(const std::string& name, const Entry& entry) {
+        std::unordered_map<std::string, Entry>::iterator it = directory.find(name);
+        if (it == directory.end()) {
+            directory.insert(std::make_pair(name, entry));
+            entryNames.push_back(name);
+        } else {
+            it->second = entry;
+        }
+    }
+
+
+    void Archive::Private::reset() {
+        currentMode             = Mode::CLOSED;
+        fileHandle              = nullptr;
+        fileSizeInBytes         = 0;
+        modified                = false;
+        mappedRegion            = nullptr;
+        mappedRegionSizeInBytes = 0;
+
+        currentFilename.clear();
+        directory.clear();
+        entryNames.clear();
+    }
+}
@@ -0,0 +1,518 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This header defines the \ref M::Archive::Private class.
+***********************************************************************************************************************/
+
+/* .. sphinx-project inem */
+
+#ifndef M_ARCHIVE_PRIVATE_H
+#define M_ARCHIVE_PRIVATE_H
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "m_api_types.h"
+#include "m_archive.h"
+
+namespace M {
+    class Variant;
+
+    /**
+     * Private implementation of the \ref M::Archive class.
+     *
+     * The archive file starts with a 16 byte header: "INEARC", a version byte, and nine reserved zero bytes.  Records
+     * follow the header.  Each record has a 24 byte header:
+     *
+     *     bytes  0 -  3: "INER"
+     *     byte        4: record kind, 'E' for an entry or 'I' for a directory index
+     *     byte        5: value type of the entry
+     *     bytes  6 -  7: reserved, zero
+     *     bytes  8 - 15: name length in bytes, little endian
+     *     bytes 16 - 23: payload length in bytes, little endian
+     *
+     * The record header is followed by the name and then the payload.  An index payload holds the number of entries
+     * followed by the name, value type and record offset of each entry.  The index payload ends with the offset of the
+     * index record and the marker "INEAEND" so the index can be located from the end of the file.
+     *
+     * Multi-byte scalars are stored little endian.  Matrix coefficients are stored in column major order without
+     * padding, in native byte order.
+     */
+    class Archive::Private {
+        public:
+            Private();
+
+            ~Private();
+
+            /**
+             * Method that opens an archive so new entries can be appended.
+             *
+             * \param[in] filename The name of the archive file.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool openForAppend(const std::string& filename);
+
+            /**
+             * Method that opens an existing archive for reading.
+             *
+             * \param[in] filename The name of the archive file.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool openForRead(const std::string& filename);
+
+            /**
+             * Method that closes the archive.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool close();
+
+            /**
+             * Method that determines if the archive is open.
+             *
+             * \return Returns true if the archive is open.
+             */
+            bool isOpen() const;
+
+            /**
+             * Method that determines if the archive holds an entry.
+             *
+             * \param[in] name The name of the entry.
+             *
+             * \return Returns true if the entry exists.
+             */
+            bool contains(const std::string& name) const;
+
+            /**
+             * Method that determines the type of an entry.
+             *
+             * \param[in] name The name of the entry.
+             *
+             * \return Returns the type of the entry.  Returns ValueType::NONE if the entry does not exist.
+             */
+            ValueType valueType(const std::string& name) const;
+
+            /**
+             * Method that obtains the names of every entry, in the order the entries were first written.
+             *
+             * \return Returns a list of entry names.
+             */
+            std::vector<std::string> names() const;
+
+            /**
+             * Method that appends an entry to the archive.
+             *
+             * \param[in] name  The name of the entry.
+             *
+             * \param[in] value The value to be stored.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool append(const std::string& name, const Variant& value);
+
+            /**
+             * Method that reads an entry from the archive.
+             *
+             * \param[in] name The name of the entry.
+             *
+             * \return Returns the stored value.  An empty variant is returned on error.
+             */
+            Variant value(const std::string& name) const;
+
+        private:
+            /**
+             * The size of the file header, in bytes.
+             */
+            static constexpr unsigned fileHeaderSizeInBytes = 16;
+
+            /**
+             * The size of each record header, in bytes.
+             */
+            static constexpr unsigned recordHeaderSizeInBytes = 24;
+
+            /**
+             * The size of the trailer at the end of the index payload, in bytes.
+             */
+            static constexpr unsigned indexTrailerSizeInBytes = 16;
+
+            /**
+             * Enumeration of archive modes.
+             */
+            enum class Mode {
+                /**
+                 * Indicates the archive is closed.
+                 */
+                CLOSED,
+
+                /**
+                 * Indicates the archive is memory mapped for reading.
+                 */
+                READ,
+
+                /**
+                 * Indicates the archive is open for appending.
+                 */
+                APPEND
+            };
+
+            /**
+             * Structure describing a single entry.
+             */
+            struct Entry {
+                /**
+                 * The value type of the entry.
+                 */
+                ValueType valueType;
+
+                /**
+                 * The offset of the entry record from the start of the file.
+                 */
+                unsigned long long recordOffset;
+
+                /**
+                 * The offset of the entry payload from the start of the file.
+                 */
+                unsigned long long payloadOffset;
+
+                /**
+                 * The length of the entry payload, in bytes.
+                 */
+                unsigned long long payloadSizeInBytes;
+            };
+
+            /**
+             * Class used to decode values from a region of memory.  Every read is bounds checked.
+             */
+            class Reader {
+                public:
+                    /**
+                     * Constructor
+                     *
+                     * \param[in] begin Pointer to the first byte to be decoded.
+                     *
+                     * \param[in] end   Pointer just past the last byte to be decoded.
+                     */
+                    Reader(const std::uint8_t* begin, const std::uint8_t* end);
+
+                    /**
+                     * Method that determines if every read so far was within bounds.
+                     *
+                     * \return Returns true if no read exceeded the region.
+                     */
+                    bool isValid() const;
+
+                    /**
+                     * Method that determines the number of bytes remaining.
+                     *
+                     * \return Returns the number of unread bytes.
+                     */
+                    unsigned long long remaining() const;
+
+                    /**
+                     * Method that reads a single byte.
+                     *
+                     * \return Returns the byte.  Returns 0 if the region is exhausted.
+                     */
+                    std::uint8_t readByte();
+
+                    /**
+                     * Method that reads a 64-bit little endian value.
+                     *
+                     * \return Returns the value.  Returns 0 if the region is exhausted.
+                     */
+                    std::uint64_t readUnsigned64();
+
+                    /**
+                     * Method that reads a block of bytes.
+                     *
+                     * \param[in] sizeInBytes The number of bytes to be read.
+                     *
+                     * \return Returns a pointer to the bytes.  Returns a null pointer if the region is exhausted.
+                     */
+                    const std::uint8_t* readBytes(unsigned long long sizeInBytes);
+
+                    /**
+                     * Method that decodes a value.
+                     *
+                     * \param[in] valueType The type of the value to be decoded.
+                     *
+                     * \return Returns the decoded value.  An empty variant is returned if the value is invalid.
+                     */
+                    Variant readValue(ValueType valueType);
+
+                    /**
+                     * Method that decodes an integer, real, or complex matrix.
+                     *
+                     * \return Returns the decoded matrix.  An empty variant is returned if the matrix is invalid.
+                     */
+                    template<typename MT> Variant readMatrix();
+
+                private:
+                    /**
+                     * Pointer to the next byte to be read.
+                     */
+                    const std::uint8_t* current;
+
+                    /**
+                     * Pointer just past the last byte in the region.
+                     */
+                    const std::uint8_t* end;
+
+                    /**
+                     * Flag indicating that a read exceeded the region.
+                     */
+                    bool valid;
+            };
+
+            /**
+             * Method that writes a 64-bit little endian value into a buffer.
+             *
+             * \param[in] destination The location to receive the value.
+             *
+             * \param[in] value       The value to be written.
+             */
+            static void writeLittleEndian(std::uint8_t* destination, std::uint64_t value);
+
+            /**
+             * Method that calculates the encoded size of a value, excluding the value type.
+             *
+             * \param[in]  value       The value to be measured.
+             *
+             * \param[out] sizeInBytes The encoded size, in bytes.
+             *
+             * \return Returns true on success.  Returns false if the value type can not be stored.
+             */
+            static bool encodedSize(const Variant& value, unsigned long long& sizeInBytes);
+
+            /**
+             * Method that writes raw bytes to the archive file.
+             *
+             * \param[in] data        The data to be written.
+             *
+             * \param[in] sizeInBytes The number of bytes to be written.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool writeBytes(const void* data, unsigned long long sizeInBytes);
+
+            /**
+             * Method that writes a single byte to the archive file.
+             *
+             * \param[in] value The byte to be written.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool writeByte(std::uint8_t value);
+
+            /**
+             * Method that writes a 64-bit little endian value to the archive file.
+             *
+             * \param[in] value The value to be written.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool writeUnsigned64(std::uint64_t value);
+
+            /**
+             * Method that writes an encoded value to the archive file, excluding the value type.
+             *
+             * \param[in] value The value to be written.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool writeValue(const Variant& value);
+
+            /**
+             * Method that writes an integer, real, or complex matrix to the archive file.
+             *
+             * \param[in] matrix The matrix to be written.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            template<typename MT> bool writeMatrix(const MT& matrix);
+
+            /**
+             * Method that writes a record header to the archive file.
+             *
+             * \param[in] kind               The record kind.
+             *
+             * \param[in] valueType          The value type of the entry.
+             *
+             * \param[in] nameSizeInBytes    The length of the name, in bytes.
+             *
+             * \param[in] payloadSizeInBytes The length of the payload, in bytes.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool writeRecordHeader(
+                char               kind,
+                ValueType          valueType,
+                unsigned long long nameSizeInBytes,
+                unsigned long long payloadSizeInBytes
+            );
+
+            /**
+             * Method that writes the directory index to the end of the archive file.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool writeIndex();
+
+            /**
+             * Method that builds the directory from an archive image.  The stored index is used when it is valid.
+             * Otherwise the records are scanned.
+             *
+             * \param[in]  image            Pointer to the archive image.
+             *
+             * \param[in]  sizeInBytes      The size of the archive image, in bytes.
+             *
+             * \param[out] validSizeInBytes The offset just past the last complete record.
+             *
+             * \param[out] indexFound       Set to true if the stored index was used.
+             *
+             * \return Returns true on success.  Returns false if the image is not an archive.
+             */
+            bool loadDirectory(
+                const std::uint8_t* image,
+                unsigned long long  sizeInBytes,
+                unsigned long long& validSizeInBytes,
+                bool&               indexFound
+            );
+
+            /**
+             * Method that builds the directory from the stored index.
+             *
+             * \param[in] image       Pointer to the archive image.
+             *
+             * \param[in] sizeInBytes The size of the archive image, in bytes.
+             *
+             * \return Returns true on success.  Returns false if the index is missing or invalid.
+             */
+            bool loadIndex(const std::uint8_t* image, unsigned long long sizeInBytes);
+
+            /**
+             * Method that builds the directory by scanning every record.  Scanning stops at the first incomplete
+             * record.
+             *
+             * \param[in] image       Pointer to the archive image.
+             *
+             * \param[in] sizeInBytes The size of the archive image, in bytes.
+             *
+             * \return Returns the offset just past the last complete record.
+             */
+            unsigned long long scanRecords(const std::uint8_t* image, unsigned long long sizeInBytes);
+
+            /**
+             * Method that decodes a record header.
+             *
+             * \param[in]  image        Pointer to the archive image.
+             *
+             * \param[in]  sizeInBytes  The size of the archive image, in bytes.
+             *
+             * \param[in]  recordOffset The offset of the record.
+             *
+             * \param[out] kind         The record kind.
+             *
+             * \param[out] entry        The entry described by the record.
+             *
+             * \param[out] name         The record name.
+             *
+             * \return Returns true if the record is complete.  Returns false if the record is invalid.
+             */
+            static bool decodeRecordHeader(
+                const std::uint8_t* image,
+                unsigned long long  sizeInBytes,
+                unsigned long long  recordOffset,
+                char&               kind,
+                Entry&              entry,
+                std::string&        name
+            );
+
+            /**
+             * Method that adds or replaces an entry in the directory.
+             *
+             * \param[in] name  The name of the entry.
+             *
+             * \param[in] entry The entry.
+             */
+            void insertEntry(const std::string& name, const Entry& entry);
+
+            /**
+             * Method that resets this instance to the closed state without writing the index.
+             */
+            void reset();
+
+            /**
+             * The current mode.
+             */
+            Mode currentMode;
+
+            /**
+             * The name of the archive file.
+             */
+            std::string currentFilename;
+
+            /**
+             * The directory, keyed by entry name.
+             */
+            std::unordered_map<std::string, Entry> directory;
+
+            /**
+             * The entry names, in the order the entries were first written.
+             */
+            std::vector<std::string> entryNames;
+
+            /**
+             * The file handle used when appending.
+             */
+            std::FILE* fileHandle;
+
+            /**
+             * The size of the archive file when appending, in bytes.
+             */
+            unsigned long long fileSizeInBytes;
+
+            /**
+             * Flag indicating that entries were appended since the archive was opened.
+             */
+            bool modified;
+
+            /**
+             * The base address of the mapped archive when reading.
+             */
+            void* mappedRegion;
+
+            /**
+             * The size of the mapped archive, in bytes.
+             */
+            unsigned long long mappedRegionSizeInBytes;
+    };
+}
+
+#endif
@@ -230,12 +230,10 @@ namespace M {
         result = UnorderedSetBase::fnv1a32(static_cast<std::uint32_t>(numberRows), result);
         result = UnorderedSetBase::fnv1a32(static_cast<std::uint32_t>(numberColumns), result);
 
-        for (Integer c=1 ; c<=numberColumns ; ++c) {
-            for (Integer r=1 ; r<=numberRows ; ++r) {
-                std::uint8_t v = value.at(static_cast<Integer>(r), static_cast<Integer>(c)) ? 1 : 0;
-                result = UnorderedSetBase::fnv1a8(v, result);
-            }
-        }
+        value.forEach([&result](Boolean coefficient) {
+            std::uint8_t v = coefficient ? 1 : 0;
+            result = UnorderedSetBase::fnv1a8(v, result);
+        });
 
         return result;
     }
@@ -270,12 +268,10 @@ namespace M {
         result = UnorderedSetBase::fnv1a32(static_cast<std::uint32_t>(numberRows), result);
         result = UnorderedSetBase::fnv1a32(static_cast<std::uint32_t>(numberColumns), result);
 
-        for (Integer c=1 ; c<=numberColumns ; ++c) {
-            for (Integer r=1 ; r<=numberRows ; ++r) {
-                std::uint64_t v = static_cast<std::uint64_t>(value(r,c));
-                result = UnorderedSetBase::fnv1a64(v, result);
-            }
-        }
+        value.forEach([&result](Integer coefficient) {
+            std::uint64_t v = static_cast<std::uint64_t>(coefficient);
+            result = UnorderedSetBase::fnv1a64(v, result);
+        });
 
         return result;
     }
@@ -315,17 +311,15 @@ namespace M {
         result = UnorderedSetBase::fnv1a32(static_cast<std::uint32_t>(numberRows), result);
         result = UnorderedSetBase::fnv1a32(static_cast<std::uint32_t>(numberColumns), result);
 
-        for (Integer c=1 ; c<=numberColumns ; ++c) {
-            for (Integer r=1 ; r<=numberRows ; ++r) {
-                union {
-                    std::uint64_t i;
-                    Real          f;
-                } u;
+        value.forEach([&result](Real coefficient) {
+            union {
+                std::uint64_t i;
+                Real          f;
+            } u;
 
-                u.f = value(r,c);
-                result = UnorderedSetBase::fnv1a64(u.i, result);
-            }
-        }
+            u.f = coefficient;
+            result = UnorderedSetBase::fnv1a64(u.i, result);
+        });
 
         return result;
     }
@@ -369,21 +363,18 @@ namespace M {
         result = UnorderedSetBase::fnv1a32(static_cast<std::uint32_t>(numberRows), result);
         result = UnorderedSetBase::fnv1a32(static_cast<std::uint32_t>(numberColumns), result);
 
-        for (Integer c=1 ; c<=numberColumns ; ++c) {
-            for (Integer r=1 ; r<=numberRows ; ++r) {
-                union {
-                    std::uint64_t i;
-                    Real          f;
-                } u;
+        value.forEach([&result](const Complex& coefficient) {
+            union {
+                std::uint64_t i;
+                Real          f;
+            } u;
 
-                const Model::Complex& v = value(r,c);
-                u.f = v.real();
-                result = UnorderedSetBase::fnv1a64(u.i, result);
+            u.f = coefficient.real();
+            result = UnorderedSetBase::fnv1a64(u.i, result);
 
-                u.f = v.imag();
-                result = UnorderedSetBase::fnv1a64(u.i, result);
-            }
-        }
+            u.f = coefficient.imag();
+            result = UnorderedSetBase::fnv1a64(u.i, result);
+        });
 
         return result;
     }
@@ -0,0 +1,260 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+*
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::IterativeSolver class.
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+
+#include "model_exceptions.h"
+#include "m_intrinsic_types.h"
+#include "m_matrix_helpers.h"
+#include "m_matrix_real.h"
+#include "m_matrix_real_data.h"
+#include "m_matrix_real_dense_data.h"
+#include "m_matrix_real_sparse_data.h"
+#include "m_matrix_complex.h"
+#include "m_matrix_complex_data.h"
+#include "m_matrix_complex_dense_data.h"
+#include "m_matrix_complex_sparse_data.h"
+#include "m_iterative_solver_private.h"
+#include "m_iterative_solver.h"
+
+namespace M {
+    constexpr Real          IterativeSolver::defaultTolerance;
+    constexpr unsigned long IterativeSolver::defaultMaximumIterations;
+    constexpr unsigned long IterativeSolver::defaultRestart;
+
+    IterativeSolver::IterativeSolver(
+            IterativeSolver::Method         method,
+            IterativeSolver::Preconditioner preconditioner,
+            Real                            tolerance,
+            unsigned long                   maximumIterations
+        ) {
+        currentMethod            = method;
+        currentPreconditioner    = preconditioner;
+        currentTolerance         = tolerance;
+        currentMaximumIterations = maximumIterations;
+        currentRestart           = defaultRestart;
+        lastConverged            = false;
+        lastNumberIterations     = 0;
+        lastRelativeResidual     = Real(0);
+    }
+
+
+    IterativeSolver::~IterativeSolver() {}
+
+
+    void IterativeSolver::setMethod(IterativeSolver::Method newMethod) {
+        currentMethod = newMethod;
+    }
+
+
+    IterativeSolver::Method IterativeSolver::method() const {
+        return currentMethod;
+    }
+
+
+    void IterativeSolver::setPreconditioner(IterativeSolver::Preconditioner newPreconditioner) {
+        currentPreconditioner = newPreconditioner;
+    }
+
+
+    IterativeSolver::Preconditioner IterativeSolver::preconditioner() const {
+        return currentPreconditioner;
+    }
+
+
+    void IterativeSolver::setTolerance(Real newTolerance) {
+        currentTolerance = newTolerance;
+    }
+
+
+    Real IterativeSolver::tolerance() const {
+        return currentTolerance;
+    }
+
+
+    void IterativeSolver::setMaximumIterations(unsigned long newMaximumIterations) {
+        currentMaximumIterations = newMaximumIterations;
+    }
+
+
+    unsigned long IterativeSolver::maximumIterations() const {
+        return currentMaximumIterations;
+    }
+
+
+    void IterativeSolver::setRestart(unsigned long newRestart) {
+        currentRestart = std::max(newRestart, 1UL);
+    }
+
+
+    unsigned long IterativeSolver::restart() const {
+        return currentRestart;
+    }
+
+
+    MatrixReal IterativeSolver::solve(const MatrixReal& a, const MatrixReal& y) {
+        return solveSystem(a, y, static_cast<const MatrixReal*>(nullptr));
+    }
+
+
+    MatrixReal IterativeSolver::solve(const MatrixReal& a, const MatrixReal& y, const MatrixReal& initialGuess) {
+        return solveSystem(a, y, &initialGuess);
+    }
+
+
+    MatrixComplex IterativeSolver::solve(const MatrixComplex& a, const MatrixComplex& y) {
+        return solveSystem(a, y, static_cast<const MatrixComplex*>(nullptr));
+    }
+
+
+    MatrixComplex IterativeSolver::solve(
+            const MatrixComplex& a,
+            const MatrixComplex& y,
+            const MatrixComplex& initialGuess
+        ) {
+        return solveSystem(a, y, &initialGuess);
+    }
+
+
+    bool IterativeSolver::converged() const {
+        return lastConverged;
+    }
+
+
+    unsigned long IterativeSolver::numberIterations() const {
+        return lastNumberIterations;
+    }
+
+
+    Real IterativeSolver::relativeResidual() const {
+        return lastRelativeResidual;
+    }
+
+
+    template<typename T> T IterativeSolver::solveSystem(const T& a, const T& y, const T* initialGuess) {
+        typedef typename T::Scalar     Scalar;
+        typedef typename T::DenseData  DenseData;
+        typedef typename T::SparseData SparseData;
+
+        a.applyLazyTransformsAndScaling();
+
+        unsigned long aNumberRows    = a.dataStore()->numberRows();
+        unsigned long aNumberColumns = a.dataStore()->numberColumns();
+        unsigned long yNumberRows    = static_cast<unsigned long>(y.numberRows());
+        unsigned long yNumberColumns = static_cast<unsigned long>(y.numberColumns());
+
+        if (aNumberColumns == 0 || aNumberRows == 0 || aNumberRows != aNumberColumns) {
+            throw Model::InvalidMatrixDimensions(aNumberRows, aNumberColumns);
+        } else if (yNumberColumns == 0 || yNumberRows == 0) {
+            throw Model::InvalidMatrixDimensions(yNumberRows, yNumberColumns);
+        } else if (aNumberRows != yNumberRows) {
+            throw Model::IncompatibleMatrixDimensions(aNumberRows, aNumberColumns, yNumberRows, yNumberColumns);
+        } else if (initialGuess != nullptr                                                 &&
+                   (static_cast<unsigned long>(initialGuess->numberRows()) != aNumberColumns ||
+                    static_cast<unsigned long>(initialGuess->numberColumns()) != yNumberColumns)) {
+            throw Model::IncompatibleMatrixDimensions(
+                initialGuess->numberRows(),
+                initialGuess->numberColumns(),
+                aNumberColumns,
+                yNumberColumns
+            );
+        }
+
+        // The iterative methods only need matrix-vector products so we always work from a compressed sparse column
+        // representation of A, converting a dense A once up front.
+
+        const SparseData* sparseA    = nullptr;
+        SparseData*       convertedA = nullptr;
+        if (a.dataStore()->matrixType() == Model::Matrix::MatrixType::DENSE) {
+            convertedA = SparseData::create(*POLYMORPHIC_CAST<const DenseData*>(a.dataStore()));
+            sparseA    = convertedA;
+        } else {
+            assert(a.dataStore()->matrixType() == Model::Matrix::MatrixType::SPARSE);
+            sparseA = POLYMORPHIC_CAST<const SparseData*>(a.dataStore());
+        }
+
+        T result;
+        try {
+            IterativeSolverPrivate<Scalar> engine(
+                aNumberRows,
+                sparseA->columnStarts(),
+                sparseA->rowIndexes(),
+                sparseA->values(),
+                currentPreconditioner
+            );
+
+            T denseY = y.toDense();
+            if (initialGuess != nullptr) {
+                result = initialGuess->toDense();
+            } else {
+                result = T(DenseData::create(aNumberRows, yNumberColumns));
+            }
+
+            const DenseData*   yData          = POLYMORPHIC_CAST<const DenseData*>(denseY.dataStore());
+            DenseData*         xData          = POLYMORPHIC_CAST<DenseData*>(result.dataStore());
+            unsigned long long yColumnSpacing = yData->columnSpacingInMemory();
+            unsigned long long xColumnSpacing = xData->columnSpacingInMemory();
+
+            lastConverged        = true;
+            lastNumberIterations = 0;
+            lastRelativeResidual = Real(0);
+
+            for (unsigned long columnIndex=0 ; columnIndex<yNumberColumns ; ++columnIndex) {
+                unsigned long iterations;
+                Real          relativeResidual;
+
+                bool columnConverged = engine.solve(
+                    currentMethod,
+                    yData->data() + yColumnSpacing * columnIndex,
+                    xData->data() + xColumnSpacing * columnIndex,
+                    currentTolerance,
+                    currentMaximumIterations,
+                    currentRestart,
+                    iterations,
+                    relativeResidual
+                );
+
+                lastConverged        = lastConverged && columnConverged;
+                lastNumberIterations = std::max(lastNumberIterations, iterations);
+                lastRelativeResidual = std::max(lastRelativeResidual, relativeResidual);
+            }
+        } catch (...) {
+            if (convertedA != nullptr) {
+                SparseData::destroy(convertedA);
+            }
+
+            throw;
+        }
+
+        if (convertedA != nullptr) {
+            SparseData::destroy(convertedA);
+        }
+
+        return result;
+    }
+}
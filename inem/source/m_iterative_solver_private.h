@@ -0,0 +1,899 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+*
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This header defines the \ref M::IterativeSolverPrivate template class.
+***********************************************************************************************************************/
+
+/* .. sphinx-project inem */
+
+#ifndef M_ITERATIVE_SOLVER_PRIVATE_H
+#define M_ITERATIVE_SOLVER_PRIVATE_H
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "m_intrinsic_types.h"
+#include "m_iterative_solver.h"
+
+namespace M {
+    /**
+     * Template class that implements the Krylov methods and preconditioners used by \ref M::IterativeSolver.  The
+     * class operates on a square matrix stored in compressed sparse column format.  Row indexes within each column
+     * must be in increasing order.
+     *
+     * \param[in] C The coefficient type.  Both \ref M::Real and \ref M::Complex are supported.
+     */
+    template<typename C> class IterativeSolverPrivate {
+        public:
+            /**
+             * Value used to indicate an invalid entry.
+             */
+            static constexpr unsigned long long invalidEntry = static_cast<unsigned long long>(-1);
+
+            /**
+             * Constructor.  The arrays are referenced, not copied, and must remain valid for the lifetime of this
+             * instance.  The preconditioner is built by the constructor.
+             *
+             * \param[in] numberRowColumns The number of rows and columns in the matrix.
+             *
+             * \param[in] columnStarts     The CSC column start array.
+             *
+             * \param[in] rowIndexes       The CSC row index array.
+             *
+             * \param[in] values           The CSC value array.
+             *
+             * \param[in] preconditioner   The preconditioner to build.
+             */
+            IterativeSolverPrivate(
+                    unsigned long                   numberRowColumns,
+                    const unsigned long long*       columnStarts,
+                    const unsigned long*            rowIndexes,
+                    const C*                        values,
+                    IterativeSolver::Preconditioner preconditioner
+                ):n(
+                    numberRowColumns
+                ),aColumnStarts(
+                    columnStarts
+                ),aRowIndexes(
+                    rowIndexes
+                ),aValues(
+                    values
+                ),currentPreconditioner(
+                    preconditioner
+                ) {
+                switch (preconditioner) {
+                    case IterativeSolver::Preconditioner::NONE:                { break;                         }
+                    case IterativeSolver::Preconditioner::JACOBI:              { buildJacobi();             break; }
+                    case IterativeSolver::Preconditioner::ILU0:                { buildIlu0();               break; }
+                    case IterativeSolver::Preconditioner::INCOMPLETE_CHOLESKY: { buildIncompleteCholesky(); break; }
+                }
+            }
+
+            /**
+             * Method that solves the system for a single right hand side.
+             *
+             * \param[in]     method            The iterative method to use.
+             *
+             * \param[in]     b                 The right hand side.
+             *
+             * \param[in,out] x                 On entry, the initial guess.  On exit, the final iterate.
+             *
+             * \param[in]     tolerance         The relative residual tolerance.
+             *
+             * \param[in]     maximumIterations The maximum number of iterations.
+             *
+             * \param[in]     restart           The GMRES restart length.
+             *
+             * \param[out]    iterations        The number of iterations performed.
+             *
+             * \param[out]    relativeResidual  The final relative residual.
+             *
+             * \return Returns true if the method converged.
+             */
+            bool solve(
+                    IterativeSolver::Method method,
+                    const C*                b,
+                    C*                      x,
+                    Real                    tolerance,
+                    unsigned long           maximumIterations,
+                    unsigned long           restart,
+                    unsigned long&          iterations,
+                    Real&                   relativeResidual
+                ) const {
+                iterations       = 0;
+                relativeResidual = Real(0);
+
+                Real bNorm = norm(b);
+                if (bNorm == Real(0)) {
+                    for (unsigned long i=0 ; i<n ; ++i) {
+                        x[i] = C(0);
+                    }
+
+                    return true;
+                }
+
+                switch (method) {
+                    case IterativeSolver::Method::CONJUGATE_GRADIENT: {
+                        conjugateGradient(b, bNorm, x, tolerance, maximumIterations, iterations, relativeResidual);
+                        break;
+                    }
+
+                    case IterativeSolver::Method::BICGSTAB: {
+                        biCgStab(b, bNorm, x, tolerance, maximumIterations, iterations, relativeResidual);
+                        break;
+                    }
+
+                    case IterativeSolver::Method::GMRES: {
+                        gmres(b, bNorm, x, tolerance, maximumIterations, restart, iterations, relativeResidual);
+                        break;
+                    }
+                }
+
+                return relativeResidual <= tolerance;
+            }
+
+        private:
+            static inline Real conjugate(Real value) {
+                return value;
+            }
+
+            static inline Complex conjugate(const Complex& value) {
+                return value.conj();
+            }
+
+            static inline Real magnitudeSquared(Real value) {
+                return value * value;
+            }
+
+            static inline Real magnitudeSquared(const Complex& value) {
+                return value.real() * value.real() + value.imag() * value.imag();
+            }
+
+            static inline Real realPart(Real value) {
+                return value;
+            }
+
+            static inline Real realPart(const Complex& value) {
+                return value.real();
+            }
+
+            /**
+             * Method that calculates the inner product \f[ a ^ H b \f].
+             *
+             * \param[in] a The first vector.
+             *
+             * \param[in] b The second vector.
+             *
+             * \return Returns the inner product.
+             */
+            C dot(const C* a, const C* b) const {
+                C result(0);
+                for (unsigned long i=0 ; i<n ; ++i) {
+                    result += conjugate(a[i]) * b[i];
+                }
+
+                return result;
+            }
+
+            /**
+             * Method that calculates the 2-norm of a vector.
+             *
+             * \param[in] a The vector.
+             *
+             * \return Returns the 2-norm.
+             */
+            Real norm(const C* a) const {
+                Real result = 0;
+                for (unsigned long i=0 ; i<n ; ++i) {
+                    result += magnitudeSquared(a[i]);
+                }
+
+                return std::sqrt(result);
+            }
+
+            /**
+             * Method that calculates \f[ y = A x \f].
+             *
+             * \param[in]  x The vector to multiply.
+             *
+             * \param[out] y The location to receive the product.
+             */
+            void multiply(const C* x, C* y) const {
+                for (unsigned long i=0 ; i<n ; ++i) {
+                    y[i] = C(0);
+                }
+
+                for (unsigned long columnIndex=0 ; columnIndex<n ; ++columnIndex) {
+                    C xj = x[columnIndex];
+                    if (xj != Real(0)) {
+                        unsigned long long end = aColumnStarts[columnIndex + 1];
+                        for (unsigned long long entryIndex=aColumnStarts[columnIndex] ; entryIndex<end ; ++entryIndex) {
+                            y[aRowIndexes[entryIndex]] += aValues[entryIndex] * xj;
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Method that calculates the residual \f[ r = b - A x \f].
+             *
+             * \param[in]  b The right hand side.
+             *
+             * \param[in]  x The current iterate.
+             *
+             * \param[out] r The location to receive the residual.
+             */
+            void residual(const C* b, const C* x, C* r) const {
+                multiply(x, r);
+                for (unsigned long i=0 ; i<n ; ++i) {
+                    r[i] = b[i] - r[i];
+                }
+            }
+
+            /**
+             * Method that applies the preconditioner, \f[ z = M ^ {-1} r \f].
+             *
+             * \param[in]  r The vector to precondition.
+             *
+             * \param[out] z The location to receive the preconditioned vector.
+             */
+            void precondition(const C* r, C* z) const {
+                switch (currentPreconditioner) {
+                    case IterativeSolver::Preconditioner::NONE: {
+                        for (unsigned long i=0 ; i<n ; ++i) {
+                            z[i] = r[i];
+                        }
+
+                        break;
+                    }
+
+                    case IterativeSolver::Preconditioner::JACOBI: {
+                        for (unsigned long i=0 ; i<n ; ++i) {
+                            z[i] = r[i] * factorPivots[i];
+                        }
+
+                        break;
+                    }
+
+                    case IterativeSolver::Preconditioner::ILU0: {
+                        for (unsigned long i=0 ; i<n ; ++i) {
+                            z[i] = r[i];
+                        }
+
+                        for (unsigned long columnIndex=0 ; columnIndex<n ; ++columnIndex) {
+                            C                  v   = z[columnIndex];
+                            unsigned long long end = aColumnStarts[columnIndex + 1];
+                            for (unsigned long long entryIndex=diagonalEntries[columnIndex] ;
+                                 entryIndex<end                                             ;
+                                 ++entryIndex                                                ) {
+                                unsigned long rowIndex = aRowIndexes[entryIndex];
+                                if (rowIndex > columnIndex) {
+                                    z[rowIndex] -= factorValues[entryIndex] * v;
+                                }
+                            }
+                        }
+
+                        for (unsigned long columnIndex=n ; columnIndex>0 ; --columnIndex) {
+                            unsigned long      j     = columnIndex - 1;
+                            C                  v     = z[j] / factorPivots[j];
+                            unsigned long long start = aColumnStarts[j];
+
+                            z[j] = v;
+                            for (unsigned long long entryIndex=start ; entryIndex<diagonalEntries[j] ; ++entryIndex) {
+                                z[aRowIndexes[entryIndex]] -= factorValues[entryIndex] * v;
+                            }
+                        }
+
+                        break;
+                    }
+
+                    case IterativeSolver::Preconditioner::INCOMPLETE_CHOLESKY: {
+                        for (unsigned long i=0 ; i<n ; ++i) {
+                            z[i] = r[i];
+                        }
+
+                        for (unsigned long columnIndex=0 ; columnIndex<n ; ++columnIndex) {
+                            unsigned long long start = lowerColumnStarts[columnIndex];
+                            unsigned long long end   = lowerColumnStarts[columnIndex + 1];
+
+                            C v = z[columnIndex] / realPart(factorValues[start]);
+                            z[columnIndex] = v;
+
+                            for (unsigned long long entryIndex=start+1 ; entryIndex<end ; ++entryIndex) {
+                                z[lowerRowIndexes[entryIndex]] -= factorValues[entryIndex] * v;
+                            }
+                        }
+
+                        for (unsigned long columnIndex=n ; columnIndex>0 ; --columnIndex) {
+                            unsigned long long start = lowerColumnStarts[columnIndex - 1];
+                            unsigned long long end   = lowerColumnStarts[columnIndex];
+
+                            C v = z[columnIndex - 1];
+                            for (unsigned long long entryIndex=start+1 ; entryIndex<end ; ++entryIndex) {
+                                v -= conjugate(factorValues[entryIndex]) * z[lowerRowIndexes[entryIndex]];
+                            }
+
+                            z[columnIndex - 1] = v / realPart(factorValues[start]);
+                        }
+
+                        break;
+                    }
+                }
+            }
+
+            /**
+             * Method that builds the Jacobi preconditioner.  Missing or zero diagonal entries are treated as 1.
+             */
+            void buildJacobi() {
+                factorPivots.assign(n, C(1));
+                for (unsigned long columnIndex=0 ; columnIndex<n ; ++columnIndex) {
+                    for (unsigned long long entryIndex=aColumnStarts[columnIndex] ;
+                         entryIndex<aColumnStarts[columnIndex + 1]                ;
+                         ++entryIndex                                              ) {
+                        if (aRowIndexes[entryIndex] == columnIndex && aValues[entryIndex] != Real(0)) {
+                            factorPivots[columnIndex] = C(1) / aValues[entryIndex];
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Method that builds the ILU(0) preconditioner using a left-looking column oriented factorization
+             * restricted to the pattern of A.  Missing or zero pivots are replaced by 1.
+             */
+            void buildIlu0() {
+                unsigned long long numberEntries = aColumnStarts[n];
+
+                factorValues.assign(aValues, aValues + numberEntries);
+                factorPivots.assign(n, C(1));
+                diagonalEntries.resize(n);
+
+                std::vector<unsigned long long> position(n, invalidEntry);
+                for (unsigned long j=0 ; j<n ; ++j) {
+                    unsigned long long start = aColumnStarts[j];
+                    unsigned long long end   = aColumnStarts[j + 1];
+
+                    for (unsigned long long entryIndex=start ; entryIndex<end ; ++entryIndex) {
+                        position[aRowIndexes[entryIndex]] = entryIndex;
+                    }
+
+                    // Entries above the diagonal are final once all earlier rows in this column have been applied.
+
+                    unsigned long long entryIndex = start;
+                    while (entryIndex < end && aRowIndexes[entryIndex] < j) {
+                        unsigned long      k   = aRowIndexes[entryIndex];
+                        C                  ukj = factorValues[entryIndex];
+                        unsigned long long kEnd = aColumnStarts[k + 1];
+
+                        for (unsigned long long kIndex=diagonalEntries[k] ; kIndex<kEnd ; ++kIndex) {
+                            unsigned long i = aRowIndexes[kIndex];
+                            if (i > k && position[i] != invalidEntry) {
+                                factorValues[position[i]] -= factorValues[kIndex] * ukj;
+                            }
+                        }
+
+                        ++entryIndex;
+                    }
+
+                    diagonalEntries[j] = entryIndex;
+                    if (entryIndex < end && aRowIndexes[entryIndex] == j && factorValues[entryIndex] != Real(0)) {
+                        factorPivots[j] = factorValues[entryIndex];
+                    }
+
+                    C pivot = factorPivots[j];
+                    for (; entryIndex<end ; ++entryIndex) {
+                        if (aRowIndexes[entryIndex] > j) {
+                            factorValues[entryIndex] /= pivot;
+                        }
+                    }
+
+                    for (unsigned long long index=start ; index<end ; ++index) {
+                        position[aRowIndexes[index]] = invalidEntry;
+                    }
+                }
+            }
+
+            /**
+             * Method that builds the IC(0) preconditioner using a left-looking factorization restricted to the
+             * pattern of the lower triangle of A.  Pivots that are not positive, due to dropped fill or a matrix that
+             * is not positive definite, are replaced by the magnitude of the diagonal of A or by 1 if the diagonal is
+             * zero.
+             */
+            void buildIncompleteCholesky() {
+                // Build the lower triangle, always including a diagonal entry as the first entry of each column.
+
+                lowerColumnStarts.resize(n + 1);
+                lowerColumnStarts[0] = 0;
+                for (unsigned long j=0 ; j<n ; ++j) {
+                    lowerRowIndexes.push_back(j);
+                    factorValues.push_back(C(0));
+
+                    unsigned long long diagonalIndex = factorValues.size() - 1;
+                    unsigned long long end           = aColumnStarts[j + 1];
+                    for (unsigned long long entryIndex=aColumnStarts[j] ; entryIndex<end ; ++entryIndex) {
+                        unsigned long i = aRowIndexes[entryIndex];
+                        if (i == j) {
+                            factorValues[diagonalIndex] = aValues[entryIndex];
+                        } else if (i > j) {
+                            lowerRowIndexes.push_back(i);
+                            factorValues.push_back(aValues[entryIndex]);
+                        }
+                    }
+
+                    lowerColumnStarts[j + 1] = factorValues.size();
+                }
+
+                // Build row lists so we can find the columns k < j with L(j, k) in the pattern.
+
+                unsigned long long              numberEntries = factorValues.size();
+                std::vector<unsigned long long> rowStarts(n + 1, 0);
+                std::vector<unsigned long long> rowEntries(numberEntries - n);
+
+                for (unsigned long long entryIndex=0 ; entryIndex<numberEntries ; ++entryIndex) {
+                    ++rowStarts[lowerRowIndexes[entryIndex] + 1];
+                }
+
+                for (unsigned long j=0 ; j<n ; ++j) {
+                    rowStarts[j + 1] += rowStarts[j] - 1;
+                }
+
+                std::vector<unsigned long long> insertionPoints(rowStarts.begin(), rowStarts.end() - 1);
+                for (unsigned long k=0 ; k<n ; ++k) {
+                    for (unsigned long long entryIndex=lowerColumnStarts[k]+1 ;
+                         entryIndex<lowerColumnStarts[k + 1]                  ;
+                         ++entryIndex                                          ) {
+                        rowEntries[insertionPoints[lowerRowIndexes[entryIndex]]++] = entryIndex;
+                    }
+                }
+
+                std::vector<unsigned long long> position(n, invalidEntry);
+                std::vector<unsigned long>      entryColumn(numberEntries);
+                for (unsigned long k=0 ; k<n ; ++k) {
+                    for (unsigned long long entryIndex=lowerColumnStarts[k] ;
+                         entryIndex<lowerColumnStarts[k + 1]                ;
+                         ++entryIndex                                        ) {
+                        entryColumn[entryIndex] = k;
+                    }
+                }
+
+                for (unsigned long j=0 ; j<n ; ++j) {
+                    unsigned long long start = lowerColumnStarts[j];
+                    unsigned long long end   = lowerColumnStarts[j + 1];
+                    Real               aJJ   = std::sqrt(magnitudeSquared(factorValues[start]));
+
+                    for (unsigned long long entryIndex=start ; entryIndex<end ; ++entryIndex) {
+                        position[lowerRowIndexes[entryIndex]] = entryIndex;
+                    }
+
+                    for (unsigned long long rowIndex=rowStarts[j] ; rowIndex<rowStarts[j + 1] ; ++rowIndex) {
+                        unsigned long long jkIndex = rowEntries[rowIndex];
+                        unsigned long      k       = entryColumn[jkIndex];
+                        unsigned long long kEnd    = lowerColumnStarts[k + 1];
+                        C                  ljk     = conjugate(factorValues[jkIndex]);
+
+                        for (unsigned long long kIndex=jkIndex ; kIndex<kEnd ; ++kIndex) {
+                            unsigned long long destination = position[lowerRowIndexes[kIndex]];
+                            if (destination != invalidEntry) {
+                                factorValues[destination] -= factorValues[kIndex] * ljk;
+                            }
+                        }
+                    }
+
+                    Real pivot = realPart(factorValues[start]);
+                    if (!(pivot > Real(0))) {
+                        pivot = aJJ > Real(0) ? aJJ : Real(1);
+                    }
+
+                    Real ljj = std::sqrt(pivot);
+                    factorValues[start] = C(ljj);
+                    for (unsigned long long entryIndex=start+1 ; entryIndex<end ; ++entryIndex) {
+                        factorValues[entryIndex] /= ljj;
+                    }
+
+                    for (unsigned long long entryIndex=start ; entryIndex<end ; ++entryIndex) {
+                        position[lowerRowIndexes[entryIndex]] = invalidEntry;
+                    }
+                }
+            }
+
+            /**
+             * Method that performs preconditioned conjugate gradient iterations.
+             *
+             * \param[in]     b                 The right hand side.
+             *
+             * \param[in]     bNorm             The 2-norm of the right hand side.
+             *
+             * \param[in,out] x                 The current iterate.
+             *
+             * \param[in]     tolerance         The relative residual tolerance.
+             *
+             * \param[in]     maximumIterations The maximum number of iterations.
+             *
+             * \param[out]    iterations        The number of iterations performed.
+             *
+             * \param[out]    relativeResidual  The final relative residual.
+             */
+            void conjugateGradient(
+                    const C*       b,
+                    Real           bNorm,
+                    C*             x,
+                    Real           tolerance,
+                    unsigned long  maximumIterations,
+                    unsigned long& iterations,
+                    Real&          relativeResidual
+                ) const {
+                std::vector<C> r(n);
+                std::vector<C> z(n);
+                std::vector<C> p(n);
+                std::vector<C> q(n);
+
+                residual(b, x, r.data());
+                relativeResidual = norm(r.data()) / bNorm;
+
+                precondition(r.data(), z.data());
+                p = z;
+
+                C rz = dot(r.data(), z.data());
+                while (relativeResidual > tolerance && iterations < maximumIterations) {
+                    multiply(p.data(), q.data());
+
+                    C pq = dot(p.data(), q.data());
+                    if (pq == Real(0)) {
+                        break;
+                    }
+
+                    C alpha = rz / pq;
+                    for (unsigned long i=0 ; i<n ; ++i) {
+                        x[i] += alpha * p[i];
+                        r[i] -= alpha * q[i];
+                    }
+
+                    ++iterations;
+                    relativeResidual = norm(r.data()) / bNorm;
+
+                    if (relativeResidual > tolerance) {
+                        precondition(r.data(), z.data());
+
+                        C rzNew = dot(r.data(), z.data());
+                        C beta  = rzNew / rz;
+                        rz = rzNew;
+
+                        for (unsigned long i=0 ; i<n ; ++i) {
+                            p[i] = z[i] + beta * p[i];
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Method that performs right preconditioned BiCGSTAB iterations.
+             *
+             * \param[in]     b                 The right hand side.
+             *
+             * \param[in]     bNorm             The 2-norm of the right hand side.
+             *
+             * \param[in,out] x                 The current iterate.
+             *
+             * \param[in]     tolerance         The relative residual tolerance.
+             *
+             * \param[in]     maximumIterations The maximum number of iterations.
+             *
+             * \param[out]    iterations        The number of iterations performed.
+             *
+             * \param[out]    relativeResidual  The final relative residual.
+             */
+            void biCgStab(
+                    const C*       b,
+                    Real           bNorm,
+                    C*             x,
+                    Real           tolerance,
+                    unsigned long  maximumIterations,
+                    unsigned long& iterations,
+                    Real&          relativeResidual
+                ) const {
+                std::vector<C> r(n);
+                std::vector<C> rHat(n);
+                std::vector<C> p(n, C(0));
+                std::vector<C> v(n, C(0));
+                std::vector<C> pHat(n);
+                std::vector<C> s(n);
+                std::vector<C> sHat(n);
+                std::vector<C> t(n);
+
+                residual(b, x, r.data());
+                rHat = r;
+                relativeResidual = norm(r.data()) / bNorm;
+
+                C rho(1);
+                C alpha(1);
+                C omega(1);
+
+                while (relativeResidual > tolerance && iterations < maximumIterations) {
+                    C rhoNew = dot(rHat.data(), r.data());
+                    if (rhoNew == Real(0)) {
+                        break;
+                    }
+
+                    if (iterations == 0) {
+                        p = r;
+                    } else {
+                        C beta = (rhoNew / rho) * (alpha / omega);
+                        for (unsigned long i=0 ; i<n ; ++i) {
+                            p[i] = r[i] + beta * (p[i] - omega * v[i]);
+                        }
+                    }
+
+                    rho = rhoNew;
+
+                    precondition(p.data(), pHat.data());
+                    multiply(pHat.data(), v.data());
+
+                    C rHatV = dot(rHat.data(), v.data());
+                    if (rHatV == Real(0)) {
+                        break;
+                    }
+
+                    alpha = rho / rHatV;
+                    for (unsigned long i=0 ; i<n ; ++i) {
+                        s[i] = r[i] - alpha * v[i];
+                    }
+
+                    ++iterations;
+
+                    Real sResidual = norm(s.data()) / bNorm;
+                    if (sResidual <= tolerance) {
+                        for (unsigned long i=0 ; i<n ; ++i) {
+                            x[i] += alpha * pHat[i];
+                        }
+
+                        relativeResidual = sResidual;
+                        break;
+                    }
+
+                    precondition(s.data(), sHat.data());
+                    multiply(sHat.data(), t.data());
+
+                    Real tt = realPart(dot(t.data(), t.data()));
+                    if (tt == Real(0)) {
+                        for (unsigned long i=0 ; i<n ; ++i) {
+                            x[i] += alpha * pHat[i];
+                        }
+
+                        r = s;
+                        relativeResidual = sResidual;
+                        break;
+                    }
+
+                    omega = dot(t.data(), s.data()) / tt;
+                    for (unsigned long i=0 ; i<n ; ++i) {
+                        x[i] += alpha * pHat[i] + omega * sHat[i];
+                        r[i]  = s[i] - omega * t[i];
+                    }
+
+                    relativeResidual = norm(r.data()) / bNorm;
+                    if (omega == Real(0)) {
+                        break;
+                    }
+                }
+            }
+
+            /**
+             * Method that performs right preconditioned restarted GMRES iterations.  The least squares problem is
+             * solved using Givens rotations.
+             *
+             * \param[in]     b                 The right hand side.
+             *
+             * \param[in]     bNorm             The 2-norm of the right hand side.
+             *
+             * \param[in,out] x                 The current iterate.
+             *
+             * \param[in]     tolerance         The relative residual tolerance.
+             *
+             * \param[in]     maximumIterations The maximum number of iterations.
+             *
+             * \param[in]     restart           The number of iterations between restarts.
+             *
+             * \param[out]    iterations        The number of iterations performed.
+             *
+             * \param[out]    relativeResidual  The final relative residual.
+             */
+            void gmres(
+                    const C*       b,
+                    Real           bNorm,
+                    C*             x,
+                    Real           tolerance,
+                    unsigned long  maximumIterations,
+                    unsigned long  restart,
+                    unsigned long& iterations,
+                    Real&          relativeResidual
+                ) const {
+                unsigned long m = std::max(restart, 1UL);
+
+                std::vector<std::vector<C>> basis(m + 1, std::vector<C>(n));
+                std::vector<std::vector<C>> preconditionedBasis(m, std::vector<C>(n));
+                std::vector<C>              hessenberg((m + 1) * m);
+                std::vector<Real>           cosines(m);
+                std::vector<C>              sines(m);
+                std::vector<C>              g(m + 1);
+                std::vector<C>              y(m);
+                std::vector<C>              w(n);
+
+                residual(b, x, w.data());
+                Real beta = norm(w.data());
+                relativeResidual = beta / bNorm;
+
+                while (relativeResidual > tolerance && iterations < maximumIterations) {
+                    for (unsigned long i=0 ; i<n ; ++i) {
+                        basis[0][i] = w[i] / beta;
+                    }
+
+                    std::fill(g.begin(), g.end(), C(0));
+                    g[0] = C(beta);
+
+                    unsigned long k = 0;
+                    while (k < m && relativeResidual > tolerance && iterations < maximumIterations) {
+                        precondition(basis[k].data(), preconditionedBasis[k].data());
+                        multiply(preconditionedBasis[k].data(), w.data());
+
+                        // Modified Gram-Schmidt orthogonalization.
+
+                        for (unsigned long i=0 ; i<=k ; ++i) {
+                            C h = dot(basis[i].data(), w.data());
+                            hessenberg[i + (m + 1) * k] = h;
+                            for (unsigned long l=0 ; l<n ; ++l) {
+                                w[l] -= h * basis[i][l];
+                            }
+                        }
+
+                        Real wNorm = norm(w.data());
+                        hessenberg[k + 1 + (m + 1) * k] = C(wNorm);
+                        if (wNorm != Real(0)) {
+                            for (unsigned long l=0 ; l<n ; ++l) {
+                                basis[k + 1][l] = w[l] / wNorm;
+                            }
+                        }
+
+                        // Apply previous rotations, then calculate and apply a new rotation to remove the subdiagonal
+                        // entry.
+
+                        C* column = hessenberg.data() + (m + 1) * k;
+                        for (unsigned long i=0 ; i<k ; ++i) {
+                            C upper = cosines[i] * column[i] + sines[i] * column[i + 1];
+                            column[i + 1] = cosines[i] * column[i + 1] - conjugate(sines[i]) * column[i];
+                            column[i]     = upper;
+                        }
+
+                        Real aMagnitude = std::sqrt(magnitudeSquared(column[k]));
+                        Real rho        = std::sqrt(magnitudeSquared(column[k]) + wNorm * wNorm);
+                        if (aMagnitude == Real(0)) {
+                            cosines[k] = Real(0);
+                            sines[k]   = C(1);
+                        } else {
+                            C phase = column[k] / aMagnitude;
+                            cosines[k] = aMagnitude / rho;
+                            sines[k]   = phase * (wNorm / rho);
+                        }
+
+                        column[k]     = cosines[k] * column[k] + sines[k] * column[k + 1];
+                        column[k + 1] = C(0);
+
+                        g[k + 1] = -conjugate(sines[k]) * g[k];
+                        g[k]     = cosines[k] * g[k];
+
+                        ++k;
+                        ++iterations;
+                        relativeResidual = std::sqrt(magnitudeSquared(g[k])) / bNorm;
+
+                        if (wNorm == Real(0)) {
+                            break;
+                        }
+                    }
+
+                    // Solve the upper triangular system and update the iterate.
+
+                    for (unsigned long i=k ; i>0 ; --i) {
+                        unsigned long row = i - 1;
+                        C             v   = g[row];
+                        for (unsigned long j=i ; j<k ; ++j) {
+                            v -= hessenberg[row + (m + 1) * j] * y[j];
+                        }
+
+                        y[row] = v / hessenberg[row + (m + 1) * row];
+                    }
+
+                    for (unsigned long j=0 ; j<k ; ++j) {
+                        for (unsigned long l=0 ; l<n ; ++l) {
+                            x[l] += y[j] * preconditionedBasis[j][l];
+                        }
+                    }
+
+                    residual(b, x, w.data());
+                    beta = norm(w.data());
+                    relativeResidual = beta / bNorm;
+
+                    if (beta == Real(0)) {
+                        break;
+                    }
+                }
+            }
+
+            /**
+             * The number of rows and columns.
+             */
+            unsigned long n;
+
+            /**
+             * The CSC column start array.
+             */
+            const unsigned long long* aColumnStarts;
+
+            /**
+             * The CSC row index array.
+             */
+            const unsigned long* aRowIndexes;
+
+            /**
+             * The CSC value array.
+             */
+            const C* aValues;
+
+            /**
+             * The selected preconditioner.
+             */
+            IterativeSolver::Preconditioner currentPreconditioner;
+
+            /**
+             * Pivot values.  Holds the inverse diagonal for the Jacobi preconditioner and the diagonal of U for the
+             * ILU(0) preconditioner.
+             */
+            std::vector<C> factorPivots;
+
+            /**
+             * Factor values.  Uses the pattern of A for the ILU(0) preconditioner and the pattern held by
+             * lowerColumnStarts and lowerRowIndexes for the IC(0) preconditioner.
+             */
+            std::vector<C> factorValues;
+
+            /**
+             * The index of the first entry on or below the diagonal in each column.  Used by the ILU(0)
+             * preconditioner.
+             */
+            std::vector<unsigned long long> diagonalEntries;
+
+            /**
+             * Column start array for the IC(0) preconditioner.
+             */
+            std::vector<unsigned long long> lowerColumnStarts;
+
+            /**
+             * Row index array for the IC(0) preconditioner.
+             */
+            std::vector<unsigned long> lowerRowIndexes;
+    };
+
+    template<typename C> constexpr unsigned long long IterativeSolverPrivate<C>::invalidEntry;
+}
+
+#endif
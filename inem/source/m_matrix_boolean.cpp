@@ -27,6 +27,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <vector>
 
 #include "m_api_types.h"
 #include "model_exceptions.h"
@@ -217,33 +218,42 @@ namespace M {
             pendingTranspose = false;
         } else {
             assert(other.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            other.applyLazyTransformsAndScaling();
+
+            currentData      = SparseData::create(*POLYMORPHIC_CAST<MatrixInteger::SparseData*>(other.currentData));
+            pendingTranspose = false;
         }
     }
 
 
     MatrixBoolean::MatrixBoolean(const MatrixReal& other) {
-        if (other.currentData->matrixType() == MatrixType::DENSE) {
+        if (other.dataStore()->matrixType() == MatrixType::DENSE) {
             other.applyLazyTransformsAndScaling();
 
-            currentData      = DenseData::create(*POLYMORPHIC_CAST<MatrixReal::DenseData*>(other.currentData));
+            currentData      = DenseData::create(*POLYMORPHIC_CAST<MatrixReal::DenseData*>(other.dataStore()));
             pendingTranspose = false;
         } else {
-            assert(other.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            assert(other.dataStore()->matrixType() == MatrixType::SPARSE);
+            other.applyLazyTransformsAndScaling();
+
+            currentData      = SparseData::create(*POLYMORPHIC_CAST<MatrixReal::SparseData*>(other.dataStore()));
+            pendingTranspose = false;
         }
     }
 
 
     MatrixBoolean::MatrixBoolean(const MatrixComplex& other) {
-        if (other.currentData->matrixType() == MatrixType::DENSE) {
+        if (other.dataStore()->matrixType() == MatrixType::DENSE) {
             other.applyLazyTransformsAndScaling();
 
-            currentData      = DenseData::create(*POLYMORPHIC_CAST<MatrixComplex::DenseData*>(other.currentData));
+            currentData      = DenseData::create(*POLYMORPHIC_CAST<MatrixComplex::DenseData*>(other.dataStore()));
             pendingTranspose = false;
         } else {
-            assert(other.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            assert(other.dataStore()->matrixType() == MatrixType::SPARSE);
+            other.applyLazyTransformsAndScaling();
+
+            currentData      = SparseData::create(*POLYMORPHIC_CAST<MatrixComplex::SparseData*>(other.dataStore()));
+            pendingTranspose = false;
         }
     }
 
@@ -318,6 +328,11 @@ namespace M {
     }
 
 
+    MatrixBoolean MatrixBoolean::sparse(Index numberRows, Index numberColumns) {
+        return MatrixBoolean(SparseData::create(numberRows, numberColumns));
+    }
+
+
     MatrixBoolean MatrixBoolean::diagonalEntries() const {
         unsigned long numberDiagnonalEntries = std::min(currentData->numberRows(), currentData->numberColumns());
         MatrixBoolean result(numberDiagnonalEntries, 1);
@@ -1802,9 +1817,7 @@ namespace M {
             resultData = currentData->combineLeftToRight(*POLYMORPHIC_CAST<const DenseData*>(other.currentData));
         } else {
             assert(other.currentData->matrixType() == Matrix::MatrixType::SPARSE);
-            assert(false); // FIXME
-            resultData = nullptr;
-//            resultData = currentData->combineLeftToRight(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            resultData = currentData->combineLeftToRight(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
         }
 
         return MatrixBoolean(resultData);
@@ -1820,9 +1833,7 @@ namespace M {
             resultData = currentData->combineTopToBottom(*POLYMORPHIC_CAST<const DenseData*>(other.currentData));
         } else {
             assert(other.currentData->matrixType() == Matrix::MatrixType::SPARSE);
-            assert(false); // FIXME
-            resultData = nullptr;
-//            resultData = currentData->combineTopToBottom(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            resultData = currentData->combineTopToBottom(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
         }
 
         return MatrixBoolean(resultData);
@@ -1868,6 +1879,160 @@ namespace M {
     }
 
 
+    MatrixBoolean MatrixBoolean::toSparse() const {
+        applyTransform();
+
+        Data* result;
+        if (currentData->matrixType() == MatrixType::SPARSE) {
+            result = currentData->clone();
+        } else {
+            result = SparseData::create(*POLYMORPHIC_CAST<const DenseData*>(currentData));
+        }
+
+        return MatrixBoolean(result);
+    }
+
+
+    MatrixBoolean MatrixBoolean::toDense() const {
+        applyTransform();
+
+        Data* result;
+        if (currentData->matrixType() == MatrixType::SPARSE) {
+            result = POLYMORPHIC_CAST<const SparseData*>(currentData)->toDense();
+        } else {
+            result = currentData->clone();
+        }
+
+        return MatrixBoolean(result);
+    }
+
+
+    void MatrixBoolean::columnValues(MatrixBoolean::Index column, MatrixBoolean::Scalar* values) const {
+        convertToDenseDataStore();
+
+        unsigned long numberColumns = currentData->numberColumns();
+        if (column < 1 || static_cast<unsigned long>(column) > numberColumns) {
+            throw Model::InvalidColumn(column, numberColumns);
+        }
+
+        POLYMORPHIC_CAST<const DenseData*>(currentData)->columnValues(column - 1, values);
+    }
+
+
+    void MatrixBoolean::updateColumn(MatrixBoolean::Index column, const MatrixBoolean::Scalar* values) {
+        convertToDenseDataStore();
+
+        unsigned long numberColumns = currentData->numberColumns();
+        if (column < 1 || static_cast<unsigned long>(column) > numberColumns) {
+            throw Model::InvalidColumn(column, numberColumns);
+        }
+
+        currentData->lock();
+        if (currentData->referenceCount() > 1) {
+            Data* oldDataStore = currentData;
+            currentData = oldDataStore->clone();
+
+            oldDataStore->unlock();
+            releaseDataStore(oldDataStore);
+        } else {
+            currentData->unlock();
+        }
+
+        POLYMORPHIC_CAST<DenseData*>(currentData)->updateColumn(column - 1, values);
+    }
+
+
+    MatrixBoolean MatrixBoolean::logicalAnd(const MatrixBoolean& other) const {
+        MatrixBoolean a = denseUntransposed();
+        MatrixBoolean b = other.denseUntransposed();
+
+        const DenseData* aData = POLYMORPHIC_CAST<const DenseData*>(a.currentData);
+        const DenseData* bData = POLYMORPHIC_CAST<const DenseData*>(b.currentData);
+
+        return MatrixBoolean(aData->logicalAnd(*bData));
+    }
+
+
+    MatrixBoolean MatrixBoolean::logicalOr(const MatrixBoolean& other) const {
+        MatrixBoolean a = denseUntransposed();
+        MatrixBoolean b = other.denseUntransposed();
+
+        const DenseData* aData = POLYMORPHIC_CAST<const DenseData*>(a.currentData);
+        const DenseData* bData = POLYMORPHIC_CAST<const DenseData*>(b.currentData);
+
+        return MatrixBoolean(aData->logicalOr(*bData));
+    }
+
+
+    MatrixBoolean MatrixBoolean::logicalExclusiveOr(const MatrixBoolean& other) const {
+        MatrixBoolean a = denseUntransposed();
+        MatrixBoolean b = other.denseUntransposed();
+
+        const DenseData* aData = POLYMORPHIC_CAST<const DenseData*>(a.currentData);
+        const DenseData* bData = POLYMORPHIC_CAST<const DenseData*>(b.currentData);
+
+        return MatrixBoolean(aData->logicalExclusiveOr(*bData));
+    }
+
+
+    MatrixBoolean MatrixBoolean::logicalNot() const {
+        MatrixBoolean a = denseUntransposed();
+        return MatrixBoolean(POLYMORPHIC_CAST<const DenseData*>(a.currentData)->logicalNot());
+    }
+
+
+    MatrixBoolean MatrixBoolean::booleanProduct(const MatrixBoolean& multiplicand) const {
+        MatrixBoolean a = denseUntransposed();
+        MatrixBoolean b = multiplicand.denseUntransposed();
+
+        const DenseData* aData = POLYMORPHIC_CAST<const DenseData*>(a.currentData);
+        const DenseData* bData = POLYMORPHIC_CAST<const DenseData*>(b.currentData);
+
+        return MatrixBoolean(aData->booleanProduct(*bData));
+    }
+
+
+    MatrixBoolean MatrixBoolean::gf2Product(const MatrixBoolean& multiplicand) const {
+        MatrixBoolean a = denseUntransposed();
+        MatrixBoolean b = multiplicand.denseUntransposed();
+
+        const DenseData* aData = POLYMORPHIC_CAST<const DenseData*>(a.currentData);
+        const DenseData* bData = POLYMORPHIC_CAST<const DenseData*>(b.currentData);
+
+        return MatrixBoolean(aData->gf2Product(*bData));
+    }
+
+
+    MatrixBoolean MatrixBoolean::transitiveClosure() const {
+        MatrixBoolean a = denseUntransposed();
+        return MatrixBoolean(POLYMORPHIC_CAST<const DenseData*>(a.currentData)->transitiveClosure());
+    }
+
+
+    MatrixBoolean MatrixBoolean::expandFrontier(const MatrixBoolean& frontier, const MatrixBoolean& visited) const {
+        MatrixBoolean a = denseUntransposed();
+        MatrixBoolean f = frontier.denseUntransposed();
+        MatrixBoolean v = visited.denseUntransposed();
+
+        const DenseData* aData = POLYMORPHIC_CAST<const DenseData*>(a.currentData);
+        const DenseData* fData = POLYMORPHIC_CAST<const DenseData*>(f.currentData);
+        const DenseData* vData = POLYMORPHIC_CAST<const DenseData*>(v.currentData);
+
+        return MatrixBoolean(aData->expandFrontier(*fData, *vData));
+    }
+
+
+    MatrixInteger MatrixBoolean::connectedComponents() const {
+        MatrixBoolean    a     = denseUntransposed();
+        const DenseData* aData = POLYMORPHIC_CAST<const DenseData*>(a.currentData);
+
+        std::vector<Integer> labels(aData->numberRows());
+        aData->connectedComponents(labels.data());
+
+        return MatrixInteger(static_cast<Integer>(labels.size()), 1, labels.data());
+    }
+
+
     MatrixBoolean& MatrixBoolean::operator=(const MatrixBoolean& other) {
         assignExistingDataStore(other.currentData, false);
         pendingTranspose = other.pendingTranspose;
@@ -1885,7 +2050,11 @@ namespace M {
             pendingTranspose = false;
         } else {
             assert(other.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            other.applyLazyTransformsAndScaling();
+
+            releaseDataStore(currentData);
+            currentData = SparseData::create(*POLYMORPHIC_CAST<MatrixInteger::SparseData*>(other.currentData));
+            pendingTranspose = false;
         }
 
         return *this;
@@ -1893,15 +2062,19 @@ namespace M {
 
 
     MatrixBoolean& MatrixBoolean::operator=(const MatrixReal& other) {
-        if (other.currentData->matrixType() == MatrixType::DENSE) {
+        if (other.dataStore()->matrixType() == MatrixType::DENSE) {
             other.applyLazyTransformsAndScaling();
 
             releaseDataStore(currentData);
-            currentData = DenseData::create(*POLYMORPHIC_CAST<MatrixReal::DenseData*>(other.currentData));
+            currentData = DenseData::create(*POLYMORPHIC_CAST<MatrixReal::DenseData*>(other.dataStore()));
             pendingTranspose = false;
         } else {
-            assert(other.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            assert(other.dataStore()->matrixType() == MatrixType::SPARSE);
+            other.applyLazyTransformsAndScaling();
+
+            releaseDataStore(currentData);
+            currentData = SparseData::create(*POLYMORPHIC_CAST<MatrixReal::SparseData*>(other.dataStore()));
+            pendingTranspose = false;
         }
 
         return *this;
@@ -1909,15 +2082,19 @@ namespace M {
 
 
     MatrixBoolean& MatrixBoolean::operator=(const MatrixComplex& other) {
-        if (other.currentData->matrixType() == MatrixType::DENSE) {
+        if (other.dataStore()->matrixType() == MatrixType::DENSE) {
             other.applyLazyTransformsAndScaling();
 
             releaseDataStore(currentData);
-            currentData = DenseData::create(*POLYMORPHIC_CAST<MatrixComplex::DenseData*>(other.currentData));
+            currentData = DenseData::create(*POLYMORPHIC_CAST<MatrixComplex::DenseData*>(other.dataStore()));
             pendingTranspose = false;
         } else {
-            assert(other.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            assert(other.dataStore()->matrixType() == MatrixType::SPARSE);
+            other.applyLazyTransformsAndScaling();
+
+            releaseDataStore(currentData);
+            currentData = SparseData::create(*POLYMORPHIC_CAST<MatrixComplex::SparseData*>(other.dataStore()));
+            pendingTranspose = false;
         }
 
         return *this;
@@ -1955,9 +2132,16 @@ namespace M {
             }
         } else {
             assert(other.currentData->matrixType() == Matrix::MatrixType::SPARSE);
-            assert(false); // FIXME
-            result = false;
-//            result = currentData->isEqualTo(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            if (currentData == other.currentData && pendingTranspose == other.pendingTranspose) {
+                result = true;
+            } else {
+                if (pendingTranspose != other.pendingTranspose) {
+                    applyTransform();
+                    other.applyTransform();
+                }
+
+                result = currentData->isEqualTo(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            }
         }
 
         return result;
@@ -2012,7 +2196,7 @@ namespace M {
             while (result && columnIndex<numberColumns) {
                 unsigned long rowIndex = 0;
                 while (result && rowIndex<numberRows) {
-                    bool v = (other.currentData->at(rowIndex, columnIndex) != MatrixReal::Scalar(0));
+                    bool v = (other.dataStore()->at(rowIndex, columnIndex) != MatrixReal::Scalar(0));
                     result = (currentData->at(rowIndex, columnIndex) == v);
 
                     ++rowIndex;
@@ -2044,7 +2228,7 @@ namespace M {
             while (result && columnIndex<numberColumns) {
                 unsigned long rowIndex = 0;
                 while (result && rowIndex<numberRows) {
-                    bool v = (other.currentData->at(rowIndex, columnIndex) != MatrixComplex::Scalar(0));
+                    bool v = (other.dataStore()->at(rowIndex, columnIndex) != MatrixComplex::Scalar(0));
                     result = (currentData->at(rowIndex, columnIndex) == v);
 
                     ++rowIndex;
@@ -2095,7 +2279,7 @@ namespace M {
                 DenseData::destroy(POLYMORPHIC_CAST<DenseData*>(dataStore));
             } else {
                 assert(dataStore->matrixType() == MatrixType::SPARSE);
-                assert(false); // FIXME
+                SparseData::destroy(POLYMORPHIC_CAST<SparseData*>(dataStore));
             }
         }
     }
@@ -2128,4 +2312,21 @@ namespace M {
             pendingTranspose = false;
         }
     }
+
+
+    MatrixBoolean MatrixBoolean::denseUntransposed() const {
+        applyTransform();
+        return currentData->matrixType() == MatrixType::DENSE ? *this : toDense();
+    }
+
+
+    void MatrixBoolean::convertToDenseDataStore() const {
+        applyTransform();
+
+        if (currentData->matrixType() == MatrixType::SPARSE) {
+            currentData->lock();
+            Data* newDataStore = POLYMORPHIC_CAST<const SparseData*>(currentData)->toDense();
+            assignNewDataStore(newDataStore, true);
+        }
+    }
 }
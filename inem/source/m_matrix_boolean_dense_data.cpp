@@ -49,6 +49,7 @@
 #include "m_matrix_boolean.h"
 #include "m_matrix_boolean_data.h"
 #include "m_matrix_boolean_dense_data.h"
+#include "m_matrix_boolean_sparse_data.h"
 
 namespace M {
     std::uint8_t MatrixBoolean::DenseData::byteReverseTable[256] = {
@@ -896,8 +897,11 @@ namespace M {
 
 
     MatrixBoolean::Data* MatrixBoolean::DenseData::combineLeftToRight(const MatrixBoolean::SparseData& other) const {
-        (void) other; // FIXME
-        return nullptr; // FIXME
+        DenseData* denseOther = other.toDense();
+        Data*      result     = combineLeftToRight(*denseOther);
+        destroy(denseOther);
+
+        return result;
     }
 
 
@@ -977,8 +981,11 @@ namespace M {
 
 
     MatrixBoolean::Data* MatrixBoolean::DenseData::combineTopToBottom(const MatrixBoolean::SparseData& other) const {
-        (void) other; // FIXME
-        return nullptr; // FIXME
+        DenseData* denseOther = other.toDense();
+        Data*      result     = combineTopToBottom(*denseOther);
+        destroy(denseOther);
+
+        return result;
     }
 
 
@@ -1257,8 +1264,7 @@ namespace M {
 
 
     bool MatrixBoolean::DenseData::isEqualTo(const MatrixBoolean::SparseData& other) const {
-        (void) other; // FIXME
-        return false; // FIXME
+        return other.isEqualTo(*this);
     }
 
 
@@ -1334,6 +1340,299 @@ namespace M {
     }
 
 
+    MatrixBoolean::DenseData* MatrixBoolean::DenseData::logicalAnd(const MatrixBoolean::DenseData& other) const {
+        return applyLogicalOperation(other, LogicalOperation::AND);
+    }
+
+
+    MatrixBoolean::DenseData* MatrixBoolean::DenseData::logicalOr(const MatrixBoolean::DenseData& other) const {
+        return applyLogicalOperation(other, LogicalOperation::OR);
+    }
+
+
+    MatrixBoolean::DenseData* MatrixBoolean::DenseData::logicalExclusiveOr(
+            const MatrixBoolean::DenseData& other
+        ) const {
+        return applyLogicalOperation(other, LogicalOperation::EXCLUSIVE_OR);
+    }
+
+
+    MatrixBoolean::DenseData* MatrixBoolean::DenseData::logicalNot() const {
+        DenseData* result = ones(currentNumberRows, currentNumberColumns);
+
+        const StorageUnit* s                = rawData;
+        StorageUnit*       d                = result->rawData;
+        unsigned long long numberBits       = columnSizeInBits * currentNumberColumns;
+        unsigned long long usedStorageUnits = (numberBits + storageUnitSizeInBits - 1) / storageUnitSizeInBits;
+
+        for (unsigned long long i=0 ; i<usedStorageUnits ; ++i) {
+            d[i] ^= s[i];
+        }
+
+        result->clearTrailingBits();
+        return result;
+    }
+
+
+    MatrixBoolean::DenseData* MatrixBoolean::DenseData::booleanProduct(
+            const MatrixBoolean::DenseData& multiplicand
+        ) const {
+        return fourRussiansProduct(multiplicand, LogicalOperation::OR);
+    }
+
+
+    MatrixBoolean::DenseData* MatrixBoolean::DenseData::gf2Product(
+            const MatrixBoolean::DenseData& multiplicand
+        ) const {
+        return fourRussiansProduct(multiplicand, LogicalOperation::EXCLUSIVE_OR);
+    }
+
+
+    MatrixBoolean::DenseData* MatrixBoolean::DenseData::transitiveClosure() const {
+        unsigned long numberVertices = currentNumberRows;
+        if (numberVertices != currentNumberColumns) {
+            throw Model::InvalidMatrixDimensions(currentNumberRows, currentNumberColumns);
+        }
+
+        DenseData*         result         = create(*this);
+        StorageUnit*       d              = result->rawData;
+        bool               alignedColumns = (columnSizeInBits % storageUnitSizeInBits) == 0;
+        unsigned long long unitsPerColumn = alignedColumns ? columnSizeInBits / storageUnitSizeInBits : 1;
+
+        // After pass k, entry (i, j) is set if j can be reached from i through vertices 0 through k.  Column j
+        // therefore absorbs column k whenever entry (k, j) is set.
+
+        for (unsigned long k=0 ; k<numberVertices ; ++k) {
+            if (alignedColumns) {
+                const StorageUnit* columnK = d + k * unitsPerColumn;
+                unsigned long long kUnit   = k / storageUnitSizeInBits;
+                unsigned           kShift  = k % storageUnitSizeInBits;
+
+                for (unsigned long j=0 ; j<numberVertices ; ++j) {
+                    StorageUnit* columnJ = d + j * unitsPerColumn;
+                    if (((columnJ[kUnit] >> kShift) & 1) != 0) {
+                        for (unsigned long long i=0 ; i<unitsPerColumn ; ++i) {
+                            columnJ[i] |= columnK[i];
+                        }
+                    }
+                }
+            } else {
+                StorageUnit columnK = result->readBits(k * columnSizeInBits, static_cast<unsigned>(numberVertices));
+
+                for (unsigned long j=0 ; j<numberVertices ; ++j) {
+                    unsigned long long bitOffset = j * columnSizeInBits;
+                    StorageUnit*       columnJ   = d + bitOffset / storageUnitSizeInBits;
+                    unsigned           shift     = bitOffset % storageUnitSizeInBits;
+
+                    if (((*columnJ >> (shift + k)) & 1) != 0) {
+                        *columnJ |= columnK << shift;
+                    }
+                }
+            }
+        }
+
+        return result;
+    }
+
+
+    MatrixBoolean::DenseData* MatrixBoolean::DenseData::expandFrontier(
+            const MatrixBoolean::DenseData& frontier,
+            const MatrixBoolean::DenseData& visited
+        ) const {
+        unsigned long numberVertices = currentNumberRows;
+        if (numberVertices != currentNumberColumns) {
+            throw Model::InvalidMatrixDimensions(currentNumberRows, currentNumberColumns);
+        }
+
+        if (frontier.currentNumberRows != numberVertices || frontier.currentNumberColumns != 1) {
+            throw Model::IncompatibleMatrixDimensions(
+                currentNumberRows,
+                currentNumberColumns,
+                frontier.currentNumberRows,
+                frontier.currentNumberColumns
+            );
+        }
+
+        if (visited.currentNumberRows != numberVertices || visited.currentNumberColumns != 1) {
+            throw Model::IncompatibleMatrixDimensions(
+                currentNumberRows,
+                currentNumberColumns,
+                visited.currentNumberRows,
+                visited.currentNumberColumns
+            );
+        }
+
+        DenseData*         result         = create(numberVertices, 1);
+        StorageUnit*       d              = result->rawData;
+        const StorageUnit* f              = frontier.rawData;
+        const StorageUnit* v              = visited.rawData;
+        bool               alignedColumns = (columnSizeInBits % storageUnitSizeInBits) == 0;
+        unsigned long long unitsPerColumn = alignedColumns ? columnSizeInBits / storageUnitSizeInBits : 1;
+
+        for (unsigned long j=0 ; j<numberVertices ; ++j) {
+            unsigned long long jUnit = j / storageUnitSizeInBits;
+            unsigned           jBit  = j % storageUnitSizeInBits;
+
+            if (((v[jUnit] >> jBit) & 1) == 0) {
+                StorageUnit        scratch;
+                const StorageUnit* column = columnStorageUnits(j, scratch);
+                unsigned long long i      = 0;
+
+                while (i < unitsPerColumn && (column[i] & f[i]) == 0) {
+                    ++i;
+                }
+
+                if (i < unitsPerColumn) {
+                    d[jUnit] |= static_cast<StorageUnit>(1) << jBit;
+                }
+            }
+        }
+
+        return result;
+    }
+
+
+    unsigned long MatrixBoolean::DenseData::connectedComponents(Integer* labels) const {
+        unsigned long numberVertices = currentNumberRows;
+        if (numberVertices != currentNumberColumns) {
+            throw Model::InvalidMatrixDimensions(currentNumberRows, currentNumberColumns);
+        }
+
+        DenseData* transposed = POLYMORPHIC_CAST<DenseData*>(applyTransform());
+        DenseData* symmetric  = logicalOr(*transposed);
+        destroy(transposed);
+
+        unsigned long long numberUnits = (numberVertices + storageUnitSizeInBits - 1) / storageUnitSizeInBits;
+
+        std::vector<StorageUnit> unvisited(numberUnits, ~static_cast<StorageUnit>(0));
+        std::vector<StorageUnit> frontier(numberUnits, 0);
+        std::vector<StorageUnit> next(numberUnits, 0);
+
+        unsigned long numberComponents = 0;
+        for (unsigned long vertex=0 ; vertex<numberVertices ; ++vertex) {
+            unsigned long long vertexUnit = vertex / storageUnitSizeInBits;
+            StorageUnit        vertexMask = static_cast<StorageUnit>(1) << (vertex % storageUnitSizeInBits);
+
+            if ((unvisited[vertexUnit] & vertexMask) != 0) {
+                ++numberComponents;
+
+                std::fill(frontier.begin(), frontier.end(), 0);
+                frontier[vertexUnit] = vertexMask;
+                labels[vertex]       = static_cast<Integer>(numberComponents);
+
+                unvisited[vertexUnit] &= ~vertexMask;
+
+                bool frontierEmpty = false;
+                while (!frontierEmpty) {
+                    std::fill(next.begin(), next.end(), 0);
+
+                    for (unsigned long long unit=0 ; unit<numberUnits ; ++unit) {
+                        StorageUnit frontierBits = frontier[unit];
+                        unsigned    bit          = 0;
+
+                        while (frontierBits != 0) {
+                            if ((frontierBits & 1) != 0) {
+                                StorageUnit        scratch;
+                                unsigned long      column     = unit * storageUnitSizeInBits + bit;
+                                const StorageUnit* columnData = symmetric->columnStorageUnits(column, scratch);
+
+                                for (unsigned long long i=0 ; i<numberUnits ; ++i) {
+                                    next[i] |= columnData[i];
+                                }
+                            }
+
+                            frontierBits >>= 1;
+                            ++bit;
+                        }
+                    }
+
+                    frontierEmpty = true;
+                    for (unsigned long long unit=0 ; unit<numberUnits ; ++unit) {
+                        StorageUnit newBits = next[unit] & unvisited[unit];
+
+                        frontier[unit]   = newBits;
+                        unvisited[unit] &= ~newBits;
+
+                        unsigned bit = 0;
+                        while (newBits != 0) {
+                            if ((newBits & 1) != 0) {
+                                labels[unit * storageUnitSizeInBits + bit] = static_cast<Integer>(numberComponents);
+                                frontierEmpty = false;
+                            }
+
+                            newBits >>= 1;
+                            ++bit;
+                        }
+                    }
+                }
+            }
+        }
+
+        destroy(symmetric);
+        return numberComponents;
+    }
+
+
+    void MatrixBoolean::DenseData::columnValues(unsigned long columnIndex, MatrixBoolean::Scalar* values) const {
+        StorageUnit        scratch;
+        const StorageUnit* column   = columnStorageUnits(columnIndex, scratch);
+        unsigned long      rowIndex = 0;
+
+        while (rowIndex < currentNumberRows) {
+            StorageUnit   unit     = *column++;
+            unsigned long unitRows = currentNumberRows - rowIndex;
+            unsigned long unitEnd  = rowIndex + (unitRows < storageUnitSizeInBits ? unitRows : storageUnitSizeInBits);
+
+            while (rowIndex < unitEnd) {
+                values[rowIndex] = (unit & 1) != 0;
+                unit >>= 1;
+                ++rowIndex;
+            }
+        }
+    }
+
+
+    void MatrixBoolean::DenseData::updateColumn(unsigned long columnIndex, const MatrixBoolean::Scalar* values) {
+        unsigned long rowIndex = 0;
+
+        if (columnSizeInBits % storageUnitSizeInBits == 0) {
+            StorageUnit* column = rawData + columnIndex * (columnSizeInBits / storageUnitSizeInBits);
+
+            while (rowIndex < currentNumberRows) {
+                StorageUnit unit = 0;
+                unsigned    bit  = 0;
+
+                while (bit < storageUnitSizeInBits && rowIndex < currentNumberRows) {
+                    if (values[rowIndex]) {
+                        unit |= StorageUnit(1) << bit;
+                    }
+
+                    ++bit;
+                    ++rowIndex;
+                }
+
+                *column++ = unit;
+            }
+        } else {
+            unsigned long long bitOffset = columnIndex * columnSizeInBits;
+            unsigned           shift     = static_cast<unsigned>(bitOffset % storageUnitSizeInBits);
+            StorageUnit        mask      = ((StorageUnit(1) << columnSizeInBits) - 1) << shift;
+            StorageUnit        unit      = 0;
+
+            while (rowIndex < currentNumberRows) {
+                if (values[rowIndex]) {
+                    unit |= StorageUnit(1) << rowIndex;
+                }
+
+                ++rowIndex;
+            }
+
+            StorageUnit& destination = rawData[bitOffset / storageUnitSizeInBits];
+            destination = (destination & ~mask) | (unit << shift);
+        }
+    }
+
+
     unsigned long long MatrixBoolean::DenseData::recommendedColumnSize(unsigned long numberRows) {
         unsigned long long result;
 
@@ -1762,4 +2061,211 @@ namespace M {
 
         return result;
     }
+
+
+    MatrixBoolean::DenseData* MatrixBoolean::DenseData::applyLogicalOperation(
+            const MatrixBoolean::DenseData&           other,
+            MatrixBoolean::DenseData::LogicalOperation operation
+        ) const {
+        if (currentNumberRows != other.currentNumberRows || currentNumberColumns != other.currentNumberColumns) {
+            throw Model::IncompatibleMatrixDimensions(
+                currentNumberRows,
+                currentNumberColumns,
+                other.currentNumberRows,
+                other.currentNumberColumns
+            );
+        }
+
+        assert(columnSizeInBits == other.columnSizeInBits);
+
+        DenseData*         result           = createUninitialized(currentNumberRows, currentNumberColumns);
+        const StorageUnit* a                = rawData;
+        const StorageUnit* b                = other.rawData;
+        StorageUnit*       d                = result->rawData;
+        unsigned long long numberBits       = columnSizeInBits * currentNumberColumns;
+        unsigned long long usedStorageUnits = (numberBits + storageUnitSizeInBits - 1) / storageUnitSizeInBits;
+
+        switch (operation) {
+            case LogicalOperation::AND: {
+                for (unsigned long long i=0 ; i<usedStorageUnits ; ++i) {
+                    d[i] = a[i] & b[i];
+                }
+
+                break;
+            }
+
+            case LogicalOperation::OR: {
+                for (unsigned long long i=0 ; i<usedStorageUnits ; ++i) {
+                    d[i] = a[i] | b[i];
+                }
+
+                break;
+            }
+
+            case LogicalOperation::EXCLUSIVE_OR: {
+                for (unsigned long long i=0 ; i<usedStorageUnits ; ++i) {
+                    d[i] = a[i] ^ b[i];
+                }
+
+                break;
+            }
+
+            default: {
+                assert(false);
+                break;
+            }
+        }
+
+        result->clearTrailingBits();
+        return result;
+    }
+
+
+    MatrixBoolean::DenseData* MatrixBoolean::DenseData::fourRussiansProduct(
+            const MatrixBoolean::DenseData&           multiplicand,
+            MatrixBoolean::DenseData::LogicalOperation accumulation
+        ) const {
+        unsigned long numberRows    = currentNumberRows;
+        unsigned long numberTerms   = currentNumberColumns;
+        unsigned long numberColumns = multiplicand.currentNumberColumns;
+
+        if (numberTerms != multiplicand.currentNumberRows) {
+            throw Model::IncompatibleMatrixDimensions(
+                numberRows,
+                numberTerms,
+                multiplicand.currentNumberRows,
+                numberColumns
+            );
+        }
+
+        DenseData* result = create(numberRows, numberColumns);
+
+        if (numberRows > 0 && numberTerms > 0 && numberColumns > 0) {
+            bool               exclusiveOr            = (accumulation == LogicalOperation::EXCLUSIVE_OR);
+            bool               alignedColumns         = (columnSizeInBits % storageUnitSizeInBits) == 0;
+            unsigned long long unitsPerColumn         = alignedColumns ? columnSizeInBits / storageUnitSizeInBits : 1;
+            unsigned long long tableSize              = static_cast<unsigned long long>(1) << productGroupSize;
+            StorageUnit*       resultData             = result->rawData;
+            unsigned long long resultColumnSize       = result->columnSizeInBits;
+            unsigned long long multiplicandColumnSize = multiplicand.columnSizeInBits;
+
+            std::vector<StorageUnit> table(tableSize * unitsPerColumn, 0);
+
+            for (unsigned long termIndex=0 ; termIndex<numberTerms ; termIndex+=productGroupSize) {
+                unsigned long remainingTerms = numberTerms - termIndex;
+                unsigned      groupSize      =   remainingTerms < productGroupSize
+                                               ? static_cast<unsigned>(remainingTerms)
+                                               : productGroupSize;
+                unsigned      groupEntries   = 1U << groupSize;
+
+                // Entry i of the table holds the combination of the group columns selected by the bits of i.  Each
+                // entry is built from the entry with the lowest set bit cleared, so building the table costs one
+                // column operation per entry.
+
+                for (unsigned entryIndex=1 ; entryIndex<groupEntries ; ++entryIndex) {
+                    unsigned bitIndex = 0;
+                    while (((entryIndex >> bitIndex) & 1) == 0) {
+                        ++bitIndex;
+                    }
+
+                    const StorageUnit* previous = table.data() + (entryIndex & (entryIndex - 1)) * unitsPerColumn;
+                    StorageUnit*       current  = table.data() + entryIndex * unitsPerColumn;
+                    unsigned long      column   = termIndex + bitIndex;
+
+                    StorageUnit        scratch;
+                    const StorageUnit* columnData = columnStorageUnits(column, scratch);
+
+                    if (exclusiveOr) {
+                        for (unsigned long long i=0 ; i<unitsPerColumn ; ++i) {
+                            current[i] = previous[i] ^ columnData[i];
+                        }
+                    } else {
+                        for (unsigned long long i=0 ; i<unitsPerColumn ; ++i) {
+                            current[i] = previous[i] | columnData[i];
+                        }
+                    }
+                }
+
+                for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+                    unsigned long long selectionOffset = columnIndex * multiplicandColumnSize + termIndex;
+                    StorageUnit        selection       = multiplicand.readBits(selectionOffset, groupSize);
+
+                    if (selection != 0) {
+                        const StorageUnit* entry = table.data() + selection * unitsPerColumn;
+
+                        if (alignedColumns) {
+                            StorageUnit* d = resultData + columnIndex * unitsPerColumn;
+                            if (exclusiveOr) {
+                                for (unsigned long long i=0 ; i<unitsPerColumn ; ++i) {
+                                    d[i] ^= entry[i];
+                                }
+                            } else {
+                                for (unsigned long long i=0 ; i<unitsPerColumn ; ++i) {
+                                    d[i] |= entry[i];
+                                }
+                            }
+                        } else {
+                            unsigned long long bitOffset = columnIndex * resultColumnSize;
+                            StorageUnit*       d         = resultData + bitOffset / storageUnitSizeInBits;
+                            StorageUnit        value     = *entry << (bitOffset % storageUnitSizeInBits);
+
+                            if (exclusiveOr) {
+                                *d ^= value;
+                            } else {
+                                *d |= value;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        return result;
+    }
+
+
+    MatrixBoolean::DenseData::StorageUnit MatrixBoolean::DenseData::readBits(
+            unsigned long long bitOffset,
+            unsigned           numberBits
+        ) const {
+        assert(numberBits < storageUnitSizeInBits);
+        assert((bitOffset % storageUnitSizeInBits) + numberBits <= storageUnitSizeInBits);
+
+        StorageUnit mask = (static_cast<StorageUnit>(1) << numberBits) - 1;
+        return (rawData[bitOffset / storageUnitSizeInBits] >> (bitOffset % storageUnitSizeInBits)) & mask;
+    }
+
+
+    const MatrixBoolean::DenseData::StorageUnit* MatrixBoolean::DenseData::columnStorageUnits(
+            unsigned long                          columnIndex,
+            MatrixBoolean::DenseData::StorageUnit& scratch
+        ) const {
+        const StorageUnit* result;
+
+        if (columnSizeInBits % storageUnitSizeInBits == 0) {
+            result = rawData + columnIndex * (columnSizeInBits / storageUnitSizeInBits);
+        } else {
+            scratch = readBits(columnIndex * columnSizeInBits, static_cast<unsigned>(currentNumberRows));
+            result  = &scratch;
+        }
+
+        return result;
+    }
+
+
+    unsigned long long MatrixBoolean::DenseData::clearTrailingBits() {
+        unsigned long long numberBits       = columnSizeInBits * currentNumberColumns;
+        unsigned long long usedStorageUnits = (numberBits + storageUnitSizeInBits - 1) / storageUnitSizeInBits;
+        unsigned           residueBits      = static_cast<unsigned>(numberBits % storageUnitSizeInBits);
+
+        if (residueBits != 0) {
+            rawData[usedStorageUnits - 1] &= (static_cast<StorageUnit>(1) << residueBits) - 1;
+        }
+
+        if (usedStorageUnits < currentAllocation) {
+            std::memset(rawData + usedStorageUnits, 0, (currentAllocation - usedStorageUnits) * sizeof(StorageUnit));
+        }
+
+        return usedStorageUnits;
+    }
 }
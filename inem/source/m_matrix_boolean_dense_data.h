@@ -441,6 +441,116 @@ namespace M {
              */
             int relativeOrder(const MatrixBoolean::Data& other) const override;
 
+            /**
+             * Method that calculates the element-wise logical AND of this matrix and another matrix.  The operation
+             * is performed a full storage unit at a time.
+             *
+             * \param[in] other The other matrix.  The matrix must have the same dimensions as this matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* logicalAnd(const DenseData& other) const;
+
+            /**
+             * Method that calculates the element-wise logical OR of this matrix and another matrix.  The operation
+             * is performed a full storage unit at a time.
+             *
+             * \param[in] other The other matrix.  The matrix must have the same dimensions as this matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* logicalOr(const DenseData& other) const;
+
+            /**
+             * Method that calculates the element-wise logical exclusive OR of this matrix and another matrix.  The
+             * operation is performed a full storage unit at a time.
+             *
+             * \param[in] other The other matrix.  The matrix must have the same dimensions as this matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* logicalExclusiveOr(const DenseData& other) const;
+
+            /**
+             * Method that calculates the element-wise logical complement of this matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* logicalNot() const;
+
+            /**
+             * Method that calculates the product of this matrix and another matrix over the boolean semiring.  Each
+             * result entry is the logical OR of the logical AND of the corresponding row and column entries.
+             *
+             * \param[in] multiplicand The multiplicand.  The number of rows must match the number of columns in
+             *                         this matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* booleanProduct(const DenseData& multiplicand) const;
+
+            /**
+             * Method that calculates the product of this matrix and another matrix over GF(2).  Each result entry is
+             * the exclusive OR of the logical AND of the corresponding row and column entries.
+             *
+             * \param[in] multiplicand The multiplicand.  The number of rows must match the number of columns in
+             *                         this matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* gf2Product(const DenseData& multiplicand) const;
+
+            /**
+             * Method that calculates the transitive closure of this matrix, treated as the adjacency matrix of a
+             * directed graph.  The closure is calculated using Warshall's algorithm with each column update performed
+             * a full storage unit at a time.
+             *
+             * \return Returns a newly created dense data instance holding the transitive closure.
+             */
+            DenseData* transitiveClosure() const;
+
+            /**
+             * Method that performs one step of a breadth first search over the directed graph described by this
+             * adjacency matrix.  An entry (i, j) indicates an edge from vertex i to vertex j.
+             *
+             * \param[in] frontier The column vector of vertices in the current frontier.
+             *
+             * \param[in] visited  The column vector of vertices to be excluded from the result.
+             *
+             * \return Returns a newly created column vector holding the vertices reachable by a single edge from the
+             *         frontier that are not marked as visited.
+             */
+            DenseData* expandFrontier(const DenseData& frontier, const DenseData& visited) const;
+
+            /**
+             * Method that labels the connected components of the graph described by this adjacency matrix.  Edge
+             * direction is ignored.
+             *
+             * \param[out] labels Array that will receive the one based component label of each vertex.  Components
+             *                    are numbered in order of their lowest vertex.
+             *
+             * \return Returns the number of connected components.
+             */
+            unsigned long connectedComponents(Integer* labels) const;
+
+            /**
+             * Method you can use to unpack every coefficient in a column.
+             *
+             * \param[in]  columnIndex The zero based column index.
+             *
+             * \param[out] values      Array to receive the column coefficients.
+             */
+            void columnValues(unsigned long columnIndex, Scalar* values) const;
+
+            /**
+             * Method you can use to pack new values into every coefficient of a column.
+             *
+             * \param[in] columnIndex The zero based column index.
+             *
+             * \param[in] values      Array holding the new column coefficients.
+             */
+            void updateColumn(unsigned long columnIndex, const Scalar* values);
+
         private:
             /**
              * Type that represents the fundamental storage unit for this matrix type.
@@ -570,6 +680,87 @@ namespace M {
              */
             static StorageUnit reverse(StorageUnit v, unsigned size);
 
+            /**
+             * Enumeration of supported word-wise logical operations.
+             */
+            enum class LogicalOperation {
+                /**
+                 * Indicates a logical AND.
+                 */
+                AND,
+
+                /**
+                 * Indicates a logical OR.
+                 */
+                OR,
+
+                /**
+                 * Indicates a logical exclusive OR.
+                 */
+                EXCLUSIVE_OR
+            };
+
+            /**
+             * Method that applies a logical operation, element-wise, to this matrix and another matrix.
+             *
+             * \param[in] other     The other matrix.  The matrix must have the same dimensions as this matrix.
+             *
+             * \param[in] operation The operation to be applied.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* applyLogicalOperation(const DenseData& other, LogicalOperation operation) const;
+
+            /**
+             * Method that calculates a matrix product using the method of the Four Russians.  The multiplier columns
+             * are taken in groups of \ref productGroupSize.  For each group, every combination of the group's
+             * columns is tabulated so that a single table lookup replaces \ref productGroupSize column updates.
+             *
+             * \param[in] multiplicand The multiplicand.
+             *
+             * \param[in] accumulation The operation used to accumulate terms.  Logical OR yields the boolean
+             *                         semiring product.  Exclusive OR yields the GF(2) product.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* fourRussiansProduct(const DenseData& multiplicand, LogicalOperation accumulation) const;
+
+            /**
+             * Method that reads a run of bits that does not cross a storage unit boundary.
+             *
+             * \param[in] bitOffset  The offset to the first bit.
+             *
+             * \param[in] numberBits The number of bits to read.  The value must be less than the storage unit size.
+             *
+             * \return Returns the requested bits, right justified.
+             */
+            StorageUnit readBits(unsigned long long bitOffset, unsigned numberBits) const;
+
+            /**
+             * Method that locates the storage units holding a column.  Columns shorter than a storage unit are
+             * copied, right justified, into a caller supplied storage unit.
+             *
+             * \param[in]     columnIndex The zero based column index.
+             *
+             * \param[in,out] scratch     Storage unit used to hold columns that do not start on a storage unit
+             *                            boundary.
+             *
+             * \return Returns a pointer to the column data.
+             */
+            const StorageUnit* columnStorageUnits(unsigned long columnIndex, StorageUnit& scratch) const;
+
+            /**
+             * Method that clears any bits past the last column in the last used storage unit.
+             *
+             * \return Returns the number of storage units holding matrix data.
+             */
+            unsigned long long clearTrailingBits();
+
+            /**
+             * The number of multiplier columns tabulated together by \ref fourRussiansProduct.
+             */
+            static constexpr unsigned productGroupSize = 8;
+
             /**
              * The size of the storage unit, in bits.
              */
@@ -0,0 +1,307 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+*
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::MatrixBoolean::SparseData class.
+***********************************************************************************************************************/
+
+#include <new>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+
+#include "m_api_types.h"
+#include "m_intrinsic_types.h"
+#include "model_exceptions.h"
+#include "m_matrix_sparse_private.h"
+#include "m_matrix_integer.h"
+#include "m_matrix_integer_sparse_data.h"
+#include "m_matrix_real.h"
+#include "m_matrix_real_sparse_data.h"
+#include "m_matrix_complex.h"
+#include "m_matrix_complex_sparse_data.h"
+#include "m_matrix_boolean.h"
+#include "m_matrix_boolean_data.h"
+#include "m_matrix_boolean_dense_data.h"
+#include "m_matrix_boolean_sparse_data.h"
+
+namespace M {
+    MatrixBoolean::SparseData::SparseData(
+            unsigned long      newNumberRows,
+            unsigned long      newNumberColumns,
+            unsigned long long newCapacity
+        ):MatrixSparsePrivate<MatrixBoolean::SparseData::Scalar>(
+            newNumberRows,
+            newNumberColumns,
+            newCapacity
+        ) {}
+
+
+    MatrixBoolean::SparseData::SparseData(
+            const MatrixBoolean::SparseData& other
+        ):MatrixBoolean::Data(),
+          MatrixSparsePrivate<MatrixBoolean::SparseData::Scalar>(
+            other
+        ) {}
+
+
+    MatrixBoolean::SparseData::SparseData(
+            const MatrixBoolean::SparseData& other,
+            unsigned long                    newNumberRows,
+            unsigned long                    newNumberColumns
+        ):MatrixSparsePrivate<MatrixBoolean::SparseData::Scalar>(
+            other,
+            newNumberRows,
+            newNumberColumns
+        ) {}
+
+
+    MatrixBoolean::SparseData::~SparseData() {}
+
+
+    MatrixBoolean::SparseData* MatrixBoolean::SparseData::create(const MatrixBoolean::DenseData& other) {
+        // The dense boolean representation is bit packed so we can't use the generic dense conversion.
+
+        unsigned long numberRows    = other.numberRows();
+        unsigned long numberColumns = other.numberColumns();
+
+        SparseData* result = create(numberRows, numberColumns);
+        for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+            for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                if (other.at(rowIndex, columnIndex)) {
+                    new(result->appendEntry(rowIndex)) Scalar(true);
+                }
+            }
+
+            result->closeColumn(columnIndex);
+        }
+
+        return result;
+    }
+
+
+    MatrixBoolean::SparseData* MatrixBoolean::SparseData::create(const MatrixInteger::SparseData& other) {
+        return createConverted<SparseData>(other, [](MatrixInteger::Scalar v) {
+            return v != 0;
+        });
+    }
+
+
+    MatrixBoolean::SparseData* MatrixBoolean::SparseData::create(const MatrixReal::SparseData& other) {
+        return createConverted<SparseData>(other, [](MatrixReal::Scalar v) {
+            return v != 0;
+        });
+    }
+
+
+    MatrixBoolean::SparseData* MatrixBoolean::SparseData::create(const MatrixComplex::SparseData& other) {
+        return createConverted<SparseData>(other, [](const MatrixComplex::Scalar& v) {
+            return v != MatrixComplex::Scalar(0);
+        });
+    }
+
+
+    MatrixBoolean::DenseData* MatrixBoolean::SparseData::toDense() const {
+        DenseData* result = DenseData::create(numberRows(), numberColumns());
+
+        const unsigned long long* starts        = columnStarts();
+        const unsigned long*      rows          = rowIndexes();
+        unsigned long             numberColumns = SparseData::numberColumns();
+
+        for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+            unsigned long long end = starts[columnIndex + 1];
+            for (unsigned long long i=starts[columnIndex] ; i<end ; ++i) {
+                result->update(rows[i], columnIndex, true);
+            }
+        }
+
+        return result;
+    }
+
+
+    bool MatrixBoolean::SparseData::toFile(const char* filename, Model::DataFileFormat fileFormat) const {
+        DenseData* dense = toDense();
+        bool       success;
+
+        try {
+            success = dense->toFile(filename, fileFormat);
+        } catch (...) {
+            DenseData::destroy(dense);
+            throw;
+        }
+
+        DenseData::destroy(dense);
+        return success;
+    }
+
+
+    void MatrixBoolean::SparseData::update(unsigned long rowIndex, unsigned long columnIndex, Scalar newValue) {
+        if (newValue) {
+            MatrixSparsePrivate<Scalar>::at(rowIndex, columnIndex) = true;
+        } else {
+            erase(rowIndex, columnIndex);
+        }
+    }
+
+
+    MatrixBoolean::Data* MatrixBoolean::SparseData::combineLeftToRight(const MatrixBoolean::DenseData& other) const {
+        SparseData* sparseOther = create(other);
+        Data*       result      = combineLeftToRight(*sparseOther);
+        destroy(sparseOther);
+
+        return result;
+    }
+
+
+    MatrixBoolean::Data* MatrixBoolean::SparseData::combineLeftToRight(const MatrixBoolean::SparseData& other) const {
+        SparseData* result = create(
+            std::max(numberRows(), other.numberRows()),
+            numberColumns() + other.numberColumns()
+        );
+
+        combineLeftToRightInto(other, *result);
+        return result;
+    }
+
+
+    MatrixBoolean::Data* MatrixBoolean::SparseData::combineTopToBottom(const MatrixBoolean::DenseData& other) const {
+        SparseData* sparseOther = create(other);
+        Data*       result      = combineTopToBottom(*sparseOther);
+        destroy(sparseOther);
+
+        return result;
+    }
+
+
+    MatrixBoolean::Data* MatrixBoolean::SparseData::combineTopToBottom(const MatrixBoolean::SparseData& other) const {
+        SparseData* result = create(
+            numberRows() + other.numberRows(),
+            std::max(numberColumns(), other.numberColumns())
+        );
+
+        combineTopToBottomInto(other, *result);
+        return result;
+    }
+
+
+    MatrixBoolean::Data* MatrixBoolean::SparseData::columnReverse() const {
+        SparseData* result = create(numberRows(), numberColumns());
+        columnReverseInto(*result);
+
+        return result;
+    }
+
+
+    MatrixBoolean::Data* MatrixBoolean::SparseData::rowReverse() const {
+        SparseData* result = create(numberRows(), numberColumns());
+        rowReverseInto(*result);
+
+        return result;
+    }
+
+
+    MatrixBoolean::Data* MatrixBoolean::SparseData::resizeTo(
+            unsigned long newNumberRows,
+            unsigned long newNumberColumns,
+            bool          alwaysReallocate
+        ) {
+        MatrixBoolean::Data* result = this;
+        if (alwaysReallocate) {
+            result = MatrixSparsePrivate<Scalar>::create<SparseData>(*this, newNumberRows, newNumberColumns);
+        } else {
+            resizeInPlace(newNumberRows, newNumberColumns);
+        }
+
+        return result;
+    }
+
+
+    bool MatrixBoolean::SparseData::resizeInPlaceTo(unsigned long newNumberRows, unsigned long newNumberColumns) {
+        resizeInPlace(newNumberRows, newNumberColumns);
+        return true;
+    }
+
+
+    bool MatrixBoolean::SparseData::isEqualTo(const MatrixBoolean::DenseData& other) const {
+        bool isEqual;
+
+        unsigned long numberRows    = SparseData::numberRows();
+        unsigned long numberColumns = SparseData::numberColumns();
+
+        if (numberRows == other.numberRows() && numberColumns == other.numberColumns()) {
+            const unsigned long long* starts = columnStarts();
+            const unsigned long*      rows   = rowIndexes();
+
+            // Only true values are stored so we walk each dense column, checking it against the stored row indexes.
+
+            isEqual = true;
+            unsigned long columnIndex = 0;
+            while (isEqual && columnIndex < numberColumns) {
+                unsigned long long i   = starts[columnIndex];
+                unsigned long long end = starts[columnIndex + 1];
+
+                unsigned long rowIndex = 0;
+                while (isEqual && rowIndex < numberRows) {
+                    bool stored = (i < end && rows[i] == rowIndex);
+                    isEqual = (other.at(rowIndex, columnIndex) == stored);
+
+                    if (stored) {
+                        ++i;
+                    }
+
+                    ++rowIndex;
+                }
+
+                ++columnIndex;
+            }
+        } else {
+            isEqual = false;
+        }
+
+        return isEqual;
+    }
+
+
+    bool MatrixBoolean::SparseData::isEqualTo(const MatrixBoolean::SparseData& other) const {
+        return MatrixSparsePrivate<Scalar>::isEqualTo(other);
+    }
+
+
+    MatrixBoolean::Data* MatrixBoolean::SparseData::applyTransform() const {
+        return transposed<SparseData>();
+    }
+
+
+    int MatrixBoolean::SparseData::relativeOrder(const MatrixBoolean::Data& other) const {
+        int result;
+
+        if (other.matrixType() == MatrixType::SPARSE) {
+            const SparseData& sparseOther = POLYMORPHIC_CAST<const SparseData&>(other);
+            result = MatrixSparsePrivate<Scalar>::relativeOrder(sparseOther);
+        } else {
+            result = static_cast<int>(matrixType()) - static_cast<int>(other.matrixType());
+        }
+
+        return result;
+    }
+}
@@ -30,105 +30,126 @@
 #ifndef MODEL_MATRIX_BOOLEAN_SPARSE_DATA_H
 #define MODEL_MATRIX_BOOLEAN_SPARSE_DATA_H
 
-#include <cstdint>
-
 #include "model_api_types.h"
 #include "model_intrinsic_types.h"
 #include "m_matrix_sparse_private.h"
-#include "m_matrix_dense_private.h"
+#include "m_matrix_integer.h"
+#include "m_matrix_real.h"
+#include "m_matrix_complex.h"
 #include "m_matrix_boolean_data.h"
 #include "m_matrix_boolean.h"
 
 namespace M {
     /**
      * Private implementation class for \ref M::MatrixBoolean.  This class provides the data store and implementation
-     * for boolean matricies using a sparse data format.
+     * for boolean matricies using a compressed sparse column data format.  Only true values are stored.
      */
-    class MatrixBoolean::SparseData:public MatrixBoolean::Data, public MatrixSparsePrivate<std::uint64_t> {
-        friend class MatrixSparsePrivate<std::uint64_t>;
+    class MatrixBoolean::SparseData:public MatrixBoolean::Data, public MatrixSparsePrivate<Boolean> {
+        friend class MatrixSparsePrivate<Boolean>;
 
         protected:
             /**
              * Constructor
              *
-             * \param[in] newNumberRows        The new number of rows.
-             *
-             * \param[in] newNumberColumns     The new number of columns.
+             * \param[in] newNumberRows    The new number of rows.
              *
-             * \param[in] newAllocationInBytes The size of the allocated data structure, in bytes.
+             * \param[in] newNumberColumns The new number of columns.
              *
-             * \param[in] rawDataBaseAddress   The base address of the raw data stored in the matrix.
+             * \param[in] newCapacity      The initial entry capacity.
              */
             SparseData(
                 unsigned long      newNumberRows,
                 unsigned long      newNumberColumns,
-                unsigned long long newAllocationInBytes,
-                void*              rawDataBaseAddress
+                unsigned long long newCapacity
             );
 
             /**
              * Constructor
              *
-             * \param[in] other                The instance to be copied to this instance.
-             *
-             * \param[in] newAllocationInBytes The size of the allocated data structure, in bytes.
-             *
-             * \param[in] rawDataBaseAddress   The base address of the raw data stored in the matrix.
+             * \param[in] other The instance to be copied to this instance.
              */
-            SparseData(
-                const MatrixDensePrivate<std::uint64_t>& other,
-                unsigned long long                       newAllocationInBytes,
-                void*                                    rawDataBaseAddress
-            );
+            SparseData(const SparseData& other);
 
             /**
              * Constructor
              *
-             * \param[in] other                The instance to be copied to this instance.
-             *
-             * \param[in] newNumberRows        The new number of rows.
+             * \param[in] other            The instance to be copied to this instance.
              *
-             * \param[in] newNumberColumns     The new number of columns.
-             *
-             * \param[in] newAllocationInBytes The size of the allocated data structure, entries.
+             * \param[in] newNumberRows    The new number of rows.
              *
-             * \param[in] rawDataBaseAddress   The base address of the raw data stored in the matrix.
+             * \param[in] newNumberColumns The new number of columns.
              */
             SparseData(
-                const MatrixDensePrivate<std::uint64_t>& other,
-                unsigned long                            newNumberRows,
-                unsigned long                            newNumberColumns,
-                unsigned long long                       newAllocationInBytes,
-                void*                                    rawDataBaseAddress
+                const SparseData& other,
+                unsigned long     newNumberRows,
+                unsigned long     newNumberColumns
             );
 
             ~SparseData() override;
 
         public:
             /**
-             * Method you can call to allocate an instance of this class.
+             * Method you can call to allocate an instance of this class.  The matrix will initially hold no entries.
              *
              * \param[in] newNumberRows    The new number of rows.
              *
              * \param[in] newNumberColumns The new number of columns.
+             *
+             * \param[in] newCapacity      The initial entry capacity.
+             *
+             * \return Returns a pointer to the newly created instance.
              */
             static inline SparseData* create(
-                    unsigned long newNumberRows,
-                    unsigned long newNumberColumns
+                    unsigned long      newNumberRows,
+                    unsigned long      newNumberColumns,
+                    unsigned long long newCapacity = 0
                 ) {
-                (void) newNumberRows;    // FIXME
-                (void) newNumberColumns; // FIXME
-
-                return nullptr; // FIXME
+                return MatrixSparsePrivate<Scalar>::create<SparseData>(newNumberRows, newNumberColumns, newCapacity);
             }
 
+            /**
+             * Method that translates dense matrix data to this type.  Only true coefficients are stored.
+             *
+             * \param[in] other The matrix data to be translated.
+             *
+             * \return Returns the translated matrix.
+             */
+            static SparseData* create(const MatrixBoolean::DenseData& other);
+
+            /**
+             * Method that translates a sparse matrix of a different type to this type.  Non-zero values map to true.
+             *
+             * \param[in] other The matrix data to be translated.
+             *
+             * \return Returns the translated matrix.
+             */
+            static SparseData* create(const MatrixInteger::SparseData& other);
+
+            /**
+             * Method that translates a sparse matrix of a different type to this type.  Non-zero values map to true.
+             *
+             * \param[in] other The matrix data to be translated.
+             *
+             * \return Returns the translated matrix.
+             */
+            static SparseData* create(const MatrixReal::SparseData& other);
+
+            /**
+             * Method that translates a sparse matrix of a different type to this type.  Non-zero values map to true.
+             *
+             * \param[in] other The matrix data to be translated.
+             *
+             * \return Returns the translated matrix.
+             */
+            static SparseData* create(const MatrixComplex::SparseData& other);
+
             /**
              * Method you can call to destroy an instance of this class.
              *
              * \param[in] instance The instance to be destroyed.
              */
             static inline void destroy(SparseData* instance) {
-                (void) instance; // FIXME
+                MatrixSparsePrivate<Scalar>::destroy(instance);
             }
 
             /**
@@ -137,9 +158,16 @@ namespace M {
              * \return Returns a newly created instance of this matrix.
              */
             MatrixBoolean::Data* clone() const override {
-                return nullptr; // FIXME
+                return MatrixSparsePrivate<Scalar>::create(*this);
             }
 
+            /**
+             * Method you can use to obtain a dense copy of this matrix.
+             *
+             * \return Returns a newly created dense instance holding the same values as this matrix.
+             */
+            MatrixBoolean::DenseData* toDense() const;
+
             /**
              * Method you can use to determine the array type.
              *
@@ -157,6 +185,173 @@ namespace M {
             ValueType coefficientType() const override {
                 return ValueType::BOOLEAN;
             }
+
+            /**
+             * Method you can use to save this matrix to a file in binary format.  This method will throw an exception
+             * if an error occurs and the associated exception is enabled.
+             *
+             * \param[in] filename   The filename to save the file to
+             *
+             * \param[in] fileFormat The desired file format.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool toFile(const char* filename, Model::DataFileFormat fileFormat) const override;
+
+            /**
+             * Method you can use to determine number of matrix rows.
+             *
+             * \return Returns the current number of rows.
+             */
+            unsigned long numberRows() const override {
+                return MatrixSparsePrivate<Scalar>::numberRows();
+            }
+
+            /**
+             * Method you can use to determine the number of matrix columns.
+             *
+             * \return Returns the current number of matrix columns.
+             */
+            unsigned long numberColumns() const override {
+                return MatrixSparsePrivate<Scalar>::numberColumns();
+            }
+
+            /**
+             * Method you can use to obtain the value at a given location.
+             *
+             * \param[in] rowIndex    The zero based row index we want the entry from.
+             *
+             * \param[in] columnIndex The zero based column index we want the entry from.
+             *
+             * \return Returns the value at the specified location.
+             */
+            Scalar at(unsigned long rowIndex, unsigned long columnIndex) const override {
+                return MatrixSparsePrivate<Scalar>::at(rowIndex, columnIndex);
+            }
+
+            /**
+             * Method you can use to update a value at a given location.  Setting a value to false removes the entry.
+             *
+             * \param[in] rowIndex    The zero based row index we want the entry from.
+             *
+             * \param[in] columnIndex The zero based column index we want the entry from.
+             *
+             * \param[in] newValue    The new value to be stored.
+             */
+            void update(unsigned long rowIndex, unsigned long columnIndex, Scalar newValue) override;
+
+            /**
+             * Method you can use to combine this matrix with another matrix, left to right.
+             *
+             * \param[in] other The matrix to combine to the right of this matrix.
+             *
+             * \return Returns a newly created matrix holding the combined results.
+             */
+            MatrixBoolean::Data* combineLeftToRight(const MatrixBoolean::DenseData& other) const override;
+
+            /**
+             * Method you can use to combine this matrix with another matrix, left to right.
+             *
+             * \param[in] other The matrix to combine to the right of this matrix.
+             *
+             * \return Returns a newly created matrix holding the combined results.
+             */
+            MatrixBoolean::Data* combineLeftToRight(const MatrixBoolean::SparseData& other) const override;
+
+            /**
+             * Method you can use to combine this matrix with another matrix, top to bottom.
+             *
+             * \param[in] other The matrix to combine below this matrix.
+             *
+             * \return Returns a newly created matrix holding the combined results.
+             */
+            MatrixBoolean::Data* combineTopToBottom(const MatrixBoolean::DenseData& other) const override;
+
+            /**
+             * Method you can use to combine this matrix with another matrix, top to bottom.
+             *
+             * \param[in] other The matrix to combine below this matrix.
+             *
+             * \return Returns a newly created matrix holding the combined results.
+             */
+            MatrixBoolean::Data* combineTopToBottom(const MatrixBoolean::SparseData& other) const override;
+
+            /**
+             * Method you can use to reverse the column order of this matrix.
+             *
+             * \return Returns a newly created matrix holding the reversed data.
+             */
+            MatrixBoolean::Data* columnReverse() const override;
+
+            /**
+             * Method you can use to reverse the row order of this matrix.
+             *
+             * \return Returns a newly created matrix holding the reversed data.
+             */
+            MatrixBoolean::Data* rowReverse() const override;
+
+            /**
+             * Method you can use to resize this matrix.  Entries outside of the new bounds are discarded.
+             *
+             * \param[in] newNumberRows    The new number of rows.
+             *
+             * \param[in] newNumberColumns The new number of columns.
+             *
+             * \param[in] alwaysReallocate If true, a new instance will always be created.
+             *
+             * \return Returns a pointer to the resized matrix.  The pointer may be this instance.
+             */
+            Data* resizeTo(
+                unsigned long newNumberRows,
+                unsigned long newNumberColumns,
+                bool          alwaysReallocate = false
+            ) override;
+
+            /**
+             * Method you can use to resize this matrix, in place.
+             *
+             * \param[in] newNumberRows    The new number of rows.
+             *
+             * \param[in] newNumberColumns The new number of columns.
+             *
+             * \return Returns true on success.  Sparse matrices can always be resized in place.
+             */
+            bool resizeInPlaceTo(unsigned long newNumberRows, unsigned long newNumberColumns) override;
+
+            /**
+             * Method you can use to compare this matrix against another matrix.
+             *
+             * \param[in] other The matrix to compare against.
+             *
+             * \return Returns true if the matrices are equal.  Returns false if the matrices are not equal.
+             */
+            bool isEqualTo(const MatrixBoolean::DenseData& other) const override;
+
+            /**
+             * Method you can use to compare this matrix against another matrix.
+             *
+             * \param[in] other The matrix to compare against.
+             *
+             * \return Returns true if the matrices are equal.  Returns false if the matrices are not equal.
+             */
+            bool isEqualTo(const MatrixBoolean::SparseData& other) const override;
+
+            /**
+             * Method that returns a transposed copy of this matrix.
+             *
+             * \return Returns a newly created, transposed, instance.
+             */
+            Data* applyTransform() const override;
+
+            /**
+             * Method you can use to determine the relative ordering of two matrices.
+             *
+             * \param[in] other The matrix to compare against.
+             *
+             * \return Returns a negative value, zero, or a positive value depending on the relative ordering of the
+             *         matrices.
+             */
+            int relativeOrder(const MatrixBoolean::Data& other) const override;
     };
 }
 
@@ -26,6 +26,7 @@
 ***********************************************************************************************************************/
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 
 #include "m_api_types.h"
@@ -43,6 +44,7 @@
 #include "m_basic_functions.h"
 #include "m_matrix_helpers.h"
 #include "m_matrix_boolean.h"
+#include "m_matrix_boolean_sparse_data.h"
 #include "m_matrix_integer.h"
 #include "m_matrix_integer_data.h"
 #include "m_matrix_integer_dense_data.h"
@@ -50,21 +52,36 @@
 #include "m_matrix_real.h"
 #include "m_matrix_real_data.h"
 #include "m_matrix_real_dense_data.h"
+#include "m_matrix_real_sparse_data.h"
 #include "m_matrix_complex.h"
 #include "m_matrix_complex_data.h"
 #include "m_matrix_complex_dense_data.h"
 #include "m_matrix_complex_sparse_data.h"
+#include "m_matrix_small_private.h"
 
 namespace M {
     const MatrixComplex::Scalar MatrixComplex::zeroValue(0);
 
+    static std::atomic<Real>               currentSparseDensityThreshold(0.05);
+    static std::atomic<Real>               currentDenseDensityThreshold(0.25);
+    static std::atomic<unsigned long long> currentAutomaticStorageMinimumCoefficients(4096);
+
+    static_assert(
+        MatrixSmallPrivate<MatrixComplex::Scalar>::maximumDimension == 4,
+        "Inline small matrix storage does not match the small matrix kernels."
+    );
+
     MatrixComplex::MatrixComplex(Integer newNumberRows, Integer newNumberColumns) {
         if (newNumberRows < 0) {
             throw Model::InvalidRow(newNumberRows, 0);
         } else if (newNumberColumns < 0) {
             throw Model::InvalidColumn(newNumberColumns, 0);
+        } else if (MatrixSmallPrivate<Scalar>::isSmall(newNumberRows, newNumberColumns)) {
+            configureSmallStorage(newNumberRows, newNumberColumns);
+            std::fill(smallCoefficients, smallCoefficients + newNumberRows * newNumberColumns, Scalar(0));
         } else {
             currentData = DenseData::create(newNumberRows, newNumberColumns);
+            currentView.parent = nullptr;
             pendingTransform   = LazyTransform::NONE;
             pendingScalarValue = Complex(1, 0);
         }
@@ -80,8 +97,12 @@ namespace M {
             throw Model::InvalidRow(newNumberRows, 0);
         } else if (newNumberColumns < 0) {
             throw Model::InvalidColumn(newNumberColumns, 0);
+        } else if (MatrixSmallPrivate<Scalar>::isSmall(newNumberRows, newNumberColumns)) {
+            configureSmallStorage(newNumberRows, newNumberColumns);
+            std::copy(matrixData, matrixData + newNumberRows * newNumberColumns, smallCoefficients);
         } else {
             currentData = DenseData::create(newNumberRows, newNumberColumns, matrixData);
+            currentView.parent = nullptr;
             pendingTransform   = LazyTransform::NONE;
             pendingScalarValue = Complex(1, 0);
         }
@@ -104,11 +125,12 @@ namespace M {
 
 
     MatrixComplex::MatrixComplex(const MatrixComplex& other) {
-        other.currentData->addReference();
-        currentData = other.currentData;
+        copyStorage(other);
+    }
 
-        pendingTransform   = other.pendingTransform;
-        pendingScalarValue = other.pendingScalarValue;
+
+    MatrixComplex::MatrixComplex(MatrixComplex&& other) noexcept {
+        moveStorage(other);
     }
 
 
@@ -117,11 +139,7 @@ namespace M {
         MatrixComplex v = other.toMatrixComplex(&ok);
 
         if (ok) {
-            v.currentData->addReference();
-            currentData = v.currentData;
-
-            pendingTransform   = v.pendingTransform;
-            pendingScalarValue = v.pendingScalarValue;
+            copyStorage(v);
         } else {
             throw Model::InvalidRuntimeConversion(other.valueType(), ValueType::MATRIX_COMPLEX);
         }
@@ -129,7 +147,7 @@ namespace M {
 
 
     MatrixComplex::~MatrixComplex() {
-        releaseDataStore(currentData);
+        releaseStorage();
     }
 
 
@@ -139,22 +157,28 @@ namespace M {
 
 
     bool MatrixComplex::toFile(const char* filename, Model::DataFileFormat fileFormat) const {
-        return currentData->toFile(filename, fileFormat);
+        return dataStore()->toFile(filename, fileFormat);
     }
 
 
     MatrixComplex MatrixComplex::fromFile(const char* filename) {
-        return MatrixComplex(DenseData::fromFile(filename));
+        MatrixComplex result(DenseData::fromFile(filename));
+        result.applyStoragePolicy();
+
+        return result;
     }
 
 
     MatrixComplex::Index MatrixComplex::numberRows() const {
         Index result;
 
-        if (pendingTransform != LazyTransform::ADJOINT && pendingTransform != LazyTransform::TRANSPOSE) {
-            result = currentData->numberRows();
+        bool transposed = (pendingTransform == LazyTransform::ADJOINT || pendingTransform == LazyTransform::TRANSPOSE);
+        if (hasSmallStorage()) {
+            result = transposed ? smallNumberColumns : smallNumberRows;
+        } else if (currentData == nullptr) {
+            result = transposed ? currentView.numberColumns : currentView.numberRows;
         } else {
-            result = currentData->numberColumns();
+            result = transposed ? currentData->numberColumns() : currentData->numberRows();
         }
 
         return result;
@@ -164,10 +188,13 @@ namespace M {
     MatrixComplex::Index MatrixComplex::numberColumns() const {
         Index result;
 
-        if (pendingTransform != LazyTransform::ADJOINT && pendingTransform != LazyTransform::TRANSPOSE) {
-            result = currentData->numberColumns();
+        bool transposed = (pendingTransform == LazyTransform::ADJOINT || pendingTransform == LazyTransform::TRANSPOSE);
+        if (hasSmallStorage()) {
+            result = transposed ? smallNumberRows : smallNumberColumns;
+        } else if (currentData == nullptr) {
+            result = transposed ? currentView.numberRows : currentView.numberColumns;
         } else {
-            result = currentData->numberRows();
+            result = transposed ? currentData->numberRows() : currentData->numberColumns();
         }
 
         return result;
@@ -175,16 +202,25 @@ namespace M {
 
 
     MatrixComplex::Index MatrixComplex::numberCoefficients() const {
-        return currentData->numberRows() * currentData->numberColumns();
+        return numberRows() * numberColumns();
     }
 
 
     Model::Variant MatrixComplex::value(MatrixComplex::Index row, MatrixComplex::Index column) const {
         Model::Variant result;
 
-        if (row > 0 && static_cast<unsigned long>(row) <= currentData->numberRows()          &&
-            column > 0 && static_cast<unsigned long>(column) <= currentData->numberColumns()    ) {
-            result = currentData->at(row - 1, column - 1);
+        if (hasSmallStorage()) {
+            if (row > 0 && row <= smallNumberRows && column > 0 && column <= smallNumberColumns) {
+                result = smallCoefficients[(column - 1) * smallNumberRows + (row - 1)];
+            }
+        } else if (currentData == nullptr) {
+            if (row > 0 && static_cast<unsigned long>(row) <= currentView.numberRows          &&
+                column > 0 && static_cast<unsigned long>(column) <= currentView.numberColumns    ) {
+                result = storedCoefficient(row - 1, column - 1);
+            }
+        } else if (row > 0 && static_cast<unsigned long>(row) <= currentData->numberRows()          &&
+                   column > 0 && static_cast<unsigned long>(column) <= currentData->numberColumns()    ) {
+            result = static_cast<const Data*>(currentData)->at(row - 1, column - 1);
         }
 
         return result;
@@ -192,33 +228,90 @@ namespace M {
 
 
     MatrixComplex MatrixComplex::identity(Index numberRows, Index numberColumns) {
-        return MatrixComplex(DenseData::identity(numberRows, numberColumns));
+        MatrixComplex result;
+
+        if (numberRows >= 0 && numberColumns >= 0 && MatrixSmallPrivate<Scalar>::isSmall(numberRows, numberColumns)) {
+            result = MatrixComplex(numberRows, numberColumns);
+
+            Index numberDiagonalEntries = std::min(numberRows, numberColumns);
+            for (Index index=0 ; index<numberDiagonalEntries ; ++index) {
+                result.smallCoefficients[index * numberRows + index] = Scalar(1);
+            }
+        } else {
+            result = MatrixComplex(DenseData::identity(numberRows, numberColumns));
+        }
+
+        return result;
     }
 
 
     MatrixComplex MatrixComplex::identity(Index numberRowColumns) {
-        return MatrixComplex(DenseData::identity(numberRowColumns, numberRowColumns));
+        return identity(numberRowColumns, numberRowColumns);
     }
 
 
     MatrixComplex MatrixComplex::ones(Index numberRows, Index numberColumns) {
-        return MatrixComplex(DenseData::ones(numberRows, numberColumns));
+        MatrixComplex result;
+
+        if (numberRows >= 0 && numberColumns >= 0 && MatrixSmallPrivate<Scalar>::isSmall(numberRows, numberColumns)) {
+            result.configureSmallStorage(numberRows, numberColumns);
+            std::fill(result.smallCoefficients, result.smallCoefficients + numberRows * numberColumns, Scalar(1));
+        } else {
+            result = MatrixComplex(DenseData::ones(numberRows, numberColumns));
+        }
+
+        return result;
     }
 
 
     MatrixComplex MatrixComplex::ones(Index numberRowColumns) {
-        return MatrixComplex(DenseData::ones(numberRowColumns, numberRowColumns));
+        return ones(numberRowColumns, numberRowColumns);
+    }
+
+
+    MatrixComplex MatrixComplex::sparse(Index numberRows, Index numberColumns) {
+        return MatrixComplex(SparseData::create(numberRows, numberColumns));
+    }
+
+
+    void MatrixComplex::setSparseDensityThreshold(Real newThreshold) {
+        currentSparseDensityThreshold = newThreshold;
+    }
+
+
+    Real MatrixComplex::sparseDensityThreshold() {
+        return currentSparseDensityThreshold;
+    }
+
+
+    void MatrixComplex::setDenseDensityThreshold(Real newThreshold) {
+        currentDenseDensityThreshold = newThreshold;
+    }
+
+
+    Real MatrixComplex::denseDensityThreshold() {
+        return currentDenseDensityThreshold;
+    }
+
+
+    void MatrixComplex::setAutomaticStorageMinimumCoefficients(unsigned long long newMinimum) {
+        currentAutomaticStorageMinimumCoefficients = newMinimum;
+    }
+
+
+    unsigned long long MatrixComplex::automaticStorageMinimumCoefficients() {
+        return currentAutomaticStorageMinimumCoefficients;
     }
 
 
     MatrixComplex MatrixComplex::diagonalEntries() const {
-        unsigned long numberDiagnonalEntries = std::min(currentData->numberRows(), currentData->numberColumns());
+        unsigned long numberDiagnonalEntries = std::min(dataStore()->numberRows(), dataStore()->numberColumns());
         MatrixComplex result(numberDiagnonalEntries, 1);
 
-        Scalar* data = result.currentData->data();
+        Scalar* data = result.dataStore()->data();
 
         for (unsigned index=0 ; index<numberDiagnonalEntries ; ++index) {
-            Scalar v = currentData->at(index, index);
+            Scalar v = static_cast<const Data*>(dataStore())->at(index, index);
             data[index] = v;
         }
 
@@ -227,19 +320,20 @@ namespace M {
 
 
     MatrixComplex MatrixComplex::diagonal() const {
-        unsigned long numberRows    = currentData->numberRows();
-        unsigned long numberColumns = currentData->numberColumns();
+        const Data*   sourceData    = dataStore();
+        unsigned long numberRows    = dataStore()->numberRows();
+        unsigned long numberColumns = dataStore()->numberColumns();
         DenseData*    result        = nullptr;
 
         if ((numberRows != 1 && numberColumns != 1) || numberRows == 0 || numberColumns == 0) {
             throw Model::InvalidMatrixDimensions(numberRows, numberColumns);
         } else {
             unsigned long numberValues = std::max(numberRows, numberColumns);
-            Scalar*       data         = currentData->data();
+            bool          isRowVector  = (numberRows == 1);
 
             result = DenseData::create(numberValues, numberValues);
             for (unsigned i=0 ; i<numberValues ; ++i) {
-                Scalar  v = data[i];
+                Scalar  v = isRowVector ? sourceData->at(0, i) : sourceData->at(i, 0);
                 Scalar* d = &(result->at(i, i));
                 *d = v;
             }
@@ -252,16 +346,28 @@ namespace M {
     Model::Variant MatrixComplex::value(Matrix::Index index) const {
         Model::Variant result;
 
-        unsigned long      numberRows         = currentData->numberRows();
-        unsigned long      numberColumns      = currentData->numberColumns();
+        unsigned long numberRows;
+        unsigned long numberColumns;
+
+        if (hasSmallStorage()) {
+            numberRows    = smallNumberRows;
+            numberColumns = smallNumberColumns;
+        } else if (currentData == nullptr) {
+            numberRows    = currentView.numberRows;
+            numberColumns = currentView.numberColumns;
+        } else {
+            numberRows    = currentData->numberRows();
+            numberColumns = currentData->numberColumns();
+        }
+
         unsigned long long numberCoefficients = numberRows * numberColumns;
 
-        if (index > 0 || static_cast<unsigned long long>(index) <= numberCoefficients) {
+        if (index > 0 && static_cast<unsigned long long>(index) <= numberCoefficients) {
             unsigned long long i           = static_cast<unsigned long long>(index - 1);
             unsigned long      rowIndex    = i / numberColumns;
             unsigned long      columnIndex = i % numberColumns;
 
-            result = currentData->at(rowIndex, columnIndex);
+            result = storedCoefficient(rowIndex, columnIndex);
         }
 
         return result;
@@ -305,19 +411,26 @@ namespace M {
     void MatrixComplex::resize(MatrixComplex::Index newNumberRows, MatrixComplex::Index newNumberColumns) {
         applyLazyTransformsAndScaling();
 
-        currentData->lock();
-        if (currentData->referenceCount() > 1) {
-            Data* oldDataStore = currentData;
-            currentData = currentData->resizeTo(newNumberRows, newNumberColumns, true);
-
-            oldDataStore->unlock();
-            releaseDataStore(oldDataStore);
+        if (hasSmallStorage()                                                &&
+            newNumberRows >= 0                                               &&
+            newNumberColumns >= 0                                            &&
+            MatrixSmallPrivate<Scalar>::isSmall(newNumberRows, newNumberColumns)    ) {
+            resizeSmallStorage(newNumberRows, newNumberColumns);
         } else {
-            Data* newDataStore = currentData->resizeTo(newNumberRows, newNumberColumns, false);
-            if (newDataStore != currentData) {
-                assignNewDataStore(newDataStore, true);
+            dataStore()->lock();
+            if (dataStore()->referenceCount() > 1) {
+                Data* oldDataStore = dataStore();
+                currentData = dataStore()->resizeTo(newNumberRows, newNumberColumns, true);
+
+                oldDataStore->unlock();
+                releaseDataStore(oldDataStore);
             } else {
-                currentData->unlock();
+                Data* newDataStore = dataStore()->resizeTo(newNumberRows, newNumberColumns, false);
+                if (newDataStore != dataStore()) {
+                    assignNewDataStore(newDataStore, true);
+                } else {
+                    dataStore()->unlock();
+                }
             }
         }
     }
@@ -336,18 +449,18 @@ namespace M {
 
         const Scalar* result = nullptr;
 
-        unsigned long      numberRows         = currentData->numberRows();
-        unsigned long      numberColumns      = currentData->numberColumns();
+        unsigned long      numberRows         = static_cast<unsigned long>(MatrixComplex::numberRows());
+        unsigned long      numberColumns      = static_cast<unsigned long>(MatrixComplex::numberColumns());
         unsigned long long numberCoefficients = numberRows * numberColumns;
 
-        if (index < 1 && static_cast<unsigned long long>(index) > numberCoefficients) {
+        if (index < 1 || static_cast<unsigned long long>(index) > numberCoefficients) {
             throw Model::InvalidIndex(index, numberCoefficients);
         } else {
             unsigned long long i           = static_cast<unsigned long long>(index - 1);
             unsigned long      rowIndex    = i / numberColumns;
             unsigned long      columnIndex = i % numberColumns;
 
-            result = &(currentData->at(rowIndex, columnIndex));
+            result = &storedCoefficient(rowIndex, columnIndex);
         }
 
         return *result;
@@ -769,7 +882,25 @@ namespace M {
 
 
     MatrixComplex MatrixComplex::at(const Range& rowRange, MatrixComplex::Index column) const {
-        return atICHelper(*this, rowRange, column);
+        MatrixComplex result;
+
+        applyLazyTransformsAndScaling();
+
+        unsigned long numberRows = static_cast<unsigned long>(MatrixComplex::numberRows());
+        unsigned long firstRow;
+        long long     rowStride;
+        unsigned long rowCount;
+
+        if (matrixType() == MatrixType::DENSE                                     &&
+            column >= 1                                                           &&
+            column <= MatrixComplex::numberColumns()                              &&
+            stridedRangeHelper(rowRange, numberRows, firstRow, rowStride, rowCount)    ) {
+            result = submatrix(firstRow, rowStride, rowCount, static_cast<unsigned long>(column - 1), 1, 1);
+        } else {
+            result = atICHelper(*this, rowRange, column);
+        }
+
+        return result;
     }
 
 
@@ -784,12 +915,58 @@ namespace M {
 
 
     MatrixComplex MatrixComplex::at(const Range& rowRange, const Range& columnRange) const {
-        return atIIHelper(*this, rowRange, columnRange);
+        MatrixComplex result;
+
+        applyLazyTransformsAndScaling();
+
+        unsigned long numberRows    = static_cast<unsigned long>(MatrixComplex::numberRows());
+        unsigned long numberColumns = static_cast<unsigned long>(MatrixComplex::numberColumns());
+        unsigned long firstRow;
+        long long     rowStride;
+        unsigned long rowCount;
+        unsigned long firstColumn;
+        long long     columnStride;
+        unsigned long columnCount;
+
+        if (matrixType() == MatrixType::DENSE                                                    &&
+            stridedRangeHelper(rowRange, numberRows, firstRow, rowStride, rowCount)              &&
+            stridedRangeHelper(columnRange, numberColumns, firstColumn, columnStride, columnCount)    ) {
+            bool allRows    = firstRow == 0 && rowStride == 1 && rowCount == numberRows;
+            bool allColumns = firstColumn == 0 && columnStride == 1 && columnCount == numberColumns;
+
+            if (allRows && allColumns) {
+                result = *this;
+            } else {
+                result = submatrix(firstRow, rowStride, rowCount, firstColumn, columnStride, columnCount);
+            }
+        } else {
+            result = atIIHelper(*this, rowRange, columnRange);
+        }
+
+        return result;
     }
 
 
     MatrixComplex MatrixComplex::at(MatrixComplex::Index row, const Range& columnRange) const {
-        return atCIHelper(*this, row, columnRange);
+        MatrixComplex result;
+
+        applyLazyTransformsAndScaling();
+
+        unsigned long numberColumns = static_cast<unsigned long>(MatrixComplex::numberColumns());
+        unsigned long firstColumn;
+        long long     columnStride;
+        unsigned long columnCount;
+
+        if (matrixType() == MatrixType::DENSE                                                    &&
+            row >= 1                                                                             &&
+            row <= MatrixComplex::numberRows()                                                   &&
+            stridedRangeHelper(columnRange, numberColumns, firstColumn, columnStride, columnCount)    ) {
+            result = submatrix(static_cast<unsigned long>(row - 1), 1, 1, firstColumn, columnStride, columnCount);
+        } else {
+            result = atCIHelper(*this, row, columnRange);
+        }
+
+        return result;
     }
 
 
@@ -1548,15 +1725,15 @@ namespace M {
 
         const Scalar* result = nullptr;
 
-        unsigned long numberRows = currentData->numberRows();
+        unsigned long numberRows = static_cast<unsigned long>(MatrixComplex::numberRows());
         if (row < 1 || static_cast<unsigned long>(row) > numberRows) {
             throw Model::InvalidRow(row, numberRows);
         } else {
-            unsigned long numberColumns = currentData->numberColumns();
+            unsigned long numberColumns = static_cast<unsigned long>(MatrixComplex::numberColumns());
             if (column < 1 || static_cast<unsigned long>(column) > numberColumns) {
                 throw Model::InvalidColumn(column, numberColumns);
             } else {
-                result = &(currentData->at(row - 1, column - 1));
+                result = &storedCoefficient(row - 1, column - 1);
             }
         }
 
@@ -1568,23 +1745,29 @@ namespace M {
         applyLazyTransformsAndScaling();
 
         if (row < 1) {
-            throw Model::InvalidRow(row, currentData->numberRows());
+            throw Model::InvalidRow(row, numberRows());
         } else if (column < 1) {
-            throw Model::InvalidColumn(column, currentData->numberColumns());
+            throw Model::InvalidColumn(column, numberColumns());
+        } else if (hasSmallStorage() && MatrixSmallPrivate<Scalar>::isSmall(row, column)) {
+            if (row > smallNumberRows || column > smallNumberColumns) {
+                resizeSmallStorage(std::max<Index>(row, smallNumberRows), std::max<Index>(column, smallNumberColumns));
+            }
+
+            smallCoefficients[(column - 1) * smallNumberRows + (row - 1)] = newValue;
         } else {
-            unsigned long numberRows    = currentData->numberRows();
-            unsigned long numberColumns = currentData->numberColumns();
+            unsigned long numberRows    = dataStore()->numberRows();
+            unsigned long numberColumns = dataStore()->numberColumns();
 
-            currentData->lock();
-            if (currentData->referenceCount() > 1) {
-                Data* oldDataStore = currentData;
+            dataStore()->lock();
+            if (dataStore()->referenceCount() > 1) {
+                Data* oldDataStore = dataStore();
 
                 if (static_cast<unsigned long>(row) > numberRows       ||
                     static_cast<unsigned long>(column) > numberColumns    ) {
                     unsigned long newNumberRows    = std::max(numberRows, static_cast<unsigned long>(row));
                     unsigned long newNumberColumns = std::max(numberColumns, static_cast<unsigned long>(column));
 
-                    currentData = currentData->resizeTo(newNumberRows, newNumberColumns, true);
+                    currentData = dataStore()->resizeTo(newNumberRows, newNumberColumns, true);
                 } else {
                     currentData = oldDataStore->clone();
                 }
@@ -1592,33 +1775,35 @@ namespace M {
                 oldDataStore->unlock();
                 releaseDataStore(oldDataStore);
 
-                currentData->at(row - 1, column - 1) = newValue;
+                dataStore()->at(row - 1, column - 1) = newValue;
             } else {
                 if (static_cast<unsigned long>(row) > numberRows       ||
                     static_cast<unsigned long>(column) > numberColumns    ) {
                     unsigned long newNumberRows    = std::max(numberRows, static_cast<unsigned long>(row));
                     unsigned long newNumberColumns = std::max(numberColumns, static_cast<unsigned long>(column));
 
-                   Data* newDataStore = currentData->resizeTo(newNumberRows, newNumberColumns);
-                    if (newDataStore != currentData) {
+                   Data* newDataStore = dataStore()->resizeTo(newNumberRows, newNumberColumns);
+                    if (newDataStore != dataStore()) {
                         assignNewDataStore(newDataStore, true);
-                        currentData->at(row - 1, column - 1) = newValue;
+                        dataStore()->at(row - 1, column - 1) = newValue;
                     } else {
-                        currentData->at(row - 1, column - 1) = newValue;
-                        currentData->unlock();
+                        dataStore()->at(row - 1, column - 1) = newValue;
+                        dataStore()->unlock();
                     }
                 } else {
-                    currentData->at(row - 1, column - 1) = newValue;
-                    currentData->unlock();
+                    dataStore()->at(row - 1, column - 1) = newValue;
+                    dataStore()->unlock();
                 }
             }
+
+            applyStoragePolicy(false);
         }
     }
 
 
     void MatrixComplex::update(Matrix::Index index, const Scalar& newValue) {
-        unsigned long      numberRows         = currentData->numberRows();
-        unsigned long      numberColumns      = currentData->numberColumns();
+        unsigned long      numberRows         = static_cast<unsigned long>(MatrixComplex::numberRows());
+        unsigned long      numberColumns      = static_cast<unsigned long>(MatrixComplex::numberColumns());
         unsigned long long numberCoefficients = numberRows * numberColumns;
 
         if (index < 1) {
@@ -1657,13 +1842,11 @@ namespace M {
         other.applyLazyTransformsAndScaling();
 
         Data* resultData;
-        if (other.currentData->matrixType() == Matrix::MatrixType::DENSE) {
-            resultData = currentData->combineLeftToRight(*POLYMORPHIC_CAST<const DenseData*>(other.currentData));
+        if (other.dataStore()->matrixType() == Matrix::MatrixType::DENSE) {
+            resultData = dataStore()->combineLeftToRight(*POLYMORPHIC_CAST<const DenseData*>(other.dataStore()));
         } else {
-            assert(other.currentData->matrixType() == Matrix::MatrixType::SPARSE);
-            assert(false); // FIXME
-            resultData = nullptr;
-//            resultData = currentData->combineLeftToRight(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            assert(other.dataStore()->matrixType() == Matrix::MatrixType::SPARSE);
+            resultData = dataStore()->combineLeftToRight(*POLYMORPHIC_CAST<const SparseData*>(other.dataStore()));
         }
 
         return MatrixComplex(resultData);
@@ -1675,13 +1858,11 @@ namespace M {
         other.applyLazyTransformsAndScaling();
 
         Data* resultData;
-        if (other.currentData->matrixType() == Matrix::MatrixType::DENSE) {
-            resultData = currentData->combineTopToBottom(*POLYMORPHIC_CAST<const DenseData*>(other.currentData));
+        if (other.dataStore()->matrixType() == Matrix::MatrixType::DENSE) {
+            resultData = dataStore()->combineTopToBottom(*POLYMORPHIC_CAST<const DenseData*>(other.dataStore()));
         } else {
-            assert(other.currentData->matrixType() == Matrix::MatrixType::SPARSE);
-            assert(false); // FIXME
-            resultData = nullptr;
-//            resultData = currentData->combineTopToBottom(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            assert(other.dataStore()->matrixType() == Matrix::MatrixType::SPARSE);
+            resultData = dataStore()->combineTopToBottom(*POLYMORPHIC_CAST<const SparseData*>(other.dataStore()));
         }
 
         return MatrixComplex(resultData);
@@ -1690,18 +1871,18 @@ namespace M {
 
     MatrixComplex MatrixComplex::columnReverse() const {
         applyLazyTransformsAndScaling();
-        return MatrixComplex(currentData->columnReverse());
+        return MatrixComplex(dataStore()->columnReverse());
     }
 
 
     MatrixComplex MatrixComplex::rowReverse() const {
         applyLazyTransformsAndScaling();
-        return MatrixComplex(currentData->rowReverse());
+        return MatrixComplex(dataStore()->rowReverse());
     }
 
 
     bool MatrixComplex::isSquare() const {
-        return currentData->numberRows() == currentData->numberColumns();
+        return numberRows() == numberColumns();
     }
 
 
@@ -1709,15 +1890,16 @@ namespace M {
         bool symmetric = true;
 
         if (isSquare()) {
-            unsigned long numberRowColumns = currentData->numberRows();
+            const Data*   sourceData       = dataStore();
+            unsigned long numberRowColumns = dataStore()->numberRows();
             unsigned long rowIndex         = 0;
 
             while (symmetric && rowIndex < numberRowColumns) {
                 unsigned long columnIndex = 0;
 
                 while (symmetric && columnIndex < numberRowColumns) {
-                    const Scalar& v1 = currentData->at(rowIndex, columnIndex);
-                    const Scalar& v2 = currentData->at(columnIndex, rowIndex);
+                    const Scalar& v1 = sourceData->at(rowIndex, columnIndex);
+                    const Scalar& v2 = sourceData->at(columnIndex, rowIndex);
 
                     if (v1 != v2) {
                         Real average = abs(v1 + v2) / 2.0;
@@ -1742,15 +1924,16 @@ namespace M {
         bool hermitian = true;
 
         if (isSquare()) {
-            unsigned long numberRowColumns = currentData->numberRows();
+            const Data*   sourceData       = dataStore();
+            unsigned long numberRowColumns = dataStore()->numberRows();
             unsigned long rowIndex         = 0;
 
             while (hermitian && rowIndex < numberRowColumns) {
                 unsigned long columnIndex = 0;
 
                 while (hermitian && columnIndex < numberRowColumns) {
-                    const Scalar& v1 = currentData->at(rowIndex, columnIndex);
-                    const Scalar& v2 = currentData->at(columnIndex, rowIndex).conj();
+                    const Scalar& v1 = sourceData->at(rowIndex, columnIndex);
+                    const Scalar& v2 = sourceData->at(columnIndex, rowIndex).conj();
 
                     if (v1 != v2) {
                         Real average = abs(v1 + v2) / 2.0;
@@ -1775,15 +1958,16 @@ namespace M {
         bool skewSymmetric = true;
 
         if (isSquare()) {
-            unsigned long numberRowColumns = currentData->numberRows();
+            const Data*   sourceData       = dataStore();
+            unsigned long numberRowColumns = dataStore()->numberRows();
             unsigned long rowIndex         = 0;
 
             while (skewSymmetric && rowIndex < numberRowColumns) {
                 unsigned long columnIndex = 0;
 
                 while (skewSymmetric && columnIndex < numberRowColumns) {
-                    const Scalar& v1 =  currentData->at(rowIndex, columnIndex);
-                    const Scalar& v2 = -currentData->at(columnIndex, rowIndex);
+                    const Scalar& v1 =  sourceData->at(rowIndex, columnIndex);
+                    const Scalar& v2 = -sourceData->at(columnIndex, rowIndex);
 
                     if (v1 != v2) {
                         Real average = abs(v1 + v2) / 2.0;
@@ -1808,15 +1992,16 @@ namespace M {
         bool skewHermitian = true;
 
         if (isSquare()) {
-            unsigned long numberRowColumns = currentData->numberRows();
+            const Data*   sourceData       = dataStore();
+            unsigned long numberRowColumns = dataStore()->numberRows();
             unsigned long rowIndex         = 0;
 
             while (skewHermitian && rowIndex < numberRowColumns) {
                 unsigned long columnIndex = 0;
 
                 while (skewHermitian && columnIndex < numberRowColumns) {
-                    const Scalar& v1 =  currentData->at(rowIndex, columnIndex);
-                    const Scalar& v2 = -currentData->at(columnIndex, rowIndex).conj();
+                    const Scalar& v1 =  sourceData->at(rowIndex, columnIndex);
+                    const Scalar& v2 = -sourceData->at(columnIndex, rowIndex).conj();
 
                     if (v1 != v2) {
                         Real average = abs(v1 + v2) / 2.0;
@@ -1886,12 +2071,12 @@ namespace M {
         Data* sData;
         Data* vData;
 
-        currentData->svd(uData, sData, vData);
+        dataStore()->svd(uData, sData, vData);
 
         Data::destroy(uData);
         Data::destroy(vData);
 
-        unsigned long diagnonalLength = std::min(currentData->numberRows(), currentData->numberColumns());
+        unsigned long diagnonalLength = std::min(dataStore()->numberRows(), dataStore()->numberColumns());
         Integer       result          = 0;
 
         for (unsigned index=0 ; index<diagnonalLength ; ++index) {
@@ -1908,8 +2093,21 @@ namespace M {
 
 
     MatrixComplex::Scalar MatrixComplex::determinant() const {
+        Scalar result;
+
         applyLazyTransformsAndScaling();
-        return currentData->determinant();
+
+        if (hasSmallStorage()) {
+            if (smallNumberRows != smallNumberColumns || smallNumberRows == 0) {
+                throw Model::InvalidMatrixDimensions(smallNumberRows, smallNumberColumns);
+            }
+
+            result = MatrixSmallPrivate<Scalar>::determinant(smallCoefficients, smallNumberRows, smallNumberRows);
+        } else {
+            result = dataStore()->determinant();
+        }
+
+        return result;
     }
 
 
@@ -2016,8 +2214,32 @@ namespace M {
 
 
     MatrixComplex MatrixComplex::inverse() const {
+        MatrixComplex result;
+
         applyLazyTransformsAndScaling();
-        return MatrixComplex(currentData->inverse());
+
+        if (hasSmallStorage()) {
+            if (smallNumberRows != smallNumberColumns || smallNumberRows == 0) {
+                throw Model::InvalidMatrixDimensions(smallNumberRows, smallNumberColumns);
+            }
+
+            result.configureSmallStorage(smallNumberRows, smallNumberColumns);
+            bool success = MatrixSmallPrivate<Scalar>::inverse(
+                smallCoefficients,
+                smallNumberRows,
+                smallNumberRows,
+                result.smallCoefficients,
+                smallNumberRows
+            );
+
+            if (!success) {
+                throw Model::MatrixIsSingular();
+            }
+        } else {
+            result = MatrixComplex(dataStore()->inverse());
+        }
+
+        return result;
     }
 
 
@@ -2030,7 +2252,7 @@ namespace M {
         Data* lData;
         Data* uData;
 
-        bool notSingular = currentData->plu(pData, lData, uData);
+        bool notSingular = dataStore()->plu(pData, lData, uData);
 
         result.append(MatrixComplex(pData));
         result.append(MatrixComplex(lData));
@@ -2050,7 +2272,7 @@ namespace M {
         Data* sData;
         Data* vData;
 
-        bool success = currentData->svd(uData, sData, vData);
+        bool success = dataStore()->svd(uData, sData, vData);
 
         result.append(MatrixComplex(uData));
         result.append(MatrixComplex(sData));
@@ -2069,7 +2291,7 @@ namespace M {
         Data* qData;
         Data* rData;
 
-        bool success = currentData->qr(qData, rData);
+        bool success = dataStore()->qr(qData, rData);
 
         result.append(MatrixComplex(qData));
         result.append(MatrixComplex(rData));
@@ -2089,7 +2311,7 @@ namespace M {
         {
             MatrixComplex ah = this->adjoint();
             ah.applyLazyTransformsAndScaling();
-            success = ah.currentData->qr(qData, rData);
+            success = ah.dataStore()->qr(qData, rData);
         }
 
         MatrixComplex l(rData);
@@ -2108,13 +2330,13 @@ namespace M {
 
     MatrixComplex MatrixComplex::cholesky() const {
         applyLazyTransformsAndScaling();
-        return MatrixComplex(currentData->cholesky());
+        return MatrixComplex(dataStore()->cholesky());
     }
 
 
     MatrixComplex MatrixComplex::upperCholesky() const {
         applyLazyTransformsAndScaling();
-        return MatrixComplex(currentData->upperCholesky());
+        return MatrixComplex(dataStore()->upperCholesky());
     }
 
 
@@ -2126,7 +2348,7 @@ namespace M {
         Data* qData;
         Data* hData;
 
-        currentData->hessenberg(qData, hData);
+        dataStore()->hessenberg(qData, hData);
 
         result.append(MatrixComplex(qData));
         result.append(MatrixComplex(hData));
@@ -2145,7 +2367,7 @@ namespace M {
         Data* wData;
         bool  success;
 
-        success = currentData->schur(qData, uData, wData);
+        success = dataStore()->schur(qData, uData, wData);
 
         result.append(MatrixComplex(qData));
         result.append(MatrixComplex(uData));
@@ -2163,24 +2385,24 @@ namespace M {
 
     MatrixComplex MatrixComplex::dft() const {
         applyLazyTransformsAndScaling();
-        return MatrixComplex(currentData->dft());
+        return MatrixComplex(dataStore()->dft());
     }
 
 
     MatrixComplex MatrixComplex::idft() const {
         applyLazyTransformsAndScaling();
-        return MatrixComplex(currentData->idft());
+        return MatrixComplex(dataStore()->idft());
     }
 
 
     Real MatrixComplex::conditionNumber() const {
         applyLazyTransformsAndScaling();
 
-        Data* inverse     = currentData->inverse();
+        Data* inverse     = dataStore()->inverse();
         Real  inverseNorm = inverse->pNorm(2.0);
         Data::destroy(inverse);
 
-        Real norm = currentData->pNorm(2.0);
+        Real norm = dataStore()->pNorm(2.0);
 
         return inverseNorm * norm;
     }
@@ -2188,7 +2410,7 @@ namespace M {
 
     Real MatrixComplex::pNorm(Integer p) const {
         applyLazyTransformsAndScaling();
-        return currentData->pNorm(p);
+        return dataStore()->pNorm(p);
     }
 
 
@@ -2199,13 +2421,13 @@ namespace M {
 
     Real MatrixComplex::oneNorm() const {
         applyLazyTransformsAndScaling();
-        return currentData->oneNorm();
+        return dataStore()->oneNorm();
     }
 
 
     Real MatrixComplex::infinityNorm() const {
         applyLazyTransformsAndScaling();
-        return currentData->infinityNorm();
+        return dataStore()->infinityNorm();
     }
 
 
@@ -2217,7 +2439,7 @@ namespace M {
         Data* row;
         Data* column;
 
-        bool  success = currentData->equilibrate(row, column);
+        bool  success = dataStore()->equilibrate(row, column);
 
         result.append(MatrixComplex(row));
         result.append(MatrixComplex(column));
@@ -2228,20 +2450,40 @@ namespace M {
 
 
     MatrixComplex MatrixComplex::solve(const MatrixComplex& y) const {
-        Data* result = nullptr;
+        MatrixComplex result;
 
         applyLazyTransformsAndScaling();
         y.applyLazyTransformsAndScaling();
 
-        if (y.currentData->matrixType() == MatrixType::DENSE) {
-            result = currentData->solve(POLYMORPHIC_CAST<const DenseData*>(y.currentData));
+        if (hasSmallStorage()                            &&
+            y.hasSmallStorage()                          &&
+            smallNumberRows == smallNumberColumns        &&
+            smallNumberRows > 0                          &&
+            y.smallNumberRows == smallNumberRows         &&
+            y.smallNumberColumns > 0                        ) {
+            result.configureSmallStorage(smallNumberRows, y.smallNumberColumns);
+            bool success = MatrixSmallPrivate<Scalar>::solve(
+                smallCoefficients,
+                smallNumberRows,
+                smallNumberRows,
+                y.smallCoefficients,
+                y.smallNumberRows,
+                y.smallNumberColumns,
+                result.smallCoefficients,
+                smallNumberRows
+            );
+
+            if (!success) {
+                result.configureSmallStorage(0, 0);
+            }
+        } else if (y.dataStore()->matrixType() == MatrixType::DENSE) {
+            result = MatrixComplex(dataStore()->solve(POLYMORPHIC_CAST<const DenseData*>(y.dataStore())));
         } else {
-            assert(y.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
-//            result = currentData->solve(POLYMORPHIC_CAST<const SparseData*>(y.currentData));
+            assert(y.dataStore()->matrixType() == MatrixType::SPARSE);
+            result = MatrixComplex(dataStore()->solve(POLYMORPHIC_CAST<const SparseData*>(y.dataStore())));
         }
 
-        return MatrixComplex(result);
+        return result;
     }
 
 
@@ -2251,12 +2493,11 @@ namespace M {
         applyLazyTransformsAndScaling();
         b.applyLazyTransformsAndScaling();
 
-        if (b.currentData->matrixType() == MatrixType::DENSE) {
-            result = currentData->leastSquares(POLYMORPHIC_CAST<const DenseData*>(b.currentData));
+        if (b.dataStore()->matrixType() == MatrixType::DENSE) {
+            result = dataStore()->leastSquares(POLYMORPHIC_CAST<const DenseData*>(b.dataStore()));
         } else {
-            assert(b.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
-//            result = currentData->leastSquares(POLYMORPHIC_CAST<const SparseData*>(b.currentData));
+            assert(b.dataStore()->matrixType() == MatrixType::SPARSE);
+            result = dataStore()->leastSquares(POLYMORPHIC_CAST<const SparseData*>(b.dataStore()));
         }
 
         return MatrixComplex(result);
@@ -2268,15 +2509,17 @@ namespace M {
         other.applyLazyTransformsAndScaling();
 
         Data* result = nullptr;
-        if (other.currentData->matrixType() == MatrixType::DENSE) {
-            result = currentData->hadamard(*POLYMORPHIC_CAST<const DenseData*>(other.currentData));
+        if (other.dataStore()->matrixType() == MatrixType::DENSE) {
+            result = dataStore()->hadamard(*POLYMORPHIC_CAST<const DenseData*>(other.dataStore()));
         } else {
-            assert(other.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
-//            result = currentData->hadamard(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            assert(other.dataStore()->matrixType() == MatrixType::SPARSE);
+            result = dataStore()->hadamard(*POLYMORPHIC_CAST<const SparseData*>(other.dataStore()));
         }
 
-        return MatrixComplex(result);
+        MatrixComplex matrixResult(result);
+        matrixResult.applyStoragePolicy(false);
+
+        return matrixResult;
     }
 
 
@@ -2284,36 +2527,180 @@ namespace M {
         applyLazyTransformsAndScaling();
 
         Data* result = nullptr;
-        if (other.currentData->matrixType() == MatrixType::DENSE) {
-            result = currentData->kronecker(
-                *POLYMORPHIC_CAST<const DenseData*>(other.currentData),
+        if (other.dataStore()->matrixType() == MatrixType::DENSE) {
+            result = dataStore()->kronecker(
+                *POLYMORPHIC_CAST<const DenseData*>(other.dataStore()),
                 other.pendingTransform,
                 other.pendingScalarValue
             );
         } else {
-            assert(other.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
-//            result = currentData->hadamard(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            assert(other.dataStore()->matrixType() == MatrixType::SPARSE);
+            result = dataStore()->kronecker(
+                *POLYMORPHIC_CAST<const SparseData*>(other.dataStore()),
+                other.pendingTransform,
+                other.pendingScalarValue
+            );
         }
 
         return MatrixComplex(result);
     }
 
 
+    MatrixComplex& MatrixComplex::multiplyAccumulate(
+            const MatrixComplex&         multiplier,
+            const MatrixComplex&         multiplicand,
+            const MatrixComplex::Scalar& accumulatorScalar
+        ) {
+        bool operandsAreDense = (
+               multiplier.matrixType() == MatrixType::DENSE
+            && multiplicand.matrixType() == MatrixType::DENSE
+        );
+
+        if (operandsAreDense                                &&
+            currentData != nullptr                          &&
+            canAccumulateInPlace(multiplier.dataStore())    &&
+            canAccumulateInPlace(multiplicand.dataStore())     ) {
+            if (multiplier.pendingTransform == LazyTransform::CONJUGATE) {
+                multiplier.applyLazyTransformsAndScaling();
+            }
+
+            if (multiplicand.pendingTransform == LazyTransform::CONJUGATE) {
+                multiplicand.applyLazyTransformsAndScaling();
+            }
+
+            ReferenceCounter::lockPair(multiplier.dataStore(), multiplicand.dataStore());
+
+            try {
+                POLYMORPHIC_CAST<DenseData*>(dataStore())->multiplyAccumulate(
+                    *POLYMORPHIC_CAST<const DenseData*>(multiplier.dataStore()),
+                    *POLYMORPHIC_CAST<const DenseData*>(multiplicand.dataStore()),
+                    multiplier.pendingTransform,
+                    multiplicand.pendingTransform,
+                    multiplier.pendingScalarValue * multiplicand.pendingScalarValue,
+                    accumulatorScalar * pendingScalarValue
+                );
+            } catch (...) {
+                multiplicand.dataStore()->unlock();
+                multiplier.dataStore()->unlock();
+                throw;
+            }
+
+            multiplicand.dataStore()->unlock();
+            multiplier.dataStore()->unlock();
+
+            pendingScalarValue = Complex(1, 0);
+        } else {
+            MatrixComplex result = multiplier * multiplicand;
+            result += (*this) * accumulatorScalar;
+            operator=(result);
+        }
+
+        return *this;
+    }
+
+
     MatrixComplex::MatrixType MatrixComplex::matrixType() const {
-        return currentData->matrixType();
+        return currentData == nullptr ? MatrixType::DENSE : currentData->matrixType();
     }
 
 
-    MatrixComplex::Scalar* MatrixComplex::data() {
+    void MatrixComplex::applyDensityThresholds() {
+        applyStoragePolicy();
+    }
+
+
+    unsigned long long MatrixComplex::numberStoredCoefficients() const {
+        unsigned long long result;
+
+        if (matrixType() == MatrixType::SPARSE) {
+            result = POLYMORPHIC_CAST<const SparseData*>(currentData)->numberNonZeros();
+        } else {
+            result = static_cast<unsigned long long>(numberRows()) * static_cast<unsigned long long>(numberColumns());
+        }
+
+        return result;
+    }
+
+
+    MatrixComplex MatrixComplex::toSparse() const {
+        applyLazyTransformsAndScaling();
+
+        Data* result;
+        if (dataStore()->matrixType() == MatrixType::SPARSE) {
+            result = dataStore()->clone();
+        } else {
+            result = SparseData::create(*POLYMORPHIC_CAST<const DenseData*>(dataStore()));
+        }
+
+        return MatrixComplex(result);
+    }
+
+
+    MatrixComplex MatrixComplex::toDense() const {
         applyLazyTransformsAndScaling();
-        return currentData->data();
+
+        Data* result;
+        if (dataStore()->matrixType() == MatrixType::SPARSE) {
+            result = POLYMORPHIC_CAST<const SparseData*>(dataStore())->toDense();
+        } else {
+            result = dataStore()->clone();
+        }
+
+        return MatrixComplex(result);
+    }
+
+
+    MatrixComplex::Scalar* MatrixComplex::data() {
+        convertToDenseDataStore();
+
+        dataStore()->lock();
+        if (dataStore()->referenceCount() > 1) {
+            Data* oldDataStore = dataStore();
+            currentData = oldDataStore->clone();
+
+            oldDataStore->unlock();
+            releaseDataStore(oldDataStore);
+        } else {
+            dataStore()->unlock();
+        }
+
+        return dataStore()->data();
     }
 
 
     const MatrixComplex::Scalar* MatrixComplex::data() const {
-        applyLazyTransformsAndScaling();
-        return currentData->data();
+        convertToDenseDataStore();
+        return dataStore()->data();
+    }
+
+
+    unsigned long long MatrixComplex::columnSpacingInMemory() const {
+        convertToDenseDataStore();
+        return POLYMORPHIC_CAST<const DenseData*>(dataStore())->columnSpacingInMemory();
+    }
+
+
+    MatrixComplex::Scalar* MatrixComplex::columnData(MatrixComplex::Index column) {
+        Scalar*       d             = data();
+        unsigned long numberColumns = dataStore()->numberColumns();
+
+        if (column < 1 || static_cast<unsigned long>(column) > numberColumns) {
+            throw Model::InvalidColumn(column, numberColumns);
+        }
+
+        return d + POLYMORPHIC_CAST<const DenseData*>(dataStore())->columnSpacingInMemory() * (column - 1);
+    }
+
+
+    const MatrixComplex::Scalar* MatrixComplex::columnData(MatrixComplex::Index column) const {
+        const Scalar* d             = data();
+        unsigned long numberColumns = dataStore()->numberColumns();
+
+        if (column < 1 || static_cast<unsigned long>(column) > numberColumns) {
+            throw Model::InvalidColumn(column, numberColumns);
+        }
+
+        return d + POLYMORPHIC_CAST<const DenseData*>(dataStore())->columnSpacingInMemory() * (column - 1);
     }
 
 
@@ -2327,7 +2714,7 @@ namespace M {
         bool              realTransposed  = false;
 
         if (pendingScalarValue.imag() != Complex::T(0)) {
-            realData = currentData->imag();
+            realData = dataStore()->imag();
 
             switch (pendingTransform) {
                 case LazyTransform::NONE: {
@@ -2364,7 +2751,7 @@ namespace M {
                 }
             }
         } else {
-            realData        = currentData->real();
+            realData        = dataStore()->real();
             realScalarValue = pendingScalarValue.real();
             realTransposed  = (
                    pendingTransform == LazyTransform::TRANSPOSE
@@ -2390,14 +2777,14 @@ namespace M {
         bool              imaginaryTransposed  = false;
 
         if (pendingScalarValue.imag() != Complex::T(0)) {
-            imaginaryData        = currentData->real();
+            imaginaryData        = dataStore()->real();
             imaginaryScalarValue = pendingScalarValue.imag();
             imaginaryTransposed  = (
                    pendingTransform == LazyTransform::TRANSPOSE
                 || pendingTransform == LazyTransform::ADJOINT
             );
         } else {
-            imaginaryData = currentData->imag();
+            imaginaryData = dataStore()->imag();
 
             switch (pendingTransform) {
                 case LazyTransform::NONE: {
@@ -2443,18 +2830,122 @@ namespace M {
     }
 
 
+    MatrixComplex MatrixComplex::exp() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->exp());
+    }
+
+
+    MatrixComplex MatrixComplex::ln() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->ln());
+    }
+
+
+    MatrixComplex MatrixComplex::sqrt() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->sqrt());
+    }
+
+
+    MatrixComplex MatrixComplex::sine() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->sine());
+    }
+
+
+    MatrixComplex MatrixComplex::cosine() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->cosine());
+    }
+
+
+    MatrixComplex MatrixComplex::tangent() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->tangent());
+    }
+
+
+    MatrixComplex MatrixComplex::arcsine() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->arcsine());
+    }
+
+
+    MatrixComplex MatrixComplex::arccosine() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->arccosine());
+    }
+
+
+    MatrixComplex MatrixComplex::arctangent() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->arctangent());
+    }
+
+
+    MatrixComplex MatrixComplex::hyperbolicSine() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->hyperbolicSine());
+    }
+
+
+    MatrixComplex MatrixComplex::hyperbolicCosine() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->hyperbolicCosine());
+    }
+
+
+    MatrixComplex MatrixComplex::hyperbolicTangent() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->hyperbolicTangent());
+    }
+
+
+    MatrixComplex MatrixComplex::gamma() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->gamma());
+    }
+
+
+    MatrixComplex MatrixComplex::pow(const Complex& exponent) const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->pow(exponent));
+    }
+
+
     MatrixComplex& MatrixComplex::operator=(const MatrixComplex& other) {
-        assignExistingDataStore(other.currentData, false);
+        if (this != &other) {
+            Data*      oldData   = currentData;
+            DenseData* oldParent = currentView.parent;
 
-        pendingTransform   = other.pendingTransform;
-        pendingScalarValue = other.pendingScalarValue;
+            copyStorage(other);
+
+            releaseDataStore(oldData);
+            releaseDataStore(oldParent);
+        }
+
+        return *this;
+    }
+
+
+    MatrixComplex& MatrixComplex::operator=(MatrixComplex&& other) noexcept {
+        if (this != &other) {
+            Data*      oldData   = currentData;
+            DenseData* oldParent = currentView.parent;
+
+            moveStorage(other);
+
+            releaseDataStore(oldData);
+            releaseDataStore(oldParent);
+        }
 
         return *this;
     }
 
 
     MatrixComplex& MatrixComplex::operator=(const MatrixReal& other) {
-        releaseDataStore(currentData);
+        releaseStorage();
         copyFrom(other);
 
         return *this;
@@ -2462,7 +2953,7 @@ namespace M {
 
 
     MatrixComplex& MatrixComplex::operator=(const MatrixInteger& other) {
-        releaseDataStore(currentData);
+        releaseStorage();
         copyFrom(other);
 
         return *this;
@@ -2470,7 +2961,7 @@ namespace M {
 
 
     MatrixComplex& MatrixComplex::operator=(const MatrixBoolean& other) {
-        releaseDataStore(currentData);
+        releaseStorage();
         copyFrom(other);
 
         return *this;
@@ -2482,10 +2973,7 @@ namespace M {
         MatrixComplex v = other.toMatrixComplex(&ok);
 
         if (ok) {
-            assignExistingDataStore(v.currentData, false);
-
-            pendingTransform   = v.pendingTransform;
-            pendingScalarValue = v.pendingScalarValue;
+            operator=(std::move(v));
         } else {
             throw Model::InvalidRuntimeConversion(other.valueType(), ValueType::MATRIX_COMPLEX);
         }
@@ -2495,76 +2983,187 @@ namespace M {
 
 
     MatrixComplex& MatrixComplex::operator+=(const MatrixComplex& v) {
-        currentData->lock();
-        v.currentData->lock();
+        if (canAddInline(v)) {
+            addSmallStorage(*this, v, false);
+            return *this;
+        }
+
+        bool addendIsDense     = v.dataStore()->matrixType() == MatrixType::DENSE;
+        bool addendIsSupported = (
+               addendIsDense
+            || (   pendingScalarValue == Complex(1, 0)
+                && (v.pendingTransform == LazyTransform::NONE || v.pendingTransform == LazyTransform::TRANSPOSE))
+        );
+
+        if (addendIsSupported && canAccumulateInPlace(v.dataStore())) {
+            ReferenceCounter::lockPair(dataStore(), v.dataStore());
+
+            try {
+                DenseData* augend = POLYMORPHIC_CAST<DenseData*>(dataStore());
+                if (addendIsDense) {
+                    augend->scaleAccumulate(
+                        *POLYMORPHIC_CAST<const DenseData*>(v.dataStore()),
+                        v.pendingTransform,
+                        pendingScalarValue,
+                        v.pendingScalarValue
+                    );
+                } else {
+                    augend->scaleAccumulate(
+                        *POLYMORPHIC_CAST<const SparseData*>(v.dataStore()),
+                        v.pendingTransform,
+                        pendingScalarValue,
+                        v.pendingScalarValue
+                    );
+                }
+            } catch (...) {
+                v.dataStore()->unlock();
+                dataStore()->unlock();
+                throw;
+            }
+
+            v.dataStore()->unlock();
+            dataStore()->unlock();
+
+            pendingScalarValue = Complex(1, 0);
+            applyStoragePolicy(false);
+
+            return *this;
+        }
+
+        ReferenceCounter::lockPair(dataStore(), v.dataStore());
 
         Data* newDataStore = nullptr;
-        if (v.currentData->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->add(
-                *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
-                pendingTransform,
-                v.pendingTransform,
-                pendingScalarValue,
-                v.pendingScalarValue
-            );
-        } else {
-            assert(v.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false);
-//            newDataStore = currentData->add(
-//                *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
-//                pendingTransform,
-//                v.pendingTransform,
-//                pendingScalarValue,
-//                v.pendingScalarValue
-//            );
-        }
-
-        v.currentData->unlock();
+        try {
+            if (v.dataStore()->matrixType() == MatrixType::DENSE) {
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const DenseData*>(v.dataStore()),
+                    pendingTransform,
+                    v.pendingTransform,
+                    pendingScalarValue,
+                    v.pendingScalarValue
+                );
+            } else {
+                assert(v.dataStore()->matrixType() == MatrixType::SPARSE);
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const SparseData*>(v.dataStore()),
+                    pendingTransform,
+                    v.pendingTransform,
+                    pendingScalarValue,
+                    v.pendingScalarValue
+                );
+            }
+        } catch (...) {
+            v.dataStore()->unlock();
+            dataStore()->unlock();
+            throw;
+        }
+
+        v.dataStore()->unlock();
         assignNewDataStore(newDataStore, true);
 
         pendingTransform = LazyTransform::NONE;
         pendingScalarValue = Complex(1, 0);
 
+        applyStoragePolicy(false);
+
         return *this;
     }
 
 
     MatrixComplex& MatrixComplex::operator-=(const MatrixComplex& v) {
-        currentData->lock();
-        v.currentData->lock();
+        if (canAddInline(v)) {
+            addSmallStorage(*this, v, true);
+            return *this;
+        }
+
+        bool addendIsDense     = v.dataStore()->matrixType() == MatrixType::DENSE;
+        bool addendIsSupported = (
+               addendIsDense
+            || (   pendingScalarValue == Complex(1, 0)
+                && (v.pendingTransform == LazyTransform::NONE || v.pendingTransform == LazyTransform::TRANSPOSE))
+        );
+
+        if (addendIsSupported && canAccumulateInPlace(v.dataStore())) {
+            ReferenceCounter::lockPair(dataStore(), v.dataStore());
+
+            try {
+                DenseData* augend = POLYMORPHIC_CAST<DenseData*>(dataStore());
+                if (addendIsDense) {
+                    augend->scaleAccumulate(
+                        *POLYMORPHIC_CAST<const DenseData*>(v.dataStore()),
+                        v.pendingTransform,
+                        pendingScalarValue,
+                        -v.pendingScalarValue
+                    );
+                } else {
+                    augend->scaleAccumulate(
+                        *POLYMORPHIC_CAST<const SparseData*>(v.dataStore()),
+                        v.pendingTransform,
+                        pendingScalarValue,
+                        -v.pendingScalarValue
+                    );
+                }
+            } catch (...) {
+                v.dataStore()->unlock();
+                dataStore()->unlock();
+                throw;
+            }
+
+            v.dataStore()->unlock();
+            dataStore()->unlock();
+
+            pendingScalarValue = Complex(1, 0);
+            applyStoragePolicy(false);
+
+            return *this;
+        }
+
+        ReferenceCounter::lockPair(dataStore(), v.dataStore());
 
         Data* newDataStore = nullptr;
-        if (v.currentData->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->add(
-                *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
-                pendingTransform,
-                v.pendingTransform,
-                pendingScalarValue,
-                -v.pendingScalarValue
-            );
-        } else {
-            assert(v.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false);
-//            newDataStore = currentData->add(
-//                *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
-//                pendingTransform,
-//                v.pendingTransform,
-//                pendingScalarValue,
-//                -v.pendingScalarValue
-//            );
-        }
-
-        v.currentData->unlock();
+        try {
+            if (v.dataStore()->matrixType() == MatrixType::DENSE) {
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const DenseData*>(v.dataStore()),
+                    pendingTransform,
+                    v.pendingTransform,
+                    pendingScalarValue,
+                    -v.pendingScalarValue
+                );
+            } else {
+                assert(v.dataStore()->matrixType() == MatrixType::SPARSE);
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const SparseData*>(v.dataStore()),
+                    pendingTransform,
+                    v.pendingTransform,
+                    pendingScalarValue,
+                    -v.pendingScalarValue
+                );
+            }
+        } catch (...) {
+            v.dataStore()->unlock();
+            dataStore()->unlock();
+            throw;
+        }
+
+        v.dataStore()->unlock();
         assignNewDataStore(newDataStore, true);
 
         pendingTransform = LazyTransform::NONE;
         pendingScalarValue = Complex(1, 0);
 
+        applyStoragePolicy(false);
+
         return *this;
     }
 
 
     MatrixComplex& MatrixComplex::operator*=(const MatrixComplex& v) {
+        if (canMultiplyInline(v)) {
+            multiplySmallStorage(*this, v);
+            return *this;
+        }
+
         Data* newDataStore;
 
         if (pendingTransform == LazyTransform::CONJUGATE) {
@@ -2576,28 +3175,33 @@ namespace M {
         }
 
         Complex scalarMultiplier = pendingScalarValue * v.pendingScalarValue;
-        Data*   multiplicand     = v.currentData;
-
-        currentData->lock();
-
-        multiplicand->lock();
-        if (multiplicand->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->multiply(
-                static_cast<const DenseData&>(*multiplicand),
-                pendingTransform,
-                v.pendingTransform,
-                scalarMultiplier
-            );
-        } else {
-            assert(multiplicand->matrixType() == MatrixType::SPARSE);
-
-            newDataStore = currentData->multiply(
-                static_cast<const SparseData&>(*multiplicand),
-                pendingTransform,
-                v.pendingTransform,
-                scalarMultiplier
-            );
+        Data*   multiplicand     = v.dataStore();
+
+        ReferenceCounter::lockPair(dataStore(), multiplicand);
+        try {
+            if (multiplicand->matrixType() == MatrixType::DENSE) {
+                newDataStore = dataStore()->multiply(
+                    static_cast<const DenseData&>(*multiplicand),
+                    pendingTransform,
+                    v.pendingTransform,
+                    scalarMultiplier
+                );
+            } else {
+                assert(multiplicand->matrixType() == MatrixType::SPARSE);
+
+                newDataStore = dataStore()->multiply(
+                    static_cast<const SparseData&>(*multiplicand),
+                    pendingTransform,
+                    v.pendingTransform,
+                    scalarMultiplier
+                );
+            }
+        } catch (...) {
+            multiplicand->unlock();
+            dataStore()->unlock();
+            throw;
         }
+
         multiplicand->unlock();
         assignNewDataStore(newDataStore, true);
 
@@ -2650,35 +3254,55 @@ namespace M {
     }
 
 
-    MatrixComplex MatrixComplex::operator+(const MatrixComplex& v) const {
-        currentData->lock();
-        v.currentData->lock();
+    MatrixComplex MatrixComplex::operator+(const MatrixComplex& v) const & {
+        if (canAddInline(v)) {
+            MatrixComplex result;
+            result.addSmallStorage(*this, v, false);
+
+            return result;
+        }
+
+        ReferenceCounter::lockPair(dataStore(), v.dataStore());
 
         Data* newDataStore = nullptr;
-        if (v.currentData->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->add(
-                *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
-                pendingTransform,
-                v.pendingTransform,
-                pendingScalarValue,
-                v.pendingScalarValue
-            );
-        } else {
-            assert(v.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
-//            newDataStore = currentData->add(
-//                *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
-//                pendingTransform,
-//                v.pendingTransform,
-//                pendingScalarValue,
-//                v.pendingScalarValue
-//            );
+        try {
+            if (v.dataStore()->matrixType() == MatrixType::DENSE) {
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const DenseData*>(v.dataStore()),
+                    pendingTransform,
+                    v.pendingTransform,
+                    pendingScalarValue,
+                    v.pendingScalarValue
+                );
+            } else {
+                assert(v.dataStore()->matrixType() == MatrixType::SPARSE);
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const SparseData*>(v.dataStore()),
+                    pendingTransform,
+                    v.pendingTransform,
+                    pendingScalarValue,
+                    v.pendingScalarValue
+                );
+            }
+        } catch (...) {
+            v.dataStore()->unlock();
+            dataStore()->unlock();
+            throw;
         }
 
-        v.currentData->unlock();
-        currentData->unlock();
+        v.dataStore()->unlock();
+        dataStore()->unlock();
+
+        MatrixComplex result(newDataStore);
+        result.applyStoragePolicy(false);
+
+        return result;
+    }
 
-        return MatrixComplex(newDataStore);
+
+    MatrixComplex MatrixComplex::operator+(const MatrixComplex& v) && {
+        operator+=(v);
+        return std::move(*this);
     }
 
 
@@ -2697,35 +3321,55 @@ namespace M {
     }
 
 
-    MatrixComplex MatrixComplex::operator-(const MatrixComplex& v) const {
-        currentData->lock();
-        v.currentData->lock();
+    MatrixComplex MatrixComplex::operator-(const MatrixComplex& v) const & {
+        if (canAddInline(v)) {
+            MatrixComplex result;
+            result.addSmallStorage(*this, v, true);
+
+            return result;
+        }
+
+        ReferenceCounter::lockPair(dataStore(), v.dataStore());
 
         Data* newDataStore = nullptr;
-        if (v.currentData->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->add(
-                *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
-                pendingTransform,
-                v.pendingTransform,
-                pendingScalarValue,
-                -v.pendingScalarValue
-            );
-        } else {
-            assert(v.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false);
-//            newDataStore = currentData->add(
-//                *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
-//                pendingTransform,
-//                v.pendingTransform,
-//                pendingScalarValue,
-//                -v.pendingScalarValue
-//            );
+        try {
+            if (v.dataStore()->matrixType() == MatrixType::DENSE) {
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const DenseData*>(v.dataStore()),
+                    pendingTransform,
+                    v.pendingTransform,
+                    pendingScalarValue,
+                    -v.pendingScalarValue
+                );
+            } else {
+                assert(v.dataStore()->matrixType() == MatrixType::SPARSE);
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const SparseData*>(v.dataStore()),
+                    pendingTransform,
+                    v.pendingTransform,
+                    pendingScalarValue,
+                    -v.pendingScalarValue
+                );
+            }
+        } catch (...) {
+            v.dataStore()->unlock();
+            dataStore()->unlock();
+            throw;
         }
 
-        v.currentData->unlock();
-        currentData->unlock();
+        v.dataStore()->unlock();
+        dataStore()->unlock();
+
+        MatrixComplex result(newDataStore);
+        result.applyStoragePolicy(false);
+
+        return result;
+    }
+
 
-        return MatrixComplex(newDataStore);
+    MatrixComplex MatrixComplex::operator-(const MatrixComplex& v) && {
+        operator-=(v);
+        return std::move(*this);
     }
 
 
@@ -2745,6 +3389,13 @@ namespace M {
 
 
     MatrixComplex MatrixComplex::operator*(const MatrixComplex& v) const {
+        if (canMultiplyInline(v)) {
+            MatrixComplex result;
+            result.multiplySmallStorage(*this, v);
+
+            return result;
+        }
+
         Data* result;
 
         if (pendingTransform == LazyTransform::CONJUGATE) {
@@ -2756,11 +3407,11 @@ namespace M {
         }
 
         Complex scalarMultiplier = pendingScalarValue * v.pendingScalarValue;
-        Data*   multiplicand     = v.currentData;
+        Data*   multiplicand     = v.dataStore();
 
         if (multiplicand->matrixType() == MatrixType::DENSE) {
             Complex scalarMultiplier = pendingScalarValue * v.pendingScalarValue;
-            result = currentData->multiply(
+            result = dataStore()->multiply(
                 static_cast<const DenseData&>(*multiplicand),
                 pendingTransform,
                 v.pendingTransform,
@@ -2769,7 +3420,7 @@ namespace M {
         } else {
             assert(multiplicand->matrixType() == MatrixType::SPARSE);
 
-            result = currentData->multiply(
+            result = dataStore()->multiply(
                 static_cast<const SparseData&>(*multiplicand),
                 pendingTransform,
                 v.pendingTransform,
@@ -2850,20 +3501,38 @@ namespace M {
     bool MatrixComplex::operator==(const MatrixComplex& other) const {
         bool result;
 
-        if (other.currentData->matrixType() == Matrix::MatrixType::DENSE) {
+        if (hasSmallStorage() && other.hasSmallStorage()) {
+            applyLazyTransformsAndScaling();
+            other.applyLazyTransformsAndScaling();
+
+            result = (
+                   smallNumberRows == other.smallNumberRows
+                && smallNumberColumns == other.smallNumberColumns
+                && std::equal(
+                       smallCoefficients,
+                       smallCoefficients + smallNumberRows * smallNumberColumns,
+                       other.smallCoefficients
+                   )
+            );
+        } else if (other.matrixType() == Matrix::MatrixType::DENSE) {
             applyLazyTransformsAndScaling();
             other.applyLazyTransformsAndScaling();
 
-            if (currentData == other.currentData) {
+            if (dataStore() == other.dataStore()) {
                 result = true;
             } else {
-                result = currentData->isEqualTo(*POLYMORPHIC_CAST<const DenseData*>(other.currentData));
+                result = dataStore()->isEqualTo(*POLYMORPHIC_CAST<const DenseData*>(other.dataStore()));
             }
         } else {
-            assert(other.currentData->matrixType() == Matrix::MatrixType::SPARSE);
-            assert(false); // FIXME
-            result = false;
-//            result = currentData->isEqualTo(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            assert(other.dataStore()->matrixType() == Matrix::MatrixType::SPARSE);
+            applyLazyTransformsAndScaling();
+            other.applyLazyTransformsAndScaling();
+
+            if (dataStore() == other.dataStore()) {
+                result = true;
+            } else {
+                result = dataStore()->isEqualTo(*POLYMORPHIC_CAST<const SparseData*>(other.dataStore()));
+            }
         }
 
         return result;
@@ -2873,7 +3542,7 @@ namespace M {
     int MatrixComplex::relativeOrder(const MatrixComplex& other) const {
         int result;
 
-        if (currentData == other.currentData) {
+        if (dataStore() == other.dataStore()) {
             if (pendingTransform == other.pendingTransform) {
                 if (pendingScalarValue.real() < other.pendingScalarValue.real()) {
                     result = -1;
@@ -2895,7 +3564,7 @@ namespace M {
             applyLazyTransformsAndScaling();
             other.applyLazyTransformsAndScaling();
 
-            result = currentData->relativeOrder(*other.currentData);
+            result = dataStore()->relativeOrder(*other.dataStore());
         }
 
         return result;
@@ -2906,6 +3575,7 @@ namespace M {
             Data* dataStore
         ):currentData(
             dataStore
+        ),currentView(
         ),pendingTransform(
             LazyTransform::NONE
         ),pendingScalarValue(
@@ -2914,13 +3584,15 @@ namespace M {
 
 
     void MatrixComplex::copyFrom(const MatrixBoolean& booleanMatrix) {
+        currentView.parent = nullptr;
+
         MatrixBoolean::Data* otherData = booleanMatrix.currentData;
 
         if (otherData->matrixType() == MatrixType::DENSE) {
             currentData = DenseData::create(*POLYMORPHIC_CAST<MatrixBoolean::DenseData*>(otherData));
         } else {
             assert(otherData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            currentData = SparseData::create(*POLYMORPHIC_CAST<MatrixBoolean::SparseData*>(otherData));
         }
 
         pendingTransform   = booleanMatrix.pendingTranspose ? LazyTransform::TRANSPOSE : LazyTransform::NONE;
@@ -2929,6 +3601,8 @@ namespace M {
 
 
     void MatrixComplex::copyFrom(const MatrixInteger& integerMatrix) {
+        currentView.parent = nullptr;
+
         if (integerMatrix.currentData->matrixType() == MatrixType::DENSE) {
             const MatrixInteger::DenseData*
                 data = POLYMORPHIC_CAST<const MatrixInteger::DenseData*>(integerMatrix.currentData);
@@ -2938,32 +3612,318 @@ namespace M {
             pendingScalarValue = Complex(integerMatrix.pendingScalarMultiplierValue);
         } else {
             assert(integerMatrix.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            const MatrixInteger::SparseData*
+                data = POLYMORPHIC_CAST<const MatrixInteger::SparseData*>(integerMatrix.currentData);
+
+            currentData        = SparseData::create(*data);
+            pendingTransform   = integerMatrix.pendingTranspose ? LazyTransform::TRANSPOSE : LazyTransform::NONE;
+            pendingScalarValue = Complex(integerMatrix.pendingScalarMultiplierValue);
         }
     }
 
 
     void MatrixComplex::copyFrom(const MatrixReal& realMatrix) {
-        if (realMatrix.currentData->matrixType() == MatrixType::DENSE) {
-            const MatrixReal::DenseData* data = POLYMORPHIC_CAST<const MatrixReal::DenseData*>(realMatrix.currentData);
+        currentView.parent = nullptr;
+
+        if (realMatrix.dataStore()->matrixType() == MatrixType::DENSE) {
+            const MatrixReal::DenseData* data = POLYMORPHIC_CAST<const MatrixReal::DenseData*>(realMatrix.dataStore());
             currentData = DenseData::create(*data);
 
             pendingTransform   = realMatrix.pendingTranspose ? LazyTransform::TRANSPOSE : LazyTransform::NONE;
             pendingScalarValue = realMatrix.pendingScalarValue;
         } else {
-            assert(realMatrix.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            assert(realMatrix.dataStore()->matrixType() == MatrixType::SPARSE);
+            const MatrixReal::SparseData*
+                data = POLYMORPHIC_CAST<const MatrixReal::SparseData*>(realMatrix.dataStore());
+
+            currentData = SparseData::create(*data);
+
+            pendingTransform   = realMatrix.pendingTranspose ? LazyTransform::TRANSPOSE : LazyTransform::NONE;
+            pendingScalarValue = realMatrix.pendingScalarValue;
         }
     }
 
 
     void MatrixComplex::releaseDataStore(MatrixComplex::Data* dataStore) const {
-        if (dataStore->removeReference()) {
+        if (dataStore != nullptr && dataStore->removeReference()) {
             Data::destroy(dataStore);
         }
     }
 
 
+    void MatrixComplex::materializeDataStore() const {
+        if (currentView.parent != nullptr) {
+            currentData = currentView.parent->copySubmatrix<DenseData>(
+                currentView.firstRow,
+                currentView.rowStride,
+                currentView.numberRows,
+                currentView.firstColumn,
+                currentView.columnStride,
+                currentView.numberColumns
+            );
+
+            releaseDataStore(currentView.parent);
+            currentView.parent = nullptr;
+        } else {
+            currentData = DenseData::create(smallNumberRows, smallNumberColumns, smallCoefficients);
+        }
+    }
+
+
+    void MatrixComplex::copyStorage(const MatrixComplex& other) {
+        if (other.currentData != nullptr) {
+            other.currentData->addReference();
+            currentData        = other.currentData;
+            currentView.parent = nullptr;
+        } else if (other.currentView.parent != nullptr) {
+            other.currentView.parent->addReference();
+            currentData = nullptr;
+            currentView = other.currentView;
+        } else {
+            copySmallStorage(other);
+        }
+
+        pendingTransform   = other.pendingTransform;
+        pendingScalarValue = other.pendingScalarValue;
+    }
+
+
+    void MatrixComplex::moveStorage(MatrixComplex& other) noexcept {
+        if (other.hasSmallStorage()) {
+            copySmallStorage(other);
+        } else {
+            currentData = other.currentData;
+            currentView = other.currentView;
+        }
+
+        pendingTransform   = other.pendingTransform;
+        pendingScalarValue = other.pendingScalarValue;
+
+        other.configureSmallStorage(0, 0);
+    }
+
+
+    void MatrixComplex::releaseStorage() const {
+        releaseDataStore(currentData);
+        releaseDataStore(currentView.parent);
+    }
+
+
+    const MatrixComplex::Scalar& MatrixComplex::storedCoefficient(
+            unsigned long rowIndex,
+            unsigned long columnIndex
+        ) const {
+        const Scalar* result;
+
+        if (currentData != nullptr) {
+            result = &static_cast<const Data*>(currentData)->at(rowIndex, columnIndex);
+        } else if (currentView.parent != nullptr) {
+            result = &static_cast<const DenseData*>(currentView.parent)->at(
+                stridedIndex(currentView.firstRow, currentView.rowStride, rowIndex),
+                stridedIndex(currentView.firstColumn, currentView.columnStride, columnIndex)
+            );
+        } else {
+            result = smallCoefficients + columnIndex * smallNumberRows + rowIndex;
+        }
+
+        return *result;
+    }
+
+
+    MatrixComplex MatrixComplex::submatrix(
+            unsigned long firstRow,
+            long long     rowStride,
+            unsigned long rowCount,
+            unsigned long firstColumn,
+            long long     columnStride,
+            unsigned long columnCount
+        ) const {
+        MatrixComplex result;
+
+        if (MatrixSmallPrivate<Scalar>::isSmall(rowCount, columnCount)) {
+            result.configureSmallStorage(rowCount, columnCount);
+
+            for (unsigned long columnIndex=0 ; columnIndex<columnCount ; ++columnIndex) {
+                unsigned long sourceColumnIndex = stridedIndex(firstColumn, columnStride, columnIndex);
+
+                for (unsigned long rowIndex=0 ; rowIndex<rowCount ; ++rowIndex) {
+                    result.smallCoefficients[columnIndex * rowCount + rowIndex] = storedCoefficient(
+                        stridedIndex(firstRow, rowStride, rowIndex),
+                        sourceColumnIndex
+                    );
+                }
+            }
+        } else {
+            SubmatrixView view;
+
+            if (currentData == nullptr) {
+                view.parent       = currentView.parent;
+                view.firstRow     = stridedIndex(currentView.firstRow, currentView.rowStride, firstRow);
+                view.rowStride    = currentView.rowStride * rowStride;
+                view.firstColumn  = stridedIndex(currentView.firstColumn, currentView.columnStride, firstColumn);
+                view.columnStride = currentView.columnStride * columnStride;
+            } else {
+                view.parent       = POLYMORPHIC_CAST<DenseData*>(currentData);
+                view.firstRow     = firstRow;
+                view.rowStride    = rowStride;
+                view.firstColumn  = firstColumn;
+                view.columnStride = columnStride;
+            }
+
+            view.numberRows    = rowCount;
+            view.numberColumns = columnCount;
+
+            view.parent->addReference();
+            result.releaseStorage();
+
+            result.currentData = nullptr;
+            result.currentView = view;
+        }
+
+        return result;
+    }
+
+
+    void MatrixComplex::configureSmallStorage(unsigned long newNumberRows, unsigned long newNumberColumns) const {
+        assert(MatrixSmallPrivate<Scalar>::isSmall(newNumberRows, newNumberColumns));
+
+        currentData        = nullptr;
+        currentView.parent = nullptr;
+        pendingTransform   = LazyTransform::NONE;
+        pendingScalarValue = Complex(1, 0);
+        smallNumberRows    = static_cast<unsigned char>(newNumberRows);
+        smallNumberColumns = static_cast<unsigned char>(newNumberColumns);
+    }
+
+
+    void MatrixComplex::copySmallStorage(const MatrixComplex& other) {
+        unsigned long numberCoefficients = static_cast<unsigned long>(other.smallNumberRows) * other.smallNumberColumns;
+
+        currentData        = nullptr;
+        currentView.parent = nullptr;
+        smallNumberRows    = other.smallNumberRows;
+        smallNumberColumns = other.smallNumberColumns;
+
+        std::copy(other.smallCoefficients, other.smallCoefficients + numberCoefficients, smallCoefficients);
+    }
+
+
+    void MatrixComplex::resizeSmallStorage(unsigned long newNumberRows, unsigned long newNumberColumns) {
+        Scalar        oldCoefficients[smallMatrixMaximumDimension * smallMatrixMaximumDimension];
+        unsigned long oldNumberRows    = smallNumberRows;
+        unsigned long oldNumberColumns = smallNumberColumns;
+        unsigned long keptRows         = std::min(oldNumberRows, newNumberRows);
+        unsigned long keptColumns      = std::min(oldNumberColumns, newNumberColumns);
+
+        std::copy(smallCoefficients, smallCoefficients + oldNumberRows * oldNumberColumns, oldCoefficients);
+        std::fill(smallCoefficients, smallCoefficients + newNumberRows * newNumberColumns, Scalar(0));
+
+        for (unsigned long columnIndex=0 ; columnIndex<keptColumns ; ++columnIndex) {
+            for (unsigned long rowIndex=0 ; rowIndex<keptRows ; ++rowIndex) {
+                smallCoefficients[columnIndex * newNumberRows + rowIndex] = (
+                    oldCoefficients[columnIndex * oldNumberRows + rowIndex]
+                );
+            }
+        }
+
+        smallNumberRows    = static_cast<unsigned char>(newNumberRows);
+        smallNumberColumns = static_cast<unsigned char>(newNumberColumns);
+    }
+
+
+    bool MatrixComplex::canAddInline(const MatrixComplex& other) const {
+        return (
+               hasSmallStorage()
+            && other.hasSmallStorage()
+            && numberRows() == other.numberRows()
+            && numberColumns() == other.numberColumns()
+        );
+    }
+
+
+    bool MatrixComplex::canMultiplyInline(const MatrixComplex& other) const {
+        return (
+               hasSmallStorage()
+            && other.hasSmallStorage()
+            && numberColumns() == other.numberRows()
+            && numberRows() > 0
+            && numberColumns() > 0
+            && other.numberColumns() > 0
+        );
+    }
+
+
+    void MatrixComplex::addSmallStorage(const MatrixComplex& augend, const MatrixComplex& addend, bool subtract) {
+        if (augend.pendingTransform != LazyTransform::NONE && augend.pendingTransform != LazyTransform::TRANSPOSE) {
+            augend.applyLazyTransformsAndScaling();
+        }
+
+        if (addend.pendingTransform != LazyTransform::NONE && addend.pendingTransform != LazyTransform::TRANSPOSE) {
+            addend.applyLazyTransformsAndScaling();
+        }
+
+        unsigned long numberRows    = static_cast<unsigned long>(augend.numberRows());
+        unsigned long numberColumns = static_cast<unsigned long>(augend.numberColumns());
+        Scalar        sum[smallMatrixMaximumDimension * smallMatrixMaximumDimension];
+
+        MatrixSmallPrivate<Scalar>::scaleAdd(
+            numberRows,
+            numberColumns,
+            augend.pendingScalarValue,
+            augend.smallCoefficients,
+            augend.smallNumberRows,
+            augend.pendingTransform == LazyTransform::TRANSPOSE,
+            subtract ? -addend.pendingScalarValue : addend.pendingScalarValue,
+            addend.smallCoefficients,
+            addend.smallNumberRows,
+            addend.pendingTransform == LazyTransform::TRANSPOSE,
+            sum,
+            numberRows
+        );
+
+        releaseStorage();
+        configureSmallStorage(numberRows, numberColumns);
+        std::copy(sum, sum + numberRows * numberColumns, smallCoefficients);
+    }
+
+
+    void MatrixComplex::multiplySmallStorage(const MatrixComplex& multiplier, const MatrixComplex& multiplicand) {
+        if (multiplier.pendingTransform != LazyTransform::NONE      &&
+            multiplier.pendingTransform != LazyTransform::TRANSPOSE    ) {
+            multiplier.applyLazyTransformsAndScaling();
+        }
+
+        if (multiplicand.pendingTransform != LazyTransform::NONE      &&
+            multiplicand.pendingTransform != LazyTransform::TRANSPOSE    ) {
+            multiplicand.applyLazyTransformsAndScaling();
+        }
+
+        unsigned long numberRows     = static_cast<unsigned long>(multiplier.numberRows());
+        unsigned long innerDimension = static_cast<unsigned long>(multiplier.numberColumns());
+        unsigned long numberColumns  = static_cast<unsigned long>(multiplicand.numberColumns());
+        Scalar        product[smallMatrixMaximumDimension * smallMatrixMaximumDimension];
+
+        MatrixSmallPrivate<Scalar>::multiply(
+            numberRows,
+            innerDimension,
+            numberColumns,
+            multiplier.pendingScalarValue * multiplicand.pendingScalarValue,
+            multiplier.smallCoefficients,
+            multiplier.smallNumberRows,
+            multiplier.pendingTransform == LazyTransform::TRANSPOSE,
+            multiplicand.smallCoefficients,
+            multiplicand.smallNumberRows,
+            multiplicand.pendingTransform == LazyTransform::TRANSPOSE,
+            product,
+            numberRows
+        );
+
+        releaseStorage();
+        configureSmallStorage(numberRows, numberColumns);
+        std::copy(product, product + numberRows * numberColumns, smallCoefficients);
+    }
+
+
     void MatrixComplex::assignNewDataStore(MatrixComplex::Data* newDataStore, bool unlock) const {
         Data* oldData = currentData;
         currentData = newDataStore;
@@ -2982,11 +3942,77 @@ namespace M {
     }
 
 
+    bool MatrixComplex::canAccumulateInPlace(const MatrixComplex::Data* operand) const {
+        return (
+               pendingTransform == LazyTransform::NONE
+            && operand != dataStore()
+            && dataStore()->matrixType() == MatrixType::DENSE
+            && dataStore()->referenceCount() == 1
+        );
+    }
+
+
     void MatrixComplex::applyLazyTransformsAndScaling() const {
-        if (pendingScalarValue != Complex(1, 0) || pendingTransform != LazyTransform::NONE) {
-            currentData->lock();
-            Data* newDataStore = currentData->applyTransformAndScaling(pendingTransform, pendingScalarValue);
-            assignNewDataStore(newDataStore, true);
+        if (hasSmallStorage()) {
+            if (pendingScalarValue != Complex(1, 0) || pendingTransform != LazyTransform::NONE) {
+                unsigned long numberRows    = static_cast<unsigned long>(MatrixComplex::numberRows());
+                unsigned long numberColumns = static_cast<unsigned long>(MatrixComplex::numberColumns());
+                Scalar        scalarValue   = pendingScalarValue;
+                bool          transpose     = (
+                       pendingTransform == LazyTransform::TRANSPOSE
+                    || pendingTransform == LazyTransform::ADJOINT
+                );
+                bool          conjugate     = (
+                       pendingTransform == LazyTransform::CONJUGATE
+                    || pendingTransform == LazyTransform::ADJOINT
+                );
+                Scalar        result[smallMatrixMaximumDimension * smallMatrixMaximumDimension];
+
+                MatrixSmallPrivate<Scalar>::scaleCopy(
+                    numberRows,
+                    numberColumns,
+                    Complex(1, 0),
+                    smallCoefficients,
+                    smallNumberRows,
+                    transpose,
+                    result,
+                    numberRows
+                );
+
+                configureSmallStorage(numberRows, numberColumns);
+
+                unsigned long numberCoefficients = numberRows * numberColumns;
+                for (unsigned long index=0 ; index<numberCoefficients ; ++index) {
+                    smallCoefficients[index] = scalarValue * (conjugate ? result[index].conj() : result[index]);
+                }
+            }
+        } else if (pendingScalarValue != Complex(1, 0) || pendingTransform != LazyTransform::NONE) {
+            bool transpose     = (
+                   pendingTransform == LazyTransform::TRANSPOSE
+                || pendingTransform == LazyTransform::ADJOINT
+            );
+            bool updateInPlace = (
+                   dataStore()->matrixType() == MatrixType::DENSE
+                && dataStore()->referenceCount() == 1
+                && (!transpose || dataStore()->numberRows() == dataStore()->numberColumns())
+            );
+
+            if (updateInPlace) {
+                DenseData* denseData = POLYMORPHIC_CAST<DenseData*>(dataStore());
+                if (transpose) {
+                    denseData->transposeInPlace();
+                }
+
+                if (pendingTransform == LazyTransform::CONJUGATE || pendingTransform == LazyTransform::ADJOINT) {
+                    denseData->conjugateAndScaleInPlace(pendingScalarValue);
+                } else if (pendingScalarValue != Complex(1, 0)) {
+                    denseData->scaleInPlace(pendingScalarValue);
+                }
+            } else {
+                dataStore()->lock();
+                Data* newDataStore = dataStore()->applyTransformAndScaling(pendingTransform, pendingScalarValue);
+                assignNewDataStore(newDataStore, true);
+            }
 
             pendingTransform = LazyTransform::NONE;
             pendingScalarValue = Complex(1, 0);
@@ -2994,6 +4020,43 @@ namespace M {
     }
 
 
+    void MatrixComplex::convertToDenseDataStore() const {
+        applyLazyTransformsAndScaling();
+
+        if (dataStore()->matrixType() == MatrixType::SPARSE) {
+            dataStore()->lock();
+            Data* newDataStore = POLYMORPHIC_CAST<const SparseData*>(dataStore())->toDense();
+            assignNewDataStore(newDataStore, true);
+        }
+    }
+
+
+    void MatrixComplex::applyStoragePolicy(bool checkDense) const {
+        unsigned long long numberCoefficients =   static_cast<unsigned long long>(numberRows())
+                                                * static_cast<unsigned long long>(numberColumns());
+
+        if (numberCoefficients > 0 && numberCoefficients >= currentAutomaticStorageMinimumCoefficients) {
+            if (matrixType() == MatrixType::SPARSE) {
+                const SparseData* sparseData = POLYMORPHIC_CAST<const SparseData*>(dataStore());
+                if (sparseData->numberNonZeros() > currentDenseDensityThreshold * numberCoefficients) {
+                    dataStore()->lock();
+                    Data* newDataStore = sparseData->toDense();
+                    assignNewDataStore(newDataStore, true);
+                }
+            } else if (checkDense && currentSparseDensityThreshold > 0) {
+                assert(matrixType() == MatrixType::DENSE);
+
+                const DenseData* denseData = POLYMORPHIC_CAST<const DenseData*>(dataStore());
+                if (denseData->numberNonZeros() <= currentSparseDensityThreshold * numberCoefficients) {
+                    dataStore()->lock();
+                    Data* newDataStore = SparseData::create(*denseData);
+                    assignNewDataStore(newDataStore, true);
+                }
+            }
+        }
+    }
+
+
     Tuple MatrixComplex::eigenvectors(bool right) const {
         Tuple result;
 
@@ -3004,7 +4067,7 @@ namespace M {
         Data*  uMatrix;
         Data** eigenvectorMatrices;
 
-        currentData->eigenvectors(right, eigenvalueMatrix, qMatrix, uMatrix, eigenvectorMatrices);
+        dataStore()->eigenvectors(right, eigenvalueMatrix, qMatrix, uMatrix, eigenvectorMatrices);
 
         result.append(MatrixComplex(eigenvalueMatrix));
         result.append(MatrixComplex(qMatrix));
@@ -31,6 +31,7 @@
 #include <cassert>
 #include <algorithm>
 #include <cmath>
+#include <complex>
 #include <fstream>
 #include <iomanip>
 #include <vector>
@@ -41,10 +42,14 @@
 #include "m_api_types.h"
 #include "m_intrinsic_types.h"
 #include "m_basic_functions.h"
+#include "m_trigonometric_functions.h"
+#include "m_hyperbolic_functions.h"
+#include "m_special_values.h"
 #include "model_exceptions.h"
 #include "model_range.h"
 #include "m_matrix_dense_private.h"
 #include "m_matrix_sparse_private.h"
+#include "m_matrix_small_private.h"
 #include "m_matrix_real.h"
 #include "m_matrix_real_dense_data.h"
 #include "m_matrix_integer.h"
@@ -54,6 +59,7 @@
 #include "m_matrix_complex.h"
 #include "m_matrix_complex_data.h"
 #include "m_matrix_complex_dense_data.h"
+#include "m_matrix_complex_sparse_data.h"
 
 namespace M {
     long double MatrixComplex::DenseData::currentSmallLimit = -1;
@@ -700,8 +706,11 @@ namespace M {
     MatrixComplex::Data* MatrixComplex::DenseData::combineLeftToRight(
             const MatrixSparsePrivate<MatrixComplex::DenseData::Scalar>& other
         ) const {
-        (void) other; // FIXME
-        return nullptr; // FIXME
+        DenseData* denseOther = static_cast<const SparseData&>(other).toDense();
+        Data*      result     = combineLeftToRight(*denseOther);
+        destroy(denseOther);
+
+        return result;
     }
 
 
@@ -787,8 +796,11 @@ namespace M {
     MatrixComplex::Data* MatrixComplex::DenseData::combineTopToBottom(
             const MatrixSparsePrivate<MatrixComplex::DenseData::Scalar>& other
         ) const {
-        (void) other; // FIXME
-        return nullptr; // FIXME
+        DenseData* denseOther = static_cast<const SparseData&>(other).toDense();
+        Data*      result     = combineTopToBottom(*denseOther);
+        destroy(denseOther);
+
+        return result;
     }
 
 
@@ -872,6 +884,8 @@ namespace M {
 
         if (numberRows != numberColumns || numberRows == 0) {
             throw Model::InvalidMatrixDimensions(numberRows, numberColumns);
+        } else if (MatrixSmallPrivate<Scalar>::isSmall(numberRows, numberColumns)) {
+            result = MatrixSmallPrivate<Scalar>::determinant(data(), columnSpacingInMemory(), numberRows);
         } else {
             DenseData*    luMatrix       = static_cast<DenseData*>(clone());
             unsigned long pivotArraySize = std::max(1UL, std::min(numberRows, numberColumns));
@@ -933,6 +947,22 @@ namespace M {
 
         if (numberColumns == 0 || numberRows == 0 || numberRows != numberColumns) {
             throw Model::InvalidMatrixDimensions(numberRows, numberColumns);
+        } else if (MatrixSmallPrivate<Scalar>::isSmall(numberRows, numberColumns)) {
+            DenseData* di      = create(numberRows, numberColumns);
+            bool       success = MatrixSmallPrivate<Scalar>::inverse(
+                data(),
+                columnSpacingInMemory(),
+                numberRows,
+                di->data(),
+                di->columnSpacingInMemory()
+            );
+
+            if (!success) {
+                destroy(di);
+                throw Model::MatrixIsSingular();
+            } else {
+                result = di;
+            }
         } else {
             DenseData*         di                    = static_cast<DenseData*>(clone());
             MatInteger*        pivotOperationsByRow  = new MatInteger[numberRows];
@@ -1522,7 +1552,7 @@ namespace M {
                 for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
                     const Scalar* v = reinterpret_cast<const Scalar*>(addressOf(0, columnIndex));
                     for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
-                        sum += pow(M::abs(*v), p);
+                        sum += M::pow(M::abs(*v), p);
                         ++v;
                     }
                 }
@@ -1657,6 +1687,25 @@ namespace M {
             throw Model::InvalidMatrixDimensions(yNumberRows, yNumberColumns);
         } else if (aNumberRows != yNumberRows) {
             throw Model::IncompatibleMatrixDimensions(aNumberRows, aNumberColumns, yNumberRows, yNumberColumns);
+        } else if (MatrixSmallPrivate<Scalar>::isSmall(aNumberRows, aNumberColumns)) {
+            DenseData* x       = create(aNumberRows, yNumberColumns);
+            bool       success = MatrixSmallPrivate<Scalar>::solve(
+                data(),
+                columnSpacingInMemory(),
+                aNumberRows,
+                y->data(),
+                y->columnSpacingInMemory(),
+                yNumberColumns,
+                x->data(),
+                x->columnSpacingInMemory()
+            );
+
+            if (success) {
+                result = x;
+            } else {
+                DenseData::destroy(x);
+                result = create(0, 0);
+            }
         } else {
             double* rowScaleFactors    = new double[aNumberRows];
             double* columnScaleFactors = new double[aNumberColumns];
@@ -1735,8 +1784,18 @@ namespace M {
 
 
     MatrixComplex::Data* MatrixComplex::DenseData::solve(const MatrixComplex::SparseData* y) const {
-        (void) y; // FIXME
-        return nullptr; // FIXME
+        DenseData* denseY = y->toDense();
+        Data*      result;
+
+        try {
+            result = solve(denseY);
+        } catch (...) {
+            destroy(denseY);
+            throw;
+        }
+
+        destroy(denseY);
+        return result;
     }
 
 
@@ -1798,8 +1857,18 @@ namespace M {
 
 
     MatrixComplex::Data* MatrixComplex::DenseData::leastSquares(const MatrixComplex::SparseData* b) const {
-        (void) b; // FIXME
-        return nullptr; // FIXME
+        DenseData* denseB = b->toDense();
+        Data*      result;
+
+        try {
+            result = leastSquares(denseB);
+        } catch (...) {
+            destroy(denseB);
+            throw;
+        }
+
+        destroy(denseB);
+        return result;
     }
 
 
@@ -1864,8 +1933,9 @@ namespace M {
     MatrixComplex::Data* MatrixComplex::DenseData::hadamard(
             const MatrixSparsePrivate<MatrixComplex::DenseData::Scalar>& other
         ) const {
-        (void) other; // FIXME
-        return nullptr; // FIXME
+        // The Hadamard product is commutative and the result can have no more non-zero entries than the sparse
+        // operand so we let the sparse implementation do the work.
+        return static_cast<const SparseData&>(other).hadamard(*this);
     }
 
 
@@ -1971,10 +2041,11 @@ namespace M {
             MatrixComplex::DenseData::LazyTransform                      otherTransform,
             const MatrixComplex::DenseData::Scalar&                      scalarMultiplier
         ) const {
-        (void) other; // FIXME
-        (void) otherTransform; // FIXME
-        (void) scalarMultiplier; // FIXME
-        return nullptr; // FIXME
+        SparseData* sparseThis = SparseData::create(*this);
+        Data*       result     = sparseThis->kronecker(other, otherTransform, scalarMultiplier);
+        SparseData::destroy(sparseThis);
+
+        return result;
     }
 
 
@@ -2097,22 +2168,46 @@ namespace M {
             Scalar*            destinationData          = result->data();
             unsigned long long destinationColumnSpacing = result->columnSpacingInMemory();
 
-            matrixApi()->complexScaleAdd(
-                MatMatrixMode::COLUMN_MAJOR,
-                augendTransformType,
-                addendTransformType,
+            bool isSmall = MatrixSmallPrivate<Scalar>::isSmall(
                 augendTransformNumberRows,
-                augendTransformNumberColumns,
-                reinterpret_cast<const MatComplex*>(&augendScalar),
-                reinterpret_cast<const MatComplex*>(augendData),
-                augendColumnSpacing,
-                reinterpret_cast<const MatComplex*>(&addendScalar),
-                reinterpret_cast<const MatComplex*>(addendData),
-                addendColumnSpacing,
-                reinterpret_cast<MatComplex*>(destinationData),
-                destinationColumnSpacing
+                augendTransformNumberColumns
             );
 
+            if (isSmall                                                                                 &&
+                (augendTransform == LazyTransform::NONE || augendTransform == LazyTransform::TRANSPOSE) &&
+                (addendTransform == LazyTransform::NONE || addendTransform == LazyTransform::TRANSPOSE)    ) {
+                MatrixSmallPrivate<Scalar>::scaleAdd(
+                    augendTransformNumberRows,
+                    augendTransformNumberColumns,
+                    augendScalar,
+                    augendData,
+                    augendColumnSpacing,
+                    augendTransform == LazyTransform::TRANSPOSE,
+                    addendScalar,
+                    addendData,
+                    addendColumnSpacing,
+                    addendTransform == LazyTransform::TRANSPOSE,
+                    destinationData,
+                    destinationColumnSpacing
+                );
+            } else {
+                matrixApi()->complexScaleAdd(
+                    MatMatrixMode::COLUMN_MAJOR,
+                    augendTransformType,
+                    addendTransformType,
+                    augendTransformNumberRows,
+                    augendTransformNumberColumns,
+                    reinterpret_cast<const MatComplex*>(&augendScalar),
+                    reinterpret_cast<const MatComplex*>(augendData),
+                    augendColumnSpacing,
+                    reinterpret_cast<const MatComplex*>(&addendScalar),
+                    reinterpret_cast<const MatComplex*>(addendData),
+                    addendColumnSpacing,
+                    reinterpret_cast<MatComplex*>(destinationData),
+                    destinationColumnSpacing
+                );
+            }
+
             unsigned long long residueRows = destinationColumnSpacing - augendTransformNumberRows;
             if (residueRows > 0) {
                 unsigned residueSizeInBytes = static_cast<unsigned>(sizeof(Scalar) * residueRows);
@@ -2134,12 +2229,14 @@ namespace M {
             const Complex&                                               augendScalar,
             const Complex&                                               addendScalar
         ) const {
-        (void) addend; // FIXME
-        (void) augendtTransform; // FIXME
-        (void) addendTransform; // FIXME
-        (void) augendScalar; // FIXME
-        (void) addendScalar; // FIXME
-        return nullptr; // FIXME
+        // Addition is commutative so we let the sparse implementation do the work.
+        return static_cast<const SparseData&>(addend).add(
+            *this,
+            addendTransform,
+            augendtTransform,
+            addendScalar,
+            augendScalar
+        );
     }
 
 
@@ -2212,22 +2309,42 @@ namespace M {
                 unsigned long long resultColumnSpacingInMemory       = result->columnSpacingInMemory();
                 Scalar             beta(0);
 
-                matrixApi()->blasComplexMultiplyAdd(
-                    MatMatrixMode::COLUMN_MAJOR,
-                    multiplierTransformOp,
-                    multiplicandTransformOp,
-                    multiplierOpRows,
-                    multiplicandOpColumns,
-                    multiplierOpColumns,
-                    reinterpret_cast<const MatComplex*>(&scalerMultiplier),
-                    reinterpret_cast<const MatComplex*>(multiplierData),
-                    multiplierColumnSpacingInMemory,
-                    reinterpret_cast<const MatComplex*>(multiplicandData),
-                    multiplicandColumnSpacingInMemory,
-                    reinterpret_cast<const MatComplex*>(&beta),
-                    reinterpret_cast<MatComplex*>(resultData),
-                    resultColumnSpacingInMemory
-                );
+                if (MatrixSmallPrivate<Scalar>::isSmall(multiplierOpRows, multiplierOpColumns)     &&
+                    MatrixSmallPrivate<Scalar>::isSmall(multiplicandOpRows, multiplicandOpColumns) &&
+                    multiplierTransform != LazyTransform::ADJOINT                                  &&
+                    multiplicandTransform != LazyTransform::ADJOINT                                   ) {
+                    MatrixSmallPrivate<Scalar>::multiply(
+                        multiplierOpRows,
+                        multiplierOpColumns,
+                        multiplicandOpColumns,
+                        scalerMultiplier,
+                        multiplierData,
+                        multiplierColumnSpacingInMemory,
+                        multiplierTransform == LazyTransform::TRANSPOSE,
+                        multiplicandData,
+                        multiplicandColumnSpacingInMemory,
+                        multiplicandTransform == LazyTransform::TRANSPOSE,
+                        resultData,
+                        resultColumnSpacingInMemory
+                    );
+                } else {
+                    matrixApi()->blasComplexMultiplyAdd(
+                        MatMatrixMode::COLUMN_MAJOR,
+                        multiplierTransformOp,
+                        multiplicandTransformOp,
+                        multiplierOpRows,
+                        multiplicandOpColumns,
+                        multiplierOpColumns,
+                        reinterpret_cast<const MatComplex*>(&scalerMultiplier),
+                        reinterpret_cast<const MatComplex*>(multiplierData),
+                        multiplierColumnSpacingInMemory,
+                        reinterpret_cast<const MatComplex*>(multiplicandData),
+                        multiplicandColumnSpacingInMemory,
+                        reinterpret_cast<const MatComplex*>(&beta),
+                        reinterpret_cast<MatComplex*>(resultData),
+                        resultColumnSpacingInMemory
+                    );
+                }
             }
         } else {
             result = DenseData::create(0, 0);
@@ -2243,11 +2360,65 @@ namespace M {
             MatrixComplex::DenseData::LazyTransform                      multiplicandTransform,
             const Complex&                                               scalerMultiplier
         ) const {
-        (void) multiplicand; // FIXME
-        (void) multiplierTransform; // FIXME
-        (void) multiplicandTransform; // FIXME
-        (void) scalerMultiplier; // FIXME
-        return nullptr; // FIXME
+        bool          multiplierTranspose   = (
+               multiplierTransform == LazyTransform::TRANSPOSE
+            || multiplierTransform == LazyTransform::ADJOINT
+        );
+        bool          multiplicandTranspose = (
+               multiplicandTransform == LazyTransform::TRANSPOSE
+            || multiplicandTransform == LazyTransform::ADJOINT
+        );
+        unsigned long multiplierRows        = multiplierTranspose ? numberColumns() : numberRows();
+        unsigned long multiplierColumns     = multiplierTranspose ? numberRows() : numberColumns();
+        unsigned long multiplicandRows      = (
+              multiplicandTranspose
+            ? multiplicand.numberColumns()
+            : multiplicand.numberRows()
+        );
+        unsigned long multiplicandColumns   = (
+              multiplicandTranspose
+            ? multiplicand.numberRows()
+            : multiplicand.numberColumns()
+        );
+
+        if (multiplierColumns != multiplicandRows) {
+            throw Model::IncompatibleMatrixDimensions(
+                multiplierRows,
+                multiplierColumns,
+                multiplicandRows,
+                multiplicandColumns
+            );
+        }
+
+        // The sparse kernels only handle transposes so any conjugation is applied up-front to a temporary copy.
+
+        const DenseData* a = this;
+        if (multiplierTransform == LazyTransform::CONJUGATE || multiplierTransform == LazyTransform::ADJOINT) {
+            a                   = POLYMORPHIC_CAST<const DenseData*>(applyTransformAndScaling(multiplierTransform, 1));
+            multiplierTranspose = false;
+        }
+
+        const SparseData& sparseMultiplicand = static_cast<const SparseData&>(multiplicand);
+        const SparseData* b                  = &sparseMultiplicand;
+        if (multiplicandTransform == LazyTransform::CONJUGATE || multiplicandTransform == LazyTransform::ADJOINT) {
+            b                     = POLYMORPHIC_CAST<const SparseData*>(
+                sparseMultiplicand.applyTransformAndScaling(multiplicandTransform, 1)
+            );
+            multiplicandTranspose = false;
+        }
+
+        DenseData* result = DenseData::create(multiplierRows, multiplicandColumns);
+        b->multiplyDenseByThisInto(*a, multiplierTranspose, multiplicandTranspose, scalerMultiplier, *result);
+
+        if (a != this) {
+            destroy(const_cast<DenseData*>(a));
+        }
+
+        if (b != &sparseMultiplicand) {
+            SparseData::destroy(const_cast<SparseData*>(b));
+        }
+
+        return result;
     }
 
 
@@ -2261,6 +2432,192 @@ namespace M {
     }
 
 
+    void MatrixComplex::DenseData::conjugateAndScaleInPlace(const Complex& scaleFactor) {
+        unsigned long      nr            = numberRows();
+        unsigned long      nc            = numberColumns();
+        Scalar*            d             = data();
+        unsigned long long columnSpacing = columnSpacingInMemory();
+
+        for (unsigned long columnIndex=0 ; columnIndex<nc ; ++columnIndex) {
+            Scalar* column = d + columnSpacing * columnIndex;
+            for (unsigned long rowIndex=0 ; rowIndex<nr ; ++rowIndex) {
+                column[rowIndex] = scaleFactor * column[rowIndex].conj();
+            }
+        }
+    }
+
+
+    void MatrixComplex::DenseData::scaleAccumulate(
+            const MatrixDensePrivate<MatrixComplex::DenseData::Scalar>& addend,
+            MatrixComplex::DenseData::LazyTransform                     addendTransform,
+            const Complex&                                              augendScalar,
+            const Complex&                                              addendScalar
+        ) {
+        bool          addendTranspose = (
+               addendTransform == LazyTransform::TRANSPOSE
+            || addendTransform == LazyTransform::ADJOINT
+        );
+        bool          addendConjugate = (
+               addendTransform == LazyTransform::CONJUGATE
+            || addendTransform == LazyTransform::ADJOINT
+        );
+        unsigned long augendRows      = numberRows();
+        unsigned long augendColumns   = numberColumns();
+        unsigned long addendRows      = addendTranspose ? addend.numberColumns() : addend.numberRows();
+        unsigned long addendColumns   = addendTranspose ? addend.numberRows() : addend.numberColumns();
+
+        if (augendRows != addendRows || augendColumns != addendColumns) {
+            throw Model::IncompatibleMatrixDimensions(augendRows, augendColumns, addendRows, addendColumns);
+        }
+
+        // The matrix API scale-add kernel does not permit the destination to alias a source so we use a simple
+        // column oriented loop.  The padding rows are never touched so they remain zero.
+
+        Scalar*            destinationData     = data();
+        unsigned long long destinationSpacing  = columnSpacingInMemory();
+        const Scalar*      addendData          = addend.data();
+        unsigned long long addendColumnSpacing = addend.columnSpacingInMemory();
+        unsigned long long addendRowStride     = addendTranspose ? addendColumnSpacing : 1;
+
+        for (unsigned long columnIndex=0 ; columnIndex<augendColumns ; ++columnIndex) {
+            Scalar*       destination = destinationData + destinationSpacing * columnIndex;
+            const Scalar* source      = (
+                  addendTranspose
+                ? addendData + columnIndex
+                : addendData + addendColumnSpacing * columnIndex
+            );
+
+            if (addendConjugate) {
+                for (unsigned long rowIndex=0 ; rowIndex<augendRows ; ++rowIndex) {
+                    destination[rowIndex] = (
+                          augendScalar * destination[rowIndex]
+                        + addendScalar * source[addendRowStride * rowIndex].conj()
+                    );
+                }
+            } else {
+                for (unsigned long rowIndex=0 ; rowIndex<augendRows ; ++rowIndex) {
+                    destination[rowIndex] = (
+                          augendScalar * destination[rowIndex]
+                        + addendScalar * source[addendRowStride * rowIndex]
+                    );
+                }
+            }
+        }
+    }
+
+
+    void MatrixComplex::DenseData::scaleAccumulate(
+            const MatrixSparsePrivate<MatrixComplex::DenseData::Scalar>& addend,
+            MatrixComplex::DenseData::LazyTransform                      addendTransform,
+            const Complex&                                               augendScalar,
+            const Complex&                                               addendScalar
+        ) {
+        assert(addendTransform == LazyTransform::NONE || addendTransform == LazyTransform::TRANSPOSE);
+
+        bool          addendTranspose = (addendTransform == LazyTransform::TRANSPOSE);
+        unsigned long augendRows      = numberRows();
+        unsigned long augendColumns   = numberColumns();
+        unsigned long addendRows      = addendTranspose ? addend.numberColumns() : addend.numberRows();
+        unsigned long addendColumns   = addendTranspose ? addend.numberRows() : addend.numberColumns();
+
+        if (augendRows != addendRows || augendColumns != addendColumns) {
+            throw Model::IncompatibleMatrixDimensions(augendRows, augendColumns, addendRows, addendColumns);
+        }
+
+        if (augendScalar != Complex(1, 0)) {
+            scaleInPlace(augendScalar);
+        }
+
+        addend.accumulateInto(*this, addendTranspose, addendScalar);
+    }
+
+
+    void MatrixComplex::DenseData::multiplyAccumulate(
+            const MatrixDensePrivate<MatrixComplex::DenseData::Scalar>& multiplier,
+            const MatrixDensePrivate<MatrixComplex::DenseData::Scalar>& multiplicand,
+            MatrixComplex::DenseData::LazyTransform                     multiplierTransform,
+            MatrixComplex::DenseData::LazyTransform                     multiplicandTransform,
+            const Complex&                                              scalerMultiplier,
+            const Complex&                                              accumulatorScalar
+        ) {
+        assert(multiplierTransform   != LazyTransform::CONJUGATE);
+        assert(multiplicandTransform != LazyTransform::CONJUGATE);
+
+        MatOperation  multiplierTransformOp;
+        unsigned long multiplierRows;
+        unsigned long multiplierColumns;
+        if (multiplierTransform == LazyTransform::TRANSPOSE) {
+            multiplierRows        = multiplier.numberColumns();
+            multiplierColumns     = multiplier.numberRows();
+            multiplierTransformOp = MatOperation::TRANSPOSE;
+        } else if (multiplierTransform == LazyTransform::ADJOINT) {
+            multiplierRows        = multiplier.numberColumns();
+            multiplierColumns     = multiplier.numberRows();
+            multiplierTransformOp = MatOperation::CONJUGATE_TRANSPOSE;
+        } else {
+            multiplierRows        = multiplier.numberRows();
+            multiplierColumns     = multiplier.numberColumns();
+            multiplierTransformOp = MatOperation::NO_OPERATION;
+        }
+
+        MatOperation  multiplicandTransformOp;
+        unsigned long multiplicandRows;
+        unsigned long multiplicandColumns;
+        if (multiplicandTransform == LazyTransform::TRANSPOSE) {
+            multiplicandRows        = multiplicand.numberColumns();
+            multiplicandColumns     = multiplicand.numberRows();
+            multiplicandTransformOp = MatOperation::TRANSPOSE;
+        } else if (multiplicandTransform == LazyTransform::ADJOINT) {
+            multiplicandRows        = multiplicand.numberColumns();
+            multiplicandColumns     = multiplicand.numberRows();
+            multiplicandTransformOp = MatOperation::CONJUGATE_TRANSPOSE;
+        } else {
+            multiplicandRows        = multiplicand.numberRows();
+            multiplicandColumns     = multiplicand.numberColumns();
+            multiplicandTransformOp = MatOperation::NO_OPERATION;
+        }
+
+        if (multiplierColumns != multiplicandRows) {
+            throw Model::IncompatibleMatrixDimensions(
+                multiplierRows,
+                multiplierColumns,
+                multiplicandRows,
+                multiplicandColumns
+            );
+        } else if (multiplierRows != numberRows() || multiplicandColumns != numberColumns()) {
+            throw Model::IncompatibleMatrixDimensions(
+                numberRows(),
+                numberColumns(),
+                multiplierRows,
+                multiplicandColumns
+            );
+        }
+
+        if (multiplierRows != 0 && multiplicandColumns != 0) {
+            if (multiplierColumns != 0) {
+                matrixApi()->blasComplexMultiplyAdd(
+                    MatMatrixMode::COLUMN_MAJOR,
+                    multiplierTransformOp,
+                    multiplicandTransformOp,
+                    multiplierRows,
+                    multiplicandColumns,
+                    multiplierColumns,
+                    reinterpret_cast<const MatComplex*>(&scalerMultiplier),
+                    reinterpret_cast<const MatComplex*>(multiplier.data()),
+                    multiplier.columnSpacingInMemory(),
+                    reinterpret_cast<const MatComplex*>(multiplicand.data()),
+                    multiplicand.columnSpacingInMemory(),
+                    reinterpret_cast<const MatComplex*>(&accumulatorScalar),
+                    reinterpret_cast<MatComplex*>(data()),
+                    columnSpacingInMemory()
+                );
+            } else if (accumulatorScalar != Complex(1, 0)) {
+                scaleInPlace(accumulatorScalar);
+            }
+        }
+    }
+
+
     bool MatrixComplex::DenseData::isEqualTo(const MatrixDensePrivate<MatrixComplex::DenseData::Scalar>& other) const {
         bool matches;
 
@@ -2298,9 +2655,7 @@ namespace M {
     bool MatrixComplex::DenseData::isEqualTo(
             const MatrixSparsePrivate<MatrixComplex::DenseData::Scalar>& other
         ) const {
-        (void) other; // FIXME
-        assert(false); // FIXME
-        return false;
+        return other.isEqualTo(*this);
     }
 
 
@@ -2360,17 +2715,31 @@ namespace M {
         Scalar*            destinationData          = result->data();
         unsigned long long destinationColumnSpacing = result->columnSpacingInMemory();
 
-        matrixApi()->complexScaleCopy(
-            MatMatrixMode::COLUMN_MAJOR,
-            transformType,
-            inNumberRows,
-            inNumberColumns,
-            reinterpret_cast<const MatComplex*>(&scaleFactor),
-            reinterpret_cast<const MatComplex*>(sourceData),
-            sourceColumnSpacing,
-            reinterpret_cast<MatComplex*>(destinationData),
-            destinationColumnSpacing
-        );
+        if (MatrixSmallPrivate<Scalar>::isSmall(outNumberRows, outNumberColumns)         &&
+            (transform == LazyTransform::NONE || transform == LazyTransform::TRANSPOSE)    ) {
+            MatrixSmallPrivate<Scalar>::scaleCopy(
+                outNumberRows,
+                outNumberColumns,
+                scaleFactor,
+                sourceData,
+                sourceColumnSpacing,
+                transform == LazyTransform::TRANSPOSE,
+                destinationData,
+                destinationColumnSpacing
+            );
+        } else {
+            matrixApi()->complexScaleCopy(
+                MatMatrixMode::COLUMN_MAJOR,
+                transformType,
+                inNumberRows,
+                inNumberColumns,
+                reinterpret_cast<const MatComplex*>(&scaleFactor),
+                reinterpret_cast<const MatComplex*>(sourceData),
+                sourceColumnSpacing,
+                reinterpret_cast<MatComplex*>(destinationData),
+                destinationColumnSpacing
+            );
+        }
 
         unsigned long long residueRows = destinationColumnSpacing - outNumberRows;
         if (residueRows > 0) {
@@ -2399,6 +2768,81 @@ namespace M {
     }
 
 
+    MatrixComplex::DenseData* MatrixComplex::DenseData::exp() const {
+        return mapElements(
+            [](const Scalar& value) {
+                std::complex<Scalar::T> result = std::exp(std::complex<Scalar::T>(value.real(), value.imag()));
+                return Scalar(result.real(), result.imag());
+            }
+        );
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::DenseData::ln() const {
+        return mapElements([](const Scalar& value) { return M::ln(value); });
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::DenseData::sqrt() const {
+        return mapElements([](const Scalar& value) { return M::sqrt(value); });
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::DenseData::sine() const {
+        return mapElements([](const Scalar& value) { return M::sine(value); });
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::DenseData::cosine() const {
+        return mapElements([](const Scalar& value) { return M::cosine(value); });
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::DenseData::tangent() const {
+        return mapElements([](const Scalar& value) { return M::tangent(value); });
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::DenseData::arcsine() const {
+        return mapElements([](const Scalar& value) { return M::arcsine(value); });
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::DenseData::arccosine() const {
+        return mapElements([](const Scalar& value) { return M::arccosine(value); });
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::DenseData::arctangent() const {
+        return mapElements([](const Scalar& value) { return M::arctangent(value); });
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::DenseData::hyperbolicSine() const {
+        return mapElements([](const Scalar& value) { return M::hyperbolicSine(value); });
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::DenseData::hyperbolicCosine() const {
+        return mapElements([](const Scalar& value) { return M::hyperbolicCosine(value); });
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::DenseData::hyperbolicTangent() const {
+        return mapElements([](const Scalar& value) { return M::hyperbolicTangent(value); });
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::DenseData::gamma() const {
+        return mapElements([](const Scalar& value) { return M::gamma(value); });
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::DenseData::pow(const MatrixComplex::Scalar& exponent) const {
+        return mapElements([exponent](const Scalar& value) { return M::pow(value, exponent); });
+    }
+
+
     long double MatrixComplex::DenseData::smallLimit() {
         if (currentSmallLimit < 0) {
             currentSmallLimit = matrixApi()->lapackDoubleMachineParameter(MatMachineParameter::SAFE_MINIMUM);
@@ -832,6 +832,93 @@ namespace M {
                 const Complex&                     scalerMultiplier
             ) const override;
 
+            /**
+             * Method you can call to accumulate another matrix into this matrix, in place.  The method calculates
+             * \f$ this = augendScalar \times this + addendScalar \times op \left ( addend \right ) \f$ using a
+             * single pass over the data and without allocating a new data store.  The caller must guarantee that this
+             * data store is not shared and that the addend does not share memory with this data store.
+             *
+             * \param[in] addend          The instance to be accumulated into this instance.
+             *
+             * \param[in] addendTransform Indicates the transformation to be performed on the addend prior to the
+             *                            addition.  The addend will not be modified.  Note that all lazy transforms
+             *                            are supported.
+             *
+             * \param[in] augendScalar    A scalar value to be multiplied to this matrix prior to the addition.
+             *
+             * \param[in] addendScalar    A scalar value to be multiplied to the addend prior to the addition.
+             */
+            /**
+             * Method you can call to conjugate and then scale every coefficient of this matrix, in place.  The
+             * caller must guarantee that this data store is not shared.
+             *
+             * \param[in] scaleFactor The scale factor to apply after conjugating each coefficient.
+             */
+            void conjugateAndScaleInPlace(const Complex& scaleFactor);
+
+            void scaleAccumulate(
+                const MatrixDensePrivate<Scalar>& addend,
+                LazyTransform                     addendTransform,
+                const Complex&                    augendScalar,
+                const Complex&                    addendScalar
+            );
+
+            /**
+             * Method you can call to accumulate a sparse matrix into this matrix, in place.  The method calculates
+             * \f$ this = augendScalar \times this + addendScalar \times op \left ( addend \right ) \f$ without
+             * allocating a new data store.  The caller must guarantee that this data store is not shared.
+             *
+             * \param[in] addend          The instance to be accumulated into this instance.
+             *
+             * \param[in] addendTransform Indicates the transformation to be performed on the addend prior to the
+             *                            addition.  The addend will not be modified.  Note that only
+             *                            \ref M::MatrixComplex::Data::LazyTransform::NONE and
+             *                            \ref M::MatrixComplex::Data::LazyTransform::TRANSPOSE are supported by this
+             *                            method.
+             *
+             * \param[in] augendScalar    A scalar value to be multiplied to this matrix prior to the addition.
+             *
+             * \param[in] addendScalar    A scalar value to be multiplied to the addend prior to the addition.
+             */
+            void scaleAccumulate(
+                const MatrixSparsePrivate<Scalar>& addend,
+                LazyTransform                      addendTransform,
+                const Complex&                     augendScalar,
+                const Complex&                     addendScalar
+            );
+
+            /**
+             * Method you can call to accumulate a matrix product into this matrix, in place.  The method calculates
+             * \f$ this = scalerMultiplier \times op \left ( multiplier \right ) \times
+             * op \left ( multiplicand \right ) + accumulatorScalar \times this \f$ using a single GEMM call.  The
+             * caller must guarantee that this data store is not shared and that neither operand shares memory with this
+             * data store.
+             *
+             * \param[in] multiplier            The left hand side of the product.
+             *
+             * \param[in] multiplicand          The right hand side of the product.
+             *
+             * \param[in] multiplierTransform   Indicates the transformation to be performed on the multiplier.  Note
+             *                                  \ref M::MatrixComplex::Data::LazyTransform::CONJUGATE is not supported
+             *                                  by this method and will trigger an assert.
+             *
+             * \param[in] multiplicandTransform Indicates the transformation to be performed on the multiplicand.  Note
+             *                                  \ref M::MatrixComplex::Data::LazyTransform::CONJUGATE is not supported
+             *                                  by this method and will trigger an assert.
+             *
+             * \param[in] scalerMultiplier      A scaler multiplier to be applied to the product.
+             *
+             * \param[in] accumulatorScalar     A scaler multiplier to be applied to this matrix prior to accumulation.
+             */
+            void multiplyAccumulate(
+                const MatrixDensePrivate<Scalar>& multiplier,
+                const MatrixDensePrivate<Scalar>& multiplicand,
+                LazyTransform                     multiplierTransform,
+                LazyTransform                     multiplicandTransform,
+                const Complex&                    scalerMultiplier,
+                const Complex&                    accumulatorScalar
+            );
+
             /**
              * Method you can use to obtain the real portion of this matrix data.
              *
@@ -892,7 +979,128 @@ namespace M {
              */
             int relativeOrder(const MatrixComplex::Data& other) const override;
 
+            /**
+             * Method you can use to obtain a matrix holding the exponential of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* exp() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the natural log of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* ln() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the square root of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* sqrt() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the sine of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* sine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the cosine of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* cosine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the tangent of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* tangent() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the inverse sine of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* arcsine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the inverse cosine of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* arccosine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the inverse tangent of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* arctangent() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the hyperbolic sine of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* hyperbolicSine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the hyperbolic cosine of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* hyperbolicCosine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the hyperbolic tangent of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* hyperbolicTangent() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the gamma function of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* gamma() const;
+
+            /**
+             * Method you can use to obtain a matrix holding each value raised to a power of each value in the matrix.
+             *
+             * \param[in] exponent The exponent to apply.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* pow(const Scalar& exponent) const;
+
         private:
+            /**
+             * Method that creates a new matrix by applying a scalar function to each value of this matrix.
+             *
+             * \param[in] function The function to apply.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            template<typename F> DenseData* mapElements(F function) const {
+                DenseData* result = createUninitialized(numberRows(), numberColumns());
+                applyColumnKernel(
+                    result->data(),
+                    result->columnSpacingInMemory(),
+                    [function](unsigned long numberRows, const Scalar* source, Scalar* destination) {
+                        for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                            destination[rowIndex] = function(source[rowIndex]);
+                        }
+                    }
+                );
+
+                return result;
+            }
             /**
              * Method you can use to obtain the small limit before equilibration is recommeded.
              *
@@ -0,0 +1,709 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+*
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::MatrixComplex::SparseData class.
+***********************************************************************************************************************/
+
+#include <new>
+#include <cstring>
+#include <cstdint>
+#include <cassert>
+#include <algorithm>
+#include <cmath>
+
+#include "m_api_types.h"
+#include "m_intrinsic_types.h"
+#include "m_basic_functions.h"
+#include "model_exceptions.h"
+#include "m_matrix_dense_private.h"
+#include "m_matrix_sparse_private.h"
+#include "m_matrix_boolean.h"
+#include "m_matrix_boolean_data.h"
+#include "m_matrix_boolean_sparse_data.h"
+#include "m_matrix_integer.h"
+#include "m_matrix_integer_data.h"
+#include "m_matrix_integer_sparse_data.h"
+#include "m_matrix_real.h"
+#include "m_matrix_real_data.h"
+#include "m_matrix_real_sparse_data.h"
+#include "m_matrix_complex.h"
+#include "m_matrix_complex_data.h"
+#include "m_matrix_complex_dense_data.h"
+#include "m_matrix_complex_sparse_data.h"
+
+namespace M {
+    const MatrixComplex::SparseData::Scalar MatrixComplex::SparseData::zeroValue(0);
+
+    MatrixComplex::SparseData::SparseData(
+            unsigned long      newNumberRows,
+            unsigned long      newNumberColumns,
+            unsigned long long newCapacity
+        ):MatrixSparsePrivate<MatrixComplex::SparseData::Scalar>(
+            newNumberRows,
+            newNumberColumns,
+            newCapacity
+        ) {}
+
+
+    MatrixComplex::SparseData::SparseData(
+            const MatrixComplex::SparseData& other
+        ):MatrixComplex::Data(),
+          MatrixSparsePrivate<MatrixComplex::SparseData::Scalar>(
+            other
+        ) {}
+
+
+    MatrixComplex::SparseData::SparseData(
+            const MatrixComplex::SparseData& other,
+            unsigned long                    newNumberRows,
+            unsigned long                    newNumberColumns
+        ):MatrixSparsePrivate<MatrixComplex::SparseData::Scalar>(
+            other,
+            newNumberRows,
+            newNumberColumns
+        ) {}
+
+
+    MatrixComplex::SparseData::~SparseData() {}
+
+
+    MatrixComplex::SparseData* MatrixComplex::SparseData::create(const MatrixBoolean::SparseData& other) {
+        return createConverted<SparseData>(other, [](MatrixBoolean::Scalar v) {
+            return v ? Scalar(1) : Scalar(0);
+        });
+    }
+
+
+    MatrixComplex::SparseData* MatrixComplex::SparseData::create(const MatrixInteger::SparseData& other) {
+        return createConverted<SparseData>(other, [](MatrixInteger::Scalar v) {
+            return Scalar(static_cast<Real>(v));
+        });
+    }
+
+
+    MatrixComplex::SparseData* MatrixComplex::SparseData::create(const MatrixReal::SparseData& other) {
+        return createConverted<SparseData>(other, [](MatrixReal::Scalar v) {
+            return Scalar(v);
+        });
+    }
+
+
+    MatrixComplex::DenseData* MatrixComplex::SparseData::toDense() const {
+        DenseData* result = DenseData::create(numberRows(), numberColumns());
+        scatterInto(*result);
+
+        return result;
+    }
+
+
+    bool MatrixComplex::SparseData::toFile(const char* filename, Model::DataFileFormat fileFormat) const {
+        return withDenseCopy([=](const DenseData& dense) {
+            return dense.toFile(filename, fileFormat);
+        });
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::combineLeftToRight(
+            const MatrixDensePrivate<MatrixComplex::SparseData::Scalar>& other
+        ) const {
+        SparseData* sparseOther = create(other);
+        Data*       result      = combineLeftToRight(*sparseOther);
+        destroy(sparseOther);
+
+        return result;
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::combineLeftToRight(
+            const MatrixSparsePrivate<MatrixComplex::SparseData::Scalar>& other
+        ) const {
+        SparseData* result = create(
+            std::max(numberRows(), other.numberRows()),
+            numberColumns() + other.numberColumns()
+        );
+
+        combineLeftToRightInto(other, *result);
+        return result;
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::combineTopToBottom(
+            const MatrixDensePrivate<MatrixComplex::SparseData::Scalar>& other
+        ) const {
+        SparseData* sparseOther = create(other);
+        Data*       result      = combineTopToBottom(*sparseOther);
+        destroy(sparseOther);
+
+        return result;
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::combineTopToBottom(
+            const MatrixSparsePrivate<MatrixComplex::SparseData::Scalar>& other
+        ) const {
+        SparseData* result = create(
+            numberRows() + other.numberRows(),
+            std::max(numberColumns(), other.numberColumns())
+        );
+
+        combineTopToBottomInto(other, *result);
+        return result;
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::columnReverse() const {
+        SparseData* result = create(numberRows(), numberColumns());
+        columnReverseInto(*result);
+
+        return result;
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::rowReverse() const {
+        SparseData* result = create(numberRows(), numberColumns());
+        rowReverseInto(*result);
+
+        return result;
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::resizeTo(
+            unsigned long newNumberRows,
+            unsigned long newNumberColumns,
+            bool          alwaysReallocate
+        ) {
+        MatrixComplex::Data* result = this;
+        if (alwaysReallocate) {
+            result = MatrixSparsePrivate<Scalar>::create<SparseData>(*this, newNumberRows, newNumberColumns);
+        } else {
+            resizeInPlace(newNumberRows, newNumberColumns);
+        }
+
+        return result;
+    }
+
+
+    bool MatrixComplex::SparseData::resizeInPlaceTo(unsigned long newNumberRows, unsigned long newNumberColumns) {
+        resizeInPlace(newNumberRows, newNumberColumns);
+        return true;
+    }
+
+
+    MatrixComplex::Scalar MatrixComplex::SparseData::determinant() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.determinant();
+        });
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::inverse() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.inverse();
+        });
+    }
+
+
+    bool MatrixComplex::SparseData::plu(
+            MatrixComplex::Data*& p,
+            MatrixComplex::Data*& l,
+            MatrixComplex::Data*& u
+        ) const {
+        return withDenseCopy([&](const DenseData& dense) {
+            return dense.plu(p, l, u);
+        });
+    }
+
+
+    bool MatrixComplex::SparseData::svd(
+            MatrixComplex::Data*& u,
+            MatrixComplex::Data*& s,
+            MatrixComplex::Data*& vh
+        ) const {
+        return withDenseCopy([&](const DenseData& dense) {
+            return dense.svd(u, s, vh);
+        });
+    }
+
+
+    bool MatrixComplex::SparseData::qr(MatrixComplex::Data*& q, MatrixComplex::Data*& r) const {
+        return withDenseCopy([&](const DenseData& dense) {
+            return dense.qr(q, r);
+        });
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::cholesky() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.cholesky();
+        });
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::upperCholesky() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.upperCholesky();
+        });
+    }
+
+
+    void MatrixComplex::SparseData::hessenberg(MatrixComplex::Data*& qData, MatrixComplex::Data*& hData) const {
+        withDenseCopy([&](const DenseData& dense) {
+            dense.hessenberg(qData, hData);
+            return true;
+        });
+    }
+
+
+    bool MatrixComplex::SparseData::schur(
+            MatrixComplex::Data*& qData,
+            MatrixComplex::Data*& uData,
+            MatrixComplex::Data*& wData
+        ) const {
+        return withDenseCopy([&](const DenseData& dense) {
+            return dense.schur(qData, uData, wData);
+        });
+    }
+
+
+    bool MatrixComplex::SparseData::eigenvectors(
+            bool                   rightEigenvectors,
+            MatrixComplex::Data*&  eigenvalueMatrix,
+            MatrixComplex::Data*&  qMatrix,
+            MatrixComplex::Data*&  uMatrix,
+            MatrixComplex::Data**& eigenvectors
+        ) const {
+        return withDenseCopy([&](const DenseData& dense) {
+            return dense.eigenvectors(rightEigenvectors, eigenvalueMatrix, qMatrix, uMatrix, eigenvectors);
+        });
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::dft() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.dft();
+        });
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::idft() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.idft();
+        });
+    }
+
+
+    Real MatrixComplex::SparseData::pNorm(Integer p) const {
+        Real result;
+
+        const Scalar*      v             = values();
+        unsigned long long numberEntries = numberNonZeros();
+
+        if (p > 0) {
+            if (p == 2) {
+                Real squaredResult = 0;
+                for (unsigned long long i=0 ; i<numberEntries ; ++i) {
+                    squaredResult += v[i].real() * v[i].real() + v[i].imag() * v[i].imag();
+                }
+
+                result = std::sqrt(squaredResult);
+            } else {
+                Real sum = 0;
+                for (unsigned long long i=0 ; i<numberEntries ; ++i) {
+                    sum += M::pow(M::abs(v[i]), p);
+                }
+
+                result = nroot(sum, p).real();
+            }
+        } else {
+            result = NaN;
+        }
+
+        return result;
+    }
+
+
+    Real MatrixComplex::SparseData::oneNorm() const {
+        const Scalar*             v             = values();
+        const unsigned long long* starts        = columnStarts();
+        unsigned long             numberColumns = SparseData::numberColumns();
+
+        Real columnMaximum = 0;
+        for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+            Real               columnSum = 0;
+            unsigned long long end       = starts[columnIndex + 1];
+            for (unsigned long long i=starts[columnIndex] ; i<end ; ++i) {
+                columnSum += M::abs(v[i]);
+            }
+
+            if (columnSum > columnMaximum) {
+                columnMaximum = columnSum;
+            }
+        }
+
+        return columnMaximum;
+    }
+
+
+    Real MatrixComplex::SparseData::infinityNorm() const {
+        const Scalar*        v             = values();
+        const unsigned long* rows          = rowIndexes();
+        unsigned long long   numberEntries = numberNonZeros();
+
+        std::vector<Real> rowSums(numberRows(), Real(0));
+        for (unsigned long long i=0 ; i<numberEntries ; ++i) {
+            rowSums[rows[i]] += M::abs(v[i]);
+        }
+
+        Real rowMaximum = 0;
+        for (Real rowSum : rowSums) {
+            if (rowSum > rowMaximum) {
+                rowMaximum = rowSum;
+            }
+        }
+
+        return rowMaximum;
+    }
+
+
+    bool MatrixComplex::SparseData::equilibrate(MatrixComplex::Data*& row, MatrixComplex::Data*& column) const {
+        return withDenseCopy([&](const DenseData& dense) {
+            return dense.equilibrate(row, column);
+        });
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::solve(const MatrixComplex::DenseData* y) const {
+        return withDenseCopy([=](const DenseData& dense) {
+            return dense.solve(y);
+        });
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::solve(const MatrixComplex::SparseData* y) const {
+        return y->withDenseCopy([=](const DenseData& denseY) {
+            return solve(&denseY);
+        });
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::leastSquares(const MatrixComplex::DenseData* b) const {
+        return withDenseCopy([=](const DenseData& dense) {
+            return dense.leastSquares(b);
+        });
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::leastSquares(const MatrixComplex::SparseData* b) const {
+        return b->withDenseCopy([=](const DenseData& denseB) {
+            return leastSquares(&denseB);
+        });
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::hadamard(
+            const MatrixDensePrivate<MatrixComplex::SparseData::Scalar>& other
+        ) const {
+        return MatrixSparsePrivate<Scalar>::hadamard<SparseData>(other);
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::hadamard(
+            const MatrixSparsePrivate<MatrixComplex::SparseData::Scalar>& other
+        ) const {
+        return MatrixSparsePrivate<Scalar>::hadamard<SparseData>(other);
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::kronecker(
+            const MatrixDensePrivate<MatrixComplex::SparseData::Scalar>& other,
+            MatrixComplex::SparseData::LazyTransform                     otherTransform,
+            const MatrixComplex::SparseData::Scalar&                     scalarMultiplier
+        ) const {
+        SparseData* sparseOther = create(other);
+        Data*       result      = kronecker(*sparseOther, otherTransform, scalarMultiplier);
+        destroy(sparseOther);
+
+        return result;
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::kronecker(
+            const MatrixSparsePrivate<MatrixComplex::SparseData::Scalar>& other,
+            MatrixComplex::SparseData::LazyTransform                      otherTransform,
+            const MatrixComplex::SparseData::Scalar&                      scalarMultiplier
+        ) const {
+        const MatrixSparsePrivate<Scalar>* b      = resolveTransform(other, otherTransform);
+        SparseData*                        result = MatrixSparsePrivate<Scalar>::kronecker<SparseData>(
+            *b,
+            otherTransform == LazyTransform::TRANSPOSE,
+            scalarMultiplier
+        );
+
+        releaseTransposed<SparseData>(b, &other);
+        return result;
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::add(
+            const MatrixDensePrivate<MatrixComplex::SparseData::Scalar>& addend,
+            MatrixComplex::SparseData::LazyTransform                     augendTransform,
+            MatrixComplex::SparseData::LazyTransform                     addendTransform,
+            const Complex&                                               augendScalar,
+            const Complex&                                               addendScalar
+        ) const {
+        // The sum of a sparse and dense matrix is, in general, dense.  We transform and scale the dense addend and
+        // then accumulate our entries into it.
+
+        bool          augendTranspose = isTransposed(augendTransform);
+        bool          addendTranspose = isTransposed(addendTransform);
+        unsigned long augendRows      = augendTranspose ? numberColumns() : numberRows();
+        unsigned long augendColumns   = augendTranspose ? numberRows() : numberColumns();
+        unsigned long addendRows      = addendTranspose ? addend.numberColumns() : addend.numberRows();
+        unsigned long addendColumns   = addendTranspose ? addend.numberRows() : addend.numberColumns();
+
+        if (augendRows != addendRows || augendColumns != addendColumns) {
+            throw Model::IncompatibleMatrixDimensions(augendRows, augendColumns, addendRows, addendColumns);
+        }
+
+        const DenseData& denseAddend = static_cast<const DenseData&>(addend);
+        DenseData*       result      = POLYMORPHIC_CAST<DenseData*>(
+            denseAddend.applyTransformAndScaling(addendTransform, addendScalar)
+        );
+
+        const MatrixSparsePrivate<Scalar>* a = resolveTransform(*this, augendTransform);
+        a->accumulateInto(*result, augendTransform == LazyTransform::TRANSPOSE, augendScalar);
+        releaseTransposed<SparseData>(a, this);
+
+        return result;
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::add(
+            const MatrixSparsePrivate<MatrixComplex::SparseData::Scalar>& addend,
+            MatrixComplex::SparseData::LazyTransform                      augendTransform,
+            MatrixComplex::SparseData::LazyTransform                      addendTransform,
+            const Complex&                                                augendScalar,
+            const Complex&                                                addendScalar
+        ) const {
+        const MatrixSparsePrivate<Scalar>* a = resolveTransform(*this, augendTransform);
+        const MatrixSparsePrivate<Scalar>* b = resolveTransform(addend, addendTransform);
+
+        SparseData* result;
+        try {
+            result = static_cast<const SparseData*>(a)->MatrixSparsePrivate<Scalar>::add<SparseData>(
+                *b,
+                augendTransform == LazyTransform::TRANSPOSE,
+                addendTransform == LazyTransform::TRANSPOSE,
+                augendScalar,
+                addendScalar
+            );
+        } catch (...) {
+            releaseTransposed<SparseData>(a, this);
+            releaseTransposed<SparseData>(b, &addend);
+            throw;
+        }
+
+        releaseTransposed<SparseData>(a, this);
+        releaseTransposed<SparseData>(b, &addend);
+
+        return result;
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::multiply(
+            const MatrixDensePrivate<MatrixComplex::SparseData::Scalar>& multiplicand,
+            MatrixComplex::SparseData::LazyTransform                     multiplierTransform,
+            MatrixComplex::SparseData::LazyTransform                     multiplicandTransform,
+            const MatrixComplex::SparseData::Scalar&                     scalerMultiplier
+        ) const {
+        bool          multiplierTranspose   = isTransposed(multiplierTransform);
+        bool          multiplicandTranspose = isTransposed(multiplicandTransform);
+        unsigned long multiplierRows        = multiplierTranspose ? numberColumns() : numberRows();
+        unsigned long multiplierColumns     = multiplierTranspose ? numberRows() : numberColumns();
+        unsigned long multiplicandRows      = (
+              multiplicandTranspose
+            ? multiplicand.numberColumns()
+            : multiplicand.numberRows()
+        );
+        unsigned long multiplicandColumns   = (
+              multiplicandTranspose
+            ? multiplicand.numberRows()
+            : multiplicand.numberColumns()
+        );
+
+        if (multiplierColumns != multiplicandRows) {
+            throw Model::IncompatibleMatrixDimensions(
+                multiplierRows,
+                multiplierColumns,
+                multiplicandRows,
+                multiplicandColumns
+            );
+        }
+
+        // Conjugation of the dense multiplicand is resolved up-front so the kernel only needs to handle transposes.
+
+        const DenseData& denseMultiplicand = static_cast<const DenseData&>(multiplicand);
+        const DenseData* b                 = &denseMultiplicand;
+        if (multiplicandTransform == LazyTransform::CONJUGATE || multiplicandTransform == LazyTransform::ADJOINT) {
+            b = POLYMORPHIC_CAST<const DenseData*>(
+                denseMultiplicand.applyTransformAndScaling(multiplicandTransform, Scalar(1))
+            );
+        }
+
+        const MatrixSparsePrivate<Scalar>* a = resolveTransform(*this, multiplierTransform);
+
+        DenseData* result = DenseData::create(multiplierRows, multiplicandColumns);
+        a->multiplyDenseInto(
+            *b,
+            multiplierTransform == LazyTransform::TRANSPOSE,
+            multiplicandTransform == LazyTransform::TRANSPOSE,
+            scalerMultiplier,
+            *result
+        );
+
+        releaseTransposed<SparseData>(a, this);
+        if (b != &denseMultiplicand) {
+            DenseData::destroy(const_cast<DenseData*>(b));
+        }
+
+        return result;
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::multiply(
+            const MatrixSparsePrivate<MatrixComplex::SparseData::Scalar>& multiplicand,
+            MatrixComplex::SparseData::LazyTransform                      multiplierTransform,
+            MatrixComplex::SparseData::LazyTransform                      multiplicandTransform,
+            const MatrixComplex::SparseData::Scalar&                      scalerMultiplier
+        ) const {
+        const MatrixSparsePrivate<Scalar>* a = resolveTransform(*this, multiplierTransform);
+        const MatrixSparsePrivate<Scalar>* b = resolveTransform(multiplicand, multiplicandTransform);
+
+        SparseData* result;
+        try {
+            result = static_cast<const SparseData*>(a)->MatrixSparsePrivate<Scalar>::multiply<SparseData>(
+                *b,
+                multiplierTransform == LazyTransform::TRANSPOSE,
+                multiplicandTransform == LazyTransform::TRANSPOSE,
+                scalerMultiplier
+            );
+        } catch (...) {
+            releaseTransposed<SparseData>(a, this);
+            releaseTransposed<SparseData>(b, &multiplicand);
+            throw;
+        }
+
+        releaseTransposed<SparseData>(a, this);
+        releaseTransposed<SparseData>(b, &multiplicand);
+
+        return result;
+    }
+
+
+    MatrixReal::Data* MatrixComplex::SparseData::real() const {
+        return MatrixSparsePrivate<Real>::createConverted<MatrixReal::SparseData>(*this, [](const Scalar& v) {
+            return v.real();
+        });
+    }
+
+
+    MatrixReal::Data* MatrixComplex::SparseData::imag() const {
+        return MatrixSparsePrivate<Real>::createConverted<MatrixReal::SparseData>(*this, [](const Scalar& v) {
+            return v.imag();
+        });
+    }
+
+
+    bool MatrixComplex::SparseData::isEqualTo(
+            const MatrixDensePrivate<MatrixComplex::SparseData::Scalar>& other
+        ) const {
+        return MatrixSparsePrivate<Scalar>::isEqualTo(other);
+    }
+
+
+    bool MatrixComplex::SparseData::isEqualTo(
+            const MatrixSparsePrivate<MatrixComplex::SparseData::Scalar>& other
+        ) const {
+        return MatrixSparsePrivate<Scalar>::isEqualTo(other);
+    }
+
+
+    MatrixComplex::Data* MatrixComplex::SparseData::applyTransformAndScaling(
+            MatrixComplex::SparseData::LazyTransform transform,
+            const MatrixComplex::SparseData::Scalar& scaleFactor
+        ) const {
+        bool        conjugate = (transform == LazyTransform::CONJUGATE || transform == LazyTransform::ADJOINT);
+        SparseData* result    = transformAndScale<SparseData>(
+            isTransposed(transform),
+            conjugate ? Scalar(1) : scaleFactor
+        );
+
+        if (conjugate) {
+            Scalar*            v             = result->values();
+            unsigned long long numberEntries = result->numberNonZeros();
+            for (unsigned long long i=0 ; i<numberEntries ; ++i) {
+                v[i] = scaleFactor * v[i].conj();
+            }
+        }
+
+        return result;
+    }
+
+
+    int MatrixComplex::SparseData::relativeOrder(const MatrixComplex::Data& other) const {
+        int result;
+
+        if (other.matrixType() == MatrixType::SPARSE) {
+            const SparseData& sparseOther = POLYMORPHIC_CAST<const SparseData&>(other);
+            result = MatrixSparsePrivate<Scalar>::relativeOrder(sparseOther);
+        } else {
+            result = static_cast<int>(matrixType()) - static_cast<int>(other.matrixType());
+        }
+
+        return result;
+    }
+
+
+    bool MatrixComplex::SparseData::isTransposed(MatrixComplex::SparseData::LazyTransform transform) {
+        return transform == LazyTransform::TRANSPOSE || transform == LazyTransform::ADJOINT;
+    }
+
+
+    const MatrixSparsePrivate<MatrixComplex::SparseData::Scalar>* MatrixComplex::SparseData::resolveTransform(
+            const MatrixSparsePrivate<MatrixComplex::SparseData::Scalar>& matrix,
+            MatrixComplex::SparseData::LazyTransform&                     transform
+        ) {
+        const MatrixSparsePrivate<Scalar>* result = &matrix;
+
+        if (transform == LazyTransform::CONJUGATE || transform == LazyTransform::ADJOINT) {
+            const SparseData& sparseMatrix = static_cast<const SparseData&>(matrix);
+            result    = POLYMORPHIC_CAST<const SparseData*>(
+                sparseMatrix.applyTransformAndScaling(transform, Scalar(1))
+            );
+            transform = LazyTransform::NONE;
+        }
+
+        return result;
+    }
+}
@@ -31,6 +31,10 @@
 #define M_MATRIX_DENSE_PRIVATE_H
 
 #include <new>
+#include <cstring>
+#include <algorithm>
+#include <utility>
+#include <cassert>
 
 #include "m_matrix_dense_private_base.h"
 
@@ -167,6 +171,153 @@ namespace M {
                 return reinterpret_cast<C*>(voidData());
             }
 
+            /**
+             * Method you can use to count the number of non-zero coefficients in this matrix.  This method visits
+             * every coefficient.
+             *
+             * \return Returns the number of non-zero coefficients.
+             */
+            unsigned long long numberNonZeros() const {
+                unsigned long      nr            = numberRows();
+                unsigned long      nc            = numberColumns();
+                const C*           d             = data();
+                unsigned long long columnSpacing = columnSpacingInMemory();
+
+                unsigned long long result = 0;
+                for (unsigned long columnIndex=0 ; columnIndex<nc ; ++columnIndex) {
+                    const C* column = d + columnSpacing * columnIndex;
+                    for (unsigned long rowIndex=0 ; rowIndex<nr ; ++rowIndex) {
+                        if (column[rowIndex] != C(0)) {
+                            ++result;
+                        }
+                    }
+                }
+
+                return result;
+            }
+
+            /**
+             * Method you can use to scale every coefficient of this matrix in place.  The padding rows are not
+             * touched and remain zero.
+             *
+             * \param[in] scaleFactor The scale factor to apply to each coefficient.
+             */
+            void scaleInPlace(C scaleFactor) {
+                unsigned long      nr            = numberRows();
+                unsigned long      nc            = numberColumns();
+                C*                 d             = data();
+                unsigned long long columnSpacing = columnSpacingInMemory();
+
+                for (unsigned long columnIndex=0 ; columnIndex<nc ; ++columnIndex) {
+                    C* column = d + columnSpacing * columnIndex;
+                    for (unsigned long rowIndex=0 ; rowIndex<nr ; ++rowIndex) {
+                        column[rowIndex] *= scaleFactor;
+                    }
+                }
+            }
+
+            /**
+             * Method you can use to transpose this matrix in place.  The matrix must be square.
+             */
+            void transposeInPlace() {
+                assert(numberRows() == numberColumns());
+
+                unsigned long      n             = numberRows();
+                C*                 d             = data();
+                unsigned long long columnSpacing = columnSpacingInMemory();
+
+                for (unsigned long columnIndex=1 ; columnIndex<n ; ++columnIndex) {
+                    C* column = d + columnSpacing * columnIndex;
+                    for (unsigned long rowIndex=0 ; rowIndex<columnIndex ; ++rowIndex) {
+                        std::swap(column[rowIndex], d[columnSpacing * rowIndex + columnIndex]);
+                    }
+                }
+            }
+
+            /**
+             * Method you can use to apply a kernel to every column of this matrix.  The kernel is called once per
+             * column so that vector math routines can process an entire column in a single call.  Padding rows in the
+             * destination are zeroed.
+             *
+             * \param[in] destination              Pointer to the destination matrix data.  The destination must have
+             *                                     the same number of rows and columns as this matrix.
+             *
+             * \param[in] destinationColumnSpacing The spacing between destination columns, in entries.
+             *
+             * \param[in] kernel                   The kernel to apply.  The kernel receives the number of rows, a
+             *                                     pointer to the source column, and a pointer to the destination
+             *                                     column.
+             */
+            template<typename R, typename F> void applyColumnKernel(
+                    R*                 destination,
+                    unsigned long long destinationColumnSpacing,
+                    F                  kernel
+                ) const {
+                unsigned long      nr            = numberRows();
+                unsigned long      nc            = numberColumns();
+                const C*           s             = data();
+                unsigned long long columnSpacing = columnSpacingInMemory();
+
+                for (unsigned long columnIndex=0 ; columnIndex<nc ; ++columnIndex) {
+                    R* d = destination + destinationColumnSpacing * columnIndex;
+
+                    kernel(nr, s + columnSpacing * columnIndex, d);
+                    std::fill(d + nr, d + destinationColumnSpacing, R(0));
+                }
+            }
+
+            /**
+             * Method you can use to copy an evenly strided submatrix out of this matrix.  Columns with a row stride
+             * of 1 are copied as a single block.  The indexes must lie within this matrix.
+             *
+             * \param[in] firstRow      The zero based index of the first row to copy.
+             *
+             * \param[in] rowStride     The signed distance between successive rows.
+             *
+             * \param[in] numberRows    The number of rows to copy.
+             *
+             * \param[in] firstColumn   The zero based index of the first column to copy.
+             *
+             * \param[in] columnStride  The signed distance between successive columns.
+             *
+             * \param[in] numberColumns The number of columns to copy.
+             *
+             * \return Returns a newly allocated instance holding the submatrix.
+             */
+            template<typename D> D* copySubmatrix(
+                    unsigned long firstRow,
+                    long long     rowStride,
+                    unsigned long numberRows,
+                    unsigned long firstColumn,
+                    long long     columnStride,
+                    unsigned long numberColumns
+                ) const {
+                D*                 result                   = createUninitialized<D>(numberRows, numberColumns);
+                unsigned long long sourceColumnSpacing      = columnSpacingInMemory();
+                unsigned long long destinationColumnSpacing = result->columnSpacingInMemory();
+                const C*           s                        = data() + firstRow;
+                C*                 d                        = result->data();
+
+                for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+                    long long sourceColumnIndex =   static_cast<long long>(firstColumn)
+                                                  + columnStride * static_cast<long long>(columnIndex);
+                    const C*  sourceColumn      = s + sourceColumnSpacing * sourceColumnIndex;
+                    C*        destinationColumn = d + destinationColumnSpacing * columnIndex;
+
+                    if (rowStride == 1) {
+                        std::memcpy(static_cast<void*>(destinationColumn), sourceColumn, sizeof(C) * numberRows);
+                    } else {
+                        for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                            destinationColumn[rowIndex] = sourceColumn[rowStride * static_cast<long long>(rowIndex)];
+                        }
+                    }
+
+                    std::fill(destinationColumn + numberRows, destinationColumn + destinationColumnSpacing, C(0));
+                }
+
+                return result;
+            }
+
             /**
              * Method you can use to destroy a previously allocated instance derived from this class.
              *
@@ -201,6 +352,42 @@ namespace M {
                 return new(p) D(newNumberRows, newNumberColumns, newAllocation, rawDataBaseAddress);
             }
 
+            /**
+             * Method you can call to allocate an instance derived from this template class whose raw data lives in a
+             * memory mapped region.  The instance takes ownership of the region.  The raw data must use the same
+             * column spacing as a conventionally allocated instance.
+             *
+             * \param[in] newNumberRows    The new number of rows.
+             *
+             * \param[in] newNumberColumns The new number of columns.
+             *
+             * \param[in] regionAddress    The base address of the mapped region.
+             *
+             * \param[in] regionSize       The size of the mapped region, in bytes.
+             *
+             * \param[in] dataOffset       The offset from the start of the region to the raw data, in bytes.
+             */
+            template<typename D> static D* createMapped(
+                    unsigned long      newNumberRows,
+                    unsigned long      newNumberColumns,
+                    void*              regionAddress,
+                    unsigned long long regionSize,
+                    unsigned long long dataOffset
+                ) {
+                void* unusedDataAddress;
+                void* p = allocateMemory(unusedDataAddress, 0, sizeof(D));
+
+                D* result = new(p) D(
+                    newNumberRows,
+                    newNumberColumns,
+                    regionSize - dataOffset,
+                    reinterpret_cast<std::uint8_t*>(regionAddress) + dataOffset
+                );
+
+                result->adoptMappedRegion(regionAddress, regionSize);
+                return result;
+            }
+
             /**
              * Method you can call to allocate an instance derived from this template class.
              *
@@ -56,6 +56,10 @@ namespace M {
             newNumberColumns
         ),currentCoefficientSizeInBytes(
             coefficientSizeInBytes
+        ),mappedRegionBaseAddress(
+            nullptr
+        ),mappedRegionSizeInBytes(
+            0
         ) {
         assert(
                memoryColumnAlignmentRequirementBytes == 1
@@ -86,6 +90,10 @@ namespace M {
             other.currentNumberColumns
         ),currentCoefficientSizeInBytes(
             other.currentCoefficientSizeInBytes
+        ),mappedRegionBaseAddress(
+            nullptr
+        ),mappedRegionSizeInBytes(
+            0
         ) {
         assert(
                memoryColumnAlignmentRequirementBytes == 1
@@ -127,6 +135,10 @@ namespace M {
             newNumberColumns
         ),currentCoefficientSizeInBytes(
             other.currentCoefficientSizeInBytes
+        ),mappedRegionBaseAddress(
+            nullptr
+        ),mappedRegionSizeInBytes(
+            0
         ) {
         assert(
                memoryColumnAlignmentRequirementBytes == 1
@@ -173,7 +185,11 @@ namespace M {
     }
 
 
-    MatrixDensePrivateBase::~MatrixDensePrivateBase() {}
+    MatrixDensePrivateBase::~MatrixDensePrivateBase() {
+        if (mappedRegionBaseAddress != nullptr) {
+            unmapFile(mappedRegionBaseAddress, mappedRegionSizeInBytes);
+        }
+    }
 
 
     unsigned long long MatrixDensePrivateBase::columnSpacingInMemory() const {
@@ -182,6 +198,14 @@ namespace M {
     }
 
 
+    void MatrixDensePrivateBase::adoptMappedRegion(void* baseAddress, unsigned long long sizeInBytes) {
+        assert(mappedRegionBaseAddress == nullptr);
+
+        mappedRegionBaseAddress = baseAddress;
+        mappedRegionSizeInBytes = sizeInBytes;
+    }
+
+
     void MatrixDensePrivateBase::zeroMatrix() {
         unsigned long long matrixSizeInBytes = minimumRequiredAllocation(
             currentNumberRows,
@@ -417,6 +441,13 @@ namespace M {
                 destination += currentColumnSizeInBytes;
             }
         }
+
+        // Keep the unused tail of the allocation cleared so that resizeInPlace can grow into it.
+
+        unsigned long long usedBytes = currentColumnSizeInBytes * currentNumberColumns;
+        if (currentAllocatedSizeInBytes > usedBytes) {
+            std::memset(rawData.byte + usedBytes, 0, currentAllocatedSizeInBytes - usedBytes);
+        }
     }
 
 
@@ -222,6 +222,16 @@ namespace M {
                 return rawData.byte;
             }
 
+            /**
+             * Method you can use to hand ownership of a memory mapped region to this instance.  The region will be
+             * unmapped when this instance is destroyed.  The raw data must lie within the region.
+             *
+             * \param[in] baseAddress The base address of the mapped region.
+             *
+             * \param[in] sizeInBytes The size of the mapped region, in bytes.
+             */
+            void adoptMappedRegion(void* baseAddress, unsigned long long sizeInBytes);
+
             /**
              * Method you can use to quickly zero out the entire matrix allocated memory.
              */
@@ -338,6 +348,17 @@ namespace M {
              * The size of a single coefficient, in bytes.
              */
             unsigned currentCoefficientSizeInBytes;
+
+            /**
+             * The base address of a memory mapped region backing the raw data.  The value is a null pointer if the
+             * raw data was allocated with the class instance.
+             */
+            void* mappedRegionBaseAddress;
+
+            /**
+             * The size of the memory mapped region, in bytes.
+             */
+            unsigned long long mappedRegionSizeInBytes;
     };
 }
 
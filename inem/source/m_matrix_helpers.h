@@ -151,6 +151,72 @@ namespace M {
         return result;
     }
 
+    /**
+     * Method you can use to describe a range of row or column indexes as a first index, a stride, and a count.  Only
+     * integer ranges that lie entirely within the matrix can be described this way.  Other ranges must be traversed
+     * entry by entry using \ref M::atIIHelper which will also report any invalid index.
+     *
+     * \param[in]  range         The range to be described.
+     *
+     * \param[in]  numberEntries The number of rows or columns in the source matrix.
+     *
+     * \param[out] first         The zero based index of the first entry in the range.
+     *
+     * \param[out] stride        The signed distance between successive entries.  Ranges containing a single entry
+     *                           always report a stride of 1.
+     *
+     * \param[out] count         The number of entries in the range.
+     *
+     * \return Returns true if the range could be described.  Returns false if the range is not an integer range or
+     *         extends outside of the source matrix.
+     */
+    template<typename R> bool stridedRangeHelper(
+            const R&       range,
+            unsigned long  numberEntries,
+            unsigned long& first,
+            long long&     stride,
+            unsigned long& count
+        ) {
+        bool success = false;
+
+        Integer rangeSize = range.size();
+        if (rangeSize > 0                                       &&
+            range.first().valueType() == ValueType::INTEGER     &&
+            range.second().valueType() == ValueType::INTEGER    &&
+            range.last().valueType() == ValueType::INTEGER         ) {
+            Integer firstIndex = range.first().toInteger();
+            Integer increment  = rangeSize > 1 ? range.second().toInteger() - firstIndex : 1;
+            Integer lastIndex  = firstIndex + increment * (rangeSize - 1);
+
+            if (firstIndex >= 1                                          &&
+                lastIndex >= 1                                           &&
+                static_cast<unsigned long>(firstIndex) <= numberEntries  &&
+                static_cast<unsigned long>(lastIndex) <= numberEntries      ) {
+                first   = static_cast<unsigned long>(firstIndex - 1);
+                stride  = static_cast<long long>(increment);
+                count   = static_cast<unsigned long>(rangeSize);
+                success = true;
+            }
+        }
+
+        return success;
+    }
+
+    /**
+     * Method you can use to locate an entry of a range described by \ref M::stridedRangeHelper.
+     *
+     * \param[in] first  The zero based index of the first entry in the range.
+     *
+     * \param[in] stride The signed distance between successive entries.
+     *
+     * \param[in] index  The zero based position of the entry within the range.
+     *
+     * \return Returns the zero based index of the entry.
+     */
+    inline unsigned long stridedIndex(unsigned long first, long long stride, unsigned long index) {
+        return static_cast<unsigned long>(static_cast<long long>(first) + stride * static_cast<long long>(index));
+    }
+
     /**
      * Method you can use to obtain a submatrix of this matrix, by iterable values.  This method will throw an
      * exception if the specified row iterable or column iterable is invalid.
@@ -44,13 +44,16 @@
 #include "m_matrix_boolean.h"
 #include "m_matrix_boolean_data.h"
 #include "m_matrix_boolean_dense_data.h"
+#include "m_matrix_boolean_sparse_data.h"
 #include "m_matrix_integer.h"
 #include "m_matrix_complex.h"
 #include "m_matrix_complex_data.h"
 #include "m_matrix_complex_dense_data.h"
+#include "m_matrix_complex_sparse_data.h"
 #include "m_matrix_real.h"
 #include "m_matrix_real_data.h"
 #include "m_matrix_real_dense_data.h"
+#include "m_matrix_real_sparse_data.h"
 #include "m_matrix_integer.h"
 #include "m_matrix_integer_data.h"
 #include "m_matrix_integer_dense_data.h"
@@ -167,7 +170,7 @@ namespace M {
 
         if (row > 0 && static_cast<unsigned long>(row) <= currentData->numberRows()          &&
             column > 0 && static_cast<unsigned long>(column) <= currentData->numberColumns()    ) {
-            result = currentData->at(row - 1, column - 1);
+            result = static_cast<const Data*>(currentData)->at(row - 1, column - 1);
         }
 
         return result;
@@ -194,6 +197,11 @@ namespace M {
     }
 
 
+    MatrixInteger MatrixInteger::sparse(Index numberRows, Index numberColumns) {
+        return MatrixInteger(SparseData::create(numberRows, numberColumns));
+    }
+
+
     MatrixInteger MatrixInteger::diagonalEntries() const {
         unsigned long numberDiagnonalEntries = std::min(currentData->numberRows(), currentData->numberColumns());
         MatrixInteger result(numberDiagnonalEntries, 1);
@@ -201,7 +209,7 @@ namespace M {
         Scalar* data = result.currentData->data();
 
         for (unsigned index=0 ; index<numberDiagnonalEntries ; ++index) {
-            Scalar v = currentData->at(index, index);
+            Scalar v = static_cast<const Data*>(currentData)->at(index, index);
             data[index] = v;
         }
 
@@ -210,6 +218,7 @@ namespace M {
 
 
     MatrixInteger MatrixInteger::diagonal() const {
+        const Data*   sourceData    = currentData;
         unsigned long numberRows    = currentData->numberRows();
         unsigned long numberColumns = currentData->numberColumns();
         DenseData*    result        = nullptr;
@@ -218,11 +227,11 @@ namespace M {
             throw Model::InvalidMatrixDimensions(numberRows, numberColumns);
         } else {
             unsigned long numberValues = std::max(numberRows, numberColumns);
-            Scalar*       data         = currentData->data();
+            bool          isRowVector  = (numberRows == 1);
 
             result = DenseData::create(numberValues, numberValues);
             for (unsigned i=0 ; i<numberValues ; ++i) {
-                Scalar  v = data[i];
+                Scalar  v = isRowVector ? sourceData->at(0, i) : sourceData->at(i, 0);
                 Scalar* d = &(result->at(i, i));
                 *d = v;
             }
@@ -244,7 +253,7 @@ namespace M {
             unsigned long      rowIndex    = i / numberColumns;
             unsigned long      columnIndex = i % numberColumns;
 
-            result = currentData->at(rowIndex, columnIndex);
+            result = static_cast<const Data*>(currentData)->at(rowIndex, columnIndex);
         }
 
         return result;
@@ -322,7 +331,7 @@ namespace M {
             if (column < 1 || static_cast<unsigned long>(column) > numberColumns) {
                 throw Model::InvalidColumn(column, numberColumns);
             } else {
-                result = currentData->at(row - 1, column - 1);
+                result = static_cast<const Data*>(currentData)->at(row - 1, column - 1);
             }
         }
 
@@ -333,7 +342,7 @@ namespace M {
     MatrixInteger::Scalar MatrixInteger::at(MatrixInteger::Index index) const {
         applyLazyTransformsAndScaling();
 
-        const Scalar* result = nullptr;
+        Scalar result = Scalar(0);
 
         unsigned long      numberRows         = currentData->numberRows();
         unsigned long      numberColumns      = currentData->numberColumns();
@@ -346,10 +355,10 @@ namespace M {
             unsigned long      rowIndex    = i / numberColumns;
             unsigned long      columnIndex = i % numberColumns;
 
-            result = &(currentData->at(rowIndex, columnIndex));
+            result = static_cast<const Data*>(currentData)->at(rowIndex, columnIndex);
         }
 
-        return *result;
+        return result;
     }
 
     MatrixInteger::Scalar MatrixInteger::at(Real row, MatrixInteger::Index column) const {
@@ -782,7 +791,41 @@ namespace M {
 
 
     MatrixInteger MatrixInteger::at(const Range& rowRange, const Range& columnRange) const {
-        return atIIHelper(*this, rowRange, columnRange);
+        applyLazyTransformsAndScaling();
+
+        unsigned long numberRows    = currentData->numberRows();
+        unsigned long numberColumns = currentData->numberColumns();
+        unsigned long firstRow;
+        long long     rowStride;
+        unsigned long rowCount;
+        unsigned long firstColumn;
+        long long     columnStride;
+        unsigned long columnCount;
+
+        if (currentData->matrixType() == MatrixType::DENSE                                        &&
+            stridedRangeHelper(rowRange, numberRows, firstRow, rowStride, rowCount)                &&
+            stridedRangeHelper(columnRange, numberColumns, firstColumn, columnStride, columnCount)    ) {
+            bool allRows    = firstRow == 0 && rowStride == 1 && rowCount == numberRows;
+            bool allColumns = firstColumn == 0 && columnStride == 1 && columnCount == numberColumns;
+
+            if (allRows && allColumns) {
+                return *this;
+            } else {
+                const DenseData* denseData = POLYMORPHIC_CAST<const DenseData*>(currentData);
+                return MatrixInteger(
+                    denseData->copySubmatrix<DenseData>(
+                        firstRow,
+                        rowStride,
+                        rowCount,
+                        firstColumn,
+                        columnStride,
+                        columnCount
+                    )
+                );
+            }
+        } else {
+            return atIIHelper(*this, rowRange, columnRange);
+        }
     }
 
 
@@ -1543,6 +1586,7 @@ namespace M {
 
     const MatrixInteger::Scalar* MatrixInteger::pointer(MatrixInteger::Index row, MatrixInteger::Index column) const {
         applyLazyTransformsAndScaling();
+        convertToDenseDataStore();
 
         const Scalar* result = nullptr;
 
@@ -1659,9 +1703,7 @@ namespace M {
             resultData = currentData->combineLeftToRight(*POLYMORPHIC_CAST<const DenseData*>(other.currentData));
         } else {
             assert(other.currentData->matrixType() == Matrix::MatrixType::SPARSE);
-            assert(false); // FIXME
-            resultData = nullptr;
-//            resultData = currentData->combineLeftToRight(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            resultData = currentData->combineLeftToRight(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
         }
 
         return MatrixInteger(resultData);
@@ -1677,9 +1719,7 @@ namespace M {
             resultData = currentData->combineTopToBottom(*POLYMORPHIC_CAST<const DenseData*>(other.currentData));
         } else {
             assert(other.currentData->matrixType() == Matrix::MatrixType::SPARSE);
-            assert(false); // FIXME
-            resultData = nullptr;
-//            resultData = currentData->combineTopToBottom(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            resultData = currentData->combineTopToBottom(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
         }
 
         return MatrixInteger(resultData);
@@ -1729,8 +1769,7 @@ namespace M {
             result = currentData->hadamard(*POLYMORPHIC_CAST<const DenseData*>(other.currentData));
         } else {
             assert(other.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
-//            result = currentData->hadamard(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            result = currentData->hadamard(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
         }
 
         return MatrixInteger(result);
@@ -1749,8 +1788,11 @@ namespace M {
             );
         } else {
             assert(other.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
-//            result = currentData->hadamard(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            result = currentData->kronecker(
+                *POLYMORPHIC_CAST<const SparseData*>(other.currentData),
+                other.pendingTranspose,
+                other.pendingScalarMultiplierValue
+            );
         }
 
         return MatrixInteger(result);
@@ -1762,18 +1804,101 @@ namespace M {
     }
 
 
-    MatrixInteger::Scalar* MatrixInteger::data() {
+    unsigned long long MatrixInteger::numberStoredCoefficients() const {
+        unsigned long long result;
+
+        if (currentData->matrixType() == MatrixType::SPARSE) {
+            result = POLYMORPHIC_CAST<const SparseData*>(currentData)->numberNonZeros();
+        } else {
+            result = static_cast<unsigned long long>(currentData->numberRows()) * currentData->numberColumns();
+        }
+
+        return result;
+    }
+
+
+    MatrixInteger MatrixInteger::toSparse() const {
+        applyLazyTransformsAndScaling();
+
+        Data* result;
+        if (currentData->matrixType() == MatrixType::SPARSE) {
+            result = currentData->clone();
+        } else {
+            result = SparseData::create(*POLYMORPHIC_CAST<const DenseData*>(currentData));
+        }
+
+        return MatrixInteger(result);
+    }
+
+
+    MatrixInteger MatrixInteger::toDense() const {
         applyLazyTransformsAndScaling();
+
+        Data* result;
+        if (currentData->matrixType() == MatrixType::SPARSE) {
+            result = POLYMORPHIC_CAST<const SparseData*>(currentData)->toDense();
+        } else {
+            result = currentData->clone();
+        }
+
+        return MatrixInteger(result);
+    }
+
+
+    MatrixInteger::Scalar* MatrixInteger::data() {
+        convertToDenseDataStore();
+
+        currentData->lock();
+        if (currentData->referenceCount() > 1) {
+            Data* oldDataStore = currentData;
+            currentData = oldDataStore->clone();
+
+            oldDataStore->unlock();
+            releaseDataStore(oldDataStore);
+        } else {
+            currentData->unlock();
+        }
+
         return currentData->data();
     }
 
 
     const MatrixInteger::Scalar* MatrixInteger::data() const {
-        applyLazyTransformsAndScaling();
+        convertToDenseDataStore();
         return currentData->data();
     }
 
 
+    unsigned long long MatrixInteger::columnSpacingInMemory() const {
+        convertToDenseDataStore();
+        return POLYMORPHIC_CAST<const DenseData*>(currentData)->columnSpacingInMemory();
+    }
+
+
+    MatrixInteger::Scalar* MatrixInteger::columnData(MatrixInteger::Index column) {
+        Scalar*       d             = data();
+        unsigned long numberColumns = currentData->numberColumns();
+
+        if (column < 1 || static_cast<unsigned long>(column) > numberColumns) {
+            throw Model::InvalidColumn(column, numberColumns);
+        }
+
+        return d + POLYMORPHIC_CAST<const DenseData*>(currentData)->columnSpacingInMemory() * (column - 1);
+    }
+
+
+    const MatrixInteger::Scalar* MatrixInteger::columnData(MatrixInteger::Index column) const {
+        const Scalar* d             = data();
+        unsigned long numberColumns = currentData->numberColumns();
+
+        if (column < 1 || static_cast<unsigned long>(column) > numberColumns) {
+            throw Model::InvalidColumn(column, numberColumns);
+        }
+
+        return d + POLYMORPHIC_CAST<const DenseData*>(currentData)->columnSpacingInMemory() * (column - 1);
+    }
+
+
     MatrixInteger MatrixInteger::randomInteger64(PerThread& pt, Integer numberRows, Integer numberColumns) {
         return MatrixInteger(DenseData::randomInteger64(pt, numberRows, numberColumns));
     }
@@ -1869,28 +1994,66 @@ namespace M {
 
 
     MatrixInteger& MatrixInteger::operator+=(const MatrixInteger& v) {
-        currentData->lock();
-        v.currentData->lock();
+        bool addendIsDense = v.currentData->matrixType() == MatrixType::DENSE;
+        if (canAccumulateInPlace(v.currentData) && (addendIsDense || pendingScalarMultiplierValue == Scalar(1))) {
+            ReferenceCounter::lockPair(currentData, v.currentData);
+
+            try {
+                DenseData* augend = POLYMORPHIC_CAST<DenseData*>(currentData);
+                if (addendIsDense) {
+                    augend->scaleAccumulate(
+                        *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
+                        v.pendingTranspose,
+                        pendingScalarMultiplierValue,
+                        v.pendingScalarMultiplierValue
+                    );
+                } else {
+                    augend->scaleAccumulate(
+                        *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
+                        v.pendingTranspose,
+                        pendingScalarMultiplierValue,
+                        v.pendingScalarMultiplierValue
+                    );
+                }
+            } catch (...) {
+                v.currentData->unlock();
+                currentData->unlock();
+                throw;
+            }
+
+            v.currentData->unlock();
+            currentData->unlock();
+
+            pendingScalarMultiplierValue = Scalar(1);
+            return *this;
+        }
+
+        ReferenceCounter::lockPair(currentData, v.currentData);
 
         Data* newDataStore = nullptr;
-        if (v.currentData->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->add(
-                *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
-                pendingTranspose,
-                v.pendingTranspose,
-                pendingScalarMultiplierValue,
-                v.pendingScalarMultiplierValue
-            );
-        } else {
-            assert(v.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false);
-//            newDataStore = currentData->add(
-//                *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
-//                pendingTransform,
-//                v.pendingTransform,
-//                pendingScalarMultiplierValue,
-//                v.pendingScalarMultiplierValue
-//            );
+        try {
+            if (v.currentData->matrixType() == MatrixType::DENSE) {
+                newDataStore = currentData->add(
+                    *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarMultiplierValue,
+                    v.pendingScalarMultiplierValue
+                );
+            } else {
+                assert(v.currentData->matrixType() == MatrixType::SPARSE);
+                newDataStore = currentData->add(
+                    *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarMultiplierValue,
+                    v.pendingScalarMultiplierValue
+                );
+            }
+        } catch (...) {
+            v.currentData->unlock();
+            currentData->unlock();
+            throw;
         }
 
         v.currentData->unlock();
@@ -1904,28 +2067,66 @@ namespace M {
 
 
     MatrixInteger& MatrixInteger::operator-=(const MatrixInteger& v) {
-        currentData->lock();
-        v.currentData->lock();
+        bool addendIsDense = v.currentData->matrixType() == MatrixType::DENSE;
+        if (canAccumulateInPlace(v.currentData) && (addendIsDense || pendingScalarMultiplierValue == Scalar(1))) {
+            ReferenceCounter::lockPair(currentData, v.currentData);
+
+            try {
+                DenseData* augend = POLYMORPHIC_CAST<DenseData*>(currentData);
+                if (addendIsDense) {
+                    augend->scaleAccumulate(
+                        *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
+                        v.pendingTranspose,
+                        pendingScalarMultiplierValue,
+                        -v.pendingScalarMultiplierValue
+                    );
+                } else {
+                    augend->scaleAccumulate(
+                        *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
+                        v.pendingTranspose,
+                        pendingScalarMultiplierValue,
+                        -v.pendingScalarMultiplierValue
+                    );
+                }
+            } catch (...) {
+                v.currentData->unlock();
+                currentData->unlock();
+                throw;
+            }
+
+            v.currentData->unlock();
+            currentData->unlock();
+
+            pendingScalarMultiplierValue = Scalar(1);
+            return *this;
+        }
+
+        ReferenceCounter::lockPair(currentData, v.currentData);
 
         Data* newDataStore = nullptr;
-        if (v.currentData->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->add(
-                *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
-                pendingTranspose,
-                v.pendingTranspose,
-                pendingScalarMultiplierValue,
-                -v.pendingScalarMultiplierValue
-            );
-        } else {
-            assert(v.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false);
-//            newDataStore = currentData->add(
-//                *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
-//                pendingTransform,
-//                v.pendingTransform,
-//                pendingScalarMultiplierValue,
-//                -v.pendingScalarMultiplierValue
-//            );
+        try {
+            if (v.currentData->matrixType() == MatrixType::DENSE) {
+                newDataStore = currentData->add(
+                    *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarMultiplierValue,
+                    -v.pendingScalarMultiplierValue
+                );
+            } else {
+                assert(v.currentData->matrixType() == MatrixType::SPARSE);
+                newDataStore = currentData->add(
+                    *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarMultiplierValue,
+                    -v.pendingScalarMultiplierValue
+                );
+            }
+        } catch (...) {
+            v.currentData->unlock();
+            currentData->unlock();
+            throw;
         }
 
         v.currentData->unlock();
@@ -1944,26 +2145,31 @@ namespace M {
         Real  scalarMultiplier = pendingScalarMultiplierValue * v.pendingScalarMultiplierValue;
         Data* multiplicand     = v.currentData;
 
-        currentData->lock();
-
-        multiplicand->lock();
-        if (multiplicand->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->multiply(
-                static_cast<const DenseData&>(*multiplicand),
-                pendingTranspose,
-                v.pendingTranspose,
-                scalarMultiplier
-            );
-        } else {
-            assert(multiplicand->matrixType() == MatrixType::SPARSE);
-
-            newDataStore = currentData->multiply(
-                static_cast<const SparseData&>(*multiplicand),
-                pendingTranspose,
-                v.pendingTranspose,
-                scalarMultiplier
-            );
+        ReferenceCounter::lockPair(currentData, multiplicand);
+        try {
+            if (multiplicand->matrixType() == MatrixType::DENSE) {
+                newDataStore = currentData->multiply(
+                    static_cast<const DenseData&>(*multiplicand),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    scalarMultiplier
+                );
+            } else {
+                assert(multiplicand->matrixType() == MatrixType::SPARSE);
+
+                newDataStore = currentData->multiply(
+                    static_cast<const SparseData&>(*multiplicand),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    scalarMultiplier
+                );
+            }
+        } catch (...) {
+            multiplicand->unlock();
+            currentData->unlock();
+            throw;
         }
+
         multiplicand->unlock();
         assignNewDataStore(newDataStore, true);
 
@@ -1995,28 +2201,32 @@ namespace M {
 
 
     MatrixInteger MatrixInteger::operator+(const MatrixInteger& v) const {
-        currentData->lock();
-        v.currentData->lock();
+        ReferenceCounter::lockPair(currentData, v.currentData);
 
         Data* newDataStore = nullptr;
-        if (v.currentData->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->add(
-                *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
-                pendingTranspose,
-                v.pendingTranspose,
-                pendingScalarMultiplierValue,
-                v.pendingScalarMultiplierValue
-            );
-        } else {
-            assert(v.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
-//            newDataStore = currentData->add(
-//                *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
-//                pendingTransform,
-//                v.pendingTransform,
-//                pendingScalarMultiplierValue,
-//                v.pendingScalarMultiplierValue
-//            );
+        try {
+            if (v.currentData->matrixType() == MatrixType::DENSE) {
+                newDataStore = currentData->add(
+                    *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarMultiplierValue,
+                    v.pendingScalarMultiplierValue
+                );
+            } else {
+                assert(v.currentData->matrixType() == MatrixType::SPARSE);
+                newDataStore = currentData->add(
+                    *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarMultiplierValue,
+                    v.pendingScalarMultiplierValue
+                );
+            }
+        } catch (...) {
+            v.currentData->unlock();
+            currentData->unlock();
+            throw;
         }
 
         v.currentData->unlock();
@@ -2032,28 +2242,32 @@ namespace M {
 
 
     MatrixInteger MatrixInteger::operator-(const MatrixInteger& v) const {
-        currentData->lock();
-        v.currentData->lock();
+        ReferenceCounter::lockPair(currentData, v.currentData);
 
         Data* newDataStore = nullptr;
-        if (v.currentData->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->add(
-                *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
-                pendingTranspose,
-                v.pendingTranspose,
-                pendingScalarMultiplierValue,
-                -v.pendingScalarMultiplierValue
-            );
-        } else {
-            assert(v.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false);
-//            newDataStore = currentData->add(
-//                *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
-//                pendingTransform,
-//                v.pendingTransform,
-//                pendingScalarMultiplierValue,
-//                -v.pendingScalarMultiplierValue
-//            );
+        try {
+            if (v.currentData->matrixType() == MatrixType::DENSE) {
+                newDataStore = currentData->add(
+                    *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarMultiplierValue,
+                    -v.pendingScalarMultiplierValue
+                );
+            } else {
+                assert(v.currentData->matrixType() == MatrixType::SPARSE);
+                newDataStore = currentData->add(
+                    *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarMultiplierValue,
+                    -v.pendingScalarMultiplierValue
+                );
+            }
+        } catch (...) {
+            v.currentData->unlock();
+            currentData->unlock();
+            throw;
         }
 
         v.currentData->unlock();
@@ -2137,9 +2351,14 @@ namespace M {
             }
         } else {
             assert(other.currentData->matrixType() == Matrix::MatrixType::SPARSE);
-            assert(false); // FIXME
-            result = false;
-//            result = currentData->isEqualTo(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            applyLazyTransformsAndScaling();
+            other.applyLazyTransformsAndScaling();
+
+            if (currentData == other.currentData) {
+                result = true;
+            } else {
+                result = currentData->isEqualTo(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            }
         }
 
         return result;
@@ -2190,7 +2409,7 @@ namespace M {
             currentData = DenseData::create(*POLYMORPHIC_CAST<MatrixBoolean::DenseData*>(otherData));
         } else {
             assert(otherData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            currentData = SparseData::create(*POLYMORPHIC_CAST<MatrixBoolean::SparseData*>(otherData));
         }
 
         pendingTranspose             = booleanMatrix.pendingTranspose;
@@ -2201,13 +2420,13 @@ namespace M {
     void MatrixInteger::copyFrom(const MatrixReal& realMatrix) {
         realMatrix.applyLazyTransformsAndScaling();
 
-        MatrixReal::Data* otherData = realMatrix.currentData;
+        MatrixReal::Data* otherData = realMatrix.dataStore();
 
         if (otherData->matrixType() == MatrixType::DENSE) {
             currentData = DenseData::create(*POLYMORPHIC_CAST<MatrixReal::DenseData*>(otherData));
         } else {
             assert(otherData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            currentData = SparseData::create(*POLYMORPHIC_CAST<MatrixReal::SparseData*>(otherData));
         }
 
         pendingTranspose             = false;
@@ -2218,13 +2437,13 @@ namespace M {
     void MatrixInteger::copyFrom(const MatrixComplex& complexMatrix) {
         complexMatrix.applyLazyTransformsAndScaling();
 
-        MatrixComplex::Data* otherData = complexMatrix.currentData;
+        MatrixComplex::Data* otherData = complexMatrix.dataStore();
 
         if (otherData->matrixType() == MatrixType::DENSE) {
             currentData = DenseData::create(*POLYMORPHIC_CAST<MatrixComplex::DenseData*>(otherData));
         } else {
             assert(otherData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            currentData = SparseData::create(*POLYMORPHIC_CAST<MatrixComplex::SparseData*>(otherData));
         }
 
         pendingTranspose             = false;
@@ -2257,11 +2476,41 @@ namespace M {
     }
 
 
+    bool MatrixInteger::canAccumulateInPlace(const MatrixInteger::Data* operand) const {
+        return (
+               !pendingTranspose
+            && operand != currentData
+            && currentData->matrixType() == MatrixType::DENSE
+            && currentData->referenceCount() == 1
+        );
+    }
+
+
     void MatrixInteger::applyLazyTransformsAndScaling() const {
         if (pendingScalarMultiplierValue != Scalar(1) || pendingTranspose) {
-            currentData->lock();
-            Data* newDataStore = currentData->applyTransformAndScaling(pendingTranspose, pendingScalarMultiplierValue);
-            assignNewDataStore(newDataStore, true);
+            bool updateInPlace = (
+                   currentData->matrixType() == MatrixType::DENSE
+                && currentData->referenceCount() == 1
+                && (!pendingTranspose || currentData->numberRows() == currentData->numberColumns())
+            );
+
+            if (updateInPlace) {
+                DenseData* denseData = POLYMORPHIC_CAST<DenseData*>(currentData);
+                if (pendingTranspose) {
+                    denseData->transposeInPlace();
+                }
+
+                if (pendingScalarMultiplierValue != Scalar(1)) {
+                    denseData->scaleInPlace(pendingScalarMultiplierValue);
+                }
+            } else {
+                currentData->lock();
+                Data* newDataStore = currentData->applyTransformAndScaling(
+                    pendingTranspose,
+                    pendingScalarMultiplierValue
+                );
+                assignNewDataStore(newDataStore, true);
+            }
 
             pendingTranspose             = false;
             pendingScalarMultiplierValue = Scalar(1);
@@ -2269,6 +2518,17 @@ namespace M {
     }
 
 
+    void MatrixInteger::convertToDenseDataStore() const {
+        applyLazyTransformsAndScaling();
+
+        if (currentData->matrixType() == MatrixType::SPARSE) {
+            currentData->lock();
+            Data* newDataStore = POLYMORPHIC_CAST<const SparseData*>(currentData)->toDense();
+            assignNewDataStore(newDataStore, true);
+        }
+    }
+
+
     MatrixInteger operator*(Boolean a, const MatrixInteger& b) {
         return b * Integer(a);
     }
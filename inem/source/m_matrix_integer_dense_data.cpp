@@ -34,6 +34,8 @@
 #include <fstream>
 #include <vector>
 #include <string>
+#include <thread>
+#include <future>
 
 #include <boost/algorithm/string.hpp>
 
@@ -55,8 +57,15 @@
 #include "m_matrix_integer.h"
 #include "m_matrix_integer_data.h"
 #include "m_matrix_integer_dense_data.h"
+#include "m_matrix_integer_sparse_data.h"
 
 namespace M {
+    constexpr unsigned long MatrixInteger::DenseData::multiplyKernelRows;
+    constexpr unsigned long MatrixInteger::DenseData::multiplyKernelColumns;
+    constexpr unsigned long MatrixInteger::DenseData::multiplyBlockRows;
+    constexpr unsigned long MatrixInteger::DenseData::multiplyBlockTerms;
+    constexpr unsigned long MatrixInteger::DenseData::multiplyBlockColumns;
+
     MatrixInteger::DenseData::DenseData(
             unsigned long      newNumberRows,
             unsigned long      newNumberColumns,
@@ -681,8 +690,11 @@ namespace M {
     MatrixInteger::Data* MatrixInteger::DenseData::combineLeftToRight(
             const MatrixSparsePrivate<MatrixInteger::DenseData::Scalar>& other
         ) const {
-        (void) other; // FIXME
-        return nullptr; // FIXME
+        DenseData* denseOther = static_cast<const SparseData&>(other).toDense();
+        Data*      result     = combineLeftToRight(*denseOther);
+        destroy(denseOther);
+
+        return result;
     }
 
 
@@ -768,8 +780,11 @@ namespace M {
     MatrixInteger::Data* MatrixInteger::DenseData::combineTopToBottom(
             const MatrixSparsePrivate<MatrixInteger::DenseData::Scalar>& other
         ) const {
-        (void) other; // FIXME
-        return nullptr; // FIXME
+        DenseData* denseOther = static_cast<const SparseData&>(other).toDense();
+        Data*      result     = combineTopToBottom(*denseOther);
+        destroy(denseOther);
+
+        return result;
     }
 
 
@@ -913,8 +928,9 @@ namespace M {
     MatrixInteger::Data* MatrixInteger::DenseData::hadamard(
             const MatrixSparsePrivate<MatrixInteger::DenseData::Scalar>& other
         ) const {
-        (void) other; // FIXME
-        return nullptr; // FIXME
+        // The Hadamard product is commutative and the result can have no more non-zero entries than the sparse
+        // operand so we let the sparse implementation do the work.
+        return static_cast<const SparseData&>(other).hadamard(*this);
     }
 
 
@@ -987,10 +1003,11 @@ namespace M {
             bool                                                         otherTranspose,
             MatrixInteger::DenseData::Scalar                             scalarMultiplier
         ) const {
-        (void) other; // FIXME
-        (void) otherTranspose; // FIXME
-        (void) scalarMultiplier; // FIXME
-        return nullptr; // FIXME
+        SparseData* sparseThis = SparseData::create(*this);
+        Data*       result     = sparseThis->kronecker(other, otherTranspose, scalarMultiplier);
+        SparseData::destroy(sparseThis);
+
+        return result;
     }
 
 
@@ -1295,12 +1312,90 @@ namespace M {
             MatrixInteger::DenseData::Scalar                             augendScalar,
             MatrixInteger::DenseData::Scalar                             addendScalar
         ) const {
-        (void) addend; // FIXME
-        (void) augendtTranspose; // FIXME
-        (void) addendTranspose; // FIXME
-        (void) augendScalar; // FIXME
-        (void) addendScalar; // FIXME
-        return nullptr; // FIXME
+        unsigned long augendRows    = augendtTranspose ? numberColumns() : numberRows();
+        unsigned long augendColumns = augendtTranspose ? numberRows() : numberColumns();
+        unsigned long addendRows    = addendTranspose ? addend.numberColumns() : addend.numberRows();
+        unsigned long addendColumns = addendTranspose ? addend.numberRows() : addend.numberColumns();
+
+        if (augendRows != addendRows || augendColumns != addendColumns) {
+            throw Model::IncompatibleMatrixDimensions(augendRows, augendColumns, addendRows, addendColumns);
+        }
+
+        DenseData* result = POLYMORPHIC_CAST<DenseData*>(applyTransformAndScaling(augendtTranspose, augendScalar));
+        addend.accumulateInto(*result, addendTranspose, addendScalar);
+
+        return result;
+    }
+
+
+    /**
+     * The minimum number of multiply-add operations handed to each thread when multiplying dense matrices.
+     */
+    static constexpr unsigned long long minimumMultiplyOperationsPerBlock = 4 * 1024 * 1024;
+
+    /**
+     * Function that determines how many column blocks a dense matrix product should be split into so each block can
+     * be calculated by a separate thread.
+     *
+     * \param[in] numberRows       The number of result rows.
+     *
+     * \param[in] numberTerms      The number of terms summed into each result entry.
+     *
+     * \param[in] numberColumns    The number of result columns.
+     *
+     * \param[in] columnsPerKernel The number of result columns calculated by each micro-kernel call.  No block will
+     *                             be narrower than this value.
+     *
+     * \return Returns the number of blocks.  The value will always be at least 1.
+     */
+    static unsigned numberMultiplyBlocks(
+            unsigned long numberRows,
+            unsigned long numberTerms,
+            unsigned long numberColumns,
+            unsigned long columnsPerKernel
+        ) {
+        unsigned long long numberOperations = (
+              static_cast<unsigned long long>(numberRows)
+            * static_cast<unsigned long long>(numberTerms)
+            * static_cast<unsigned long long>(numberColumns)
+        );
+
+        unsigned long long numberBlocks  = numberOperations / minimumMultiplyOperationsPerBlock;
+        unsigned long long maximumBlocks = numberColumns / columnsPerKernel;
+        unsigned           numberThreads = std::thread::hardware_concurrency();
+
+        if (numberBlocks > numberThreads) {
+            numberBlocks = numberThreads;
+        }
+
+        if (numberBlocks > maximumBlocks) {
+            numberBlocks = maximumBlocks;
+        }
+
+        return numberBlocks > 1 ? static_cast<unsigned>(numberBlocks) : 1;
+    }
+
+    /**
+     * Function that calculates a collection of column blocks, one thread per block.  The last block is calculated on
+     * the calling thread.  Exceptions thrown while calculating a block are rethrown on the calling thread.
+     *
+     * \param[in] numberBlocks The number of blocks to be calculated.
+     *
+     * \param[in] function     The function used to calculate each block.  The function receives the zero based block
+     *                         index.
+     */
+    template<typename F> static void processMultiplyBlocks(unsigned numberBlocks, F function) {
+        std::vector<std::future<void>> threads;
+        threads.reserve(numberBlocks - 1);
+
+        for (unsigned blockIndex=0 ; blockIndex<numberBlocks - 1 ; ++blockIndex) {
+            threads.push_back(std::async(std::launch::async, function, blockIndex));
+        }
+
+        function(numberBlocks - 1);
+        for (std::future<void>& thread : threads) {
+            thread.get();
+        }
     }
 
 
@@ -1366,44 +1461,85 @@ namespace M {
             } else {
                 result = DenseData::create(multiplierOutputRows, multiplicandOutputColumns);
 
-                const Scalar* multiplierBase   = data();
-                const Scalar* multiplicandBase = multiplicand.data();
-
-                // TODO: Consider Strassen method
-                // TODO: Consider using SIMD instructions for inner loop.
-                const Scalar*      multiplicandData = multiplicandBase;
-                Scalar*            y                = result->data();
+                const Scalar*      multiplierBase   = data();
+                const Scalar*      multiplicandBase = multiplicand.data();
+                Scalar*            resultBase       = result->data();
                 unsigned long long resultColumnSize = result->columnSpacingInMemory();
-                unsigned           residue          = static_cast<unsigned>(resultColumnSize - multiplierOutputRows);
-                unsigned           residueInBytes   = residue * sizeof(Scalar);
-
-                for (unsigned columnIndex=0 ; columnIndex<multiplicandOutputColumns ; ++columnIndex) {
-                    const Scalar* multiplierData = multiplierBase;
-                    for (unsigned rowIndex=0 ; rowIndex<multiplierOutputRows ; ++rowIndex) {
-                        Integer       sum = 0;
-                        const Scalar* a   = multiplierData;
-                        const Scalar* b   = multiplicandData;
-
-                        for (unsigned termIndex=0 ; termIndex<multiplierOutputColumns ; ++termIndex) {
-                            const Scalar va = *a;
-                            const Scalar vb = *b;
-                            sum += va * vb * scalarMultiplier;
-                            a += multiplierColumnIncrement;
-                            b += multiplicandRowIncrement;
-                        }
 
-                        (*y) = sum;
-                        ++y;
+                if (multiplierOutputRows < multiplyKernelRows || multiplicandOutputColumns < multiplyKernelColumns) {
+                    // Matrix/vector products would waste most of each tile so we use dot products instead.
 
-                        multiplierData += multiplierRowIncrement;
-                    }
+                    const Scalar* multiplicandData = multiplicandBase;
+                    Scalar*       y                = resultBase;
 
-                    if (residue > 0) {
-                        std::memset(y, 0, residueInBytes);
-                        y += residue;
+                    for (unsigned long columnIndex=0 ; columnIndex<multiplicandOutputColumns ; ++columnIndex) {
+                        const Scalar* multiplierData = multiplierBase;
+                        for (unsigned long rowIndex=0 ; rowIndex<multiplierOutputRows ; ++rowIndex) {
+                            Integer       sum = 0;
+                            const Scalar* a   = multiplierData;
+                            const Scalar* b   = multiplicandData;
+
+                            for (unsigned long termIndex=0 ; termIndex<multiplierOutputColumns ; ++termIndex) {
+                                sum += (*a) * (*b);
+                                a   += multiplierColumnIncrement;
+                                b   += multiplicandRowIncrement;
+                            }
+
+                            y[rowIndex]     = sum * scalarMultiplier;
+                            multiplierData += multiplierRowIncrement;
+                        }
+
+                        y                += resultColumnSize;
+                        multiplicandData += multiplicandColumnIncrement;
                     }
+                } else {
+                    // Blocked, packed panel multiply.  The result columns are split into contiguous ranges that are
+                    // calculated concurrently when the product is large enough to amortize the thread start-up cost.
+
+                    unsigned long numberTerms   = multiplierOutputColumns;
+                    unsigned      numberBlocks  = numberMultiplyBlocks(
+                        multiplierOutputRows,
+                        numberTerms,
+                        multiplicandOutputColumns,
+                        multiplyKernelColumns
+                    );
 
-                    multiplicandData += multiplicandColumnIncrement;
+                    unsigned long blockColumns  = (
+                          ((multiplicandOutputColumns + numberBlocks - 1) / numberBlocks + multiplyKernelColumns - 1)
+                        / multiplyKernelColumns
+                        * multiplyKernelColumns
+                    );
+
+                    processMultiplyBlocks(
+                        numberBlocks,
+                        [&](unsigned blockIndex) {
+                            unsigned long firstColumnIndex = std::min(
+                                blockIndex * blockColumns,
+                                multiplicandOutputColumns
+                            );
+                            unsigned long lastColumnIndex  = std::min(
+                                firstColumnIndex + blockColumns,
+                                multiplicandOutputColumns
+                            );
+
+                            if (firstColumnIndex < lastColumnIndex) {
+                                multiplyPackedColumns(
+                                    multiplierOutputRows,
+                                    numberTerms,
+                                    lastColumnIndex - firstColumnIndex,
+                                    scalarMultiplier,
+                                    multiplierBase,
+                                    multiplierRowIncrement,
+                                    multiplierColumnIncrement,
+                                    multiplicandBase + multiplicandColumnIncrement * firstColumnIndex,
+                                    multiplicandRowIncrement,
+                                    multiplicandColumnIncrement,
+                                    resultBase + resultColumnSize * firstColumnIndex,
+                                    resultColumnSize
+                                );
+                            }
+                        }
+                    );
                 }
             }
         } else {
@@ -1420,11 +1556,102 @@ namespace M {
             bool                                                         multiplicandTranspose,
             MatrixInteger::DenseData::Scalar                             scalerMultiplier
         ) const {
-        (void) multiplicand; // FIXME
-        (void) multiplierTranspose; // FIXME
-        (void) multiplicandTranspose; // FIXME
-        (void) scalerMultiplier; // FIXME
-        return nullptr; // FIXME
+        unsigned long multiplierRows      = multiplierTranspose ? numberColumns() : numberRows();
+        unsigned long multiplierColumns   = multiplierTranspose ? numberRows() : numberColumns();
+        unsigned long multiplicandRows    = (
+              multiplicandTranspose
+            ? multiplicand.numberColumns()
+            : multiplicand.numberRows()
+        );
+        unsigned long multiplicandColumns = (
+              multiplicandTranspose
+            ? multiplicand.numberRows()
+            : multiplicand.numberColumns()
+        );
+
+        if (multiplierColumns != multiplicandRows) {
+            throw Model::IncompatibleMatrixDimensions(
+                multiplierRows,
+                multiplierColumns,
+                multiplicandRows,
+                multiplicandColumns
+            );
+        }
+
+        DenseData* result = DenseData::create(multiplierRows, multiplicandColumns);
+        multiplicand.multiplyDenseByThisInto(
+            *this,
+            multiplierTranspose,
+            multiplicandTranspose,
+            scalerMultiplier,
+            *result
+        );
+
+        return result;
+    }
+
+
+    void MatrixInteger::DenseData::scaleAccumulate(
+            const MatrixDensePrivate<MatrixInteger::DenseData::Scalar>& addend,
+            bool                                                        addendTranspose,
+            MatrixInteger::DenseData::Scalar                            augendScalar,
+            MatrixInteger::DenseData::Scalar                            addendScalar
+        ) {
+        unsigned long augendRows    = numberRows();
+        unsigned long augendColumns = numberColumns();
+        unsigned long addendRows    = addendTranspose ? addend.numberColumns() : addend.numberRows();
+        unsigned long addendColumns = addendTranspose ? addend.numberRows() : addend.numberColumns();
+
+        if (augendRows != addendRows || augendColumns != addendColumns) {
+            throw Model::IncompatibleMatrixDimensions(augendRows, augendColumns, addendRows, addendColumns);
+        }
+
+        Scalar*            destinationData     = data();
+        unsigned long long destinationSpacing  = columnSpacingInMemory();
+        const Scalar*      addendData          = addend.data();
+        unsigned long long addendColumnSpacing = addend.columnSpacingInMemory();
+
+        for (unsigned long columnIndex=0 ; columnIndex<augendColumns ; ++columnIndex) {
+            Scalar* destination = destinationData + destinationSpacing * columnIndex;
+
+            if (addendTranspose) {
+                const Scalar* source = addendData + columnIndex;
+                for (unsigned long rowIndex=0 ; rowIndex<augendRows ; ++rowIndex) {
+                    destination[rowIndex] = (
+                          augendScalar * destination[rowIndex]
+                        + addendScalar * source[addendColumnSpacing * rowIndex]
+                    );
+                }
+            } else {
+                const Scalar* source = addendData + addendColumnSpacing * columnIndex;
+                for (unsigned long rowIndex=0 ; rowIndex<augendRows ; ++rowIndex) {
+                    destination[rowIndex] = augendScalar * destination[rowIndex] + addendScalar * source[rowIndex];
+                }
+            }
+        }
+    }
+
+
+    void MatrixInteger::DenseData::scaleAccumulate(
+            const MatrixSparsePrivate<MatrixInteger::DenseData::Scalar>& addend,
+            bool                                                         addendTranspose,
+            MatrixInteger::DenseData::Scalar                             augendScalar,
+            MatrixInteger::DenseData::Scalar                             addendScalar
+        ) {
+        unsigned long augendRows    = numberRows();
+        unsigned long augendColumns = numberColumns();
+        unsigned long addendRows    = addendTranspose ? addend.numberColumns() : addend.numberRows();
+        unsigned long addendColumns = addendTranspose ? addend.numberRows() : addend.numberColumns();
+
+        if (augendRows != addendRows || augendColumns != addendColumns) {
+            throw Model::IncompatibleMatrixDimensions(augendRows, augendColumns, addendRows, addendColumns);
+        }
+
+        if (augendScalar != Scalar(1)) {
+            scaleInPlace(augendScalar);
+        }
+
+        addend.accumulateInto(*this, addendTranspose, addendScalar);
     }
 
 
@@ -1514,9 +1741,7 @@ namespace M {
 
 
     bool MatrixInteger::DenseData::isEqualTo(const MatrixSparsePrivate<MatrixInteger::DenseData::Scalar>& other) const {
-        (void) other; // FIXME
-        assert(false); // FIXME
-        return false;
+        return other.isEqualTo(*this);
     }
 
 
@@ -1719,6 +1944,242 @@ namespace M {
     }
 
 
+    void MatrixInteger::DenseData::packMultiplierBlock(
+            unsigned long            numberRows,
+            unsigned long            numberTerms,
+            const Scalar*            base,
+            const unsigned long long rowIncrement,
+            const unsigned long long termIncrement,
+            Scalar*                  packedBase
+        ) {
+        Scalar* y = packedBase;
+
+        for (unsigned long panelRow=0 ; panelRow<numberRows ; panelRow+=multiplyKernelRows) {
+            unsigned long panelRows = numberRows - panelRow;
+            if (panelRows > multiplyKernelRows) {
+                panelRows = multiplyKernelRows;
+            }
+
+            const Scalar* a = base + rowIncrement * panelRow;
+            for (unsigned long termIndex=0 ; termIndex<numberTerms ; ++termIndex) {
+                unsigned long rowIndex = 0;
+                while (rowIndex < panelRows) {
+                    y[rowIndex] = a[rowIncrement * rowIndex];
+                    ++rowIndex;
+                }
+
+                while (rowIndex < multiplyKernelRows) {
+                    y[rowIndex] = 0;
+                    ++rowIndex;
+                }
+
+                a += termIncrement;
+                y += multiplyKernelRows;
+            }
+        }
+    }
+
+
+    void MatrixInteger::DenseData::packMultiplicandBlock(
+            unsigned long            numberTerms,
+            unsigned long            numberColumns,
+            const Scalar             scaleFactor,
+            const Scalar*            base,
+            const unsigned long long termIncrement,
+            const unsigned long long columnIncrement,
+            Scalar*                  packedBase
+        ) {
+        Scalar* y = packedBase;
+
+        for (unsigned long panelColumn=0 ; panelColumn<numberColumns ; panelColumn+=multiplyKernelColumns) {
+            unsigned long panelColumns = numberColumns - panelColumn;
+            if (panelColumns > multiplyKernelColumns) {
+                panelColumns = multiplyKernelColumns;
+            }
+
+            const Scalar* b = base + columnIncrement * panelColumn;
+            for (unsigned long termIndex=0 ; termIndex<numberTerms ; ++termIndex) {
+                unsigned long columnIndex = 0;
+                while (columnIndex < panelColumns) {
+                    y[columnIndex] = scaleFactor * b[columnIncrement * columnIndex];
+                    ++columnIndex;
+                }
+
+                while (columnIndex < multiplyKernelColumns) {
+                    y[columnIndex] = 0;
+                    ++columnIndex;
+                }
+
+                b += termIncrement;
+                y += multiplyKernelColumns;
+            }
+        }
+    }
+
+
+    void MatrixInteger::DenseData::multiplyMicroKernel(
+            unsigned long            numberTerms,
+            const Scalar*            packedMultiplier,
+            const Scalar*            packedMultiplicand,
+            unsigned long            numberRows,
+            unsigned long            numberColumns,
+            Scalar*                  resultBase,
+            const unsigned long long resultColumnSpacingInEntries
+        ) {
+        Scalar accumulators[multiplyKernelColumns][multiplyKernelRows] = {};
+
+        const Scalar* a = packedMultiplier;
+        const Scalar* b = packedMultiplicand;
+        for (unsigned long termIndex=0 ; termIndex<numberTerms ; ++termIndex) {
+            for (unsigned long columnIndex=0 ; columnIndex<multiplyKernelColumns ; ++columnIndex) {
+                Scalar multiplicandValue = b[columnIndex];
+                for (unsigned long rowIndex=0 ; rowIndex<multiplyKernelRows ; ++rowIndex) {
+                    accumulators[columnIndex][rowIndex] += a[rowIndex] * multiplicandValue;
+                }
+            }
+
+            a += multiplyKernelRows;
+            b += multiplyKernelColumns;
+        }
+
+        Scalar* y = resultBase;
+        for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+            for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                y[rowIndex] += accumulators[columnIndex][rowIndex];
+            }
+
+            y += resultColumnSpacingInEntries;
+        }
+    }
+
+
+    void MatrixInteger::DenseData::multiplyPackedColumns(
+            unsigned long            numberRows,
+            unsigned long            numberTerms,
+            unsigned long            numberColumns,
+            const Scalar             scaleFactor,
+            const Scalar*            multiplierBase,
+            const unsigned long long multiplierRowIncrement,
+            const unsigned long long multiplierTermIncrement,
+            const Scalar*            multiplicandBase,
+            const unsigned long long multiplicandTermIncrement,
+            const unsigned long long multiplicandColumnIncrement,
+            Scalar*                  resultBase,
+            const unsigned long long resultColumnSpacingInEntries
+        ) {
+        unsigned long blockRows     = (
+              numberRows < multiplyBlockRows
+            ? numberRows
+            : multiplyBlockRows
+        );
+        unsigned long blockTerms    = numberTerms < multiplyBlockTerms ? numberTerms : multiplyBlockTerms;
+        unsigned long blockColumns  = (
+              numberColumns < multiplyBlockColumns
+            ? numberColumns
+            : multiplyBlockColumns
+        );
+
+        unsigned long paddedRows    = (
+              (blockRows + multiplyKernelRows - 1) / multiplyKernelRows
+            * multiplyKernelRows
+        );
+        unsigned long paddedColumns = (
+              (blockColumns + multiplyKernelColumns - 1) / multiplyKernelColumns
+            * multiplyKernelColumns
+        );
+
+        Scalar* packedMultiplier   = new Scalar[paddedRows * blockTerms];
+        Scalar* packedMultiplicand = new Scalar[blockTerms * paddedColumns];
+
+        for (  unsigned long columnIndex=0
+             ; columnIndex<numberColumns
+             ; columnIndex+=multiplyBlockColumns
+            ) {
+            unsigned long remainingColumns = numberColumns - columnIndex;
+            unsigned long columns          = (
+                  remainingColumns < multiplyBlockColumns
+                ? remainingColumns
+                : multiplyBlockColumns
+            );
+
+            for (unsigned long termIndex=0 ; termIndex<numberTerms ; termIndex+=multiplyBlockTerms) {
+                unsigned long remainingTerms = numberTerms - termIndex;
+                unsigned long terms          = (
+                      remainingTerms < multiplyBlockTerms
+                    ? remainingTerms
+                    : multiplyBlockTerms
+                );
+
+                packMultiplicandBlock(
+                    terms,
+                    columns,
+                    scaleFactor,
+                    (
+                          multiplicandBase
+                        + multiplicandTermIncrement * termIndex
+                        + multiplicandColumnIncrement * columnIndex
+                    ),
+                    multiplicandTermIncrement,
+                    multiplicandColumnIncrement,
+                    packedMultiplicand
+                );
+
+                for (  unsigned long rowIndex=0
+                     ; rowIndex<numberRows
+                     ; rowIndex+=multiplyBlockRows
+                    ) {
+                    unsigned long remainingRows = numberRows - rowIndex;
+                    unsigned long rows          = (
+                          remainingRows < multiplyBlockRows
+                        ? remainingRows
+                        : multiplyBlockRows
+                    );
+
+                    packMultiplierBlock(
+                        rows,
+                        terms,
+                        (
+                              multiplierBase
+                            + multiplierRowIncrement * rowIndex
+                            + multiplierTermIncrement * termIndex
+                        ),
+                        multiplierRowIncrement,
+                        multiplierTermIncrement,
+                        packedMultiplier
+                    );
+
+                    for (unsigned long j=0 ; j<columns ; j+=multiplyKernelColumns) {
+                        unsigned long tileColumns = columns - j;
+                        if (tileColumns > multiplyKernelColumns) {
+                            tileColumns = multiplyKernelColumns;
+                        }
+
+                        for (unsigned long i=0 ; i<rows ; i+=multiplyKernelRows) {
+                            unsigned long tileRows = rows - i;
+                            if (tileRows > multiplyKernelRows) {
+                                tileRows = multiplyKernelRows;
+                            }
+
+                            multiplyMicroKernel(
+                                terms,
+                                packedMultiplier + terms * i,
+                                packedMultiplicand + terms * j,
+                                tileRows,
+                                tileColumns,
+                                resultBase + (rowIndex + i) + resultColumnSpacingInEntries * (columnIndex + j),
+                                resultColumnSpacingInEntries
+                            );
+                        }
+                    }
+                }
+            }
+        }
+
+        delete[] packedMultiplier;
+        delete[] packedMultiplicand;
+    }
+
+
     MatrixInteger::Scalar MatrixInteger::DenseData::convertString(const std::string& str, bool* ok) {
         std::string t = str;
         boost::algorithm::trim(t);
@@ -670,6 +670,49 @@ namespace M {
                 Scalar                             scalerMultiplier
             ) const override;
 
+            /**
+             * Method you can call to accumulate another matrix into this matrix, in place.  The method calculates
+             * \f$ this = augendScalar \times this + addendScalar \times op \left ( addend \right ) \f$ using a
+             * single pass over the data and without allocating a new data store.  The caller must guarantee that this
+             * data store is not shared and that the addend does not share memory with this data store.
+             *
+             * \param[in] addend          The instance to be accumulated into this instance.
+             *
+             * \param[in] addendTranspose Indicates that transpose needs to be performed on the addend prior to the
+             *                            addition.  The addend will not be modified.
+             *
+             * \param[in] augendScalar    A scalar value to be multiplied to this matrix prior to the addition.
+             *
+             * \param[in] addendScalar    A scalar value to be multiplied to the addend prior to the addition.
+             */
+            void scaleAccumulate(
+                const MatrixDensePrivate<Scalar>& addend,
+                bool                              addendTranspose,
+                Scalar                            augendScalar,
+                Scalar                            addendScalar
+            );
+
+            /**
+             * Method you can call to accumulate a sparse matrix into this matrix, in place.  The method calculates
+             * \f$ this = augendScalar \times this + addendScalar \times op \left ( addend \right ) \f$ without
+             * allocating a new data store.  The caller must guarantee that this data store is not shared.
+             *
+             * \param[in] addend          The instance to be accumulated into this instance.
+             *
+             * \param[in] addendTranspose Indicates that transpose needs to be performed on the addend prior to the
+             *                            addition.  The addend will not be modified.
+             *
+             * \param[in] augendScalar    A scalar value to be multiplied to this matrix prior to the addition.
+             *
+             * \param[in] addendScalar    A scalar value to be multiplied to the addend prior to the addition.
+             */
+            void scaleAccumulate(
+                const MatrixSparsePrivate<Scalar>& addend,
+                bool                               addendTranspose,
+                Scalar                             augendScalar,
+                Scalar                             addendScalar
+            );
+
             /**
              * Method you can call to divide this matrix by a scalar value.
              *
@@ -906,6 +949,159 @@ namespace M {
                 const unsigned long long resultColumnSpacingInEntries
             );
 
+            /**
+             * The number of result rows calculated by each call to \ref multiplyMicroKernel.
+             */
+            static constexpr unsigned long multiplyKernelRows = 8;
+
+            /**
+             * The number of result columns calculated by each call to \ref multiplyMicroKernel.
+             */
+            static constexpr unsigned long multiplyKernelColumns = 4;
+
+            /**
+             * The number of multiplier rows packed at one time.  Must be a multiple of \ref multiplyKernelRows.
+             */
+            static constexpr unsigned long multiplyBlockRows = 128;
+
+            /**
+             * The number of terms packed at one time.  The packed multiplier block is sized to remain in the L2 cache.
+             */
+            static constexpr unsigned long multiplyBlockTerms = 256;
+
+            /**
+             * The number of multiplicand columns packed at one time.  Must be a multiple of
+             * \ref multiplyKernelColumns.
+             */
+            static constexpr unsigned long multiplyBlockColumns = 2048;
+
+            /**
+             * Method that copies a block of the multiplier into contiguous panels of \ref multiplyKernelRows rows.
+             * Within each panel, the entries for each term are stored together.  Rows past the end of the block are
+             * padded with zeros.
+             *
+             * \param[in] numberRows      The number of rows in the block.
+             *
+             * \param[in] numberTerms     The number of terms (columns) in the block.
+             *
+             * \param[in] base            The address of the first entry in the block.
+             *
+             * \param[in] rowIncrement    The distance between rows, in entries.
+             *
+             * \param[in] termIncrement   The distance between terms, in entries.
+             *
+             * \param[in] packedBase      The location to receive the packed panels.
+             */
+            static void packMultiplierBlock(
+                unsigned long            numberRows,
+                unsigned long            numberTerms,
+                const Scalar*            base,
+                const unsigned long long rowIncrement,
+                const unsigned long long termIncrement,
+                Scalar*                  packedBase
+            );
+
+            /**
+             * Method that copies a block of the multiplicand into contiguous panels of \ref multiplyKernelColumns
+             * columns, applying a scale factor.  Within each panel, the entries for each term are stored together.
+             * Columns past the end of the block are padded with zeros.
+             *
+             * \param[in] numberTerms      The number of terms (rows) in the block.
+             *
+             * \param[in] numberColumns    The number of columns in the block.
+             *
+             * \param[in] scaleFactor      The scale factor to apply to each entry.
+             *
+             * \param[in] base             The address of the first entry in the block.
+             *
+             * \param[in] termIncrement    The distance between terms, in entries.
+             *
+             * \param[in] columnIncrement  The distance between columns, in entries.
+             *
+             * \param[in] packedBase       The location to receive the packed panels.
+             */
+            static void packMultiplicandBlock(
+                unsigned long            numberTerms,
+                unsigned long            numberColumns,
+                const Scalar             scaleFactor,
+                const Scalar*            base,
+                const unsigned long long termIncrement,
+                const unsigned long long columnIncrement,
+                Scalar*                  packedBase
+            );
+
+            /**
+             * Method that multiplies one packed multiplier panel by one packed multiplicand panel and adds the product
+             * to the result.  The product is accumulated in local variables so the compiler can keep the entire
+             * \ref multiplyKernelRows by \ref multiplyKernelColumns tile in registers.
+             *
+             * \param[in] numberTerms                  The number of terms in each panel.
+             *
+             * \param[in] packedMultiplier             The packed multiplier panel.
+             *
+             * \param[in] packedMultiplicand           The packed multiplicand panel.
+             *
+             * \param[in] numberRows                   The number of valid result rows in the tile.
+             *
+             * \param[in] numberColumns                The number of valid result columns in the tile.
+             *
+             * \param[in] resultBase                   The address of the first entry of the result tile.
+             *
+             * \param[in] resultColumnSpacingInEntries The spacing between columns in the result, in entries.
+             */
+            static void multiplyMicroKernel(
+                unsigned long            numberTerms,
+                const Scalar*            packedMultiplier,
+                const Scalar*            packedMultiplicand,
+                unsigned long            numberRows,
+                unsigned long            numberColumns,
+                Scalar*                  resultBase,
+                const unsigned long long resultColumnSpacingInEntries
+            );
+
+            /**
+             * Method that calculates a range of result columns using the blocked, packed panel multiply.  Each call
+             * allocates its own packing buffers so disjoint column ranges can be calculated concurrently.
+             *
+             * \param[in] numberRows                   The number of result rows.
+             *
+             * \param[in] numberTerms                  The number of terms summed into each result entry.
+             *
+             * \param[in] numberColumns                The number of result columns in the range.
+             *
+             * \param[in] scaleFactor                  The scale factor to apply to each product.
+             *
+             * \param[in] multiplierBase               The address of the first multiplier entry.
+             *
+             * \param[in] multiplierRowIncrement       The distance between multiplier rows, in entries.
+             *
+             * \param[in] multiplierTermIncrement      The distance between multiplier terms, in entries.
+             *
+             * \param[in] multiplicandBase             The address of the first multiplicand entry in the range.
+             *
+             * \param[in] multiplicandTermIncrement    The distance between multiplicand terms, in entries.
+             *
+             * \param[in] multiplicandColumnIncrement  The distance between multiplicand columns, in entries.
+             *
+             * \param[in] resultBase                   The address of the first result entry in the range.
+             *
+             * \param[in] resultColumnSpacingInEntries The spacing between columns in the result, in entries.
+             */
+            static void multiplyPackedColumns(
+                unsigned long            numberRows,
+                unsigned long            numberTerms,
+                unsigned long            numberColumns,
+                const Scalar             scaleFactor,
+                const Scalar*            multiplierBase,
+                const unsigned long long multiplierRowIncrement,
+                const unsigned long long multiplierTermIncrement,
+                const Scalar*            multiplicandBase,
+                const unsigned long long multiplicandTermIncrement,
+                const unsigned long long multiplicandColumnIncrement,
+                Scalar*                  resultBase,
+                const unsigned long long resultColumnSpacingInEntries
+            );
+
             /**
              * Method that converts a string to a numerical value.
              *
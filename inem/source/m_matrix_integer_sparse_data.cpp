@@ -0,0 +1,407 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+*
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::MatrixInteger::SparseData class.
+***********************************************************************************************************************/
+
+#include <new>
+#include <cstring>
+#include <cstdint>
+#include <cassert>
+#include <algorithm>
+#include <cmath>
+
+#include "m_api_types.h"
+#include "m_intrinsic_types.h"
+#include "m_basic_functions.h"
+#include "model_exceptions.h"
+#include "m_matrix_dense_private.h"
+#include "m_matrix_sparse_private.h"
+#include "m_matrix_boolean.h"
+#include "m_matrix_boolean_data.h"
+#include "m_matrix_boolean_sparse_data.h"
+#include "m_matrix_real.h"
+#include "m_matrix_real_data.h"
+#include "m_matrix_real_sparse_data.h"
+#include "m_matrix_complex.h"
+#include "m_matrix_complex_data.h"
+#include "m_matrix_complex_sparse_data.h"
+#include "m_matrix_integer.h"
+#include "m_matrix_integer_data.h"
+#include "m_matrix_integer_dense_data.h"
+#include "m_matrix_integer_sparse_data.h"
+
+namespace M {
+    MatrixInteger::SparseData::SparseData(
+            unsigned long      newNumberRows,
+            unsigned long      newNumberColumns,
+            unsigned long long newCapacity
+        ):MatrixSparsePrivate<MatrixInteger::SparseData::Scalar>(
+            newNumberRows,
+            newNumberColumns,
+            newCapacity
+        ) {}
+
+
+    MatrixInteger::SparseData::SparseData(
+            const MatrixInteger::SparseData& other
+        ):MatrixInteger::Data(),
+          MatrixSparsePrivate<MatrixInteger::SparseData::Scalar>(
+            other
+        ) {}
+
+
+    MatrixInteger::SparseData::SparseData(
+            const MatrixInteger::SparseData& other,
+            unsigned long                 newNumberRows,
+            unsigned long                 newNumberColumns
+        ):MatrixSparsePrivate<MatrixInteger::SparseData::Scalar>(
+            other,
+            newNumberRows,
+            newNumberColumns
+        ) {}
+
+
+    MatrixInteger::SparseData::~SparseData() {}
+
+
+    MatrixInteger::DenseData* MatrixInteger::SparseData::toDense() const {
+        DenseData* result = DenseData::create(numberRows(), numberColumns());
+        scatterInto(*result);
+
+        return result;
+    }
+
+
+    MatrixInteger::SparseData* MatrixInteger::SparseData::create(const MatrixBoolean::SparseData& other) {
+        return createConverted<SparseData>(other, [](MatrixBoolean::Scalar v) {
+            return v ? Scalar(1) : Scalar(0);
+        });
+    }
+
+
+    MatrixInteger::SparseData* MatrixInteger::SparseData::create(const MatrixReal::SparseData& other) {
+        return createConverted<SparseData>(other, [](MatrixReal::Scalar v) {
+            MatrixReal::Scalar wholePart;
+            if (std::modf(v, &wholePart) != 0.0) {
+                internalTriggerTypeConversionError(M::ValueType::MATRIX_REAL, M::ValueType::MATRIX_INTEGER);
+            }
+
+            return static_cast<Scalar>(v);
+        });
+    }
+
+
+    MatrixInteger::SparseData* MatrixInteger::SparseData::create(const MatrixComplex::SparseData& other) {
+        return createConverted<SparseData>(other, [](const MatrixComplex::Scalar& v) {
+            Real wholePart;
+            if (v.imag() != 0 || std::modf(v.real(), &wholePart) != 0.0) {
+                internalTriggerTypeConversionError(M::ValueType::MATRIX_COMPLEX, M::ValueType::MATRIX_INTEGER);
+            }
+
+            return static_cast<Scalar>(v.real());
+        });
+    }
+
+
+    bool MatrixInteger::SparseData::toFile(const char* filename, Model::DataFileFormat fileFormat) const {
+        DenseData* dense   = toDense();
+        bool       success = dense->toFile(filename, fileFormat);
+        DenseData::destroy(dense);
+
+        return success;
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::combineLeftToRight(
+            const MatrixDensePrivate<MatrixInteger::SparseData::Scalar>& other
+        ) const {
+        SparseData* sparseOther = create(other);
+        Data*       result      = combineLeftToRight(*sparseOther);
+        destroy(sparseOther);
+
+        return result;
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::combineLeftToRight(
+            const MatrixSparsePrivate<MatrixInteger::SparseData::Scalar>& other
+        ) const {
+        SparseData* result = create(
+            std::max(numberRows(), other.numberRows()),
+            numberColumns() + other.numberColumns()
+        );
+
+        combineLeftToRightInto(other, *result);
+        return result;
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::combineTopToBottom(
+            const MatrixDensePrivate<MatrixInteger::SparseData::Scalar>& other
+        ) const {
+        SparseData* sparseOther = create(other);
+        Data*       result      = combineTopToBottom(*sparseOther);
+        destroy(sparseOther);
+
+        return result;
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::combineTopToBottom(
+            const MatrixSparsePrivate<MatrixInteger::SparseData::Scalar>& other
+        ) const {
+        SparseData* result = create(
+            numberRows() + other.numberRows(),
+            std::max(numberColumns(), other.numberColumns())
+        );
+
+        combineTopToBottomInto(other, *result);
+        return result;
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::columnReverse() const {
+        SparseData* result = create(numberRows(), numberColumns());
+        columnReverseInto(*result);
+
+        return result;
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::rowReverse() const {
+        SparseData* result = create(numberRows(), numberColumns());
+        rowReverseInto(*result);
+
+        return result;
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::resizeTo(
+            unsigned long newNumberRows,
+            unsigned long newNumberColumns,
+            bool          alwaysReallocate
+        ) {
+        MatrixInteger::Data* result = this;
+        if (alwaysReallocate) {
+            result = MatrixSparsePrivate<Scalar>::create<SparseData>(*this, newNumberRows, newNumberColumns);
+        } else {
+            resizeInPlace(newNumberRows, newNumberColumns);
+        }
+
+        return result;
+    }
+
+
+    bool MatrixInteger::SparseData::resizeInPlaceTo(unsigned long newNumberRows, unsigned long newNumberColumns) {
+        resizeInPlace(newNumberRows, newNumberColumns);
+        return true;
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::hadamard(
+            const MatrixDensePrivate<MatrixInteger::SparseData::Scalar>& other
+        ) const {
+        return MatrixSparsePrivate<Scalar>::hadamard<SparseData>(other);
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::hadamard(
+            const MatrixSparsePrivate<MatrixInteger::SparseData::Scalar>& other
+        ) const {
+        return MatrixSparsePrivate<Scalar>::hadamard<SparseData>(other);
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::kronecker(
+            const MatrixDensePrivate<MatrixInteger::SparseData::Scalar>& other,
+            bool                                                      otherTranspose,
+            MatrixInteger::SparseData::Scalar                            scalarMultiplier
+        ) const {
+        SparseData* sparseOther = create(other);
+        Data*       result      = kronecker(*sparseOther, otherTranspose, scalarMultiplier);
+        destroy(sparseOther);
+
+        return result;
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::kronecker(
+            const MatrixSparsePrivate<MatrixInteger::SparseData::Scalar>& other,
+            bool                                                       otherTranspose,
+            MatrixInteger::SparseData::Scalar                             scalarMultiplier
+        ) const {
+        return MatrixSparsePrivate<Scalar>::kronecker<SparseData>(other, otherTranspose, scalarMultiplier);
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::add(
+            const MatrixDensePrivate<MatrixInteger::SparseData::Scalar>& addend,
+            bool                                                      augendTranspose,
+            bool                                                      addendTranspose,
+            MatrixInteger::SparseData::Scalar                            augendScalar,
+            MatrixInteger::SparseData::Scalar                            addendScalar
+        ) const {
+        // The sum of a sparse and dense matrix is, in general, dense.  We scale and transpose the dense addend and
+        // then accumulate our entries into it.
+
+        unsigned long augendRows    = augendTranspose ? numberColumns() : numberRows();
+        unsigned long augendColumns = augendTranspose ? numberRows() : numberColumns();
+        unsigned long addendRows    = addendTranspose ? addend.numberColumns() : addend.numberRows();
+        unsigned long addendColumns = addendTranspose ? addend.numberRows() : addend.numberColumns();
+
+        if (augendRows != addendRows || augendColumns != addendColumns) {
+            throw Model::IncompatibleMatrixDimensions(augendRows, augendColumns, addendRows, addendColumns);
+        }
+
+        const DenseData& denseAddend = static_cast<const DenseData&>(addend);
+        DenseData*       result      = POLYMORPHIC_CAST<DenseData*>(
+            denseAddend.applyTransformAndScaling(addendTranspose, addendScalar)
+        );
+
+        accumulateInto(*result, augendTranspose, augendScalar);
+
+        return result;
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::add(
+            const MatrixSparsePrivate<MatrixInteger::SparseData::Scalar>& addend,
+            bool                                                       augendTranspose,
+            bool                                                       addendTranspose,
+            MatrixInteger::SparseData::Scalar                             augendScalar,
+            MatrixInteger::SparseData::Scalar                             addendScalar
+        ) const {
+        return MatrixSparsePrivate<Scalar>::add<SparseData>(
+            addend,
+            augendTranspose,
+            addendTranspose,
+            augendScalar,
+            addendScalar
+        );
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::multiply(
+            const MatrixDensePrivate<MatrixInteger::SparseData::Scalar>& multiplicand,
+            bool                                                      multiplierTranspose,
+            bool                                                      multiplicandTranspose,
+            MatrixInteger::SparseData::Scalar                            scalerMultiplier
+        ) const {
+        unsigned long multiplierRows      = multiplierTranspose ? numberColumns() : numberRows();
+        unsigned long multiplierColumns   = multiplierTranspose ? numberRows() : numberColumns();
+        unsigned long multiplicandRows    = (
+              multiplicandTranspose
+            ? multiplicand.numberColumns()
+            : multiplicand.numberRows()
+        );
+        unsigned long multiplicandColumns = (
+              multiplicandTranspose
+            ? multiplicand.numberRows()
+            : multiplicand.numberColumns()
+        );
+
+        if (multiplierColumns != multiplicandRows) {
+            throw Model::IncompatibleMatrixDimensions(
+                multiplierRows,
+                multiplierColumns,
+                multiplicandRows,
+                multiplicandColumns
+            );
+        }
+
+        DenseData* result = DenseData::create(multiplierRows, multiplicandColumns);
+        multiplyDenseInto(multiplicand, multiplierTranspose, multiplicandTranspose, scalerMultiplier, *result);
+
+        return result;
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::multiply(
+            const MatrixSparsePrivate<MatrixInteger::SparseData::Scalar>& multiplicand,
+            bool                                                       multiplierTranspose,
+            bool                                                       multiplicandTranspose,
+            MatrixInteger::SparseData::Scalar                             scalerMultiplier
+        ) const {
+        return MatrixSparsePrivate<Scalar>::multiply<SparseData>(
+            multiplicand,
+            multiplierTranspose,
+            multiplicandTranspose,
+            scalerMultiplier
+        );
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::divide(
+            bool    transpose,
+            Integer scalarMultiplier,
+            Integer scalarDivisor
+        ) const {
+        // Integer division can truncate stored values to zero so we use map to discard those entries.
+
+        const SparseData* source = transpose ? transposed<SparseData>() : this;
+        SparseData*       result = source->map<SparseData>([=](Scalar v) {
+            return (scalarMultiplier * v) / scalarDivisor;
+        });
+
+        releaseTransposed<SparseData>(source, this);
+        return result;
+    }
+
+
+    bool MatrixInteger::SparseData::isEqualTo(
+            const MatrixDensePrivate<MatrixInteger::SparseData::Scalar>& other
+        ) const {
+        return MatrixSparsePrivate<Scalar>::isEqualTo(other);
+    }
+
+
+    bool MatrixInteger::SparseData::isEqualTo(
+            const MatrixSparsePrivate<MatrixInteger::SparseData::Scalar>& other
+        ) const {
+        return MatrixSparsePrivate<Scalar>::isEqualTo(other);
+    }
+
+
+    MatrixInteger::Data* MatrixInteger::SparseData::applyTransformAndScaling(
+            bool                           transpose,
+            MatrixInteger::SparseData::Scalar scaleFactor
+        ) const {
+        return transformAndScale<SparseData>(transpose, scaleFactor);
+    }
+
+
+    int MatrixInteger::SparseData::relativeOrder(const MatrixInteger::Data& other) const {
+        int result;
+
+        if (other.matrixType() == MatrixType::SPARSE) {
+            const SparseData& sparseOther = POLYMORPHIC_CAST<const SparseData&>(other);
+            result = MatrixSparsePrivate<Scalar>::relativeOrder(sparseOther);
+        } else {
+            result = static_cast<int>(matrixType()) - static_cast<int>(other.matrixType());
+        }
+
+        return result;
+    }
+}
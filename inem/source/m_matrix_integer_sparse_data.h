@@ -34,13 +34,19 @@
 #include "model_intrinsic_types.h"
 #include "m_matrix_sparse_private.h"
 #include "m_matrix_dense_private.h"
+#include "m_matrix_boolean.h"
+#include "m_matrix_real.h"
+#include "m_matrix_complex.h"
 #include "m_matrix_integer_data.h"
 #include "m_matrix_integer.h"
 
 namespace M {
     /**
      * Private implementation class for \ref M::MatrixInteger.  This class provides the data store and implementation
-     * for integer matricies using a sparse data format.
+     * for integer matricies using a compressed sparse column data format.
+     *
+     * Structural operations, addition, multiplication, and the Hadamard and Kronecker products are performed directly
+     * on the sparse representation.
      */
     class MatrixInteger::SparseData:public MatrixInteger::Data, public MatrixSparsePrivate<Integer> {
         friend class MatrixSparsePrivate<Integer>;
@@ -49,84 +55,107 @@ namespace M {
             /**
              * Constructor
              *
-             * \param[in] newNumberRows        The new number of rows.
-             *
-             * \param[in] newNumberColumns     The new number of columns.
+             * \param[in] newNumberRows    The new number of rows.
              *
-             * \param[in] newAllocationInBytes The size of the allocated data structure, in bytes.
+             * \param[in] newNumberColumns The new number of columns.
              *
-             * \param[in] rawDataBaseAddress   The base address of the raw data stored in the matrix.
+             * \param[in] newCapacity      The initial entry capacity.
              */
             SparseData(
                 unsigned long      newNumberRows,
                 unsigned long      newNumberColumns,
-                unsigned long long newAllocationInBytes,
-                void*              rawDataBaseAddress
+                unsigned long long newCapacity
             );
 
             /**
              * Constructor
              *
-             * \param[in] other                The instance to be copied to this instance.
-             *
-             * \param[in] newAllocationInBytes The size of the allocated data structure, in bytes.
-             *
-             * \param[in] rawDataBaseAddress   The base address of the raw data stored in the matrix.
+             * \param[in] other The instance to be copied to this instance.
              */
-            SparseData(
-                const MatrixDensePrivate<Integer>& other,
-                unsigned long long              newAllocationInBytes,
-                void*                           rawDataBaseAddress
-            );
+            SparseData(const SparseData& other);
 
             /**
              * Constructor
              *
-             * \param[in] other                The instance to be copied to this instance.
+             * \param[in] other            The instance to be copied to this instance.
              *
-             * \param[in] newNumberRows        The new number of rows.
-             *
-             * \param[in] newNumberColumns     The new number of columns.
-             *
-             * \param[in] newAllocationInBytes The size of the allocated data structure, entries.
+             * \param[in] newNumberRows    The new number of rows.
              *
-             * \param[in] rawDataBaseAddress   The base address of the raw data stored in the matrix.
+             * \param[in] newNumberColumns The new number of columns.
              */
             SparseData(
-                const MatrixDensePrivate<Integer>& other,
-                unsigned long                   newNumberRows,
-                unsigned long                   newNumberColumns,
-                unsigned long long              newAllocationInBytes,
-                void*                           rawDataBaseAddress
+                const SparseData& other,
+                unsigned long     newNumberRows,
+                unsigned long     newNumberColumns
             );
 
             ~SparseData() override;
 
         public:
             /**
-             * Method you can call to allocate an instance of this class.
+             * Method you can call to allocate an instance of this class.  The matrix will initially hold no entries.
              *
              * \param[in] newNumberRows    The new number of rows.
              *
              * \param[in] newNumberColumns The new number of columns.
+             *
+             * \param[in] newCapacity      The initial entry capacity.
+             *
+             * \return Returns a pointer to the newly created instance.
              */
             static inline SparseData* create(
-                    unsigned long newNumberRows,
-                    unsigned long newNumberColumns
+                    unsigned long      newNumberRows,
+                    unsigned long      newNumberColumns,
+                    unsigned long long newCapacity = 0
                 ) {
-                (void) newNumberRows;    // FIXME
-                (void) newNumberColumns; // FIXME
+                return MatrixSparsePrivate<Scalar>::create<SparseData>(newNumberRows, newNumberColumns, newCapacity);
+            }
 
-                return nullptr; // FIXME
+            /**
+             * Method that translates dense matrix data to this type.  Only non-zero coefficients are stored.
+             *
+             * \param[in] other The matrix data to be translated.
+             *
+             * \return Returns the translated matrix.
+             */
+            static inline SparseData* create(const MatrixDensePrivate<Integer>& other) {
+                return MatrixSparsePrivate<Scalar>::createFromDense<SparseData>(other);
             }
 
+            /**
+             * Method that translates a sparse matrix of a different type to this type.
+             *
+             * \param[in] other The matrix data to be translated.
+             *
+             * \return Returns the translated matrix.
+             */
+            static SparseData* create(const MatrixBoolean::SparseData& other);
+
+            /**
+             * Method that translates a sparse matrix of a different type to this type.
+             *
+             * \param[in] other The matrix data to be translated.
+             *
+             * \return Returns the translated matrix.
+             */
+            static SparseData* create(const MatrixReal::SparseData& other);
+
+            /**
+             * Method that translates a sparse matrix of a different type to this type.
+             *
+             * \param[in] other The matrix data to be translated.
+             *
+             * \return Returns the translated matrix.
+             */
+            static SparseData* create(const MatrixComplex::SparseData& other);
+
             /**
              * Method you can call to destroy an instance of this class.
              *
              * \param[in] instance The instance to be destroyed.
              */
             static inline void destroy(SparseData* instance) {
-                (void) instance; // FIXME
+                MatrixSparsePrivate<Scalar>::destroy(instance);
             }
 
             /**
@@ -135,9 +164,16 @@ namespace M {
              * \return Returns a newly created instance of this matrix.
              */
             MatrixInteger::Data* clone() const override {
-                return nullptr; // FIXME
+                return MatrixSparsePrivate<Scalar>::create(*this);
             }
 
+            /**
+             * Method you can use to obtain a dense copy of this matrix.
+             *
+             * \return Returns a newly created dense instance holding the same values as this matrix.
+             */
+            MatrixInteger::DenseData* toDense() const;
+
             /**
              * Method you can use to determine the array type.
              *
@@ -155,6 +191,389 @@ namespace M {
             ValueType coefficientType() const override {
                 return ValueType::INTEGER;
             }
+
+            /**
+             * Method you can use to save this matrix to a file in binary format.  This method will throw an exception
+             * if an error occurs and the associated exception is enabled.
+             *
+             * \param[in] filename   The filename to save the file to
+             *
+             * \param[in] fileFormat The desired file format.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool toFile(const char* filename, Model::DataFileFormat fileFormat) const override;
+
+            /**
+             * Method you can use to determine number of matrix rows.
+             *
+             * \return Returns the current number of rows.
+             */
+            unsigned long numberRows() const override {
+                return MatrixSparsePrivate<Scalar>::numberRows();
+            }
+
+            /**
+             * Method you can use to determine the number of matrix columns.
+             *
+             * \return Returns the current number of matrix columns.
+             */
+            unsigned long numberColumns() const override {
+                return MatrixSparsePrivate<Scalar>::numberColumns();
+            }
+
+            /**
+             * Method you can use to obtain the value at a given location.
+             *
+             * \param[in] rowIndex    The zero based row index we want the entry from.
+             *
+             * \param[in] columnIndex The zero based column index we want the entry from.
+             *
+             * \return Returns the value at the specified location.
+             */
+            Scalar at(unsigned long rowIndex, unsigned long columnIndex) const override {
+                return MatrixSparsePrivate<Scalar>::at(rowIndex, columnIndex);
+            }
+
+            /**
+             * Method you can use to obtain the value at a given location.
+             *
+             * \param[in] rowIndex    The zero based row index we want the entry from.
+             *
+             * \param[in] columnIndex The zero based column index we want the entry from.
+             *
+             * \return Returns a reference to the value at the specified location.  The entry will be inserted into the
+             *         matrix if it is not currently stored.
+             */
+            Scalar& at(unsigned long rowIndex, unsigned long columnIndex) override {
+                return MatrixSparsePrivate<Scalar>::at(rowIndex, columnIndex);
+            }
+
+            /**
+             * Method you can use to create a matrix that represents the combination of two other matrices.  The
+             * matrices are combined left to right.
+             *
+             * \param[in] other The matrix to combine to the right of this matrix.
+             *
+             * \return Returns a new matrix representing the combination of the two matrices.
+             */
+            MatrixInteger::Data* combineLeftToRight(const MatrixDensePrivate<Scalar>& other) const override;
+
+            /**
+             * Method you can use to create a matrix that represents the combination of two other matrices.  The
+             * matrices are combined left to right.
+             *
+             * \param[in] other The matrix to combine to the right of this matrix.
+             *
+             * \return Returns a new matrix representing the combination of the two matrices.
+             */
+            MatrixInteger::Data* combineLeftToRight(const MatrixSparsePrivate<Scalar>& other) const override;
+
+            /**
+             * Method you can use to create a matrix that represents the combination of two other matrices.  The
+             * matrices are combined top to bottom.
+             *
+             * \param[in] other The matrix to combine below this matrix.
+             *
+             * \return Returns a new matrix representing the combination of the two matrices.
+             */
+            MatrixInteger::Data* combineTopToBottom(const MatrixDensePrivate<Scalar>& other) const override;
+
+            /**
+             * Method you can use to create a matrix that represents the combination of two other matrices.  The
+             * matrices are combined top to bottom.
+             *
+             * \param[in] other The matrix to combine below this matrix.
+             *
+             * \return Returns a new matrix representing the combination of the two matrices.
+             */
+            MatrixInteger::Data* combineTopToBottom(const MatrixSparsePrivate<Scalar>& other) const override;
+
+            /**
+             * Method you can use to reverse the columns in this matrix.
+             *
+             * \return Returns a column-reversed version of this matrix.
+             */
+            MatrixInteger::Data* columnReverse() const override;
+
+            /**
+             * Method you can use to reverse the rows in this matrix.
+             *
+             * \return Returns a row-reversed version of this matrix.
+             */
+            MatrixInteger::Data* rowReverse() const override;
+
+            /**
+             * Method you can call to resize this matrix to a specific dimension.
+             *
+             * \param[in] newNumberRows    The new number of rows for the array.
+             *
+             * \param[in] newNumberColumns The new number of columns for the array.
+             *
+             * \param[in] alwaysReallocate if true, then this method will always create a new array instance.  If
+             *                             false, then this method may try to preserve the existing array depending on
+             *                             the magnitude of the size change.
+             *
+             * \return Returns either a pointer to this object or a newly initialized instance if the object size
+             *         could not support the matrix.  Note that reducing the array size may also cause a new instance
+             *         to be allocated.
+             */
+            MatrixInteger::Data* resizeTo(
+                    unsigned long newNumberRows,
+                    unsigned long newNumberColumns,
+                    bool          alwaysReallocate = false
+                ) override;
+
+            /**
+             * Method you can call attempt a resize-in-place.
+             *
+             * \param[in] newNumberRows    The new number of rows for the array.
+             *
+             * \param[in] newNumberColumns The new number of columns for the array.
+             *
+             * \return Returns true on success, returns false if the matrix could not be adjusted in-place to the new
+             *         size.
+             */
+            bool resizeInPlaceTo(unsigned long newNumberRows, unsigned long newNumberColumns) override;
+
+            /**
+             * Method you can use to obtain the raw data tracked by this matrix.  Sparse matrices do not maintain a
+             * contiguous column major image of their coefficients so this method always returns a null pointer.
+             * Convert the matrix to a dense representation if you need direct access to the coefficients.
+             *
+             * \return Returns a null pointer.
+             */
+            const Scalar* data() const override {
+                return nullptr;
+            }
+
+            /**
+             * Method you can use to obtain the raw data tracked by this matrix.  Sparse matrices do not maintain a
+             * contiguous column major image of their coefficients so this method always returns a null pointer.
+             * Convert the matrix to a dense representation if you need direct access to the coefficients.
+             *
+             * \return Returns a null pointer.
+             */
+            Scalar* data() override {
+                return nullptr;
+            }
+
+
+            /**
+             * Method that calculates the Hadamard or Schur product of this matrix and another matrix.
+             *
+             * \param[in] other The matrix to multiply against this matrix.
+             *
+             * \return Returns the Hadamard product of the two matrices.
+             */
+            Data* hadamard(const MatrixDensePrivate<Scalar>& other) const override;
+
+            /**
+             * Method that calculates the Hadamard or Schur product of this matrix and another matrix.
+             *
+             * \param[in] other The matrix to multiply against this matrix.
+             *
+             * \return Returns the Hadamard product of the two matrices.
+             */
+            Data* hadamard(const MatrixSparsePrivate<Scalar>& other) const override;
+
+            /**
+             * Method that calculates the Kronecker product of this matrix and another matrix.
+             *
+             * \param[in] other            The matrix to multiply against this matrix.
+             *
+             * \param[in] otherTranspose   If true, the other matrix should be transposed before performing this
+             *                             opration.
+             *
+             * \param[in] scalarMultiplier A scalar multiplier to be applied.
+             *
+             * \return Returns the Kronecker product of the two matrices.
+             */
+            Data* kronecker(
+                const MatrixDensePrivate<Scalar>& other,
+                bool                              otherTranspose,
+                Scalar                            scalarMultiplier
+            ) const override;
+
+            /**
+             * Method that calculates the Kronecker product of this matrix and another matrix.
+             *
+             * \param[in] other            The matrix to multiply against this matrix.
+             *
+             * \param[in] otherTranspose   If true, the other matrix should be transposed before performing this
+             *                             opration.
+             *
+             * \param[in] scalarMultiplier A scalar multiplier to be applied.
+             *
+             * \return Returns the Kronecker product of the two matrices.
+             */
+            Data* kronecker(
+                const MatrixSparsePrivate<Scalar>& other,
+                bool                               otherTranspose,
+                Scalar                             scalarMultiplier
+            ) const override;
+
+            /**
+             * Method you can call to add this matrix to another matrix.
+             *
+             * \param[in] addend          The instance to be added to this instance.
+             *
+             * \param[in] augendTranspose Indicates that transpose needs to be performed on the augend (left value)
+             *                            prior to performing the addition.  The augend (this data instance) will not
+             *                            be modified.
+             *
+             * \param[in] addendTranspose Indicates that transpose needs to be performed on the added (right value)
+             *                            prior to performing the addition.  The addend will not be modified.
+             *
+             * \param[in] augendScalar    A scalar value to be multiplied to the augend prior to the addition.
+             *
+             * \param[in] addendScalar    A scalar value to be multiplied to the addend prior to the addition.
+             *
+             * \return Returns a new matrix representing the sum of the two matrices.
+             */
+            Data* add(
+                const MatrixDensePrivate<Scalar>& addend,
+                bool                              augendTranspose,
+                bool                              addendTranspose,
+                Scalar                            augendScalar,
+                Scalar                            addendScalar
+            ) const override;
+
+            /**
+             * Method you can call to add this matrix to another matrix.
+             *
+             * \param[in] addend          The instance to be added to this instance.
+             *
+             * \param[in] augendTranspose Indicates that transpose needs to be performed on the augend (left value)
+             *                            prior to performing the addition.  The augend (this data instance) will not
+             *                            be modified.
+             *
+             * \param[in] addendTranspose Indicates that transpose needs to be performed on the added (right value)
+             *                            prior to performing the addition.  The addend will not be modified.
+             *
+             * \param[in] augendScalar    A scalar value to be multiplied to the augend prior to the addition.
+             *
+             * \param[in] addendScalar    A scalar value to be multiplied to the addend prior to the addition.
+             *
+             * \return Returns a new matrix representing the sum of the two matrices.
+             */
+            Data* add(
+                const MatrixSparsePrivate<Scalar>& addend,
+                bool                               augendTranspose,
+                bool                               addendTranspose,
+                Scalar                             augendScalar,
+                Scalar                             addendScalar
+            ) const override;
+
+            /**
+             * Method you can call to multiply this matrix to another matrix.
+             *
+             * \param[in] multiplicand          The instance to be multiplied to this instance.
+             *
+             * \param[in] multiplierTranspose   Indicates that a transpose needs to be performed on the multiplier
+             *                                  during the multiplication. The multiplier will not be modified during
+             *                                  the operation.
+             *
+             * \param[in] multiplicandTranspose Indicates that a transpose needs to be performed on the multiplicand
+             *                                  during the multiplication. The multiplicand will not be modified during
+             *                                  the operation.
+             *
+             * \param[in] scalerMultiplier      A scaler multiplier to be applied to the multiplication operation.
+             *
+             * \return Returns a new matrix representing the product of the two matrices.
+             */
+            Data* multiply(
+                const MatrixDensePrivate<Scalar>& multiplicand,
+                bool                              multiplierTranspose,
+                bool                              multiplicandTranspose,
+                Scalar                            scalerMultiplier
+            ) const override;
+
+            /**
+             * Method you can call to multiply this matrix to another matrix.
+             *
+             * \param[in] multiplicand          The instance to be multiplied to this instance.
+             *
+             * \param[in] multiplierTranspose   Indicates that a transpose needs to be performed on the multiplier
+             *                                  during the multiplication. The multiplier will not be modified during
+             *                                  the operation.
+             *
+             * \param[in] multiplicandTranspose Indicates that a transpose needs to be performed on the multiplicand
+             *                                  during the multiplication. The multiplicand will not be modified during
+             *                                  the operation.
+             *
+             * \param[in] scalerMultiplier      A scaler multiplier to be applied to the multiplication operation.
+             *
+             * \return Returns a new matrix representing the product of the two matrices.
+             */
+            Data* multiply(
+                const MatrixSparsePrivate<Scalar>& multiplicand,
+                bool                               multiplierTranspose,
+                bool                               multiplicandTranspose,
+                Scalar                             scalerMultiplier
+            ) const override;
+
+            /**
+             * Method you can call to divide this matrix by a scalar value.
+             *
+             * \param[in] transpose        Indicates that a transpose needs to be performed on the multiplier during
+             *                             the multiplication. The multiplier will not be modified during the
+             *                             operation.
+             *
+             * \param[in] scalarMultiplier A scaler multiplier to be applied to the multiplication operation.  The
+             *                             scalar is applied before the divide operation.
+             *
+             * \param[in] scalarDivisor    The scalar divisor.  This will be applied after the multiplier.
+             *
+             * \return Returns a new matrix representing the quotient.
+             */
+            Data* divide(bool transpose, Integer scalarMultiplier, Integer scalarDivisor) const override;
+
+            /**
+             * Method that compares this matrix against another matrix.  This version supports integer types.
+             *
+             * \param[in] other The matrix to be compared against.
+             *
+             * \return Returns true if the matrices are equal.  Returns false if the matrices are not equal.
+             */
+            bool isEqualTo(const MatrixDensePrivate<Scalar>& other) const override;
+
+            /**
+             * Method that compares this matrix against another matrix.  This version supports integer types.
+             *
+             * \param[in] other The matrix to be compared against.
+             *
+             * \return Returns true if the matrices are equal.  Returns false if the matrices are not equal.
+             */
+            bool isEqualTo(const MatrixSparsePrivate<Scalar>& other) const override;
+
+            /**
+             * Method that applies a requested transform and scaling.
+             *
+             * \param[in] transpose   If true, the matrix will be transposed.
+             *
+             * \param[in] scaleFactor The desired scale factor.
+             *
+             * \return Returns a pointer to the newly transformed and scaled instance.
+             */
+            Data* applyTransformAndScaling(bool transpose, Scalar scaleFactor) const override;
+
+            /**
+             * Method you can call to determine the recommended ordering of this matrix data relative to another
+             * matrix data instance.  Ordering is based on:
+             *
+             *     * The type of the underlying data.
+             *
+             *     * Number of matrix rows and columns.
+             *
+             *     * Value of each byte in the matrix.
+             *
+             * \param[in] other The other set to compare against.
+             *
+             * \return Returns a negative value if this matrix should precede the order matrix.  Returns 0 if the
+             *         matrices are equal.  Returns a positive value if this matrix should follow the other matrix.
+             */
+            int relativeOrder(const MatrixInteger::Data& other) const override;
     };
 }
 
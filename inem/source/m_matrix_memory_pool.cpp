@@ -0,0 +1,532 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::MatrixMemoryPool class.
+***********************************************************************************************************************/
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+
+#if (defined(_MSC_VER))
+
+    #define NOMINMAX
+    #include <windows.h>
+
+#else
+
+    #include <sys/mman.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+
+#endif
+
+#include <mat_api.h>
+
+#include "m_matrix_memory_pool.h"
+
+namespace M {
+    /**
+     * Log base 2 of the smallest pooled block size, in bytes.
+     */
+    static constexpr unsigned smallestBlockShift = 6;
+
+    /**
+     * The number of size classes.  Four classes are used for each power of two up to the largest pooled block.
+     */
+    static constexpr unsigned numberSizeClasses = 4 * (24 - smallestBlockShift + 1);
+
+    /**
+     * Size class index used to mark blocks that are not pooled.
+     */
+    static constexpr std::uint64_t unpooledBlock = static_cast<std::uint64_t>(-1);
+
+    /**
+     * Size class index used to mark blocks that live in a disk backed scratch file.
+     */
+    static constexpr std::uint64_t outOfCoreBlock = static_cast<std::uint64_t>(-2);
+
+    /**
+     * Header placed in front of every block.  The header is padded to the memory alignment requirement so the space
+     * returned to the caller remains aligned.
+     */
+    struct BlockHeader {
+        /**
+         * The size class of the block or unpooledBlock.
+         */
+        std::uint64_t sizeClass;
+
+        /**
+         * The next free block in the same size class.  Only used while the block is held by the pool.
+         */
+        BlockHeader* nextFree;
+
+        /**
+         * The size of the mapped region, in bytes.  Only used for out-of-core blocks.
+         */
+        std::uint64_t mappedSizeInBytes;
+    };
+
+    /**
+     * Function that calculates the size class for a block.
+     *
+     * \param[in] bytes The required block size, including the header.
+     *
+     * \return Returns the size class index.
+     */
+    static inline unsigned sizeClassIndex(unsigned long long bytes) {
+        unsigned long long v   = std::max(bytes, 1ULL << smallestBlockShift) - 1;
+        unsigned           msb = smallestBlockShift - 1;
+        while ((v >> (msb + 1)) != 0) {
+            ++msb;
+        }
+
+        unsigned sub = static_cast<unsigned>(v >> (msb - 2)) & 3;
+        return 4 * (msb - (smallestBlockShift - 1)) + sub;
+    }
+
+    /**
+     * Function that calculates the block size for a size class.
+     *
+     * \param[in] sizeClass The size class index.
+     *
+     * \return Returns the size of blocks in this size class, in bytes.
+     */
+    static inline unsigned long long sizeClassBytes(unsigned sizeClass) {
+        unsigned shift = sizeClass / 4 + smallestBlockShift - 3;
+        return static_cast<unsigned long long>(5 + (sizeClass & 3)) << shift;
+    }
+
+    /**
+     * Function that calculates the header size for a given memory alignment.
+     *
+     * \param[in] matrixApi The matrix API.
+     *
+     * \return Returns the padded header size, in bytes.
+     */
+    static inline unsigned long long headerBytes(const MatApi* matrixApi) {
+        unsigned long long alignment = matrixApi->memoryAlignmentRequirementBytes;
+        unsigned long long size      = sizeof(BlockHeader);
+
+        if (alignment > 1) {
+            size = ((size + alignment - 1) / alignment) * alignment;
+        }
+
+        return size;
+    }
+
+    /**
+     * The maximum number of bytes cached by each thread.
+     */
+    static std::atomic<unsigned long long> currentMaximumCachedBytes(MatrixMemoryPool::defaultMaximumCachedBytes);
+
+    /**
+     * The size above which blocks are placed in scratch files.  A value of 0 disables scratch files.
+     */
+    static std::atomic<unsigned long long> currentOutOfCoreThresholdBytes(0);
+
+    /**
+     * Mutex used to guard the scratch file directory.
+     */
+    static std::mutex outOfCoreDirectoryMutex;
+
+    /**
+     * The directory used to hold scratch files.  An empty string selects the system temporary directory.
+     */
+    static std::string currentOutOfCoreDirectory;
+
+    /**
+     * Function that creates a zero filled, disk backed region.  Disk space for the entire region is reserved up front
+     * so that later writes to the region can not fault when the disk fills.  The scratch file is removed from the file
+     * system once the region is unmapped.
+     *
+     * \param[in] sizeInBytes The required region size, in bytes.
+     *
+     * \return Returns the base address of the region.  A null pointer is returned on error.
+     */
+    static void* mapScratchRegion(unsigned long long sizeInBytes) {
+        void*       result = nullptr;
+        std::string directory;
+
+        {
+            std::lock_guard<std::mutex> lock(outOfCoreDirectoryMutex);
+            directory = currentOutOfCoreDirectory;
+        }
+
+        #if (defined(_MSC_VER))
+
+            char temporaryPath[MAX_PATH + 1];
+            if (directory.empty() && GetTempPathA(MAX_PATH + 1, temporaryPath) != 0) {
+                directory = temporaryPath;
+            }
+
+            char filename[MAX_PATH + 1];
+            if (GetTempFileNameA(directory.c_str(), "inm", 0, filename) != 0) {
+                HANDLE fileHandle = CreateFileA(
+                    filename,
+                    GENERIC_READ | GENERIC_WRITE,
+                    0,
+                    nullptr,
+                    CREATE_ALWAYS,
+                    FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE,
+                    nullptr
+                );
+
+                if (fileHandle != INVALID_HANDLE_VALUE) {
+                    HANDLE mappingHandle = CreateFileMappingA(
+                        fileHandle,
+                        nullptr,
+                        PAGE_READWRITE,
+                        static_cast<DWORD>(sizeInBytes >> 32),
+                        static_cast<DWORD>(sizeInBytes),
+                        nullptr
+                    );
+
+                    if (mappingHandle != nullptr) {
+                        result = MapViewOfFile(mappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+                        CloseHandle(mappingHandle);
+                    }
+
+                    CloseHandle(fileHandle);
+                } else {
+                    DeleteFileA(filename);
+                }
+            }
+
+        #else
+
+            if (directory.empty()) {
+                const char* temporaryDirectory = std::getenv("TMPDIR");
+                directory = temporaryDirectory != nullptr ? temporaryDirectory : "/tmp";
+            }
+
+            std::string filename = directory + "/inem_scratch_XXXXXX";
+            int         fileDescriptor = mkstemp(&filename[0]);
+
+            if (fileDescriptor >= 0) {
+                // The file is unlinked immediately so the space is reclaimed when the region is unmapped, even if the
+                // process terminates abnormally.
+
+                unlink(filename.c_str());
+
+                #if (defined(__APPLE__))
+
+                    fstore_t store = { F_ALLOCATEALL, F_PEOFPOSMODE, 0, static_cast<off_t>(sizeInBytes), 0 };
+                    bool     reserved = (
+                           fcntl(fileDescriptor, F_PREALLOCATE, &store) != -1
+                        && ftruncate(fileDescriptor, static_cast<off_t>(sizeInBytes)) == 0
+                    );
+
+                #else
+
+                    bool reserved = (posix_fallocate(fileDescriptor, 0, static_cast<off_t>(sizeInBytes)) == 0);
+
+                #endif
+
+                if (reserved) {
+                    void* mapping = mmap(
+                        nullptr,
+                        static_cast<std::size_t>(sizeInBytes),
+                        PROT_READ | PROT_WRITE,
+                        MAP_SHARED,
+                        fileDescriptor,
+                        0
+                    );
+
+                    if (mapping != MAP_FAILED) {
+                        result = mapping;
+                    }
+                }
+
+                close(fileDescriptor);
+            }
+
+        #endif
+
+        return result;
+    }
+
+    /**
+     * Function that releases a region created by \ref M::mapScratchRegion.
+     *
+     * \param[in] baseAddress The base address of the region.
+     *
+     * \param[in] sizeInBytes The size of the region, in bytes.
+     */
+    static void unmapScratchRegion(void* baseAddress, unsigned long long sizeInBytes) {
+        #if (defined(_MSC_VER))
+
+            (void) sizeInBytes;
+            UnmapViewOfFile(baseAddress);
+
+        #else
+
+            munmap(baseAddress, static_cast<std::size_t>(sizeInBytes));
+
+        #endif
+    }
+
+    /**
+     * Class holding the free lists for a single thread.
+     */
+    class ThreadMemoryPool {
+        public:
+            ThreadMemoryPool() {
+                std::fill(freeLists, freeLists + numberSizeClasses, nullptr);
+
+                statistics.numberAllocations    = 0;
+                statistics.numberPoolHits       = 0;
+                statistics.numberReleases       = 0;
+                statistics.numberPooledReleases = 0;
+                statistics.numberTrimmedBlocks  = 0;
+                statistics.cachedBytes          = 0;
+
+                statistics.numberOutOfCoreAllocations = 0;
+
+                matrixApi = nullptr;
+            }
+
+            ~ThreadMemoryPool() {
+                trim(0);
+            }
+
+            /**
+             * Method that releases pooled blocks, largest first, until at most the requested number of bytes are
+             * cached.
+             *
+             * \param[in] limit The maximum number of bytes to remain cached.
+             */
+            void trim(unsigned long long limit) {
+                unsigned sizeClass = numberSizeClasses;
+                while (statistics.cachedBytes > limit && sizeClass > 0) {
+                    --sizeClass;
+                    while (statistics.cachedBytes > limit && freeLists[sizeClass] != nullptr) {
+                        BlockHeader* header = freeLists[sizeClass];
+                        freeLists[sizeClass] = header->nextFree;
+
+                        (*matrixApi->releaseMemory)(header);
+
+                        statistics.cachedBytes -= sizeClassBytes(sizeClass);
+                        ++statistics.numberTrimmedBlocks;
+                    }
+                }
+            }
+
+            /**
+             * The free list for each size class.
+             */
+            BlockHeader* freeLists[numberSizeClasses];
+
+            /**
+             * The pool counters.
+             */
+            MatrixMemoryPool::Statistics statistics;
+
+            /**
+             * The matrix API used to allocate the pooled blocks.
+             */
+            const MatApi* matrixApi;
+    };
+
+    /**
+     * The pool for the current thread.
+     */
+    static thread_local ThreadMemoryPool threadMemoryPool;
+
+    /**
+     * Function that allocates a block in a disk backed scratch file.
+     *
+     * \param[in] requiredSize The required block size, including the header.
+     *
+     * \return Returns the block header.  A null pointer is returned on error.
+     */
+    static BlockHeader* allocateOutOfCore(unsigned long long requiredSize) {
+        BlockHeader* header = reinterpret_cast<BlockHeader*>(mapScratchRegion(requiredSize));
+
+        if (header != nullptr) {
+            header->sizeClass         = outOfCoreBlock;
+            header->mappedSizeInBytes = requiredSize;
+
+            ++threadMemoryPool.statistics.numberOutOfCoreAllocations;
+        }
+
+        return header;
+    }
+
+    constexpr unsigned long long MatrixMemoryPool::defaultMaximumCachedBytes;
+    constexpr unsigned long long MatrixMemoryPool::largestPooledBlock;
+
+    void MatrixMemoryPool::setMaximumCachedBytes(unsigned long long newMaximumCachedBytes) {
+        currentMaximumCachedBytes.store(newMaximumCachedBytes, std::memory_order_relaxed);
+    }
+
+
+    unsigned long long MatrixMemoryPool::maximumCachedBytes() {
+        return currentMaximumCachedBytes.load(std::memory_order_relaxed);
+    }
+
+
+    void MatrixMemoryPool::setOutOfCoreThresholdBytes(unsigned long long newThresholdBytes) {
+        currentOutOfCoreThresholdBytes.store(newThresholdBytes, std::memory_order_relaxed);
+    }
+
+
+    unsigned long long MatrixMemoryPool::outOfCoreThresholdBytes() {
+        return currentOutOfCoreThresholdBytes.load(std::memory_order_relaxed);
+    }
+
+
+    void MatrixMemoryPool::setOutOfCoreDirectory(const std::string& newDirectory) {
+        std::lock_guard<std::mutex> lock(outOfCoreDirectoryMutex);
+        currentOutOfCoreDirectory = newDirectory;
+    }
+
+
+    std::string MatrixMemoryPool::outOfCoreDirectory() {
+        std::lock_guard<std::mutex> lock(outOfCoreDirectoryMutex);
+        return currentOutOfCoreDirectory;
+    }
+
+
+    void MatrixMemoryPool::trim() {
+        threadMemoryPool.trim(0);
+    }
+
+
+    MatrixMemoryPool::Statistics MatrixMemoryPool::statistics() {
+        return threadMemoryPool.statistics;
+    }
+
+
+    void MatrixMemoryPool::resetStatistics() {
+        Statistics& statistics = threadMemoryPool.statistics;
+
+        statistics.numberAllocations    = 0;
+        statistics.numberPoolHits       = 0;
+        statistics.numberReleases       = 0;
+        statistics.numberPooledReleases = 0;
+        statistics.numberTrimmedBlocks  = 0;
+
+        statistics.numberOutOfCoreAllocations = 0;
+    }
+
+
+    void* MatrixMemoryPool::allocate(const MatApi* matrixApi, unsigned long long space) {
+        ThreadMemoryPool&  pool         = threadMemoryPool;
+        unsigned long long headerSize   = headerBytes(matrixApi);
+        unsigned long long requiredSize = space + headerSize;
+        unsigned long long threshold    = currentOutOfCoreThresholdBytes.load(std::memory_order_relaxed);
+        bool               outOfCore    = (threshold != 0 && requiredSize >= threshold);
+
+        ++pool.statistics.numberAllocations;
+
+        BlockHeader* header = outOfCore ? allocateOutOfCore(requiredSize) : nullptr;
+        if (header == nullptr) {
+            if (requiredSize <= largestPooledBlock) {
+                unsigned sizeClass = sizeClassIndex(requiredSize);
+
+                header = pool.freeLists[sizeClass];
+                if (header != nullptr && pool.matrixApi == matrixApi) {
+                    pool.freeLists[sizeClass] = header->nextFree;
+                    pool.statistics.cachedBytes -= sizeClassBytes(sizeClass);
+                    ++pool.statistics.numberPoolHits;
+                } else {
+                    void* block = (*matrixApi->allocateMemory)(
+                        sizeClassBytes(sizeClass),
+                        matrixApi->memoryAlignmentRequirementBytes
+                    );
+
+                    header = reinterpret_cast<BlockHeader*>(block);
+                }
+
+                if (header != nullptr) {
+                    header->sizeClass = sizeClass;
+                }
+            } else {
+                void* block = (*matrixApi->allocateMemory)(requiredSize, matrixApi->memoryAlignmentRequirementBytes);
+                header = reinterpret_cast<BlockHeader*>(block);
+
+                if (header != nullptr) {
+                    header->sizeClass = unpooledBlock;
+                }
+            }
+
+            if (header == nullptr && !outOfCore && threshold != 0) {
+                header = allocateOutOfCore(requiredSize);
+            }
+        }
+
+        return header != nullptr ? reinterpret_cast<std::uint8_t*>(header) + headerSize : nullptr;
+    }
+
+
+    void MatrixMemoryPool::release(const MatApi* matrixApi, void* p) {
+        ThreadMemoryPool& pool   = threadMemoryPool;
+        BlockHeader*      header = reinterpret_cast<BlockHeader*>(
+            reinterpret_cast<std::uint8_t*>(p) - headerBytes(matrixApi)
+        );
+
+        ++pool.statistics.numberReleases;
+
+        if (header->sizeClass == outOfCoreBlock) {
+            unmapScratchRegion(header, header->mappedSizeInBytes);
+        } else {
+            bool pooled = false;
+            if (header->sizeClass != unpooledBlock) {
+                unsigned           sizeClass = static_cast<unsigned>(header->sizeClass);
+                unsigned long long blockSize = sizeClassBytes(sizeClass);
+                unsigned long long limit     = currentMaximumCachedBytes.load(std::memory_order_relaxed);
+
+                if (pool.matrixApi != matrixApi) {
+                    if (pool.matrixApi != nullptr) {
+                        pool.trim(0);
+                    }
+
+                    pool.matrixApi = matrixApi;
+                }
+
+                if (pool.statistics.cachedBytes + blockSize > limit) {
+                    pool.trim(limit / 2);
+                }
+
+                if (pool.statistics.cachedBytes + blockSize <= limit) {
+                    header->nextFree = pool.freeLists[sizeClass];
+                    pool.freeLists[sizeClass] = header;
+
+                    pool.statistics.cachedBytes += blockSize;
+                    ++pool.statistics.numberPooledReleases;
+
+                    pooled = true;
+                }
+            }
+
+            if (!pooled) {
+                (*matrixApi->releaseMemory)(header);
+            }
+        }
+    }
+}
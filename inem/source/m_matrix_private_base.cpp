@@ -27,16 +27,32 @@
 
 #include <new>
 #include <cstring>
+#include <cstdio>
 #include <cassert>
 #include <cstdint>
 #include <cassert>
 #include <algorithm>
 
+#if (defined(_MSC_VER))
+
+    #define NOMINMAX
+    #include <windows.h>
+
+#else
+
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+
+#endif
+
 #include <mat_api.h>
 
 #include "m_api_types.h"
 #include "m_intrinsic_types.h"
 #include "model_exceptions.h"
+#include "m_matrix_memory_pool.h"
 #include "m_matrix_private_base.h"
 
 extern "C" typedef struct _MatApi MatApi;
@@ -82,8 +98,102 @@ namespace M {
     }
 
 
+    void* MatrixPrivateBase::mapFile(const char* filename, unsigned long long& sizeInBytes) {
+        void* result = nullptr;
+
+        #if (defined(_MSC_VER))
+
+            HANDLE fileHandle = CreateFileA(
+                filename,
+                GENERIC_READ,
+                FILE_SHARE_READ,
+                nullptr,
+                OPEN_EXISTING,
+                FILE_ATTRIBUTE_NORMAL,
+                nullptr
+            );
+
+            if (fileHandle != INVALID_HANDLE_VALUE) {
+                LARGE_INTEGER fileSize;
+                if (GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0) {
+                    HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                    if (mappingHandle != nullptr) {
+                        result = MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0);
+                        if (result != nullptr) {
+                            sizeInBytes = static_cast<unsigned long long>(fileSize.QuadPart);
+                        }
+
+                        CloseHandle(mappingHandle);
+                    }
+                }
+
+                CloseHandle(fileHandle);
+            }
+
+        #else
+
+            int fileDescriptor = open(filename, O_RDONLY);
+            if (fileDescriptor >= 0) {
+                struct stat fileStatus;
+                if (fstat(fileDescriptor, &fileStatus) == 0 && fileStatus.st_size > 0) {
+                    std::size_t mappingSize = static_cast<std::size_t>(fileStatus.st_size);
+                    void*       mapping     = mmap(
+                        nullptr,
+                        mappingSize,
+                        PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE,
+                        fileDescriptor,
+                        0
+                    );
+
+                    if (mapping != MAP_FAILED) {
+                        result      = mapping;
+                        sizeInBytes = static_cast<unsigned long long>(mappingSize);
+                    }
+                }
+
+                close(fileDescriptor);
+            }
+
+        #endif
+
+        return result;
+    }
+
+
+    void MatrixPrivateBase::unmapFile(void* baseAddress, unsigned long long sizeInBytes) {
+        #if (defined(_MSC_VER))
+
+            (void) sizeInBytes;
+            UnmapViewOfFile(baseAddress);
+
+        #else
+
+            munmap(baseAddress, static_cast<std::size_t>(sizeInBytes));
+
+        #endif
+    }
+
+
+    bool MatrixPrivateBase::replaceFile(const char* sourceFilename, const char* destinationFilename) {
+        bool result;
+
+        #if (defined(_MSC_VER))
+
+            result = (MoveFileExA(sourceFilename, destinationFilename, MOVEFILE_REPLACE_EXISTING) != 0);
+
+        #else
+
+            result = (std::rename(sourceFilename, destinationFilename) == 0);
+
+        #endif
+
+        return result;
+    }
+
+
     void* MatrixPrivateBase::malloc(unsigned long long space) {
-        void* p = (*currentMatrixApi->allocateMemory)(space, currentMatrixApi->memoryAlignmentRequirementBytes);
+        void* p = MatrixMemoryPool::allocate(currentMatrixApi, space);
 
         if (p == nullptr) {
             throw Model::InsufficientMemory();
@@ -94,6 +204,6 @@ namespace M {
 
 
     void MatrixPrivateBase::free(void* p) {
-        (*currentMatrixApi->releaseMemory)(p);
+        MatrixMemoryPool::release(currentMatrixApi, p);
     }
 }
@@ -56,6 +56,40 @@ namespace M {
              */
             static void setMatrixApi(const MatApi* matrixApi);
 
+            /**
+             * Method you can call to map a file into memory.  The mapping is private so changes made through the
+             * mapping are copied on write and are never written back to the file.
+             *
+             * \param[in]  filename    The name of the file to be mapped.
+             *
+             * \param[out] sizeInBytes The size of the mapped region, in bytes.
+             *
+             * \return Returns the base address of the mapped region.  A null pointer is returned if the file could
+             *         not be mapped.
+             */
+            static void* mapFile(const char* filename, unsigned long long& sizeInBytes);
+
+            /**
+             * Method you should call to release a region previously mapped with \ref M::MatrixPrivateBase::mapFile.
+             *
+             * \param[in] baseAddress The base address of the mapped region.
+             *
+             * \param[in] sizeInBytes The size of the mapped region, in bytes.
+             */
+            static void unmapFile(void* baseAddress, unsigned long long sizeInBytes);
+
+            /**
+             * Method you can call to move a file over another file, replacing it.  Regions mapped from the replaced
+             * file with \ref M::MatrixPrivateBase::mapFile keep their contents.
+             *
+             * \param[in] sourceFilename      The name of the file to be moved.
+             *
+             * \param[in] destinationFilename The name of the file to be replaced.
+             *
+             * \return Returns true on success.  Returns false if the file could not be moved.
+             */
+            static bool replaceFile(const char* sourceFilename, const char* destinationFilename);
+
         protected:
             /**
              * Method you can use to obtain the matrix library API.
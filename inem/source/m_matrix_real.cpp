@@ -26,6 +26,7 @@
 ***********************************************************************************************************************/
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 
 #include "m_api_types.h"
@@ -57,15 +58,29 @@
 #include "m_matrix_real_data.h"
 #include "m_matrix_real_dense_data.h"
 #include "m_matrix_real_sparse_data.h"
+#include "m_matrix_small_private.h"
 
 namespace M {
+    static std::atomic<Real>               currentSparseDensityThreshold(0.05);
+    static std::atomic<Real>               currentDenseDensityThreshold(0.25);
+    static std::atomic<unsigned long long> currentAutomaticStorageMinimumCoefficients(4096);
+
+    static_assert(
+        MatrixSmallPrivate<MatrixReal::Scalar>::maximumDimension == 4,
+        "Inline small matrix storage does not match the small matrix kernels."
+    );
+
     MatrixReal::MatrixReal(Integer newNumberRows, Integer newNumberColumns) {
         if (newNumberRows < 0) {
             throw Model::InvalidRow(newNumberRows, 0);
         } else if (newNumberColumns < 0) {
             throw Model::InvalidColumn(newNumberColumns, 0);
+        } else if (MatrixSmallPrivate<Scalar>::isSmall(newNumberRows, newNumberColumns)) {
+            configureSmallStorage(newNumberRows, newNumberColumns);
+            std::fill(smallCoefficients, smallCoefficients + newNumberRows * newNumberColumns, Scalar(0));
         } else {
             currentData = DenseData::create(newNumberRows, newNumberColumns);
+            currentView.parent = nullptr;
             pendingTranspose   = false;
             pendingScalarValue = Scalar(1);
         }
@@ -77,8 +92,12 @@ namespace M {
             throw Model::InvalidRow(newNumberRows, 0);
         } else if (newNumberColumns < 0) {
             throw Model::InvalidColumn(newNumberColumns, 0);
+        } else if (MatrixSmallPrivate<Scalar>::isSmall(newNumberRows, newNumberColumns)) {
+            configureSmallStorage(newNumberRows, newNumberColumns);
+            std::copy(matrixData, matrixData + newNumberRows * newNumberColumns, smallCoefficients);
         } else {
             currentData = DenseData::create(newNumberRows, newNumberColumns, matrixData);
+            currentView.parent = nullptr;
             pendingTranspose   = false;
             pendingScalarValue = Scalar(1);
         }
@@ -96,11 +115,12 @@ namespace M {
 
 
     MatrixReal::MatrixReal(const MatrixReal& other) {
-        other.currentData->addReference();
-        currentData = other.currentData;
+        copyStorage(other);
+    }
 
-        pendingTranspose   = other.pendingTranspose;
-        pendingScalarValue = other.pendingScalarValue;
+
+    MatrixReal::MatrixReal(MatrixReal&& other) noexcept {
+        moveStorage(other);
     }
 
 
@@ -114,11 +134,7 @@ namespace M {
         MatrixReal v = other.toMatrixReal(&ok);
 
         if (ok) {
-            v.currentData->addReference();
-            currentData = v.currentData;
-
-            pendingTranspose   = v.pendingTranspose;
-            pendingScalarValue = v.pendingScalarValue;
+            copyStorage(v);
         } else {
             throw Model::InvalidRuntimeConversion(other.valueType(), ValueType::MATRIX_REAL);
         }
@@ -126,7 +142,7 @@ namespace M {
 
 
     MatrixReal::~MatrixReal() {
-        releaseDataStore(currentData);
+        releaseStorage();
     }
 
 
@@ -136,36 +152,69 @@ namespace M {
 
 
     bool MatrixReal::toFile(const char* filename, Model::DataFileFormat fileFormat) const {
-        return currentData->toFile(filename, fileFormat);
+        applyLazyTransformsAndScaling();
+        return dataStore()->toFile(filename, fileFormat);
     }
 
 
     MatrixReal MatrixReal::fromFile(const char* filename) {
-        return MatrixReal(DenseData::fromFile(filename));
+        MatrixReal result(DenseData::fromFile(filename));
+        result.applyStoragePolicy();
+
+        return result;
     }
 
 
     MatrixReal::Index MatrixReal::numberRows() const {
-        return pendingTranspose ? currentData->numberColumns() : currentData->numberRows();
+        Index result;
+
+        if (hasSmallStorage()) {
+            result = pendingTranspose ? smallNumberColumns : smallNumberRows;
+        } else if (currentData == nullptr) {
+            result = pendingTranspose ? currentView.numberColumns : currentView.numberRows;
+        } else {
+            result = pendingTranspose ? currentData->numberColumns() : currentData->numberRows();
+        }
+
+        return result;
     }
 
 
     MatrixReal::Index MatrixReal::numberColumns() const {
-        return pendingTranspose ? currentData->numberRows() : currentData->numberColumns();
+        Index result;
+
+        if (hasSmallStorage()) {
+            result = pendingTranspose ? smallNumberRows : smallNumberColumns;
+        } else if (currentData == nullptr) {
+            result = pendingTranspose ? currentView.numberRows : currentView.numberColumns;
+        } else {
+            result = pendingTranspose ? currentData->numberRows() : currentData->numberColumns();
+        }
+
+        return result;
     }
 
 
     MatrixReal::Index MatrixReal::numberCoefficients() const {
-        return currentData->numberRows() * currentData->numberColumns();
+        return numberRows() * numberColumns();
     }
 
 
     Model::Variant MatrixReal::value(MatrixReal::Index row, MatrixReal::Index column) const {
         Model::Variant result;
 
-        if (row > 0 && static_cast<unsigned long>(row) <= currentData->numberRows()          &&
-            column > 0 && static_cast<unsigned long>(column) <= currentData->numberColumns()    ) {
-            result = currentData->at(row - 1, column - 1);
+        if (hasSmallStorage()) {
+            if (row > 0 && row <= smallNumberRows && column > 0 && column <= smallNumberColumns) {
+                result = smallCoefficients[(column - 1) * smallNumberRows + (row - 1)];
+            }
+        } else if (currentData == nullptr) {
+            if (row > 0 && static_cast<unsigned long>(row) <= currentView.numberRows          &&
+                column > 0 && static_cast<unsigned long>(column) <= currentView.numberColumns    ) {
+                result = storedCoefficient(row - 1, column - 1);
+            }
+        } else if (row > 0 && static_cast<unsigned long>(row) <= currentData->numberRows()          &&
+                   column > 0 && static_cast<unsigned long>(column) <= currentData->numberColumns()    ) {
+            result = static_cast<const Data*>(currentData)->at(row - 1, column - 1);
         }
 
         return result;
@@ -173,33 +222,90 @@ namespace M {
 
 
     MatrixReal MatrixReal::identity(Index numberRows, Index numberColumns) {
-        return MatrixReal(DenseData::identity(numberRows, numberColumns));
+        MatrixReal result;
+
+        if (numberRows >= 0 && numberColumns >= 0 && MatrixSmallPrivate<Scalar>::isSmall(numberRows, numberColumns)) {
+            result = MatrixReal(numberRows, numberColumns);
+
+            Index numberDiagonalEntries = std::min(numberRows, numberColumns);
+            for (Index index=0 ; index<numberDiagonalEntries ; ++index) {
+                result.smallCoefficients[index * numberRows + index] = Scalar(1);
+            }
+        } else {
+            result = MatrixReal(DenseData::identity(numberRows, numberColumns));
+        }
+
+        return result;
     }
 
 
     MatrixReal MatrixReal::identity(Index numberRowColumns) {
-        return MatrixReal(DenseData::identity(numberRowColumns, numberRowColumns));
+        return identity(numberRowColumns, numberRowColumns);
     }
 
 
     MatrixReal MatrixReal::ones(Index numberRows, Index numberColumns) {
-        return MatrixReal(DenseData::ones(numberRows, numberColumns));
+        MatrixReal result;
+
+        if (numberRows >= 0 && numberColumns >= 0 && MatrixSmallPrivate<Scalar>::isSmall(numberRows, numberColumns)) {
+            result.configureSmallStorage(numberRows, numberColumns);
+            std::fill(result.smallCoefficients, result.smallCoefficients + numberRows * numberColumns, Scalar(1));
+        } else {
+            result = MatrixReal(DenseData::ones(numberRows, numberColumns));
+        }
+
+        return result;
     }
 
 
     MatrixReal MatrixReal::ones(Index numberRowColumns) {
-        return MatrixReal(DenseData::ones(numberRowColumns, numberRowColumns));
+        return ones(numberRowColumns, numberRowColumns);
+    }
+
+
+    MatrixReal MatrixReal::sparse(Index numberRows, Index numberColumns) {
+        return MatrixReal(SparseData::create(numberRows, numberColumns));
+    }
+
+
+    void MatrixReal::setSparseDensityThreshold(Real newThreshold) {
+        currentSparseDensityThreshold = newThreshold;
+    }
+
+
+    Real MatrixReal::sparseDensityThreshold() {
+        return currentSparseDensityThreshold;
+    }
+
+
+    void MatrixReal::setDenseDensityThreshold(Real newThreshold) {
+        currentDenseDensityThreshold = newThreshold;
+    }
+
+
+    Real MatrixReal::denseDensityThreshold() {
+        return currentDenseDensityThreshold;
+    }
+
+
+    void MatrixReal::setAutomaticStorageMinimumCoefficients(unsigned long long newMinimum) {
+        currentAutomaticStorageMinimumCoefficients = newMinimum;
+    }
+
+
+    unsigned long long MatrixReal::automaticStorageMinimumCoefficients() {
+        return currentAutomaticStorageMinimumCoefficients;
     }
 
 
     MatrixReal MatrixReal::diagonalEntries() const {
-        unsigned long numberDiagnonalEntries = std::min(currentData->numberRows(), currentData->numberColumns());
+        unsigned long numberDiagnonalEntries = std::min(dataStore()->numberRows(), dataStore()->numberColumns());
         MatrixReal result(numberDiagnonalEntries, 1);
 
-        Scalar* data = result.currentData->data();
+        Scalar* data = result.dataStore()->data();
 
         for (unsigned index=0 ; index<numberDiagnonalEntries ; ++index) {
-            Scalar v = currentData->at(index, index);
+            Scalar v = static_cast<const Data*>(dataStore())->at(index, index);
             data[index] = v;
         }
 
@@ -208,19 +314,20 @@ namespace M {
 
 
     MatrixReal MatrixReal::diagonal() const {
-        unsigned long numberRows    = currentData->numberRows();
-        unsigned long numberColumns = currentData->numberColumns();
+        const Data*   sourceData    = dataStore();
+        unsigned long numberRows    = dataStore()->numberRows();
+        unsigned long numberColumns = dataStore()->numberColumns();
         DenseData*    result        = nullptr;
 
         if ((numberRows != 1 && numberColumns != 1) || numberRows == 0 || numberColumns == 0) {
             throw Model::InvalidMatrixDimensions(numberRows, numberColumns);
         } else {
             unsigned long numberValues = std::max(numberRows, numberColumns);
-            Scalar*       data         = currentData->data();
+            bool          isRowVector  = (numberRows == 1);
 
             result = DenseData::create(numberValues, numberValues);
             for (unsigned i=0 ; i<numberValues ; ++i) {
-                Scalar  v = data[i];
+                Scalar  v = isRowVector ? sourceData->at(0, i) : sourceData->at(i, 0);
                 Scalar* d = &(result->at(i, i));
                 *d = v;
             }
@@ -233,16 +340,28 @@ namespace M {
     Model::Variant MatrixReal::value(Matrix::Index index) const {
         Model::Variant result;
 
-        unsigned long      numberRows         = currentData->numberRows();
-        unsigned long      numberColumns      = currentData->numberColumns();
+        unsigned long numberRows;
+        unsigned long numberColumns;
+
+        if (hasSmallStorage()) {
+            numberRows    = smallNumberRows;
+            numberColumns = smallNumberColumns;
+        } else if (currentData == nullptr) {
+            numberRows    = currentView.numberRows;
+            numberColumns = currentView.numberColumns;
+        } else {
+            numberRows    = currentData->numberRows();
+            numberColumns = currentData->numberColumns();
+        }
+
         unsigned long long numberCoefficients = numberRows * numberColumns;
 
-        if (index > 0 || static_cast<unsigned long long>(index) <= numberCoefficients) {
+        if (index > 0 && static_cast<unsigned long long>(index) <= numberCoefficients) {
             unsigned long long i           = static_cast<unsigned long long>(index - 1);
             unsigned long      rowIndex    = i / numberColumns;
             unsigned long      columnIndex = i % numberColumns;
 
-            result = currentData->at(rowIndex, columnIndex);
+            result = storedCoefficient(rowIndex, columnIndex);
         }
 
         return result;
@@ -286,19 +405,26 @@ namespace M {
     void MatrixReal::resize(MatrixReal::Index newNumberRows, MatrixReal::Index newNumberColumns) {
         applyLazyTransformsAndScaling();
 
-        currentData->lock();
-        if (currentData->referenceCount() > 1) {
-            Data* oldDataStore = currentData;
-            currentData = currentData->resizeTo(newNumberRows, newNumberColumns, true);
-
-            oldDataStore->unlock();
-            releaseDataStore(oldDataStore);
+        if (hasSmallStorage()                                                &&
+            newNumberRows >= 0                                               &&
+            newNumberColumns >= 0                                            &&
+            MatrixSmallPrivate<Scalar>::isSmall(newNumberRows, newNumberColumns)    ) {
+            resizeSmallStorage(newNumberRows, newNumberColumns);
         } else {
-            Data* newDataStore = currentData->resizeTo(newNumberRows, newNumberColumns, false);
-            if (newDataStore != currentData) {
-                assignNewDataStore(newDataStore, true);
+            dataStore()->lock();
+            if (dataStore()->referenceCount() > 1) {
+                Data* oldDataStore = dataStore();
+                currentData = dataStore()->resizeTo(newNumberRows, newNumberColumns, true);
+
+                oldDataStore->unlock();
+                releaseDataStore(oldDataStore);
             } else {
-                currentData->unlock();
+                Data* newDataStore = dataStore()->resizeTo(newNumberRows, newNumberColumns, false);
+                if (newDataStore != dataStore()) {
+                    assignNewDataStore(newDataStore, true);
+                } else {
+                    dataStore()->unlock();
+                }
             }
         }
     }
@@ -312,15 +438,15 @@ namespace M {
 
         Scalar result = Scalar(0);
 
-        unsigned long numberRows = currentData->numberRows();
+        unsigned long numberRows = static_cast<unsigned long>(MatrixReal::numberRows());
         if (row < 1 || static_cast<unsigned long>(row) > numberRows) {
             throw Model::InvalidRow(row, numberRows);
         } else {
-            unsigned long numberColumns = currentData->numberColumns();
+            unsigned long numberColumns = static_cast<unsigned long>(MatrixReal::numberColumns());
             if (column < 1 || static_cast<unsigned long>(column) > numberColumns) {
                 throw Model::InvalidColumn(column, numberColumns);
             } else {
-                result = currentData->at(row - 1, column - 1);
+                result = storedCoefficient(row - 1, column - 1);
             }
         }
 
@@ -331,23 +457,23 @@ namespace M {
     MatrixReal::Scalar MatrixReal::at(MatrixReal::Index index) const {
         applyLazyTransformsAndScaling();
 
-        const Scalar* result = nullptr;
+        Scalar result = Scalar(0);
 
-        unsigned long      numberRows         = currentData->numberRows();
-        unsigned long      numberColumns      = currentData->numberColumns();
+        unsigned long      numberRows         = static_cast<unsigned long>(MatrixReal::numberRows());
+        unsigned long      numberColumns      = static_cast<unsigned long>(MatrixReal::numberColumns());
         unsigned long long numberCoefficients = numberRows * numberColumns;
 
-        if (index < 1 && static_cast<unsigned long long>(index) > numberCoefficients) {
+        if (index < 1 || static_cast<unsigned long long>(index) > numberCoefficients) {
             throw Model::InvalidIndex(index, numberCoefficients);
         } else {
             unsigned long long i           = static_cast<unsigned long long>(index - 1);
             unsigned long      rowIndex    = i / numberColumns;
             unsigned long      columnIndex = i % numberColumns;
 
-            result = &(currentData->at(rowIndex, columnIndex));
+            result = storedCoefficient(rowIndex, columnIndex);
         }
 
-        return *result;
+        return result;
     }
 
 
@@ -766,7 +892,25 @@ namespace M {
 
 
     MatrixReal MatrixReal::at(const Range& rowRange, MatrixReal::Index column) const {
-        return atICHelper(*this, rowRange, column);
+        MatrixReal result;
+
+        applyLazyTransformsAndScaling();
+
+        unsigned long numberRows = static_cast<unsigned long>(MatrixReal::numberRows());
+        unsigned long firstRow;
+        long long     rowStride;
+        unsigned long rowCount;
+
+        if (matrixType() == MatrixType::DENSE                                     &&
+            column >= 1                                                           &&
+            column <= MatrixReal::numberColumns()                                 &&
+            stridedRangeHelper(rowRange, numberRows, firstRow, rowStride, rowCount)    ) {
+            result = submatrix(firstRow, rowStride, rowCount, static_cast<unsigned long>(column - 1), 1, 1);
+        } else {
+            result = atICHelper(*this, rowRange, column);
+        }
+
+        return result;
     }
 
 
@@ -781,12 +925,58 @@ namespace M {
 
 
     MatrixReal MatrixReal::at(const Range& rowRange, const Range& columnRange) const {
-        return atIIHelper(*this, rowRange, columnRange);
+        MatrixReal result;
+
+        applyLazyTransformsAndScaling();
+
+        unsigned long numberRows    = static_cast<unsigned long>(MatrixReal::numberRows());
+        unsigned long numberColumns = static_cast<unsigned long>(MatrixReal::numberColumns());
+        unsigned long firstRow;
+        long long     rowStride;
+        unsigned long rowCount;
+        unsigned long firstColumn;
+        long long     columnStride;
+        unsigned long columnCount;
+
+        if (matrixType() == MatrixType::DENSE                                                    &&
+            stridedRangeHelper(rowRange, numberRows, firstRow, rowStride, rowCount)              &&
+            stridedRangeHelper(columnRange, numberColumns, firstColumn, columnStride, columnCount)    ) {
+            bool allRows    = firstRow == 0 && rowStride == 1 && rowCount == numberRows;
+            bool allColumns = firstColumn == 0 && columnStride == 1 && columnCount == numberColumns;
+
+            if (allRows && allColumns) {
+                result = *this;
+            } else {
+                result = submatrix(firstRow, rowStride, rowCount, firstColumn, columnStride, columnCount);
+            }
+        } else {
+            result = atIIHelper(*this, rowRange, columnRange);
+        }
+
+        return result;
     }
 
 
     MatrixReal MatrixReal::at(MatrixReal::Index row, const Range& columnRange) const {
-        return atCIHelper(*this, row, columnRange);
+        MatrixReal result;
+
+        applyLazyTransformsAndScaling();
+
+        unsigned long numberColumns = static_cast<unsigned long>(MatrixReal::numberColumns());
+        unsigned long firstColumn;
+        long long     columnStride;
+        unsigned long columnCount;
+
+        if (matrixType() == MatrixType::DENSE                                                    &&
+            row >= 1                                                                             &&
+            row <= MatrixReal::numberRows()                                                      &&
+            stridedRangeHelper(columnRange, numberColumns, firstColumn, columnStride, columnCount)    ) {
+            result = submatrix(static_cast<unsigned long>(row - 1), 1, 1, firstColumn, columnStride, columnCount);
+        } else {
+            result = atCIHelper(*this, row, columnRange);
+        }
+
+        return result;
     }
 
 
@@ -1542,18 +1732,19 @@ namespace M {
 
     const MatrixReal::Scalar* MatrixReal::pointer(MatrixReal::Index row, MatrixReal::Index column) const {
         applyLazyTransformsAndScaling();
+        convertToDenseDataStore();
 
         const Scalar* result = nullptr;
 
-        unsigned long numberRows = currentData->numberRows();
+        unsigned long numberRows = dataStore()->numberRows();
         if (row < 1 || static_cast<unsigned long>(row) > numberRows) {
             throw Model::InvalidRow(row, numberRows);
         } else {
-            unsigned long numberColumns = currentData->numberColumns();
+            unsigned long numberColumns = dataStore()->numberColumns();
             if (column < 1 || static_cast<unsigned long>(column) > numberColumns) {
                 throw Model::InvalidColumn(column, numberColumns);
             } else {
-                result = &(currentData->at(row - 1, column - 1));
+                result = &(dataStore()->at(row - 1, column - 1));
             }
         }
 
@@ -1565,23 +1756,29 @@ namespace M {
         applyLazyTransformsAndScaling();
 
         if (row < 1) {
-            throw Model::InvalidRow(row, currentData->numberRows());
+            throw Model::InvalidRow(row, numberRows());
         } else if (column < 1) {
-            throw Model::InvalidColumn(column, currentData->numberColumns());
+            throw Model::InvalidColumn(column, numberColumns());
+        } else if (hasSmallStorage() && MatrixSmallPrivate<Scalar>::isSmall(row, column)) {
+            if (row > smallNumberRows || column > smallNumberColumns) {
+                resizeSmallStorage(std::max<Index>(row, smallNumberRows), std::max<Index>(column, smallNumberColumns));
+            }
+
+            smallCoefficients[(column - 1) * smallNumberRows + (row - 1)] = newValue;
         } else {
-            unsigned long numberRows    = currentData->numberRows();
-            unsigned long numberColumns = currentData->numberColumns();
+            unsigned long numberRows    = dataStore()->numberRows();
+            unsigned long numberColumns = dataStore()->numberColumns();
 
-            currentData->lock();
-            if (currentData->referenceCount() > 1) {
-                Data* oldDataStore = currentData;
+            dataStore()->lock();
+            if (dataStore()->referenceCount() > 1) {
+                Data* oldDataStore = dataStore();
 
                 if (static_cast<unsigned long>(row) > numberRows       ||
                     static_cast<unsigned long>(column) > numberColumns    ) {
                     unsigned long newNumberRows    = std::max(numberRows, static_cast<unsigned long>(row));
                     unsigned long newNumberColumns = std::max(numberColumns, static_cast<unsigned long>(column));
 
-                    currentData = currentData->resizeTo(newNumberRows, newNumberColumns, true);
+                    currentData = dataStore()->resizeTo(newNumberRows, newNumberColumns, true);
                 } else {
                     currentData = oldDataStore->clone();
                 }
@@ -1589,33 +1786,35 @@ namespace M {
                 oldDataStore->unlock();
                 releaseDataStore(oldDataStore);
 
-                currentData->at(row - 1, column - 1) = newValue;
+                dataStore()->at(row - 1, column - 1) = newValue;
             } else {
                 if (static_cast<unsigned long>(row) > numberRows       ||
                     static_cast<unsigned long>(column) > numberColumns    ) {
                     unsigned long newNumberRows    = std::max(numberRows, static_cast<unsigned long>(row));
                     unsigned long newNumberColumns = std::max(numberColumns, static_cast<unsigned long>(column));
 
-                   Data* newDataStore = currentData->resizeTo(newNumberRows, newNumberColumns);
-                    if (newDataStore != currentData) {
+                   Data* newDataStore = dataStore()->resizeTo(newNumberRows, newNumberColumns);
+                    if (newDataStore != dataStore()) {
                         assignNewDataStore(newDataStore, true);
-                        currentData->at(row - 1, column - 1) = newValue;
+                        dataStore()->at(row - 1, column - 1) = newValue;
                     } else {
-                        currentData->at(row - 1, column - 1) = newValue;
-                        currentData->unlock();
+                        dataStore()->at(row - 1, column - 1) = newValue;
+                        dataStore()->unlock();
                     }
                 } else {
-                    currentData->at(row - 1, column - 1) = newValue;
-                    currentData->unlock();
+                    dataStore()->at(row - 1, column - 1) = newValue;
+                    dataStore()->unlock();
                 }
             }
+
+            applyStoragePolicy(false);
         }
     }
 
 
     void MatrixReal::update(Matrix::Index index, MatrixReal::Scalar newValue) {
-        unsigned long      numberRows         = currentData->numberRows();
-        unsigned long      numberColumns      = currentData->numberColumns();
+        unsigned long      numberRows         = static_cast<unsigned long>(MatrixReal::numberRows());
+        unsigned long      numberColumns      = static_cast<unsigned long>(MatrixReal::numberColumns());
         unsigned long long numberCoefficients = numberRows * numberColumns;
 
         if (index < 1) {
@@ -1654,13 +1853,11 @@ namespace M {
         other.applyLazyTransformsAndScaling();
 
         Data* resultData;
-        if (other.currentData->matrixType() == Matrix::MatrixType::DENSE) {
-            resultData = currentData->combineLeftToRight(*POLYMORPHIC_CAST<const DenseData*>(other.currentData));
+        if (other.dataStore()->matrixType() == Matrix::MatrixType::DENSE) {
+            resultData = dataStore()->combineLeftToRight(*POLYMORPHIC_CAST<const DenseData*>(other.dataStore()));
         } else {
-            assert(other.currentData->matrixType() == Matrix::MatrixType::SPARSE);
-            assert(false); // FIXME
-            resultData = nullptr;
-//            resultData = currentData->combineLeftToRight(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            assert(other.dataStore()->matrixType() == Matrix::MatrixType::SPARSE);
+            resultData = dataStore()->combineLeftToRight(*POLYMORPHIC_CAST<const SparseData*>(other.dataStore()));
         }
 
         return MatrixReal(resultData);
@@ -1672,13 +1869,11 @@ namespace M {
         other.applyLazyTransformsAndScaling();
 
         Data* resultData;
-        if (other.currentData->matrixType() == Matrix::MatrixType::DENSE) {
-            resultData = currentData->combineTopToBottom(*POLYMORPHIC_CAST<const DenseData*>(other.currentData));
+        if (other.dataStore()->matrixType() == Matrix::MatrixType::DENSE) {
+            resultData = dataStore()->combineTopToBottom(*POLYMORPHIC_CAST<const DenseData*>(other.dataStore()));
         } else {
-            assert(other.currentData->matrixType() == Matrix::MatrixType::SPARSE);
-            assert(false); // FIXME
-            resultData = nullptr;
-//            resultData = currentData->combineTopToBottom(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            assert(other.dataStore()->matrixType() == Matrix::MatrixType::SPARSE);
+            resultData = dataStore()->combineTopToBottom(*POLYMORPHIC_CAST<const SparseData*>(other.dataStore()));
         }
 
         return MatrixReal(resultData);
@@ -1687,18 +1882,18 @@ namespace M {
 
     MatrixReal MatrixReal::columnReverse() const {
         applyLazyTransformsAndScaling();
-        return MatrixReal(currentData->columnReverse());
+        return MatrixReal(dataStore()->columnReverse());
     }
 
 
     MatrixReal MatrixReal::rowReverse() const {
         applyLazyTransformsAndScaling();
-        return MatrixReal(currentData->rowReverse());
+        return MatrixReal(dataStore()->rowReverse());
     }
 
 
     bool MatrixReal::isSquare() const {
-        return currentData->numberRows() == currentData->numberColumns();
+        return numberRows() == numberColumns();
     }
 
 
@@ -1706,15 +1901,16 @@ namespace M {
         bool symmetric = true;
 
         if (isSquare()) {
-            unsigned long numberRowColumns = currentData->numberRows();
+            const Data*   sourceData       = dataStore();
+            unsigned long numberRowColumns = dataStore()->numberRows();
             unsigned long rowIndex         = 0;
 
             while (symmetric && rowIndex < numberRowColumns) {
                 unsigned long columnIndex = 0;
 
                 while (symmetric && columnIndex < numberRowColumns) {
-                    Scalar v1 = currentData->at(rowIndex, columnIndex);
-                    Scalar v2 = currentData->at(columnIndex, rowIndex);
+                    Scalar v1 = sourceData->at(rowIndex, columnIndex);
+                    Scalar v2 = sourceData->at(columnIndex, rowIndex);
 
                     if (v1 != v2) {
                         Real average = abs(v1 + v2) / 2.0;
@@ -1739,15 +1935,16 @@ namespace M {
         bool skewSymmetric = true;
 
         if (isSquare()) {
-            unsigned long numberRowColumns = currentData->numberRows();
+            const Data*   sourceData       = dataStore();
+            unsigned long numberRowColumns = dataStore()->numberRows();
             unsigned long rowIndex         = 0;
 
             while (skewSymmetric && rowIndex < numberRowColumns) {
                 unsigned long columnIndex = 0;
 
                 while (skewSymmetric && columnIndex < numberRowColumns) {
-                    Scalar v1 =  currentData->at(rowIndex, columnIndex);
-                    Scalar v2 = -currentData->at(columnIndex, rowIndex);
+                    Scalar v1 =  sourceData->at(rowIndex, columnIndex);
+                    Scalar v2 = -sourceData->at(columnIndex, rowIndex);
 
                     if (v1 != v2) {
                         Real average = abs(v1 + v2) / 2.0;
@@ -1817,12 +2014,12 @@ namespace M {
         Data* sData;
         Data* vData;
 
-        currentData->svd(uData, sData, vData);
+        dataStore()->svd(uData, sData, vData);
 
         Data::destroy(uData);
         Data::destroy(vData);
 
-        unsigned long diagnonalLength = std::min(currentData->numberRows(), currentData->numberColumns());
+        unsigned long diagnonalLength = std::min(dataStore()->numberRows(), dataStore()->numberColumns());
         Integer       result          = 0;
 
         for (unsigned index=0 ; index<diagnonalLength ; ++index) {
@@ -1839,8 +2036,21 @@ namespace M {
 
 
     MatrixReal::Scalar MatrixReal::determinant() const {
+        Scalar result;
+
         applyLazyTransformsAndScaling();
-        return currentData->determinant();
+
+        if (hasSmallStorage()) {
+            if (smallNumberRows != smallNumberColumns || smallNumberRows == 0) {
+                throw Model::InvalidMatrixDimensions(smallNumberRows, smallNumberColumns);
+            }
+
+            result = MatrixSmallPrivate<Scalar>::determinant(smallCoefficients, smallNumberRows, smallNumberRows);
+        } else {
+            result = dataStore()->determinant();
+        }
+
+        return result;
     }
 
 
@@ -1852,8 +2062,32 @@ namespace M {
 
 
     MatrixReal MatrixReal::inverse() const {
+        MatrixReal result;
+
         applyLazyTransformsAndScaling();
-        return MatrixReal(currentData->inverse());
+
+        if (hasSmallStorage()) {
+            if (smallNumberRows != smallNumberColumns || smallNumberRows == 0) {
+                throw Model::InvalidMatrixDimensions(smallNumberRows, smallNumberColumns);
+            }
+
+            result.configureSmallStorage(smallNumberRows, smallNumberColumns);
+            bool success = MatrixSmallPrivate<Scalar>::inverse(
+                smallCoefficients,
+                smallNumberRows,
+                smallNumberRows,
+                result.smallCoefficients,
+                smallNumberRows
+            );
+
+            if (!success) {
+                throw Model::MatrixIsSingular();
+            }
+        } else {
+            result = MatrixReal(dataStore()->inverse());
+        }
+
+        return result;
     }
 
 
@@ -1866,7 +2100,7 @@ namespace M {
         Data* lData;
         Data* uData;
 
-        bool notSingular = currentData->plu(pData, lData, uData);
+        bool notSingular = dataStore()->plu(pData, lData, uData);
 
         result.append(MatrixReal(pData));
         result.append(MatrixReal(lData));
@@ -1886,7 +2120,7 @@ namespace M {
         Data* sData;
         Data* vData;
 
-        bool success = currentData->svd(uData, sData, vData);
+        bool success = dataStore()->svd(uData, sData, vData);
 
         result.append(MatrixReal(uData));
         result.append(MatrixReal(sData));
@@ -1905,7 +2139,7 @@ namespace M {
         Data* qData;
         Data* rData;
 
-        bool success = currentData->qr(qData, rData);
+        bool success = dataStore()->qr(qData, rData);
 
         result.append(MatrixReal(qData));
         result.append(MatrixReal(rData));
@@ -1925,7 +2159,7 @@ namespace M {
         {
             MatrixReal ah = this->transpose();
             ah.applyLazyTransformsAndScaling();
-            success = ah.currentData->qr(qData, rData);
+            success = ah.dataStore()->qr(qData, rData);
         }
 
         MatrixReal l(rData);
@@ -1944,13 +2178,13 @@ namespace M {
 
     MatrixReal MatrixReal::cholesky() const {
         applyLazyTransformsAndScaling();
-        return MatrixReal(currentData->cholesky());
+        return MatrixReal(dataStore()->cholesky());
     }
 
 
     MatrixReal MatrixReal::upperCholesky() const {
         applyLazyTransformsAndScaling();
-        return MatrixReal(currentData->upperCholesky());
+        return MatrixReal(dataStore()->upperCholesky());
     }
 
 
@@ -1962,7 +2196,7 @@ namespace M {
         Data* qData;
         Data* hData;
 
-        currentData->hessenberg(qData, hData);
+        dataStore()->hessenberg(qData, hData);
 
         result.append(MatrixReal(qData));
         result.append(MatrixReal(hData));
@@ -1973,30 +2207,30 @@ namespace M {
 
     MatrixReal MatrixReal::dct() const {
         applyLazyTransformsAndScaling();
-        return MatrixReal(currentData->dct());
+        return MatrixReal(dataStore()->dct());
     }
 
 
     MatrixReal MatrixReal::idct() const {
         applyLazyTransformsAndScaling();
-        return MatrixReal(currentData->idct());
+        return MatrixReal(dataStore()->idct());
     }
 
 
     MatrixComplex MatrixReal::hilbertTransform() const {
         applyLazyTransformsAndScaling();
-        return MatrixComplex(currentData->hilbertTransform());
+        return MatrixComplex(dataStore()->hilbertTransform());
     }
 
 
     Real MatrixReal::conditionNumber() const {
         applyLazyTransformsAndScaling();
 
-        Data* inverse     = currentData->inverse();
+        Data* inverse     = dataStore()->inverse();
         Real  inverseNorm = inverse->pNorm(2.0);
         Data::destroy(inverse);
 
-        Real norm = currentData->pNorm(2.0);
+        Real norm = dataStore()->pNorm(2.0);
 
         return inverseNorm * norm;
     }
@@ -2004,7 +2238,7 @@ namespace M {
 
     Real MatrixReal::pNorm(Integer p) const {
         applyLazyTransformsAndScaling();
-        return currentData->pNorm(p);
+        return dataStore()->pNorm(p);
     }
 
 
@@ -2015,13 +2249,13 @@ namespace M {
 
     Real MatrixReal::oneNorm() const {
         applyLazyTransformsAndScaling();
-        return currentData->oneNorm();
+        return dataStore()->oneNorm();
     }
 
 
     Real MatrixReal::infinityNorm() const {
         applyLazyTransformsAndScaling();
-        return currentData->infinityNorm();
+        return dataStore()->infinityNorm();
     }
 
 
@@ -2033,7 +2267,7 @@ namespace M {
         Data* row;
         Data* column;
 
-        bool  success = currentData->equilibrate(row, column);
+        bool  success = dataStore()->equilibrate(row, column);
 
         result.append(MatrixReal(row));
         result.append(MatrixReal(column));
@@ -2044,20 +2278,40 @@ namespace M {
 
 
     MatrixReal MatrixReal::solve(const MatrixReal& y) const {
-        Data* result = nullptr;
+        MatrixReal result;
 
         applyLazyTransformsAndScaling();
         y.applyLazyTransformsAndScaling();
 
-        if (y.currentData->matrixType() == MatrixType::DENSE) {
-            result = currentData->solve(POLYMORPHIC_CAST<const DenseData*>(y.currentData));
+        if (hasSmallStorage()                            &&
+            y.hasSmallStorage()                          &&
+            smallNumberRows == smallNumberColumns        &&
+            smallNumberRows > 0                          &&
+            y.smallNumberRows == smallNumberRows         &&
+            y.smallNumberColumns > 0                        ) {
+            result.configureSmallStorage(smallNumberRows, y.smallNumberColumns);
+            bool success = MatrixSmallPrivate<Scalar>::solve(
+                smallCoefficients,
+                smallNumberRows,
+                smallNumberRows,
+                y.smallCoefficients,
+                y.smallNumberRows,
+                y.smallNumberColumns,
+                result.smallCoefficients,
+                smallNumberRows
+            );
+
+            if (!success) {
+                result.configureSmallStorage(0, 0);
+            }
+        } else if (y.dataStore()->matrixType() == MatrixType::DENSE) {
+            result = MatrixReal(dataStore()->solve(POLYMORPHIC_CAST<const DenseData*>(y.dataStore())));
         } else {
-            assert(y.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
-//            result = currentData->solve(POLYMORPHIC_CAST<const SparseData*>(y.currentData));
+            assert(y.dataStore()->matrixType() == MatrixType::SPARSE);
+            result = MatrixReal(dataStore()->solve(POLYMORPHIC_CAST<const SparseData*>(y.dataStore())));
         }
 
-        return MatrixReal(result);
+        return result;
     }
 
 
@@ -2067,12 +2321,11 @@ namespace M {
         applyLazyTransformsAndScaling();
         b.applyLazyTransformsAndScaling();
 
-        if (b.currentData->matrixType() == MatrixType::DENSE) {
-            result = currentData->leastSquares(POLYMORPHIC_CAST<const DenseData*>(b.currentData));
+        if (b.dataStore()->matrixType() == MatrixType::DENSE) {
+            result = dataStore()->leastSquares(POLYMORPHIC_CAST<const DenseData*>(b.dataStore()));
         } else {
-            assert(b.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
-//            result = currentData->leastSquares(POLYMORPHIC_CAST<const SparseData*>(b.currentData));
+            assert(b.dataStore()->matrixType() == MatrixType::SPARSE);
+            result = dataStore()->leastSquares(POLYMORPHIC_CAST<const SparseData*>(b.dataStore()));
         }
 
         return MatrixReal(result);
@@ -2084,15 +2337,17 @@ namespace M {
         other.applyLazyTransformsAndScaling();
 
         Data* result = nullptr;
-        if (other.currentData->matrixType() == MatrixType::DENSE) {
-            result = currentData->hadamard(*POLYMORPHIC_CAST<const DenseData*>(other.currentData));
+        if (other.dataStore()->matrixType() == MatrixType::DENSE) {
+            result = dataStore()->hadamard(*POLYMORPHIC_CAST<const DenseData*>(other.dataStore()));
         } else {
-            assert(other.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
-//            result = currentData->hadamard(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            assert(other.dataStore()->matrixType() == MatrixType::SPARSE);
+            result = dataStore()->hadamard(*POLYMORPHIC_CAST<const SparseData*>(other.dataStore()));
         }
 
-        return MatrixReal(result);
+        MatrixReal matrixResult(result);
+        matrixResult.applyStoragePolicy(false);
+
+        return matrixResult;
     }
 
 
@@ -2100,41 +2355,177 @@ namespace M {
         applyLazyTransformsAndScaling();
 
         Data* result = nullptr;
-        if (other.currentData->matrixType() == MatrixType::DENSE) {
-            result = currentData->kronecker(
-                *POLYMORPHIC_CAST<const DenseData*>(other.currentData),
+        if (other.dataStore()->matrixType() == MatrixType::DENSE) {
+            result = dataStore()->kronecker(
+                *POLYMORPHIC_CAST<const DenseData*>(other.dataStore()),
                 other.pendingTranspose,
                 other.pendingScalarValue
             );
         } else {
-            assert(other.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
-//            result = currentData->hadamard(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            assert(other.dataStore()->matrixType() == MatrixType::SPARSE);
+            result = dataStore()->kronecker(
+                *POLYMORPHIC_CAST<const SparseData*>(other.dataStore()),
+                other.pendingTranspose,
+                other.pendingScalarValue
+            );
         }
 
         return MatrixReal(result);
     }
 
 
+    MatrixReal& MatrixReal::multiplyAccumulate(
+            const MatrixReal&  multiplier,
+            const MatrixReal&  multiplicand,
+            MatrixReal::Scalar accumulatorScalar
+        ) {
+        bool operandsAreDense = (
+               multiplier.matrixType() == MatrixType::DENSE
+            && multiplicand.matrixType() == MatrixType::DENSE
+        );
+
+        if (operandsAreDense                                &&
+            currentData != nullptr                          &&
+            canAccumulateInPlace(multiplier.dataStore())    &&
+            canAccumulateInPlace(multiplicand.dataStore())     ) {
+            ReferenceCounter::lockPair(multiplier.dataStore(), multiplicand.dataStore());
+
+            try {
+                POLYMORPHIC_CAST<DenseData*>(dataStore())->multiplyAccumulate(
+                    *POLYMORPHIC_CAST<const DenseData*>(multiplier.dataStore()),
+                    *POLYMORPHIC_CAST<const DenseData*>(multiplicand.dataStore()),
+                    multiplier.pendingTranspose,
+                    multiplicand.pendingTranspose,
+                    multiplier.pendingScalarValue * multiplicand.pendingScalarValue,
+                    accumulatorScalar * pendingScalarValue
+                );
+            } catch (...) {
+                multiplicand.dataStore()->unlock();
+                multiplier.dataStore()->unlock();
+                throw;
+            }
+
+            multiplicand.dataStore()->unlock();
+            multiplier.dataStore()->unlock();
+
+            pendingScalarValue = Scalar(1);
+        } else {
+            MatrixReal result = multiplier * multiplicand;
+            result += (*this) * accumulatorScalar;
+            operator=(result);
+        }
+
+        return *this;
+    }
+
+
     MatrixReal::MatrixType MatrixReal::matrixType() const {
-        return currentData->matrixType();
+        return currentData == nullptr ? MatrixType::DENSE : currentData->matrixType();
     }
 
 
-    MatrixReal::Scalar* MatrixReal::data() {
+    void MatrixReal::applyDensityThresholds() {
+        applyStoragePolicy();
+    }
+
+
+    unsigned long long MatrixReal::numberStoredCoefficients() const {
+        unsigned long long result;
+
+        if (matrixType() == MatrixType::SPARSE) {
+            result = POLYMORPHIC_CAST<const SparseData*>(currentData)->numberNonZeros();
+        } else {
+            result = static_cast<unsigned long long>(numberRows()) * static_cast<unsigned long long>(numberColumns());
+        }
+
+        return result;
+    }
+
+
+    MatrixReal MatrixReal::toSparse() const {
         applyLazyTransformsAndScaling();
-        return currentData->data();
+
+        Data* result;
+        if (dataStore()->matrixType() == MatrixType::SPARSE) {
+            result = dataStore()->clone();
+        } else {
+            result = SparseData::create(*POLYMORPHIC_CAST<const DenseData*>(dataStore()));
+        }
+
+        return MatrixReal(result);
     }
 
 
-    const MatrixReal::Scalar* MatrixReal::data() const {
+    MatrixReal MatrixReal::toDense() const {
         applyLazyTransformsAndScaling();
-        return currentData->data();
+
+        Data* result;
+        if (dataStore()->matrixType() == MatrixType::SPARSE) {
+            result = POLYMORPHIC_CAST<const SparseData*>(dataStore())->toDense();
+        } else {
+            result = dataStore()->clone();
+        }
+
+        return MatrixReal(result);
+    }
+
+
+    MatrixReal::Scalar* MatrixReal::data() {
+        convertToDenseDataStore();
+
+        dataStore()->lock();
+        if (dataStore()->referenceCount() > 1) {
+            Data* oldDataStore = dataStore();
+            currentData = oldDataStore->clone();
+
+            oldDataStore->unlock();
+            releaseDataStore(oldDataStore);
+        } else {
+            dataStore()->unlock();
+        }
+
+        return dataStore()->data();
+    }
+
+
+    const MatrixReal::Scalar* MatrixReal::data() const {
+        convertToDenseDataStore();
+        return dataStore()->data();
+    }
+
+
+    unsigned long long MatrixReal::columnSpacingInMemory() const {
+        convertToDenseDataStore();
+        return POLYMORPHIC_CAST<const DenseData*>(dataStore())->columnSpacingInMemory();
+    }
+
+
+    MatrixReal::Scalar* MatrixReal::columnData(MatrixReal::Index column) {
+        Scalar*       d             = data();
+        unsigned long numberColumns = dataStore()->numberColumns();
+
+        if (column < 1 || static_cast<unsigned long>(column) > numberColumns) {
+            throw Model::InvalidColumn(column, numberColumns);
+        }
+
+        return d + POLYMORPHIC_CAST<const DenseData*>(dataStore())->columnSpacingInMemory() * (column - 1);
+    }
+
+
+    const MatrixReal::Scalar* MatrixReal::columnData(MatrixReal::Index column) const {
+        const Scalar* d             = data();
+        unsigned long numberColumns = dataStore()->numberColumns();
+
+        if (column < 1 || static_cast<unsigned long>(column) > numberColumns) {
+            throw Model::InvalidColumn(column, numberColumns);
+        }
+
+        return d + POLYMORPHIC_CAST<const DenseData*>(dataStore())->columnSpacingInMemory() * (column - 1);
     }
 
 
     MatrixReal MatrixReal::floor() const {
-        MatrixReal result(currentData->floor());
+        MatrixReal result(dataStore()->floor());
 
         result.pendingTranspose   = pendingTranspose;
         result.pendingScalarValue = pendingScalarValue;
@@ -2144,7 +2535,7 @@ namespace M {
 
 
     MatrixReal MatrixReal::ceil() const {
-        MatrixReal result(currentData->ceil());
+        MatrixReal result(dataStore()->ceil());
 
         result.pendingTranspose   = pendingTranspose;
         result.pendingScalarValue = pendingScalarValue;
@@ -2154,7 +2545,7 @@ namespace M {
 
 
     MatrixReal MatrixReal::nint() const {
-        MatrixReal result(currentData->nint());
+        MatrixReal result(dataStore()->nint());
 
         result.pendingTranspose   = pendingTranspose;
         result.pendingScalarValue = pendingScalarValue;
@@ -2165,25 +2556,127 @@ namespace M {
 
     MatrixInteger MatrixReal::truncateToInteger() const {
         applyLazyTransformsAndScaling();
-        return MatrixInteger(currentData->truncateToInteger());
+        return MatrixInteger(dataStore()->truncateToInteger());
     }
 
 
     MatrixInteger MatrixReal::floorToInteger() const {
         applyLazyTransformsAndScaling();
-        return MatrixInteger(currentData->floorToInteger());
+        return MatrixInteger(dataStore()->floorToInteger());
     }
 
 
     MatrixInteger MatrixReal::ceilToInteger() const {
         applyLazyTransformsAndScaling();
-        return MatrixInteger(currentData->ceilToInteger());
+        return MatrixInteger(dataStore()->ceilToInteger());
     }
 
 
     MatrixInteger MatrixReal::nintToInteger() const {
         applyLazyTransformsAndScaling();
-        return MatrixInteger(currentData->nintToInteger());
+        return MatrixInteger(dataStore()->nintToInteger());
+    }
+
+
+    MatrixReal MatrixReal::exp() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->exp());
+    }
+
+
+    MatrixReal MatrixReal::sine() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->sine());
+    }
+
+
+    MatrixReal MatrixReal::cosine() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->cosine());
+    }
+
+
+    MatrixReal MatrixReal::tangent() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->tangent());
+    }
+
+
+    MatrixReal MatrixReal::arcsine() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->arcsine());
+    }
+
+
+    MatrixReal MatrixReal::arccosine() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->arccosine());
+    }
+
+
+    MatrixReal MatrixReal::arctangent() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->arctangent());
+    }
+
+
+    MatrixReal MatrixReal::hyperbolicSine() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->hyperbolicSine());
+    }
+
+
+    MatrixReal MatrixReal::hyperbolicCosine() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->hyperbolicCosine());
+    }
+
+
+    MatrixReal MatrixReal::hyperbolicTangent() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->hyperbolicTangent());
+    }
+
+
+    MatrixReal MatrixReal::erf() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->erf());
+    }
+
+
+    MatrixReal MatrixReal::erfc() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->erfc());
+    }
+
+
+    MatrixReal MatrixReal::gamma() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->gamma());
+    }
+
+
+    MatrixReal MatrixReal::lnGamma() const {
+        convertToDenseDataStore();
+        return MatrixReal(POLYMORPHIC_CAST<const DenseData*>(dataStore())->lnGamma());
+    }
+
+
+    MatrixComplex MatrixReal::ln() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->ln());
+    }
+
+
+    MatrixComplex MatrixReal::sqrt() const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->sqrt());
+    }
+
+
+    MatrixComplex MatrixReal::pow(Real exponent) const {
+        convertToDenseDataStore();
+        return MatrixComplex(POLYMORPHIC_CAST<const DenseData*>(dataStore())->pow(exponent));
     }
 
 
@@ -2313,17 +2806,37 @@ namespace M {
 
 
     MatrixReal& MatrixReal::operator=(const MatrixReal& other) {
-        assignExistingDataStore(other.currentData, false);
+        if (this != &other) {
+            Data*      oldData   = currentData;
+            DenseData* oldParent = currentView.parent;
 
-        pendingTranspose   = other.pendingTranspose;
-        pendingScalarValue = other.pendingScalarValue;
+            copyStorage(other);
+
+            releaseDataStore(oldData);
+            releaseDataStore(oldParent);
+        }
+
+        return *this;
+    }
+
+
+    MatrixReal& MatrixReal::operator=(MatrixReal&& other) noexcept {
+        if (this != &other) {
+            Data*      oldData   = currentData;
+            DenseData* oldParent = currentView.parent;
+
+            moveStorage(other);
+
+            releaseDataStore(oldData);
+            releaseDataStore(oldParent);
+        }
 
         return *this;
     }
 
 
     MatrixReal& MatrixReal::operator=(const MatrixComplex& other) {
-        releaseDataStore(currentData);
+        releaseStorage();
         copyFrom(other);
 
         return *this;
@@ -2331,7 +2844,7 @@ namespace M {
 
 
     MatrixReal& MatrixReal::operator=(const MatrixInteger& other) {
-        releaseDataStore(currentData);
+        releaseStorage();
         copyFrom(other);
 
         return *this;
@@ -2339,7 +2852,7 @@ namespace M {
 
 
     MatrixReal& MatrixReal::operator=(const MatrixBoolean& other) {
-        releaseDataStore(currentData);
+        releaseStorage();
         copyFrom(other);
 
         return *this;
@@ -2351,10 +2864,7 @@ namespace M {
         MatrixReal v = other.toMatrixReal(&ok);
 
         if (ok) {
-            assignExistingDataStore(v.currentData, false);
-
-            pendingTranspose   = v.pendingTranspose;
-            pendingScalarValue = v.pendingScalarValue;
+            operator=(std::move(v));
         } else {
             throw Model::InvalidRuntimeConversion(other.valueType(), ValueType::MATRIX_REAL);
         }
@@ -2364,101 +2874,205 @@ namespace M {
 
 
     MatrixReal& MatrixReal::operator+=(const MatrixReal& v) {
-        currentData->lock();
-        v.currentData->lock();
+        if (canAddInline(v)) {
+            addSmallStorage(*this, v, false);
+            return *this;
+        }
+
+        bool addendIsDense = v.matrixType() == MatrixType::DENSE;
+        if (canAccumulateInPlace(v.dataStore()) && (addendIsDense || pendingScalarValue == Scalar(1))) {
+            ReferenceCounter::lockPair(dataStore(), v.dataStore());
+
+            try {
+                DenseData* augend = POLYMORPHIC_CAST<DenseData*>(dataStore());
+                if (addendIsDense) {
+                    augend->scaleAccumulate(
+                        *POLYMORPHIC_CAST<const DenseData*>(v.dataStore()),
+                        v.pendingTranspose,
+                        pendingScalarValue,
+                        v.pendingScalarValue
+                    );
+                } else {
+                    augend->scaleAccumulate(
+                        *POLYMORPHIC_CAST<const SparseData*>(v.dataStore()),
+                        v.pendingTranspose,
+                        pendingScalarValue,
+                        v.pendingScalarValue
+                    );
+                }
+            } catch (...) {
+                v.dataStore()->unlock();
+                dataStore()->unlock();
+                throw;
+            }
+
+            v.dataStore()->unlock();
+            dataStore()->unlock();
+
+            pendingScalarValue = Scalar(1);
+            applyStoragePolicy(false);
+
+            return *this;
+        }
+
+        ReferenceCounter::lockPair(dataStore(), v.dataStore());
 
         Data* newDataStore = nullptr;
-        if (v.currentData->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->add(
-                *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
-                pendingTranspose,
-                v.pendingTranspose,
-                pendingScalarValue,
-                v.pendingScalarValue
-            );
-        } else {
-            assert(v.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false);
-//            newDataStore = currentData->add(
-//                *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
-//                pendingTransform,
-//                v.pendingTransform,
-//                pendingScalarValue,
-//                v.pendingScalarValue
-//            );
-        }
-
-        v.currentData->unlock();
+        try {
+            if (v.dataStore()->matrixType() == MatrixType::DENSE) {
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const DenseData*>(v.dataStore()),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarValue,
+                    v.pendingScalarValue
+                );
+            } else {
+                assert(v.dataStore()->matrixType() == MatrixType::SPARSE);
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const SparseData*>(v.dataStore()),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarValue,
+                    v.pendingScalarValue
+                );
+            }
+        } catch (...) {
+            v.dataStore()->unlock();
+            dataStore()->unlock();
+            throw;
+        }
+
+        v.dataStore()->unlock();
         assignNewDataStore(newDataStore, true);
 
         pendingTranspose   = false;
         pendingScalarValue = Scalar(1);
 
+        applyStoragePolicy(false);
+
         return *this;
     }
 
 
     MatrixReal& MatrixReal::operator-=(const MatrixReal& v) {
-        currentData->lock();
-        v.currentData->lock();
+        if (canAddInline(v)) {
+            addSmallStorage(*this, v, true);
+            return *this;
+        }
+
+        bool addendIsDense = v.matrixType() == MatrixType::DENSE;
+        if (canAccumulateInPlace(v.dataStore()) && (addendIsDense || pendingScalarValue == Scalar(1))) {
+            ReferenceCounter::lockPair(dataStore(), v.dataStore());
+
+            try {
+                DenseData* augend = POLYMORPHIC_CAST<DenseData*>(dataStore());
+                if (addendIsDense) {
+                    augend->scaleAccumulate(
+                        *POLYMORPHIC_CAST<const DenseData*>(v.dataStore()),
+                        v.pendingTranspose,
+                        pendingScalarValue,
+                        -v.pendingScalarValue
+                    );
+                } else {
+                    augend->scaleAccumulate(
+                        *POLYMORPHIC_CAST<const SparseData*>(v.dataStore()),
+                        v.pendingTranspose,
+                        pendingScalarValue,
+                        -v.pendingScalarValue
+                    );
+                }
+            } catch (...) {
+                v.dataStore()->unlock();
+                dataStore()->unlock();
+                throw;
+            }
+
+            v.dataStore()->unlock();
+            dataStore()->unlock();
+
+            pendingScalarValue = Scalar(1);
+            applyStoragePolicy(false);
+
+            return *this;
+        }
+
+        ReferenceCounter::lockPair(dataStore(), v.dataStore());
 
         Data* newDataStore = nullptr;
-        if (v.currentData->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->add(
-                *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
-                pendingTranspose,
-                v.pendingTranspose,
-                pendingScalarValue,
-                -v.pendingScalarValue
-            );
-        } else {
-            assert(v.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false);
-//            newDataStore = currentData->add(
-//                *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
-//                pendingTransform,
-//                v.pendingTransform,
-//                pendingScalarValue,
-//                -v.pendingScalarValue
-//            );
-        }
-
-        v.currentData->unlock();
+        try {
+            if (v.dataStore()->matrixType() == MatrixType::DENSE) {
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const DenseData*>(v.dataStore()),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarValue,
+                    -v.pendingScalarValue
+                );
+            } else {
+                assert(v.dataStore()->matrixType() == MatrixType::SPARSE);
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const SparseData*>(v.dataStore()),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarValue,
+                    -v.pendingScalarValue
+                );
+            }
+        } catch (...) {
+            v.dataStore()->unlock();
+            dataStore()->unlock();
+            throw;
+        }
+
+        v.dataStore()->unlock();
         assignNewDataStore(newDataStore, true);
 
         pendingTranspose   = false;
         pendingScalarValue = Scalar(1);
 
+        applyStoragePolicy(false);
+
         return *this;
     }
 
 
     MatrixReal& MatrixReal::operator*=(const MatrixReal& v) {
+        if (canMultiplyInline(v)) {
+            multiplySmallStorage(*this, v);
+            return *this;
+        }
+
         Data* newDataStore;
 
         Real  scalarMultiplier = pendingScalarValue * v.pendingScalarValue;
-        Data* multiplicand     = v.currentData;
-
-        currentData->lock();
-
-        multiplicand->lock();
-        if (multiplicand->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->multiply(
-                static_cast<const DenseData&>(*multiplicand),
-                pendingTranspose,
-                v.pendingTranspose,
-                scalarMultiplier
-            );
-        } else {
-            assert(multiplicand->matrixType() == MatrixType::SPARSE);
+        Data* multiplicand     = v.dataStore();
+
+        ReferenceCounter::lockPair(dataStore(), multiplicand);
+        try {
+            if (multiplicand->matrixType() == MatrixType::DENSE) {
+                newDataStore = dataStore()->multiply(
+                    static_cast<const DenseData&>(*multiplicand),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    scalarMultiplier
+                );
+            } else {
+                assert(multiplicand->matrixType() == MatrixType::SPARSE);
 
-            newDataStore = currentData->multiply(
-                static_cast<const SparseData&>(*multiplicand),
-                pendingTranspose,
-                v.pendingTranspose,
-                scalarMultiplier
-            );
+                newDataStore = dataStore()->multiply(
+                    static_cast<const SparseData&>(*multiplicand),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    scalarMultiplier
+                );
+            }
+        } catch (...) {
+            multiplicand->unlock();
+            dataStore()->unlock();
+            throw;
         }
+
         multiplicand->unlock();
         assignNewDataStore(newDataStore, true);
 
@@ -2500,35 +3114,55 @@ namespace M {
     }
 
 
-    MatrixReal MatrixReal::operator+(const MatrixReal& v) const {
-        currentData->lock();
-        v.currentData->lock();
+    MatrixReal MatrixReal::operator+(const MatrixReal& v) const & {
+        if (canAddInline(v)) {
+            MatrixReal result;
+            result.addSmallStorage(*this, v, false);
+
+            return result;
+        }
+
+        ReferenceCounter::lockPair(dataStore(), v.dataStore());
 
         Data* newDataStore = nullptr;
-        if (v.currentData->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->add(
-                *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
-                pendingTranspose,
-                v.pendingTranspose,
-                pendingScalarValue,
-                v.pendingScalarValue
-            );
-        } else {
-            assert(v.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
-//            newDataStore = currentData->add(
-//                *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
-//                pendingTransform,
-//                v.pendingTransform,
-//                pendingScalarValue,
-//                v.pendingScalarValue
-//            );
+        try {
+            if (v.dataStore()->matrixType() == MatrixType::DENSE) {
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const DenseData*>(v.dataStore()),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarValue,
+                    v.pendingScalarValue
+                );
+            } else {
+                assert(v.dataStore()->matrixType() == MatrixType::SPARSE);
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const SparseData*>(v.dataStore()),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarValue,
+                    v.pendingScalarValue
+                );
+            }
+        } catch (...) {
+            v.dataStore()->unlock();
+            dataStore()->unlock();
+            throw;
         }
 
-        v.currentData->unlock();
-        currentData->unlock();
+        v.dataStore()->unlock();
+        dataStore()->unlock();
 
-        return MatrixReal(newDataStore);
+        MatrixReal result(newDataStore);
+        result.applyStoragePolicy(false);
+
+        return result;
+    }
+
+
+    MatrixReal MatrixReal::operator+(const MatrixReal& v) && {
+        operator+=(v);
+        return std::move(*this);
     }
 
 
@@ -2542,35 +3176,55 @@ namespace M {
     }
 
 
-    MatrixReal MatrixReal::operator-(const MatrixReal& v) const {
-        currentData->lock();
-        v.currentData->lock();
+    MatrixReal MatrixReal::operator-(const MatrixReal& v) const & {
+        if (canAddInline(v)) {
+            MatrixReal result;
+            result.addSmallStorage(*this, v, true);
+
+            return result;
+        }
+
+        ReferenceCounter::lockPair(dataStore(), v.dataStore());
 
         Data* newDataStore = nullptr;
-        if (v.currentData->matrixType() == MatrixType::DENSE) {
-            newDataStore = currentData->add(
-                *POLYMORPHIC_CAST<const DenseData*>(v.currentData),
-                pendingTranspose,
-                v.pendingTranspose,
-                pendingScalarValue,
-                -v.pendingScalarValue
-            );
-        } else {
-            assert(v.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false);
-//            newDataStore = currentData->add(
-//                *POLYMORPHIC_CAST<const SparseData*>(v.currentData),
-//                pendingTransform,
-//                v.pendingTransform,
-//                pendingScalarValue,
-//                -v.pendingScalarValue
-//            );
+        try {
+            if (v.dataStore()->matrixType() == MatrixType::DENSE) {
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const DenseData*>(v.dataStore()),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarValue,
+                    -v.pendingScalarValue
+                );
+            } else {
+                assert(v.dataStore()->matrixType() == MatrixType::SPARSE);
+                newDataStore = dataStore()->add(
+                    *POLYMORPHIC_CAST<const SparseData*>(v.dataStore()),
+                    pendingTranspose,
+                    v.pendingTranspose,
+                    pendingScalarValue,
+                    -v.pendingScalarValue
+                );
+            }
+        } catch (...) {
+            v.dataStore()->unlock();
+            dataStore()->unlock();
+            throw;
         }
 
-        v.currentData->unlock();
-        currentData->unlock();
+        v.dataStore()->unlock();
+        dataStore()->unlock();
+
+        MatrixReal result(newDataStore);
+        result.applyStoragePolicy(false);
 
-        return MatrixReal(newDataStore);
+        return result;
+    }
+
+
+    MatrixReal MatrixReal::operator-(const MatrixReal& v) && {
+        operator-=(v);
+        return std::move(*this);
     }
 
 
@@ -2585,14 +3239,21 @@ namespace M {
 
 
     MatrixReal MatrixReal::operator*(const MatrixReal& v) const {
+        if (canMultiplyInline(v)) {
+            MatrixReal result;
+            result.multiplySmallStorage(*this, v);
+
+            return result;
+        }
+
         Data* result;
 
         Real  scalarMultiplier = pendingScalarValue * v.pendingScalarValue;
-        Data* multiplicand     = v.currentData;
+        Data* multiplicand     = v.dataStore();
 
         if (multiplicand->matrixType() == MatrixType::DENSE) {
             Scalar scalarMultiplier = pendingScalarValue * v.pendingScalarValue;
-            result = currentData->multiply(
+            result = dataStore()->multiply(
                 static_cast<const DenseData&>(*multiplicand),
                 pendingTranspose,
                 v.pendingTranspose,
@@ -2601,7 +3262,7 @@ namespace M {
         } else {
             assert(multiplicand->matrixType() == MatrixType::SPARSE);
 
-            result = currentData->multiply(
+            result = dataStore()->multiply(
                 static_cast<const SparseData&>(*multiplicand),
                 pendingTranspose,
                 v.pendingTranspose,
@@ -2675,20 +3336,38 @@ namespace M {
     bool MatrixReal::operator==(const MatrixReal& other) const {
         bool result;
 
-        if (other.currentData->matrixType() == Matrix::MatrixType::DENSE) {
+        if (hasSmallStorage() && other.hasSmallStorage()) {
             applyLazyTransformsAndScaling();
             other.applyLazyTransformsAndScaling();
 
-            if (currentData == other.currentData) {
+            result = (
+                   smallNumberRows == other.smallNumberRows
+                && smallNumberColumns == other.smallNumberColumns
+                && std::equal(
+                       smallCoefficients,
+                       smallCoefficients + smallNumberRows * smallNumberColumns,
+                       other.smallCoefficients
+                   )
+            );
+        } else if (other.matrixType() == Matrix::MatrixType::DENSE) {
+            applyLazyTransformsAndScaling();
+            other.applyLazyTransformsAndScaling();
+
+            if (dataStore() == other.dataStore()) {
                 result = true;
             } else {
-                result = currentData->isEqualTo(*POLYMORPHIC_CAST<const DenseData*>(other.currentData));
+                result = dataStore()->isEqualTo(*POLYMORPHIC_CAST<const DenseData*>(other.dataStore()));
             }
         } else {
-            assert(other.currentData->matrixType() == Matrix::MatrixType::SPARSE);
-            assert(false); // FIXME
-            result = false;
-//            result = currentData->isEqualTo(*POLYMORPHIC_CAST<const SparseData*>(other.currentData));
+            assert(other.dataStore()->matrixType() == Matrix::MatrixType::SPARSE);
+            applyLazyTransformsAndScaling();
+            other.applyLazyTransformsAndScaling();
+
+            if (dataStore() == other.dataStore()) {
+                result = true;
+            } else {
+                result = dataStore()->isEqualTo(*POLYMORPHIC_CAST<const SparseData*>(other.dataStore()));
+            }
         }
 
         return result;
@@ -2698,7 +3377,7 @@ namespace M {
     int MatrixReal::relativeOrder(const MatrixReal& other) const {
         int result;
 
-        if (currentData == other.currentData) {
+        if (dataStore() == other.dataStore()) {
             if (pendingTranspose == other.pendingTranspose) {
                 if (pendingScalarValue < other.pendingScalarValue) {
                     result = -1;
@@ -2714,7 +3393,7 @@ namespace M {
             applyLazyTransformsAndScaling();
             other.applyLazyTransformsAndScaling();
 
-            result = currentData->relativeOrder(*other.currentData);
+            result = dataStore()->relativeOrder(*other.dataStore());
         }
 
         return result;
@@ -2725,6 +3404,7 @@ namespace M {
             Data* dataStore
         ):currentData(
             dataStore
+        ),currentView(
         ),pendingTranspose(
             false
         ),pendingScalarValue(
@@ -2733,13 +3413,15 @@ namespace M {
 
 
     void MatrixReal::copyFrom(const MatrixBoolean& booleanMatrix) {
+        currentView.parent = nullptr;
+
         MatrixBoolean::Data* otherData = booleanMatrix.currentData;
 
         if (otherData->matrixType() == MatrixType::DENSE) {
             currentData = DenseData::create(*POLYMORPHIC_CAST<MatrixBoolean::DenseData*>(otherData));
         } else {
             assert(otherData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            currentData = SparseData::create(*POLYMORPHIC_CAST<MatrixBoolean::SparseData*>(otherData));
         }
 
         pendingTranspose   = booleanMatrix.pendingTranspose;
@@ -2748,6 +3430,8 @@ namespace M {
 
 
     void MatrixReal::copyFrom(const MatrixInteger& integerMatrix) {
+        currentView.parent = nullptr;
+
         if (integerMatrix.currentData->matrixType() == MatrixType::DENSE) {
             const MatrixInteger::DenseData*
                 data = POLYMORPHIC_CAST<const MatrixInteger::DenseData*>(integerMatrix.currentData);
@@ -2757,21 +3441,28 @@ namespace M {
             pendingScalarValue = Real(integerMatrix.pendingScalarMultiplierValue);
         } else {
             assert(integerMatrix.currentData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            const MatrixInteger::SparseData*
+                data = POLYMORPHIC_CAST<const MatrixInteger::SparseData*>(integerMatrix.currentData);
+
+            currentData        = SparseData::create(*data);
+            pendingTranspose   = integerMatrix.pendingTranspose;
+            pendingScalarValue = Real(integerMatrix.pendingScalarMultiplierValue);
         }
     }
 
 
     void MatrixReal::copyFrom(const MatrixComplex& complexMatrix) {
+        currentView.parent = nullptr;
+
         complexMatrix.applyLazyTransformsAndScaling();
 
-        MatrixComplex::Data* otherData = complexMatrix.currentData;
+        MatrixComplex::Data* otherData = complexMatrix.dataStore();
 
         if (otherData->matrixType() == MatrixType::DENSE) {
             currentData = DenseData::create(*POLYMORPHIC_CAST<MatrixComplex::DenseData*>(otherData));
         } else {
             assert(otherData->matrixType() == MatrixType::SPARSE);
-            assert(false); // FIXME
+            currentData = SparseData::create(*POLYMORPHIC_CAST<MatrixComplex::SparseData*>(otherData));
         }
 
         pendingTranspose   = false;
@@ -2780,12 +3471,264 @@ namespace M {
 
 
     void MatrixReal::releaseDataStore(MatrixReal::Data* dataStore) const {
-        if (dataStore->removeReference()) {
+        if (dataStore != nullptr && dataStore->removeReference()) {
             Data::destroy(dataStore);
         }
     }
 
 
+    void MatrixReal::materializeDataStore() const {
+        if (currentView.parent != nullptr) {
+            currentData = currentView.parent->copySubmatrix<DenseData>(
+                currentView.firstRow,
+                currentView.rowStride,
+                currentView.numberRows,
+                currentView.firstColumn,
+                currentView.columnStride,
+                currentView.numberColumns
+            );
+
+            releaseDataStore(currentView.parent);
+            currentView.parent = nullptr;
+        } else {
+            currentData = DenseData::create(smallNumberRows, smallNumberColumns, smallCoefficients);
+        }
+    }
+
+
+    void MatrixReal::copyStorage(const MatrixReal& other) {
+        if (other.currentData != nullptr) {
+            other.currentData->addReference();
+            currentData        = other.currentData;
+            currentView.parent = nullptr;
+        } else if (other.currentView.parent != nullptr) {
+            other.currentView.parent->addReference();
+            currentData = nullptr;
+            currentView = other.currentView;
+        } else {
+            copySmallStorage(other);
+        }
+
+        pendingTranspose   = other.pendingTranspose;
+        pendingScalarValue = other.pendingScalarValue;
+    }
+
+
+    void MatrixReal::moveStorage(MatrixReal& other) noexcept {
+        if (other.hasSmallStorage()) {
+            copySmallStorage(other);
+        } else {
+            currentData = other.currentData;
+            currentView = other.currentView;
+        }
+
+        pendingTranspose   = other.pendingTranspose;
+        pendingScalarValue = other.pendingScalarValue;
+
+        other.configureSmallStorage(0, 0);
+    }
+
+
+    void MatrixReal::releaseStorage() const {
+        releaseDataStore(currentData);
+        releaseDataStore(currentView.parent);
+    }
+
+
+    MatrixReal::Scalar MatrixReal::storedCoefficient(unsigned long rowIndex, unsigned long columnIndex) const {
+        Scalar result;
+
+        if (currentData != nullptr) {
+            result = static_cast<const Data*>(currentData)->at(rowIndex, columnIndex);
+        } else if (currentView.parent != nullptr) {
+            result = static_cast<const DenseData*>(currentView.parent)->at(
+                stridedIndex(currentView.firstRow, currentView.rowStride, rowIndex),
+                stridedIndex(currentView.firstColumn, currentView.columnStride, columnIndex)
+            );
+        } else {
+            result = smallCoefficients[columnIndex * smallNumberRows + rowIndex];
+        }
+
+        return result;
+    }
+
+
+    MatrixReal MatrixReal::submatrix(
+            unsigned long firstRow,
+            long long     rowStride,
+            unsigned long rowCount,
+            unsigned long firstColumn,
+            long long     columnStride,
+            unsigned long columnCount
+        ) const {
+        MatrixReal result;
+
+        if (MatrixSmallPrivate<Scalar>::isSmall(rowCount, columnCount)) {
+            result.configureSmallStorage(rowCount, columnCount);
+
+            for (unsigned long columnIndex=0 ; columnIndex<columnCount ; ++columnIndex) {
+                unsigned long sourceColumnIndex = stridedIndex(firstColumn, columnStride, columnIndex);
+
+                for (unsigned long rowIndex=0 ; rowIndex<rowCount ; ++rowIndex) {
+                    result.smallCoefficients[columnIndex * rowCount + rowIndex] = storedCoefficient(
+                        stridedIndex(firstRow, rowStride, rowIndex),
+                        sourceColumnIndex
+                    );
+                }
+            }
+        } else {
+            SubmatrixView view;
+
+            if (currentData == nullptr) {
+                view.parent       = currentView.parent;
+                view.firstRow     = stridedIndex(currentView.firstRow, currentView.rowStride, firstRow);
+                view.rowStride    = currentView.rowStride * rowStride;
+                view.firstColumn  = stridedIndex(currentView.firstColumn, currentView.columnStride, firstColumn);
+                view.columnStride = currentView.columnStride * columnStride;
+            } else {
+                view.parent       = POLYMORPHIC_CAST<DenseData*>(currentData);
+                view.firstRow     = firstRow;
+                view.rowStride    = rowStride;
+                view.firstColumn  = firstColumn;
+                view.columnStride = columnStride;
+            }
+
+            view.numberRows    = rowCount;
+            view.numberColumns = columnCount;
+
+            view.parent->addReference();
+            result.releaseStorage();
+
+            result.currentData = nullptr;
+            result.currentView = view;
+        }
+
+        return result;
+    }
+
+
+    void MatrixReal::configureSmallStorage(unsigned long newNumberRows, unsigned long newNumberColumns) const {
+        assert(MatrixSmallPrivate<Scalar>::isSmall(newNumberRows, newNumberColumns));
+
+        currentData        = nullptr;
+        currentView.parent = nullptr;
+        pendingTranspose   = false;
+        pendingScalarValue = Scalar(1);
+        smallNumberRows    = static_cast<unsigned char>(newNumberRows);
+        smallNumberColumns = static_cast<unsigned char>(newNumberColumns);
+    }
+
+
+    void MatrixReal::copySmallStorage(const MatrixReal& other) {
+        unsigned long numberCoefficients = static_cast<unsigned long>(other.smallNumberRows) * other.smallNumberColumns;
+
+        currentData        = nullptr;
+        currentView.parent = nullptr;
+        smallNumberRows    = other.smallNumberRows;
+        smallNumberColumns = other.smallNumberColumns;
+
+        std::copy(other.smallCoefficients, other.smallCoefficients + numberCoefficients, smallCoefficients);
+    }
+
+
+    void MatrixReal::resizeSmallStorage(unsigned long newNumberRows, unsigned long newNumberColumns) {
+        Scalar        oldCoefficients[smallMatrixMaximumDimension * smallMatrixMaximumDimension];
+        unsigned long oldNumberRows    = smallNumberRows;
+        unsigned long oldNumberColumns = smallNumberColumns;
+        unsigned long keptRows         = std::min(oldNumberRows, newNumberRows);
+        unsigned long keptColumns      = std::min(oldNumberColumns, newNumberColumns);
+
+        std::copy(smallCoefficients, smallCoefficients + oldNumberRows * oldNumberColumns, oldCoefficients);
+        std::fill(smallCoefficients, smallCoefficients + newNumberRows * newNumberColumns, Scalar(0));
+
+        for (unsigned long columnIndex=0 ; columnIndex<keptColumns ; ++columnIndex) {
+            for (unsigned long rowIndex=0 ; rowIndex<keptRows ; ++rowIndex) {
+                smallCoefficients[columnIndex * newNumberRows + rowIndex] = (
+                    oldCoefficients[columnIndex * oldNumberRows + rowIndex]
+                );
+            }
+        }
+
+        smallNumberRows    = static_cast<unsigned char>(newNumberRows);
+        smallNumberColumns = static_cast<unsigned char>(newNumberColumns);
+    }
+
+
+    bool MatrixReal::canAddInline(const MatrixReal& other) const {
+        return (
+               hasSmallStorage()
+            && other.hasSmallStorage()
+            && numberRows() == other.numberRows()
+            && numberColumns() == other.numberColumns()
+        );
+    }
+
+
+    bool MatrixReal::canMultiplyInline(const MatrixReal& other) const {
+        return (
+               hasSmallStorage()
+            && other.hasSmallStorage()
+            && numberColumns() == other.numberRows()
+            && numberRows() > 0
+            && numberColumns() > 0
+            && other.numberColumns() > 0
+        );
+    }
+
+
+    void MatrixReal::addSmallStorage(const MatrixReal& augend, const MatrixReal& addend, bool subtract) {
+        unsigned long numberRows    = static_cast<unsigned long>(augend.numberRows());
+        unsigned long numberColumns = static_cast<unsigned long>(augend.numberColumns());
+        Scalar        sum[smallMatrixMaximumDimension * smallMatrixMaximumDimension];
+
+        MatrixSmallPrivate<Scalar>::scaleAdd(
+            numberRows,
+            numberColumns,
+            augend.pendingScalarValue,
+            augend.smallCoefficients,
+            augend.smallNumberRows,
+            augend.pendingTranspose,
+            subtract ? -addend.pendingScalarValue : addend.pendingScalarValue,
+            addend.smallCoefficients,
+            addend.smallNumberRows,
+            addend.pendingTranspose,
+            sum,
+            numberRows
+        );
+
+        releaseStorage();
+        configureSmallStorage(numberRows, numberColumns);
+        std::copy(sum, sum + numberRows * numberColumns, smallCoefficients);
+    }
+
+
+    void MatrixReal::multiplySmallStorage(const MatrixReal& multiplier, const MatrixReal& multiplicand) {
+        unsigned long numberRows     = static_cast<unsigned long>(multiplier.numberRows());
+        unsigned long innerDimension = static_cast<unsigned long>(multiplier.numberColumns());
+        unsigned long numberColumns  = static_cast<unsigned long>(multiplicand.numberColumns());
+        Scalar        product[smallMatrixMaximumDimension * smallMatrixMaximumDimension];
+
+        MatrixSmallPrivate<Scalar>::multiply(
+            numberRows,
+            innerDimension,
+            numberColumns,
+            multiplier.pendingScalarValue * multiplicand.pendingScalarValue,
+            multiplier.smallCoefficients,
+            multiplier.smallNumberRows,
+            multiplier.pendingTranspose,
+            multiplicand.smallCoefficients,
+            multiplicand.smallNumberRows,
+            multiplicand.pendingTranspose,
+            product,
+            numberRows
+        );
+
+        releaseStorage();
+        configureSmallStorage(numberRows, numberColumns);
+        std::copy(product, product + numberRows * numberColumns, smallCoefficients);
+    }
+
+
     void MatrixReal::assignNewDataStore(MatrixReal::Data* newDataStore, bool unlock) const {
         Data* oldData = currentData;
         currentData = newDataStore;
@@ -2804,11 +3747,58 @@ namespace M {
     }
 
 
+    bool MatrixReal::canAccumulateInPlace(const MatrixReal::Data* operand) const {
+        return (
+               !pendingTranspose
+            && operand != dataStore()
+            && dataStore()->matrixType() == MatrixType::DENSE
+            && dataStore()->referenceCount() == 1
+        );
+    }
+
+
     void MatrixReal::applyLazyTransformsAndScaling() const {
-        if (pendingScalarValue != Scalar(1) || pendingTranspose) {
-            currentData->lock();
-            Data* newDataStore = currentData->applyTransformAndScaling(pendingTranspose, pendingScalarValue);
-            assignNewDataStore(newDataStore, true);
+        if (hasSmallStorage()) {
+            if (pendingScalarValue != Scalar(1) || pendingTranspose) {
+                unsigned long numberRows    = static_cast<unsigned long>(MatrixReal::numberRows());
+                unsigned long numberColumns = static_cast<unsigned long>(MatrixReal::numberColumns());
+                Scalar        result[smallMatrixMaximumDimension * smallMatrixMaximumDimension];
+
+                MatrixSmallPrivate<Scalar>::scaleCopy(
+                    numberRows,
+                    numberColumns,
+                    pendingScalarValue,
+                    smallCoefficients,
+                    smallNumberRows,
+                    pendingTranspose,
+                    result,
+                    numberRows
+                );
+
+                configureSmallStorage(numberRows, numberColumns);
+                std::copy(result, result + numberRows * numberColumns, smallCoefficients);
+            }
+        } else if (pendingScalarValue != Scalar(1) || pendingTranspose) {
+            bool updateInPlace = (
+                   dataStore()->matrixType() == MatrixType::DENSE
+                && dataStore()->referenceCount() == 1
+                && (!pendingTranspose || dataStore()->numberRows() == dataStore()->numberColumns())
+            );
+
+            if (updateInPlace) {
+                DenseData* denseData = POLYMORPHIC_CAST<DenseData*>(dataStore());
+                if (pendingTranspose) {
+                    denseData->transposeInPlace();
+                }
+
+                if (pendingScalarValue != Scalar(1)) {
+                    denseData->scaleInPlace(pendingScalarValue);
+                }
+            } else {
+                dataStore()->lock();
+                Data* newDataStore = dataStore()->applyTransformAndScaling(pendingTranspose, pendingScalarValue);
+                assignNewDataStore(newDataStore, true);
+            }
 
             pendingTranspose   = false;
             pendingScalarValue = Scalar(1);
@@ -2816,6 +3806,43 @@ namespace M {
     }
 
 
+    void MatrixReal::convertToDenseDataStore() const {
+        applyLazyTransformsAndScaling();
+
+        if (dataStore()->matrixType() == MatrixType::SPARSE) {
+            dataStore()->lock();
+            Data* newDataStore = POLYMORPHIC_CAST<const SparseData*>(dataStore())->toDense();
+            assignNewDataStore(newDataStore, true);
+        }
+    }
+
+
+    void MatrixReal::applyStoragePolicy(bool checkDense) const {
+        unsigned long long numberCoefficients =   static_cast<unsigned long long>(numberRows())
+                                                * static_cast<unsigned long long>(numberColumns());
+
+        if (numberCoefficients > 0 && numberCoefficients >= currentAutomaticStorageMinimumCoefficients) {
+            if (matrixType() == MatrixType::SPARSE) {
+                const SparseData* sparseData = POLYMORPHIC_CAST<const SparseData*>(dataStore());
+                if (sparseData->numberNonZeros() > currentDenseDensityThreshold * numberCoefficients) {
+                    dataStore()->lock();
+                    Data* newDataStore = sparseData->toDense();
+                    assignNewDataStore(newDataStore, true);
+                }
+            } else if (checkDense && currentSparseDensityThreshold > 0) {
+                assert(matrixType() == MatrixType::DENSE);
+
+                const DenseData* denseData = POLYMORPHIC_CAST<const DenseData*>(dataStore());
+                if (denseData->numberNonZeros() <= currentSparseDensityThreshold * numberCoefficients) {
+                    dataStore()->lock();
+                    Data* newDataStore = SparseData::create(*denseData);
+                    assignNewDataStore(newDataStore, true);
+                }
+            }
+        }
+    }
+
+
     MatrixReal operator*(Boolean a, const MatrixReal& b) {
         return b * Integer(a);
     }
@@ -28,25 +28,36 @@
 #include <new>
 #include <cstring>
 #include <cstdint>
+#include <cstdlib>
+#include <cstdio>
 #include <cassert>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <fstream>
 #include <iomanip>
 #include <vector>
 #include <string>
+#include <sstream>
+#include <locale>
+#include <iterator>
+#include <thread>
+#include <future>
 #include <chrono> // Debug
 
-#include <boost/algorithm/string.hpp>
-
 #include "m_api_types.h"
 #include "m_intrinsic_types.h"
 #include "m_basic_functions.h"
+#include "m_trigonometric_functions.h"
+#include "m_hyperbolic_functions.h"
+#include "m_special_values.h"
 #include "model_exceptions.h"
 #include "model_range.h"
 #include "m_per_thread.h"
+#include "m_ziggurat.h"
 #include "m_matrix_dense_private.h"
 #include "m_matrix_sparse_private.h"
+#include "m_matrix_small_private.h"
 #include "m_matrix_complex.h"
 #include "m_matrix_complex_data.h"
 #include "m_matrix_complex_dense_data.h"
@@ -60,6 +71,7 @@
 #include "m_matrix_real.h"
 #include "m_matrix_real_data.h"
 #include "m_matrix_real_dense_data.h"
+#include "m_matrix_real_sparse_data.h"
 
 namespace M {
     long double MatrixReal::DenseData::currentSmallLimit = -1;
@@ -286,56 +298,39 @@ namespace M {
 
 
     bool MatrixReal::DenseData::toFile(const char* filename, Model::DataFileFormat fileFormat) const {
-        bool          success              = true;
-        unsigned long currentNumberRows    = static_cast<unsigned long>(numberRows());
-        unsigned long currentNumberColumns = static_cast<unsigned long>(numberColumns());
-
-        switch (fileFormat) {
-            case Model::DataFileFormat::CSV: {
-                std::ofstream f(filename);
+        // We write to a temporary file and then move it into place.  The destination may be the file backing a memory
+        // mapped matrix.  Truncating that file in place would change the mapped coefficients or fault on access.
 
-                if (!f) {
-                    internalTriggerFileOpenError(filename);
-                    success = false;
-                }
-
-                unsigned long rowIndex = 0;
-                while (success && rowIndex < currentNumberRows) {
-                    unsigned long columnIndex = 0;
-                    while (success && columnIndex < currentNumberColumns) {
-                        if (columnIndex > 0) {
-                            f << "\t" << std::setprecision(17) << at(rowIndex, columnIndex);
-                        } else {
-                            f << std::setprecision(17) << at(rowIndex, columnIndex);
-                        }
+        std::string temporaryFilename = std::string(filename) + ".tmp";
+        bool        success;
 
-                        if (!f) {
-                            internalTriggerFileWriteError(filename);
-                            success = false;
-                        }
+        try {
+            success = writeFile(temporaryFilename.c_str(), fileFormat);
+        } catch (...) {
+            std::remove(temporaryFilename.c_str());
+            throw;
+        }
 
-                        ++columnIndex;
-                    }
+        if (!success) {
+            std::remove(temporaryFilename.c_str());
+        } else if (!replaceFile(temporaryFilename.c_str(), filename)) {
+            std::remove(temporaryFilename.c_str());
+            internalTriggerFileWriteError(filename);
+            success = false;
+        }
 
-                    if (success) {
-                        f << std::endl;
-                        if (!f) {
-                            internalTriggerFileWriteError(filename);
-                            success = false;
-                        }
-                    }
+        return success;
+    }
 
-                    ++rowIndex;
-                }
 
-                if (success) {
-                    f.close();
-                    if (!f) {
-                        internalTriggerFileWriteError(filename);
-                        success = false;
-                    }
-                }
+    bool MatrixReal::DenseData::writeFile(const char* filename, Model::DataFileFormat fileFormat) const {
+        bool          success              = true;
+        unsigned long currentNumberRows    = static_cast<unsigned long>(numberRows());
+        unsigned long currentNumberColumns = static_cast<unsigned long>(numberColumns());
 
+        switch (fileFormat) {
+            case Model::DataFileFormat::CSV: {
+                success = toCsvFile(filename);
                 break;
             }
 
@@ -345,62 +340,48 @@ namespace M {
                     internalTriggerFileOpenError(filename);
                     success = false;
                 } else {
-                    unsigned      i      = 6;
-                    std::uint8_t* buffer = new std::uint8_t[4096];
-
-                    std::memcpy(buffer, "INEBIN", 6);
-                    buffer[i++] = 0;
-                    buffer[i++] = 'R';
-
-                    buffer[i++] = static_cast<std::uint8_t>(currentNumberRows      );
-                    buffer[i++] = static_cast<std::uint8_t>(currentNumberRows >>  8);
-                    buffer[i++] = static_cast<std::uint8_t>(currentNumberRows >> 16);
-                    buffer[i++] = static_cast<std::uint8_t>(currentNumberRows >> 24);
-
-                    buffer[i++] = static_cast<std::uint8_t>(currentNumberColumns      );
-                    buffer[i++] = static_cast<std::uint8_t>(currentNumberColumns >>  8);
-                    buffer[i++] = static_cast<std::uint8_t>(currentNumberColumns >> 16);
-                    buffer[i++] = static_cast<std::uint8_t>(currentNumberColumns >> 24);
-
-                    unsigned long rowIndex = 0;
-                    while (success && rowIndex < currentNumberRows) {
-                        unsigned long columnIndex = 0;
-                        while (success && columnIndex < currentNumberColumns) {
-                            *reinterpret_cast<Scalar*>(buffer + i) = at(rowIndex, columnIndex);
-                            i += sizeof(Scalar);
-
-                            if (i >= 4096) {
-                                f.write(reinterpret_cast<const char*>(buffer), 4096);
-                                if (!f) {
-                                    delete[] buffer;
-                                    buffer = nullptr;
-
-                                    internalTriggerFileWriteError(filename);
-                                    success = false;
-                                }
-
-                                i = 0;
-                            }
-
-                            ++columnIndex;
-                        }
-
-                        ++rowIndex;
+                    // Version 2 header:
+                    //     bytes  0 -  5: "INEBIN"
+                    //     byte        6: format version, 2
+                    //     byte        7: coefficient type, 'R'
+                    //     bytes  8 - 15: number rows, little endian
+                    //     bytes 16 - 23: number columns, little endian
+                    //     bytes 24 - 31: column spacing in coefficients, little endian
+                    //     bytes 32 - 39: coefficient size in bytes, little endian
+                    //     bytes 40 - 63: reserved, zero
+                    //
+                    // The header is followed by the raw, column major matrix data including column padding so the
+                    // file can be memory mapped directly.
+
+                    unsigned long long columnSpacing = columnSpacingInMemory();
+                    std::uint8_t       header[binaryHeaderSizeInBytes];
+
+                    std::memset(header, 0, binaryHeaderSizeInBytes);
+                    std::memcpy(header, "INEBIN", 6);
+                    header[6] = 2;
+                    header[7] = 'R';
+
+                    writeLittleEndian(header +  8, currentNumberRows);
+                    writeLittleEndian(header + 16, currentNumberColumns);
+                    writeLittleEndian(header + 24, columnSpacing);
+                    writeLittleEndian(header + 32, sizeof(Scalar));
+
+                    f.write(reinterpret_cast<const char*>(header), binaryHeaderSizeInBytes);
+                    if (f) {
+                        std::streamsize dataSizeInBytes = static_cast<std::streamsize>(
+                            columnSpacing * currentNumberColumns * sizeof(Scalar)
+                        );
+
+                        f.write(reinterpret_cast<const char*>(data()), dataSizeInBytes);
                     }
 
-                    if (success && i != 0) {
-                        f.write(reinterpret_cast<const char*>(buffer), i);
-                        if (!f) {
-                            delete[] buffer;
-                            buffer = nullptr;
-
-                            internalTriggerFileWriteError(filename);
-                            success = false;
-                        }
+                    if (f) {
+                        f.close();
                     }
 
-                    if (buffer != nullptr) {
-                        delete[] buffer;
+                    if (!f) {
+                        internalTriggerFileWriteError(filename);
+                        success = false;
                     }
                 }
 
@@ -422,6 +403,7 @@ namespace M {
         bool                  success    = true;
         DenseData*            result     = nullptr;
         Model::DataFileFormat fileFormat = Model::DataFileFormat::CSV;
+        unsigned              version    = 0;
         std::ifstream         f(filename, std::ios::binary);
 
         if (f) {
@@ -431,6 +413,7 @@ namespace M {
             if (f) {
                 if (strncmp("INEBIN", buffer, 6) == 0) {
                     fileFormat = Model::DataFileFormat::BINARY;
+                    version    = static_cast<unsigned>(buffer[6]);
                 } else {
                     fileFormat = Model::DataFileFormat::CSV;
                 }
@@ -448,95 +431,20 @@ namespace M {
         if (success) {
             switch (fileFormat) {
                 case Model::DataFileFormat::CSV: {
-                    f.open(filename);
-                    if (!f) {
-                        internalTriggerFileOpenError(filename);
-                        success = false;
-                    }
-
-                    std::vector<std::vector<Scalar>> matrixData;
-                    unsigned long                    numberColumns = 0;
-
-                    while (success && f.peek() != EOF) { // IMHO, C++ stream are broken when testing against EOF.
-                        std::vector<Scalar> rowArray;
-
-                        std::string line;
-                        std::getline(f, line);
-                        if (!f) {
-                            internalTriggerFileReadError(filename);
-                            success = false;
-                        }
-
-                        std::string                 value;
-                        std::string::const_iterator it  = line.cbegin();
-                        std::string::const_iterator end = line.cend();
-
-                        while (success && it != end) {
-                            char c = *it;
-                            if (c == '\t' || c == ' ' || c == ',' || c == ';' || c == '|' || c == ':') {
-                                size_t index;
-                                Scalar rv = std::stod(value, &index);
-
-                                if (index != value.length()) {
-                                    internalTriggerFileReadError(filename);
-                                    success = false;
-                                } else {
-                                    rowArray.push_back(rv);
-                                    value.clear();
-                                }
-                            } else {
-                                value += c;
-                            }
-
-                            ++it;
-                        }
-
-                        if (success && value.length() > 0) {
-                            size_t index;
-                            Scalar rv = std::stod(value, &index);
-
-                            if (index != value.length()) {
-                                internalTriggerFileReadError(filename);
-                                success = false;
-                            }
-
-                            rowArray.push_back(rv);
-                        }
-
-                        if (success) {
-                            matrixData.push_back(rowArray);
-                            unsigned long rowLength = static_cast<unsigned long>(rowArray.size());
-                            if (rowLength > numberColumns) {
-                                numberColumns = rowLength;
-                            }
-                        }
-                    }
-
-                    if (success) {
-                        f.close();
-                        if (!f) {
-                            internalTriggerFileCloseError(filename);
-                            success = false;
-                        }
-                    }
-
-                    if (success) {
-                        unsigned long numberRows = static_cast<unsigned long>(matrixData.size());
-                        result = create(numberRows, numberColumns);
-
-                        for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
-                            const std::vector<Scalar>& rowArray = matrixData.at(rowIndex);
-                            unsigned long numberColumns = static_cast<unsigned long>(rowArray.size());
-                            for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
-                                result->at(rowIndex, columnIndex) = rowArray.at(columnIndex);
-                            }
-                        }
-                    }
+                    result  = fromCsvFile(filename);
+                    success = (result != nullptr);
 
                     break;
                 }
 
                 case Model::DataFileFormat::BINARY: {
+                    if (version >= 2) {
+                        result  = fromVersion2BinaryFile(filename);
+                        success = (result != nullptr);
+
+                        break;
+                    }
+
                     f.open(filename);
                     if (!f) {
                         internalTriggerFileOpenError(filename);
@@ -614,6 +522,495 @@ namespace M {
     }
 
 
+    void MatrixReal::DenseData::writeLittleEndian(std::uint8_t* destination, unsigned long long value) {
+        for (unsigned i=0 ; i<8 ; ++i) {
+            destination[i] = static_cast<std::uint8_t>(value >> (8 * i));
+        }
+    }
+
+
+    unsigned long long MatrixReal::DenseData::readLittleEndian(const std::uint8_t* source) {
+        unsigned long long result = 0;
+        for (unsigned i=0 ; i<8 ; ++i) {
+            result |= static_cast<unsigned long long>(source[i]) << (8 * i);
+        }
+
+        return result;
+    }
+
+
+    bool MatrixReal::DenseData::parseBinaryHeader(
+            const std::uint8_t* header,
+            unsigned long&      numberRows,
+            unsigned long&      numberColumns,
+            unsigned long long& columnSpacing
+        ) {
+        bool success = false;
+
+        if (std::memcmp(header, "INEBIN", 6) == 0 && header[6] == 2 && header[7] == 'R') {
+            unsigned long long rows            = readLittleEndian(header +  8);
+            unsigned long long columns         = readLittleEndian(header + 16);
+            unsigned long long spacing         = readLittleEndian(header + 24);
+            unsigned long long coefficientSize = readLittleEndian(header + 32);
+
+            if (coefficientSize == sizeof(Scalar)                                     &&
+                rows <= std::numeric_limits<unsigned long>::max()                     &&
+                columns <= std::numeric_limits<unsigned long>::max()                  &&
+                spacing >= rows                                                       &&
+                (columns == 0 || spacing <= ~0ULL / sizeof(Scalar) / columns)            ) {
+                numberRows    = static_cast<unsigned long>(rows);
+                numberColumns = static_cast<unsigned long>(columns);
+                columnSpacing = spacing;
+                success       = true;
+            }
+        }
+
+        return success;
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::DenseData::fromVersion2BinaryFile(const char* filename) {
+        DenseData*         result        = nullptr;
+        unsigned long      numberRows    = 0;
+        unsigned long      numberColumns = 0;
+        unsigned long long columnSpacing = 0;
+        unsigned long long regionSize    = 0;
+        void*              region        = mapFile(filename, regionSize);
+
+        if (region != nullptr) {
+            const std::uint8_t* header = reinterpret_cast<const std::uint8_t*>(region);
+
+            if (regionSize >= binaryHeaderSizeInBytes                                      &&
+                parseBinaryHeader(header, numberRows, numberColumns, columnSpacing)        &&
+                  (regionSize - binaryHeaderSizeInBytes) / sizeof(Scalar)
+                >= columnSpacing * numberColumns                                              ) {
+                unsigned long long expectedSpacing = columnSizeInBytes(numberRows, sizeof(Scalar)) / sizeof(Scalar);
+
+                if (columnSpacing == expectedSpacing) {
+                    result = MatrixDensePrivate<Scalar>::createMapped<DenseData>(
+                        numberRows,
+                        numberColumns,
+                        region,
+                        regionSize,
+                        binaryHeaderSizeInBytes
+                    );
+
+                    region = nullptr;
+                } else {
+                    const Scalar* source = reinterpret_cast<const Scalar*>(header + binaryHeaderSizeInBytes);
+
+                    result = create(numberRows, numberColumns);
+                    for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+                        std::memcpy(
+                            result->addressOf(0, columnIndex),
+                            source + columnSpacing * columnIndex,
+                            numberRows * sizeof(Scalar)
+                        );
+                    }
+                }
+            } else {
+                internalTriggerFileReadError(filename, 1);
+            }
+
+            if (region != nullptr) {
+                unmapFile(region, regionSize);
+            }
+        } else {
+            // The file could not be mapped so we fall back to reading the file one column at a time.
+
+            std::ifstream f(filename, std::ios::binary);
+            std::uint8_t  header[binaryHeaderSizeInBytes];
+
+            f.read(reinterpret_cast<char*>(header), binaryHeaderSizeInBytes);
+            if (!f) {
+                internalTriggerFileReadError(filename);
+            } else if (!parseBinaryHeader(header, numberRows, numberColumns, columnSpacing)) {
+                internalTriggerFileReadError(filename, 1);
+            } else {
+                std::streamsize columnDataSizeInBytes = static_cast<std::streamsize>(numberRows * sizeof(Scalar));
+                std::streamoff  paddingInBytes        = static_cast<std::streamoff>(
+                    (columnSpacing - numberRows) * sizeof(Scalar)
+                );
+
+                result = create(numberRows, numberColumns);
+
+                unsigned long columnIndex = 0;
+                while (f && columnIndex < numberColumns) {
+                    f.read(reinterpret_cast<char*>(result->addressOf(0, columnIndex)), columnDataSizeInBytes);
+                    if (f && paddingInBytes != 0) {
+                        f.seekg(paddingInBytes, std::ios::cur);
+                    }
+
+                    ++columnIndex;
+                }
+
+                if (!f) {
+                    destroy(result);
+                    result = nullptr;
+
+                    internalTriggerFileReadError(filename);
+                }
+            }
+        }
+
+        return result;
+    }
+
+
+    /**
+     * The minimum amount of CSV text, in bytes, handed to each thread when reading or writing a CSV file.
+     */
+    static constexpr unsigned long long minimumCsvBlockSizeInBytes = 4 * 1024 * 1024;
+
+    /**
+     * Function that determines how many blocks a CSV file should be split into so each block can be processed by a
+     * separate thread.
+     *
+     * \param[in] sizeInBytes The approximate size of the CSV text, in bytes.
+     *
+     * \return Returns the number of blocks.  The value will always be at least 1.
+     */
+    static unsigned numberCsvBlocks(unsigned long long sizeInBytes) {
+        unsigned long long numberBlocks  = sizeInBytes / minimumCsvBlockSizeInBytes;
+        unsigned           numberThreads = std::thread::hardware_concurrency();
+
+        if (numberBlocks > numberThreads) {
+            numberBlocks = numberThreads;
+        }
+
+        return numberBlocks > 1 ? static_cast<unsigned>(numberBlocks) : 1;
+    }
+
+    /**
+     * Function that processes a collection of CSV blocks, one thread per block.  The last block is processed on the
+     * calling thread.
+     *
+     * \param[in] numberBlocks The number of blocks to be processed.
+     *
+     * \param[in] function     The function used to process each block.  The function receives the zero based block
+     *                         index and returns true on success.
+     *
+     * \return Returns true if every block was processed successfully.  Returns false on error.
+     */
+    template<typename F> static bool processCsvBlocks(unsigned numberBlocks, F function) {
+        std::vector<std::future<bool>> threads;
+        threads.reserve(numberBlocks - 1);
+
+        for (unsigned blockIndex=0 ; blockIndex<numberBlocks - 1 ; ++blockIndex) {
+            threads.push_back(std::async(std::launch::async, function, blockIndex));
+        }
+
+        bool success = function(numberBlocks - 1);
+        for (std::future<bool>& thread : threads) {
+            success = thread.get() && success;
+        }
+
+        return success;
+    }
+
+
+    unsigned long MatrixReal::DenseData::countCsvValues(const char* begin, const char* end) {
+        unsigned long numberSeparators = 0;
+        for (const char* p=begin ; p<end ; ++p) {
+            if (isCsvSeparator(*p)) {
+                ++numberSeparators;
+            }
+        }
+
+        // A trailing separator does not introduce an additional value.
+        return begin < end && !isCsvSeparator(end[-1]) ? numberSeparators + 1 : numberSeparators;
+    }
+
+
+    void MatrixReal::DenseData::scanCsvBlock(
+            const char*    begin,
+            const char*    end,
+            unsigned long& numberRows,
+            unsigned long& numberColumns
+        ) {
+        numberRows    = 0;
+        numberColumns = 0;
+
+        const char* lineBegin = begin;
+        while (lineBegin < end) {
+            const char* newline = static_cast<const char*>(std::memchr(lineBegin, '\n', end - lineBegin));
+            const char* lineEnd = newline != nullptr ? newline : end;
+            const char* next    = newline != nullptr ? newline + 1 : end;
+
+            if (lineEnd > lineBegin && lineEnd[-1] == '\r') {
+                --lineEnd;
+            }
+
+            numberColumns = std::max(numberColumns, countCsvValues(lineBegin, lineEnd));
+            ++numberRows;
+
+            lineBegin = next;
+        }
+    }
+
+
+    bool MatrixReal::DenseData::parseCsvBlock(
+            const char*   begin,
+            const char*   end,
+            unsigned long firstRowIndex,
+            DenseData*    matrix
+        ) {
+        bool               success       = true;
+        Scalar*            rowData       = matrix->data() + firstRowIndex;
+        unsigned long long columnSpacing = matrix->columnSpacingInMemory();
+        const char*        lineBegin     = begin;
+
+        while (success && lineBegin < end) {
+            const char* newline = static_cast<const char*>(std::memchr(lineBegin, '\n', end - lineBegin));
+            const char* lineEnd = newline != nullptr ? newline : end;
+            const char* next    = newline != nullptr ? newline + 1 : end;
+
+            if (lineEnd > lineBegin && lineEnd[-1] == '\r') {
+                --lineEnd;
+            }
+
+            Scalar*     destination = rowData;
+            const char* valueBegin  = lineBegin;
+            while (success && valueBegin < lineEnd) {
+                const char* valueEnd = valueBegin;
+                while (valueEnd < lineEnd && !isCsvSeparator(*valueEnd)) {
+                    ++valueEnd;
+                }
+
+                std::size_t length = static_cast<std::size_t>(valueEnd - valueBegin);
+                if (length == 0) {
+                    success = false;
+                } else {
+                    // The text is not null terminated so each value is copied into a small buffer before parsing.
+                    // Very long values, which should be rare, use a heap allocated string.
+
+                    char        buffer[64];
+                    std::string longValue;
+                    const char* value;
+
+                    if (length < sizeof(buffer)) {
+                        std::memcpy(buffer, valueBegin, length);
+                        buffer[length] = '\0';
+                        value          = buffer;
+                    } else {
+                        longValue.assign(valueBegin, length);
+                        value = longValue.c_str();
+                    }
+
+                    char* parseEnd;
+                    *destination = std::strtod(value, &parseEnd);
+
+                    success      = (parseEnd == value + length);
+                    destination += columnSpacing;
+                }
+
+                valueBegin = valueEnd < lineEnd ? valueEnd + 1 : lineEnd;
+            }
+
+            ++rowData;
+            lineBegin = next;
+        }
+
+        return success;
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::DenseData::fromCsvFile(const char* filename) {
+        DenseData*         result     = nullptr;
+        bool               success    = true;
+        unsigned long long regionSize = 0;
+        void*              region     = mapFile(filename, regionSize);
+        std::string        contents;
+        const char*        begin;
+        const char*        end;
+
+        if (region != nullptr) {
+            begin = static_cast<const char*>(region);
+            end   = begin + regionSize;
+        } else {
+            // The file could not be mapped, possibly because it is empty, so we read it into memory instead.
+
+            std::ifstream f(filename, std::ios::binary);
+            if (!f) {
+                internalTriggerFileOpenError(filename);
+                success = false;
+            } else {
+                contents.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+                if (f.bad()) {
+                    internalTriggerFileReadError(filename);
+                    success = false;
+                }
+            }
+
+            begin = contents.data();
+            end   = begin + contents.size();
+        }
+
+        if (success) {
+            // Split the text into blocks that start at the beginning of a line and end just after a newline.
+
+            unsigned long long       sizeInBytes     = static_cast<unsigned long long>(end - begin);
+            unsigned                 requestedBlocks = numberCsvBlocks(sizeInBytes);
+            std::vector<const char*> boundaries(1, begin);
+
+            for (unsigned blockIndex=1 ; blockIndex<requestedBlocks ; ++blockIndex) {
+                const char* p       = std::max(begin + sizeInBytes * blockIndex / requestedBlocks, boundaries.back());
+                const char* newline = static_cast<const char*>(std::memchr(p, '\n', end - p));
+
+                if (newline != nullptr && newline + 1 < end) {
+                    boundaries.push_back(newline + 1);
+                }
+            }
+
+            boundaries.push_back(end);
+
+            unsigned                   numberBlocks = static_cast<unsigned>(boundaries.size() - 1);
+            std::vector<unsigned long> blockRows(numberBlocks);
+            std::vector<unsigned long> blockColumns(numberBlocks);
+
+            processCsvBlocks(
+                numberBlocks,
+                [&](unsigned blockIndex) {
+                    scanCsvBlock(
+                        boundaries[blockIndex],
+                        boundaries[blockIndex + 1],
+                        blockRows[blockIndex],
+                        blockColumns[blockIndex]
+                    );
+
+                    return true;
+                }
+            );
+
+            std::vector<unsigned long> blockFirstRows(numberBlocks);
+            unsigned long              numberRows    = 0;
+            unsigned long              numberColumns = 0;
+
+            for (unsigned blockIndex=0 ; blockIndex<numberBlocks ; ++blockIndex) {
+                blockFirstRows[blockIndex]  = numberRows;
+                numberRows                 += blockRows[blockIndex];
+                numberColumns               = std::max(numberColumns, blockColumns[blockIndex]);
+            }
+
+            result  = create(numberRows, numberColumns);
+            success = processCsvBlocks(
+                numberBlocks,
+                [&](unsigned blockIndex) {
+                    return parseCsvBlock(
+                        boundaries[blockIndex],
+                        boundaries[blockIndex + 1],
+                        blockFirstRows[blockIndex],
+                        result
+                    );
+                }
+            );
+
+            if (!success) {
+                destroy(result);
+                result = nullptr;
+
+                internalTriggerFileReadError(filename);
+            }
+        }
+
+        if (region != nullptr) {
+            unmapFile(region, regionSize);
+        }
+
+        return result;
+    }
+
+
+    std::string MatrixReal::DenseData::formatCsvRows(unsigned long firstRowIndex, unsigned long lastRowIndex) const {
+        unsigned long      currentNumberColumns = numberColumns();
+        const Scalar*      d                    = data();
+        unsigned long long columnSpacing        = columnSpacingInMemory();
+        std::ostringstream stream;
+
+        stream.imbue(std::locale::classic());
+        stream << std::setprecision(17);
+
+        for (unsigned long rowIndex=firstRowIndex ; rowIndex<lastRowIndex ; ++rowIndex) {
+            const Scalar* s = d + rowIndex;
+            for (unsigned long columnIndex=0 ; columnIndex<currentNumberColumns ; ++columnIndex) {
+                if (columnIndex > 0) {
+                    stream << '\t';
+                }
+
+                stream << *s;
+                s += columnSpacing;
+            }
+
+            stream << '\n';
+        }
+
+        return stream.str();
+    }
+
+
+    bool MatrixReal::DenseData::toCsvFile(const char* filename) const {
+        bool          success              = true;
+        unsigned long currentNumberRows    = numberRows();
+        unsigned long currentNumberColumns = numberColumns();
+        std::ofstream f(filename, std::ios::binary);
+
+        if (!f) {
+            internalTriggerFileOpenError(filename);
+            success = false;
+        } else {
+            // Each pass formats one block of rows per thread and then writes the blocks in order.  Blocks are sized
+            // assuming roughly 24 bytes per value.
+
+            unsigned long long bytesPerRow  = 24ULL * std::max(currentNumberColumns, 1UL) + 1;
+            unsigned           numberBlocks = numberCsvBlocks(bytesPerRow * currentNumberRows);
+            unsigned long      rowsPerBlock = static_cast<unsigned long>(
+                std::max(minimumCsvBlockSizeInBytes / bytesPerRow, 1ULL)
+            );
+
+            std::vector<std::string> blocks(numberBlocks);
+            unsigned long            passFirstRowIndex = 0;
+
+            while (success && passFirstRowIndex < currentNumberRows) {
+                processCsvBlocks(
+                    numberBlocks,
+                    [&](unsigned blockIndex) {
+                        unsigned long firstRowIndex = std::min(
+                            passFirstRowIndex + blockIndex * rowsPerBlock,
+                            currentNumberRows
+                        );
+                        unsigned long lastRowIndex  = std::min(firstRowIndex + rowsPerBlock, currentNumberRows);
+
+                        blocks[blockIndex] = formatCsvRows(firstRowIndex, lastRowIndex);
+                        return true;
+                    }
+                );
+
+                for (unsigned blockIndex=0 ; success && blockIndex<numberBlocks ; ++blockIndex) {
+                    const std::string& block = blocks[blockIndex];
+                    f.write(block.data(), static_cast<std::streamsize>(block.size()));
+
+                    if (!f) {
+                        internalTriggerFileWriteError(filename);
+                        success = false;
+                    }
+                }
+
+                passFirstRowIndex = std::min(passFirstRowIndex + numberBlocks * rowsPerBlock, currentNumberRows);
+            }
+
+            if (success) {
+                f.close();
+                if (!f) {
+                    internalTriggerFileWriteError(filename);
+                    success = false;
+                }
+            }
+        }
+
+        return success;
+    }
+
+
     MatrixReal::Data* MatrixReal::DenseData::combineLeftToRight(
             const MatrixDensePrivate<MatrixReal::DenseData::Scalar>& other
         ) const {
@@ -678,8 +1075,11 @@ namespace M {
     MatrixReal::Data* MatrixReal::DenseData::combineLeftToRight(
             const MatrixSparsePrivate<MatrixReal::DenseData::Scalar>& other
         ) const {
-        (void) other; // FIXME
-        return nullptr; // FIXME
+        DenseData* denseOther = static_cast<const SparseData&>(other).toDense();
+        Data*      result     = combineLeftToRight(*denseOther);
+        destroy(denseOther);
+
+        return result;
     }
 
 
@@ -765,8 +1165,11 @@ namespace M {
     MatrixReal::Data* MatrixReal::DenseData::combineTopToBottom(
             const MatrixSparsePrivate<MatrixReal::DenseData::Scalar>& other
         ) const {
-        (void) other; // FIXME
-        return nullptr; // FIXME
+        DenseData* denseOther = static_cast<const SparseData&>(other).toDense();
+        Data*      result     = combineTopToBottom(*denseOther);
+        destroy(denseOther);
+
+        return result;
     }
 
 
@@ -967,84 +1370,247 @@ namespace M {
         unsigned long numberRows    = DenseData::numberRows();
         unsigned long numberColumns = DenseData::numberColumns();
 
-        MatrixInteger::DenseData* result = MatrixInteger::DenseData::createUninitialized(numberRows, numberColumns);
+        MatrixInteger::DenseData* result = MatrixInteger::DenseData::createUninitialized(numberRows, numberColumns);
+
+        unsigned long long sourceColumnSizeInEntries      = columnSpacingInMemory();
+        unsigned long long destinationColumnSizeInEntries = result->columnSpacingInMemory();
+
+        unsigned residueInEntries = static_cast<unsigned>(destinationColumnSizeInEntries - numberRows);
+
+        Scalar*                buffer = new Scalar[numberRows];
+        const double*          s      = data();
+        MatrixInteger::Scalar* d      = result->data();
+
+        for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+            matrixApi()->doubleFloor(numberRows, s, buffer);
+            toInteger(numberRows, residueInEntries, buffer, d);
+
+            s += sourceColumnSizeInEntries;
+            d += destinationColumnSizeInEntries;
+        }
+
+        delete[] buffer;
+
+        return result;
+    }
+
+
+    MatrixInteger::Data* MatrixReal::DenseData::ceilToInteger() const {
+        unsigned long numberRows    = DenseData::numberRows();
+        unsigned long numberColumns = DenseData::numberColumns();
+
+        MatrixInteger::DenseData* result = MatrixInteger::DenseData::createUninitialized(numberRows, numberColumns);
+
+        unsigned long long sourceColumnSizeInEntries      = columnSpacingInMemory();
+        unsigned long long destinationColumnSizeInEntries = result->columnSpacingInMemory();
+
+        unsigned residueInEntries = static_cast<unsigned>(destinationColumnSizeInEntries - numberRows);
+
+        Scalar*                buffer = new Scalar[numberRows];
+        const double*          s      = data();
+        MatrixInteger::Scalar* d      = result->data();
+
+        for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+            matrixApi()->doubleCeiling(numberRows, s, buffer);
+            toInteger(numberRows, residueInEntries, buffer, d);
+
+            s += sourceColumnSizeInEntries;
+            d += destinationColumnSizeInEntries;
+        }
+
+        delete[] buffer;
+
+        return result;
+    }
+
+
+    MatrixInteger::Data* MatrixReal::DenseData::nintToInteger() const {
+        unsigned long numberRows    = DenseData::numberRows();
+        unsigned long numberColumns = DenseData::numberColumns();
+
+        MatrixInteger::DenseData* result = MatrixInteger::DenseData::createUninitialized(numberRows, numberColumns);
+
+        unsigned long long sourceColumnSizeInEntries      = columnSpacingInMemory();
+        unsigned long long destinationColumnSizeInEntries = result->columnSpacingInMemory();
+
+        unsigned residueInEntries = static_cast<unsigned>(destinationColumnSizeInEntries - numberRows);
+
+        Scalar*                buffer = new Scalar[numberRows];
+        const double*          s      = data();
+        MatrixInteger::Scalar* d      = result->data();
+
+        for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+            matrixApi()->doubleNearestInteger(numberRows, s, buffer);
+            toInteger(numberRows, residueInEntries, buffer, d);
+
+            s += sourceColumnSizeInEntries;
+            d += destinationColumnSizeInEntries;
+        }
+
+        delete[] buffer;
+
+        return result;
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::DenseData::exp() const {
+        return mapColumns(
+            [](unsigned long numberRows, const Scalar* source, Scalar* destination) {
+                matrixApi()->doubleExponential(numberRows, source, destination);
+            }
+        );
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::DenseData::tangent() const {
+        return mapColumns(
+            [](unsigned long numberRows, const Scalar* source, Scalar* destination) {
+                matrixApi()->doubleTangent(numberRows, source, destination);
+            }
+        );
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::DenseData::sine() const {
+        return mapElements([](Scalar value) { return M::sine(value); });
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::DenseData::cosine() const {
+        return mapElements([](Scalar value) { return M::cosine(value); });
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::DenseData::arcsine() const {
+        return mapElements([](Scalar value) { return M::arcsine(value); });
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::DenseData::arccosine() const {
+        return mapElements([](Scalar value) { return M::arccosine(value); });
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::DenseData::arctangent() const {
+        return mapElements([](Scalar value) { return M::arctangent(value); });
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::DenseData::hyperbolicSine() const {
+        return mapElements([](Scalar value) { return M::hyperbolicSine(value); });
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::DenseData::hyperbolicCosine() const {
+        return mapElements([](Scalar value) { return M::hyperbolicCosine(value); });
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::DenseData::hyperbolicTangent() const {
+        return mapElements([](Scalar value) { return M::hyperbolicTangent(value); });
+    }
+
 
-        unsigned long long sourceColumnSizeInEntries      = columnSpacingInMemory();
-        unsigned long long destinationColumnSizeInEntries = result->columnSpacingInMemory();
+    MatrixReal::DenseData* MatrixReal::DenseData::erf() const {
+        return mapElements([](Scalar value) { return M::erf(value); });
+    }
 
-        unsigned residueInEntries = static_cast<unsigned>(destinationColumnSizeInEntries - numberRows);
 
-        Scalar*                buffer = new Scalar[numberRows];
-        const double*          s      = data();
-        MatrixInteger::Scalar* d      = result->data();
+    MatrixReal::DenseData* MatrixReal::DenseData::erfc() const {
+        return mapElements([](Scalar value) { return M::erfc(value); });
+    }
 
-        for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
-            matrixApi()->doubleFloor(numberRows, s, buffer);
-            toInteger(numberRows, residueInEntries, buffer, d);
 
-            s += sourceColumnSizeInEntries;
-            d += destinationColumnSizeInEntries;
-        }
+    MatrixReal::DenseData* MatrixReal::DenseData::gamma() const {
+        return mapElements([](Scalar value) { return M::gamma(value); });
+    }
 
-        delete[] buffer;
 
-        return result;
+    MatrixReal::DenseData* MatrixReal::DenseData::lnGamma() const {
+        return mapElements([](Scalar value) { return M::lnGamma(value); });
     }
 
 
-    MatrixInteger::Data* MatrixReal::DenseData::ceilToInteger() const {
+    MatrixComplex::DenseData* MatrixReal::DenseData::ln() const {
         unsigned long numberRows    = DenseData::numberRows();
         unsigned long numberColumns = DenseData::numberColumns();
 
-        MatrixInteger::DenseData* result = MatrixInteger::DenseData::createUninitialized(numberRows, numberColumns);
-
-        unsigned long long sourceColumnSizeInEntries      = columnSpacingInMemory();
-        unsigned long long destinationColumnSizeInEntries = result->columnSpacingInMemory();
-
-        unsigned residueInEntries = static_cast<unsigned>(destinationColumnSizeInEntries - numberRows);
+        MatrixComplex::DenseData* result = MatrixComplex::DenseData::createUninitialized(numberRows, numberColumns);
+        std::vector<Scalar>       buffer(numberRows);
 
-        Scalar*                buffer = new Scalar[numberRows];
-        const double*          s      = data();
-        MatrixInteger::Scalar* d      = result->data();
+        // The log of the magnitude is calculated a column at a time.  Negative values, including negative zero, pick
+        // up an imaginary part of pi to match the principal branch used by the scalar version.
 
-        for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
-            matrixApi()->doubleCeiling(numberRows, s, buffer);
-            toInteger(numberRows, residueInEntries, buffer, d);
+        applyColumnKernel(
+            result->data(),
+            result->columnSpacingInMemory(),
+            [&buffer](unsigned long numberRows, const Scalar* source, Complex* destination) {
+                for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                    buffer[rowIndex] = std::abs(source[rowIndex]);
+                }
 
-            s += sourceColumnSizeInEntries;
-            d += destinationColumnSizeInEntries;
-        }
+                matrixApi()->doubleLog(numberRows, buffer.data(), buffer.data());
 
-        delete[] buffer;
+                for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                    Scalar value = source[rowIndex];
+                    if (std::isnan(value)) {
+                        destination[rowIndex] = Complex(NaN, NaN);
+                    } else {
+                        destination[rowIndex] = Complex(buffer[rowIndex], std::signbit(value) ? pi : Scalar(0));
+                    }
+                }
+            }
+        );
 
         return result;
     }
 
 
-    MatrixInteger::Data* MatrixReal::DenseData::nintToInteger() const {
+    MatrixComplex::DenseData* MatrixReal::DenseData::sqrt() const {
         unsigned long numberRows    = DenseData::numberRows();
         unsigned long numberColumns = DenseData::numberColumns();
 
-        MatrixInteger::DenseData* result = MatrixInteger::DenseData::createUninitialized(numberRows, numberColumns);
+        MatrixComplex::DenseData* result = MatrixComplex::DenseData::createUninitialized(numberRows, numberColumns);
+        std::vector<Scalar>       buffer(numberRows);
 
-        unsigned long long sourceColumnSizeInEntries      = columnSpacingInMemory();
-        unsigned long long destinationColumnSizeInEntries = result->columnSpacingInMemory();
+        applyColumnKernel(
+            result->data(),
+            result->columnSpacingInMemory(),
+            [&buffer](unsigned long numberRows, const Scalar* source, Complex* destination) {
+                for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                    buffer[rowIndex] = std::abs(source[rowIndex]);
+                }
 
-        unsigned residueInEntries = static_cast<unsigned>(destinationColumnSizeInEntries - numberRows);
+                matrixApi()->doubleSquareRoot(numberRows, buffer.data(), buffer.data());
 
-        Scalar*                buffer = new Scalar[numberRows];
-        const double*          s      = data();
-        MatrixInteger::Scalar* d      = result->data();
+                for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                    if (source[rowIndex] < 0) {
+                        destination[rowIndex] = Complex(0, buffer[rowIndex]);
+                    } else {
+                        destination[rowIndex] = Complex(buffer[rowIndex], 0);
+                    }
+                }
+            }
+        );
 
-        for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
-            matrixApi()->doubleNearestInteger(numberRows, s, buffer);
-            toInteger(numberRows, residueInEntries, buffer, d);
+        return result;
+    }
 
-            s += sourceColumnSizeInEntries;
-            d += destinationColumnSizeInEntries;
-        }
 
-        delete[] buffer;
+    MatrixComplex::DenseData* MatrixReal::DenseData::pow(MatrixReal::Scalar exponent) const {
+        unsigned long numberRows    = DenseData::numberRows();
+        unsigned long numberColumns = DenseData::numberColumns();
+
+        MatrixComplex::DenseData* result = MatrixComplex::DenseData::createUninitialized(numberRows, numberColumns);
+        applyColumnKernel(
+            result->data(),
+            result->columnSpacingInMemory(),
+            [exponent](unsigned long numberRows, const Scalar* source, Complex* destination) {
+                for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                    destination[rowIndex] = M::pow(source[rowIndex], exponent);
+                }
+            }
+        );
 
         return result;
     }
@@ -1058,6 +1624,8 @@ namespace M {
 
         if (numberRows != numberColumns || numberRows == 0) {
             throw Model::InvalidMatrixDimensions(numberRows, numberColumns);
+        } else if (MatrixSmallPrivate<Scalar>::isSmall(numberRows, numberColumns)) {
+            result = MatrixSmallPrivate<Scalar>::determinant(data(), columnSpacingInMemory(), numberRows);
         } else {
             DenseData*    luMatrix       = static_cast<DenseData*>(clone());
             unsigned long pivotArraySize = std::max(1UL, std::min(numberRows, numberColumns));
@@ -1114,6 +1682,22 @@ namespace M {
 
         if (numberColumns == 0 || numberRows == 0 || numberRows != numberColumns) {
             throw Model::InvalidMatrixDimensions(numberRows, numberColumns);
+        } else if (MatrixSmallPrivate<Scalar>::isSmall(numberRows, numberColumns)) {
+            DenseData* di      = create(numberRows, numberColumns);
+            bool       success = MatrixSmallPrivate<Scalar>::inverse(
+                data(),
+                columnSpacingInMemory(),
+                numberRows,
+                di->data(),
+                di->columnSpacingInMemory()
+            );
+
+            if (!success) {
+                destroy(di);
+                throw Model::MatrixIsSingular();
+            } else {
+                result = di;
+            }
         } else {
             DenseData*         di                    = static_cast<DenseData*>(clone());
             MatInteger*        pivotOperationsByRow  = new MatInteger[numberRows];
@@ -1538,7 +2122,7 @@ namespace M {
                 for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
                     const Scalar* v = reinterpret_cast<const Scalar*>(addressOf(0, columnIndex));
                     for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
-                        sum += pow(M::abs(*v), p);
+                        sum += M::pow(M::abs(*v), p);
                         ++v;
                     }
                 }
@@ -1673,6 +2257,25 @@ namespace M {
             throw Model::InvalidMatrixDimensions(yNumberRows, yNumberColumns);
         } else if (aNumberRows != yNumberRows) {
             throw Model::IncompatibleMatrixDimensions(aNumberRows, aNumberColumns, yNumberRows, yNumberColumns);
+        } else if (MatrixSmallPrivate<Scalar>::isSmall(aNumberRows, aNumberColumns)) {
+            DenseData* x       = create(aNumberRows, yNumberColumns);
+            bool       success = MatrixSmallPrivate<Scalar>::solve(
+                data(),
+                columnSpacingInMemory(),
+                aNumberRows,
+                y->data(),
+                y->columnSpacingInMemory(),
+                yNumberColumns,
+                x->data(),
+                x->columnSpacingInMemory()
+            );
+
+            if (success) {
+                result = x;
+            } else {
+                DenseData::destroy(x);
+                result = create(0, 0);
+            }
         } else {
             double* rowScaleFactors    = new double[aNumberRows];
             double* columnScaleFactors = new double[aNumberColumns];
@@ -1752,8 +2355,18 @@ namespace M {
 
 
     MatrixReal::Data* MatrixReal::DenseData::solve(const MatrixReal::SparseData* y) const {
-        (void) y; // FIXME
-        return nullptr; // FIXME
+        DenseData* denseY = y->toDense();
+        Data*      result;
+
+        try {
+            result = solve(denseY);
+        } catch (...) {
+            destroy(denseY);
+            throw;
+        }
+
+        destroy(denseY);
+        return result;
     }
 
 
@@ -1815,8 +2428,18 @@ namespace M {
 
 
     MatrixReal::Data* MatrixReal::DenseData::leastSquares(const MatrixReal::SparseData* b) const {
-        (void) b; // FIXME
-        return nullptr; // FIXME
+        DenseData* denseB = b->toDense();
+        Data*      result;
+
+        try {
+            result = leastSquares(denseB);
+        } catch (...) {
+            destroy(denseB);
+            throw;
+        }
+
+        destroy(denseB);
+        return result;
     }
 
 
@@ -1870,8 +2493,9 @@ namespace M {
     MatrixReal::Data* MatrixReal::DenseData::hadamard(
             const MatrixSparsePrivate<MatrixReal::DenseData::Scalar>& other
         ) const {
-        (void) other; // FIXME
-        return nullptr; // FIXME
+        // The Hadamard product is commutative and the result can have no more non-zero entries than the sparse
+        // operand so we let the sparse implementation do the work.
+        return static_cast<const SparseData&>(other).hadamard(*this);
     }
 
 
@@ -1948,10 +2572,11 @@ namespace M {
             bool                                                      otherTranspose,
             MatrixReal::DenseData::Scalar                             scalarMultiplier
         ) const {
-        (void) other; // FIXME
-        (void) otherTranspose; // FIXME
-        (void) scalarMultiplier; // FIXME
-        return nullptr; // FIXME
+        SparseData* sparseThis = SparseData::create(*this);
+        Data*       result     = sparseThis->kronecker(other, otherTranspose, scalarMultiplier);
+        SparseData::destroy(sparseThis);
+
+        return result;
     }
 
 
@@ -2132,24 +2757,26 @@ namespace M {
         unsigned long long residueEntriesToClear    = columnSpacing - numberRows;
         unsigned long long matrixSizeInCoefficients = columnSpacing * numberColumns - residueEntriesToClear;
 
+        // The value (-ln(u))^(1/shape) is computed as exp(ln(-ln(u)) / shape) so every step uses the vector kernels.
+
         if (residueEntriesToClear == 0) {
             matrixApi()->doubleLog(matrixSizeInCoefficients, data, data);
+            matrixApi()->doubleVectorScalarMultiplyAdd(matrixSizeInCoefficients, data, -1.0, 0, data);
+            matrixApi()->doubleLog(matrixSizeInCoefficients, data, data);
+            matrixApi()->doubleVectorScalarMultiplyAdd(matrixSizeInCoefficients, data, 1.0 / shape, 0, data);
+            matrixApi()->doubleExponential(matrixSizeInCoefficients, data, data);
         } else {
             Scalar* columnBase = data;
             for (unsigned long long ci=0 ; ci<static_cast<unsigned long long>(numberColumns) ; ++ci) {
                 matrixApi()->doubleLog(numberRows, columnBase, columnBase);
+                matrixApi()->doubleVectorScalarMultiplyAdd(numberRows, columnBase, -1.0, 0, columnBase);
+                matrixApi()->doubleLog(numberRows, columnBase, columnBase);
+                matrixApi()->doubleVectorScalarMultiplyAdd(numberRows, columnBase, 1.0 / shape, 0, columnBase);
+                matrixApi()->doubleExponential(numberRows, columnBase, columnBase);
                 columnBase += columnSpacing;
             }
         }
 
-        Scalar* p            = data;
-        Scalar* end          = data + matrixSizeInCoefficients;
-        Scalar  oneOverShape = 1.0 / shape;
-        while (p != end) {
-            *p = std::pow(-(*p), oneOverShape);
-            ++p;
-        }
-
         if (delay == 0 || residueEntriesToClear == 0) {
             matrixApi()->doubleVectorScalarMultiplyAdd(
                 matrixSizeInCoefficients,
@@ -2220,24 +2847,18 @@ namespace M {
         if (residueEntriesToClear > 0) {
             Scalar* p = data;
             for (unsigned long long ci=0 ; ci<static_cast<unsigned long long>(numberColumns) ; ++ci) {
-                Scalar* columnEnd = p + numberRows;
-                while (p != columnEnd) {
-                    *p = pt.randomGamma(k, s);
-                    ++p;
-                }
+                randomGammaEngine(pt, k, numberRows, p);
+                p += numberRows;
 
                 std::memset(p, 0, residueEntriesToClear * sizeof(Scalar));
                 p += residueEntriesToClear;
             }
         } else {
-            Scalar* p   = data;
-            Scalar* end = data + matrixSizeInCoefficients;
-            while (p != end) {
-                *p = pt.randomGamma(k, s);
-                ++p;
-            }
+            randomGammaEngine(pt, k, matrixSizeInCoefficients, data);
         }
 
+        matrixApi()->doubleVectorScalarMultiplyAdd(matrixSizeInCoefficients, data, s, 0, data);
+
         return result;
     }
 
@@ -2432,21 +3053,38 @@ namespace M {
             Scalar*            destinationData          = result->data();
             unsigned long long destinationColumnSpacing = result->columnSpacingInMemory();
 
-            matrixApi()->doubleScaleAdd(
-                MatMatrixMode::COLUMN_MAJOR,
-                augendTransformType,
-                addendTransformType,
-                augendTransformNumberRows,
-                augendTransformNumberColumns,
-                augendScalar,
-                augendData,
-                augendColumnSpacing,
-                addendScalar,
-                addendData,
-                addendColumnSpacing,
-                destinationData,
-                destinationColumnSpacing
-            );
+            if (MatrixSmallPrivate<Scalar>::isSmall(augendTransformNumberRows, augendTransformNumberColumns)) {
+                MatrixSmallPrivate<Scalar>::scaleAdd(
+                    augendTransformNumberRows,
+                    augendTransformNumberColumns,
+                    augendScalar,
+                    augendData,
+                    augendColumnSpacing,
+                    augendTranspose,
+                    addendScalar,
+                    addendData,
+                    addendColumnSpacing,
+                    addendTranspose,
+                    destinationData,
+                    destinationColumnSpacing
+                );
+            } else {
+                matrixApi()->doubleScaleAdd(
+                    MatMatrixMode::COLUMN_MAJOR,
+                    augendTransformType,
+                    addendTransformType,
+                    augendTransformNumberRows,
+                    augendTransformNumberColumns,
+                    augendScalar,
+                    augendData,
+                    augendColumnSpacing,
+                    addendScalar,
+                    addendData,
+                    addendColumnSpacing,
+                    destinationData,
+                    destinationColumnSpacing
+                );
+            }
 
             unsigned long long residueRows = destinationColumnSpacing - augendTransformNumberRows;
             if (residueRows > 0) {
@@ -2469,12 +3107,19 @@ namespace M {
             MatrixReal::DenseData::Scalar                             augendScalar,
             MatrixReal::DenseData::Scalar                             addendScalar
         ) const {
-        (void) addend; // FIXME
-        (void) augendtTranspose; // FIXME
-        (void) addendTranspose; // FIXME
-        (void) augendScalar; // FIXME
-        (void) addendScalar; // FIXME
-        return nullptr; // FIXME
+        unsigned long augendRows    = augendtTranspose ? numberColumns() : numberRows();
+        unsigned long augendColumns = augendtTranspose ? numberRows() : numberColumns();
+        unsigned long addendRows    = addendTranspose ? addend.numberColumns() : addend.numberRows();
+        unsigned long addendColumns = addendTranspose ? addend.numberRows() : addend.numberColumns();
+
+        if (augendRows != addendRows || augendColumns != addendColumns) {
+            throw Model::IncompatibleMatrixDimensions(augendRows, augendColumns, addendRows, addendColumns);
+        }
+
+        DenseData* result = POLYMORPHIC_CAST<DenseData*>(applyTransformAndScaling(augendtTranspose, augendScalar));
+        addend.accumulateInto(*result, addendTranspose, addendScalar);
+
+        return result;
     }
 
 
@@ -2530,22 +3175,40 @@ namespace M {
                 unsigned long long resultColumnSpacingInMemory       = result->columnSpacingInMemory();
                 Scalar             beta(0);
 
-                matrixApi()->blasDoubleMultiplyAdd(
-                    MatMatrixMode::COLUMN_MAJOR,
-                    multiplierTranspose ? MatOperation::TRANSPOSE : MatOperation::NO_OPERATION,
-                    multiplicandTranspose ? MatOperation::TRANSPOSE : MatOperation::NO_OPERATION,
-                    multiplierOpRows,
-                    multiplicandOpColumns,
-                    multiplierOpColumns,
-                    scalerMultiplier,
-                    multiplierData,
-                    multiplierColumnSpacingInMemory,
-                    multiplicandData,
-                    multiplicandColumnSpacingInMemory,
-                    beta,
-                    resultData,
-                    resultColumnSpacingInMemory
-                );
+                if (MatrixSmallPrivate<Scalar>::isSmall(multiplierOpRows, multiplierOpColumns)     &&
+                    MatrixSmallPrivate<Scalar>::isSmall(multiplicandOpRows, multiplicandOpColumns)    ) {
+                    MatrixSmallPrivate<Scalar>::multiply(
+                        multiplierOpRows,
+                        multiplierOpColumns,
+                        multiplicandOpColumns,
+                        scalerMultiplier,
+                        multiplierData,
+                        multiplierColumnSpacingInMemory,
+                        multiplierTranspose,
+                        multiplicandData,
+                        multiplicandColumnSpacingInMemory,
+                        multiplicandTranspose,
+                        resultData,
+                        resultColumnSpacingInMemory
+                    );
+                } else {
+                    matrixApi()->blasDoubleMultiplyAdd(
+                        MatMatrixMode::COLUMN_MAJOR,
+                        multiplierTranspose ? MatOperation::TRANSPOSE : MatOperation::NO_OPERATION,
+                        multiplicandTranspose ? MatOperation::TRANSPOSE : MatOperation::NO_OPERATION,
+                        multiplierOpRows,
+                        multiplicandOpColumns,
+                        multiplierOpColumns,
+                        scalerMultiplier,
+                        multiplierData,
+                        multiplierColumnSpacingInMemory,
+                        multiplicandData,
+                        multiplicandColumnSpacingInMemory,
+                        beta,
+                        resultData,
+                        resultColumnSpacingInMemory
+                    );
+                }
             }
         } else {
             result = DenseData::create(0, 0);
@@ -2561,11 +3224,167 @@ namespace M {
             bool                                                      multiplicandTranspose,
             MatrixReal::DenseData::Scalar                             scalerMultiplier
         ) const {
-        (void) multiplicand; // FIXME
-        (void) multiplierTranspose; // FIXME
-        (void) multiplicandTranspose; // FIXME
-        (void) scalerMultiplier; // FIXME
-        return nullptr; // FIXME
+        unsigned long multiplierRows      = multiplierTranspose ? numberColumns() : numberRows();
+        unsigned long multiplierColumns   = multiplierTranspose ? numberRows() : numberColumns();
+        unsigned long multiplicandRows    = (
+              multiplicandTranspose
+            ? multiplicand.numberColumns()
+            : multiplicand.numberRows()
+        );
+        unsigned long multiplicandColumns = (
+              multiplicandTranspose
+            ? multiplicand.numberRows()
+            : multiplicand.numberColumns()
+        );
+
+        if (multiplierColumns != multiplicandRows) {
+            throw Model::IncompatibleMatrixDimensions(
+                multiplierRows,
+                multiplierColumns,
+                multiplicandRows,
+                multiplicandColumns
+            );
+        }
+
+        DenseData* result = DenseData::create(multiplierRows, multiplicandColumns);
+        multiplicand.multiplyDenseByThisInto(
+            *this,
+            multiplierTranspose,
+            multiplicandTranspose,
+            scalerMultiplier,
+            *result
+        );
+
+        return result;
+    }
+
+
+    void MatrixReal::DenseData::scaleAccumulate(
+            const MatrixDensePrivate<MatrixReal::DenseData::Scalar>& addend,
+            bool                                                     addendTranspose,
+            MatrixReal::DenseData::Scalar                            augendScalar,
+            MatrixReal::DenseData::Scalar                            addendScalar
+        ) {
+        unsigned long augendRows    = numberRows();
+        unsigned long augendColumns = numberColumns();
+        unsigned long addendRows    = addendTranspose ? addend.numberColumns() : addend.numberRows();
+        unsigned long addendColumns = addendTranspose ? addend.numberRows() : addend.numberColumns();
+
+        if (augendRows != addendRows || augendColumns != addendColumns) {
+            throw Model::IncompatibleMatrixDimensions(augendRows, augendColumns, addendRows, addendColumns);
+        }
+
+        // The matrix API scale-add kernel does not permit the destination to alias a source so we use a simple
+        // column oriented loop the compiler can vectorize.  The padding rows are never touched so they remain zero.
+
+        Scalar*            destinationData     = data();
+        unsigned long long destinationSpacing  = columnSpacingInMemory();
+        const Scalar*      addendData          = addend.data();
+        unsigned long long addendColumnSpacing = addend.columnSpacingInMemory();
+
+        for (unsigned long columnIndex=0 ; columnIndex<augendColumns ; ++columnIndex) {
+            Scalar* destination = destinationData + destinationSpacing * columnIndex;
+
+            if (addendTranspose) {
+                const Scalar* source = addendData + columnIndex;
+                for (unsigned long rowIndex=0 ; rowIndex<augendRows ; ++rowIndex) {
+                    destination[rowIndex] = (
+                          augendScalar * destination[rowIndex]
+                        + addendScalar * source[addendColumnSpacing * rowIndex]
+                    );
+                }
+            } else {
+                const Scalar* source = addendData + addendColumnSpacing * columnIndex;
+                for (unsigned long rowIndex=0 ; rowIndex<augendRows ; ++rowIndex) {
+                    destination[rowIndex] = augendScalar * destination[rowIndex] + addendScalar * source[rowIndex];
+                }
+            }
+        }
+    }
+
+
+    void MatrixReal::DenseData::scaleAccumulate(
+            const MatrixSparsePrivate<MatrixReal::DenseData::Scalar>& addend,
+            bool                                                      addendTranspose,
+            MatrixReal::DenseData::Scalar                             augendScalar,
+            MatrixReal::DenseData::Scalar                             addendScalar
+        ) {
+        unsigned long augendRows    = numberRows();
+        unsigned long augendColumns = numberColumns();
+        unsigned long addendRows    = addendTranspose ? addend.numberColumns() : addend.numberRows();
+        unsigned long addendColumns = addendTranspose ? addend.numberRows() : addend.numberColumns();
+
+        if (augendRows != addendRows || augendColumns != addendColumns) {
+            throw Model::IncompatibleMatrixDimensions(augendRows, augendColumns, addendRows, addendColumns);
+        }
+
+        if (augendScalar != Scalar(1)) {
+            scaleInPlace(augendScalar);
+        }
+
+        addend.accumulateInto(*this, addendTranspose, addendScalar);
+    }
+
+
+    void MatrixReal::DenseData::multiplyAccumulate(
+            const MatrixDensePrivate<MatrixReal::DenseData::Scalar>& multiplier,
+            const MatrixDensePrivate<MatrixReal::DenseData::Scalar>& multiplicand,
+            bool                                                     multiplierTranspose,
+            bool                                                     multiplicandTranspose,
+            MatrixReal::DenseData::Scalar                            scalerMultiplier,
+            MatrixReal::DenseData::Scalar                            accumulatorScalar
+        ) {
+        unsigned long multiplierRows      = multiplierTranspose ? multiplier.numberColumns() : multiplier.numberRows();
+        unsigned long multiplierColumns   = multiplierTranspose ? multiplier.numberRows() : multiplier.numberColumns();
+        unsigned long multiplicandRows    = (
+              multiplicandTranspose
+            ? multiplicand.numberColumns()
+            : multiplicand.numberRows()
+        );
+        unsigned long multiplicandColumns = (
+              multiplicandTranspose
+            ? multiplicand.numberRows()
+            : multiplicand.numberColumns()
+        );
+
+        if (multiplierColumns != multiplicandRows) {
+            throw Model::IncompatibleMatrixDimensions(
+                multiplierRows,
+                multiplierColumns,
+                multiplicandRows,
+                multiplicandColumns
+            );
+        } else if (multiplierRows != numberRows() || multiplicandColumns != numberColumns()) {
+            throw Model::IncompatibleMatrixDimensions(
+                numberRows(),
+                numberColumns(),
+                multiplierRows,
+                multiplicandColumns
+            );
+        }
+
+        if (multiplierRows != 0 && multiplicandColumns != 0) {
+            if (multiplierColumns != 0) {
+                matrixApi()->blasDoubleMultiplyAdd(
+                    MatMatrixMode::COLUMN_MAJOR,
+                    multiplierTranspose ? MatOperation::TRANSPOSE : MatOperation::NO_OPERATION,
+                    multiplicandTranspose ? MatOperation::TRANSPOSE : MatOperation::NO_OPERATION,
+                    multiplierRows,
+                    multiplicandColumns,
+                    multiplierColumns,
+                    scalerMultiplier,
+                    multiplier.data(),
+                    multiplier.columnSpacingInMemory(),
+                    multiplicand.data(),
+                    multiplicand.columnSpacingInMemory(),
+                    accumulatorScalar,
+                    data(),
+                    columnSpacingInMemory()
+                );
+            } else if (accumulatorScalar != Scalar(1)) {
+                scaleInPlace(accumulatorScalar);
+            }
+        }
     }
 
 
@@ -2604,9 +3423,7 @@ namespace M {
 
 
     bool MatrixReal::DenseData::isEqualTo(const MatrixSparsePrivate<MatrixReal::DenseData::Scalar>& other) const {
-        (void) other; // FIXME
-        assert(false); // FIXME
-        return false;
+        return other.isEqualTo(*this);
     }
 
 
@@ -2637,17 +3454,30 @@ namespace M {
         Scalar*            destinationData          = result->data();
         unsigned long long destinationColumnSpacing = result->columnSpacingInMemory();
 
-        matrixApi()->doubleScaleCopy(
-            MatMatrixMode::COLUMN_MAJOR,
-            transformType,
-            inNumberRows,
-            inNumberColumns,
-            scaleFactor,
-            sourceData,
-            sourceColumnSpacing,
-            destinationData,
-            destinationColumnSpacing
-        );
+        if (MatrixSmallPrivate<Scalar>::isSmall(outNumberRows, outNumberColumns)) {
+            MatrixSmallPrivate<Scalar>::scaleCopy(
+                outNumberRows,
+                outNumberColumns,
+                scaleFactor,
+                sourceData,
+                sourceColumnSpacing,
+                transpose,
+                destinationData,
+                destinationColumnSpacing
+            );
+        } else {
+            matrixApi()->doubleScaleCopy(
+                MatMatrixMode::COLUMN_MAJOR,
+                transformType,
+                inNumberRows,
+                inNumberColumns,
+                scaleFactor,
+                sourceData,
+                sourceColumnSpacing,
+                destinationData,
+                destinationColumnSpacing
+            );
+        }
 
         unsigned long long residueRows = destinationColumnSpacing - outNumberRows;
         if (residueRows > 0) {
@@ -2753,60 +3583,164 @@ namespace M {
     }
 
 
-    MatrixReal::DenseData* MatrixReal::DenseData::randomNormalEngine(PerThread &pt, Integer numberRows, Integer numberColumns) {
-        // This method uses the Marsaglia Polar Method to calculate two terms simultaneously.  We fill the matrix with
-        // random 64-bit integer values and then convert the values to values in a normal distribution.  If we run out
-        // of space, we repeat starting at the first unused location.
-        //
-        // To keep things Residue
-        // locations are also calculated and then used to populate remaining entries.  If needed, we will fill any
-        // remaining entries using the M::PerThread::randomNormal method.
+    /**
+     * The number of coefficients converted per block by \ref M::MatrixReal::DenseData::randomNormalEngine.
+     */
+    static constexpr unsigned zigguratBlockSize = 256;
 
+    /**
+     * Function that converts a block of raw 64-bit random values, in place, into normal deviates using the Ziggurat
+     * algorithm.  The fast path is branch free so the inner loop can be vectorized.  Rejected raw values, about 1.5%
+     * of the total, are recorded and then resolved using the slow path which draws any additional random values
+     * directly from the per-thread instance.
+     *
+     * \param[in]     pt        The per-thread instance used for any additional random values.
+     *
+     * \param[in]     blockSize The number of values to convert.  The value must not exceed zigguratBlockSize.
+     *
+     * \param[in,out] block     The block of raw values to be converted.
+     */
+    static void zigguratConvertBlock(PerThread& pt, unsigned blockSize, MatrixReal::Scalar* block) {
         union ValueUnion {
-            Scalar        f;
-            std::uint64_t i;
+            MatrixReal::Scalar f;
+            std::uint64_t      i;
         };
 
+        ValueUnion*   values = reinterpret_cast<ValueUnion*>(block);
+        std::uint64_t rejectedValues[zigguratBlockSize];
+        unsigned      rejectedIndexes[zigguratBlockSize];
+        unsigned      numberRejected = 0;
+
+        for (unsigned i=0 ; i<blockSize ; ++i) {
+            std::uint64_t raw = values[i].i;
+            Real          value;
+            bool          accepted = Ziggurat::normalFastPath(raw, value);
+
+            values[i].f                     = value;
+            rejectedValues[numberRejected]  = raw;
+            rejectedIndexes[numberRejected] = i;
+            numberRejected                 += accepted ? 0 : 1;
+        }
+
+        for (unsigned i=0 ; i<numberRejected ; ++i) {
+            values[rejectedIndexes[i]].f = Ziggurat::normalSlowPath(rejectedValues[i], pt);
+        }
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::DenseData::randomNormalEngine(PerThread &pt, Integer numberRows, Integer numberColumns) {
+        // This method fills the matrix with random 64-bit integer values and then converts the values, in place,
+        // using the Ziggurat algorithm.  Values are converted in blocks.
+
         DenseData*         result                   = createUninitialized(numberRows, numberColumns);
-        ValueUnion*        data                     = reinterpret_cast<ValueUnion*>(result->data());
+        Scalar*            data                     = result->data();
         unsigned long long columnSpacing            = result->columnSpacingInMemory();
         unsigned long long matrixSizeInCoefficients = columnSpacing * numberColumns;
         unsigned long long residueEntriesToClear    = columnSpacing - numberRows;
         unsigned long long firstTailEntry           = matrixSizeInCoefficients - residueEntriesToClear;
-        unsigned long long d                        = 0;
+        unsigned long long blockStart               = 0;
 
-        while (d < firstTailEntry) {
-            unsigned long long s                  = d;
-            unsigned long long coefficientsNeeded = matrixSizeInCoefficients - d;
+        pt.fillArray(data, matrixSizeInCoefficients * sizeof(Scalar) / 8);
 
-            pt.fillArray(data + d, coefficientsNeeded * sizeof(Scalar) / 8);
+        while (blockStart < firstTailEntry) {
+            unsigned blockSize = static_cast<unsigned>(
+                std::min(static_cast<unsigned long long>(zigguratBlockSize), firstTailEntry - blockStart)
+            );
 
-            while (s < matrixSizeInCoefficients && d < firstTailEntry) {
-                Real x1;
-                Real x2;
-                Real w;
+            zigguratConvertBlock(pt, blockSize, data + blockStart);
+            blockStart += blockSize;
+        }
 
-                do {
-                    std::uint64_t vi1 = data[s++].i;
-                    std::uint64_t vi2 = data[s++].i;
+        return result;
+    }
 
-                    x1 = 2.0 * (static_cast<double>(vi1) / static_cast<double>(0xFFFFFFFFFFFFFFFFULL)) - 1.0;
-                    x2 = 2.0 * (static_cast<double>(vi2) / static_cast<double>(0xFFFFFFFFFFFFFFFFULL)) - 1.0;
 
-                    w = x1 * x1 + x2 * x2;
-                } while (s < matrixSizeInCoefficients && (w == 0.0 || w >= 1.0));
+    /**
+     * The number of candidate values generated per pass by \ref M::MatrixReal::DenseData::randomGammaEngine.
+     */
+    static constexpr unsigned gammaBlockSize = zigguratBlockSize;
 
-                if (w > 0 && w< 1.0) {
-                    w = std::sqrt(-2.0 * std::log(w) / w);
-                    data[d + 0].f = x1 * w;
-                    data[d + 1].f = x2 * w;
+    void MatrixReal::DenseData::randomGammaEngine(
+            PerThread&         pt,
+            Real               shape,
+            unsigned long long numberValues,
+            Scalar*            destination
+        ) {
+        // Marsaglia and Tsang's method, evaluated a block of candidates at a time.  Each pass draws a block of
+        // normal and uniform deviates, computes the logarithms with the vector kernels, and then tests every
+        // candidate without branching, compacting accepted values directly into the destination.  With shape >= 1
+        // at least 95% of the candidates are accepted so few passes are needed.  Shapes below 1 use the identity
+        // G(a) = G(a + 1) * U^(1/a).
+
+        Real boostedShape = shape < 1.0 ? shape + 1.0 : shape;
+        Real d            = boostedShape - 1.0 / 3.0;
+        Real c            = 1.0 / std::sqrt(9.0 * d);
+
+        Scalar normals[gammaBlockSize];
+        Scalar logUniforms[gammaBlockSize];
+        Scalar cubes[gammaBlockSize];
+        Scalar logCubes[gammaBlockSize];
+
+        unsigned long long numberGenerated = 0;
+        while (numberGenerated < numberValues) {
+            unsigned blockSize = static_cast<unsigned>(
+                std::min(static_cast<unsigned long long>(gammaBlockSize), numberValues - numberGenerated)
+            );
 
-                    d += 2;
-                }
+            pt.fillArray(normals, blockSize);
+            zigguratConvertBlock(pt, blockSize, normals);
+
+            pt.fillArray(logUniforms, blockSize);
+            matrixApi()->integerToFloatExclusive(blockSize, logUniforms);
+            matrixApi()->doubleLog(blockSize, logUniforms, logUniforms);
+
+            for (unsigned i=0 ; i<blockSize ; ++i) {
+                Real t = 1.0 + c * normals[i];
+                Real v = t * t * t;
+
+                cubes[i]    = v;
+                logCubes[i] = v > 0 ? v : 1.0;
+            }
+
+            matrixApi()->doubleLog(blockSize, logCubes, logCubes);
+
+            Scalar*  block          = destination + numberGenerated;
+            unsigned numberAccepted = 0;
+            for (unsigned i=0 ; i<blockSize ; ++i) {
+                Real x        = normals[i];
+                Real v        = cubes[i];
+                bool accepted = v > 0 && logUniforms[i] < 0.5 * x * x + d - d * v + d * logCubes[i];
+
+                block[numberAccepted]  = d * v;
+                numberAccepted        += accepted ? 1 : 0;
             }
+
+            numberGenerated += numberAccepted;
         }
 
-        return result;
+        if (shape < 1.0) {
+            Scalar             factors[gammaBlockSize];
+            unsigned long long blockStart = 0;
+            while (blockStart < numberValues) {
+                unsigned blockSize = static_cast<unsigned>(
+                    std::min(static_cast<unsigned long long>(gammaBlockSize), numberValues - blockStart)
+                );
+
+                pt.fillArray(factors, blockSize);
+                matrixApi()->integerToFloatExclusive(blockSize, factors);
+                matrixApi()->doubleLog(blockSize, factors, factors);
+                matrixApi()->doubleVectorScalarMultiplyAdd(blockSize, factors, 1.0 / shape, 0, factors);
+                matrixApi()->doubleExponential(blockSize, factors, factors);
+                matrixApi()->doubleDotProduct(
+                    blockSize,
+                    destination + blockStart,
+                    factors,
+                    destination + blockStart
+                );
+
+                blockStart += blockSize;
+            }
+        }
     }
 
 
@@ -30,6 +30,9 @@
 #ifndef MODEL_MATRIX_REAL_DENSE_DATA_H
 #define MODEL_MATRIX_REAL_DENSE_DATA_H
 
+#include <cstdint>
+#include <string>
+
 #include <mat_api.h>
 
 #include "model_api_types.h"
@@ -490,6 +493,129 @@ namespace M {
              */
             MatrixInteger::Data* nintToInteger() const override;
 
+            /**
+             * Method you can use to obtain a matrix holding the exponential of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* exp() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the sine of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* sine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the cosine of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* cosine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the tangent of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* tangent() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the inverse sine of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* arcsine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the inverse cosine of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* arccosine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the inverse tangent of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* arctangent() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the hyperbolic sine of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* hyperbolicSine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the hyperbolic cosine of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* hyperbolicCosine() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the hyperbolic tangent of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* hyperbolicTangent() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the error function of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* erf() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the complementary error function of each value in the
+             * matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* erfc() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the gamma function of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* gamma() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the natural log of the gamma function of each value in the
+             * matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            DenseData* lnGamma() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the natural log of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            MatrixComplex::DenseData* ln() const;
+
+            /**
+             * Method you can use to obtain a matrix holding the square root of each value in the matrix.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            MatrixComplex::DenseData* sqrt() const;
+
+            /**
+             * Method you can use to obtain a matrix holding each value raised to a power of each value in the matrix.
+             *
+             * \param[in] exponent The exponent to apply.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            MatrixComplex::DenseData* pow(Scalar exponent) const;
+
             /**
              * Method that returns the determinant of this matrix.
              *
@@ -1089,6 +1215,77 @@ namespace M {
                 Scalar                             scalerMultiplier
             ) const override;
 
+            /**
+             * Method you can call to accumulate another matrix into this matrix, in place.  The method calculates
+             * \f$ this = augendScalar \times this + addendScalar \times op \left ( addend \right ) \f$ using a
+             * single pass over the data and without allocating a new data store.  The caller must guarantee that this
+             * data store is not shared and that the addend does not share memory with this data store.
+             *
+             * \param[in] addend          The instance to be accumulated into this instance.
+             *
+             * \param[in] addendTranspose Indicates that transpose needs to be performed on the addend prior to the
+             *                            addition.  The addend will not be modified.
+             *
+             * \param[in] augendScalar    A scalar value to be multiplied to this matrix prior to the addition.
+             *
+             * \param[in] addendScalar    A scalar value to be multiplied to the addend prior to the addition.
+             */
+            void scaleAccumulate(
+                const MatrixDensePrivate<Scalar>& addend,
+                bool                              addendTranspose,
+                Scalar                            augendScalar,
+                Scalar                            addendScalar
+            );
+
+            /**
+             * Method you can call to accumulate a sparse matrix into this matrix, in place.  The method calculates
+             * \f$ this = augendScalar \times this + addendScalar \times op \left ( addend \right ) \f$ without
+             * allocating a new data store.  The caller must guarantee that this data store is not shared.
+             *
+             * \param[in] addend          The instance to be accumulated into this instance.
+             *
+             * \param[in] addendTranspose Indicates that transpose needs to be performed on the addend prior to the
+             *                            addition.  The addend will not be modified.
+             *
+             * \param[in] augendScalar    A scalar value to be multiplied to this matrix prior to the addition.
+             *
+             * \param[in] addendScalar    A scalar value to be multiplied to the addend prior to the addition.
+             */
+            void scaleAccumulate(
+                const MatrixSparsePrivate<Scalar>& addend,
+                bool                               addendTranspose,
+                Scalar                             augendScalar,
+                Scalar                             addendScalar
+            );
+
+            /**
+             * Method you can call to accumulate a matrix product into this matrix, in place.  The method calculates
+             * \f$ this = scalerMultiplier \times op \left ( multiplier \right ) \times
+             * op \left ( multiplicand \right ) + accumulatorScalar \times this \f$ using a single GEMM call.  The
+             * caller must guarantee that this data store is not shared and that neither operand shares memory with this
+             * data store.
+             *
+             * \param[in] multiplier            The left hand side of the product.
+             *
+             * \param[in] multiplicand          The right hand side of the product.
+             *
+             * \param[in] multiplierTranspose   Indicates that a transpose needs to be performed on the multiplier.
+             *
+             * \param[in] multiplicandTranspose Indicates that a transpose needs to be performed on the multiplicand.
+             *
+             * \param[in] scalerMultiplier      A scaler multiplier to be applied to the product.
+             *
+             * \param[in] accumulatorScalar     A scaler multiplier to be applied to this matrix prior to accumulation.
+             */
+            void multiplyAccumulate(
+                const MatrixDensePrivate<Scalar>& multiplier,
+                const MatrixDensePrivate<Scalar>& multiplicand,
+                bool                              multiplierTranspose,
+                bool                              multiplicandTranspose,
+                Scalar                            scalerMultiplier,
+                Scalar                            accumulatorScalar
+            );
+
             /**
              * Method that compares this matrix against another matrix.  This version supports real types.
              *
@@ -1136,6 +1333,197 @@ namespace M {
             int relativeOrder(const MatrixReal::Data& other) const override;
 
         private:
+            /**
+             * The size of the version 2 binary file header, in bytes.  The size keeps the matrix data that follows
+             * the header aligned to a column boundary when the file is memory mapped.
+             */
+            static constexpr unsigned binaryHeaderSizeInBytes = 64;
+
+            /**
+             * Method that writes a 64-bit little endian value into a binary file header.
+             *
+             * \param[in] destination The location to receive the value.
+             *
+             * \param[in] value       The value to be written.
+             */
+            static void writeLittleEndian(std::uint8_t* destination, unsigned long long value);
+
+            /**
+             * Method that reads a 64-bit little endian value from a binary file header.
+             *
+             * \param[in] source The location holding the value.
+             *
+             * \return Returns the value.
+             */
+            static unsigned long long readLittleEndian(const std::uint8_t* source);
+
+            /**
+             * Method that validates a version 2 binary file header and extracts the matrix layout.
+             *
+             * \param[in]  header        The header to be parsed.  The header must be binaryHeaderSizeInBytes long.
+             *
+             * \param[out] numberRows    The number of matrix rows.
+             *
+             * \param[out] numberColumns The number of matrix columns.
+             *
+             * \param[out] columnSpacing The spacing between columns in the file, in coefficients.
+             *
+             * \return Returns true if the header describes a real matrix.  Returns false if the header is invalid.
+             */
+            static bool parseBinaryHeader(
+                const std::uint8_t* header,
+                unsigned long&      numberRows,
+                unsigned long&      numberColumns,
+                unsigned long long& columnSpacing
+            );
+
+            /**
+             * Method that loads a version 2 binary file.  The file is memory mapped and adopted as the matrix data
+             * when possible.  Changes to the matrix are copied on write and are never written back to the file.
+             *
+             * \param[in] filename The name of the file to be loaded.
+             *
+             * \return Returns a newly created matrix.  Returns a null pointer on error.
+             */
+            static DenseData* fromVersion2BinaryFile(const char* filename);
+
+            /**
+             * Method that determines if a character separates values in a CSV file.
+             *
+             * \param[in] c The character to be tested.
+             *
+             * \return Returns true if the character is a value separator.  Returns false otherwise.
+             */
+            static inline bool isCsvSeparator(char c) {
+                return c == '\t' || c == ' ' || c == ',' || c == ';' || c == '|' || c == ':';
+            }
+
+            /**
+             * Method that determines the number of CSV values on a single line.  The line is not validated.
+             *
+             * \param[in] begin Pointer to the first character of the line.
+             *
+             * \param[in] end   Pointer just past the last character of the line, excluding the line terminator.
+             *
+             * \return Returns the number of values on the line.
+             */
+            static unsigned long countCsvValues(const char* begin, const char* end);
+
+            /**
+             * Method that determines the number of rows and the largest number of columns in a block of CSV text.
+             *
+             * \param[in]  begin         Pointer to the first character of the block.  The block must start at the
+             *                           beginning of a line.
+             *
+             * \param[in]  end           Pointer just past the last character of the block.  The block must end at
+             *                           the end of a line.
+             *
+             * \param[out] numberRows    The number of lines in the block.
+             *
+             * \param[out] numberColumns The largest number of values on any line in the block.
+             */
+            static void scanCsvBlock(
+                const char*    begin,
+                const char*    end,
+                unsigned long& numberRows,
+                unsigned long& numberColumns
+            );
+
+            /**
+             * Method that parses a block of CSV text directly into a matrix.
+             *
+             * \param[in] begin         Pointer to the first character of the block.
+             *
+             * \param[in] end           Pointer just past the last character of the block.
+             *
+             * \param[in] firstRowIndex The zero based matrix row receiving the first line of the block.
+             *
+             * \param[in] matrix        The matrix to receive the values.  The matrix must be large enough to hold
+             *                          every value in the block.
+             *
+             * \return Returns true on success.  Returns false if the block contains an invalid value.
+             */
+            static bool parseCsvBlock(
+                const char*   begin,
+                const char*   end,
+                unsigned long firstRowIndex,
+                DenseData*    matrix
+            );
+
+            /**
+             * Method that loads a CSV file.  Large files are split at line boundaries and parsed in parallel.
+             *
+             * \param[in] filename The name of the file to be loaded.
+             *
+             * \return Returns a newly created matrix.  Returns a null pointer on error.
+             */
+            static DenseData* fromCsvFile(const char* filename);
+
+            /**
+             * Method that formats a range of rows of this matrix as CSV text.
+             *
+             * \param[in] firstRowIndex The zero based index of the first row to be formatted.
+             *
+             * \param[in] lastRowIndex  The zero based index just past the last row to be formatted.
+             *
+             * \return Returns the formatted text.
+             */
+            std::string formatCsvRows(unsigned long firstRowIndex, unsigned long lastRowIndex) const;
+
+            /**
+             * Method that writes this matrix to a file.  This method will throw an exception if an error occurs and
+             * the associated exception is enabled.
+             *
+             * \param[in] filename   The name of the file to be written.
+             *
+             * \param[in] fileFormat The desired file format.
+             *
+             * \return Returns true on success.  Returns false on error.
+             */
+            bool writeFile(const char* filename, Model::DataFileFormat fileFormat) const;
+
+            /**
+             * Method that saves this matrix as a CSV file.  Rows are formatted in parallel for large matrices and
+             * written in large blocks.
+             *
+             * \param[in] filename The name of the file to be written.
+             *
+             * \return Returns true on success.  Returns false on error.
+             */
+            bool toCsvFile(const char* filename) const;
+
+            /**
+             * Method that creates a new matrix by applying a kernel to each column of this matrix.
+             *
+             * \param[in] kernel The kernel to apply.  The kernel receives the number of rows, a pointer to the
+             *                   source column, and a pointer to the destination column.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            template<typename F> DenseData* mapColumns(F kernel) const {
+                DenseData* result = createUninitialized(numberRows(), numberColumns());
+                applyColumnKernel(result->data(), result->columnSpacingInMemory(), kernel);
+
+                return result;
+            }
+
+            /**
+             * Method that creates a new matrix by applying a scalar function to each value of this matrix.
+             *
+             * \param[in] function The function to apply.
+             *
+             * \return Returns a newly created dense data instance holding the result.
+             */
+            template<typename F> DenseData* mapElements(F function) const {
+                return mapColumns(
+                    [function](unsigned long numberRows, const Scalar* source, Scalar* destination) {
+                        for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                            destination[rowIndex] = function(source[rowIndex]);
+                        }
+                    }
+                );
+            }
+
             /**
              * Method you can use to obtain the small limit before equilibration is recommeded.
              *
@@ -1200,6 +1588,24 @@ namespace M {
              */
             static DenseData* randomNormalEngine(PerThread& pt, Integer numberRows, Integer numberColumns);
 
+            /**
+             * Method that fills a contiguous array with gamma distributed random values with a scale of 1.0.
+             *
+             * \param[in] pt           The per-thread instance used for random number generation.
+             *
+             * \param[in] shape        The shape parameter.
+             *
+             * \param[in] numberValues The number of values to generate.
+             *
+             * \param[in] destination  The array to receive the generated values.
+             */
+            static void randomGammaEngine(
+                PerThread&         pt,
+                Real               shape,
+                unsigned long long numberValues,
+                Scalar*            destination
+            );
+
             /**
              * Method that multiplies each row against a unique scale factor.
              *
@@ -0,0 +1,636 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+*
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::MatrixReal::SparseData class.
+***********************************************************************************************************************/
+
+#include <new>
+#include <cstring>
+#include <cstdint>
+#include <cassert>
+#include <algorithm>
+#include <cmath>
+
+#include "m_api_types.h"
+#include "m_intrinsic_types.h"
+#include "m_basic_functions.h"
+#include "model_exceptions.h"
+#include "m_matrix_dense_private.h"
+#include "m_matrix_sparse_private.h"
+#include "m_matrix_sparse_solver.h"
+#include "m_matrix_boolean.h"
+#include "m_matrix_boolean_data.h"
+#include "m_matrix_boolean_sparse_data.h"
+#include "m_matrix_complex.h"
+#include "m_matrix_complex_data.h"
+#include "m_matrix_complex_sparse_data.h"
+#include "m_matrix_integer.h"
+#include "m_matrix_integer_data.h"
+#include "m_matrix_integer_sparse_data.h"
+#include "m_matrix_real.h"
+#include "m_matrix_real_data.h"
+#include "m_matrix_real_dense_data.h"
+#include "m_matrix_real_sparse_data.h"
+
+namespace M {
+    MatrixReal::SparseData::SparseData(
+            unsigned long      newNumberRows,
+            unsigned long      newNumberColumns,
+            unsigned long long newCapacity
+        ):MatrixSparsePrivate<MatrixReal::SparseData::Scalar>(
+            newNumberRows,
+            newNumberColumns,
+            newCapacity
+        ) {}
+
+
+    MatrixReal::SparseData::SparseData(
+            const MatrixReal::SparseData& other
+        ):MatrixReal::Data(),
+          MatrixSparsePrivate<MatrixReal::SparseData::Scalar>(
+            other
+        ) {}
+
+
+    MatrixReal::SparseData::SparseData(
+            const MatrixReal::SparseData& other,
+            unsigned long                 newNumberRows,
+            unsigned long                 newNumberColumns
+        ):MatrixSparsePrivate<MatrixReal::SparseData::Scalar>(
+            other,
+            newNumberRows,
+            newNumberColumns
+        ) {}
+
+
+    MatrixReal::SparseData::~SparseData() {}
+
+
+    MatrixReal::SparseData* MatrixReal::SparseData::create(const MatrixBoolean::SparseData& other) {
+        return createConverted<SparseData>(other, [](MatrixBoolean::Scalar v) {
+            return v ? Scalar(1) : Scalar(0);
+        });
+    }
+
+
+    MatrixReal::SparseData* MatrixReal::SparseData::create(const MatrixInteger::SparseData& other) {
+        return createConverted<SparseData>(other, [](MatrixInteger::Scalar v) {
+            return static_cast<Scalar>(v);
+        });
+    }
+
+
+    MatrixReal::SparseData* MatrixReal::SparseData::create(const MatrixComplex::SparseData& other) {
+        return createConverted<SparseData>(other, [](const MatrixComplex::Scalar& v) {
+            if (v.imag() != 0) {
+                internalTriggerTypeConversionError(M::ValueType::MATRIX_COMPLEX, M::ValueType::MATRIX_REAL);
+            }
+
+            return v.real();
+        });
+    }
+
+
+    MatrixReal::DenseData* MatrixReal::SparseData::toDense() const {
+        DenseData* result = DenseData::create(numberRows(), numberColumns());
+        scatterInto(*result);
+
+        return result;
+    }
+
+
+    bool MatrixReal::SparseData::toFile(const char* filename, Model::DataFileFormat fileFormat) const {
+        return withDenseCopy([=](const DenseData& dense) {
+            return dense.toFile(filename, fileFormat);
+        });
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::combineLeftToRight(
+            const MatrixDensePrivate<MatrixReal::SparseData::Scalar>& other
+        ) const {
+        SparseData* sparseOther = create(other);
+        Data*       result      = combineLeftToRight(*sparseOther);
+        destroy(sparseOther);
+
+        return result;
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::combineLeftToRight(
+            const MatrixSparsePrivate<MatrixReal::SparseData::Scalar>& other
+        ) const {
+        SparseData* result = create(
+            std::max(numberRows(), other.numberRows()),
+            numberColumns() + other.numberColumns()
+        );
+
+        combineLeftToRightInto(other, *result);
+        return result;
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::combineTopToBottom(
+            const MatrixDensePrivate<MatrixReal::SparseData::Scalar>& other
+        ) const {
+        SparseData* sparseOther = create(other);
+        Data*       result      = combineTopToBottom(*sparseOther);
+        destroy(sparseOther);
+
+        return result;
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::combineTopToBottom(
+            const MatrixSparsePrivate<MatrixReal::SparseData::Scalar>& other
+        ) const {
+        SparseData* result = create(
+            numberRows() + other.numberRows(),
+            std::max(numberColumns(), other.numberColumns())
+        );
+
+        combineTopToBottomInto(other, *result);
+        return result;
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::columnReverse() const {
+        SparseData* result = create(numberRows(), numberColumns());
+        columnReverseInto(*result);
+
+        return result;
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::rowReverse() const {
+        SparseData* result = create(numberRows(), numberColumns());
+        rowReverseInto(*result);
+
+        return result;
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::resizeTo(
+            unsigned long newNumberRows,
+            unsigned long newNumberColumns,
+            bool          alwaysReallocate
+        ) {
+        MatrixReal::Data* result = this;
+        if (alwaysReallocate) {
+            result = MatrixSparsePrivate<Scalar>::create<SparseData>(*this, newNumberRows, newNumberColumns);
+        } else {
+            resizeInPlace(newNumberRows, newNumberColumns);
+        }
+
+        return result;
+    }
+
+
+    bool MatrixReal::SparseData::resizeInPlaceTo(unsigned long newNumberRows, unsigned long newNumberColumns) {
+        resizeInPlace(newNumberRows, newNumberColumns);
+        return true;
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::floor() const {
+        return map<SparseData>([](Scalar v) { return std::floor(v); });
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::ceil() const {
+        return map<SparseData>([](Scalar v) { return std::ceil(v); });
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::nint() const {
+        return map<SparseData>([](Scalar v) { return std::nearbyint(v); });
+    }
+
+
+    MatrixInteger::Data* MatrixReal::SparseData::truncateToInteger() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.truncateToInteger();
+        });
+    }
+
+
+    MatrixInteger::Data* MatrixReal::SparseData::floorToInteger() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.floorToInteger();
+        });
+    }
+
+
+    MatrixInteger::Data* MatrixReal::SparseData::ceilToInteger() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.ceilToInteger();
+        });
+    }
+
+
+    MatrixInteger::Data* MatrixReal::SparseData::nintToInteger() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.nintToInteger();
+        });
+    }
+
+
+    MatrixReal::Scalar MatrixReal::SparseData::determinant() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.determinant();
+        });
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::inverse() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.inverse();
+        });
+    }
+
+
+    bool MatrixReal::SparseData::plu(MatrixReal::Data*& p, MatrixReal::Data*& l, MatrixReal::Data*& u) const {
+        return withDenseCopy([&](const DenseData& dense) {
+            return dense.plu(p, l, u);
+        });
+    }
+
+
+    bool MatrixReal::SparseData::svd(MatrixReal::Data*& u, MatrixReal::Data*& s, MatrixReal::Data*& vh) const {
+        return withDenseCopy([&](const DenseData& dense) {
+            return dense.svd(u, s, vh);
+        });
+    }
+
+
+    bool MatrixReal::SparseData::qr(MatrixReal::Data*& q, MatrixReal::Data*& r) const {
+        return withDenseCopy([&](const DenseData& dense) {
+            return dense.qr(q, r);
+        });
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::cholesky() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.cholesky();
+        });
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::upperCholesky() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.upperCholesky();
+        });
+    }
+
+
+    void MatrixReal::SparseData::hessenberg(MatrixReal::Data*& qData, MatrixReal::Data*& hData) const {
+        withDenseCopy([&](const DenseData& dense) {
+            dense.hessenberg(qData, hData);
+            return true;
+        });
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::dct() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.dct();
+        });
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::idct() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.idct();
+        });
+    }
+
+
+    MatrixComplex::Data* MatrixReal::SparseData::hilbertTransform() const {
+        return withDenseCopy([](const DenseData& dense) {
+            return dense.hilbertTransform();
+        });
+    }
+
+
+    Real MatrixReal::SparseData::pNorm(Integer p) const {
+        Real result;
+
+        const Scalar*      v             = values();
+        unsigned long long numberEntries = numberNonZeros();
+
+        if (p > 0) {
+            if (p == 2) {
+                Real squaredResult = 0;
+                for (unsigned long long i=0 ; i<numberEntries ; ++i) {
+                    squaredResult += v[i] * v[i];
+                }
+
+                result = std::sqrt(squaredResult);
+            } else {
+                Real sum = 0;
+                for (unsigned long long i=0 ; i<numberEntries ; ++i) {
+                    sum += M::pow(M::abs(v[i]), p);
+                }
+
+                result = nroot(sum, p).real();
+            }
+        } else {
+            result = NaN;
+        }
+
+        return result;
+    }
+
+
+    Real MatrixReal::SparseData::oneNorm() const {
+        const Scalar*             v             = values();
+        const unsigned long long* starts        = columnStarts();
+        unsigned long             numberColumns = SparseData::numberColumns();
+
+        Real columnMaximum = 0;
+        for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+            Real               columnSum = 0;
+            unsigned long long end       = starts[columnIndex + 1];
+            for (unsigned long long i=starts[columnIndex] ; i<end ; ++i) {
+                columnSum += std::abs(v[i]);
+            }
+
+            if (columnSum > columnMaximum) {
+                columnMaximum = columnSum;
+            }
+        }
+
+        return columnMaximum;
+    }
+
+
+    Real MatrixReal::SparseData::infinityNorm() const {
+        const Scalar*        v             = values();
+        const unsigned long* rows          = rowIndexes();
+        unsigned long long   numberEntries = numberNonZeros();
+
+        std::vector<Real> rowSums(numberRows(), Real(0));
+        for (unsigned long long i=0 ; i<numberEntries ; ++i) {
+            rowSums[rows[i]] += std::abs(v[i]);
+        }
+
+        Real rowMaximum = 0;
+        for (Real rowSum : rowSums) {
+            if (rowSum > rowMaximum) {
+                rowMaximum = rowSum;
+            }
+        }
+
+        return rowMaximum;
+    }
+
+
+    bool MatrixReal::SparseData::equilibrate(MatrixReal::Data*& row, MatrixReal::Data*& column) const {
+        return withDenseCopy([&](const DenseData& dense) {
+            return dense.equilibrate(row, column);
+        });
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::solve(const MatrixReal::DenseData* y) const {
+        Data*         result         = nullptr;
+
+        unsigned long aNumberRows    = SparseData::numberRows();
+        unsigned long aNumberColumns = SparseData::numberColumns();
+        unsigned long yNumberRows    = y->numberRows();
+        unsigned long yNumberColumns = y->numberColumns();
+
+        if (aNumberColumns == 0 || aNumberRows == 0 || aNumberRows != aNumberColumns) {
+            throw Model::InvalidMatrixDimensions(aNumberRows, aNumberColumns);
+        } else if (yNumberColumns == 0 || yNumberRows == 0) {
+            throw Model::InvalidMatrixDimensions(yNumberRows, yNumberColumns);
+        } else if (aNumberRows != yNumberRows) {
+            throw Model::IncompatibleMatrixDimensions(aNumberRows, aNumberColumns, yNumberRows, yNumberColumns);
+        } else {
+            MatrixSparseSolver solver;
+            if (solver.factor(aNumberRows, columnStarts(), rowIndexes(), values())) {
+                DenseData*         x              = DenseData::createUninitialized(aNumberRows, yNumberColumns);
+                unsigned long long yColumnSpacing = y->columnSpacingInMemory();
+                unsigned long long xColumnSpacing = x->columnSpacingInMemory();
+
+                for (unsigned long columnIndex=0 ; columnIndex<yNumberColumns ; ++columnIndex) {
+                    solver.solve(y->data() + yColumnSpacing * columnIndex, x->data() + xColumnSpacing * columnIndex);
+                }
+
+                result = x;
+            } else {
+                result = DenseData::create(0, 0);
+            }
+        }
+
+        return result;
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::solve(const MatrixReal::SparseData* y) const {
+        return y->withDenseCopy([=](const DenseData& denseY) {
+            return solve(&denseY);
+        });
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::leastSquares(const MatrixReal::DenseData* b) const {
+        return withDenseCopy([=](const DenseData& dense) {
+            return dense.leastSquares(b);
+        });
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::leastSquares(const MatrixReal::SparseData* b) const {
+        return b->withDenseCopy([=](const DenseData& denseB) {
+            return leastSquares(&denseB);
+        });
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::hadamard(
+            const MatrixDensePrivate<MatrixReal::SparseData::Scalar>& other
+        ) const {
+        return MatrixSparsePrivate<Scalar>::hadamard<SparseData>(other);
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::hadamard(
+            const MatrixSparsePrivate<MatrixReal::SparseData::Scalar>& other
+        ) const {
+        return MatrixSparsePrivate<Scalar>::hadamard<SparseData>(other);
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::kronecker(
+            const MatrixDensePrivate<MatrixReal::SparseData::Scalar>& other,
+            bool                                                      otherTranspose,
+            MatrixReal::SparseData::Scalar                            scalarMultiplier
+        ) const {
+        SparseData* sparseOther = create(other);
+        Data*       result      = kronecker(*sparseOther, otherTranspose, scalarMultiplier);
+        destroy(sparseOther);
+
+        return result;
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::kronecker(
+            const MatrixSparsePrivate<MatrixReal::SparseData::Scalar>& other,
+            bool                                                       otherTranspose,
+            MatrixReal::SparseData::Scalar                             scalarMultiplier
+        ) const {
+        return MatrixSparsePrivate<Scalar>::kronecker<SparseData>(other, otherTranspose, scalarMultiplier);
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::add(
+            const MatrixDensePrivate<MatrixReal::SparseData::Scalar>& addend,
+            bool                                                      augendTranspose,
+            bool                                                      addendTranspose,
+            MatrixReal::SparseData::Scalar                            augendScalar,
+            MatrixReal::SparseData::Scalar                            addendScalar
+        ) const {
+        // The sum of a sparse and dense matrix is, in general, dense.  We scale and transpose the dense addend and
+        // then accumulate our entries into it.
+
+        unsigned long augendRows    = augendTranspose ? numberColumns() : numberRows();
+        unsigned long augendColumns = augendTranspose ? numberRows() : numberColumns();
+        unsigned long addendRows    = addendTranspose ? addend.numberColumns() : addend.numberRows();
+        unsigned long addendColumns = addendTranspose ? addend.numberRows() : addend.numberColumns();
+
+        if (augendRows != addendRows || augendColumns != addendColumns) {
+            throw Model::IncompatibleMatrixDimensions(augendRows, augendColumns, addendRows, addendColumns);
+        }
+
+        const DenseData& denseAddend = static_cast<const DenseData&>(addend);
+        DenseData*       result      = POLYMORPHIC_CAST<DenseData*>(
+            denseAddend.applyTransformAndScaling(addendTranspose, addendScalar)
+        );
+
+        accumulateInto(*result, augendTranspose, augendScalar);
+
+        return result;
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::add(
+            const MatrixSparsePrivate<MatrixReal::SparseData::Scalar>& addend,
+            bool                                                       augendTranspose,
+            bool                                                       addendTranspose,
+            MatrixReal::SparseData::Scalar                             augendScalar,
+            MatrixReal::SparseData::Scalar                             addendScalar
+        ) const {
+        return MatrixSparsePrivate<Scalar>::add<SparseData>(
+            addend,
+            augendTranspose,
+            addendTranspose,
+            augendScalar,
+            addendScalar
+        );
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::multiply(
+            const MatrixDensePrivate<MatrixReal::SparseData::Scalar>& multiplicand,
+            bool                                                      multiplierTranspose,
+            bool                                                      multiplicandTranspose,
+            MatrixReal::SparseData::Scalar                            scalerMultiplier
+        ) const {
+        unsigned long multiplierRows      = multiplierTranspose ? numberColumns() : numberRows();
+        unsigned long multiplierColumns   = multiplierTranspose ? numberRows() : numberColumns();
+        unsigned long multiplicandRows    = (
+              multiplicandTranspose
+            ? multiplicand.numberColumns()
+            : multiplicand.numberRows()
+        );
+        unsigned long multiplicandColumns = (
+              multiplicandTranspose
+            ? multiplicand.numberRows()
+            : multiplicand.numberColumns()
+        );
+
+        if (multiplierColumns != multiplicandRows) {
+            throw Model::IncompatibleMatrixDimensions(
+                multiplierRows,
+                multiplierColumns,
+                multiplicandRows,
+                multiplicandColumns
+            );
+        }
+
+        DenseData* result = DenseData::create(multiplierRows, multiplicandColumns);
+        multiplyDenseInto(multiplicand, multiplierTranspose, multiplicandTranspose, scalerMultiplier, *result);
+
+        return result;
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::multiply(
+            const MatrixSparsePrivate<MatrixReal::SparseData::Scalar>& multiplicand,
+            bool                                                       multiplierTranspose,
+            bool                                                       multiplicandTranspose,
+            MatrixReal::SparseData::Scalar                             scalerMultiplier
+        ) const {
+        return MatrixSparsePrivate<Scalar>::multiply<SparseData>(
+            multiplicand,
+            multiplierTranspose,
+            multiplicandTranspose,
+            scalerMultiplier
+        );
+    }
+
+
+    bool MatrixReal::SparseData::isEqualTo(const MatrixDensePrivate<MatrixReal::SparseData::Scalar>& other) const {
+        return MatrixSparsePrivate<Scalar>::isEqualTo(other);
+    }
+
+
+    bool MatrixReal::SparseData::isEqualTo(const MatrixSparsePrivate<MatrixReal::SparseData::Scalar>& other) const {
+        return MatrixSparsePrivate<Scalar>::isEqualTo(other);
+    }
+
+
+    MatrixReal::Data* MatrixReal::SparseData::applyTransformAndScaling(
+            bool                           transpose,
+            MatrixReal::SparseData::Scalar scaleFactor
+        ) const {
+        return transformAndScale<SparseData>(transpose, scaleFactor);
+    }
+
+
+    int MatrixReal::SparseData::relativeOrder(const MatrixReal::Data& other) const {
+        int result;
+
+        if (other.matrixType() == MatrixType::SPARSE) {
+            const SparseData& sparseOther = POLYMORPHIC_CAST<const SparseData&>(other);
+            result = MatrixSparsePrivate<Scalar>::relativeOrder(sparseOther);
+        } else {
+            result = static_cast<int>(matrixType()) - static_cast<int>(other.matrixType());
+        }
+
+        return result;
+    }
+}
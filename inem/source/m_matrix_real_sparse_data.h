@@ -34,13 +34,20 @@
 #include "model_intrinsic_types.h"
 #include "m_matrix_sparse_private.h"
 #include "m_matrix_dense_private.h"
+#include "m_matrix_boolean.h"
+#include "m_matrix_integer_data.h"
+#include "m_matrix_complex_data.h"
 #include "m_matrix_real_data.h"
 #include "m_matrix_real.h"
 
 namespace M {
     /**
      * Private implementation class for \ref M::MatrixReal.  This class provides the data store and implementation for
-     * real matricies using a sparse data format.
+     * real matricies using a compressed sparse column data format.
+     *
+     * Structural operations, addition, multiplication, and the Hadamard and Kronecker products are performed directly
+     * on the sparse representation.  Decompositions and other operations that inherently produce dense results are
+     * performed by converting to a dense representation.
      */
     class MatrixReal::SparseData:public MatrixReal::Data, public MatrixSparsePrivate<Real> {
         friend class MatrixSparsePrivate<Real>;
@@ -49,84 +56,107 @@ namespace M {
             /**
              * Constructor
              *
-             * \param[in] newNumberRows        The new number of rows.
-             *
-             * \param[in] newNumberColumns     The new number of columns.
+             * \param[in] newNumberRows    The new number of rows.
              *
-             * \param[in] newAllocationInBytes The size of the allocated data structure, in bytes.
+             * \param[in] newNumberColumns The new number of columns.
              *
-             * \param[in] rawDataBaseAddress   The base address of the raw data stored in the matrix.
+             * \param[in] newCapacity      The initial entry capacity.
              */
             SparseData(
                 unsigned long      newNumberRows,
                 unsigned long      newNumberColumns,
-                unsigned long long newAllocationInBytes,
-                void*              rawDataBaseAddress
+                unsigned long long newCapacity
             );
 
             /**
              * Constructor
              *
-             * \param[in] other                The instance to be copied to this instance.
-             *
-             * \param[in] newAllocationInBytes The size of the allocated data structure, in bytes.
-             *
-             * \param[in] rawDataBaseAddress   The base address of the raw data stored in the matrix.
+             * \param[in] other The instance to be copied to this instance.
              */
-            SparseData(
-                const MatrixDensePrivate<Real>& other,
-                unsigned long long              newAllocationInBytes,
-                void*                           rawDataBaseAddress
-            );
+            SparseData(const SparseData& other);
 
             /**
              * Constructor
              *
-             * \param[in] other                The instance to be copied to this instance.
-             *
-             * \param[in] newNumberRows        The new number of rows.
-             *
-             * \param[in] newNumberColumns     The new number of columns.
+             * \param[in] other            The instance to be copied to this instance.
              *
-             * \param[in] newAllocationInBytes The size of the allocated data structure, entries.
+             * \param[in] newNumberRows    The new number of rows.
              *
-             * \param[in] rawDataBaseAddress   The base address of the raw data stored in the matrix.
+             * \param[in] newNumberColumns The new number of columns.
              */
             SparseData(
-                const MatrixDensePrivate<Real>& other,
-                unsigned long                   newNumberRows,
-                unsigned long                   newNumberColumns,
-                unsigned long long              newAllocationInBytes,
-                void*                           rawDataBaseAddress
+                const SparseData& other,
+                unsigned long     newNumberRows,
+                unsigned long     newNumberColumns
             );
 
             ~SparseData() override;
 
         public:
             /**
-             * Method you can call to allocate an instance of this class.
+             * Method you can call to allocate an instance of this class.  The matrix will initially hold no entries.
              *
              * \param[in] newNumberRows    The new number of rows.
              *
              * \param[in] newNumberColumns The new number of columns.
+             *
+             * \param[in] newCapacity      The initial entry capacity.
+             *
+             * \return Returns a pointer to the newly created instance.
              */
             static inline SparseData* create(
-                    unsigned long newNumberRows,
-                    unsigned long newNumberColumns
+                    unsigned long      newNumberRows,
+                    unsigned long      newNumberColumns,
+                    unsigned long long newCapacity = 0
                 ) {
-                (void) newNumberRows;    // FIXME
-                (void) newNumberColumns; // FIXME
+                return MatrixSparsePrivate<Scalar>::create<SparseData>(newNumberRows, newNumberColumns, newCapacity);
+            }
 
-                return nullptr; // FIXME
+            /**
+             * Method that translates dense matrix data to this type.  Only non-zero coefficients are stored.
+             *
+             * \param[in] other The matrix data to be translated.
+             *
+             * \return Returns the translated matrix.
+             */
+            static inline SparseData* create(const MatrixDensePrivate<Real>& other) {
+                return MatrixSparsePrivate<Scalar>::createFromDense<SparseData>(other);
             }
 
+            /**
+             * Method that translates a sparse matrix of a different type to this type.
+             *
+             * \param[in] other The matrix data to be translated.
+             *
+             * \return Returns the translated matrix.
+             */
+            static SparseData* create(const MatrixBoolean::SparseData& other);
+
+            /**
+             * Method that translates a sparse matrix of a different type to this type.
+             *
+             * \param[in] other The matrix data to be translated.
+             *
+             * \return Returns the translated matrix.
+             */
+            static SparseData* create(const MatrixInteger::SparseData& other);
+
+            /**
+             * Method that translates a sparse matrix of a different type to this type.
+             *
+             * \param[in] other The matrix data to be translated.
+             *
+             * \return Returns the translated matrix.
+             */
+            static SparseData* create(const MatrixComplex::SparseData& other);
+
             /**
              * Method you can call to destroy an instance of this class.
              *
              * \param[in] instance The instance to be destroyed.
              */
             static inline void destroy(SparseData* instance) {
-                (void) instance; // FIXME
+                MatrixSparsePrivate<Scalar>::destroy(instance);
             }
 
             /**
@@ -135,9 +165,16 @@ namespace M {
              * \return Returns a newly created instance of this matrix.
              */
             MatrixReal::Data* clone() const override {
-                return nullptr; // FIXME
+                return MatrixSparsePrivate<Scalar>::create(*this);
             }
 
+            /**
+             * Method you can use to obtain a dense copy of this matrix.
+             *
+             * \return Returns a newly created dense instance holding the same values as this matrix.
+             */
+            MatrixReal::DenseData* toDense() const;
+
             /**
              * Method you can use to determine the array type.
              *
@@ -155,6 +192,654 @@ namespace M {
             ValueType coefficientType() const override {
                 return ValueType::REAL;
             }
+
+            /**
+             * Method you can use to save this matrix to a file in binary format.  This method will throw an exception
+             * if an error occurs and the associated exception is enabled.
+             *
+             * \param[in] filename   The filename to save the file to
+             *
+             * \param[in] fileFormat The desired file format.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            bool toFile(const char* filename, Model::DataFileFormat fileFormat) const override;
+
+            /**
+             * Method you can use to determine number of matrix rows.
+             *
+             * \return Returns the current number of rows.
+             */
+            unsigned long numberRows() const override {
+                return MatrixSparsePrivate<Scalar>::numberRows();
+            }
+
+            /**
+             * Method you can use to determine the number of matrix columns.
+             *
+             * \return Returns the current number of matrix columns.
+             */
+            unsigned long numberColumns() const override {
+                return MatrixSparsePrivate<Scalar>::numberColumns();
+            }
+
+            /**
+             * Method you can use to obtain the value at a given location.
+             *
+             * \param[in] rowIndex    The zero based row index we want the entry from.
+             *
+             * \param[in] columnIndex The zero based column index we want the entry from.
+             *
+             * \return Returns the value at the specified location.
+             */
+            Scalar at(unsigned long rowIndex, unsigned long columnIndex) const override {
+                return MatrixSparsePrivate<Scalar>::at(rowIndex, columnIndex);
+            }
+
+            /**
+             * Method you can use to obtain the value at a given location.
+             *
+             * \param[in] rowIndex    The zero based row index we want the entry from.
+             *
+             * \param[in] columnIndex The zero based column index we want the entry from.
+             *
+             * \return Returns a reference to the value at the specified location.  The entry will be inserted into the
+             *         matrix if it is not currently stored.
+             */
+            Scalar& at(unsigned long rowIndex, unsigned long columnIndex) override {
+                return MatrixSparsePrivate<Scalar>::at(rowIndex, columnIndex);
+            }
+
+            /**
+             * Method you can use to create a matrix that represents the combination of two other matrices.  The
+             * matrices are combined left to right.
+             *
+             * \param[in] other The matrix to combine to the right of this matrix.
+             *
+             * \return Returns a new matrix representing the combination of the two matrices.
+             */
+            MatrixReal::Data* combineLeftToRight(const MatrixDensePrivate<Scalar>& other) const override;
+
+            /**
+             * Method you can use to create a matrix that represents the combination of two other matrices.  The
+             * matrices are combined left to right.
+             *
+             * \param[in] other The matrix to combine to the right of this matrix.
+             *
+             * \return Returns a new matrix representing the combination of the two matrices.
+             */
+            MatrixReal::Data* combineLeftToRight(const MatrixSparsePrivate<Scalar>& other) const override;
+
+            /**
+             * Method you can use to create a matrix that represents the combination of two other matrices.  The
+             * matrices are combined top to bottom.
+             *
+             * \param[in] other The matrix to combine below this matrix.
+             *
+             * \return Returns a new matrix representing the combination of the two matrices.
+             */
+            MatrixReal::Data* combineTopToBottom(const MatrixDensePrivate<Scalar>& other) const override;
+
+            /**
+             * Method you can use to create a matrix that represents the combination of two other matrices.  The
+             * matrices are combined top to bottom.
+             *
+             * \param[in] other The matrix to combine below this matrix.
+             *
+             * \return Returns a new matrix representing the combination of the two matrices.
+             */
+            MatrixReal::Data* combineTopToBottom(const MatrixSparsePrivate<Scalar>& other) const override;
+
+            /**
+             * Method you can use to reverse the columns in this matrix.
+             *
+             * \return Returns a column-reversed version of this matrix.
+             */
+            MatrixReal::Data* columnReverse() const override;
+
+            /**
+             * Method you can use to reverse the rows in this matrix.
+             *
+             * \return Returns a row-reversed version of this matrix.
+             */
+            MatrixReal::Data* rowReverse() const override;
+
+            /**
+             * Method you can call to resize this matrix to a specific dimension.
+             *
+             * \param[in] newNumberRows    The new number of rows for the array.
+             *
+             * \param[in] newNumberColumns The new number of columns for the array.
+             *
+             * \param[in] alwaysReallocate if true, then this method will always create a new array instance.  If
+             *                             false, then this method may try to preserve the existing array depending on
+             *                             the magnitude of the size change.
+             *
+             * \return Returns either a pointer to this object or a newly initialized instance if the object size
+             *         could not support the matrix.  Note that reducing the array size may also cause a new instance
+             *         to be allocated.
+             */
+            MatrixReal::Data* resizeTo(
+                    unsigned long newNumberRows,
+                    unsigned long newNumberColumns,
+                    bool          alwaysReallocate = false
+                ) override;
+
+            /**
+             * Method you can call attempt a resize-in-place.
+             *
+             * \param[in] newNumberRows    The new number of rows for the array.
+             *
+             * \param[in] newNumberColumns The new number of columns for the array.
+             *
+             * \return Returns true on success, returns false if the matrix could not be adjusted in-place to the new
+             *         size.
+             */
+            bool resizeInPlaceTo(unsigned long newNumberRows, unsigned long newNumberColumns) override;
+
+            /**
+             * Method you can use to obtain the raw data tracked by this matrix.  Sparse matrices do not maintain a
+             * contiguous column major image of their coefficients so this method always returns a null pointer.
+             * Convert the matrix to a dense representation if you need direct access to the coefficients.
+             *
+             * \return Returns a null pointer.
+             */
+            const Scalar* data() const override {
+                return nullptr;
+            }
+
+            /**
+             * Method you can use to obtain the raw data tracked by this matrix.  Sparse matrices do not maintain a
+             * contiguous column major image of their coefficients so this method always returns a null pointer.
+             * Convert the matrix to a dense representation if you need direct access to the coefficients.
+             *
+             * \return Returns a null pointer.
+             */
+            Scalar* data() override {
+                return nullptr;
+            }
+
+            /**
+             * Method you can use to obtain a matrix holding the floor of each value in the matrix.
+             *
+             * \return Returns a real matrix with each value equal to the floor of the matrix contents.
+             */
+            Data* floor() const override;
+
+            /**
+             * Method you can use to obtain a matrix holding the ceiling of each value in the matrix.
+             *
+             * \return Returns a real matrix with each value equal to the ceiling of the matrix contents.
+             */
+            Data* ceil() const override;
+
+            /**
+             * Method you can use to obtain a matrix holding the nearest integer to each value in the matrix.
+             *
+             * \return Returns a real matrix with each value equal to the nearest integer of each coefficeint of the
+             *         matrix contents.
+             */
+            Data* nint() const override;
+
+            /**
+             * Method you can use to convert this matrix to an integer matrix.
+             *
+             * \return Returns this matrix converted to an integer matrix.  Values are truncated towards zero.
+             */
+            MatrixInteger::Data* truncateToInteger() const override;
+
+            /**
+             * Method you can use to convert this matrix to an integer matrix.  Integer values represent the floor of
+             * the supplied values.
+             *
+             * \return Returns this matrix converted to an integer matrix.  Values are truncated towards negative
+             *         infinity.
+             */
+            MatrixInteger::Data* floorToInteger() const override;
+
+            /**
+             * Method you can use to convert this matrix to an integer matrix.  Integer values represent the ceiling
+             * of the supplied values.
+             *
+             * \return Returns this matrix converted to an integer matrix.  Values are truncated towards positive
+             *         infinity.
+             */
+            MatrixInteger::Data* ceilToInteger() const override;
+
+            /**
+             * Method you can use to convert this matrix to an integer matrix.  Integer values represent the nearest
+             * integer of the supplied values.
+             *
+             * \return Returns this matrix converted to an integer matrix.  Values are truncated to the closest
+             *         integer value.
+             */
+            MatrixInteger::Data* nintToInteger() const override;
+
+            /**
+             * Method that returns the determinant of this matrix.
+             *
+             * \return Returns the determinant of this value.
+             */
+            Scalar determinant() const override;
+
+            /**
+             * Method that returns the inverse of the matrix.
+             *
+             * \return Returns the inverse matrix.  Returns an empty matrix if inverse could not be determined.
+             */
+            Data* inverse() const override;
+
+            /**
+             * Method that performs PLU decomposition of this matrix.
+             *
+             * \param[out] p The pivot matrix.  You are expected to take ownership of this matrix.
+             *
+             * \param[out] l The resulting lower triangular matrix.  You are expected to take ownership of this matrix.
+             *
+             * \param[out] u The resulting upper triangular matrix.  You are expected to take ownership of this matrix.
+             *
+             * \return Returns true on success, returns false if the resulting upper matrix is singular.
+             */
+            bool plu(Data*& p, Data*& l, Data*& u) const override;
+
+            /**
+             * Method that performs singular value decomposition of this matrix.
+             *
+             * \param[out] u  The unitary matrix.  You are expected to take ownership of this matrix.
+             *
+             * \param[out] s  The singular value matrix.  You are expected to take ownership of this matrix.
+             *
+             * \param[out] vh The left and right singular vector matrix.  You are expected to take ownership of this
+             *                matrix.
+             *
+             * \return Returns true on success, returns false if the resulting upper matrix is singular.
+             */
+            bool svd(Data*& u, Data*& s, Data*& vh) const override;
+
+            /**
+             * Method that performs QR decomposition of this matrix.
+             *
+             * \param[out] q The unitary matrix.  You are expected to take ownership of this matrix.
+             *
+             * \param[out] r The upper triangular matrix.  You are expected to take ownership of this matrix.
+             *
+             * \return Returns true on success, false if the decomposition could not be performed.
+             */
+            bool qr(Data*& q, Data*& r) const override;
+
+            /**
+             * Method that performs Cholesky decomposition of this matrix.  The matrix must be Hermitian.
+             *
+             * \return Returns the lower triangular matrix representing the Cholesky decomposition of this matrix.
+             *         An empty matrix will be returned on failure.
+             */
+            Data* cholesky() const override;
+
+            /**
+             * Method that performs Cholesky decomposition of this matrix, creating an upper triangular matrix.  The
+             * matrix must be Hermitian.
+             *
+             * \return Returns the upper triangular matrix representing the Cholesky decomposition of this matrix.
+             *         An empty matrix will be returned on failure.
+             */
+            Data* upperCholesky() const override;
+
+            /**
+             * Method that reduces this matrix to upper Hessenberg form.
+             *
+             * \param[out] qData The Q unitary matrix.  You are expected to take ownership of this matrix.
+             *
+             * \param[out] hData The Hessenberg matrix.  You are expected to take ownership of this matrix.
+             *
+             * \return Returns true on success, returns false on error.
+             */
+            void hessenberg(Data*& qData, Data*& hData) const override;
+
+            /**
+             * Method that calculates the forward or type 2 discrete cosine transform (DCT) of this matrix.  A matrix
+             * with a single dimension will be processed as a one-dimensional DCT.  A matrix with multiple rows and
+             * columns will be processed as a two dimensional DCT.
+             *
+             * \return Returns a matrix representing the complex discrete cosine transform of the matrix.
+             */
+            Data* dct() const override;
+
+            /**
+             * Method that calculates the inverse or type 3 discrete cosine transform (DCT) of this matrix.  A matrix
+             * with a single dimension will be processed as a one dimensional inverse DFT.  A matrix with multiple rows
+             * and columns will be processed as a two dimensional inverse DCT.
+             *
+             * \return Returns a matrix representing the complex inverse discrete cosine transform of the matrix.
+             */
+            Data* idct() const override;
+
+            /**
+             * Method that calculates the Hilbert transform of an array (1 dimensional matrix).
+             *
+             * \return Returns the Hilbert transform of this matrix.
+             */
+            MatrixComplex::Data* hilbertTransform() const override;
+
+            /**
+             * Method that calculates the entry-wise p-norm of this matrix.
+             *
+             * \param[in] p The power term to apply to the norm operation.
+             *
+             * \return Returns the p-norm of this matrix.
+             */
+            Real pNorm(Integer p) const override;
+
+            /**
+             * Method that calculates the 1-norm of this matrix.
+             *
+             * \return Returns the 1-normnorm of this matrix.
+             */
+            Real oneNorm() const override;
+
+            /**
+             * Method that calculates the infinity-norm of this matrix.
+             *
+             * \return Returns the infinity-norm of this matrix.
+             */
+            Real infinityNorm() const override;
+
+            /**
+             * Method that calculates a set of row and column factors you can use to equilibrate a matrix.
+             *
+             * \param[out] row    The row scaling matrix.  You are expected to take ownership of this matrix.
+             *
+             * \param[out] column The column scaling matrix.  You are expected to take ownership of this matrix.
+             *
+             * \return Returns true on success.  Returns false if one or more row of the matrix is exactly 0.
+             */
+            bool equilibrate(Data*& row, Data*& column) const override;
+
+            /**
+             * Method that solves the system of linear equations specified by this matrix.  For a system of linear
+             * equations defined by:
+             *
+             * \f[
+             *     A \times X = Y
+             * \f]
+             *
+             * Where 'A' is represented by this matrix and Y is a row vector defining the results, this method will
+             * return approximate values for 'X'.  The system is solved using a sparse Cholesky factorization when A
+             * is symmetric positive definite and a sparse LU factorization otherwise.  Both factorizations use an
+             * approximate minimum degree ordering to limit fill.
+             *
+             * \param[in] y The row matrix holding the results of the product \f[ A \times X \f].
+             *
+             * \return Returns the resulting values of 'X'.  An empty matrix will be returned if A is singular.
+             */
+            Data* solve(const MatrixReal::DenseData* y) const override;
+
+            /**
+             * Method that solves the system of linear equations specified by this matrix.  For a system of linear
+             * equations defined by:
+             *
+             * \f[
+             *     A \times X = Y
+             * \f]
+             *
+             * Where 'A' is represented by this matrix and Y is a row vector defining the results, this method will
+             * return approximate values for 'X'.
+             *
+             * \param[in] y The row matrix holding the results of the product \f[ A \times X \f].
+             *
+             * \return Returns the resulting values of 'X'.  An empty matrix will be returned if A is singular.
+             */
+            Data* solve(const MatrixReal::SparseData* y) const override;
+
+            /**
+             * Method that solves and over/under determined system using QR or LQ factorization.  When provided an
+             * under-determined matrix, this method will determine the minimum Euclidean-norm solution.
+             *
+             * For over-determined systems, this method will find the solution that exactly satisfies \f[ Ax = b \f].
+             * For under-determined system, this method will find the solution that identifies the value of \f[ x \f]
+             * that minimizes \f[ \Vert\Vert A x - b \Vert\Vert _ 2 \f].
+             *
+             * \param[in] b The row matrix holding the results of the product \f[ A \times X \f].
+             *
+             * \return Returns the resulting values of 'x'.  An empty matrix will be returned on error.
+             */
+            Data* leastSquares(const MatrixReal::DenseData* b) const override;
+
+            /**
+             * Method that solves and over/under determined system using QR or LQ factorization.  When provided an
+             * under-determined matrix, this method will determine the minimum Euclidean-norm solution.
+             *
+             * For over-determined systems, this method will find the solution that exactly satisfies \f[ Ax = b \f].
+             * For under-determined system, this method will find the solution that identifies the value of \f[ x \f]
+             * that minimizes \f[ \Vert\Vert A x - b \Vert\Vert _ 2 \f].
+             *
+             * \param[in] b The row matrix holding the results of the product \f[ A \times X \f].
+             *
+             * \return Returns the resulting values of 'x'.  An empty matrix will be returned on error.
+             */
+            Data* leastSquares(const MatrixReal::SparseData* b) const override;
+
+            /**
+             * Method that calculates the Hadamard or Schur product of this matrix and another matrix.
+             *
+             * \param[in] other The matrix to multiply against this matrix.
+             *
+             * \return Returns the Hadamard product of the two matrices.
+             */
+            Data* hadamard(const MatrixDensePrivate<Scalar>& other) const override;
+
+            /**
+             * Method that calculates the Hadamard or Schur product of this matrix and another matrix.
+             *
+             * \param[in] other The matrix to multiply against this matrix.
+             *
+             * \return Returns the Hadamard product of the two matrices.
+             */
+            Data* hadamard(const MatrixSparsePrivate<Scalar>& other) const override;
+
+            /**
+             * Method that calculates the Kronecker product of this matrix and another matrix.
+             *
+             * \param[in] other            The matrix to multiply against this matrix.
+             *
+             * \param[in] otherTranspose   If true, the other matrix should be transposed before performing this
+             *                             opration.
+             *
+             * \param[in] scalarMultiplier A scalar multiplier to be applied.
+             *
+             * \return Returns the Kronecker product of the two matrices.
+             */
+            Data* kronecker(
+                const MatrixDensePrivate<Scalar>& other,
+                bool                              otherTranspose,
+                Scalar                            scalarMultiplier
+            ) const override;
+
+            /**
+             * Method that calculates the Kronecker product of this matrix and another matrix.
+             *
+             * \param[in] other            The matrix to multiply against this matrix.
+             *
+             * \param[in] otherTranspose   If true, the other matrix should be transposed before performing this
+             *                             opration.
+             *
+             * \param[in] scalarMultiplier A scalar multiplier to be applied.
+             *
+             * \return Returns the Kronecker product of the two matrices.
+             */
+            Data* kronecker(
+                const MatrixSparsePrivate<Scalar>& other,
+                bool                               otherTranspose,
+                Scalar                             scalarMultiplier
+            ) const override;
+
+            /**
+             * Method you can call to add this matrix to another matrix.
+             *
+             * \param[in] addend          The instance to be added to this instance.
+             *
+             * \param[in] augendTranspose Indicates that transpose needs to be performed on the augend (left value)
+             *                            prior to performing the addition.  The augend (this data instance) will not
+             *                            be modified.
+             *
+             * \param[in] addendTranspose Indicates that transpose needs to be performed on the added (right value)
+             *                            prior to performing the addition.  The addend will not be modified.
+             *
+             * \param[in] augendScalar    A scalar value to be multiplied to the augend prior to the addition.
+             *
+             * \param[in] addendScalar    A scalar value to be multiplied to the addend prior to the addition.
+             *
+             * \return Returns a new matrix representing the sum of the two matrices.
+             */
+            Data* add(
+                const MatrixDensePrivate<Scalar>& addend,
+                bool                              augendTranspose,
+                bool                              addendTranspose,
+                Scalar                            augendScalar,
+                Scalar                            addendScalar
+            ) const override;
+
+            /**
+             * Method you can call to add this matrix to another matrix.
+             *
+             * \param[in] addend          The instance to be added to this instance.
+             *
+             * \param[in] augendTranspose Indicates that transpose needs to be performed on the augend (left value)
+             *                            prior to performing the addition.  The augend (this data instance) will not
+             *                            be modified.
+             *
+             * \param[in] addendTranspose Indicates that transpose needs to be performed on the added (right value)
+             *                            prior to performing the addition.  The addend will not be modified.
+             *
+             * \param[in] augendScalar    A scalar value to be multiplied to the augend prior to the addition.
+             *
+             * \param[in] addendScalar    A scalar value to be multiplied to the addend prior to the addition.
+             *
+             * \return Returns a new matrix representing the sum of the two matrices.
+             */
+            Data* add(
+                const MatrixSparsePrivate<Scalar>& addend,
+                bool                               augendTranspose,
+                bool                               addendTranspose,
+                Scalar                             augendScalar,
+                Scalar                             addendScalar
+            ) const override;
+
+            /**
+             * Method you can call to multiply this matrix to another matrix.
+             *
+             * \param[in] multiplicand          The instance to be multiplied to this instance.
+             *
+             * \param[in] multiplierTranspose   Indicates that a transpose needs to be performed on the multiplier
+             *                                  during the multiplication. The multiplier will not be modified during
+             *                                  the operation.
+             *
+             * \param[in] multiplicandTranspose Indicates that a transpose needs to be performed on the multiplicand
+             *                                  during the multiplication. The multiplicand will not be modified during
+             *                                  the operation.
+             *
+             * \param[in] scalerMultiplier      A scaler multiplier to be applied to the multiplication operation.
+             *
+             * \return Returns a new matrix representing the product of the two matrices.
+             */
+            Data* multiply(
+                const MatrixDensePrivate<Scalar>& multiplicand,
+                bool                              multiplierTranspose,
+                bool                              multiplicandTranspose,
+                Scalar                            scalerMultiplier
+            ) const override;
+
+            /**
+             * Method you can call to multiply this matrix to another matrix.
+             *
+             * \param[in] multiplicand          The instance to be multiplied to this instance.
+             *
+             * \param[in] multiplierTranspose   Indicates that a transpose needs to be performed on the multiplier
+             *                                  during the multiplication. The multiplier will not be modified during
+             *                                  the operation.
+             *
+             * \param[in] multiplicandTranspose Indicates that a transpose needs to be performed on the multiplicand
+             *                                  during the multiplication. The multiplicand will not be modified during
+             *                                  the operation.
+             *
+             * \param[in] scalerMultiplier      A scaler multiplier to be applied to the multiplication operation.
+             *
+             * \return Returns a new matrix representing the product of the two matrices.
+             */
+            Data* multiply(
+                const MatrixSparsePrivate<Scalar>& multiplicand,
+                bool                               multiplierTranspose,
+                bool                               multiplicandTranspose,
+                Scalar                             scalerMultiplier
+            ) const override;
+
+            /**
+             * Method that compares this matrix against another matrix.  This version supports real types.
+             *
+             * \param[in] other The matrix to be compared against.
+             *
+             * \return Returns true if the matrices are equal.  Returns false if the matrices are not equal.
+             */
+            bool isEqualTo(const MatrixDensePrivate<Scalar>& other) const override;
+
+            /**
+             * Method that compares this matrix against another matrix.  This version supports real types.
+             *
+             * \param[in] other The matrix to be compared against.
+             *
+             * \return Returns true if the matrices are equal.  Returns false if the matrices are not equal.
+             */
+            bool isEqualTo(const MatrixSparsePrivate<Scalar>& other) const override;
+
+            /**
+             * Method that applies a requested transform and scaling.
+             *
+             * \param[in] transpose   If true, the matrix will be transposed.
+             *
+             * \param[in] scaleFactor The desired scale factor.
+             *
+             * \return Returns a pointer to the newly transformed and scaled instance.
+             */
+            Data* applyTransformAndScaling(bool transpose, Scalar scaleFactor) const override;
+
+            /**
+             * Method you can call to determine the recommended ordering of this matrix data relative to another
+             * matrix data instance.  Ordering is based on:
+             *
+             *     * The type of the underlying data.
+             *
+             *     * Number of matrix rows and columns.
+             *
+             *     * Value of each byte in the matrix.
+             *
+             * \param[in] other The other set to compare against.
+             *
+             * \return Returns a negative value if this matrix should precede the order matrix.  Returns 0 if the
+             *         matrices are equal.  Returns a positive value if this matrix should follow the other matrix.
+             */
+            int relativeOrder(const MatrixReal::Data& other) const override;
+
+        private:
+            /**
+             * Method that runs an operation against a temporary dense copy of this matrix.  The temporary is released
+             * even if the operation throws.
+             *
+             * \param[in] operation The operation to perform.  The operation receives a reference to the dense copy.
+             *
+             * \return Returns the value reported by the operation.
+             */
+            template<typename F> auto withDenseCopy(F operation) const -> decltype(operation(*toDense())) {
+                DenseData* dense = toDense();
+
+                try {
+                    auto result = operation(*dense);
+                    MatrixDensePrivate<Scalar>::destroy(dense);
+
+                    return result;
+                } catch (...) {
+                    MatrixDensePrivate<Scalar>::destroy(dense);
+                    throw;
+                }
+            }
     };
 }
 
@@ -0,0 +1,844 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This header defines the private \ref M::MatrixSmallPrivate template class.
+***********************************************************************************************************************/
+
+/* .. sphinx-project inem */
+
+#ifndef M_MATRIX_SMALL_PRIVATE_H
+#define M_MATRIX_SMALL_PRIVATE_H
+
+#include <cmath>
+#include <cassert>
+#include <utility>
+
+#include "m_intrinsic_types.h"
+
+namespace M {
+    /**
+     * Fixed size kernels for matrices with no more than \ref M::MatrixSmallPrivate::maximumDimension rows and
+     * columns.  At these sizes the call overhead of the BLAS and LAPACK libraries dominates the actual work so the
+     * dense data stores dispatch to these kernels instead.  Kernels are templated on the matrix dimension so the
+     * compiler can fully unroll the inner loops.
+     *
+     * All matrices are stored in column major order with the column spacing, in entries, used by the dense data
+     * stores.
+     *
+     * \param[in] C The scalar type of the matrix coefficients.
+     */
+    template<typename C> class MatrixSmallPrivate {
+        public:
+            /**
+             * The largest number of rows or columns handled by these kernels.
+             */
+            static constexpr unsigned long maximumDimension = 4;
+
+            /**
+             * Method you can use to determine if a matrix can be handled by these kernels.
+             *
+             * \param[in] numberRows    The number of matrix rows.
+             *
+             * \param[in] numberColumns The number of matrix columns.
+             *
+             * \return Returns true if the matrix is small enough for these kernels.  Returns false if the matrix should
+             *         be handled by the general purpose implementation.
+             */
+            static inline bool isSmall(unsigned long numberRows, unsigned long numberColumns) {
+                return numberRows <= maximumDimension && numberColumns <= maximumDimension;
+            }
+
+            /**
+             * Method that calculates \f$ Y = s \times op \left ( A \right ) \times op \left ( B \right ) \f$.  All
+             * dimensions must be between 1 and \ref M::MatrixSmallPrivate::maximumDimension, inclusive.
+             *
+             * \param[in] numberRows                The number of rows in \f$ op \left ( A \right ) \f$ and Y.
+             *
+             * \param[in] innerDimension            The number of columns in \f$ op \left ( A \right ) \f$.
+             *
+             * \param[in] numberColumns             The number of columns in \f$ op \left ( B \right ) \f$ and Y.
+             *
+             * \param[in] scaleFactor               The scale factor to apply to the product.
+             *
+             * \param[in] multiplier                The multiplier, A.
+             *
+             * \param[in] multiplierColumnSpacing   The column spacing of the multiplier, in entries.
+             *
+             * \param[in] multiplierTranspose       If true, the multiplier should be transposed.
+             *
+             * \param[in] multiplicand              The multiplicand, B.
+             *
+             * \param[in] multiplicandColumnSpacing The column spacing of the multiplicand, in entries.
+             *
+             * \param[in] multiplicandTranspose     If true, the multiplicand should be transposed.
+             *
+             * \param[in] result                    The location to receive the product, Y.
+             *
+             * \param[in] resultColumnSpacing       The column spacing of the result, in entries.
+             */
+            static void multiply(
+                    unsigned long      numberRows,
+                    unsigned long      innerDimension,
+                    unsigned long      numberColumns,
+                    const C&           scaleFactor,
+                    const C*           multiplier,
+                    unsigned long long multiplierColumnSpacing,
+                    bool               multiplierTranspose,
+                    const C*           multiplicand,
+                    unsigned long long multiplicandColumnSpacing,
+                    bool               multiplicandTranspose,
+                    C*                 result,
+                    unsigned long long resultColumnSpacing
+                ) {
+                unsigned long long multiplierRowStride      = multiplierTranspose ? multiplierColumnSpacing : 1;
+                unsigned long long multiplierColumnStride   = multiplierTranspose ? 1 : multiplierColumnSpacing;
+                unsigned long long multiplicandRowStride    = multiplicandTranspose ? multiplicandColumnSpacing : 1;
+                unsigned long long multiplicandColumnStride = multiplicandTranspose ? 1 : multiplicandColumnSpacing;
+
+                switch (innerDimension) {
+                    case 1: {
+                        multiplyKernel<1>(
+                            numberRows,
+                            numberColumns,
+                            scaleFactor,
+                            multiplier,
+                            multiplierRowStride,
+                            multiplierColumnStride,
+                            multiplicand,
+                            multiplicandRowStride,
+                            multiplicandColumnStride,
+                            result,
+                            resultColumnSpacing
+                        );
+
+                        break;
+                    }
+
+                    case 2: {
+                        multiplyKernel<2>(
+                            numberRows,
+                            numberColumns,
+                            scaleFactor,
+                            multiplier,
+                            multiplierRowStride,
+                            multiplierColumnStride,
+                            multiplicand,
+                            multiplicandRowStride,
+                            multiplicandColumnStride,
+                            result,
+                            resultColumnSpacing
+                        );
+
+                        break;
+                    }
+
+                    case 3: {
+                        multiplyKernel<3>(
+                            numberRows,
+                            numberColumns,
+                            scaleFactor,
+                            multiplier,
+                            multiplierRowStride,
+                            multiplierColumnStride,
+                            multiplicand,
+                            multiplicandRowStride,
+                            multiplicandColumnStride,
+                            result,
+                            resultColumnSpacing
+                        );
+
+                        break;
+                    }
+
+                    case 4: {
+                        multiplyKernel<4>(
+                            numberRows,
+                            numberColumns,
+                            scaleFactor,
+                            multiplier,
+                            multiplierRowStride,
+                            multiplierColumnStride,
+                            multiplicand,
+                            multiplicandRowStride,
+                            multiplicandColumnStride,
+                            result,
+                            resultColumnSpacing
+                        );
+
+                        break;
+                    }
+
+                    default: {
+                        assert(false);
+                        break;
+                    }
+                }
+            }
+
+            /**
+             * Method that calculates \f$ Y = a \times op \left ( A \right ) + b \times op \left ( B \right ) \f$.
+             *
+             * \param[in] numberRows             The number of rows in Y.
+             *
+             * \param[in] numberColumns          The number of columns in Y.
+             *
+             * \param[in] augendScalar           The scale factor to apply to the augend, a.
+             *
+             * \param[in] augend                 The augend, A.
+             *
+             * \param[in] augendColumnSpacing    The column spacing of the augend, in entries.
+             *
+             * \param[in] augendTranspose        If true, the augend should be transposed.
+             *
+             * \param[in] addendScalar           The scale factor to apply to the addend, b.
+             *
+             * \param[in] addend                 The addend, B.
+             *
+             * \param[in] addendColumnSpacing    The column spacing of the addend, in entries.
+             *
+             * \param[in] addendTranspose        If true, the addend should be transposed.
+             *
+             * \param[in] result                 The location to receive the sum, Y.
+             *
+             * \param[in] resultColumnSpacing    The column spacing of the result, in entries.
+             */
+            static void scaleAdd(
+                    unsigned long      numberRows,
+                    unsigned long      numberColumns,
+                    const C&           augendScalar,
+                    const C*           augend,
+                    unsigned long long augendColumnSpacing,
+                    bool               augendTranspose,
+                    const C&           addendScalar,
+                    const C*           addend,
+                    unsigned long long addendColumnSpacing,
+                    bool               addendTranspose,
+                    C*                 result,
+                    unsigned long long resultColumnSpacing
+                ) {
+                unsigned long long augendRowStride    = augendTranspose ? augendColumnSpacing : 1;
+                unsigned long long augendColumnStride = augendTranspose ? 1 : augendColumnSpacing;
+                unsigned long long addendRowStride    = addendTranspose ? addendColumnSpacing : 1;
+                unsigned long long addendColumnStride = addendTranspose ? 1 : addendColumnSpacing;
+
+                for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+                    const C* augendColumn = augend + augendColumnStride * columnIndex;
+                    const C* addendColumn = addend + addendColumnStride * columnIndex;
+                    C*       resultColumn = result + resultColumnSpacing * columnIndex;
+
+                    for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                        resultColumn[rowIndex] = (
+                              augendScalar * augendColumn[augendRowStride * rowIndex]
+                            + addendScalar * addendColumn[addendRowStride * rowIndex]
+                        );
+                    }
+                }
+            }
+
+            /**
+             * Method that calculates \f$ Y = s \times op \left ( A \right ) \f$.
+             *
+             * \param[in] numberRows          The number of rows in Y.
+             *
+             * \param[in] numberColumns       The number of columns in Y.
+             *
+             * \param[in] scaleFactor         The scale factor to apply, s.
+             *
+             * \param[in] source              The source matrix, A.
+             *
+             * \param[in] sourceColumnSpacing The column spacing of the source, in entries.
+             *
+             * \param[in] transpose           If true, the source should be transposed.
+             *
+             * \param[in] result              The location to receive the result, Y.
+             *
+             * \param[in] resultColumnSpacing The column spacing of the result, in entries.
+             */
+            static void scaleCopy(
+                    unsigned long      numberRows,
+                    unsigned long      numberColumns,
+                    const C&           scaleFactor,
+                    const C*           source,
+                    unsigned long long sourceColumnSpacing,
+                    bool               transpose,
+                    C*                 result,
+                    unsigned long long resultColumnSpacing
+                ) {
+                unsigned long long sourceRowStride    = transpose ? sourceColumnSpacing : 1;
+                unsigned long long sourceColumnStride = transpose ? 1 : sourceColumnSpacing;
+
+                for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+                    const C* sourceColumn = source + sourceColumnStride * columnIndex;
+                    C*       resultColumn = result + resultColumnSpacing * columnIndex;
+
+                    for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                        resultColumn[rowIndex] = scaleFactor * sourceColumn[sourceRowStride * rowIndex];
+                    }
+                }
+            }
+
+            /**
+             * Method that calculates the determinant of a square matrix using an LU decomposition with partial
+             * pivoting.
+             *
+             * \param[in] source        The source matrix.
+             *
+             * \param[in] columnSpacing The column spacing of the source, in entries.
+             *
+             * \param[in] dimension     The number of rows and columns in the source matrix.
+             *
+             * \return Returns the determinant.  A value of 0 is returned if the matrix is singular.
+             */
+            static C determinant(const C* source, unsigned long long columnSpacing, unsigned long dimension) {
+                C result(0);
+
+                switch (dimension) {
+                    case 1: {
+                        result = determinantKernel<1>(source, columnSpacing);
+
+                        break;
+                    }
+
+                    case 2: {
+                        result = determinantKernel<2>(source, columnSpacing);
+
+                        break;
+                    }
+
+                    case 3: {
+                        result = determinantKernel<3>(source, columnSpacing);
+
+                        break;
+                    }
+
+                    case 4: {
+                        result = determinantKernel<4>(source, columnSpacing);
+
+                        break;
+                    }
+
+                    default: {
+                        assert(false);
+                        break;
+                    }
+                }
+
+                return result;
+            }
+
+            /**
+             * Method that calculates the inverse of a square matrix.
+             *
+             * \param[in] source              The source matrix.
+             *
+             * \param[in] sourceColumnSpacing The column spacing of the source, in entries.
+             *
+             * \param[in] dimension           The number of rows and columns in the source matrix.
+             *
+             * \param[in] result              The location to receive the inverse.
+             *
+             * \param[in] resultColumnSpacing The column spacing of the result, in entries.
+             *
+             * \return Returns true on success.  Returns false if the matrix is singular.
+             */
+            static bool inverse(
+                    const C*           source,
+                    unsigned long long sourceColumnSpacing,
+                    unsigned long      dimension,
+                    C*                 result,
+                    unsigned long long resultColumnSpacing
+                ) {
+                bool success = false;
+
+                switch (dimension) {
+                    case 1: {
+                        success = inverseKernel<1>(source, sourceColumnSpacing, result, resultColumnSpacing);
+
+                        break;
+                    }
+
+                    case 2: {
+                        success = inverseKernel<2>(source, sourceColumnSpacing, result, resultColumnSpacing);
+
+                        break;
+                    }
+
+                    case 3: {
+                        success = inverseKernel<3>(source, sourceColumnSpacing, result, resultColumnSpacing);
+
+                        break;
+                    }
+
+                    case 4: {
+                        success = inverseKernel<4>(source, sourceColumnSpacing, result, resultColumnSpacing);
+
+                        break;
+                    }
+
+                    default: {
+                        assert(false);
+                        break;
+                    }
+                }
+
+                return success;
+            }
+
+            /**
+             * Method that solves \f$ A X = Y \f$ for X.  The matrix Y can contain any number of columns.
+             *
+             * \param[in] a                The square matrix, A.
+             *
+             * \param[in] aColumnSpacing   The column spacing of A, in entries.
+             *
+             * \param[in] dimension        The number of rows and columns in A.
+             *
+             * \param[in] y                The matrix, Y.
+             *
+             * \param[in] yColumnSpacing   The column spacing of Y, in entries.
+             *
+             * \param[in] numberColumns    The number of columns in X and Y.
+             *
+             * \param[in] x                The location to receive the solution, X.
+             *
+             * \param[in] xColumnSpacing   The column spacing of X, in entries.
+             *
+             * \return Returns true on success.  Returns false if A is singular.
+             */
+            static bool solve(
+                    const C*           a,
+                    unsigned long long aColumnSpacing,
+                    unsigned long      dimension,
+                    const C*           y,
+                    unsigned long long yColumnSpacing,
+                    unsigned long      numberColumns,
+                    C*                 x,
+                    unsigned long long xColumnSpacing
+                ) {
+                bool success = false;
+
+                switch (dimension) {
+                    case 1: {
+                        success = solveKernel<1>(
+                            a,
+                            aColumnSpacing,
+                            y,
+                            yColumnSpacing,
+                            numberColumns,
+                            x,
+                            xColumnSpacing
+                        );
+
+                        break;
+                    }
+
+                    case 2: {
+                        success = solveKernel<2>(
+                            a,
+                            aColumnSpacing,
+                            y,
+                            yColumnSpacing,
+                            numberColumns,
+                            x,
+                            xColumnSpacing
+                        );
+
+                        break;
+                    }
+
+                    case 3: {
+                        success = solveKernel<3>(
+                            a,
+                            aColumnSpacing,
+                            y,
+                            yColumnSpacing,
+                            numberColumns,
+                            x,
+                            xColumnSpacing
+                        );
+
+                        break;
+                    }
+
+                    case 4: {
+                        success = solveKernel<4>(
+                            a,
+                            aColumnSpacing,
+                            y,
+                            yColumnSpacing,
+                            numberColumns,
+                            x,
+                            xColumnSpacing
+                        );
+
+                        break;
+                    }
+
+                    default: {
+                        assert(false);
+                        break;
+                    }
+                }
+
+                return success;
+            }
+
+        private:
+            /**
+             * Method that calculates the magnitude used to select pivots.
+             *
+             * \param[in] value The value to calculate the magnitude of.
+             *
+             * \return Returns the magnitude of the value.
+             */
+            static inline Real pivotMagnitude(Real value) {
+                return std::abs(value);
+            }
+
+            /**
+             * Method that calculates the magnitude used to select pivots.  As with LAPACK, the sum of the magnitudes
+             * of the real and imaginary components is used.
+             *
+             * \param[in] value The value to calculate the magnitude of.
+             *
+             * \return Returns the magnitude of the value.
+             */
+            static inline Real pivotMagnitude(const Complex& value) {
+                return std::abs(value.real()) + std::abs(value.imag());
+            }
+
+            /**
+             * Multiplication kernel for a fixed inner dimension.
+             *
+             * \param[in] K                        The inner dimension.
+             *
+             * \param[in] numberRows               The number of rows in the result.
+             *
+             * \param[in] numberColumns            The number of columns in the result.
+             *
+             * \param[in] scaleFactor              The scale factor to apply to the product.
+             *
+             * \param[in] multiplier               The multiplier.
+             *
+             * \param[in] multiplierRowStride      The distance between rows of the multiplier, in entries.
+             *
+             * \param[in] multiplierColumnStride   The distance between columns of the multiplier, in entries.
+             *
+             * \param[in] multiplicand             The multiplicand.
+             *
+             * \param[in] multiplicandRowStride    The distance between rows of the multiplicand, in entries.
+             *
+             * \param[in] multiplicandColumnStride The distance between columns of the multiplicand, in entries.
+             *
+             * \param[in] result                   The location to receive the product.
+             *
+             * \param[in] resultColumnSpacing      The column spacing of the result, in entries.
+             */
+            template<unsigned long K> static void multiplyKernel(
+                    unsigned long      numberRows,
+                    unsigned long      numberColumns,
+                    const C&           scaleFactor,
+                    const C*           multiplier,
+                    unsigned long long multiplierRowStride,
+                    unsigned long long multiplierColumnStride,
+                    const C*           multiplicand,
+                    unsigned long long multiplicandRowStride,
+                    unsigned long long multiplicandColumnStride,
+                    C*                 result,
+                    unsigned long long resultColumnSpacing
+                ) {
+                for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+                    const C* multiplicandColumn = multiplicand + multiplicandColumnStride * columnIndex;
+                    C*       resultColumn       = result + resultColumnSpacing * columnIndex;
+
+                    for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                        const C* multiplierRow = multiplier + multiplierRowStride * rowIndex;
+
+                        C sum = multiplierRow[0] * multiplicandColumn[0];
+                        for (unsigned long k=1 ; k<K ; ++k) {
+                            sum += (
+                                  multiplierRow[multiplierColumnStride * k]
+                                * multiplicandColumn[multiplicandRowStride * k]
+                            );
+                        }
+
+                        resultColumn[rowIndex] = scaleFactor * sum;
+                    }
+                }
+            }
+
+            /**
+             * Method that copies a square matrix into a local array, indexed by column and then row.
+             *
+             * \param[in]  N             The matrix dimension.
+             *
+             * \param[in]  source        The source matrix.
+             *
+             * \param[in]  columnSpacing The column spacing of the source, in entries.
+             *
+             * \param[out] destination   The array to receive the matrix.
+             */
+            template<unsigned long N> static inline void load(
+                    const C*           source,
+                    unsigned long long columnSpacing,
+                    C                  (&destination)[N][N]
+                ) {
+                for (unsigned long columnIndex=0 ; columnIndex<N ; ++columnIndex) {
+                    const C* sourceColumn = source + columnSpacing * columnIndex;
+                    for (unsigned long rowIndex=0 ; rowIndex<N ; ++rowIndex) {
+                        destination[columnIndex][rowIndex] = sourceColumn[rowIndex];
+                    }
+                }
+            }
+
+            /**
+             * Method that performs an in-place LU decomposition with partial pivoting.  The decomposition follows the
+             * same conventions as the LAPACK getrf functions.  The unit lower triangular matrix L is stored below the
+             * diagonal and the upper triangular matrix U is stored on and above the diagonal.
+             *
+             * \param[in]     N      The matrix dimension.
+             *
+             * \param[in,out] lu     The matrix to be decomposed, indexed by column and then row.
+             *
+             * \param[out]    pivots The row exchanged with each row during the decomposition.
+             *
+             * \return Returns true on success.  Returns false if the matrix is singular.
+             */
+            template<unsigned long N> static bool luDecompose(C (&lu)[N][N], unsigned long (&pivots)[N]) {
+                for (unsigned long k=0 ; k<N ; ++k) {
+                    unsigned long pivotRow     = k;
+                    Real          maximumValue = pivotMagnitude(lu[k][k]);
+
+                    for (unsigned long rowIndex=k+1 ; rowIndex<N ; ++rowIndex) {
+                        Real magnitude = pivotMagnitude(lu[k][rowIndex]);
+                        if (magnitude > maximumValue) {
+                            pivotRow     = rowIndex;
+                            maximumValue = magnitude;
+                        }
+                    }
+
+                    pivots[k] = pivotRow;
+                    if (maximumValue == 0) {
+                        return false;
+                    }
+
+                    if (pivotRow != k) {
+                        for (unsigned long columnIndex=0 ; columnIndex<N ; ++columnIndex) {
+                            std::swap(lu[columnIndex][k], lu[columnIndex][pivotRow]);
+                        }
+                    }
+
+                    C reciprocal = C(1) / lu[k][k];
+                    for (unsigned long rowIndex=k+1 ; rowIndex<N ; ++rowIndex) {
+                        lu[k][rowIndex] *= reciprocal;
+                    }
+
+                    for (unsigned long columnIndex=k+1 ; columnIndex<N ; ++columnIndex) {
+                        C factor = lu[columnIndex][k];
+                        for (unsigned long rowIndex=k+1 ; rowIndex<N ; ++rowIndex) {
+                            lu[columnIndex][rowIndex] -= lu[k][rowIndex] * factor;
+                        }
+                    }
+                }
+
+                return true;
+            }
+
+            /**
+             * Method that solves \f$ L U x = P b \f$ in place using a previously calculated LU decomposition.
+             *
+             * \param[in]     N      The matrix dimension.
+             *
+             * \param[in]     lu     The LU decomposition, indexed by column and then row.
+             *
+             * \param[in]     pivots The pivot operations performed during the decomposition.
+             *
+             * \param[in,out] b      The right hand side.  The solution is returned in place.
+             */
+            template<unsigned long N> static void luSolve(
+                    const C             (&lu)[N][N],
+                    const unsigned long (&pivots)[N],
+                    C                   (&b)[N]
+                ) {
+                for (unsigned long k=0 ; k<N ; ++k) {
+                    if (pivots[k] != k) {
+                        std::swap(b[k], b[pivots[k]]);
+                    }
+                }
+
+                for (unsigned long k=0 ; k<N ; ++k) {
+                    for (unsigned long rowIndex=k+1 ; rowIndex<N ; ++rowIndex) {
+                        b[rowIndex] -= lu[k][rowIndex] * b[k];
+                    }
+                }
+
+                for (unsigned long j=N ; j>0 ; --j) {
+                    unsigned long k = j - 1;
+                    b[k] /= lu[k][k];
+                    for (unsigned long rowIndex=0 ; rowIndex<k ; ++rowIndex) {
+                        b[rowIndex] -= lu[k][rowIndex] * b[k];
+                    }
+                }
+            }
+
+            /**
+             * Determinant kernel for a fixed dimension.
+             *
+             * \param[in] N             The matrix dimension.
+             *
+             * \param[in] source        The source matrix.
+             *
+             * \param[in] columnSpacing The column spacing of the source, in entries.
+             *
+             * \return Returns the determinant.
+             */
+            template<unsigned long N> static C determinantKernel(const C* source, unsigned long long columnSpacing) {
+                C             lu[N][N];
+                unsigned long pivots[N];
+
+                load<N>(source, columnSpacing, lu);
+
+                C result(0);
+                if (luDecompose<N>(lu, pivots)) {
+                    result = lu[0][0];
+                    for (unsigned long k=1 ; k<N ; ++k) {
+                        result *= lu[k][k];
+                    }
+
+                    for (unsigned long k=0 ; k<N ; ++k) {
+                        if (pivots[k] != k) {
+                            result = -result;
+                        }
+                    }
+                }
+
+                return result;
+            }
+
+            /**
+             * Inverse kernel for a fixed dimension.
+             *
+             * \param[in] N                   The matrix dimension.
+             *
+             * \param[in] source              The source matrix.
+             *
+             * \param[in] sourceColumnSpacing The column spacing of the source, in entries.
+             *
+             * \param[in] result              The location to receive the inverse.
+             *
+             * \param[in] resultColumnSpacing The column spacing of the result, in entries.
+             *
+             * \return Returns true on success.  Returns false if the matrix is singular.
+             */
+            template<unsigned long N> static bool inverseKernel(
+                    const C*           source,
+                    unsigned long long sourceColumnSpacing,
+                    C*                 result,
+                    unsigned long long resultColumnSpacing
+                ) {
+                C             lu[N][N];
+                unsigned long pivots[N];
+
+                load<N>(source, sourceColumnSpacing, lu);
+
+                bool success = luDecompose<N>(lu, pivots);
+                if (success) {
+                    for (unsigned long columnIndex=0 ; columnIndex<N ; ++columnIndex) {
+                        C column[N];
+                        for (unsigned long rowIndex=0 ; rowIndex<N ; ++rowIndex) {
+                            column[rowIndex] = C(rowIndex == columnIndex ? 1 : 0);
+                        }
+
+                        luSolve<N>(lu, pivots, column);
+
+                        C* resultColumn = result + resultColumnSpacing * columnIndex;
+                        for (unsigned long rowIndex=0 ; rowIndex<N ; ++rowIndex) {
+                            resultColumn[rowIndex] = column[rowIndex];
+                        }
+                    }
+                }
+
+                return success;
+            }
+
+            /**
+             * Solver kernel for a fixed dimension.
+             *
+             * \param[in] N              The dimension of A.
+             *
+             * \param[in] a              The square matrix, A.
+             *
+             * \param[in] aColumnSpacing The column spacing of A, in entries.
+             *
+             * \param[in] y              The matrix, Y.
+             *
+             * \param[in] yColumnSpacing The column spacing of Y, in entries.
+             *
+             * \param[in] numberColumns  The number of columns in X and Y.
+             *
+             * \param[in] x              The location to receive the solution, X.
+             *
+             * \param[in] xColumnSpacing The column spacing of X, in entries.
+             *
+             * \return Returns true on success.  Returns false if A is singular.
+             */
+            template<unsigned long N> static bool solveKernel(
+                    const C*           a,
+                    unsigned long long aColumnSpacing,
+                    const C*           y,
+                    unsigned long long yColumnSpacing,
+                    unsigned long      numberColumns,
+                    C*                 x,
+                    unsigned long long xColumnSpacing
+                ) {
+                C             lu[N][N];
+                unsigned long pivots[N];
+
+                load<N>(a, aColumnSpacing, lu);
+
+                bool success = luDecompose<N>(lu, pivots);
+                if (success) {
+                    for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+                        const C* yColumn = y + yColumnSpacing * columnIndex;
+                        C*       xColumn = x + xColumnSpacing * columnIndex;
+
+                        C column[N];
+                        for (unsigned long rowIndex=0 ; rowIndex<N ; ++rowIndex) {
+                            column[rowIndex] = yColumn[rowIndex];
+                        }
+
+                        luSolve<N>(lu, pivots, column);
+
+                        for (unsigned long rowIndex=0 ; rowIndex<N ; ++rowIndex) {
+                            xColumn[rowIndex] = column[rowIndex];
+                        }
+                    }
+                }
+
+                return success;
+            }
+    };
+}
+
+#endif
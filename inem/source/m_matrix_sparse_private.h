@@ -1,6 +1,6 @@
 /*-*-c++-*-*************************************************************************************************************
 * Copyright 2016 - 2022 Inesonic, LLC.
-* 
+*
 * This file is licensed under two licenses.
 *
 * Inesonic Commercial License, Version 1:
@@ -12,11 +12,11 @@
 *   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
 *   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
 *   version.
-*   
+*
 *   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
 *   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
 *   details.
-*   
+*
 *   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
 *   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 ********************************************************************************************************************//**
@@ -30,16 +30,985 @@
 #ifndef M_MATRIX_SPARSE_PRIVATE_H
 #define M_MATRIX_SPARSE_PRIVATE_H
 
+#include <new>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#include "model_exceptions.h"
+#include "m_matrix_dense_private.h"
+#include "m_matrix_sparse_private_base.h"
+
 namespace M {
     /**
      * Private implementation of the \ref M::MatrixSparsePrivate template class.  This class provides generic support
-     * for sparse matrices.
+     * for sparse matrices stored in compressed sparse column format.
      *
      * You should use this class primary as an input parameter to method that operate on sparse matrices.
      *
      * \param[in] C The scalar type to be contained in this matrix.
      */
-    template<typename C> class MatrixSparsePrivate {
+    template<typename C> class MatrixSparsePrivate:public MatrixSparsePrivateBase {
+        protected:
+            /**
+             * Constructor
+             *
+             * \param[in] newNumberRows    The new number of rows.
+             *
+             * \param[in] newNumberColumns The new number of columns.
+             *
+             * \param[in] newCapacity      The initial entry capacity.
+             */
+            MatrixSparsePrivate(
+                    unsigned long      newNumberRows,
+                    unsigned long      newNumberColumns,
+                    unsigned long long newCapacity
+                ):MatrixSparsePrivateBase(
+                    newNumberRows,
+                    newNumberColumns,
+                    newCapacity,
+                    sizeof(C)
+                ) {}
+
+            /**
+             * Constructor
+             *
+             * \param[in] other The instance to be copied to this instance.
+             */
+            MatrixSparsePrivate(const MatrixSparsePrivate<C>& other):MatrixSparsePrivateBase(other) {}
+
+            /**
+             * Constructor
+             *
+             * \param[in] other            The instance to be copied to this instance.
+             *
+             * \param[in] newNumberRows    The new number of rows.
+             *
+             * \param[in] newNumberColumns The new number of columns.
+             */
+            MatrixSparsePrivate(
+                    const MatrixSparsePrivate<C>& other,
+                    unsigned long                 newNumberRows,
+                    unsigned long                 newNumberColumns
+                ):MatrixSparsePrivateBase(
+                    other,
+                    newNumberRows,
+                    newNumberColumns
+                ) {}
+
+        public:
+            /**
+             * Type used to represent the scalar value used as the coefficients of this matrix.
+             */
+            typedef C Scalar;
+
+            /**
+             * Method you can use to obtain the value at a specific location.
+             *
+             * \param[in] rowIndex    The zero based row index we want the entry from.
+             *
+             * \param[in] columnIndex The zero based column index we want the entry from.
+             *
+             * \return Returns the value at the requested location.  Entries that are not stored are reported as zero.
+             */
+            C at(unsigned long rowIndex, unsigned long columnIndex) const {
+                unsigned long long entryIndex = find(rowIndex, columnIndex);
+                return entryIndex == invalidEntry ? C(0) : values()[entryIndex];
+            }
+
+            /**
+             * Method you can use to obtain a reference to the data at a specific location.  The entry will be inserted
+             * into the matrix if it is not already stored.
+             *
+             * \param[in] rowIndex    The zero based row index we want the entry from.
+             *
+             * \param[in] columnIndex The zero based column index we want the entry from.
+             *
+             * \return Returns a reference to the requested value.
+             */
+            C& at(unsigned long rowIndex, unsigned long columnIndex) {
+                unsigned long long entryIndex = findOrInsert(rowIndex, columnIndex);
+                return values()[entryIndex];
+            }
+
+            /**
+             * Method you can use to obtain the array of stored values.
+             *
+             * \return Returns a pointer to the stored values.
+             */
+            inline const C* values() const {
+                return reinterpret_cast<const C*>(currentValues);
+            }
+
+            /**
+             * Method you can use to obtain the array of stored values.
+             *
+             * \return Returns a pointer to the stored values.
+             */
+            inline C* values() {
+                return reinterpret_cast<C*>(currentValues);
+            }
+
+            /**
+             * Method you can use to destroy a previously allocated instance derived from this class.
+             *
+             * \param[in] instance The instance to be destroyed.
+             */
+            template<typename D> static void destroy(D* instance) {
+                instance->~D();
+                releaseMemory(instance);
+            }
+
+            /**
+             * Method you can use to write this matrix into a dense matrix.  The destination is expected to be zeroed
+             * and must have the same dimensions as this matrix.
+             *
+             * \param[in] destination The dense matrix to receive the values.
+             */
+            void scatterInto(MatrixDensePrivate<C>& destination) const {
+                C*                 d             = destination.data();
+                unsigned long long columnSpacing = destination.columnSpacingInMemory();
+                const C*           v             = values();
+
+                for (unsigned long columnIndex=0 ; columnIndex<currentNumberColumns ; ++columnIndex) {
+                    C*                 column = d + columnSpacing * columnIndex;
+                    unsigned long long end    = currentColumnStarts[columnIndex + 1];
+                    for (unsigned long long i=currentColumnStarts[columnIndex] ; i<end ; ++i) {
+                        column[currentRowIndexes[i]] = v[i];
+                    }
+                }
+            }
+
+            /**
+             * Method you can use to accumulate a scaled, and optionally transposed, copy of this matrix into a dense
+             * matrix.
+             *
+             * \param[in] destination The dense matrix to accumulate into.  The matrix dimensions must match the
+             *                        dimensions of this matrix after the transpose is applied.
+             *
+             * \param[in] transpose   If true, this matrix will be transposed before being accumulated.
+             *
+             * \param[in] scaleFactor The scale factor to apply to each entry.
+             */
+            void accumulateInto(MatrixDensePrivate<C>& destination, bool transpose, C scaleFactor) const {
+                C*                 d             = destination.data();
+                unsigned long long columnSpacing = destination.columnSpacingInMemory();
+                const C*           v             = values();
+
+                for (unsigned long columnIndex=0 ; columnIndex<currentNumberColumns ; ++columnIndex) {
+                    unsigned long long end = currentColumnStarts[columnIndex + 1];
+                    for (unsigned long long i=currentColumnStarts[columnIndex] ; i<end ; ++i) {
+                        unsigned long rowIndex = currentRowIndexes[i];
+                        if (transpose) {
+                            d[columnSpacing * rowIndex + columnIndex] += scaleFactor * v[i];
+                        } else {
+                            d[columnSpacing * columnIndex + rowIndex] += scaleFactor * v[i];
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Method that multiplies this sparse matrix by a dense matrix, placing the result into a zeroed dense
+             * matrix.
+             *
+             * \param[in] multiplicand          The dense multiplicand.
+             *
+             * \param[in] multiplierTranspose   If true, this matrix should be transposed.
+             *
+             * \param[in] multiplicandTranspose If true, the multiplicand should be transposed.
+             *
+             * \param[in] scaleFactor           A scale factor to apply to the product.
+             *
+             * \param[in] product               The zeroed dense matrix to receive the product.
+             */
+            void multiplyDenseInto(
+                    const MatrixDensePrivate<C>& multiplicand,
+                    bool                         multiplierTranspose,
+                    bool                         multiplicandTranspose,
+                    C                            scaleFactor,
+                    MatrixDensePrivate<C>&       product
+                ) const {
+                const C*           b              = multiplicand.data();
+                unsigned long long bSpacing       = multiplicand.columnSpacingInMemory();
+                unsigned long long bRowStride     = multiplicandTranspose ? bSpacing : 1;
+                unsigned long long bColumnStride  = multiplicandTranspose ? 1 : bSpacing;
+                C*                 y              = product.data();
+                unsigned long long ySpacing       = product.columnSpacingInMemory();
+                unsigned long      productColumns = product.numberColumns();
+                const C*           v              = values();
+
+                if (multiplierTranspose) {
+                    // y(i, j) = sum over k of a(k, i) * b(k, j) -- A dot product of each stored column against each
+                    // multiplicand column.
+                    for (unsigned long j=0 ; j<productColumns ; ++j) {
+                        const C* bColumn = b + bColumnStride * j;
+                        C*       yColumn = y + ySpacing * j;
+                        for (unsigned long i=0 ; i<currentNumberColumns ; ++i) {
+                            C                  sum = C(0);
+                            unsigned long long end = currentColumnStarts[i + 1];
+                            for (unsigned long long e=currentColumnStarts[i] ; e<end ; ++e) {
+                                sum += v[e] * bColumn[bRowStride * currentRowIndexes[e]];
+                            }
+
+                            yColumn[i] = scaleFactor * sum;
+                        }
+                    }
+                } else {
+                    // y(:, j) = sum over k of a(:, k) * b(k, j) -- Scatter each stored column scaled by the matching
+                    // multiplicand coefficient.
+                    for (unsigned long j=0 ; j<productColumns ; ++j) {
+                        const C* bColumn = b + bColumnStride * j;
+                        C*       yColumn = y + ySpacing * j;
+                        for (unsigned long k=0 ; k<currentNumberColumns ; ++k) {
+                            C bkj = bColumn[bRowStride * k];
+                            if (bkj != C(0)) {
+                                C                  s   = scaleFactor * bkj;
+                                unsigned long long end = currentColumnStarts[k + 1];
+                                for (unsigned long long e=currentColumnStarts[k] ; e<end ; ++e) {
+                                    yColumn[currentRowIndexes[e]] += s * v[e];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Method that multiplies a dense matrix by this sparse matrix, placing the result into a zeroed dense
+             * matrix.
+             *
+             * \param[in] multiplier            The dense multiplier.
+             *
+             * \param[in] multiplierTranspose   If true, the multiplier should be transposed.
+             *
+             * \param[in] multiplicandTranspose If true, this matrix should be transposed.
+             *
+             * \param[in] scaleFactor           A scale factor to apply to the product.
+             *
+             * \param[in] product               The zeroed dense matrix to receive the product.
+             */
+            void multiplyDenseByThisInto(
+                    const MatrixDensePrivate<C>& multiplier,
+                    bool                         multiplierTranspose,
+                    bool                         multiplicandTranspose,
+                    C                            scaleFactor,
+                    MatrixDensePrivate<C>&       product
+                ) const {
+                const C*           a             = multiplier.data();
+                unsigned long long aSpacing      = multiplier.columnSpacingInMemory();
+                unsigned long long aRowStride    = multiplierTranspose ? aSpacing : 1;
+                unsigned long long aColumnStride = multiplierTranspose ? 1 : aSpacing;
+                C*                 y             = product.data();
+                unsigned long long ySpacing      = product.columnSpacingInMemory();
+                unsigned long      productRows   = product.numberRows();
+                const C*           v             = values();
+
+                for (unsigned long k=0 ; k<currentNumberColumns ; ++k) {
+                    unsigned long long end = currentColumnStarts[k + 1];
+                    for (unsigned long long e=currentColumnStarts[k] ; e<end ; ++e) {
+                        // Entry (r, k) of this matrix.  Without a transpose it contributes a(:, r) to y(:, k).  With a
+                        // transpose it contributes a(:, k) to y(:, r).
+                        unsigned long r              = currentRowIndexes[e];
+                        unsigned long aColumnIndex   = multiplicandTranspose ? k : r;
+                        unsigned long yColumnIndex   = multiplicandTranspose ? r : k;
+                        C             s              = scaleFactor * v[e];
+                        const C*      aColumn        = a + aColumnStride * aColumnIndex;
+                        C*            yColumn        = y + ySpacing * yColumnIndex;
+
+                        for (unsigned long i=0 ; i<productRows ; ++i) {
+                            yColumn[i] += s * aColumn[aRowStride * i];
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Method that compares this matrix against another sparse matrix.
+             *
+             * \param[in] other The matrix to compare against.
+             *
+             * \return Returns true if the matrices hold the same values.  Returns false if the matrices differ.
+             */
+            bool isEqualTo(const MatrixSparsePrivate<C>& other) const {
+                bool matches = (
+                       currentNumberRows == other.currentNumberRows
+                    && currentNumberColumns == other.currentNumberColumns
+                );
+
+                unsigned long columnIndex = 0;
+                while (matches && columnIndex < currentNumberColumns) {
+                    matches = (compareColumns(other, columnIndex, false) == 0);
+                    ++columnIndex;
+                }
+
+                return matches;
+            }
+
+            /**
+             * Method that compares this matrix against a dense matrix.
+             *
+             * \param[in] other The matrix to compare against.
+             *
+             * \return Returns true if the matrices hold the same values.  Returns false if the matrices differ.
+             */
+            bool isEqualTo(const MatrixDensePrivate<C>& other) const {
+                bool matches = (
+                       currentNumberRows == other.numberRows()
+                    && currentNumberColumns == other.numberColumns()
+                );
+
+                const C*           d             = other.data();
+                unsigned long long columnSpacing = other.columnSpacingInMemory();
+                const C*           v             = values();
+
+                unsigned long columnIndex = 0;
+                while (matches && columnIndex < currentNumberColumns) {
+                    const C*           column = d + columnSpacing * columnIndex;
+                    unsigned long long e      = currentColumnStarts[columnIndex];
+                    unsigned long long end    = currentColumnStarts[columnIndex + 1];
+                    unsigned long      r      = 0;
+
+                    while (matches && r < currentNumberRows) {
+                        if (e < end && currentRowIndexes[e] == r) {
+                            matches = (column[r] == v[e]);
+                            ++e;
+                        } else {
+                            matches = (column[r] == C(0));
+                        }
+
+                        ++r;
+                    }
+
+                    ++columnIndex;
+                }
+
+                return matches;
+            }
+
+            /**
+             * Method you can call to determine the recommended ordering of this matrix relative to another sparse
+             * matrix.  The ordering matches the ordering used for dense matrices holding the same values.
+             *
+             * \param[in] other The other matrix to compare against.
+             *
+             * \return Returns a negative value if this matrix should precede the other matrix.  Returns 0 if the
+             *         matrices are equal.  Returns a positive value if this matrix should follow the other matrix.
+             */
+            int relativeOrder(const MatrixSparsePrivate<C>& other) const {
+                int result;
+
+                if (currentNumberRows != other.currentNumberRows) {
+                    result = currentNumberRows < other.currentNumberRows ? -1 : +1;
+                } else if (currentNumberColumns != other.currentNumberColumns) {
+                    result = currentNumberColumns < other.currentNumberColumns ? -1 : +1;
+                } else {
+                    result = 0;
+
+                    unsigned long columnIndex = 0;
+                    while (result == 0 && columnIndex < currentNumberColumns) {
+                        result = compareColumns(other, columnIndex, true);
+                        ++columnIndex;
+                    }
+                }
+
+                return result;
+            }
+
+            /**
+             * Method you can call to build an instance derived from this template class from a sparse matrix holding a
+             * different coefficient type.  Entries that convert to zero are discarded.
+             *
+             * \param[in] other    The sparse matrix to be converted.
+             *
+             * \param[in] function The function used to convert each stored value.
+             *
+             * \return Returns a pointer to the newly created instance.
+             */
+            template<typename D, typename S, typename F> static D* createConverted(
+                    const MatrixSparsePrivate<S>& other,
+                    F                             function
+                ) {
+                unsigned long             numberColumns = other.numberColumns();
+                const unsigned long long* starts        = other.columnStarts();
+                const unsigned long*      rows          = other.rowIndexes();
+                const S*                  v             = other.values();
+
+                D* result = create<D>(other.numberRows(), numberColumns, other.numberNonZeros());
+                for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+                    unsigned long long end = starts[columnIndex + 1];
+                    for (unsigned long long i=starts[columnIndex] ; i<end ; ++i) {
+                        C value = function(v[i]);
+                        if (value != C(0)) {
+                            new(result->appendEntry(rows[i])) C(value);
+                        }
+                    }
+
+                    result->closeColumn(columnIndex);
+                }
+
+                return result;
+            }
+
+        protected:
+            /**
+             * Method you can call to allocate an instance derived from this template class.
+             *
+             * \param[in] newNumberRows    The new number of rows.
+             *
+             * \param[in] newNumberColumns The new number of columns.
+             *
+             * \param[in] newCapacity      The initial entry capacity.
+             *
+             * \return Returns a pointer to the newly created instance.
+             */
+            template<typename D> static D* create(
+                    unsigned long      newNumberRows,
+                    unsigned long      newNumberColumns,
+                    unsigned long long newCapacity = 0
+                ) {
+                // The entry arrays are allocated separately so the class instance itself needs no trailing storage.
+                void* unused;
+                void* p = allocateMemory(unused, sizeof(D), 0);
+
+                return new(p) D(newNumberRows, newNumberColumns, newCapacity);
+            }
+
+            /**
+             * Method you can call to allocate a copy of an instance derived from this template class.
+             *
+             * \param[in] other The instance to make a copy of.
+             *
+             * \return Returns a pointer to the newly created instance.
+             */
+            template<typename D> static D* create(const D& other) {
+                void* unused;
+                void* p = allocateMemory(unused, sizeof(D), 0);
+
+                return new(p) D(other);
+            }
+
+            /**
+             * Method you can call to allocate a resized copy of an instance derived from this template class.
+             *
+             * \param[in] other            The instance to make a copy of.
+             *
+             * \param[in] newNumberRows    The new number of rows.
+             *
+             * \param[in] newNumberColumns The new number of columns.
+             *
+             * \return Returns a pointer to the newly created instance.
+             */
+            template<typename D> static D* create(
+                    const D&      other,
+                    unsigned long newNumberRows,
+                    unsigned long newNumberColumns
+                ) {
+                void* unused;
+                void* p = allocateMemory(unused, sizeof(D), 0);
+
+                return new(p) D(other, newNumberRows, newNumberColumns);
+            }
+
+            /**
+             * Method you can call to build an instance derived from this template class from a dense matrix.  Only
+             * non-zero values are stored.
+             *
+             * \param[in] other The dense matrix to be converted.
+             *
+             * \return Returns a pointer to the newly created instance.
+             */
+            template<typename D> static D* createFromDense(const MatrixDensePrivate<C>& other) {
+                unsigned long      numberRows    = other.numberRows();
+                unsigned long      numberColumns = other.numberColumns();
+                const C*           d             = other.data();
+                unsigned long long columnSpacing = other.columnSpacingInMemory();
+
+                D* result = create<D>(numberRows, numberColumns, other.numberNonZeros());
+                for (unsigned long columnIndex=0 ; columnIndex<numberColumns ; ++columnIndex) {
+                    const C* column = d + columnSpacing * columnIndex;
+                    for (unsigned long rowIndex=0 ; rowIndex<numberRows ; ++rowIndex) {
+                        C value = column[rowIndex];
+                        if (value != C(0)) {
+                            new(result->appendEntry(rowIndex)) C(value);
+                        }
+                    }
+
+                    result->closeColumn(columnIndex);
+                }
+
+                return result;
+            }
+
+            /**
+             * Method that applies a transpose and scale factor to this matrix.
+             *
+             * \param[in] transpose   If true, the result will be transposed.
+             *
+             * \param[in] scaleFactor The scale factor to apply.
+             *
+             * \return Returns a newly created instance holding the result.
+             */
+            template<typename D> D* transformAndScale(bool transpose, C scaleFactor) const {
+                D* result;
+
+                if (transpose) {
+                    result = create<D>(currentNumberColumns, currentNumberRows, currentNumberEntries);
+                    transposeInto(*result);
+                } else {
+                    result = create<D>(*static_cast<const D*>(this));
+                }
+
+                if (scaleFactor != C(1)) {
+                    C*                 v   = result->values();
+                    unsigned long long end = result->numberNonZeros();
+                    for (unsigned long long i=0 ; i<end ; ++i) {
+                        v[i] = scaleFactor * v[i];
+                    }
+                }
+
+                return result;
+            }
+
+            /**
+             * Method that applies a function to each stored value, discarding any entries that become zero.  The
+             * function must map zero to zero.
+             *
+             * \param[in] function The function to apply.
+             *
+             * \return Returns a newly created instance holding the result.
+             */
+            template<typename D, typename F> D* map(F function) const {
+                D*       result = create<D>(currentNumberRows, currentNumberColumns, currentNumberEntries);
+                const C* v      = values();
+
+                for (unsigned long columnIndex=0 ; columnIndex<currentNumberColumns ; ++columnIndex) {
+                    unsigned long long end = currentColumnStarts[columnIndex + 1];
+                    for (unsigned long long i=currentColumnStarts[columnIndex] ; i<end ; ++i) {
+                        C value = function(v[i]);
+                        if (value != C(0)) {
+                            new(result->appendEntry(currentRowIndexes[i])) C(value);
+                        }
+                    }
+
+                    result->closeColumn(columnIndex);
+                }
+
+                return result;
+            }
+
+            /**
+             * Method that calculates the weighted sum of this matrix and another sparse matrix.
+             *
+             * \param[in] addend          The addend.
+             *
+             * \param[in] augendTranspose If true, this matrix should be transposed.
+             *
+             * \param[in] addendTranspose If true, the addend should be transposed.
+             *
+             * \param[in] augendScalar    Scale factor to apply to this matrix.
+             *
+             * \param[in] addendScalar    Scale factor to apply to the addend.
+             *
+             * \return Returns a newly created instance holding the sum.
+             */
+            template<typename D> D* add(
+                    const MatrixSparsePrivate<C>& addend,
+                    bool                          augendTranspose,
+                    bool                          addendTranspose,
+                    C                             augendScalar,
+                    C                             addendScalar
+                ) const {
+                unsigned long augendRows    = augendTranspose ? currentNumberColumns : currentNumberRows;
+                unsigned long augendColumns = augendTranspose ? currentNumberRows : currentNumberColumns;
+                unsigned long addendRows    = addendTranspose ? addend.currentNumberColumns : addend.currentNumberRows;
+                unsigned long addendColumns = addendTranspose ? addend.currentNumberRows : addend.currentNumberColumns;
+
+                if (augendRows != addendRows || augendColumns != addendColumns) {
+                    throw Model::IncompatibleMatrixDimensions(augendRows, augendColumns, addendRows, addendColumns);
+                }
+
+                const MatrixSparsePrivate<C>* a = augendTranspose ? transposed<D>() : this;
+                const MatrixSparsePrivate<C>* b = addendTranspose ? addend.template transposed<D>() : &addend;
+
+                D* result = create<D>(augendRows, augendColumns, a->currentNumberEntries + b->currentNumberEntries);
+
+                const C* av = a->values();
+                const C* bv = b->values();
+
+                for (unsigned long columnIndex=0 ; columnIndex<augendColumns ; ++columnIndex) {
+                    unsigned long long ai   = a->currentColumnStarts[columnIndex];
+                    unsigned long long aEnd = a->currentColumnStarts[columnIndex + 1];
+                    unsigned long long bi   = b->currentColumnStarts[columnIndex];
+                    unsigned long long bEnd = b->currentColumnStarts[columnIndex + 1];
+
+                    while (ai < aEnd || bi < bEnd) {
+                        unsigned long rowIndex;
+                        C             value;
+
+                        if (bi >= bEnd || (ai < aEnd && a->currentRowIndexes[ai] < b->currentRowIndexes[bi])) {
+                            rowIndex = a->currentRowIndexes[ai];
+                            value    = augendScalar * av[ai];
+                            ++ai;
+                        } else if (ai >= aEnd || b->currentRowIndexes[bi] < a->currentRowIndexes[ai]) {
+                            rowIndex = b->currentRowIndexes[bi];
+                            value    = addendScalar * bv[bi];
+                            ++bi;
+                        } else {
+                            rowIndex = a->currentRowIndexes[ai];
+                            value    = augendScalar * av[ai] + addendScalar * bv[bi];
+                            ++ai;
+                            ++bi;
+                        }
+
+                        if (value != C(0)) {
+                            new(result->appendEntry(rowIndex)) C(value);
+                        }
+                    }
+
+                    result->closeColumn(columnIndex);
+                }
+
+                releaseTransposed<D>(a, this);
+                releaseTransposed<D>(b, &addend);
+
+                return result;
+            }
+
+            /**
+             * Method that multiplies this matrix by another sparse matrix.  The product is calculated column by
+             * column using Gustavson's algorithm.
+             *
+             * \param[in] multiplicand          The multiplicand.
+             *
+             * \param[in] multiplierTranspose   If true, this matrix should be transposed.
+             *
+             * \param[in] multiplicandTranspose If true, the multiplicand should be transposed.
+             *
+             * \param[in] scaleFactor           A scale factor to apply to the product.
+             *
+             * \return Returns a newly created instance holding the product.
+             */
+            template<typename D> D* multiply(
+                    const MatrixSparsePrivate<C>& multiplicand,
+                    bool                          multiplierTranspose,
+                    bool                          multiplicandTranspose,
+                    C                             scaleFactor
+                ) const {
+                unsigned long multiplierRows      = multiplierTranspose ? currentNumberColumns : currentNumberRows;
+                unsigned long multiplierColumns   = multiplierTranspose ? currentNumberRows : currentNumberColumns;
+                unsigned long multiplicandRows    = (
+                      multiplicandTranspose
+                    ? multiplicand.currentNumberColumns
+                    : multiplicand.currentNumberRows
+                );
+                unsigned long multiplicandColumns = (
+                      multiplicandTranspose
+                    ? multiplicand.currentNumberRows
+                    : multiplicand.currentNumberColumns
+                );
+
+                if (multiplierColumns != multiplicandRows) {
+                    throw Model::IncompatibleMatrixDimensions(
+                        multiplierRows,
+                        multiplierColumns,
+                        multiplicandRows,
+                        multiplicandColumns
+                    );
+                }
+
+                const MatrixSparsePrivate<C>* a = multiplierTranspose ? transposed<D>() : this;
+                const MatrixSparsePrivate<C>* b = (
+                      multiplicandTranspose
+                    ? multiplicand.template transposed<D>()
+                    : &multiplicand
+                );
+
+                D* result = create<D>(
+                    multiplierRows,
+                    multiplicandColumns,
+                    a->currentNumberEntries + b->currentNumberEntries
+                );
+
+                const C* av = a->values();
+                const C* bv = b->values();
+
+                std::vector<C>                  accumulator(multiplierRows);
+                std::vector<unsigned long long> marker(multiplierRows, invalidEntry);
+                std::vector<unsigned long>      pattern;
+
+                for (unsigned long j=0 ; j<multiplicandColumns ; ++j) {
+                    pattern.clear();
+
+                    unsigned long long bEnd = b->currentColumnStarts[j + 1];
+                    for (unsigned long long bi=b->currentColumnStarts[j] ; bi<bEnd ; ++bi) {
+                        unsigned long      k    = b->currentRowIndexes[bi];
+                        C                  bkj  = bv[bi];
+                        unsigned long long aEnd = a->currentColumnStarts[k + 1];
+
+                        for (unsigned long long ai=a->currentColumnStarts[k] ; ai<aEnd ; ++ai) {
+                            unsigned long i = a->currentRowIndexes[ai];
+                            if (marker[i] != j) {
+                                marker[i]      = j;
+                                accumulator[i] = av[ai] * bkj;
+                                pattern.push_back(i);
+                            } else {
+                                accumulator[i] += av[ai] * bkj;
+                            }
+                        }
+                    }
+
+                    std::sort(pattern.begin(), pattern.end());
+                    for (unsigned long i : pattern) {
+                        C value = scaleFactor * accumulator[i];
+                        if (value != C(0)) {
+                            new(result->appendEntry(i)) C(value);
+                        }
+                    }
+
+                    result->closeColumn(j);
+                }
+
+                releaseTransposed<D>(a, this);
+                releaseTransposed<D>(b, &multiplicand);
+
+                return result;
+            }
+
+            /**
+             * Method that calculates the Hadamard product of this matrix and another sparse matrix.
+             *
+             * \param[in] other The matrix to multiply against.
+             *
+             * \return Returns a newly created instance holding the product.
+             */
+            template<typename D> D* hadamard(const MatrixSparsePrivate<C>& other) const {
+                if (currentNumberRows    != other.currentNumberRows   ||
+                    currentNumberColumns != other.currentNumberColumns    ) {
+                    throw Model::IncompatibleMatrixDimensions(
+                        currentNumberRows,
+                        currentNumberColumns,
+                        other.currentNumberRows,
+                        other.currentNumberColumns
+                    );
+                }
+
+                D* result = create<D>(
+                    currentNumberRows,
+                    currentNumberColumns,
+                    std::min(currentNumberEntries, other.currentNumberEntries)
+                );
+
+                const C* av = values();
+                const C* bv = other.values();
+
+                for (unsigned long columnIndex=0 ; columnIndex<currentNumberColumns ; ++columnIndex) {
+                    unsigned long long ai   = currentColumnStarts[columnIndex];
+                    unsigned long long aEnd = currentColumnStarts[columnIndex + 1];
+                    unsigned long long bi   = other.currentColumnStarts[columnIndex];
+                    unsigned long long bEnd = other.currentColumnStarts[columnIndex + 1];
+
+                    while (ai < aEnd && bi < bEnd) {
+                        unsigned long aRow = currentRowIndexes[ai];
+                        unsigned long bRow = other.currentRowIndexes[bi];
+
+                        if (aRow < bRow) {
+                            ++ai;
+                        } else if (bRow < aRow) {
+                            ++bi;
+                        } else {
+                            C value = av[ai] * bv[bi];
+                            if (value != C(0)) {
+                                new(result->appendEntry(aRow)) C(value);
+                            }
+
+                            ++ai;
+                            ++bi;
+                        }
+                    }
+
+                    result->closeColumn(columnIndex);
+                }
+
+                return result;
+            }
+
+            /**
+             * Method that calculates the Hadamard product of this matrix and a dense matrix.  The result will be
+             * sparse.
+             *
+             * \param[in] other The matrix to multiply against.
+             *
+             * \return Returns a newly created instance holding the product.
+             */
+            template<typename D> D* hadamard(const MatrixDensePrivate<C>& other) const {
+                if (currentNumberRows != other.numberRows() || currentNumberColumns != other.numberColumns()) {
+                    throw Model::IncompatibleMatrixDimensions(
+                        currentNumberRows,
+                        currentNumberColumns,
+                        other.numberRows(),
+                        other.numberColumns()
+                    );
+                }
+
+                D* result = create<D>(currentNumberRows, currentNumberColumns, currentNumberEntries);
+
+                const C*           d             = other.data();
+                unsigned long long columnSpacing = other.columnSpacingInMemory();
+                const C*           v             = values();
+
+                for (unsigned long columnIndex=0 ; columnIndex<currentNumberColumns ; ++columnIndex) {
+                    const C*           column = d + columnSpacing * columnIndex;
+                    unsigned long long end    = currentColumnStarts[columnIndex + 1];
+
+                    for (unsigned long long i=currentColumnStarts[columnIndex] ; i<end ; ++i) {
+                        unsigned long rowIndex = currentRowIndexes[i];
+                        C             value    = v[i] * column[rowIndex];
+                        if (value != C(0)) {
+                            new(result->appendEntry(rowIndex)) C(value);
+                        }
+                    }
+
+                    result->closeColumn(columnIndex);
+                }
+
+                return result;
+            }
+
+            /**
+             * Method that calculates the Kronecker product of this matrix and another sparse matrix.
+             *
+             * \param[in] other          The multiplicand.
+             *
+             * \param[in] otherTranspose If true, the multiplicand should be transposed.
+             *
+             * \param[in] scaleFactor    A scale factor to apply to the product.
+             *
+             * \return Returns a newly created instance holding the product.
+             */
+            template<typename D> D* kronecker(
+                    const MatrixSparsePrivate<C>& other,
+                    bool                          otherTranspose,
+                    C                             scaleFactor
+                ) const {
+                const MatrixSparsePrivate<C>* b = otherTranspose ? other.template transposed<D>() : &other;
+
+                unsigned long bRows          = b->currentNumberRows;
+                unsigned long bColumns       = b->currentNumberColumns;
+                unsigned long productRows    = currentNumberRows * bRows;
+                unsigned long productColumns = currentNumberColumns * bColumns;
+
+                D* result = create<D>(productRows, productColumns, currentNumberEntries * b->currentNumberEntries);
+
+                const C* av = values();
+                const C* bv = b->values();
+
+                for (unsigned long aColumn=0 ; aColumn<currentNumberColumns ; ++aColumn) {
+                    unsigned long long aStart = currentColumnStarts[aColumn];
+                    unsigned long long aEnd   = currentColumnStarts[aColumn + 1];
+
+                    for (unsigned long bColumn=0 ; bColumn<bColumns ; ++bColumn) {
+                        unsigned long long bStart = b->currentColumnStarts[bColumn];
+                        unsigned long long bEnd   = b->currentColumnStarts[bColumn + 1];
+
+                        for (unsigned long long ai=aStart ; ai<aEnd ; ++ai) {
+                            unsigned long topRow = currentRowIndexes[ai] * bRows;
+                            C             s      = scaleFactor * av[ai];
+
+                            for (unsigned long long bi=bStart ; bi<bEnd ; ++bi) {
+                                C value = s * bv[bi];
+                                if (value != C(0)) {
+                                    new(result->appendEntry(topRow + b->currentRowIndexes[bi])) C(value);
+                                }
+                            }
+                        }
+
+                        result->closeColumn(aColumn * bColumns + bColumn);
+                    }
+                }
+
+                releaseTransposed<D>(b, &other);
+
+                return result;
+            }
+
+            /**
+             * Method that creates a transposed copy of this matrix.
+             *
+             * \return Returns a newly created transposed instance.
+             */
+            template<typename D> D* transposed() const {
+                D* result = create<D>(currentNumberColumns, currentNumberRows, currentNumberEntries);
+                transposeInto(*result);
+                return result;
+            }
+
+            /**
+             * Method that releases a temporary created by \ref M::MatrixSparsePrivate::transposed.
+             *
+             * \param[in] instance The instance that may be a temporary.
+             *
+             * \param[in] original The original, non-temporary instance.
+             */
+            template<typename D> static void releaseTransposed(
+                    const MatrixSparsePrivate<C>* instance,
+                    const MatrixSparsePrivate<C>* original
+                ) {
+                if (instance != original) {
+                    destroy(const_cast<D*>(static_cast<const D*>(instance)));
+                }
+            }
+
+        private:
+            /**
+             * Method that compares a single column of this matrix against the same column of another matrix.
+             *
+             * \param[in] other       The matrix to compare against.
+             *
+             * \param[in] columnIndex The zero based index of the column to compare.
+             *
+             * \param[in] byBytes     If true, values are ordered by their in-memory representation in the same way
+             *                        dense matrices are ordered.  If false, values are only tested for equality and any
+             *                        difference is reported as a non-zero value.
+             *
+             * \return Returns a negative value, zero, or a positive value.
+             */
+            int compareColumns(const MatrixSparsePrivate<C>& other, unsigned long columnIndex, bool byBytes) const {
+                int result = 0;
+
+                const C* av = values();
+                const C* bv = other.values();
+                C        zero(0);
+
+                unsigned long long ai   = currentColumnStarts[columnIndex];
+                unsigned long long aEnd = currentColumnStarts[columnIndex + 1];
+                unsigned long long bi   = other.currentColumnStarts[columnIndex];
+                unsigned long long bEnd = other.currentColumnStarts[columnIndex + 1];
+
+                while (result == 0 && (ai < aEnd || bi < bEnd)) {
+                    const C* a;
+                    const C* b;
+
+                    if (bi >= bEnd || (ai < aEnd && currentRowIndexes[ai] < other.currentRowIndexes[bi])) {
+                        a = av + ai++;
+                        b = &zero;
+                    } else if (ai >= aEnd || other.currentRowIndexes[bi] < currentRowIndexes[ai]) {
+                        a = &zero;
+                        b = bv + bi++;
+                    } else {
+                        a = av + ai++;
+                        b = bv + bi++;
+                    }
+
+                    if (byBytes) {
+                        result = std::memcmp(a, b, sizeof(C));
+                    } else {
+                        result = (*a == *b) ? 0 : 1;
+                    }
+                }
+
+                return result;
+            }
     };
 }
 
@@ -0,0 +1,537 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+*
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::MatrixSparsePrivateBase class.
+***********************************************************************************************************************/
+
+#include <new>
+#include <cstring>
+#include <cassert>
+#include <cstdint>
+#include <algorithm>
+
+#include "m_api_types.h"
+#include "m_intrinsic_types.h"
+#include "model_exceptions.h"
+#include "m_matrix_private_base.h"
+#include "m_matrix_sparse_private_base.h"
+
+namespace M {
+    constexpr unsigned long long MatrixSparsePrivateBase::invalidEntry;
+
+    MatrixSparsePrivateBase::MatrixSparsePrivateBase(
+            unsigned long      newNumberRows,
+            unsigned long      newNumberColumns,
+            unsigned long long newCapacity,
+            unsigned           coefficientSizeInBytes
+        ) {
+        currentNumberRows             = newNumberRows;
+        currentNumberColumns          = newNumberColumns;
+        currentNumberEntries          = 0;
+        currentCapacity               = 0;
+        currentCoefficientSizeInBytes = coefficientSizeInBytes;
+        currentRowIndexes             = nullptr;
+        currentValues                 = nullptr;
+
+        unsigned long long columnStartsSizeInBytes = sizeof(unsigned long long) * (newNumberColumns + 1);
+        currentColumnStarts = reinterpret_cast<unsigned long long*>(allocateArray(columnStartsSizeInBytes));
+        std::memset(currentColumnStarts, 0, columnStartsSizeInBytes);
+
+        reserve(newCapacity);
+    }
+
+
+    MatrixSparsePrivateBase::MatrixSparsePrivateBase(const MatrixSparsePrivateBase& other):MatrixPrivateBase() {
+        currentNumberRows             = other.currentNumberRows;
+        currentNumberColumns          = other.currentNumberColumns;
+        currentNumberEntries          = 0;
+        currentCapacity               = 0;
+        currentCoefficientSizeInBytes = other.currentCoefficientSizeInBytes;
+        currentRowIndexes             = nullptr;
+        currentValues                 = nullptr;
+
+        unsigned long long columnStartsSizeInBytes = sizeof(unsigned long long) * (currentNumberColumns + 1);
+        currentColumnStarts = reinterpret_cast<unsigned long long*>(allocateArray(columnStartsSizeInBytes));
+        std::memcpy(currentColumnStarts, other.currentColumnStarts, columnStartsSizeInBytes);
+
+        reserve(other.currentNumberEntries);
+
+        currentNumberEntries = other.currentNumberEntries;
+        if (currentNumberEntries > 0) {
+            std::memcpy(currentRowIndexes, other.currentRowIndexes, sizeof(unsigned long) * currentNumberEntries);
+            std::memcpy(currentValues, other.currentValues, currentCoefficientSizeInBytes * currentNumberEntries);
+        }
+    }
+
+
+    MatrixSparsePrivateBase::MatrixSparsePrivateBase(
+            const MatrixSparsePrivateBase& other,
+            unsigned long                  newNumberRows,
+            unsigned long                  newNumberColumns
+        ) {
+        currentNumberRows             = newNumberRows;
+        currentNumberColumns          = newNumberColumns;
+        currentNumberEntries          = 0;
+        currentCapacity               = 0;
+        currentCoefficientSizeInBytes = other.currentCoefficientSizeInBytes;
+        currentRowIndexes             = nullptr;
+        currentValues                 = nullptr;
+
+        unsigned long long columnStartsSizeInBytes = sizeof(unsigned long long) * (newNumberColumns + 1);
+        currentColumnStarts = reinterpret_cast<unsigned long long*>(allocateArray(columnStartsSizeInBytes));
+        currentColumnStarts[0] = 0;
+
+        unsigned long      columnsToCopy = std::min(newNumberColumns, other.currentNumberColumns);
+        unsigned long long entriesToCopy = other.currentColumnStarts[columnsToCopy];
+
+        reserve(entriesToCopy);
+
+        for (unsigned long columnIndex=0 ; columnIndex<columnsToCopy ; ++columnIndex) {
+            unsigned long long sourceStart = other.currentColumnStarts[columnIndex];
+            unsigned long long sourceEnd   = other.currentColumnStarts[columnIndex + 1];
+            unsigned long long sourceIndex = sourceStart;
+
+            while (sourceIndex < sourceEnd && other.currentRowIndexes[sourceIndex] < newNumberRows) {
+                ++sourceIndex;
+            }
+
+            unsigned long long numberToCopy = sourceIndex - sourceStart;
+            if (numberToCopy > 0) {
+                std::memcpy(
+                    currentRowIndexes + currentNumberEntries,
+                    other.currentRowIndexes + sourceStart,
+                    sizeof(unsigned long) * numberToCopy
+                );
+                std::memcpy(
+                    currentValues + currentCoefficientSizeInBytes * currentNumberEntries,
+                    other.currentValues + currentCoefficientSizeInBytes * sourceStart,
+                    currentCoefficientSizeInBytes * numberToCopy
+                );
+
+                currentNumberEntries += numberToCopy;
+            }
+
+            currentColumnStarts[columnIndex + 1] = currentNumberEntries;
+        }
+
+        for (unsigned long columnIndex=columnsToCopy ; columnIndex<newNumberColumns ; ++columnIndex) {
+            currentColumnStarts[columnIndex + 1] = currentNumberEntries;
+        }
+    }
+
+
+    MatrixSparsePrivateBase::~MatrixSparsePrivateBase() {
+        releaseArray(currentColumnStarts);
+        releaseArray(currentRowIndexes);
+        releaseArray(currentValues);
+    }
+
+
+    double MatrixSparsePrivateBase::density() const {
+        double result;
+
+        unsigned long long numberCoefficients = (
+            static_cast<unsigned long long>(currentNumberRows) * currentNumberColumns
+        );
+        if (numberCoefficients > 0) {
+            result = static_cast<double>(currentNumberEntries) / static_cast<double>(numberCoefficients);
+        } else {
+            result = 0;
+        }
+
+        return result;
+    }
+
+
+    void MatrixSparsePrivateBase::reserve(unsigned long long newCapacity) {
+        if (newCapacity > currentCapacity) {
+            unsigned long* newRowIndexes = reinterpret_cast<unsigned long*>(
+                allocateArray(sizeof(unsigned long) * newCapacity)
+            );
+            std::uint8_t* newValues = reinterpret_cast<std::uint8_t*>(
+                allocateArray(currentCoefficientSizeInBytes * newCapacity)
+            );
+
+            if (currentNumberEntries > 0) {
+                std::memcpy(newRowIndexes, currentRowIndexes, sizeof(unsigned long) * currentNumberEntries);
+                std::memcpy(newValues, currentValues, currentCoefficientSizeInBytes * currentNumberEntries);
+            }
+
+            releaseArray(currentRowIndexes);
+            releaseArray(currentValues);
+
+            currentRowIndexes = newRowIndexes;
+            currentValues     = newValues;
+            currentCapacity   = newCapacity;
+        }
+    }
+
+
+    void MatrixSparsePrivateBase::resizeInPlace(unsigned long newNumberRows, unsigned long newNumberColumns) {
+        if (newNumberRows < currentNumberRows) {
+            unsigned long long destinationIndex = 0;
+            unsigned long long sourceStart      = 0;
+
+            for (unsigned long columnIndex=0 ; columnIndex<currentNumberColumns ; ++columnIndex) {
+                unsigned long long sourceEnd = currentColumnStarts[columnIndex + 1];
+
+                for (unsigned long long sourceIndex=sourceStart ; sourceIndex<sourceEnd ; ++sourceIndex) {
+                    if (currentRowIndexes[sourceIndex] < newNumberRows) {
+                        if (destinationIndex != sourceIndex) {
+                            currentRowIndexes[destinationIndex] = currentRowIndexes[sourceIndex];
+                            std::memcpy(
+                                currentValues + currentCoefficientSizeInBytes * destinationIndex,
+                                currentValues + currentCoefficientSizeInBytes * sourceIndex,
+                                currentCoefficientSizeInBytes
+                            );
+                        }
+
+                        ++destinationIndex;
+                    }
+                }
+
+                sourceStart = sourceEnd;
+                currentColumnStarts[columnIndex + 1] = destinationIndex;
+            }
+
+            currentNumberEntries = destinationIndex;
+        }
+
+        if (newNumberColumns != currentNumberColumns) {
+            unsigned long long columnStartsSizeInBytes = sizeof(unsigned long long) * (newNumberColumns + 1);
+            unsigned long long* newColumnStarts = reinterpret_cast<unsigned long long*>(
+                allocateArray(columnStartsSizeInBytes)
+            );
+
+            if (newNumberColumns < currentNumberColumns) {
+                std::memcpy(newColumnStarts, currentColumnStarts, columnStartsSizeInBytes);
+                currentNumberEntries = newColumnStarts[newNumberColumns];
+            } else {
+                std::memcpy(
+                    newColumnStarts,
+                    currentColumnStarts,
+                    sizeof(unsigned long long) * (currentNumberColumns + 1)
+                );
+
+                for (unsigned long columnIndex=currentNumberColumns ; columnIndex<newNumberColumns ; ++columnIndex) {
+                    newColumnStarts[columnIndex + 1] = currentNumberEntries;
+                }
+            }
+
+            releaseArray(currentColumnStarts);
+            currentColumnStarts = newColumnStarts;
+        }
+
+        currentNumberRows    = newNumberRows;
+        currentNumberColumns = newNumberColumns;
+    }
+
+
+    unsigned long long MatrixSparsePrivateBase::find(unsigned long rowIndex, unsigned long columnIndex) const {
+        const unsigned long* columnBegin = currentRowIndexes + currentColumnStarts[columnIndex];
+        const unsigned long* columnEnd   = currentRowIndexes + currentColumnStarts[columnIndex + 1];
+        const unsigned long* location    = std::lower_bound(columnBegin, columnEnd, rowIndex);
+
+        unsigned long long result;
+        if (location != columnEnd && *location == rowIndex) {
+            result = static_cast<unsigned long long>(location - currentRowIndexes);
+        } else {
+            result = invalidEntry;
+        }
+
+        return result;
+    }
+
+
+    unsigned long long MatrixSparsePrivateBase::findOrInsert(unsigned long rowIndex, unsigned long columnIndex) {
+        const unsigned long* columnBegin = currentRowIndexes + currentColumnStarts[columnIndex];
+        const unsigned long* columnEnd   = currentRowIndexes + currentColumnStarts[columnIndex + 1];
+        const unsigned long* location    = std::lower_bound(columnBegin, columnEnd, rowIndex);
+
+        unsigned long long entryIndex = static_cast<unsigned long long>(location - currentRowIndexes);
+        if (location == columnEnd || *location != rowIndex) {
+            if (currentNumberEntries >= currentCapacity) {
+                reserve(grownCapacity(currentNumberEntries + 1));
+            }
+
+            unsigned long long entriesToMove = currentNumberEntries - entryIndex;
+            if (entriesToMove > 0) {
+                std::memmove(
+                    currentRowIndexes + entryIndex + 1,
+                    currentRowIndexes + entryIndex,
+                    sizeof(unsigned long) * entriesToMove
+                );
+                std::memmove(
+                    currentValues + currentCoefficientSizeInBytes * (entryIndex + 1),
+                    currentValues + currentCoefficientSizeInBytes * entryIndex,
+                    currentCoefficientSizeInBytes * entriesToMove
+                );
+            }
+
+            currentRowIndexes[entryIndex] = rowIndex;
+            std::memset(currentValues + currentCoefficientSizeInBytes * entryIndex, 0, currentCoefficientSizeInBytes);
+
+            for (unsigned long i=columnIndex + 1 ; i<=currentNumberColumns ; ++i) {
+                ++currentColumnStarts[i];
+            }
+
+            ++currentNumberEntries;
+        }
+
+        return entryIndex;
+    }
+
+
+    void MatrixSparsePrivateBase::erase(unsigned long rowIndex, unsigned long columnIndex) {
+        unsigned long long entryIndex = find(rowIndex, columnIndex);
+        if (entryIndex != invalidEntry) {
+            unsigned long long entriesToMove = currentNumberEntries - entryIndex - 1;
+            if (entriesToMove > 0) {
+                std::memmove(
+                    currentRowIndexes + entryIndex,
+                    currentRowIndexes + entryIndex + 1,
+                    sizeof(unsigned long) * entriesToMove
+                );
+                std::memmove(
+                    currentValues + currentCoefficientSizeInBytes * entryIndex,
+                    currentValues + currentCoefficientSizeInBytes * (entryIndex + 1),
+                    currentCoefficientSizeInBytes * entriesToMove
+                );
+            }
+
+            for (unsigned long i=columnIndex + 1 ; i<=currentNumberColumns ; ++i) {
+                --currentColumnStarts[i];
+            }
+
+            --currentNumberEntries;
+        }
+    }
+
+
+    void MatrixSparsePrivateBase::clearEntries() {
+        std::memset(currentColumnStarts, 0, sizeof(unsigned long long) * (currentNumberColumns + 1));
+        currentNumberEntries = 0;
+    }
+
+
+    void MatrixSparsePrivateBase::transposeInto(MatrixSparsePrivateBase& destination) const {
+        assert(destination.currentNumberRows == currentNumberColumns);
+        assert(destination.currentNumberColumns == currentNumberRows);
+        assert(destination.currentNumberEntries == 0);
+
+        destination.reserve(currentNumberEntries);
+
+        // Count the entries in each row of this matrix, then convert the counts into column starts for the
+        // destination.  We then scatter entries, walking this matrix in column order so that row indexes in the
+        // destination are naturally sorted.
+
+        unsigned long long* destinationStarts = destination.currentColumnStarts;
+        std::memset(destinationStarts, 0, sizeof(unsigned long long) * (currentNumberRows + 1));
+
+        for (unsigned long long i=0 ; i<currentNumberEntries ; ++i) {
+            ++destinationStarts[currentRowIndexes[i] + 1];
+        }
+
+        for (unsigned long rowIndex=0 ; rowIndex<currentNumberRows ; ++rowIndex) {
+            destinationStarts[rowIndex + 1] += destinationStarts[rowIndex];
+        }
+
+        unsigned long long* nextFree = reinterpret_cast<unsigned long long*>(
+            allocateArray(sizeof(unsigned long long) * (currentNumberRows + 1))
+        );
+        std::memcpy(nextFree, destinationStarts, sizeof(unsigned long long) * (currentNumberRows + 1));
+
+        unsigned coefficientSize = currentCoefficientSizeInBytes;
+        for (unsigned long columnIndex=0 ; columnIndex<currentNumberColumns ; ++columnIndex) {
+            unsigned long long end = currentColumnStarts[columnIndex + 1];
+            for (unsigned long long i=currentColumnStarts[columnIndex] ; i<end ; ++i) {
+                unsigned long long destinationIndex = nextFree[currentRowIndexes[i]]++;
+                destination.currentRowIndexes[destinationIndex] = columnIndex;
+                std::memcpy(
+                    destination.currentValues + coefficientSize * destinationIndex,
+                    currentValues + coefficientSize * i,
+                    coefficientSize
+                );
+            }
+        }
+
+        releaseArray(nextFree);
+
+        destination.currentNumberEntries = currentNumberEntries;
+    }
+
+
+    void MatrixSparsePrivateBase::columnReverseInto(MatrixSparsePrivateBase& destination) const {
+        assert(destination.currentNumberRows == currentNumberRows);
+        assert(destination.currentNumberColumns == currentNumberColumns);
+        assert(destination.currentNumberEntries == 0);
+
+        destination.reserve(currentNumberEntries);
+
+        for (unsigned long destinationColumn=0 ; destinationColumn<currentNumberColumns ; ++destinationColumn) {
+            unsigned long      sourceColumn  = currentNumberColumns - destinationColumn - 1;
+            unsigned long long sourceStart   = currentColumnStarts[sourceColumn];
+            unsigned long long numberEntries = currentColumnStarts[sourceColumn + 1] - sourceStart;
+
+            if (numberEntries > 0) {
+                std::memcpy(
+                    destination.currentRowIndexes + destination.currentNumberEntries,
+                    currentRowIndexes + sourceStart,
+                    sizeof(unsigned long) * numberEntries
+                );
+                std::memcpy(
+                    destination.valueAddress(destination.currentNumberEntries),
+                    valueAddress(sourceStart),
+                    currentCoefficientSizeInBytes * numberEntries
+                );
+
+                destination.currentNumberEntries += numberEntries;
+            }
+
+            destination.closeColumn(destinationColumn);
+        }
+    }
+
+
+    void MatrixSparsePrivateBase::rowReverseInto(MatrixSparsePrivateBase& destination) const {
+        assert(destination.currentNumberRows == currentNumberRows);
+        assert(destination.currentNumberColumns == currentNumberColumns);
+        assert(destination.currentNumberEntries == 0);
+
+        destination.reserve(currentNumberEntries);
+
+        unsigned long lastRow = currentNumberRows - 1;
+        for (unsigned long columnIndex=0 ; columnIndex<currentNumberColumns ; ++columnIndex) {
+            unsigned long long start = currentColumnStarts[columnIndex];
+            unsigned long long i     = currentColumnStarts[columnIndex + 1];
+
+            while (i > start) {
+                --i;
+                void* d = destination.appendEntry(lastRow - currentRowIndexes[i]);
+                std::memcpy(d, valueAddress(i), currentCoefficientSizeInBytes);
+            }
+
+            destination.closeColumn(columnIndex);
+        }
+    }
+
+
+    void MatrixSparsePrivateBase::combineLeftToRightInto(
+            const MatrixSparsePrivateBase& other,
+            MatrixSparsePrivateBase&       destination
+        ) const {
+        assert(destination.currentNumberColumns == currentNumberColumns + other.currentNumberColumns);
+        assert(destination.currentNumberEntries == 0);
+
+        destination.reserve(currentNumberEntries + other.currentNumberEntries);
+
+        unsigned long long* destinationStarts = destination.currentColumnStarts;
+
+        if (currentNumberEntries > 0) {
+            std::memcpy(destination.currentRowIndexes, currentRowIndexes, sizeof(unsigned long) * currentNumberEntries);
+            std::memcpy(destination.currentValues, currentValues, currentCoefficientSizeInBytes * currentNumberEntries);
+        }
+
+        if (other.currentNumberEntries > 0) {
+            std::memcpy(
+                destination.currentRowIndexes + currentNumberEntries,
+                other.currentRowIndexes,
+                sizeof(unsigned long) * other.currentNumberEntries
+            );
+            std::memcpy(
+                destination.valueAddress(currentNumberEntries),
+                other.currentValues,
+                currentCoefficientSizeInBytes * other.currentNumberEntries
+            );
+        }
+
+        std::memcpy(destinationStarts, currentColumnStarts, sizeof(unsigned long long) * (currentNumberColumns + 1));
+        for (unsigned long columnIndex=1 ; columnIndex<=other.currentNumberColumns ; ++columnIndex) {
+            destinationStarts[currentNumberColumns + columnIndex] = (
+                  other.currentColumnStarts[columnIndex]
+                + currentNumberEntries
+            );
+        }
+
+        destination.currentNumberEntries = currentNumberEntries + other.currentNumberEntries;
+    }
+
+
+    void MatrixSparsePrivateBase::combineTopToBottomInto(
+            const MatrixSparsePrivateBase& other,
+            MatrixSparsePrivateBase&       destination
+        ) const {
+        assert(destination.currentNumberRows == currentNumberRows + other.currentNumberRows);
+        assert(destination.currentNumberEntries == 0);
+
+        destination.reserve(currentNumberEntries + other.currentNumberEntries);
+
+        for (unsigned long columnIndex=0 ; columnIndex<destination.currentNumberColumns ; ++columnIndex) {
+            if (columnIndex < currentNumberColumns) {
+                unsigned long long end = currentColumnStarts[columnIndex + 1];
+                for (unsigned long long i=currentColumnStarts[columnIndex] ; i<end ; ++i) {
+                    void* d = destination.appendEntry(currentRowIndexes[i]);
+                    std::memcpy(d, valueAddress(i), currentCoefficientSizeInBytes);
+                }
+            }
+
+            if (columnIndex < other.currentNumberColumns) {
+                unsigned long long end = other.currentColumnStarts[columnIndex + 1];
+                for (unsigned long long i=other.currentColumnStarts[columnIndex] ; i<end ; ++i) {
+                    void* d = destination.appendEntry(currentNumberRows + other.currentRowIndexes[i]);
+                    std::memcpy(d, other.valueAddress(i), currentCoefficientSizeInBytes);
+                }
+            }
+
+            destination.closeColumn(columnIndex);
+        }
+    }
+
+
+    unsigned long long MatrixSparsePrivateBase::grownCapacity(unsigned long long requiredCapacity) const {
+        unsigned long long result = std::max(currentCapacity + currentCapacity / 2, requiredCapacity);
+        return std::max(result, 16ULL);
+    }
+
+
+    void* MatrixSparsePrivateBase::allocateArray(unsigned long long sizeInBytes) {
+        void* result;
+
+        if (sizeInBytes > 0) {
+            void* unused;
+            result = allocateMemory(unused, sizeInBytes, 0);
+        } else {
+            result = nullptr;
+        }
+
+        return result;
+    }
+
+
+    void MatrixSparsePrivateBase::releaseArray(void* array) {
+        if (array != nullptr) {
+            releaseMemory(array);
+        }
+    }
+}
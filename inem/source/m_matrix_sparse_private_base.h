@@ -0,0 +1,387 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+*
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This header defines the private base class used by the \ref M::MatrixSparsePrivate class.
+***********************************************************************************************************************/
+
+/* .. sphinx-project inem */
+
+#ifndef M_MATRIX_SPARSE_PRIVATE_BASE_H
+#define M_MATRIX_SPARSE_PRIVATE_BASE_H
+
+#include <cstdint>
+
+#include "m_api_types.h"
+#include "m_intrinsic_types.h"
+#include "m_compiler_abstraction.h"
+#include "m_matrix_private_base.h"
+
+namespace M {
+    /**
+     * Private base class used by the \ref MatrixSparsePrivate template class.  This class provides generic support
+     * for sparse matrices stored in compressed sparse column (CSC) format.
+     *
+     * Entries are stored column by column.  The column start array holds, for each column, the index of the first
+     * stored entry for that column with one additional trailing entry holding the total number of stored entries.
+     * Row indexes within each column are kept in strictly increasing order.  Coefficient values are managed as opaque
+     * blocks of bytes by this class so that structural operations can be shared across all the coefficient types.
+     */
+    class MatrixSparsePrivateBase:public MatrixPrivateBase {
+        public:
+            /**
+             * Constructor
+             *
+             * \param[in] newNumberRows          The new number of rows.
+             *
+             * \param[in] newNumberColumns       The new number of columns.
+             *
+             * \param[in] newCapacity            The initial number of entries we can store without reallocation.
+             *
+             * \param[in] coefficientSizeInBytes The coefficient size in bytes.
+             */
+            MatrixSparsePrivateBase(
+                unsigned long      newNumberRows,
+                unsigned long      newNumberColumns,
+                unsigned long long newCapacity,
+                unsigned           coefficientSizeInBytes
+            );
+
+            /**
+             * Constructor
+             *
+             * \param[in] other The instance to be copied to this instance.
+             */
+            MatrixSparsePrivateBase(const MatrixSparsePrivateBase& other);
+
+            /**
+             * Constructor
+             *
+             * \param[in] other            The instance to be copied to this instance.
+             *
+             * \param[in] newNumberRows    The new number of rows.  Entries beyond this row will be discarded.
+             *
+             * \param[in] newNumberColumns The new number of columns.  Entries beyond this column will be discarded.
+             */
+            MatrixSparsePrivateBase(
+                const MatrixSparsePrivateBase& other,
+                unsigned long                  newNumberRows,
+                unsigned long                  newNumberColumns
+            );
+
+            ~MatrixSparsePrivateBase();
+
+            /**
+             * Method you can use to determine number of matrix rows.
+             *
+             * \return Returns the current number of rows.
+             */
+            inline unsigned long numberRows() const {
+                return currentNumberRows;
+            }
+
+            /**
+             * Method you can use to determine the number of matrix columns.
+             *
+             * \return Returns the current number of matrix columns.
+             */
+            inline unsigned long numberColumns() const {
+                return currentNumberColumns;
+            }
+
+            /**
+             * Method you can use to determine the number of explicitly stored entries.  Note that explicitly stored
+             * entries may, in some cases, hold a zero value.
+             *
+             * \return Returns the number of stored entries.
+             */
+            inline unsigned long long numberNonZeros() const {
+                return currentNumberEntries;
+            }
+
+            /**
+             * Method you can use to determine the number of entries that can be stored without reallocation.
+             *
+             * \return Returns the current entry capacity.
+             */
+            inline unsigned long long capacity() const {
+                return currentCapacity;
+            }
+
+            /**
+             * Method you can use to determine the fraction of the matrix coefficients that are explicitly stored.
+             *
+             * \return Returns the matrix density as a value between 0 and 1, inclusive.
+             */
+            double density() const;
+
+            /**
+             * Method you can use to obtain the column start array.  The array contains one entry per column plus one
+             * additional trailing entry.
+             *
+             * \return Returns a pointer to the column start array.
+             */
+            inline const unsigned long long* columnStarts() const {
+                return currentColumnStarts;
+            }
+
+            /**
+             * Method you can use to obtain the row index array.
+             *
+             * \return Returns a pointer to the row index array.
+             */
+            inline const unsigned long* rowIndexes() const {
+                return currentRowIndexes;
+            }
+
+            /**
+             * Method you can use to reserve space for a given number of entries.
+             *
+             * \param[in] newCapacity The desired capacity, in entries.  The capacity will never be reduced by this
+             *                        method.
+             */
+            void reserve(unsigned long long newCapacity);
+
+            /**
+             * Method you can use to resize the matrix, in place.  Entries that fall outside the new matrix bounds are
+             * discarded.
+             *
+             * \param[in] newNumberRows    The new number of rows.
+             *
+             * \param[in] newNumberColumns The new number of columns.
+             */
+            void resizeInPlace(unsigned long newNumberRows, unsigned long newNumberColumns);
+
+        protected:
+            /**
+             * Value returned by \ref M::MatrixSparsePrivateBase::find if an entry is not stored.
+             */
+            static constexpr unsigned long long invalidEntry = static_cast<unsigned long long>(-1);
+
+            /**
+             * Method you can use to locate a stored entry.
+             *
+             * \param[in] rowIndex    The zero based row index of the entry.
+             *
+             * \param[in] columnIndex The zero based column index of the entry.
+             *
+             * \return Returns the index of the entry in the entry arrays.  The value
+             *         \ref M::MatrixSparsePrivateBase::invalidEntry is returned if the entry is not stored.
+             */
+            unsigned long long find(unsigned long rowIndex, unsigned long columnIndex) const;
+
+            /**
+             * Method you can use to locate or insert a stored entry.  Newly inserted entries are zero filled.
+             *
+             * \param[in] rowIndex    The zero based row index of the entry.
+             *
+             * \param[in] columnIndex The zero based column index of the entry.
+             *
+             * \return Returns the index of the entry in the entry arrays.
+             */
+            unsigned long long findOrInsert(unsigned long rowIndex, unsigned long columnIndex);
+
+            /**
+             * Method you can use to append an entry to the column currently being built.  Entries must be appended
+             * in column major order with strictly increasing row indexes.  You must call
+             * \ref M::MatrixSparsePrivateBase::closeColumn after the last entry of each column has been appended.
+             *
+             * \param[in] rowIndex The zero based row index of the entry.
+             *
+             * \return Returns the address where the entry's value should be placed.
+             */
+            inline void* appendEntry(unsigned long rowIndex) {
+                if (currentNumberEntries >= currentCapacity) {
+                    reserve(grownCapacity(currentNumberEntries + 1));
+                }
+
+                currentRowIndexes[currentNumberEntries] = rowIndex;
+                return currentValues + currentCoefficientSizeInBytes * currentNumberEntries++;
+            }
+
+            /**
+             * Method you should call to mark the end of a column built using
+             * \ref M::MatrixSparsePrivateBase::appendEntry.  Columns must be closed in increasing order.
+             *
+             * \param[in] columnIndex The zero based column index of the column to be closed.
+             */
+            inline void closeColumn(unsigned long columnIndex) {
+                currentColumnStarts[columnIndex + 1] = currentNumberEntries;
+            }
+
+            /**
+             * Method you can use to obtain the address of an entry's value.
+             *
+             * \param[in] entryIndex The index of the entry.
+             *
+             * \return Returns the address of the requested entry value.
+             */
+            inline void* valueAddress(unsigned long long entryIndex) {
+                return currentValues + currentCoefficientSizeInBytes * entryIndex;
+            }
+
+            /**
+             * Method you can use to obtain the address of an entry's value.
+             *
+             * \param[in] entryIndex The index of the entry.
+             *
+             * \return Returns the address of the requested entry value.
+             */
+            inline const void* valueAddress(unsigned long long entryIndex) const {
+                return currentValues + currentCoefficientSizeInBytes * entryIndex;
+            }
+
+            /**
+             * Method you can use to remove a stored entry.  Entries that are not stored are ignored.
+             *
+             * \param[in] rowIndex    The zero based row index of the entry.
+             *
+             * \param[in] columnIndex The zero based column index of the entry.
+             */
+            void erase(unsigned long rowIndex, unsigned long columnIndex);
+
+            /**
+             * Method that discards all stored entries while retaining the current matrix dimensions.
+             */
+            void clearEntries();
+
+            /**
+             * Method that populates a destination with the transpose of this matrix.  The destination must be empty
+             * and have dimensions matching the transpose of this matrix.
+             *
+             * \param[in] destination The destination to receive the transposed data.
+             */
+            void transposeInto(MatrixSparsePrivateBase& destination) const;
+
+            /**
+             * Method that populates a destination with this matrix with the column order reversed.  The destination
+             * must be empty and have the same dimensions as this matrix.
+             *
+             * \param[in] destination The destination to receive the data.
+             */
+            void columnReverseInto(MatrixSparsePrivateBase& destination) const;
+
+            /**
+             * Method that populates a destination with this matrix with the row order reversed.  The destination
+             * must be empty and have the same dimensions as this matrix.
+             *
+             * \param[in] destination The destination to receive the data.
+             */
+            void rowReverseInto(MatrixSparsePrivateBase& destination) const;
+
+            /**
+             * Method that populates a destination with this matrix followed, to the right, by another matrix.  The
+             * destination must be empty and sized to hold both matrices.
+             *
+             * \param[in] other       The matrix to place to the right of this matrix.
+             *
+             * \param[in] destination The destination to receive the data.
+             */
+            void combineLeftToRightInto(
+                const MatrixSparsePrivateBase& other,
+                MatrixSparsePrivateBase&       destination
+            ) const;
+
+            /**
+             * Method that populates a destination with this matrix followed, below, by another matrix.  The
+             * destination must be empty and sized to hold both matrices.
+             *
+             * \param[in] other       The matrix to place below this matrix.
+             *
+             * \param[in] destination The destination to receive the data.
+             */
+            void combineTopToBottomInto(
+                const MatrixSparsePrivateBase& other,
+                MatrixSparsePrivateBase&       destination
+            ) const;
+
+            /**
+             * Method that calculates a recommended capacity when growing the entry arrays.
+             *
+             * \param[in] requiredCapacity The minimum required capacity, in entries.
+             *
+             * \return Returns the recommended capacity, in entries.
+             */
+            unsigned long long grownCapacity(unsigned long long requiredCapacity) const;
+
+            /**
+             * The current number of matrix rows.
+             */
+            unsigned long currentNumberRows;
+
+            /**
+             * The current number of matrix columns.
+             */
+            unsigned long currentNumberColumns;
+
+            /**
+             * The current number of stored entries.
+             */
+            unsigned long long currentNumberEntries;
+
+            /**
+             * The current entry capacity.
+             */
+            unsigned long long currentCapacity;
+
+            /**
+             * The size of each coefficient, in bytes.
+             */
+            unsigned currentCoefficientSizeInBytes;
+
+            /**
+             * Array holding the index of the first entry of each column.  The array holds one additional trailing
+             * entry.
+             */
+            unsigned long long* currentColumnStarts;
+
+            /**
+             * Array holding the row index of each stored entry.
+             */
+            unsigned long* currentRowIndexes;
+
+            /**
+             * Array holding the value of each stored entry.
+             */
+            std::uint8_t* currentValues;
+
+        private:
+            /**
+             * Method that allocates an array.
+             *
+             * \param[in] sizeInBytes The required array size, in bytes.
+             *
+             * \return Returns a pointer to the newly allocated array.
+             */
+            static void* allocateArray(unsigned long long sizeInBytes);
+
+            /**
+             * Method that releases an array allocated with \ref M::MatrixSparsePrivateBase::allocateArray.
+             *
+             * \param[in] array The array to be released.  A null pointer is ignored.
+             */
+            static void releaseArray(void* array);
+    };
+}
+
+#endif
@@ -0,0 +1,730 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+*
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::MatrixSparseSolver class.
+***********************************************************************************************************************/
+
+#include <vector>
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+
+#include "m_intrinsic_types.h"
+#include "m_matrix_sparse_solver.h"
+
+namespace M {
+    constexpr unsigned long MatrixSparseSolver::invalidIndex;
+    constexpr Real          MatrixSparseSolver::diagonalPivotThreshold;
+
+    MatrixSparseSolver::MatrixSparseSolver() {
+        currentFactorization    = Factorization::NONE;
+        currentNumberRowColumns = 0;
+    }
+
+
+    MatrixSparseSolver::~MatrixSparseSolver() {}
+
+
+    bool MatrixSparseSolver::factor(
+            unsigned long             numberRowColumns,
+            const unsigned long long* columnStarts,
+            const unsigned long*      rowIndexes,
+            const Real*               values
+        ) {
+        clear();
+        currentNumberRowColumns = numberRowColumns;
+
+        // Build the transpose so that we can test for symmetry and build the pattern of A + A^T.  Row indexes in
+        // each column of the transpose end up sorted because we visit the columns of A in order.
+
+        unsigned long long              numberEntries = columnStarts[numberRowColumns];
+        std::vector<unsigned long long> transposeColumnStarts(numberRowColumns + 1, 0);
+        std::vector<unsigned long>      transposeRowIndexes(numberEntries);
+        std::vector<Real>               transposeValues(numberEntries);
+
+        for (unsigned long long entryIndex=0 ; entryIndex<numberEntries ; ++entryIndex) {
+            ++transposeColumnStarts[rowIndexes[entryIndex] + 1];
+        }
+
+        for (unsigned long columnIndex=0 ; columnIndex<numberRowColumns ; ++columnIndex) {
+            transposeColumnStarts[columnIndex + 1] += transposeColumnStarts[columnIndex];
+        }
+
+        std::vector<unsigned long long> insertionPoints(transposeColumnStarts.begin(), transposeColumnStarts.end() - 1);
+        for (unsigned long columnIndex=0 ; columnIndex<numberRowColumns ; ++columnIndex) {
+            for (unsigned long long entryIndex=columnStarts[columnIndex] ;
+                 entryIndex<columnStarts[columnIndex + 1]                ;
+                 ++entryIndex                                             ) {
+                unsigned long long destination = insertionPoints[rowIndexes[entryIndex]]++;
+                transposeRowIndexes[destination] = columnIndex;
+                transposeValues[destination]     = values[entryIndex];
+            }
+        }
+
+        bool isSymmetric = true;
+        for (unsigned long columnIndex=0 ; isSymmetric && columnIndex<numberRowColumns ; ++columnIndex) {
+            unsigned long long start = columnStarts[columnIndex];
+            unsigned long long end   = columnStarts[columnIndex + 1];
+
+            if (end - start != transposeColumnStarts[columnIndex + 1] - transposeColumnStarts[columnIndex]) {
+                isSymmetric = false;
+            } else {
+                unsigned long long transposeIndex = transposeColumnStarts[columnIndex];
+                for (unsigned long long entryIndex=start ; isSymmetric && entryIndex<end ; ++entryIndex) {
+                    isSymmetric = (
+                           rowIndexes[entryIndex] == transposeRowIndexes[transposeIndex]
+                        && values[entryIndex] == transposeValues[transposeIndex]
+                    );
+
+                    ++transposeIndex;
+                }
+            }
+        }
+
+        std::vector<std::vector<unsigned long>> adjacency(numberRowColumns);
+        for (unsigned long columnIndex=0 ; columnIndex<numberRowColumns ; ++columnIndex) {
+            std::vector<unsigned long>& neighbors = adjacency[columnIndex];
+
+            unsigned long long entryIndex     = columnStarts[columnIndex];
+            unsigned long long entryEnd       = columnStarts[columnIndex + 1];
+            unsigned long long transposeIndex = transposeColumnStarts[columnIndex];
+            unsigned long long transposeEnd   = transposeColumnStarts[columnIndex + 1];
+
+            neighbors.reserve((entryEnd - entryIndex) + (transposeEnd - transposeIndex));
+            while (entryIndex < entryEnd || transposeIndex < transposeEnd) {
+                unsigned long rowIndex;
+                if (transposeIndex >= transposeEnd                                                         ||
+                    (entryIndex < entryEnd && rowIndexes[entryIndex] < transposeRowIndexes[transposeIndex])    ) {
+                    rowIndex = rowIndexes[entryIndex++];
+                } else if (entryIndex >= entryEnd || transposeRowIndexes[transposeIndex] < rowIndexes[entryIndex]) {
+                    rowIndex = transposeRowIndexes[transposeIndex++];
+                } else {
+                    rowIndex = rowIndexes[entryIndex++];
+                    ++transposeIndex;
+                }
+
+                if (rowIndex != columnIndex) {
+                    neighbors.push_back(rowIndex);
+                }
+            }
+        }
+
+        columnOrder = approximateMinimumDegree(numberRowColumns, adjacency);
+
+        bool success = false;
+        if (isSymmetric) {
+            success = choleskyFactor(columnStarts, rowIndexes, values);
+        }
+
+        if (!success) {
+            success = luFactor(columnStarts, rowIndexes, values);
+        }
+
+        if (!success) {
+            clear();
+        }
+
+        return success;
+    }
+
+
+    unsigned long long MatrixSparseSolver::numberFactorEntries() const {
+        return lowerValues.size() + upperValues.size();
+    }
+
+
+    void MatrixSparseSolver::solve(const Real* b, Real* x) const {
+        unsigned long     n = currentNumberRowColumns;
+        std::vector<Real> y(n);
+
+        if (currentFactorization == Factorization::CHOLESKY) {
+            for (unsigned long k=0 ; k<n ; ++k) {
+                y[k] = b[columnOrder[k]];
+            }
+
+            for (unsigned long columnIndex=0 ; columnIndex<n ; ++columnIndex) {
+                unsigned long long start = lowerColumnStarts[columnIndex];
+                unsigned long long end   = lowerColumnStarts[columnIndex + 1];
+
+                Real v = y[columnIndex] / lowerValues[start];
+                y[columnIndex] = v;
+
+                for (unsigned long long entryIndex=start+1 ; entryIndex<end ; ++entryIndex) {
+                    y[lowerRowIndexes[entryIndex]] -= lowerValues[entryIndex] * v;
+                }
+            }
+
+            for (unsigned long columnIndex=n ; columnIndex>0 ; --columnIndex) {
+                unsigned long long start = lowerColumnStarts[columnIndex - 1];
+                unsigned long long end   = lowerColumnStarts[columnIndex];
+
+                Real v = y[columnIndex - 1];
+                for (unsigned long long entryIndex=start+1 ; entryIndex<end ; ++entryIndex) {
+                    v -= lowerValues[entryIndex] * y[lowerRowIndexes[entryIndex]];
+                }
+
+                y[columnIndex - 1] = v / lowerValues[start];
+            }
+        } else {
+            assert(currentFactorization == Factorization::LU);
+
+            for (unsigned long rowIndex=0 ; rowIndex<n ; ++rowIndex) {
+                y[inverseRowOrder[rowIndex]] = b[rowIndex];
+            }
+
+            for (unsigned long columnIndex=0 ; columnIndex<n ; ++columnIndex) {
+                Real v = y[columnIndex];
+                if (v != Real(0)) {
+                    unsigned long long start = lowerColumnStarts[columnIndex];
+                    unsigned long long end   = lowerColumnStarts[columnIndex + 1];
+                    for (unsigned long long entryIndex=start+1 ; entryIndex<end ; ++entryIndex) {
+                        y[lowerRowIndexes[entryIndex]] -= lowerValues[entryIndex] * v;
+                    }
+                }
+            }
+
+            for (unsigned long columnIndex=n ; columnIndex>0 ; --columnIndex) {
+                unsigned long long start = upperColumnStarts[columnIndex - 1];
+                unsigned long long end   = upperColumnStarts[columnIndex] - 1;
+
+                Real v = y[columnIndex - 1] / upperValues[end];
+                y[columnIndex - 1] = v;
+
+                if (v != Real(0)) {
+                    for (unsigned long long entryIndex=start ; entryIndex<end ; ++entryIndex) {
+                        y[upperRowIndexes[entryIndex]] -= upperValues[entryIndex] * v;
+                    }
+                }
+            }
+        }
+
+        for (unsigned long k=0 ; k<n ; ++k) {
+            x[columnOrder[k]] = y[k];
+        }
+    }
+
+
+    std::vector<unsigned long> MatrixSparseSolver::approximateMinimumDegree(
+            unsigned long                            numberNodes,
+            std::vector<std::vector<unsigned long>>& adjacency
+        ) {
+        // This is a quotient graph minimum degree ordering.  Eliminated nodes become elements holding the set of
+        // variables they connect.  Degrees are approximated using the external degree bound from the AMD algorithm
+        // rather than computed exactly.  Elements whose variables are fully covered by a newly formed element are
+        // absorbed into it.
+
+        enum class Status : unsigned char {
+            VARIABLE,
+            ELEMENT,
+            ABSORBED
+        };
+
+        std::vector<unsigned long>              result;
+        std::vector<std::vector<unsigned long>> elements(numberNodes);
+        std::vector<std::vector<unsigned long>> members(numberNodes);
+        std::vector<Status>                     status(numberNodes, Status::VARIABLE);
+        std::vector<unsigned long>              degree(numberNodes);
+        std::vector<unsigned long>              bucketHead(numberNodes + 1, invalidIndex);
+        std::vector<unsigned long>              bucketNext(numberNodes, invalidIndex);
+        std::vector<unsigned long>              bucketPrevious(numberNodes, invalidIndex);
+        std::vector<unsigned long>              variableMark(numberNodes, invalidIndex);
+        std::vector<unsigned long>              elementMark(numberNodes, invalidIndex);
+        std::vector<unsigned long>              externalDegree(numberNodes, 0);
+
+        result.reserve(numberNodes);
+
+        auto insertIntoBucket = [&](unsigned long node) {
+            unsigned long d = degree[node];
+            bucketPrevious[node] = invalidIndex;
+            bucketNext[node]     = bucketHead[d];
+            if (bucketHead[d] != invalidIndex) {
+                bucketPrevious[bucketHead[d]] = node;
+            }
+
+            bucketHead[d] = node;
+        };
+
+        auto removeFromBucket = [&](unsigned long node) {
+            if (bucketPrevious[node] != invalidIndex) {
+                bucketNext[bucketPrevious[node]] = bucketNext[node];
+            } else {
+                bucketHead[degree[node]] = bucketNext[node];
+            }
+
+            if (bucketNext[node] != invalidIndex) {
+                bucketPrevious[bucketNext[node]] = bucketPrevious[node];
+            }
+        };
+
+        for (unsigned long node=0 ; node<numberNodes ; ++node) {
+            degree[node] = std::min(static_cast<unsigned long>(adjacency[node].size()), numberNodes - 1);
+            insertIntoBucket(node);
+        }
+
+        unsigned long minimumDegree = 0;
+        for (unsigned long step=0 ; step<numberNodes ; ++step) {
+            while (bucketHead[minimumDegree] == invalidIndex) {
+                ++minimumDegree;
+            }
+
+            unsigned long pivot = bucketHead[minimumDegree];
+            removeFromBucket(pivot);
+            result.push_back(pivot);
+
+            // Form the new element from the pivot's variable neighbors and the variables of the elements it is
+            // adjacent to.  Those elements are absorbed into the new element.
+
+            std::vector<unsigned long> newElement;
+            variableMark[pivot] = step;
+
+            for (unsigned long neighbor : adjacency[pivot]) {
+                if (status[neighbor] == Status::VARIABLE && variableMark[neighbor] != step) {
+                    variableMark[neighbor] = step;
+                    newElement.push_back(neighbor);
+                }
+            }
+
+            for (unsigned long element : elements[pivot]) {
+                if (status[element] == Status::ELEMENT) {
+                    for (unsigned long member : members[element]) {
+                        if (status[member] == Status::VARIABLE && variableMark[member] != step) {
+                            variableMark[member] = step;
+                            newElement.push_back(member);
+                        }
+                    }
+
+                    status[element] = Status::ABSORBED;
+                    std::vector<unsigned long>().swap(members[element]);
+                }
+            }
+
+            status[pivot] = Status::ELEMENT;
+            std::vector<unsigned long>().swap(adjacency[pivot]);
+            std::vector<unsigned long>().swap(elements[pivot]);
+
+            // Calculate |Le \ Lp| for every element adjacent to the variables of the new element.
+
+            for (unsigned long variable : newElement) {
+                for (unsigned long element : elements[variable]) {
+                    if (status[element] == Status::ELEMENT) {
+                        if (elementMark[element] != step) {
+                            elementMark[element]    = step;
+                            externalDegree[element] = members[element].size();
+                        }
+
+                        --externalDegree[element];
+                    }
+                }
+            }
+
+            // Update the variables of the new element, pruning entries now represented by the new element, and
+            // recompute their approximate degrees.
+
+            unsigned long remaining   = numberNodes - step - 1;
+            unsigned long elementSize = newElement.size();
+            for (unsigned long variable : newElement) {
+                std::vector<unsigned long>& variableElements = elements[variable];
+                unsigned long               degreeEstimate   = elementSize - 1;
+
+                unsigned long kept = 0;
+                for (unsigned long element : variableElements) {
+                    if (status[element] == Status::ELEMENT) {
+                        if (externalDegree[element] == 0) {
+                            status[element] = Status::ABSORBED;
+                            std::vector<unsigned long>().swap(members[element]);
+                        } else {
+                            degreeEstimate += externalDegree[element];
+                            variableElements[kept++] = element;
+                        }
+                    }
+                }
+
+                variableElements.resize(kept);
+                variableElements.push_back(pivot);
+
+                std::vector<unsigned long>& variableNeighbors = adjacency[variable];
+                kept = 0;
+                for (unsigned long neighbor : variableNeighbors) {
+                    if (status[neighbor] == Status::VARIABLE && variableMark[neighbor] != step) {
+                        variableNeighbors[kept++] = neighbor;
+                    }
+                }
+
+                variableNeighbors.resize(kept);
+                degreeEstimate += kept;
+
+                removeFromBucket(variable);
+                degree[variable] = std::min(degreeEstimate, remaining);
+                insertIntoBucket(variable);
+
+                if (degree[variable] < minimumDegree) {
+                    minimumDegree = degree[variable];
+                }
+            }
+
+            members[pivot].swap(newElement);
+        }
+
+        return result;
+    }
+
+
+    bool MatrixSparseSolver::choleskyFactor(
+            const unsigned long long* columnStarts,
+            const unsigned long*      rowIndexes,
+            const Real*               values
+        ) {
+        unsigned long n = currentNumberRowColumns;
+
+        std::vector<unsigned long> inverseOrder(n);
+        for (unsigned long k=0 ; k<n ; ++k) {
+            inverseOrder[columnOrder[k]] = k;
+        }
+
+        // Build the symmetrically permuted matrix C = P A P^T.
+
+        unsigned long long              numberEntries = columnStarts[n];
+        std::vector<unsigned long long> cColumnStarts(n + 1);
+        std::vector<unsigned long>      cRowIndexes(numberEntries);
+        std::vector<Real>               cValues(numberEntries);
+
+        cColumnStarts[0] = 0;
+        for (unsigned long k=0 ; k<n ; ++k) {
+            unsigned long      originalColumn = columnOrder[k];
+            unsigned long long destination    = cColumnStarts[k];
+            for (unsigned long long entryIndex=columnStarts[originalColumn] ;
+                 entryIndex<columnStarts[originalColumn + 1]                ;
+                 ++entryIndex                                                ) {
+                cRowIndexes[destination] = inverseOrder[rowIndexes[entryIndex]];
+                cValues[destination]     = values[entryIndex];
+                ++destination;
+            }
+
+            cColumnStarts[k + 1] = destination;
+        }
+
+        // Elimination tree.
+
+        std::vector<unsigned long> parent(n, invalidIndex);
+        std::vector<unsigned long> ancestor(n, invalidIndex);
+        for (unsigned long k=0 ; k<n ; ++k) {
+            for (unsigned long long entryIndex=cColumnStarts[k] ; entryIndex<cColumnStarts[k + 1] ; ++entryIndex) {
+                unsigned long i = cRowIndexes[entryIndex];
+                while (i != invalidIndex && i < k) {
+                    unsigned long next = ancestor[i];
+                    ancestor[i] = k;
+                    if (next == invalidIndex) {
+                        parent[i] = k;
+                    }
+
+                    i = next;
+                }
+            }
+        }
+
+        // The pattern of row k of L is the set of nodes reachable in the elimination tree from the entries above
+        // the diagonal in column k of C.
+
+        std::vector<unsigned long> flag(n, invalidIndex);
+        std::vector<unsigned long> rowPattern;
+        rowPattern.reserve(n);
+
+        auto rowReach = [&](unsigned long k) {
+            rowPattern.clear();
+            flag[k] = k;
+            for (unsigned long long entryIndex=cColumnStarts[k] ; entryIndex<cColumnStarts[k + 1] ; ++entryIndex) {
+                unsigned long i = cRowIndexes[entryIndex];
+                if (i < k) {
+                    while (flag[i] != k) {
+                        rowPattern.push_back(i);
+                        flag[i] = k;
+                        i = parent[i];
+                    }
+                }
+            }
+        };
+
+        // Symbolic factorization.
+
+        std::vector<unsigned long long> columnCounts(n, 1);
+        for (unsigned long k=0 ; k<n ; ++k) {
+            rowReach(k);
+            for (unsigned long j : rowPattern) {
+                ++columnCounts[j];
+            }
+        }
+
+        lowerColumnStarts.resize(n + 1);
+        lowerColumnStarts[0] = 0;
+        for (unsigned long k=0 ; k<n ; ++k) {
+            lowerColumnStarts[k + 1] = lowerColumnStarts[k] + columnCounts[k];
+        }
+
+        unsigned long long numberFactorEntries = lowerColumnStarts[n];
+        lowerRowIndexes.resize(numberFactorEntries);
+        lowerValues.resize(numberFactorEntries);
+
+        std::vector<unsigned long long> nextEntry(n);
+        std::fill(flag.begin(), flag.end(), invalidIndex);
+        for (unsigned long k=0 ; k<n ; ++k) {
+            lowerRowIndexes[lowerColumnStarts[k]] = k;
+            nextEntry[k] = lowerColumnStarts[k] + 1;
+
+            rowReach(k);
+            for (unsigned long j : rowPattern) {
+                lowerRowIndexes[nextEntry[j]++] = k;
+            }
+        }
+
+        // Left-looking numeric factorization.  Column j is formed by subtracting the contributions of every column k
+        // with L(j, k) non-zero.  Because rows are processed in increasing order, nextEntry[k] always references the
+        // entry for row j in column k.
+
+        std::vector<Real> work(n, Real(0));
+        std::fill(flag.begin(), flag.end(), invalidIndex);
+        for (unsigned long k=0 ; k<n ; ++k) {
+            nextEntry[k] = lowerColumnStarts[k] + 1;
+        }
+
+        bool success = true;
+        for (unsigned long j=0 ; success && j<n ; ++j) {
+            for (unsigned long long entryIndex=cColumnStarts[j] ; entryIndex<cColumnStarts[j + 1] ; ++entryIndex) {
+                unsigned long i = cRowIndexes[entryIndex];
+                if (i >= j) {
+                    work[i] += cValues[entryIndex];
+                }
+            }
+
+            rowReach(j);
+            for (unsigned long k : rowPattern) {
+                unsigned long long entryIndex = nextEntry[k]++;
+                unsigned long long end        = lowerColumnStarts[k + 1];
+                Real               ljk        = lowerValues[entryIndex];
+
+                assert(lowerRowIndexes[entryIndex] == j);
+                for (; entryIndex<end ; ++entryIndex) {
+                    work[lowerRowIndexes[entryIndex]] -= lowerValues[entryIndex] * ljk;
+                }
+            }
+
+            Real diagonal = work[j];
+            work[j] = Real(0);
+
+            unsigned long long start = lowerColumnStarts[j];
+            unsigned long long end   = lowerColumnStarts[j + 1];
+            if (diagonal > Real(0)) {
+                Real ljj = std::sqrt(diagonal);
+                lowerValues[start] = ljj;
+
+                for (unsigned long long entryIndex=start+1 ; entryIndex<end ; ++entryIndex) {
+                    unsigned long i = lowerRowIndexes[entryIndex];
+                    lowerValues[entryIndex] = work[i] / ljj;
+                    work[i] = Real(0);
+                }
+            } else {
+                success = false;
+            }
+        }
+
+        if (success) {
+            currentFactorization = Factorization::CHOLESKY;
+        } else {
+            clear();
+        }
+
+        return success;
+    }
+
+
+    bool MatrixSparseSolver::luFactor(
+            const unsigned long long* columnStarts,
+            const unsigned long*      rowIndexes,
+            const Real*               values
+        ) {
+        unsigned long n = currentNumberRowColumns;
+
+        inverseRowOrder.assign(n, invalidIndex);
+
+        lowerColumnStarts.assign(n + 1, 0);
+        upperColumnStarts.assign(n + 1, 0);
+
+        unsigned long long initialCapacity = 4 * columnStarts[n] + n;
+        lowerRowIndexes.reserve(initialCapacity);
+        lowerValues.reserve(initialCapacity);
+        upperRowIndexes.reserve(initialCapacity);
+        upperValues.reserve(initialCapacity);
+
+        std::vector<Real>               work(n, Real(0));
+        std::vector<unsigned long>      visited(n, invalidIndex);
+        std::vector<unsigned long>      reach(n);
+        std::vector<unsigned long>      dfsStack;
+        std::vector<unsigned long long> dfsPosition(n);
+
+        dfsStack.reserve(n);
+
+        bool success = true;
+        for (unsigned long k=0 ; success && k<n ; ++k) {
+            unsigned long      originalColumn = columnOrder[k];
+            unsigned long long columnStart    = columnStarts[originalColumn];
+            unsigned long long columnEnd      = columnStarts[originalColumn + 1];
+
+            lowerColumnStarts[k] = lowerRowIndexes.size();
+            upperColumnStarts[k] = upperRowIndexes.size();
+
+            // Determine, in topological order, the rows that are non-zero in the solution of L x = A(:, k).  Row
+            // indexes in L are kept in the original row numbering until the factorization completes.
+
+            unsigned long top = n;
+            for (unsigned long long entryIndex=columnStart ; entryIndex<columnEnd ; ++entryIndex) {
+                unsigned long startRow = rowIndexes[entryIndex];
+                if (visited[startRow] != k) {
+                    dfsStack.push_back(startRow);
+                    while (!dfsStack.empty()) {
+                        unsigned long row         = dfsStack.back();
+                        unsigned long pivotColumn = inverseRowOrder[row];
+
+                        if (visited[row] != k) {
+                            visited[row]     = k;
+                            dfsPosition[row] = pivotColumn == invalidIndex ? 0 : lowerColumnStarts[pivotColumn] + 1;
+                        }
+
+                        bool finished = true;
+                        if (pivotColumn != invalidIndex) {
+                            unsigned long long end = lowerColumnStarts[pivotColumn + 1];
+                            while (dfsPosition[row] < end) {
+                                unsigned long child = lowerRowIndexes[dfsPosition[row]++];
+                                if (visited[child] != k) {
+                                    dfsStack.push_back(child);
+                                    finished = false;
+                                    break;
+                                }
+                            }
+                        }
+
+                        if (finished) {
+                            dfsStack.pop_back();
+                            reach[--top] = row;
+                        }
+                    }
+                }
+            }
+
+            // Sparse triangular solve.
+
+            for (unsigned long long entryIndex=columnStart ; entryIndex<columnEnd ; ++entryIndex) {
+                work[rowIndexes[entryIndex]] = values[entryIndex];
+            }
+
+            for (unsigned long p=top ; p<n ; ++p) {
+                unsigned long row         = reach[p];
+                unsigned long pivotColumn = inverseRowOrder[row];
+                if (pivotColumn != invalidIndex) {
+                    Real v = work[row];
+                    if (v != Real(0)) {
+                        unsigned long long end = lowerColumnStarts[pivotColumn + 1];
+                        for (unsigned long long entryIndex=lowerColumnStarts[pivotColumn]+1 ;
+                             entryIndex<end                                                  ;
+                             ++entryIndex                                                     ) {
+                            work[lowerRowIndexes[entryIndex]] -= lowerValues[entryIndex] * v;
+                        }
+                    }
+                }
+            }
+
+            // Select the pivot, preferring the diagonal entry if it is large enough.
+
+            unsigned long pivotRow       = invalidIndex;
+            Real          pivotMagnitude = Real(-1);
+            for (unsigned long p=top ; p<n ; ++p) {
+                unsigned long row = reach[p];
+                if (inverseRowOrder[row] == invalidIndex) {
+                    Real magnitude = std::abs(work[row]);
+                    if (magnitude > pivotMagnitude) {
+                        pivotMagnitude = magnitude;
+                        pivotRow       = row;
+                    }
+                } else {
+                    upperRowIndexes.push_back(inverseRowOrder[row]);
+                    upperValues.push_back(work[row]);
+                }
+            }
+
+            if (pivotRow == invalidIndex || !(pivotMagnitude > Real(0))) {
+                success = false;
+            } else {
+                if (inverseRowOrder[originalColumn] == invalidIndex                       &&
+                    visited[originalColumn] == k                                          &&
+                    std::abs(work[originalColumn]) >= diagonalPivotThreshold * pivotMagnitude) {
+                    pivotRow = originalColumn;
+                }
+
+                Real pivot = work[pivotRow];
+                upperRowIndexes.push_back(k);
+                upperValues.push_back(pivot);
+
+                inverseRowOrder[pivotRow] = k;
+                lowerRowIndexes.push_back(pivotRow);
+                lowerValues.push_back(Real(1));
+
+                for (unsigned long p=top ; p<n ; ++p) {
+                    unsigned long row = reach[p];
+                    if (inverseRowOrder[row] == invalidIndex) {
+                        lowerRowIndexes.push_back(row);
+                        lowerValues.push_back(work[row] / pivot);
+                    }
+
+                    work[row] = Real(0);
+                }
+            }
+        }
+
+        if (success) {
+            lowerColumnStarts[n] = lowerRowIndexes.size();
+            upperColumnStarts[n] = upperRowIndexes.size();
+
+            for (unsigned long& rowIndex : lowerRowIndexes) {
+                rowIndex = inverseRowOrder[rowIndex];
+            }
+
+            currentFactorization = Factorization::LU;
+        } else {
+            clear();
+        }
+
+        return success;
+    }
+
+
+    void MatrixSparseSolver::clear() {
+        std::vector<unsigned long>().swap(inverseRowOrder);
+        std::vector<unsigned long long>().swap(lowerColumnStarts);
+        std::vector<unsigned long>().swap(lowerRowIndexes);
+        std::vector<Real>().swap(lowerValues);
+        std::vector<unsigned long long>().swap(upperColumnStarts);
+        std::vector<unsigned long>().swap(upperRowIndexes);
+        std::vector<Real>().swap(upperValues);
+
+        currentFactorization = Factorization::NONE;
+    }
+}
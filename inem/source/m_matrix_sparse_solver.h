@@ -0,0 +1,238 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+*
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This header defines the \ref M::MatrixSparseSolver class.
+***********************************************************************************************************************/
+
+/* .. sphinx-project inem */
+
+#ifndef M_MATRIX_SPARSE_SOLVER_H
+#define M_MATRIX_SPARSE_SOLVER_H
+
+#include <vector>
+
+#include "m_intrinsic_types.h"
+
+namespace M {
+    /**
+     * Class that performs direct solves of sparse square systems of linear equations stored in compressed sparse
+     * column format.
+     *
+     * The class first computes a fill reducing ordering using an approximate minimum degree algorithm applied to the
+     * pattern of \f$ A + A ^ T \f$.  Symmetric matrices are then factored using a left-looking Cholesky factorization.
+     * Non-symmetric matrices, and symmetric matrices that are not positive definite, are factored using a
+     * left-looking LU factorization with threshold partial pivoting that prefers the diagonal.
+     */
+    class MatrixSparseSolver {
+        public:
+            /**
+             * Enumeration of supported factorizations.
+             */
+            enum class Factorization {
+                /**
+                 * Indicates no factorization is available.
+                 */
+                NONE,
+
+                /**
+                 * Indicates a Cholesky factorization, \f$ P A P ^ T = L L ^ T \f$.
+                 */
+                CHOLESKY,
+
+                /**
+                 * Indicates an LU factorization, \f$ P_r A P ^ T = L U \f$.
+                 */
+                LU
+            };
+
+            /**
+             * Value used to indicate an invalid index.
+             */
+            static constexpr unsigned long invalidIndex = static_cast<unsigned long>(-1);
+
+            /**
+             * Relative threshold used to accept the diagonal entry as the pivot during LU factorization.
+             */
+            static constexpr Real diagonalPivotThreshold = 0.1;
+
+            MatrixSparseSolver();
+
+            ~MatrixSparseSolver();
+
+            /**
+             * Method you can use to factor a square matrix.
+             *
+             * \param[in] numberRowColumns The number of rows and columns in the matrix.
+             *
+             * \param[in] columnStarts     The CSC column start array.  The array must contain numberRowColumns + 1
+             *                             entries.
+             *
+             * \param[in] rowIndexes       The CSC row index array.
+             *
+             * \param[in] values           The CSC value array.
+             *
+             * \return Returns true on success.  Returns false if the matrix is singular.
+             */
+            bool factor(
+                unsigned long             numberRowColumns,
+                const unsigned long long* columnStarts,
+                const unsigned long*      rowIndexes,
+                const Real*               values
+            );
+
+            /**
+             * Method you can use to determine the factorization that was used.
+             *
+             * \return Returns the factorization used.
+             */
+            inline Factorization factorization() const {
+                return currentFactorization;
+            }
+
+            /**
+             * Method you can use to determine the number of entries in the computed factors.
+             *
+             * \return Returns the number of stored entries in the factors.
+             */
+            unsigned long long numberFactorEntries() const;
+
+            /**
+             * Method you can use to solve \f$ A x = b \f$ for a single right hand side using the computed
+             * factorization.
+             *
+             * \param[in]  b The right hand side.  The array must contain one entry per matrix row.
+             *
+             * \param[out] x The location to receive the solution.  The array must contain one entry per matrix
+             *               column and must not overlap b.
+             */
+            void solve(const Real* b, Real* x) const;
+
+            /**
+             * Method that calculates an approximate minimum degree ordering of a symmetric sparsity pattern.  The
+             * diagonal should not be included in the pattern.
+             *
+             * \param[in] numberNodes The number of nodes in the graph.
+             *
+             * \param[in] adjacency   The adjacency list of each node.  The lists are consumed by this method.
+             *
+             * \return Returns the elimination order.  Entry k holds the node to be eliminated at step k.
+             */
+            static std::vector<unsigned long> approximateMinimumDegree(
+                unsigned long                            numberNodes,
+                std::vector<std::vector<unsigned long>>& adjacency
+            );
+
+        private:
+            /**
+             * Method that attempts a Cholesky factorization of the permuted matrix.
+             *
+             * \param[in] columnStarts The CSC column start array.
+             *
+             * \param[in] rowIndexes   The CSC row index array.
+             *
+             * \param[in] values       The CSC value array.
+             *
+             * \return Returns true on success.  Returns false if the matrix is not positive definite.
+             */
+            bool choleskyFactor(
+                const unsigned long long* columnStarts,
+                const unsigned long*      rowIndexes,
+                const Real*               values
+            );
+
+            /**
+             * Method that performs an LU factorization with threshold partial pivoting.
+             *
+             * \param[in] columnStarts The CSC column start array.
+             *
+             * \param[in] rowIndexes   The CSC row index array.
+             *
+             * \param[in] values       The CSC value array.
+             *
+             * \return Returns true on success.  Returns false if the matrix is singular.
+             */
+            bool luFactor(
+                const unsigned long long* columnStarts,
+                const unsigned long*      rowIndexes,
+                const Real*               values
+            );
+
+            /**
+             * Method that releases the current factors.
+             */
+            void clear();
+
+            /**
+             * The current factorization.
+             */
+            Factorization currentFactorization;
+
+            /**
+             * The number of rows and columns in the factored matrix.
+             */
+            unsigned long currentNumberRowColumns;
+
+            /**
+             * The column ordering.  Entry k holds the original column placed at position k.
+             */
+            std::vector<unsigned long> columnOrder;
+
+            /**
+             * The inverse row permutation.  Entry i holds the position of original row i.
+             */
+            std::vector<unsigned long> inverseRowOrder;
+
+            /**
+             * Column start array for the lower triangular factor.  The first entry of each column is the diagonal.
+             */
+            std::vector<unsigned long long> lowerColumnStarts;
+
+            /**
+             * Row index array for the lower triangular factor.
+             */
+            std::vector<unsigned long> lowerRowIndexes;
+
+            /**
+             * Value array for the lower triangular factor.
+             */
+            std::vector<Real> lowerValues;
+
+            /**
+             * Column start array for the upper triangular factor.  The last entry of each column is the diagonal.
+             */
+            std::vector<unsigned long long> upperColumnStarts;
+
+            /**
+             * Row index array for the upper triangular factor.
+             */
+            std::vector<unsigned long> upperRowIndexes;
+
+            /**
+             * Value array for the upper triangular factor.
+             */
+            std::vector<Real> upperValues;
+    };
+}
+
+#endif
@@ -40,8 +40,12 @@
 #include "m_per_thread_mt216091.h"
 #include "m_per_thread_xorshiro256_plus.h"
 #include "m_per_thread_xorshiro256_stars.h"
+#include "m_per_thread_xorshiro256_plus_x8.h"
+#include "m_per_thread_xorshiro256_stars_x8.h"
 #include "m_per_thread_trng.h"
+#include "m_per_thread_philox.h"
 #include "m_per_thread.h"
+#include "m_ziggurat.h"
 
 namespace M {
     static const Real oneThird = 1.0 / 3.0;
@@ -95,7 +99,6 @@ namespace M {
         currentConsoleCallback = consoleCallback;
         currentStatusInstance  = modelStatus;
 
-        gaussianHasSpareValue  = false;
         gammaLastShape         = std::numeric_limits<Real>::lowest();
         poissonLastRate        = std::numeric_limits<Real>::lowest();
         binomialLastN          = -1;
@@ -220,34 +223,8 @@ namespace M {
 
 
     Real PerThread::randomNormal() {
-        // This method uses the Marsaglia Polar Method to calculate two terms simultaneously.  Terms are used in
-        // alternating fashion.
-        //
-        // Longer term, we should consider Ziggurat's algorithm.
-
-        Real result;
-        if (gaussianHasSpareValue) {
-            gaussianHasSpareValue = false;
-            result = gaussianSpare;
-        } else {
-            Real w;
-            Real x1;
-            Real x2;
-
-            do {
-                x1 = 2.0 * randomInclusive() - 1.0;
-                x2 = 2.0 * randomInclusive() - 1.0;
-
-                w = x1 * x1 + x2 * x2;
-            } while (w == 0.0 || w >= 1.0);
-
-            w = std::sqrt(-2.0 * std::log(w) / w);
-
-            gaussianSpare = x2 * w;
-            result        = x1 * w;
-        }
-
-        return result;
+        // This method uses the Ziggurat algorithm.  Almost every call consumes a single 64-bit random value.
+        return Ziggurat::normal(rng->random64(), *this);
     }
 
 
@@ -514,6 +491,39 @@ namespace M {
     }
 
 
+    bool PerThread::jump() {
+        bool result = rng->supportsJumps();
+        if (result) {
+            rng->jump();
+        }
+
+        return result;
+    }
+
+
+    bool PerThread::longJump() {
+        bool result = rng->supportsJumps();
+        if (result) {
+            rng->longJump();
+        }
+
+        return result;
+    }
+
+
+    bool PerThread::selectSubstream(const RngSeed& rngSeed, unsigned substream) {
+        bool result = rng->supportsJumps();
+        if (result) {
+            rng->setRngSeed(rngSeed, 0);
+            for (unsigned i=0 ; i<substream ; ++i) {
+                rng->jump();
+            }
+        }
+
+        return result;
+    }
+
+
     void PerThread::sendToDevice(M::Device device, const Model::Variant& value) {
         if (currentStatusInstance != nullptr) {
             currentStatusInstance->sendToDevice(device, value);
@@ -550,6 +560,21 @@ namespace M {
                 break;
             }
 
+            case RngType::PHILOX4X32_10: {
+                rng = new Philox;
+                break;
+            }
+
+            case RngType::XORSHIRO256_PLUS_X8: {
+                rng = new XorShiRo256PlusX8;
+                break;
+            }
+
+            case RngType::XORSHIRO256_STARS_X8: {
+                rng = new XorShiRo256StarsX8;
+                break;
+            }
+
             default: {
                 rng = nullptr;
                 assert(false);
@@ -589,6 +614,21 @@ namespace M {
                 break;
             }
 
+            case RngType::PHILOX4X32_10: {
+                rng = new Philox(rngSeed, extra);
+                break;
+            }
+
+            case RngType::XORSHIRO256_PLUS_X8: {
+                rng = new XorShiRo256PlusX8(rngSeed, extra);
+                break;
+            }
+
+            case RngType::XORSHIRO256_STARS_X8: {
+                rng = new XorShiRo256StarsX8(rngSeed, extra);
+                break;
+            }
+
             default: {
                 rng = nullptr;
                 assert(false);
@@ -38,6 +38,173 @@
 namespace M {
     const std::uint64_t PerThread::MT19937::mag01[2] = { 0, PerThread::MT19937::matrixA };
 
+    /* Jump polynomials were calculated by recovering the characteristic polynomial of the recurrence using the
+     * Berlekamp-Massey algorithm and then reducing t^(2^k - 1) modulo that polynomial by repeated squaring.
+     */
+    const std::uint64_t PerThread::MT19937::jumpPolynomial[PerThread::MT19937::stateVectorLength] = {
+        0x0A9FDE11A04D8F18ULL, 0xDC6AC5177E0E63DFULL, 0x026646FB5EAAB9F0ULL, 0xC70DCCEB751913AAULL,
+        0x3FD2E45588D3C767ULL, 0xD1F80CC97C3CEE13ULL, 0x3BA80731494EBA68ULL, 0x2632F7A1CF96E595ULL,
+        0x398D9DE9A9C77623ULL, 0x8A66AB262064F1D7ULL, 0xB7FB2B3BBA91345BULL, 0x5DF50826247645C6ULL,
+        0x0469AB2CB92B4752ULL, 0x2E5BCED8FBB9CAF9ULL, 0xCA7AE1A451967656ULL, 0x25AC661C5B091F6BULL,
+        0xB268C8D0059F1B16ULL, 0x3D828B0ADE082B2CULL, 0x15688F16C0970AE9ULL, 0xE92A8E8AE4A2790CULL,
+        0xB41BA12A68FA3442ULL, 0x3952FEBB807461A7ULL, 0x7205A5630F0A1BB6ULL, 0x5D883E68548AC660ULL,
+        0xA8145151EA671473ULL, 0xE840AF759748D502ULL, 0x94DD1C37B184F3EEULL, 0x50CDF894048EFB21ULL,
+        0x526ED1F52D7923FCULL, 0x4A87F9645E46CF98ULL, 0x620AD0438F78D7A7ULL, 0x7442CEBD2D619326ULL,
+        0x26AC735F6839CFF1ULL, 0xD8396A3A71FCB016ULL, 0xC9D88901AE78719EULL, 0xC86A57AB2105051EULL,
+        0x65C9866FFE84DD43ULL, 0xC1182A09E3B5D025ULL, 0x4476B0DD3EFE483AULL, 0xEF7E3AD3C34E0A2EULL,
+        0x860B48B34B3BAB2CULL, 0xCA523DF85AE9C34DULL, 0x8136223B712A8BCCULL, 0x95916C8013FEEBA3ULL,
+        0x7223D7BB8C3223BBULL, 0x5DC1F8E018C8707DULL, 0xC997D5E38BD988A6ULL, 0xF01C2020EDEAF57EULL,
+        0xB4C654D11827D44AULL, 0xDDD9377FA717B313ULL, 0xA29E55CB3D238322ULL, 0x153577D5E68CEA74ULL,
+        0xC047C6999207B5C8ULL, 0xC8DFA3649D25C295ULL, 0xBA5B542CB880734BULL, 0x5E9527791CAB2044ULL,
+        0xCC8BB8C70476127DULL, 0x564E73286E662EB0ULL, 0x296DA6BB5162AA36ULL, 0x8091F07E1E5C8575ULL,
+        0xFF3C78F41DDC9B1AULL, 0xA7ADB9CEADD02428ULL, 0x525FBFCB74B42544ULL, 0x2A325D9BBD4BFB17ULL,
+        0x994499F803670A5FULL, 0x21F2AC5BEB1572EBULL, 0x6ED8799F90F3EC6EULL, 0xA9693BCEF4999069ULL,
+        0xAB8C8E39567E2849ULL, 0x0BBC9C240CE50074ULL, 0x3D7E7DDF15655342ULL, 0xC8118EABC4253AA2ULL,
+        0xEE9FFF56A7F76371ULL, 0x939AC252178D3CAEULL, 0xB48B0099C6963A24ULL, 0x464720CE50294FE1ULL,
+        0x9B9F1BEE828FC5C3ULL, 0x13D16B8B0FB6835EULL, 0x4AA120038239188DULL, 0xA38AB2DB0549E972ULL,
+        0xA7DA56CB1619409AULL, 0xBD8D1D496200F49DULL, 0x7930E1FE641578A0ULL, 0xAB920D7844BC79F6ULL,
+        0x163CD551B868DEA7ULL, 0xF9ABC8504BC09BEBULL, 0x9C63931E4B11A11CULL, 0x70509D0EEAFC295AULL,
+        0x839A7B64B17C3401ULL, 0x65292B27B9789F88ULL, 0x525E954EE34D0924ULL, 0x37A0C50276DA2F4CULL,
+        0xBB25ABD002CD538DULL, 0x4937B7AF9AA1336FULL, 0x30620A8009E64A09ULL, 0x9D0A4C064EA666CBULL,
+        0x272ED19CA211CEC5ULL, 0x91F9F7B7421E394EULL, 0x1C4D88116F0563E4ULL, 0x9B4D94EBE942C11FULL,
+        0xFAAB10A56B1F166CULL, 0x48721DCA9B5E0AD5ULL, 0xD21B02003F11FEC2ULL, 0x387715EC6CF36157ULL,
+        0x8745B63D3BFEA135ULL, 0xF684A0BE706B9E6FULL, 0x51F49AF1640D2010ULL, 0xBE7970459441CC7DULL,
+        0x8F499E6F4B51888AULL, 0xEDB00A61D3C062B0ULL, 0x95F8ACA85A3307CEULL, 0xA867B177E4051E2AULL,
+        0xA2476F017503C1E2ULL, 0x4BEF868A7B2600E3ULL, 0x09A99ABEAA19B468ULL, 0xCDE8A24B2966E54EULL,
+        0xB368AD77D3D12190ULL, 0x92EEBAFE3A495D4EULL, 0xA34674D0D1C3A709ULL, 0xA055CF476B3D2568ULL,
+        0x85D7DA6991E8133BULL, 0x7CF9E80E0FA1ADB4ULL, 0x062507D237D632B5ULL, 0xDED61D5EE9BF26FEULL,
+        0xEFCD837782ED98EFULL, 0x76802F8079BED53DULL, 0xC925F17232D84A08ULL, 0x4C84C9BB7543DF2BULL,
+        0x9816C53E24E25F35ULL, 0xF477FE382A0E03D2ULL, 0x372308D68CB53771ULL, 0x5EA1658AD2965914ULL,
+        0x671A1F7249E6F610ULL, 0xBFA118F1E9074739ULL, 0x51093E976C0F27C4ULL, 0x13DD9957D0E377A6ULL,
+        0x4E9BECFA65C3E249ULL, 0xD35BF4A58AF1143EULL, 0x04C5A698170B6B74ULL, 0x0968ED47FDF9D6D9ULL,
+        0xEADF0AADE17E00EFULL, 0x487B185CF184B8ADULL, 0x5ED884587C6D109EULL, 0x4C76A906B8FA4E8DULL,
+        0x4124AD5668CF5CEEULL, 0x8926BA3C50A812D9ULL, 0x5075B03F62043BBAULL, 0xE5A3CAAF755F0448ULL,
+        0x39B051E8705B45C4ULL, 0x92FADF732B0ACEC9ULL, 0x757421A709FCC2F6ULL, 0x027F9C3915688543ULL,
+        0x56384B90ADA1A140ULL, 0x9B20574EE8343D8DULL, 0xD92104D2674FB01DULL, 0xF81F37EB7BD20B6EULL,
+        0xE98F2DE6F2433957ULL, 0x9382673075C214D3ULL, 0x7BD75C0FC7E68061ULL, 0x2A126DD505B1B51EULL,
+        0x79A97F1286B12D32ULL, 0xCE6092AB611147C3ULL, 0xF6D606DDCA74A7A8ULL, 0xEEC7958F933B17E8ULL,
+        0xAF7A4403B63F4ABFULL, 0x95B9A6E452361E30ULL, 0x29088AC4F5951171ULL, 0x7D08E4DDC21EFA5EULL,
+        0x2C4B5617679B7CE9ULL, 0xB360CBD3F24EDD05ULL, 0xF0F6D166A3D77E87ULL, 0xA6570567AEAFD316ULL,
+        0x659F10F1FC6BE4A1ULL, 0x9A8AC0693DBAFF22ULL, 0xB65EA5AB0C65D5CDULL, 0xC723F782A174528EULL,
+        0x892D6FB5A5ACD977ULL, 0x1394EE19A6567EADULL, 0xC41A19539BC9BC10ULL, 0x30780160EE76D255ULL,
+        0xD7F68DF2373FE95EULL, 0x7951E8E65FC3888AULL, 0x7C2F2E28285738B0ULL, 0x3BBE6E222AA736BAULL,
+        0x05E7BA909F12CCA3ULL, 0xCE838A5A6DCE514DULL, 0x1B87EE2033993536ULL, 0x7FF5B89C03D0E754ULL,
+        0xBFD854B3A529F3C9ULL, 0xB15820002FCE73DDULL, 0x4481FB59415B3E55ULL, 0x9AA27F8AC01375A9ULL,
+        0x6B32C812456FC978ULL, 0x2AEF0E43D175EFA4ULL, 0x20581C1143933D5DULL, 0x3EFD2B537D930C07ULL,
+        0xA2E196BEE3358CE7ULL, 0x7AF6876FB3281A63ULL, 0x7A63D6DF3AF0AED0ULL, 0xCAEDC29AF05EC891ULL,
+        0xE2B8D84B106C1389ULL, 0xCE10F6873C7810FCULL, 0x6865A854FCD546F7ULL, 0xDE599B46274FFADBULL,
+        0x036C7B24B8249CD1ULL, 0x2F554F70C368A52AULL, 0xC368FCB97EA441E8ULL, 0xB1D8A917A6A86C43ULL,
+        0x4C1597DD0D4C3AD3ULL, 0x392C5FEB11AC9875ULL, 0x72666471E1787B87ULL, 0x4DF9C8688CBB49B1ULL,
+        0x0DE7514EDE96015FULL, 0x6CE0C4EDA099CC60ULL, 0x4C455222B27C2A1AULL, 0x003F68F5777AF105ULL,
+        0x50342FF6F07762CBULL, 0xFF78BBF059AD3F87ULL, 0x28032CB78C8F5E30ULL, 0xE5D43E1F30DEDE45ULL,
+        0xFF90BA024834DFE5ULL, 0xEBD29B6ED962799FULL, 0x7BD766F10FE16CBBULL, 0xE090EE51FF77BC00ULL,
+        0x54856C93E812E0B5ULL, 0x9F537F729902C74BULL, 0xCFA9086F98566F5CULL, 0xA9074A444C1BDE7FULL,
+        0x4636350806D5EDADULL, 0xB69080F9FE2983BAULL, 0xA8EA9AF36E322F24ULL, 0xF2F3B1076B524A0DULL,
+        0x57C011E083823121ULL, 0xB1737207A750CB00ULL, 0xA331CB670D5C749CULL, 0x2387E1A2680D1534ULL,
+        0x911808FC0B2A4F87ULL, 0x4D85200B9994CE2BULL, 0x3710A291D730599AULL, 0x426265F22D4DB353ULL,
+        0x31869CFC915A605AULL, 0x7DFD3CF616070809ULL, 0x74CA0242F6406AE0ULL, 0x8EE0E37DAD00F995ULL,
+        0x4E685BF9D2BC72BFULL, 0xA05B674EA8749602ULL, 0xAC45C579CD5C8EC0ULL, 0xC02C6E13C1D816F1ULL,
+        0xDD9081E2821C964EULL, 0x393234911038B108ULL, 0xEDC027E6F5CC3DDDULL, 0xD5D5E995249CC343ULL,
+        0xF1EF71BAADA6D43AULL, 0x0B6F399D6DC5DB90ULL, 0xCCA3B689881FFF19ULL, 0xC3696B14B336582DULL,
+        0xCE273155BA067322ULL, 0xDACB41132DBA8CFFULL, 0x2A6FB49874F6A1FDULL, 0x19FC10C430FCC5B4ULL,
+        0x90DE3A4AA178328BULL, 0x6AF4B315A2C36FBFULL, 0xA32AB4F5075AE672ULL, 0x9B5242649C78573AULL,
+        0x60446628C4FC01CCULL, 0x25F668D45114066FULL, 0x8C979053A6D60378ULL, 0xD73B3545943D0AB2ULL,
+        0x81B602DD355FFAF9ULL, 0x2FF224249EC7D7B4ULL, 0xD440547FCA5C8754ULL, 0xE8763E31A1695BBDULL,
+        0xE8C3EB8345167C87ULL, 0x19291FCD6C173349ULL, 0x87C3A10743DC8393ULL, 0x1D3A2FCA9EC7061AULL,
+        0x00CCCC9E2D1E8EDAULL, 0x19F22DABB36658D0ULL, 0xE955D560B1370586ULL, 0x56AE1811D830FEFDULL,
+        0x7B3E7B2A0E5B3729ULL, 0x74EC841E31AD10C8ULL, 0x14D081F061DA6D64ULL, 0x3AFB956DAF3D3F23ULL,
+        0xEE64A1D597614B6DULL, 0x9CB503CF89BFF8A5ULL, 0x33C29F9E948C1760ULL, 0x1AEE9F3D3D38E3C0ULL,
+        0xFDFC1537D13AD2A3ULL, 0x9CE62C53AC1FB913ULL, 0x458D8D76F7F54FF6ULL, 0x484FA2BED6D38A28ULL,
+        0xE0155FE5FF1F1C3DULL, 0xEB438F0C5BCD71E0ULL, 0xCFB5D6231A278D07ULL, 0x99B366BC100D5E76ULL,
+        0x54ED2529038BA94CULL, 0x0183215D78D6A811ULL, 0xAD7090334D422558ULL, 0x6C7E09643B5AEDDBULL,
+        0x17C95A09D37E371AULL, 0x1795AD35879857FAULL, 0x44B19D8B0FD63ABDULL, 0xAF25F90E5159CCE1ULL,
+        0xAF6C1A7CAAEE7B55ULL, 0xEAFEE406B7D47366ULL, 0x66F84F6CCAA2034FULL, 0xFD4D6E42AF2994BEULL,
+        0x1C7D18A6AE2355A9ULL, 0x4A284602EED13503ULL, 0x3EF16D715520AE96ULL, 0x00000000A1F6B797ULL
+    };
+
+    const std::uint64_t PerThread::MT19937::longJumpPolynomial[PerThread::MT19937::stateVectorLength] = {
+        0x6E137B5A1D368234ULL, 0x37F8438C00DAB43AULL, 0xBF8F1B6BC85FEBF0ULL, 0xFA6F902D34A05B84ULL,
+        0x462522E79268D4B1ULL, 0xE44C17459DC1A026ULL, 0x4E09737A4B423E3EULL, 0x65A097D7F3C3B4BFULL,
+        0xB72945D5FB9AD345ULL, 0xE4187BD1DDAB01A9ULL, 0xFC07794415862DDDULL, 0x4ACC9CEF412149D2ULL,
+        0x8F41E2DEDCA61336ULL, 0xA08F9F4B75075265ULL, 0x436ABBEE6BCC2B16ULL, 0xA7CBB5CF859A53D9ULL,
+        0xA7E67E6D40EA97D1ULL, 0xE16B61771BCE1D55ULL, 0x15F7EDE9EE0B9E55ULL, 0xEFC56DF28C9507C6ULL,
+        0x96384A175FABFD0FULL, 0x440A865F3F8F25D9ULL, 0x3A65AB4F7D779D76ULL, 0x632ABF2CD7F6E3D5ULL,
+        0xA0367B4CB4A68AD3ULL, 0x47F04B2908B35674ULL, 0xFDDC76D18F59FEAEULL, 0x0EB030D7B577BAB5ULL,
+        0x4D10249FF6B33007ULL, 0x93F6495AD8910B5CULL, 0xE67D3F181DB117F3ULL, 0x90BF166283B35759ULL,
+        0xD587BAABF62732ECULL, 0x897AC57D8A754EB9ULL, 0xF6DDCDA4D1071228ULL, 0x5929B77568C27936ULL,
+        0x8A8D099577CFB5A2ULL, 0xBDCB06E165191422ULL, 0xEB902A5BECC67338ULL, 0x04FEC24E6777A2EBULL,
+        0x35A8B670886877B5ULL, 0xE90C35333B2B1E39ULL, 0x064F0DB69B16CDFBULL, 0x0AD4C7C3EAAB745DULL,
+        0x8FA3410155E48A64ULL, 0xE03B13A5F301A428ULL, 0xF5B3E8B13CB79039ULL, 0x9B7BA1AD1E94413FULL,
+        0x3D29242C6B946E51ULL, 0x4A8E8B066A93E5E0ULL, 0xC933856C4A2A046CULL, 0x0AC2094AFBBAD813ULL,
+        0xB0F63520C2D7CF3AULL, 0xCB8C147287A1C078ULL, 0xC7BE20283CE64DB9ULL, 0xB6B1F859AD225950ULL,
+        0x819C74D0A539BFC5ULL, 0x0E7B77BFF3F576BCULL, 0x9EA45055BAE33718ULL, 0x8A29E7D21B964C3DULL,
+        0x8B61C4E0B4743221ULL, 0xD5FB23A20BD73626ULL, 0xBC38D02B034D5DDDULL, 0xD8C0FBFAF2F12275ULL,
+        0xA01568F96EDC86E9ULL, 0x454ABBB93B46C48FULL, 0x520D114309E2E122ULL, 0xEB27F1D774149A35ULL,
+        0x4B8CE1C3400B554DULL, 0x7A43808E8C851AE4ULL, 0x975887E30D9CA0C4ULL, 0x6182A4AC2B152949ULL,
+        0x2D6F771406A55D8CULL, 0x17C0BD9E2267BF5DULL, 0xE6092866992FE5EEULL, 0xC4826321662F5B70ULL,
+        0xF9187C79F3B0F3E1ULL, 0x5DF5432D81435646ULL, 0xB85E0372B64BFB17ULL, 0x24981ACA4E2E2A0AULL,
+        0x186A80002EF551EAULL, 0x01E2B1B4BC13182AULL, 0x280FDD5D086DCFD1ULL, 0xC14854419A31DDCAULL,
+        0x7CDA8A2A8FA64725ULL, 0x639C727D68AE54A2ULL, 0x30431CCB49A28F67ULL, 0xB51377A730FDFE76ULL,
+        0x0A627AC629C0E87AULL, 0xE42C37073C9DCFEEULL, 0x4F2CCDAA248C89B4ULL, 0xC280F812740BA942ULL,
+        0x6BFC6830BA2C0488ULL, 0x192F61CDA8C58F6DULL, 0x0350E911BF3590A1ULL, 0x7F6BDA56E61B2C12ULL,
+        0x1DBB994BF183ADBBULL, 0xAB161A7F8843AF7EULL, 0x24916F654FAA244EULL, 0x6BABBEF29B95F6F9ULL,
+        0x6E2B0484BB78E9B9ULL, 0xBC349DF1BAD9FEBEULL, 0x6E428F9261BD4CB3ULL, 0x24D80CD2E1C26472ULL,
+        0x480147CFC44BB8DEULL, 0x19F6D307EEDE2B7AULL, 0x1545DBCC9D9E44D3ULL, 0x2BD64871221A0253ULL,
+        0x556C27ACC1C6A99BULL, 0x45365BFB15718522ULL, 0xA031E03D0C66FA2EULL, 0x52AC885743ADB7EBULL,
+        0x6188288EEB73320DULL, 0xBC09E8269EC1947DULL, 0x19C6FF2ADD63AEDEULL, 0x03B942386D509153ULL,
+        0x6A60C8DFF7DA4E5CULL, 0x56F0B47CE2AF36BAULL, 0x3175360EB9E9C88DULL, 0xB5D976B567FC3269ULL,
+        0x5E2956B508945CA0ULL, 0xC5009F45C31C5C8BULL, 0x814A48B1DFA3144EULL, 0xE1D1F31A674C34F9ULL,
+        0xE352BADE2F3C52E4ULL, 0x3BBB924E66357A0EULL, 0x2D17A6B75DEC43DEULL, 0xD514B196FB4B07E1ULL,
+        0x4CE8124F83143452ULL, 0xEA88A0B54367E799ULL, 0x434CC17A968F62C1ULL, 0x8AECA19932404129ULL,
+        0x073CC2BD7EED888DULL, 0xC792F8B8611B2985ULL, 0xFA498BDBBD082EEAULL, 0x3CD5F637DC14E821ULL,
+        0xC90F353065660CD5ULL, 0x653E249FB21534D5ULL, 0xC0184A58D7514EACULL, 0x46217FB030AD045EULL,
+        0x76AD1CE9BE9D2996ULL, 0x369B28F35C76765BULL, 0xF975B6458A9900F3ULL, 0x67D60998A13938D0ULL,
+        0xF50FA1FED2836722ULL, 0x0074FE2E43A78033ULL, 0xBE1B334A3E9DEA82ULL, 0x4FEE29BA9E64BFCEULL,
+        0x5990FF4D352632A9ULL, 0xC89C16FDAFF7E3D8ULL, 0x5009DBE48F45B91CULL, 0x0A0C9C70A26F8EDBULL,
+        0x025C2F978B677693ULL, 0xD1EDD652652707D7ULL, 0x34022F26078F1D56ULL, 0x04C21F1008D4D0DAULL,
+        0x991272DABEDABF19ULL, 0xF49FF382D6B8E8A1ULL, 0x811CA7702CD00BABULL, 0xE7A1B75871D8F5D1ULL,
+        0x2CBBCC8C12891C30ULL, 0x543B375A665D5FB0ULL, 0x241EF5F946833490ULL, 0xA876707CCABCDE11ULL,
+        0xF94B051887A9B307ULL, 0x2436085B8348D313ULL, 0x6F96E9B3FCF6DB66ULL, 0xED525951F195AAF8ULL,
+        0xCC42D7E8DF765A51ULL, 0x5AB46F771D2C5486ULL, 0x7239F067A0101ECAULL, 0xBAA609200340EA59ULL,
+        0x55FC350296E9C922ULL, 0x7EDFE063C1E4FBC9ULL, 0xB750F964431A9E3CULL, 0xAD07767904A4025FULL,
+        0x241FC3A9C7183379ULL, 0xB82FBC2AF453E61CULL, 0x24CA04E94140D695ULL, 0x9F8CCA03D009EEBDULL,
+        0x34AEC6697DAB8291ULL, 0x12A36D527B7F10B1ULL, 0xD4491C27B53FC910ULL, 0xC2567E21CCD67608ULL,
+        0x4CCC5D907A6CE1FFULL, 0xD5147FF1BA836FE9ULL, 0x8C2B6D05765487E9ULL, 0xCBD579D03792744DULL,
+        0x71746AFA4ADE8BA2ULL, 0x38F27D97E18C2FA1ULL, 0xE335928CE2793C25ULL, 0xED0C2B6AB4E40FFAULL,
+        0x47F4E63E64E217AEULL, 0xE6877CF7E7872E86ULL, 0xEEE0D93BC37285A6ULL, 0xFE37C897B7DE72B8ULL,
+        0xC3783546CD85897BULL, 0xACDA2A21D7AF7D7CULL, 0x2C0614149062B0F5ULL, 0xF5E393DF95C11197ULL,
+        0xBF4B90F650338536ULL, 0xF44465410B642F53ULL, 0x3AA8F788C6F6D47BULL, 0xFAD9201BCB885973ULL,
+        0xFA30432518D5C788ULL, 0x4F3960E28819E261ULL, 0xD3E8DFB96C07A181ULL, 0x2FCC7FBC94B262D9ULL,
+        0x4EC569125D8C0CBAULL, 0x29EE5509D0285F23ULL, 0x2AD22EB676D60774ULL, 0x1316122A612D0AA4ULL,
+        0xCBCAD2849FDCA216ULL, 0x6F565E2EAC424F1BULL, 0x96299936AFE669C4ULL, 0x4BECDBEA31487C2EULL,
+        0x92DD57A00598290EULL, 0x6C59902C76896A17ULL, 0x4A573711F78F71E7ULL, 0x55D8A7790CB989FEULL,
+        0x818D4FB213922A0AULL, 0x60F3A400E64424A1ULL, 0xAA4DAE51D10B4FE8ULL, 0x115B7ADEB3EC1BA7ULL,
+        0xEB30BEFBD733EEA7ULL, 0xAF42D084E5312413ULL, 0x206179C53BB679EEULL, 0x4DCCD0D3B9B38B0DULL,
+        0xA3344C0CC6D5CD6EULL, 0x0738B273E63CD3E7ULL, 0x88E95B213AE23AB5ULL, 0x952FEC1D7952AB69ULL,
+        0xB1FF8ADEC631158FULL, 0xD315F77D0DFD0A7AULL, 0x979C8E083F154FE2ULL, 0x484E5E94EE6483EFULL,
+        0x21C6A837124ACC03ULL, 0x4148E3C0863499ABULL, 0xA9957F6F514F7458ULL, 0x067BB264BD2ABA17ULL,
+        0x07EAC0AC831F2767ULL, 0xBB27D1FC85C6AD94ULL, 0x456550B22BB22488ULL, 0x40ABC8A91F6BB410ULL,
+        0x7C6867165E93D093ULL, 0x6268BFC4566F4A39ULL, 0xA92366F272CF3DFFULL, 0xB027419D65B97DA9ULL,
+        0xB4C516270430D053ULL, 0xF249C097AEB6305CULL, 0x29A3938A41B7D53FULL, 0x508C0FDCEA8BAA89ULL,
+        0xF8689E746EA0F389ULL, 0xD7F2E5EDCDCA6D41ULL, 0xD8698CB921F07678ULL, 0xF0003F046FFEE627ULL,
+        0x62BCA7971ABBA37BULL, 0xF7497190C1798C1DULL, 0x2DD9778D1C6601ACULL, 0xE5E10542523335D2ULL,
+        0x09526C2CA4B13009ULL, 0xC1B4200710FBF31AULL, 0xCE3638954D683E70ULL, 0x1A36CC22D588AC8BULL,
+        0x96914E0822944E7BULL, 0x84D8EADB3582D3F1ULL, 0x829C74C9339EAF37ULL, 0xD89A3A45DC9E0B1BULL,
+        0x88F74EF2D8504542ULL, 0xCF5F25BF9AE4ED7FULL, 0x78BAFBF47C37BF9CULL, 0xDE5198E6A1DA3C83ULL,
+        0xFE1FD1EA4B2FD0E7ULL, 0x3A2A5E83F385506AULL, 0x00F620843BABFE49ULL, 0x66198379026930EDULL,
+        0xB10FACC796F28A30ULL, 0x71FFD95C340E97CBULL, 0xECF127024AA649DFULL, 0x33A7945047FB33DBULL,
+        0x481CAA02251AE739ULL, 0x80D5DA47E2B05CABULL, 0xFC9F0F07F2B4F123ULL, 0x9E315418210378AFULL,
+        0x618FE18E3C40000EULL, 0x6710FDA9ADB9FA73ULL, 0x12128F861D59ADE7ULL, 0x276AFF905A68F200ULL,
+        0x38DF56A6A9951199ULL, 0xF0E345645594B301ULL, 0x667BB1646024AE88ULL, 0xB1EFC70781907C28ULL,
+        0xBED2CBBE2712A3F3ULL, 0xB1469931FB4F2A5CULL, 0x67C88A10C79091D3ULL, 0xF224690911C0E636ULL,
+        0x155082CFAFA6A9C3ULL, 0x5D6EB49B178C0729ULL, 0xEEE3D80C7CB09222ULL, 0x06C1DA89D1C422EAULL,
+        0x4999FAD12DAF8BB7ULL, 0x827BEFE616F45396ULL, 0x994259DCEB4B851AULL, 0x33EB1146D039F956ULL,
+        0x400E36793240A9F9ULL, 0xFA8A2A31000ADE68ULL, 0xAAD9FA81543D0D98ULL, 0x2EB1F8296B551E90ULL,
+        0xD3A2B3E63EDF8144ULL, 0x0F126255093682E0ULL, 0x2C1D9CC174597C71ULL, 0x000000018F2B116DULL
+    };
+
+    constexpr unsigned PerThread::MT19937::characteristicDegree;
+
     PerThread::MT19937::MT19937() {
         RngSeed seed;
         trng(reinterpret_cast<std::uint32_t*>(seed), sizeof(RngSeed) / sizeof(std::uint32_t));
@@ -197,6 +364,71 @@ namespace M {
     }
 
 
+    bool PerThread::MT19937::supportsJumps() const {
+        return true;
+    }
+
+
+    void PerThread::MT19937::jump() {
+        applyJumpPolynomial(jumpPolynomial);
+    }
+
+
+    void PerThread::MT19937::longJump() {
+        applyJumpPolynomial(longJumpPolynomial);
+    }
+
+
+    void PerThread::MT19937::applyJumpPolynomial(const std::uint64_t* polynomial) {
+        // The generator is linear over GF(2).  Advancing by J values is done by evaluating the jump polynomial,
+        // t^(J-1) modulo the characteristic polynomial, at the single step transition and applying the result to a
+        // window holding the next 312 raw values.  The window is stepped once first to flush the low 31 bits of its
+        // first entry, which never feed back into the recurrence.
+
+        std::uint64_t extended[2 * stateVectorLength];
+        std::memcpy(extended, stateVector, sizeof(stateVector));
+
+        for (unsigned i=0 ; i<stateVectorIndex ; ++i) {
+            std::uint64_t x = (extended[i] & upperBits) | (extended[i + 1] & lowerBits);
+            extended[i + stateVectorLength] = (
+                extended[i + splitPoint] ^ (x >> 1) ^ mag01[static_cast<unsigned>(x & 1)]
+            );
+        }
+
+        std::uint64_t window[stateVectorLength];
+        std::uint64_t result[stateVectorLength];
+        unsigned      start = 0;
+
+        std::memcpy(window, extended + stateVectorIndex, sizeof(window));
+        std::memset(result, 0, sizeof(result));
+
+        for (unsigned step=0 ; step<=characteristicDegree ; ++step) {
+            if (step > 0 && ((polynomial[(step - 1) / 64] >> ((step - 1) % 64)) & 1) != 0) {
+                unsigned numberAtEnd = stateVectorLength - start;
+
+                for (unsigned i=0 ; i<numberAtEnd ; ++i) {
+                    result[i] ^= window[start + i];
+                }
+
+                for (unsigned i=0 ; i<start ; ++i) {
+                    result[numberAtEnd + i] ^= window[i];
+                }
+            }
+
+            unsigned      next  = start + 1 < stateVectorLength ? start + 1 : 0;
+            unsigned      split = start + splitPoint < stateVectorLength ? start + splitPoint : start - splitLength;
+            std::uint64_t x     = (window[start] & upperBits) | (window[next] & lowerBits);
+
+            window[start] = window[split] ^ (x >> 1) ^ mag01[static_cast<unsigned>(x & 1)];
+            start         = next;
+        }
+
+        std::memcpy(stateVector, result, sizeof(stateVector));
+        stateVectorIndex      = 0;
+        needNewDecomposeValue = true;
+    }
+
+
     void PerThread::MT19937::updateStateVector() {
         std::uint64_t x;
         unsigned      i = 0;
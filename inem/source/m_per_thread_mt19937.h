@@ -149,6 +149,24 @@ namespace M {
              */
             void fillArray(void* array, unsigned long numberValues) override;
 
+            /**
+             * Method you can use to determine if the RNG supports jump-ahead.
+             *
+             * \return Returns true.
+             */
+            bool supportsJumps() const override;
+
+            /**
+             * Method you can use to advance the RNG by 2^128 values.  Identically seeded instances advanced by a
+             * different number of jumps produce non-overlapping sequences.
+             */
+            void jump() override;
+
+            /**
+             * Method you can use to advance the RNG by 2^192 values.
+             */
+            void longJump() override;
+
         private:
             /**
              * The alternation matrix.
@@ -195,11 +213,33 @@ namespace M {
             static constexpr std::uint64_t initializerValue3 = 3935559000370003845ULL;
             static constexpr std::uint64_t initializerValue4 = 2862933555777941757ULL;
 
+            /**
+             * The degree of the characteristic polynomial of the generator's linear recurrence.
+             */
+            static constexpr unsigned characteristicDegree = 19937;
+
+            /**
+             * The polynomial t^(2^128 - 1) modulo the characteristic polynomial, least significant coefficient first.
+             */
+            static const std::uint64_t jumpPolynomial[stateVectorLength];
+
+            /**
+             * The polynomial t^(2^192 - 1) modulo the characteristic polynomial, least significant coefficient first.
+             */
+            static const std::uint64_t longJumpPolynomial[stateVectorLength];
+
             /**
              * Method used internally to update the state vector.
              */
             void updateStateVector();
 
+            /**
+             * Method that advances the generator by the number of values described by a jump polynomial.
+             *
+             * \param[in] polynomial The jump polynomial to apply.
+             */
+            void applyJumpPolynomial(const std::uint64_t* polynomial);
+
             /**
              * State vector array.
              */
@@ -0,0 +1,204 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::PerThread::Philox class.
+***********************************************************************************************************************/
+
+#include <cstdint>
+#include <cstring>
+
+#include "model_exceptions.h"
+#include "m_console.h"
+#include "m_intrinsics.h"
+#include "m_per_thread_rng_base.h"
+#include "m_per_thread_philox.h"
+
+namespace M {
+    constexpr std::uint32_t PerThread::Philox::multiplier0;
+    constexpr std::uint32_t PerThread::Philox::multiplier1;
+    constexpr std::uint32_t PerThread::Philox::keyIncrement0;
+    constexpr std::uint32_t PerThread::Philox::keyIncrement1;
+    constexpr unsigned      PerThread::Philox::numberRounds;
+    constexpr unsigned      PerThread::Philox::numberLanes;
+
+    PerThread::Philox::Philox() {
+        RngSeed seed;
+        trng(reinterpret_cast<std::uint32_t*>(seed), sizeof(RngSeed) / (sizeof(std::uint32_t)));
+        setRngSeed(seed, 0);
+    }
+
+
+    PerThread::Philox::Philox(const PerThread::RngSeed& rngSeed, unsigned extra) {
+        setRngSeed(rngSeed, extra);
+    }
+
+
+    PerThread::Philox::~Philox() {}
+
+
+    void PerThread::Philox::setRngSeed(const PerThread::RngSeed& rngSeed, unsigned extra) {
+        // The 256-bit seed is folded into the 64-bit key and the 64-bit stream identifier.  The extra value offsets
+        // the stream so instances differing only by the extra value never share a counter value.
+
+        currentKey    = rngSeed[0] ^ rngSeed[2];
+        currentStream = (rngSeed[1] ^ rngSeed[3]) + extra;
+
+        nextBlock       = 0;
+        blockValueIndex = 2;
+
+        std::memcpy(initialSeedValue, rngSeed, sizeof(RngSeed));
+        needNewDecomposeValue = true;
+    }
+
+
+    const PerThread::RngSeed& PerThread::Philox::rngSeed() const {
+        return initialSeedValue;
+    }
+
+
+    PerThread::RngType PerThread::Philox::rngType() const {
+        return RngType::PHILOX4X32_10;
+    }
+
+
+    unsigned long PerThread::Philox::random32() {
+        unsigned long result;
+
+        if (needNewDecomposeValue) {
+            currentDecomposedValue = random64();
+            result = static_cast<std::uint32_t>(currentDecomposedValue);
+            needNewDecomposeValue = false;
+        } else {
+            result = static_cast<std::uint32_t>(currentDecomposedValue >> 32ULL);
+            needNewDecomposeValue = true;
+        }
+
+        return result;
+    }
+
+
+    unsigned long long PerThread::Philox::random64() {
+        if (blockValueIndex >= 2) {
+            generateLanes(currentKey, currentStream, nextBlock, 1, blockValues);
+            ++nextBlock;
+            blockValueIndex = 0;
+        }
+
+        return blockValues[blockValueIndex++];
+    }
+
+
+    void PerThread::Philox::fillArray(void* array, unsigned long numberValues) {
+        std::uint64_t* p         = reinterpret_cast<std::uint64_t*>(array);
+        unsigned long  remaining = numberValues;
+
+        while (remaining > 0 && blockValueIndex < 2) {
+            *p = blockValues[blockValueIndex++];
+            ++p;
+            --remaining;
+        }
+
+        unsigned long numberBlocks = remaining / 2;
+        generateBlocks(currentKey, currentStream, nextBlock, numberBlocks, p);
+
+        nextBlock += numberBlocks;
+        p         += 2 * numberBlocks;
+        remaining -= 2 * numberBlocks;
+
+        if (remaining > 0) {
+            *p = random64();
+        }
+    }
+
+
+    void PerThread::Philox::generateBlocks(
+            std::uint64_t  key,
+            std::uint64_t  stream,
+            std::uint64_t  firstBlock,
+            unsigned long  numberBlocks,
+            std::uint64_t* destination
+        ) {
+        std::uint64_t  block     = firstBlock;
+        std::uint64_t* d         = destination;
+        unsigned long  remaining = numberBlocks;
+
+        while (remaining >= numberLanes) {
+            generateLanes(key, stream, block, numberLanes, d);
+
+            block     += numberLanes;
+            d         += 2 * numberLanes;
+            remaining -= numberLanes;
+        }
+
+        if (remaining > 0) {
+            generateLanes(key, stream, block, static_cast<unsigned>(remaining), d);
+        }
+    }
+
+
+    inline void PerThread::Philox::generateLanes(
+            std::uint64_t  key,
+            std::uint64_t  stream,
+            std::uint64_t  firstBlock,
+            unsigned       numberBlocks,
+            std::uint64_t* destination
+        ) {
+        std::uint32_t x0[numberLanes];
+        std::uint32_t x1[numberLanes];
+        std::uint32_t x2[numberLanes];
+        std::uint32_t x3[numberLanes];
+
+        for (unsigned lane=0 ; lane<numberBlocks ; ++lane) {
+            std::uint64_t counter = firstBlock + lane;
+
+            x0[lane] = static_cast<std::uint32_t>(counter);
+            x1[lane] = static_cast<std::uint32_t>(counter >> 32);
+            x2[lane] = static_cast<std::uint32_t>(stream);
+            x3[lane] = static_cast<std::uint32_t>(stream >> 32);
+        }
+
+        std::uint32_t k0 = static_cast<std::uint32_t>(key);
+        std::uint32_t k1 = static_cast<std::uint32_t>(key >> 32);
+
+        for (unsigned round=0 ; round<numberRounds ; ++round) {
+            for (unsigned lane=0 ; lane<numberBlocks ; ++lane) {
+                std::uint64_t p0 = static_cast<std::uint64_t>(multiplier0) * x0[lane];
+                std::uint64_t p1 = static_cast<std::uint64_t>(multiplier1) * x2[lane];
+
+                x0[lane] = static_cast<std::uint32_t>(p1 >> 32) ^ x1[lane] ^ k0;
+                x1[lane] = static_cast<std::uint32_t>(p1);
+                x2[lane] = static_cast<std::uint32_t>(p0 >> 32) ^ x3[lane] ^ k1;
+                x3[lane] = static_cast<std::uint32_t>(p0);
+            }
+
+            k0 += keyIncrement0;
+            k1 += keyIncrement1;
+        }
+
+        for (unsigned lane=0 ; lane<numberBlocks ; ++lane) {
+            destination[2 * lane + 0] = (static_cast<std::uint64_t>(x1[lane]) << 32) | x0[lane];
+            destination[2 * lane + 1] = (static_cast<std::uint64_t>(x3[lane]) << 32) | x2[lane];
+        }
+    }
+}
@@ -0,0 +1,236 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This header defines the \ref M::PerThread::Philox class.
+***********************************************************************************************************************/
+
+/* .. sphinx-project inem */
+
+#ifndef M_PER_THREAD_PHILOX_H
+#define M_PER_THREAD_PHILOX_H
+
+#include <cstdint>
+
+#include "model_rng.h"
+#include "m_intrinsics.h"
+#include "m_per_thread.h"
+#include "m_per_thread_rng_base.h"
+
+namespace M {
+    /**
+     * The \ref M::PerThread RNG class for the Philox4x32-10 counter based PRNG.
+     *
+     * Each 128-bit counter value is encrypted under a 64-bit key using 10 Philox rounds, producing two 64-bit random
+     * values.  The low 64 bits of the counter hold the block index and the high 64 bits hold a stream identifier
+     * derived from the seed and the "extra" value.  Any value in a stream can therefore be calculated directly from
+     * its position, so large arrays can be generated in pieces, by any number of threads, with identical results.
+     *
+     * Algorithm from:
+     *     Salmon, Moraes, Dror and Shaw, "Parallel Random Numbers: As Easy as 1, 2, 3", Proceedings of the
+     *     International Conference for High Performance Computing, Networking, Storage and Analysis (SC11), 2011.
+     */
+    class PerThread::Philox:public PerThread::RngBase {
+        public:
+            Philox();
+
+            /**
+             * Constructor
+             *
+             * \param[in] rngSeed The desired seed for the RNG.
+             *
+             * \param[in] extra   A extra value applied in addition to the provided seed.  Different values select
+             *                    disjoint streams.
+             */
+            Philox(const RngSeed& rngSeed, unsigned extra);
+
+            ~Philox() override;
+
+            /**
+             * Method you can use to set the RNG seed.
+             *
+             * \param[in] rngSeed The RNG seed to apply.
+             *
+             * \param[in] extra   A extra value applied in addition to the provided seed.  Different values select
+             *                    disjoint streams.
+             */
+            void setRngSeed(const RngSeed& rngSeed, unsigned extra) override;
+
+            /**
+             * Method you can use to determine the currently selected RNG type.
+             *
+             * \return Returns the currently selected RNG type.
+             */
+            RngType rngType() const override;
+
+            /**
+             * Method you can use to determine the last used RNG seed.
+             *
+             * \return Returns a constant reference to the last seed applied to the selected RNG.
+             */
+            const RngSeed& rngSeed() const override;
+
+            /**
+             * Method you can use to obtain an unsigned 32-bit random value.
+             *
+             * \return Returns an unsigned 32-bit random value with uniform distribution.
+             */
+            unsigned long random32() override;
+
+            /**
+             * Method you can use to obtain an unsigned 64-bit random value.
+             *
+             * \return Returns an unsigned 64-bit random value with uniform distribution.
+             */
+            unsigned long long random64() override;
+
+            /**
+             * Method you can use to rapidly populate an arbitrary length array with 64-bit random integer values.
+             * Values are identical to those returned by successive calls to
+             * \ref M::PerThread::Philox::random64.
+             *
+             * \param[in] array        Pointer to the starting location to be populated.
+             *
+             * \param[in] numberValues The length of the array to be populated.
+             */
+            void fillArray(void* array, unsigned long numberValues) override;
+
+            /**
+             * Method that calculates a contiguous run of Philox blocks.  Each block holds two 64-bit values.  The
+             * method only depends on its arguments so it can be called from multiple threads to fill different parts
+             * of a single array.
+             *
+             * \param[in]  key          The 64-bit key.
+             *
+             * \param[in]  stream       The stream identifier, used as the upper 64 bits of the counter.
+             *
+             * \param[in]  firstBlock   The index of the first block to calculate.
+             *
+             * \param[in]  numberBlocks The number of blocks to calculate.
+             *
+             * \param[out] destination  The array to receive the values.  The array must hold 2 * numberBlocks values.
+             */
+            static void generateBlocks(
+                std::uint64_t  key,
+                std::uint64_t  stream,
+                std::uint64_t  firstBlock,
+                unsigned long  numberBlocks,
+                std::uint64_t* destination
+            );
+
+        private:
+            /**
+             * Multiplier applied to the first counter word.
+             */
+            static constexpr std::uint32_t multiplier0 = 0xD2511F53UL;
+
+            /**
+             * Multiplier applied to the third counter word.
+             */
+            static constexpr std::uint32_t multiplier1 = 0xCD9E8D57UL;
+
+            /**
+             * Weyl sequence increment applied to the low key word after each round.
+             */
+            static constexpr std::uint32_t keyIncrement0 = 0x9E3779B9UL;
+
+            /**
+             * Weyl sequence increment applied to the high key word after each round.
+             */
+            static constexpr std::uint32_t keyIncrement1 = 0xBB67AE85UL;
+
+            /**
+             * The number of Philox rounds.
+             */
+            static constexpr unsigned numberRounds = 10;
+
+            /**
+             * The number of blocks calculated together.  Lanes are independent so the compiler can map them onto SIMD
+             * registers.
+             */
+            static constexpr unsigned numberLanes = 8;
+
+            /**
+             * Method that calculates up to \ref M::PerThread::Philox::numberLanes blocks.
+             *
+             * \param[in]  key          The 64-bit key.
+             *
+             * \param[in]  stream       The stream identifier.
+             *
+             * \param[in]  firstBlock   The index of the first block to calculate.
+             *
+             * \param[in]  numberBlocks The number of blocks to calculate.
+             *
+             * \param[out] destination  The array to receive the values.
+             */
+            static inline void generateLanes(
+                std::uint64_t  key,
+                std::uint64_t  stream,
+                std::uint64_t  firstBlock,
+                unsigned       numberBlocks,
+                std::uint64_t* destination
+            );
+
+            /**
+             * The current key.
+             */
+            std::uint64_t currentKey;
+
+            /**
+             * The current stream identifier.
+             */
+            std::uint64_t currentStream;
+
+            /**
+             * The index of the next block to be calculated.
+             */
+            std::uint64_t nextBlock;
+
+            /**
+             * Buffer holding the values from the last calculated block.
+             */
+            std::uint64_t blockValues[2];
+
+            /**
+             * Index of the next unused value in the block buffer.  A value of 2 indicates the buffer is empty.
+             */
+            unsigned blockValueIndex;
+
+            /**
+             * Initial seed value.
+             */
+            RngSeed initialSeedValue;
+
+            /**
+             * Value used for 32-bit values.
+             */
+            std::uint64_t currentDecomposedValue;
+
+            /**
+             * Flag indicating if we need to fetch a new value to decompose.
+             */
+            bool needNewDecomposeValue;
+    };
+};
+
+#endif
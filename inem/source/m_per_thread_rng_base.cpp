@@ -49,4 +49,15 @@ namespace M {
     void PerThread::RngBase::trng(std::uint32_t* array, unsigned numberTerms) {
         matrixApi()->trueRandomArray(array, numberTerms);
     }
+
+
+    bool PerThread::RngBase::supportsJumps() const {
+        return false;
+    }
+
+
+    void PerThread::RngBase::jump() {}
+
+
+    void PerThread::RngBase::longJump() {}
 }
@@ -121,6 +121,27 @@ namespace M {
              * \param[in] numberValues The length of the array to be populated.
              */
             virtual void fillArray(void* array, unsigned long numberValues) = 0;
+
+            /**
+             * Method you can use to determine if the RNG supports jump-ahead.
+             *
+             * \return Returns true if \ref M::PerThread::RngBase::jump and \ref M::PerThread::RngBase::longJump are
+             *         supported.  The default implementation returns false.
+             */
+            virtual bool supportsJumps() const;
+
+            /**
+             * Method you can use to advance the RNG by 2^128 values.  Identically seeded instances advanced by a
+             * different number of jumps produce non-overlapping sequences.  The default implementation does nothing.
+             */
+            virtual void jump();
+
+            /**
+             * Method you can use to advance the RNG by 2^192 values.  The method can be used to create groups of
+             * substreams, each of which can be further divided using \ref M::PerThread::RngBase::jump.  The default
+             * implementation does nothing.
+             */
+            virtual void longJump();
     };
 };
 
@@ -35,6 +35,14 @@
 #include "m_per_thread_xorshiro256_base.h"
 
 namespace M {
+    const std::uint64_t PerThread::XorShiRo256Base::jumpPolynomial[4] = {
+        0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+    };
+
+    const std::uint64_t PerThread::XorShiRo256Base::longJumpPolynomial[4] = {
+        0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL, 0x77710069854EE241ULL, 0x39109BB02ACBE635ULL
+    };
+
     PerThread::XorShiRo256Base::XorShiRo256Base() {
         RngSeed seed;
         trng(reinterpret_cast<std::uint32_t*>(seed), sizeof(RngSeed) / sizeof(std::uint32_t));
@@ -95,4 +103,63 @@ namespace M {
 
         return result;
     }
+
+
+    bool PerThread::XorShiRo256Base::supportsJumps() const {
+        return true;
+    }
+
+
+    void PerThread::XorShiRo256Base::jump() {
+        applyJumpPolynomial(state, jumpPolynomial);
+        needNewDecomposeValue = true;
+    }
+
+
+    void PerThread::XorShiRo256Base::longJump() {
+        applyJumpPolynomial(state, longJumpPolynomial);
+        needNewDecomposeValue = true;
+    }
+
+
+    void PerThread::XorShiRo256Base::applyJumpPolynomial(std::uint64_t* jumpState, const std::uint64_t* polynomial) {
+        // The + and ** variants share the same linear state transition, only the output function differs, so the
+        // state is advanced here directly.
+
+        std::uint64_t s0 = jumpState[0];
+        std::uint64_t s1 = jumpState[1];
+        std::uint64_t s2 = jumpState[2];
+        std::uint64_t s3 = jumpState[3];
+
+        std::uint64_t j0 = 0;
+        std::uint64_t j1 = 0;
+        std::uint64_t j2 = 0;
+        std::uint64_t j3 = 0;
+
+        for (unsigned wordIndex=0 ; wordIndex<4 ; ++wordIndex) {
+            std::uint64_t word = polynomial[wordIndex];
+            for (unsigned bitIndex=0 ; bitIndex<64 ; ++bitIndex) {
+                if (word & (1ULL << bitIndex)) {
+                    j0 ^= s0;
+                    j1 ^= s1;
+                    j2 ^= s2;
+                    j3 ^= s3;
+                }
+
+                std::uint64_t t = s1 << 17;
+                s2 ^= s0;
+                s3 ^= s1;
+                s1 ^= s2;
+                s0 ^= s3;
+
+                s2 ^= t;
+                s3 = (s3 << 45) | (s3 >> 19);
+            }
+        }
+
+        jumpState[0] = j0;
+        jumpState[1] = j1;
+        jumpState[2] = j2;
+        jumpState[3] = j3;
+    }
 }
@@ -86,13 +86,58 @@ namespace M {
              */
             unsigned long random32() override;
 
+            /**
+             * Method you can use to determine if the RNG supports jump-ahead.
+             *
+             * \return Returns true.
+             */
+            bool supportsJumps() const override;
+
+            /**
+             * Method you can use to advance the RNG by 2^128 values.  Identically seeded instances advanced by a
+             * different number of jumps produce non-overlapping sequences.
+             */
+            void jump() override;
+
+            /**
+             * Method you can use to advance the RNG by 2^192 values.
+             */
+            void longJump() override;
+
         protected:
             /**
              * The current generator state.  Direct access to derived classes for speed.
              */
             std::uint64_t state[4];
 
+            /**
+             * Flag indicating if we need to fetch a new value to decompose.
+             */
+            bool needNewDecomposeValue;
+
+            /**
+             * Polynomial used to advance the generator by 2^128 values.  Values from the reference implementation at
+             *
+             *     https://prng.di.unimi.it/xoshiro256plus.c
+             */
+            static const std::uint64_t jumpPolynomial[4];
+
+            /**
+             * Polynomial used to advance the generator by 2^192 values.
+             */
+            static const std::uint64_t longJumpPolynomial[4];
+
+            /**
+             * Method that advances a generator state by the number of values described by a jump polynomial.
+             *
+             * \param[in,out] jumpState  The four word generator state to be advanced.
+             *
+             * \param[in]     polynomial The jump polynomial to apply.
+             */
+            static void applyJumpPolynomial(std::uint64_t* jumpState, const std::uint64_t* polynomial);
+
         private:
+
             /**
              * Method that provides a trivial linear congruent generator in 64-bits.  Algorithm from :
              *
@@ -120,11 +165,6 @@ namespace M {
              * Value used for 32-bit values.
              */
             std::uint64_t currentDecomposedValue;
-
-            /**
-             * Flag indicating if we need to fetch a new value to decompose.
-             */
-            bool needNewDecomposeValue;
     };
 };
 
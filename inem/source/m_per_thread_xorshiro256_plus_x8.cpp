@@ -0,0 +1,97 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::PerThread::XorShiRo256PlusX8 class.
+***********************************************************************************************************************/
+
+#include <cstdint>
+#include <cstring>
+
+#include "model_exceptions.h"
+#include "m_console.h"
+#include "m_intrinsics.h"
+#include "m_per_thread_rng_base.h"
+#include "m_per_thread_xorshiro256_plus_x8.h"
+
+namespace M {
+    PerThread::XorShiRo256PlusX8::XorShiRo256PlusX8():PerThread::XorShiRo256X8Base() {}
+
+
+    PerThread::XorShiRo256PlusX8::XorShiRo256PlusX8(
+            const PerThread::RngSeed& rngSeed,
+            unsigned                  extra
+        ):PerThread::XorShiRo256X8Base(
+            rngSeed,
+            extra
+        ) {}
+
+
+    PerThread::XorShiRo256PlusX8::~XorShiRo256PlusX8() {}
+
+
+    PerThread::RngType PerThread::XorShiRo256PlusX8::rngType() const {
+        return RngType::XORSHIRO256_PLUS_X8;
+    }
+
+
+    void PerThread::XorShiRo256PlusX8::generateSteps(std::uint64_t* destination, unsigned long numberSteps) {
+        // The lane loops carry no dependencies between lanes so the compiler can map each one onto vector
+        // instructions.
+
+        alignas(64) std::uint64_t s0[numberLanes];
+        alignas(64) std::uint64_t s1[numberLanes];
+        alignas(64) std::uint64_t s2[numberLanes];
+        alignas(64) std::uint64_t s3[numberLanes];
+
+        std::memcpy(s0, laneState[0], sizeof(s0));
+        std::memcpy(s1, laneState[1], sizeof(s1));
+        std::memcpy(s2, laneState[2], sizeof(s2));
+        std::memcpy(s3, laneState[3], sizeof(s3));
+
+        std::uint64_t* p = destination;
+        for (unsigned long step=0 ; step<numberSteps ; ++step) {
+            for (unsigned lane=0 ; lane<numberLanes ; ++lane) {
+                std::uint64_t result = s0[lane] + s3[lane];
+                std::uint64_t t      = s1[lane] << 17;
+
+                s2[lane] ^= s0[lane];
+                s3[lane] ^= s1[lane];
+                s1[lane] ^= s2[lane];
+                s0[lane] ^= s3[lane];
+
+                s2[lane] ^= t;
+                s3[lane]  = (s3[lane] << 45) | (s3[lane] >> 19);
+
+                p[lane] = result;
+            }
+
+            p += numberLanes;
+        }
+
+        std::memcpy(laneState[0], s0, sizeof(s0));
+        std::memcpy(laneState[1], s1, sizeof(s1));
+        std::memcpy(laneState[2], s2, sizeof(s2));
+        std::memcpy(laneState[3], s3, sizeof(s3));
+    }
+}
@@ -0,0 +1,80 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This header defines the \ref M::PerThread::XorShiRo256StarsX8 class.
+***********************************************************************************************************************/
+
+/* .. sphinx-project inem */
+
+#ifndef M_PER_THREAD_XORSHIRO256_STARS_X8_H
+#define M_PER_THREAD_XORSHIRO256_STARS_X8_H
+
+#include <cstdint>
+
+#include "model_rng.h"
+#include "m_intrinsics.h"
+#include "m_per_thread.h"
+#include "m_per_thread_xorshiro256_x8_base.h"
+
+namespace M {
+    /**
+     * The \ref M::PerThread RNG class for the eight lane XOR-SHIFT-ROTATE 256** PRNG.  Every eighth value, starting
+     * with the first, matches the single lane \ref M::PerThread::XorShiRo256Stars generator.
+     */
+    class PerThread::XorShiRo256StarsX8:public PerThread::XorShiRo256X8Base {
+        public:
+            XorShiRo256StarsX8();
+
+            /**
+             * Constructor
+             *
+             * \param[in] rngSeed The desired seed for the RNG.
+             *
+             * \param[in] extra   A extra value applied in addition to the provided seed.  The value is intended to
+             *                    provide additional scrambling based on a thread ID or similar construct.
+             */
+            XorShiRo256StarsX8(const RngSeed& rngSeed, unsigned extra);
+
+            ~XorShiRo256StarsX8() override;
+
+            /**
+             * Method you can use to determine the currently selected RNG type.
+             *
+             * \return Returns the currently selected RNG type.
+             */
+            RngType rngType() const override;
+
+        protected:
+            /**
+             * Method that advances every lane a number of steps, storing one value per lane per step.
+             *
+             * \param[in] destination Pointer to the location to receive numberLanes * numberSteps values.
+             *
+             * \param[in] numberSteps The number of steps to advance each lane.
+             */
+            void generateSteps(std::uint64_t* destination, unsigned long numberSteps) override;
+    };
+};
+
+#endif
@@ -0,0 +1,152 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::PerThread::XorShiRo256X8Base class.
+***********************************************************************************************************************/
+
+#include <cstdint>
+#include <cstring>
+
+#include "model_exceptions.h"
+#include "m_console.h"
+#include "m_intrinsics.h"
+#include "m_per_thread_rng_base.h"
+#include "m_per_thread_xorshiro256_x8_base.h"
+
+namespace M {
+    constexpr unsigned PerThread::XorShiRo256X8Base::numberLanes;
+
+    PerThread::XorShiRo256X8Base::XorShiRo256X8Base():PerThread::XorShiRo256Base() {
+        // The base class constructor can not dispatch to our setRngSeed so the lanes are seeded here.
+        seedLanes();
+    }
+
+
+    PerThread::XorShiRo256X8Base::XorShiRo256X8Base(
+            const PerThread::RngSeed& rngSeed,
+            unsigned                  extra
+        ):PerThread::XorShiRo256Base(
+            rngSeed,
+            extra
+        ) {
+        seedLanes();
+    }
+
+
+    PerThread::XorShiRo256X8Base::~XorShiRo256X8Base() {}
+
+
+    void PerThread::XorShiRo256X8Base::setRngSeed(const PerThread::RngSeed& rngSeed, unsigned extra) {
+        XorShiRo256Base::setRngSeed(rngSeed, extra);
+        seedLanes();
+    }
+
+
+    unsigned long long PerThread::XorShiRo256X8Base::random64() {
+        if (laneValueIndex >= numberLanes) {
+            generateSteps(laneValues, 1);
+            laneValueIndex = 0;
+        }
+
+        return laneValues[laneValueIndex++];
+    }
+
+
+    void PerThread::XorShiRo256X8Base::fillArray(void* array, unsigned long numberValues) {
+        std::uint64_t* p         = reinterpret_cast<std::uint64_t*>(array);
+        unsigned long  remaining = numberValues;
+
+        while (remaining > 0 && laneValueIndex < numberLanes) {
+            *p = laneValues[laneValueIndex++];
+            ++p;
+            --remaining;
+        }
+
+        unsigned long numberSteps = remaining / numberLanes;
+        if (numberSteps > 0) {
+            generateSteps(p, numberSteps);
+
+            p         += numberLanes * numberSteps;
+            remaining -= numberLanes * numberSteps;
+        }
+
+        while (remaining > 0) {
+            *p = random64();
+            ++p;
+            --remaining;
+        }
+    }
+
+
+    void PerThread::XorShiRo256X8Base::jump() {
+        // Lane i of substream k starts (8k + i) * 2^128 values into the sequence so advancing every lane by eight
+        // single lane jumps keeps substreams disjoint from each other and from their own lanes.
+
+        jumpLanes(jumpPolynomial, numberLanes);
+    }
+
+
+    void PerThread::XorShiRo256X8Base::longJump() {
+        jumpLanes(longJumpPolynomial, 1);
+    }
+
+
+    void PerThread::XorShiRo256X8Base::seedLanes() {
+        std::uint64_t s[4];
+        std::memcpy(s, state, sizeof(s));
+
+        for (unsigned lane=0 ; lane<numberLanes ; ++lane) {
+            if (lane > 0) {
+                applyJumpPolynomial(s, jumpPolynomial);
+            }
+
+            for (unsigned wordIndex=0 ; wordIndex<4 ; ++wordIndex) {
+                laneState[wordIndex][lane] = s[wordIndex];
+            }
+        }
+
+        laneValueIndex = numberLanes;
+    }
+
+
+    void PerThread::XorShiRo256X8Base::jumpLanes(const std::uint64_t* polynomial, unsigned numberJumps) {
+        for (unsigned lane=0 ; lane<numberLanes ; ++lane) {
+            std::uint64_t s[4];
+            for (unsigned wordIndex=0 ; wordIndex<4 ; ++wordIndex) {
+                s[wordIndex] = laneState[wordIndex][lane];
+            }
+
+            for (unsigned i=0 ; i<numberJumps ; ++i) {
+                applyJumpPolynomial(s, polynomial);
+            }
+
+            for (unsigned wordIndex=0 ; wordIndex<4 ; ++wordIndex) {
+                laneState[wordIndex][lane] = s[wordIndex];
+            }
+        }
+
+        laneValueIndex        = numberLanes;
+        needNewDecomposeValue = true;
+    }
+}
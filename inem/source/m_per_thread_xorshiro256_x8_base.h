@@ -0,0 +1,151 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This header defines the \ref M::PerThread::XorShiRo256X8Base class.
+***********************************************************************************************************************/
+
+/* .. sphinx-project inem */
+
+#ifndef M_PER_THREAD_XORSHIRO256_X8_BASE_H
+#define M_PER_THREAD_XORSHIRO256_X8_BASE_H
+
+#include <cstdint>
+
+#include "model_rng.h"
+#include "m_intrinsics.h"
+#include "m_per_thread.h"
+#include "m_per_thread_xorshiro256_base.h"
+
+namespace M {
+    /**
+     * The \ref M::PerThread RNG base class for the eight lane XOR-SHIFT-ROTATE 256 + and ** algorithms.
+     *
+     * The class runs eight independent generators side by side and interleaves their output, value n coming from
+     * lane n % 8.  Lane 0 starts from the same state as the equivalent single lane generator and each following lane
+     * starts 2^128 values further along the same sequence so the lanes never overlap.  The lane state is held as
+     * a structure of arrays so the derived classes can advance all lanes with the same vector instructions.
+     */
+    class PerThread::XorShiRo256X8Base:public PerThread::XorShiRo256Base {
+        public:
+            XorShiRo256X8Base();
+
+            /**
+             * Constructor
+             *
+             * \param[in] rngSeed The desired seed for the RNG.
+             *
+             * \param[in] extra   A extra value applied in addition to the provided seed.  The value is intended to
+             *                    provide additional scrambling based on a thread ID or similar construct.
+             */
+            XorShiRo256X8Base(const RngSeed& rngSeed, unsigned extra);
+
+            ~XorShiRo256X8Base() override;
+
+            /**
+             * Method you can use to set the RNG seed.
+             *
+             * \param[in] rngSeed The RNG seed to apply.
+             *
+             * \param[in] extra   A extra value applied in addition to the provided seed.  The value is intended to
+             *                    provide additional scrambling based on a thread ID or similar construct.
+             */
+            void setRngSeed(const RngSeed& rngSeed, unsigned extra) override;
+
+            /**
+             * Method you can use to obtain an unsigned 64-bit random value.
+             *
+             * \return Returns an unsigned 64-bit random value with uniform distribution.
+             */
+            unsigned long long random64() override;
+
+            /**
+             * Method you can use to rapidly populate an arbitrary length array with 64-bit random integer values.
+             * The values are identical to those that would be obtained from repeated calls to \ref random64.
+             *
+             * \param[in] array        Pointer to the starting location to be populated.
+             *
+             * \param[in] numberValues The length of the array to be populated.
+             */
+            void fillArray(void* array, unsigned long numberValues) override;
+
+            /**
+             * Method you can use to advance every lane by 2^131 values, the span covered by all eight lanes.
+             * Identically seeded instances advanced by a different number of jumps produce non-overlapping sequences.
+             */
+            void jump() override;
+
+            /**
+             * Method you can use to advance every lane by 2^192 values.
+             */
+            void longJump() override;
+
+        protected:
+            /**
+             * The number of interleaved generators.  Eight lanes fill two AVX2 registers or one AVX-512 register.
+             */
+            static constexpr unsigned numberLanes = 8;
+
+            /**
+             * The lane states, indexed by state word and then by lane.
+             */
+            std::uint64_t laneState[4][numberLanes];
+
+            /**
+             * Method that advances every lane a number of steps, storing one value per lane per step.
+             *
+             * \param[in] destination Pointer to the location to receive numberLanes * numberSteps values.
+             *
+             * \param[in] numberSteps The number of steps to advance each lane.
+             */
+            virtual void generateSteps(std::uint64_t* destination, unsigned long numberSteps) = 0;
+
+        private:
+            /**
+             * Method that derives the lane states from the single lane generator state.
+             */
+            void seedLanes();
+
+            /**
+             * Method that applies a jump polynomial to every lane and discards any buffered values.
+             *
+             * \param[in] polynomial  The jump polynomial to apply.
+             *
+             * \param[in] numberJumps The number of times to apply the polynomial.
+             */
+            void jumpLanes(const std::uint64_t* polynomial, unsigned numberJumps);
+
+            /**
+             * Values from the most recent step that have not yet been returned.
+             */
+            std::uint64_t laneValues[numberLanes];
+
+            /**
+             * Index of the next value in laneValues to be returned.  A value of numberLanes indicates the buffer is
+             * empty.
+             */
+            unsigned laneValueIndex;
+    };
+};
+
+#endif
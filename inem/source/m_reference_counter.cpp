@@ -25,32 +25,110 @@
 * This file implements the \ref M::ReferenceCounter class.
 ***********************************************************************************************************************/
 
+#include <atomic>
+#include <thread>
+#include <cassert>
+
 #include "m_reference_counter.h"
 
 namespace M {
-    ReferenceCounter::ReferenceCounter() {
-        currentReferenceCount = 1;
+    /**
+     * The number of failed attempts to acquire a lock before the thread yields.
+     */
+    static constexpr unsigned spinsBeforeYield = 64;
+
+    /**
+     * Function that returns a value that uniquely identifies the calling thread.
+     *
+     * \return Returns a value unique to the calling thread.
+     */
+    static inline const void* currentThreadMarker() {
+        static thread_local char marker;
+        return &marker;
+    }
+
+
+    ReferenceCounter::ReferenceCounter():currentReferenceCount(1),currentLockOwner(nullptr) {
+        currentLockDepth = 0;
+    }
+
+
+    ReferenceCounter::ReferenceCounter(const ReferenceCounter&):currentReferenceCount(1),currentLockOwner(nullptr) {
+        currentLockDepth = 0;
     }
 
 
     ReferenceCounter::~ReferenceCounter() {}
 
 
+    void ReferenceCounter::lock() const {
+        const void* marker = currentThreadMarker();
+
+        if (currentLockOwner.load(std::memory_order_relaxed) == marker) {
+            ++currentLockDepth;
+        } else {
+            unsigned    spins    = 0;
+            const void* expected = nullptr;
+            while (!currentLockOwner.compare_exchange_weak(expected, marker, std::memory_order_acquire)) {
+                expected = nullptr;
+
+                ++spins;
+                if (spins >= spinsBeforeYield) {
+                    std::this_thread::yield();
+                    spins = 0;
+                }
+            }
+
+            currentLockDepth = 1;
+        }
+    }
+
+
+    void ReferenceCounter::unlock() const {
+        assert(currentLockOwner.load(std::memory_order_relaxed) == currentThreadMarker());
+        assert(currentLockDepth > 0);
+
+        --currentLockDepth;
+        if (currentLockDepth == 0) {
+            currentLockOwner.store(nullptr, std::memory_order_release);
+        }
+    }
+
+
+    void ReferenceCounter::lockPair(const ReferenceCounter* first, const ReferenceCounter* second) {
+        if (first <= second) {
+            first->lock();
+            second->lock();
+        } else {
+            second->lock();
+            first->lock();
+        }
+    }
+
+
     void ReferenceCounter::addReference() const {
-        ++currentReferenceCount;
+        currentReferenceCount.fetch_add(1, std::memory_order_relaxed);
     }
 
 
     unsigned ReferenceCounter::referenceCount() const {
-        return currentReferenceCount;
+        return currentReferenceCount.load(std::memory_order_acquire);
     }
 
 
     bool ReferenceCounter::removeReference() const {
-        if (currentReferenceCount > 0) {
-            --currentReferenceCount;
+        unsigned count   = currentReferenceCount.load(std::memory_order_relaxed);
+        bool     updated = (count == 0);
+        while (!updated) {
+            updated = currentReferenceCount.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel);
+            updated = updated || count == 0;
         }
 
-        return currentReferenceCount == 0;
+        return count <= 1;
+    }
+
+
+    ReferenceCounter& ReferenceCounter::operator=(const ReferenceCounter&) {
+        return *this;
     }
 }
@@ -1357,45 +1357,27 @@ namespace M {
 
 
     bool internalBuildRealList(List<Real>& list, const MatrixBoolean& value) {
-        Integer numberRows    = value.numberRows();
-        Integer numberColumns = value.numberColumns();
-
-        for (Integer ri=1 ; ri<=numberRows ; ++ri) {
-            for (Integer ci=1 ; ci<=numberColumns ; ++ci) {
-                Real v = value(ri, ci) ? 1.0 : 0.0;
-                list.append(v);
-            }
-        }
+        value.forEach([&list](Boolean coefficient) {
+            list.append(coefficient ? 1.0 : 0.0);
+        });
 
         return true;
     }
 
 
     bool internalBuildRealList(List<Real>& list, const MatrixInteger& value) {
-        Integer numberRows    = value.numberRows();
-        Integer numberColumns = value.numberColumns();
-
-        for (Integer ri=1 ; ri<=numberRows ; ++ri) {
-            for (Integer ci=1 ; ci<=numberColumns ; ++ci) {
-                Real v = static_cast<Real>(value(ri, ci));
-                list.append(v);
-            }
-        }
+        value.forEach([&list](Integer coefficient) {
+            list.append(static_cast<Real>(coefficient));
+        });
 
         return true;
     }
 
 
     bool internalBuildRealList(List<Real>& list, const MatrixReal& value) {
-        Integer numberRows    = value.numberRows();
-        Integer numberColumns = value.numberColumns();
-
-        for (Integer ri=1 ; ri<=numberRows ; ++ri) {
-            for (Integer ci=1 ; ci<=numberColumns ; ++ci) {
-                Real v = value(ri, ci);
-                list.append(v);
-            }
-        }
+        value.forEach([&list](Real coefficient) {
+            list.append(coefficient);
+        });
 
         return true;
     }
@@ -1403,28 +1385,17 @@ namespace M {
 
     bool internalBuildRealList(List<Real>& list, const MatrixComplex& value) {
         bool result = true;
-        Integer numberRows    = value.numberRows();
-        Integer numberColumns = value.numberColumns();
 
-        Integer ri = 1;
-        while (result && ri <= numberRows) {
-            Integer ci = 1;
-            while (result && ci <= numberColumns) {
-                Complex v = value(ri, ci);
-
-                if (v.imag() != 0.0) {
+        value.forEach([&list, &result](const Complex& coefficient) {
+            if (result) {
+                if (coefficient.imag() != 0.0) {
                     internalTriggerInvalidParameterValueError();
                     result = false;
                 } else {
-                    list.append(v.real());
-                    result = true;
+                    list.append(coefficient.real());
                 }
-
-                ++ci;
             }
-
-            ++ri;
-        }
+        });
 
         return result;
     }
@@ -0,0 +1,112 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This file implements the \ref M::Ziggurat class.
+***********************************************************************************************************************/
+
+#include <cstdint>
+#include <cmath>
+
+#include "m_intrinsic_types.h"
+#include "m_per_thread.h"
+#include "m_ziggurat.h"
+
+namespace M {
+    /**
+     * The right edge of the base layer.  Values beyond this point are drawn from the tail.
+     */
+    static constexpr Real zigguratR = 3.6541528853610088;
+
+    /**
+     * The area of each layer.
+     */
+    static constexpr Real zigguratV = 4.92867323399E-3;
+
+    /**
+     * The range of the uniform value extracted from each raw value, 2^52.
+     */
+    static constexpr Real zigguratUniformRange = 4503599627370496.0;
+
+    constexpr unsigned Ziggurat::numberLayers;
+    const Ziggurat::Tables Ziggurat::tables;
+
+    Ziggurat::Tables::Tables() {
+        // Layer 0 is the base layer, including the tail.  Layer 255 is the widest rectangle, sitting just above the
+        // base layer, and layer 1 is the narrowest rectangle at the top of the ziggurat.  The layers are calculated
+        // from the base upwards following Marsaglia and Tsang.
+
+        Real xi = zigguratR;
+        Real fi = std::exp(-0.5 * xi * xi);
+        Real q  = zigguratV / fi;
+
+        k[0] = static_cast<std::uint64_t>((xi / q) * zigguratUniformRange);
+        k[1] = 0;
+
+        w[0]                = q / zigguratUniformRange;
+        w[numberLayers - 1] = xi / zigguratUniformRange;
+
+        f[0]                = 1.0;
+        f[numberLayers - 1] = fi;
+
+        for (unsigned layer=numberLayers - 2 ; layer>=1 ; --layer) {
+            Real xPrevious = xi;
+
+            xi = std::sqrt(-2.0 * std::log(zigguratV / xi + std::exp(-0.5 * xi * xi)));
+
+            k[layer + 1] = static_cast<std::uint64_t>((xi / xPrevious) * zigguratUniformRange);
+            w[layer]     = xi / zigguratUniformRange;
+            f[layer]     = std::exp(-0.5 * xi * xi);
+        }
+    }
+
+
+    Real Ziggurat::normalSlowPath(std::uint64_t raw, PerThread& pt) {
+        Real     result;
+        unsigned layer = static_cast<unsigned>(raw >> 56);
+        Real     x;
+
+        normalFastPath(raw, x);
+
+        if (layer == 0) {
+            // Draw from the tail beyond zigguratR using Marsaglia's method.
+
+            Real tx;
+            Real ty;
+
+            do {
+                tx = -std::log(pt.randomExclusive()) / zigguratR;
+                ty = -std::log(pt.randomExclusive());
+            } while (ty + ty < tx * tx);
+
+            result = x < 0 ? -(zigguratR + tx) : zigguratR + tx;
+        } else if (tables.f[layer] + pt.randomInclusiveExclusive() * (tables.f[layer - 1] - tables.f[layer])
+                   < std::exp(-0.5 * x * x)                                                                   ) {
+            result = x;
+        } else {
+            result = normal(pt.random64(), pt);
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,134 @@
+/*-*-c++-*-*************************************************************************************************************
+* Copyright 2016 - 2022 Inesonic, LLC.
+* 
+* This file is licensed under two licenses.
+*
+* Inesonic Commercial License, Version 1:
+*   All rights reserved.  Inesonic, LLC retains all rights to this software, including the right to relicense the
+*   software in source or binary formats under different terms.  Unauthorized use under the terms of this license is
+*   strictly prohibited.
+*
+* GNU Public License, Version 2:
+*   This program is free software; you can redistribute it and/or modify it under the terms of the GNU General Public
+*   License as published by the Free Software Foundation; either version 2 of the License, or (at your option) any later
+*   version.
+*   
+*   This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+*   warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+*   details.
+*   
+*   You should have received a copy of the GNU General Public License along with this program; if not, write to the Free
+*   Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+********************************************************************************************************************//**
+* \file
+*
+* This header defines the \ref M::Ziggurat class.
+***********************************************************************************************************************/
+
+/* .. sphinx-project inem */
+
+#ifndef M_ZIGGURAT_H
+#define M_ZIGGURAT_H
+
+#include <cstdint>
+
+#include "m_intrinsic_types.h"
+
+namespace M {
+    class PerThread;
+
+    /**
+     * Class that converts raw 64-bit random values into normally distributed values using the Marsaglia and Tsang
+     * Ziggurat algorithm with 256 layers.
+     *
+     * Each raw value supplies the layer index (top 8 bits), the sign (next bit) and a 52-bit uniform value taken from
+     * the high bits below the sign.  Drawing every field from the high bits keeps generators with weaker low bits
+     * from biasing the layer selection.  About 98.5% of all raw values are accepted by the fast path, which requires a
+     * single table lookup, a multiply and a compare.  The remaining values are resolved by
+     * \ref M::Ziggurat::normalSlowPath which draws additional values from the supplied \ref M::PerThread instance.
+     */
+    class Ziggurat {
+        public:
+            /**
+             * The number of layers in the ziggurat.
+             */
+            static constexpr unsigned numberLayers = 256;
+
+            /**
+             * Method that attempts to convert a raw 64-bit random value into a normally distributed value.  This
+             * method is branch free so loops calling it can be vectorized.
+             *
+             * \param[in]  raw   The raw 64-bit random value.
+             *
+             * \param[out] value The calculated value.  The value is only valid if this method returns true.
+             *
+             * \return Returns true if the value was accepted.  Returns false if the raw value must be resolved using
+             *         \ref M::Ziggurat::normalSlowPath.
+             */
+            static inline bool normalFastPath(std::uint64_t raw, Real& value) {
+                unsigned      layer   = static_cast<unsigned>(raw >> 56);
+                std::uint64_t u       = (raw >> 3) & 0x000FFFFFFFFFFFFFULL;
+                Real          x       = static_cast<Real>(static_cast<std::int64_t>(u)) * tables.w[layer];
+                Real          signedX = ((raw >> 55) & 1) ? -x : x;
+
+                value = signedX;
+                return u < tables.k[layer];
+            }
+
+            /**
+             * Method that converts a raw 64-bit value rejected by \ref M::Ziggurat::normalFastPath into a normally
+             * distributed value.
+             *
+             * \param[in] raw The raw 64-bit random value that was rejected.
+             *
+             * \param[in] pt  The per-thread instance used to obtain any additional random values.
+             *
+             * \return Returns a normally distributed value.
+             */
+            static Real normalSlowPath(std::uint64_t raw, PerThread& pt);
+
+            /**
+             * Method that converts a raw 64-bit random value into a normally distributed value.
+             *
+             * \param[in] raw The raw 64-bit random value.
+             *
+             * \param[in] pt  The per-thread instance used to obtain any additional random values.
+             *
+             * \return Returns a normally distributed value.
+             */
+            static inline Real normal(std::uint64_t raw, PerThread& pt) {
+                Real value;
+                return normalFastPath(raw, value) ? value : normalSlowPath(raw, pt);
+            }
+
+        private:
+            /**
+             * Structure holding the ziggurat tables.  Tables are calculated once, at load time.
+             */
+            struct Tables {
+                Tables();
+
+                /**
+                 * Acceptance thresholds for the 52-bit uniform value, per layer.
+                 */
+                std::uint64_t k[numberLayers];
+
+                /**
+                 * Scale factors used to convert the 52-bit uniform value into an abscissa, per layer.
+                 */
+                Real w[numberLayers];
+
+                /**
+                 * The normal density, without normalization, at the right edge of each layer.
+                 */
+                Real f[numberLayers];
+            };
+
+            /**
+             * The ziggurat tables.
+             */
+            static const Tables tables;
+    };
+}
+
+#endif
@@ -56,7 +56,7 @@ namespace Model {
     IdentifierData::Private::Private(const M::IdentifierData* identifierData):M::IdentifierData(*identifierData) {}
 
 
-    IdentifierData::Private::Private(const Private& other):M::IdentifierData(other) {}
+    IdentifierData::Private::Private(const Private& other):M::ReferenceCounter(),M::IdentifierData(other) {}
 
 
     IdentifierData::Private::~Private() {}
@@ -167,7 +167,7 @@ namespace Model {
     IdentifierDatabase::Private::Private() {}
 
 
-    IdentifierDatabase::Private::Private(const IdentifierDatabase::Private& other) {
+    IdentifierDatabase::Private::Private(const IdentifierDatabase::Private& other):M::ReferenceCounter() {
         currentIdentifierDataByHandle = other.currentIdentifierDataByHandle;
         currentIdentifierDataByName   = other.currentIdentifierDataByName;
     }
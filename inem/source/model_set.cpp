@@ -384,8 +384,7 @@ namespace Model {
         if (impl == other.impl) {
             result = true;
         } else {
-            impl->lock();
-            other.impl->lock();
+            M::ReferenceCounter::lockPair(impl, other.impl);
 
             result = (*impl == *other.impl);
 
@@ -44,7 +44,7 @@ namespace Model {
     Set::Private::Private() {}
 
 
-    Set::Private::Private(const Private& other):M::VariantOrderedSet(other) {}
+    Set::Private::Private(const Private& other):M::VariantOrderedSet(other),M::ReferenceCounter() {}
 
 
     Set::Private::Private(const M::OrderedSet<M::Variant>& other):M::VariantOrderedSet(other) {}
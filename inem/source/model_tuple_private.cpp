@@ -98,7 +98,7 @@ namespace Model {
     }
 
 
-    Tuple::Private::Private(const Private& other):M::List<M::Variant>(other) {}
+    Tuple::Private::Private(const Private& other):M::List<M::Variant>(other),M::ReferenceCounter() {}
 
 
     Tuple::Private::Private(const M::List<M::Variant>& other):M::List<M::Variant>(other) {}
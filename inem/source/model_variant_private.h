@@ -171,7 +171,7 @@ namespace Model {
              *
              * \param[in] other The instance to be copied.
              */
-            inline Private(const Private& other):M::Variant(other) {}
+            inline Private(const Private& other):M::Variant(other),M::ReferenceCounter() {}
 
             inline ~Private() {}
     };
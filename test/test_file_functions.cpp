@@ -35,6 +35,8 @@
 #include <sstream>
 
 #include <limits>
+#include <string>
+#include <vector>
 
 #include <m_intrinsic_types.h>
 #include <model_exceptions.h>
@@ -46,6 +48,7 @@
 #include <m_matrix_complex.h>
 #include <m_variant.h>
 #include <m_file_functions.h>
+#include <m_archive.h>
 
 #include "test_file_functions.h"
 
@@ -1104,6 +1107,105 @@ void TestFileFunctions::testLoadSaveComplexMatrixBinary() {
 void TestFileFunctions::testLoadWavFile() {}
 
 
+void TestFileFunctions::testArchive() {
+    QFile::remove("test.arc");
+
+    M::MatrixBoolean mb = M::MatrixBoolean::build(
+        2, 3,
+        true,  false, true,
+        false, false, true
+    );
+
+    M::MatrixInteger mi = M::MatrixInteger::build(
+        3, 2,
+        1, 2,
+        3, 4,
+        5, 6
+    );
+
+    M::MatrixReal mr = M::MatrixReal::build(
+        2, 2,
+        1.5, 2.5,
+        3.5, 4.5
+    );
+
+    M::MatrixComplex mc = M::MatrixComplex::build(
+        2, 1,
+        M::Complex(1.0, 2.0),
+        M::Complex(3.0, 4.0)
+    );
+
+    M::Set s;
+    s.insert(M::Variant(M::Integer(1)));
+    s.insert(M::Variant(M::Real(2.5)));
+
+    M::Tuple t;
+    t.append(M::Variant(M::Integer(7)));
+    t.append(M::Variant(mr));
+    t.append(M::Variant(s));
+
+    M::Archive archive;
+    QCOMPARE(archive.openForAppend("test.arc"), true);
+    QCOMPARE(archive.append("boolean", M::Variant(true)), true);
+    QCOMPARE(archive.append("integer", M::Variant(M::Integer(-42))), true);
+    QCOMPARE(archive.append("real", M::Variant(M::Real(3.25))), true);
+    QCOMPARE(archive.append("complex", M::Variant(M::Complex(1.5, -2.5))), true);
+    QCOMPARE(archive.append("set", M::Variant(s)), true);
+    QCOMPARE(archive.append("tuple", M::Variant(t)), true);
+    QCOMPARE(archive.append("matrix_boolean", M::Variant(mb)), true);
+
+    // Values written during this session can be read back before the archive is closed.
+
+    QCOMPARE(archive.value("integer").toInteger(), M::Integer(-42));
+    QCOMPARE(archive.close(), true);
+
+    QCOMPARE(archive.openForAppend("test.arc"), true);
+    QCOMPARE(archive.contains("real"), true);
+    QCOMPARE(archive.append("matrix_integer", M::Variant(mi)), true);
+    QCOMPARE(archive.append("matrix_real", M::Variant(mr)), true);
+    QCOMPARE(archive.append("matrix_complex", M::Variant(mc)), true);
+    QCOMPARE(archive.append("integer", M::Variant(M::Integer(17))), true);
+    QCOMPARE(archive.close(), true);
+
+    QCOMPARE(archive.openForRead("test.arc"), true);
+
+    std::vector<std::string> names = archive.names();
+    QCOMPARE(names.size(), std::size_t(10));
+    QCOMPARE(names[1], std::string("integer"));
+    QCOMPARE(names[9], std::string("matrix_complex"));
+
+    QCOMPARE(archive.contains("missing"), false);
+    QCOMPARE(archive.valueType("missing"), M::ValueType::NONE);
+    QCOMPARE(archive.valueType("matrix_real"), M::ValueType::MATRIX_REAL);
+
+    QCOMPARE(archive.value("boolean").toBoolean(), true);
+    QCOMPARE(archive.value("integer").toInteger(), M::Integer(17));
+    QCOMPARE(archive.value("real").toReal(), M::Real(3.25));
+    QCOMPARE(archive.value("complex").toComplex(), M::Complex(1.5, -2.5));
+    QCOMPARE(archive.value("set").toSet() == s, true);
+    QCOMPARE(archive.value("tuple").toTuple() == t, true);
+    QCOMPARE(archive.value("matrix_boolean").toMatrixBoolean(), mb);
+    QCOMPARE(archive.value("matrix_integer").toMatrixInteger(), mi);
+    QCOMPARE(archive.value("matrix_real").toMatrixReal(), mr);
+    QCOMPARE(archive.value("matrix_complex").toMatrixComplex(), mc);
+
+    QCOMPARE(archive.close(), true);
+
+    // Simulate an interrupted session by truncating the file in the middle of the index.  The entries are recovered
+    // by scanning the records.
+
+    QFile file("test.arc");
+    QCOMPARE(file.resize(file.size() - 20), true);
+
+    QCOMPARE(archive.openForRead("test.arc"), true);
+    QCOMPARE(archive.names().size(), std::size_t(10));
+    QCOMPARE(archive.value("matrix_complex").toMatrixComplex(), mc);
+    QCOMPARE(archive.close(), true);
+
+    QFile::remove("test.arc");
+}
+
+
 void TestFileFunctions::buildTextFile(const char* filename) {
     std::ofstream f(filename);
     Q_ASSERT(f);
@@ -106,6 +106,8 @@ class TestFileFunctions:public QObject {
 
         void testLoadWavFile();
 
+        void testArchive();
+
     private:
         void buildTextFile(const char* filename);
 };
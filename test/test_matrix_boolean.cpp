@@ -36,6 +36,7 @@
 #include <random>
 #include <algorithm>
 #include <cstdint>
+#include <memory>
 
 #include <model_exceptions.h>
 #include <model_tuple.h>
@@ -49,6 +50,7 @@
 #include <m_tuple.h>
 #include <m_matrix_real.h>
 #include <m_matrix_complex.h>
+#include <m_matrix_integer.h>
 #include <model_matrix_boolean.h>
 
 #include "test_matrix_base.h"
@@ -1315,6 +1317,65 @@ void TestMatrixBoolean::testMatrixTypeMethods() {
 }
 
 
+void TestMatrixBoolean::testSparseMethods() {
+    M::MatrixBoolean s1 = M::MatrixBoolean::sparse(3, 3);
+    QCOMPARE(s1.matrixType(), M::MatrixBoolean::MatrixType::SPARSE);
+    QCOMPARE(s1.numberRows(), M::MatrixBoolean::Index(3));
+    QCOMPARE(s1.numberColumns(), M::MatrixBoolean::Index(3));
+
+    s1.update(M::Integer(1), M::Integer(1), true);
+    s1.update(M::Integer(3), M::Integer(1), true);
+    s1.update(M::Integer(2), M::Integer(2), true);
+    s1.update(M::Integer(1), M::Integer(3), true);
+    s1.update(M::Integer(2), M::Integer(3), true);
+    s1.update(M::Integer(2), M::Integer(3), false);
+
+    QCOMPARE(s1.matrixType(), M::MatrixBoolean::MatrixType::SPARSE);
+    QCOMPARE(s1(M::Integer(1), M::Integer(1)), true);
+    QCOMPARE(s1(M::Integer(2), M::Integer(1)), false);
+    QCOMPARE(s1(M::Integer(3), M::Integer(1)), true);
+    QCOMPARE(s1(M::Integer(2), M::Integer(3)), false);
+
+    M::MatrixBoolean d1 = M::MatrixBoolean::build(
+        3, 3,
+        true,  false, true,
+        false, true,  false,
+        true,  false, false
+    );
+
+    M::MatrixBoolean d2 = M::MatrixBoolean::build(
+        3, 3,
+        false, true,  false,
+        true,  false, false,
+        false, false, true
+    );
+
+    M::MatrixBoolean s2 = d2.toSparse();
+    QCOMPARE(s2.matrixType(), M::MatrixBoolean::MatrixType::SPARSE);
+
+    QCOMPARE(s1 == d1, true);
+    QCOMPARE(d1 == s1, true);
+    QCOMPARE(s1 == s2, false);
+    QCOMPARE(s1.toDense().matrixType(), M::MatrixBoolean::MatrixType::DENSE);
+    QCOMPARE(s1.toDense(), d1);
+
+    QCOMPARE(s2.transpose(), d2.transpose());
+    QCOMPARE(s1.combineLeftToRight(s2), d1.combineLeftToRight(d2));
+    QCOMPARE(s1.combineTopToBottom(d2), d1.combineTopToBottom(d2));
+    QCOMPARE(d1.combineLeftToRight(s2), d1.combineLeftToRight(d2));
+    QCOMPARE(s1.columnReverse(), d1.columnReverse());
+    QCOMPARE(s1.rowReverse(), d1.rowReverse());
+
+    M::MatrixInteger i1(s1);
+    QCOMPARE(i1.matrixType(), M::MatrixInteger::MatrixType::SPARSE);
+    QCOMPARE(i1, M::MatrixInteger(d1));
+
+    M::MatrixBoolean b1(i1);
+    QCOMPARE(b1.matrixType(), M::MatrixBoolean::MatrixType::SPARSE);
+    QCOMPARE(b1, d1);
+}
+
+
 void TestMatrixBoolean::testTranspose() {
     std::mt19937                    rng(0x12345678);
     std::uniform_int_distribution<> coefficientDistribution(-1E6, +1E6);
@@ -1634,6 +1695,250 @@ void TestMatrixBoolean::testIterator() {
 }
 
 
+void TestMatrixBoolean::testBitParallelOperations() {
+    std::mt19937                    rng(0x12345678);
+    std::uniform_int_distribution<> coefficientDistribution(0, 2);
+
+    static const unsigned numberCases = 6;
+    static const M::Integer dimensions[numberCases][3] = {
+        {  70, 130,  45 },
+        {   3,   5,   7 },
+        {   1,   9,   2 },
+        {  40,   1,   3 },
+        { 130,  17,  65 },
+        {  33,  70,  20 }
+    };
+
+    for (unsigned i=0 ; i<numberCases ; ++i) {
+        M::Integer numberRows    = dimensions[i][0];
+        M::Integer numberTerms   = dimensions[i][1];
+        M::Integer numberColumns = dimensions[i][2];
+
+        M::MatrixBoolean a(numberRows, numberTerms);
+        M::MatrixBoolean b(numberRows, numberTerms);
+        M::MatrixBoolean c(numberTerms, numberColumns);
+
+        for (M::Integer row=1 ; row<=numberRows ; ++row) {
+            for (M::Integer column=1 ; column<=numberTerms ; ++column) {
+                a.update(row, column, coefficientDistribution(rng) == 0);
+                b.update(row, column, coefficientDistribution(rng) != 0);
+            }
+        }
+
+        for (M::Integer row=1 ; row<=numberTerms ; ++row) {
+            for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+                c.update(row, column, coefficientDistribution(rng) == 0);
+            }
+        }
+
+        M::MatrixBoolean andResult = a && b.toSparse();
+        M::MatrixBoolean orResult  = a || b;
+        M::MatrixBoolean xorResult = a ^ b.transpose().transpose();
+        M::MatrixBoolean notResult = !a;
+
+        for (M::Integer row=1 ; row<=numberRows ; ++row) {
+            for (M::Integer column=1 ; column<=numberTerms ; ++column) {
+                bool av = a(row, column);
+                bool bv = b(row, column);
+
+                QCOMPARE(andResult(row, column), av && bv);
+                QCOMPARE(orResult(row, column), av || bv);
+                QCOMPARE(xorResult(row, column), av != bv);
+                QCOMPARE(notResult(row, column), !av);
+            }
+        }
+
+        M::MatrixBoolean booleanResult = a.booleanProduct(c);
+        M::MatrixBoolean gf2Result     = a.toSparse().gf2Product(c.transpose().transpose());
+
+        QCOMPARE(booleanResult.numberRows(), numberRows);
+        QCOMPARE(booleanResult.numberColumns(), numberColumns);
+
+        for (M::Integer row=1 ; row<=numberRows ; ++row) {
+            for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+                unsigned count = 0;
+                for (M::Integer term=1 ; term<=numberTerms ; ++term) {
+                    if (a(row, term) && c(term, column)) {
+                        ++count;
+                    }
+                }
+
+                QCOMPARE(booleanResult(row, column), count > 0);
+                QCOMPARE(gf2Result(row, column), (count % 2) == 1);
+            }
+        }
+
+        QCOMPARE(c.transpose().booleanProduct(a.transpose()), booleanResult.transpose());
+    }
+
+    M::MatrixBoolean m1(10, 11);
+    M::MatrixBoolean m2(12, 13);
+
+    bool caughtException = false;
+    bool exceptionValid  = false;
+    try {
+        M::MatrixBoolean m3 = m1.booleanProduct(m2); // should throw an exception.
+        (void) m3;
+    } catch (const Model::IncompatibleMatrixDimensions& e) {
+        caughtException = true;
+
+        exceptionValid  = (
+               e.multiplierRows() == 10
+            && e.multiplierColumns() == 11
+            && e.multiplicandRows() == 12
+            && e.multiplicandColumns() == 13
+        );
+    } catch (...) {
+        caughtException = true;
+        exceptionValid  = false;
+    }
+
+    QCOMPARE(caughtException, true);
+    QCOMPARE(exceptionValid, true);
+}
+
+
+void TestMatrixBoolean::testGraphOperations() {
+    static const unsigned numberCases = 3;
+    static const M::Integer vertexCounts[numberCases] = { 12, 45, 150 };
+
+    for (unsigned i=0 ; i<numberCases ; ++i) {
+        M::Integer numberVertices = vertexCounts[i];
+        M::Integer chainLength    = numberVertices / 2;
+
+        // Vertices 1 through chainLength form a chain.  The remaining vertices form a cycle.
+
+        M::MatrixBoolean adjacency(numberVertices, numberVertices);
+        for (M::Integer vertex=1 ; vertex<chainLength ; ++vertex) {
+            adjacency.update(vertex, vertex + 1, true);
+        }
+
+        for (M::Integer vertex=chainLength+1 ; vertex<numberVertices ; ++vertex) {
+            adjacency.update(vertex, vertex + 1, true);
+        }
+
+        adjacency.update(numberVertices, chainLength + 1, true);
+
+        M::MatrixBoolean closure = adjacency.transitiveClosure();
+        for (M::Integer row=1 ; row<=numberVertices ; ++row) {
+            for (M::Integer column=1 ; column<=numberVertices ; ++column) {
+                bool expected;
+                if (row <= chainLength) {
+                    expected = (column > row && column <= chainLength);
+                } else {
+                    expected = (column > chainLength);
+                }
+
+                QCOMPARE(closure(row, column), expected);
+            }
+        }
+
+        QCOMPARE(adjacency.transpose().transitiveClosure(), closure.transpose());
+
+        M::MatrixBoolean sparseAdjacency = adjacency.toSparse();
+        M::MatrixBoolean empty(numberVertices, 1);
+        M::MatrixBoolean frontier(numberVertices, 1);
+        M::MatrixBoolean visited(numberVertices, 1);
+        frontier.update(M::Integer(1), true);
+        visited.update(M::Integer(1), true);
+
+        M::Integer steps = 0;
+        while (frontier != empty) {
+            ++steps;
+            frontier = sparseAdjacency.expandFrontier(frontier, visited);
+            visited  = visited || frontier;
+        }
+
+        QCOMPARE(steps, chainLength);
+        for (M::Integer vertex=1 ; vertex<=numberVertices ; ++vertex) {
+            QCOMPARE(visited(vertex), vertex <= chainLength);
+        }
+
+        M::MatrixInteger labels = adjacency.connectedComponents();
+        QCOMPARE(labels.numberRows(), numberVertices);
+        QCOMPARE(labels.numberColumns(), M::Integer(1));
+
+        for (M::Integer vertex=1 ; vertex<=numberVertices ; ++vertex) {
+            QCOMPARE(labels(vertex), vertex <= chainLength ? M::Integer(1) : M::Integer(2));
+        }
+    }
+}
+
+
+void TestMatrixBoolean::testColumnAccess() {
+    static const unsigned numberCases = 5;
+    static const M::Integer rowCounts[numberCases] = { 1, 5, 33, 64, 100 };
+
+    for (unsigned i=0 ; i<numberCases ; ++i) {
+        M::Integer numberRows    = rowCounts[i];
+        M::Integer numberColumns = 7;
+
+        M::MatrixBoolean m(numberRows, numberColumns);
+        for (M::Integer row=1 ; row<=numberRows ; ++row) {
+            for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+                m.update(row, column, ((row * 7 + column * 3) % 5) < 2);
+            }
+        }
+
+        std::unique_ptr<M::MatrixBoolean::Scalar[]> values(new M::MatrixBoolean::Scalar[numberRows]);
+        M::MatrixBoolean::Scalar* columnValues = values.get();
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            m.columnValues(column, columnValues);
+            for (M::Integer row=1 ; row<=numberRows ; ++row) {
+                QCOMPARE(columnValues[row - 1], m(row, column));
+            }
+        }
+
+        M::Integer visited = 0;
+        bool       inOrder = true;
+        m.forEach([&](bool coefficient) {
+            M::Integer row    = 1 + visited % numberRows;
+            M::Integer column = 1 + visited / numberRows;
+
+            inOrder = inOrder && coefficient == m(row, column);
+            ++visited;
+        });
+
+        QCOMPARE(visited, numberRows * numberColumns);
+        QCOMPARE(inOrder, true);
+
+        // Neighboring columns share storage units when the column size is below the storage unit size.
+
+        M::MatrixBoolean inverted = m;
+        inverted.transform([](bool coefficient) {
+            return !coefficient;
+        });
+
+        for (M::Integer row=1 ; row<=numberRows ; ++row) {
+            columnValues[row - 1] = (row % 2) == 0;
+        }
+
+        inverted.updateColumn(M::Integer(4), columnValues);
+
+        for (M::Integer row=1 ; row<=numberRows ; ++row) {
+            for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+                bool expected = column == 4 ? (row % 2) == 0 : !m(row, column);
+                QCOMPARE(inverted(row, column), expected);
+                QCOMPARE(m(row, column), ((row * 7 + column * 3) % 5) < 2);
+            }
+        }
+
+        QCOMPARE(inverted.logicalNot().logicalNot(), inverted);
+    }
+
+    M::MatrixBoolean m(3, 4);
+    bool exceptionThrown = false;
+    try {
+        bool values[3];
+        m.columnValues(M::Integer(5), values);
+    } catch (Model::InvalidColumn&) {
+        exceptionThrown = true;
+    }
+
+    QCOMPARE(exceptionThrown, true);
+}
+
+
 bool TestMatrixBoolean::boolify(unsigned value) {
     std::uint32_t x = value;
 
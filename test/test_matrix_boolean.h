@@ -78,6 +78,8 @@ class TestMatrixBoolean:public TestMatrixBase {
 
         void testMatrixTypeMethods();
 
+        void testSparseMethods();
+
         void testTranspose();
 
         void testComplexConjugate();
@@ -90,6 +92,12 @@ class TestMatrixBoolean:public TestMatrixBase {
 
         void testIterator();
 
+        void testBitParallelOperations();
+
+        void testGraphOperations();
+
+        void testColumnAccess();
+
     private:
         static bool boolify(unsigned value);
 
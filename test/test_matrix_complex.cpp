@@ -35,20 +35,27 @@
 #include <cmath>
 #include <random>
 #include <algorithm>
+#include <utility>
+#include <type_traits>
 
 #include <model_complex.h>
 #include <model_exceptions.h>
 #include <model_tuple.h>
 #include <m_basic_functions.h>
+#include <m_trigonometric_functions.h>
+#include <m_hyperbolic_functions.h>
+#include <m_matrix_functions.h>
 #include <model_matrix_boolean.h>
 #include <model_matrix_integer.h>
 #include <model_matrix_real.h>
 #include <model_matrix_complex.h>
 #include <m_matrix_complex.h>
+#include <m_matrix_real.h>
 #include <m_variant.h>
 #include <m_range.h>
 #include <m_set.h>
 #include <m_tuple.h>
+#include <m_iterative_solver.h>
 
 #include "test_matrix_base.h"
 #include "test_matrix_complex.h"
@@ -1253,6 +1260,193 @@ void TestMatrixComplex::testMatrixTypeMethods() {
 }
 
 
+void TestMatrixComplex::testSparseMethods() {
+    M::MatrixComplex s1 = M::MatrixComplex::sparse(3, 3);
+    QCOMPARE(s1.matrixType(), M::MatrixComplex::MatrixType::SPARSE);
+    QCOMPARE(s1.numberRows(), M::MatrixComplex::Index(3));
+    QCOMPARE(s1.numberColumns(), M::MatrixComplex::Index(3));
+
+    s1.update(M::Integer(1), M::Integer(1), M::Complex(1, 1));
+    s1.update(M::Integer(3), M::Integer(1), M::Complex(2, 0));
+    s1.update(M::Integer(2), M::Integer(2), M::Complex(0, 3));
+    s1.update(M::Integer(1), M::Integer(3), M::Complex(4, -1));
+    s1.update(M::Integer(3), M::Integer(3), M::Complex(5, 2));
+
+    QCOMPARE(s1.matrixType(), M::MatrixComplex::MatrixType::SPARSE);
+    QCOMPARE(s1(M::Integer(1), M::Integer(1)), M::Complex(1, 1));
+    QCOMPARE(s1(M::Integer(2), M::Integer(1)), M::Complex(0));
+    QCOMPARE(s1(M::Integer(3), M::Integer(1)), M::Complex(2, 0));
+    QCOMPARE(s1(M::Integer(1), M::Integer(3)), M::Complex(4, -1));
+    QCOMPARE(s1(M::Integer(2)), M::Complex(0));
+    QCOMPARE(s1.isHermitian(), false);
+
+    // Reading coefficients that are not stored must not insert them into the sparse store.
+    QCOMPARE(s1.numberStoredCoefficients(), 5ULL);
+    QCOMPARE(s1.matrixType(), M::MatrixComplex::MatrixType::SPARSE);
+
+    M::MatrixComplex d1 = M::MatrixComplex::build(
+        3, 3,
+        M::Complex(1, 1),  M::Complex(0), M::Complex(2, 0),
+        M::Complex(0),     M::Complex(0, 3), M::Complex(0),
+        M::Complex(4, -1), M::Complex(0), M::Complex(5, 2)
+    );
+
+    M::MatrixComplex d2 = M::MatrixComplex::build(
+        3, 3,
+        M::Complex(0),    M::Complex(7, 1), M::Complex(0),
+        M::Complex(6, 2), M::Complex(0),    M::Complex(0),
+        M::Complex(0),    M::Complex(0),    M::Complex(8, -3)
+    );
+
+    M::MatrixComplex s2 = d2.toSparse();
+    QCOMPARE(s2.matrixType(), M::MatrixComplex::MatrixType::SPARSE);
+
+    QCOMPARE(s1 == d1, true);
+    QCOMPARE(d1 == s1, true);
+    QCOMPARE(s1 == s2, false);
+    QCOMPARE(s1.toDense().matrixType(), M::MatrixComplex::MatrixType::DENSE);
+    QCOMPARE(s1.toDense(), d1);
+
+    M::MatrixComplex sum = s1 + s2;
+    QCOMPARE(sum.matrixType(), M::MatrixComplex::MatrixType::SPARSE);
+    QCOMPARE(sum, d1 + d2);
+    QCOMPARE(s1.conj() + s2.adjoint(), d1.conj() + d2.adjoint());
+
+    M::MatrixComplex difference = s1 - d2;
+    QCOMPARE(difference.matrixType(), M::MatrixComplex::MatrixType::DENSE);
+    QCOMPARE(difference, d1 - d2);
+    QCOMPARE(d1 - s2, d1 - d2);
+
+    M::MatrixComplex product = s1 * s2;
+    QCOMPARE(product.matrixType(), M::MatrixComplex::MatrixType::SPARSE);
+    QCOMPARE(product, d1 * d2);
+    QCOMPARE(s1.adjoint() * s2, d1.adjoint() * d2);
+    QCOMPARE(s1 * d2.adjoint(), d1 * d2.adjoint());
+    QCOMPARE(d1.transpose() * s2.adjoint(), d1.transpose() * d2.adjoint());
+    QCOMPARE(M::Complex(0, 2) * s1, M::Complex(0, 2) * d1);
+
+    QCOMPARE(s1.hadamard(d2), d1.hadamard(d2));
+    QCOMPARE(d1.hadamard(s2), d1.hadamard(d2));
+    QCOMPARE(s1.kronecker(s2), d1.kronecker(d2));
+    QCOMPARE(d1.kronecker(s2.adjoint()), d1.kronecker(d2.adjoint()));
+
+    QCOMPARE(s1.combineLeftToRight(s2), d1.combineLeftToRight(d2));
+    QCOMPARE(s1.combineTopToBottom(d2), d1.combineTopToBottom(d2));
+    QCOMPARE(s1.columnReverse(), d1.columnReverse());
+    QCOMPARE(s1.rowReverse(), d1.rowReverse());
+
+    QCOMPARE(s1.real().matrixType(), M::MatrixReal::MatrixType::SPARSE);
+    QCOMPARE(s1.real(), d1.real());
+    QCOMPARE(s1.imag(), d1.imag());
+
+    QCOMPARE(s1.oneNorm(), d1.oneNorm());
+    QCOMPARE(s1.infinityNorm(), d1.infinityNorm());
+
+    M::MatrixComplex c1(s1.real());
+    QCOMPARE(c1.matrixType(), M::MatrixComplex::MatrixType::SPARSE);
+    QCOMPARE(c1, M::MatrixComplex(d1.real()));
+
+    bool caughtException = false;
+    try {
+        M::MatrixComplex bad = s1 * M::MatrixComplex::sparse(2, 2);
+        (void) bad;
+    } catch (Model::IncompatibleMatrixDimensions&) {
+        caughtException = true;
+    }
+    QCOMPARE(caughtException, true);
+
+    M::MatrixComplex s3 = s1;
+    const M::Complex* rawData = s3.data();
+    QCOMPARE(s3.matrixType(), M::MatrixComplex::MatrixType::DENSE);
+    QCOMPARE(rawData[0], M::Complex(1, 1));
+    QCOMPARE(s1.matrixType(), M::MatrixComplex::MatrixType::SPARSE);
+}
+
+
+void TestMatrixComplex::testAutomaticStorageMethods() {
+    QCOMPARE(M::MatrixComplex::zero(10, 10).matrixType(), M::MatrixComplex::MatrixType::DENSE);
+    QCOMPARE(M::MatrixComplex::zero(100, 100).matrixType(), M::MatrixComplex::MatrixType::DENSE);
+
+    M::MatrixComplex m1 = M::MatrixComplex::sparse(100, 100);
+    QCOMPARE(m1.matrixType(), M::MatrixComplex::MatrixType::SPARSE);
+
+    for (M::MatrixComplex::Index index=1 ; index<=20 ; ++index) {
+        m1.update(index, index, M::Complex(1, 1));
+    }
+
+    QCOMPARE(m1.matrixType(), M::MatrixComplex::MatrixType::SPARSE);
+    QCOMPARE(m1(M::Integer(20), M::Integer(20)), M::Complex(1, 1));
+    QCOMPARE(m1(M::Integer(20), M::Integer(21)), M::Complex(0, 0));
+
+    for (M::MatrixComplex::Index column=1 ; column<=26 ; ++column) {
+        for (M::MatrixComplex::Index row=1 ; row<=100 ; ++row) {
+            m1.update(row, column, M::Complex(1, 1));
+        }
+    }
+
+    QCOMPARE(m1.matrixType(), M::MatrixComplex::MatrixType::DENSE);
+    QCOMPARE(m1(M::Integer(100), M::Integer(26)), M::Complex(1, 1));
+    QCOMPARE(m1(M::Integer(100), M::Integer(27)), M::Complex(0, 0));
+
+    M::MatrixComplex d1 = M::MatrixComplex::ones(100, 100);
+    M::MatrixComplex d2 = M::MatrixComplex::identity(100, 100);
+    QCOMPARE(d1.matrixType(), M::MatrixComplex::MatrixType::DENSE);
+
+    M::MatrixComplex difference = d1 - d1;
+    QCOMPARE(difference.matrixType(), M::MatrixComplex::MatrixType::DENSE);
+    QCOMPARE(difference, M::MatrixComplex::zero(100, 100));
+
+    difference.update(M::Integer(1), M::Integer(1), d1(M::Integer(1), M::Integer(1)));
+    QCOMPARE(difference.matrixType(), M::MatrixComplex::MatrixType::DENSE);
+
+    M::MatrixComplex movedDifference = M::MatrixComplex::ones(100, 100) - d1;
+    QCOMPARE(movedDifference.matrixType(), difference.matrixType());
+    QCOMPARE(movedDifference, M::MatrixComplex::zero(100, 100));
+
+    movedDifference.applyDensityThresholds();
+    QCOMPARE(movedDifference.matrixType(), M::MatrixComplex::MatrixType::SPARSE);
+    QCOMPARE(movedDifference, M::MatrixComplex::zero(100, 100));
+
+    M::MatrixComplex movedFrom = d1 + d2;
+    M::MatrixComplex movedTo(std::move(movedFrom));
+    QCOMPARE(movedTo, d1 + d2);
+    QCOMPARE(movedFrom.numberRows(), M::Integer(0));
+    QCOMPARE(movedFrom.numberColumns(), M::Integer(0));
+
+    movedFrom = std::move(movedTo);
+    QCOMPARE(movedFrom, d1 + d2);
+    QCOMPARE(movedTo.numberRows(), M::Integer(0));
+    QCOMPARE(movedTo.numberColumns(), M::Integer(0));
+    QCOMPARE(std::is_nothrow_move_constructible<M::MatrixComplex>::value, true);
+    QCOMPARE(std::is_nothrow_move_assignable<M::MatrixComplex>::value, true);
+
+    M::MatrixComplex product = d1.hadamard(d2);
+    QCOMPARE(product.matrixType(), M::MatrixComplex::MatrixType::DENSE);
+    QCOMPARE(product, d2);
+
+    M::MatrixComplex sum = d1 + d2;
+    QCOMPARE(sum.matrixType(), M::MatrixComplex::MatrixType::DENSE);
+
+    M::Real sparseThreshold = M::MatrixComplex::sparseDensityThreshold();
+    M::MatrixComplex::setSparseDensityThreshold(0);
+    QCOMPARE(M::MatrixComplex::sparseDensityThreshold(), M::Real(0));
+    QCOMPARE(M::MatrixComplex::zero(100, 100).matrixType(), M::MatrixComplex::MatrixType::DENSE);
+    M::MatrixComplex zeros = d1 - d1;
+    zeros.applyDensityThresholds();
+    QCOMPARE(zeros.matrixType(), M::MatrixComplex::MatrixType::DENSE);
+    M::MatrixComplex::setSparseDensityThreshold(sparseThreshold);
+
+    unsigned long long minimumCoefficients = M::MatrixComplex::automaticStorageMinimumCoefficients();
+    M::MatrixComplex::setAutomaticStorageMinimumCoefficients(16);
+    M::MatrixComplex small = M::MatrixComplex::ones(4, 4);
+    M::MatrixComplex smallZeros = small - small;
+    QCOMPARE(smallZeros.matrixType(), M::MatrixComplex::MatrixType::DENSE);
+    smallZeros.applyDensityThresholds();
+    QCOMPARE(smallZeros.matrixType(), M::MatrixComplex::MatrixType::SPARSE);
+    M::MatrixComplex::setAutomaticStorageMinimumCoefficients(minimumCoefficients);
+}
+
+
 void TestMatrixComplex::testDeterminant1() {
     // We noted a simple test produced an incorrect determinant value (+2 rather than -2).  This test exists to verify
     // that the issue is resolved.
@@ -2584,6 +2778,118 @@ void TestMatrixComplex::testSolve() {
 }
 
 
+void TestMatrixComplex::testIterativeSolvers() {
+    std::mt19937                            rng(0x12345678);
+    std::uniform_real_distribution<M::Real> coefficientDistribution(-1, +1);
+
+    M::Integer gridSize         = 16;
+    M::Integer numberRowColumns = gridSize * gridSize;
+
+    M::MatrixComplex y(numberRowColumns, 2);
+    for (M::Integer row=1 ; row<=numberRowColumns ; ++row) {
+        y.update(row, M::Integer(1), M::Complex(coefficientDistribution(rng), coefficientDistribution(rng)));
+        y.update(row, M::Integer(2), M::Complex(coefficientDistribution(rng), coefficientDistribution(rng)));
+    }
+
+    // The first system is Hermitian positive definite, a grid Laplacian with complex phases on the horizontal
+    // couplings.  The second system adds a complex convection term and is not Hermitian.
+
+    for (unsigned convection=0 ; convection<2 ; ++convection) {
+        M::Complex forward  = convection ? M::Complex(-0.5, 0.25) : M::Complex(-0.6, -0.8);
+        M::Complex backward = convection ? M::Complex(-1.0, 0)    : M::Complex(-0.6, +0.8);
+
+        M::MatrixComplex a = M::MatrixComplex::sparse(numberRowColumns, numberRowColumns);
+        for (M::Integer index=0 ; index<numberRowColumns ; ++index) {
+            M::Integer gridX = index % gridSize;
+            M::Integer gridY = index / gridSize;
+
+            a.update(index + 1, index + 1, M::Complex(4));
+            if (gridX > 0) {
+                a.update(index + 1, index, backward);
+            }
+
+            if (gridX + 1 < gridSize) {
+                a.update(index + 1, index + 2, forward);
+            }
+
+            if (gridY > 0) {
+                a.update(index + 1, index + 1 - gridSize, M::Complex(-1));
+            }
+
+            if (gridY + 1 < gridSize) {
+                a.update(index + 1, index + 1 + gridSize, M::Complex(-1));
+            }
+        }
+
+        M::IterativeSolver::Method methods[] = {
+            M::IterativeSolver::Method::CONJUGATE_GRADIENT,
+            M::IterativeSolver::Method::BICGSTAB,
+            M::IterativeSolver::Method::GMRES
+        };
+
+        M::IterativeSolver::Preconditioner preconditioners[] = {
+            M::IterativeSolver::Preconditioner::NONE,
+            M::IterativeSolver::Preconditioner::JACOBI,
+            M::IterativeSolver::Preconditioner::ILU0,
+            M::IterativeSolver::Preconditioner::INCOMPLETE_CHOLESKY
+        };
+
+        for (M::IterativeSolver::Method method : methods) {
+            if (convection && method == M::IterativeSolver::Method::CONJUGATE_GRADIENT) {
+                continue;
+            }
+
+            M::Integer unpreconditionedIterations = 0;
+            for (M::IterativeSolver::Preconditioner preconditioner : preconditioners) {
+                M::IterativeSolver solver(method, preconditioner, 1.0E-10);
+
+                M::MatrixComplex x = solver.solve(a, y);
+                QCOMPARE(solver.converged(), true);
+                QCOMPARE(solver.relativeResidual() <= 1.0E-10, true);
+
+                if (preconditioner == M::IterativeSolver::Preconditioner::NONE) {
+                    unpreconditionedIterations = solver.numberIterations();
+                } else if (preconditioner != M::IterativeSolver::Preconditioner::JACOBI) {
+                    QCOMPARE(solver.numberIterations() < unpreconditionedIterations, true);
+                }
+
+                M::MatrixComplex residual = a * x - y;
+                for (M::Integer column=1 ; column<=2 ; ++column) {
+                    M::Real residualNorm = 0;
+                    M::Real yNorm        = 0;
+                    for (M::Integer row=1 ; row<=numberRowColumns ; ++row) {
+                        residualNorm += M::abs(residual(row, column)) * M::abs(residual(row, column));
+                        yNorm        += M::abs(y(row, column)) * M::abs(y(row, column));
+                    }
+
+                    QCOMPARE(std::sqrt(residualNorm / yNorm) <= 1.0E-9, true);
+                }
+
+                // A pending conjugation of A must be honored.  Since conj(A) x = y exactly when A conj(x) = conj(y)
+                // both solutions must agree.
+
+                M::MatrixComplex conjugateX = solver.solve(a.conj(), y);
+                QCOMPARE(solver.converged(), true);
+
+                M::MatrixComplex expectedX  = solver.solve(a, y.conj()).conj();
+                M::MatrixComplex difference = conjugateX - expectedX;
+                for (M::Integer column=1 ; column<=2 ; ++column) {
+                    for (M::Integer row=1 ; row<=numberRowColumns ; ++row) {
+                        QCOMPARE(M::abs(difference(row, column)) <= 1.0E-6, true);
+                    }
+                }
+
+                // Warm starting from the previous solution should need no further iterations.
+
+                solver.solve(a, y, x);
+                QCOMPARE(solver.converged(), true);
+                QCOMPARE(solver.numberIterations(), 0UL);
+            }
+        }
+    }
+}
+
+
 void TestMatrixComplex::testLeastSquares() {
     std::mt19937                                rng(0x12345678);
     std::uniform_int_distribution<>             dimensionDistribution(1, 100);
@@ -3887,6 +4193,390 @@ void TestMatrixComplex::testMultiplicationFunctions() {
 }
 
 
+void TestMatrixComplex::testFusedArithmetic() {
+    std::mt19937                            rng(0x5EED1234);
+    std::uniform_real_distribution<M::Real> coefficientDistribution(-1, +1);
+
+    M::Integer numberRows    = 29;
+    M::Integer numberColumns = 17;
+    M::Integer innerSize     = 13;
+
+    M::MatrixComplex a(numberRows, innerSize);
+    M::MatrixComplex b(innerSize, numberColumns);
+    M::MatrixComplex bh(numberColumns, innerSize);
+    M::MatrixComplex c(numberRows, numberColumns);
+    M::MatrixComplex ch(numberColumns, numberRows);
+    M::MatrixComplex d(numberRows, numberColumns);
+
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=innerSize ; ++column) {
+            a.update(row, column, M::Complex(coefficientDistribution(rng), coefficientDistribution(rng)));
+        }
+
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            c.update(row, column, M::Complex(coefficientDistribution(rng), coefficientDistribution(rng)));
+            ch.update(column, row, M::Complex(coefficientDistribution(rng), coefficientDistribution(rng)));
+            d.update(row, column, M::Complex(coefficientDistribution(rng), coefficientDistribution(rng)));
+        }
+    }
+
+    for (M::Integer row=1 ; row<=innerSize ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            b.update(row, column, M::Complex(coefficientDistribution(rng), coefficientDistribution(rng)));
+            bh.update(column, row, M::Complex(coefficientDistribution(rng), coefficientDistribution(rng)));
+        }
+    }
+
+    M::MatrixComplex sparseD = M::MatrixComplex::sparse(numberRows, numberColumns);
+    for (M::Integer index=1 ; index<=numberColumns ; ++index) {
+        sparseD.update(index, index, M::Complex(M::Real(index), M::Real(-1)));
+    }
+
+    // Each fused expression is compared against the same calculation performed using only named intermediate
+    // values, which forces every step to be calculated out of place.
+
+    M::Complex alpha(0.5, -1.5);
+    M::Complex beta(-2, 0.25);
+
+    M::MatrixComplex product       = a * b;
+    M::MatrixComplex scaledC       = alpha * c;
+    M::MatrixComplex expected1     = product + ch.adjoint();
+    M::MatrixComplex expected2     = product - scaledC;
+    M::MatrixComplex scaledA       = beta * a;
+    M::MatrixComplex productH      = scaledA * bh.adjoint();
+    M::MatrixComplex conjugateD    = d.conj();
+    M::MatrixComplex expected3     = productH + conjugateD;
+    M::MatrixComplex sumCD         = scaledC + d;
+    M::MatrixComplex scaledD       = beta * d;
+    M::MatrixComplex expected4     = sumCD - scaledD;
+    M::MatrixComplex expected5     = expected4 + sparseD;
+    M::MatrixComplex scaledProduct = alpha * product;
+    M::MatrixComplex scaledSum     = beta * c;
+    M::MatrixComplex expected6     = scaledProduct + scaledSum;
+    M::MatrixComplex expected7     = productH - product;
+
+    M::MatrixComplex fused1 = a * b + ch.adjoint();
+    M::MatrixComplex fused2 = a * b - alpha * c;
+    M::MatrixComplex fused3 = (beta * a) * bh.adjoint() + d.conj();
+    M::MatrixComplex fused4 = alpha * c + d - beta * d;
+    M::MatrixComplex fused5 = alpha * c + d - beta * d + sparseD;
+
+    // Shared destinations fall back to calculating the result out of place.
+
+    M::MatrixComplex fused6 = c;
+    fused6.multiplyAccumulate(alpha * a, b, beta);
+
+    M::MatrixComplex fused7 = c * beta;
+    fused7.multiplyAccumulate(a, b * alpha);
+
+    // Unshared dense destinations are updated in place.
+
+    M::MatrixComplex fused8 = a * b;
+    fused8.multiplyAccumulate(scaledA, bh.adjoint(), M::Complex(-1, 0));
+
+    M::MatrixComplex fused9 = a * b;
+    fused9 += ch.adjoint();
+
+    M::MatrixComplex* expected[] = {
+        &expected1, &expected2, &expected3, &expected4, &expected5, &expected6, &expected6, &expected7, &expected1
+    };
+
+    M::MatrixComplex* fused[] = { &fused1, &fused2, &fused3, &fused4, &fused5, &fused6, &fused7, &fused8, &fused9 };
+
+    for (unsigned i=0 ; i<9 ; ++i) {
+        QCOMPARE(fused[i]->numberRows(), numberRows);
+        QCOMPARE(fused[i]->numberColumns(), numberColumns);
+
+        for (M::Integer row=1 ; row<=numberRows ; ++row) {
+            for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+                M::Complex difference = (*fused[i])(row, column) - (*expected[i])(row, column);
+                QCOMPARE(M::abs(difference) <= 1.0E-12, true);
+            }
+        }
+    }
+
+    // In-place accumulation must not disturb matrices sharing the original data.
+
+    M::MatrixComplex shared = c;
+    M::MatrixComplex alias  = shared;
+    shared += d;
+    shared.multiplyAccumulate(a, b);
+    QCOMPARE(alias == c, true);
+
+    bool caughtException = false;
+    try {
+        M::MatrixComplex wrongSize(numberRows, numberColumns + 1);
+        wrongSize.multiplyAccumulate(a, b);
+    } catch (Model::IncompatibleMatrixDimensions&) {
+        caughtException = true;
+    }
+
+    QCOMPARE(caughtException, true);
+}
+
+
+void TestMatrixComplex::testSmallMatrixKernels() {
+    static const M::Real realValues[4][4] = {
+        { 0, 2, 1, 3 },
+        { 4, 1, 0, 2 },
+        { 1, 3, 5, 0 },
+        { 2, 0, 1, 4 }
+    };
+
+    static const M::Real imaginaryValues[4][4] = {
+        {  1,  0, -1,  2 },
+        {  0,  2,  1,  0 },
+        { -2,  1,  0,  1 },
+        {  1, -1,  0,  3 }
+    };
+
+    static const M::Complex determinants[4] = {
+        M::Complex(0, 1), M::Complex(-10, 1), M::Complex(-32, 5), M::Complex(-105, -171)
+    };
+
+    for (M::Integer n=1 ; n<=4 ; ++n) {
+        M::MatrixComplex a(n, n);
+        M::MatrixComplex b(n, 3);
+
+        for (M::Integer row=1 ; row<=n ; ++row) {
+            for (M::Integer column=1 ; column<=n ; ++column) {
+                a.update(
+                    row,
+                    column,
+                    M::Complex(realValues[row - 1][column - 1], imaginaryValues[row - 1][column - 1])
+                );
+            }
+
+            for (M::Integer column=1 ; column<=3 ; ++column) {
+                b.update(row, column, M::Complex(row - column, row + column));
+            }
+        }
+
+        QCOMPARE(M::abs(a.determinant() - determinants[n - 1]) <= 1.0E-12, true);
+
+        M::MatrixComplex product  = a * b;
+        M::MatrixComplex productT = a.transpose() * b;
+        M::MatrixComplex sum      = a + M::Complex(0, 2) * a.transpose();
+        M::MatrixComplex inverse  = a.inverse();
+        M::MatrixComplex x        = a.solve(b);
+
+        for (M::Integer row=1 ; row<=n ; ++row) {
+            for (M::Integer column=1 ; column<=3 ; ++column) {
+                M::Complex expected  = 0;
+                M::Complex expectedT = 0;
+                M::Complex residual  = -b(row, column);
+                for (M::Integer k=1 ; k<=n ; ++k) {
+                    expected  += a(row, k) * b(k, column);
+                    expectedT += a(k, row) * b(k, column);
+                    residual  += a(row, k) * x(k, column);
+                }
+
+                QCOMPARE(M::abs(product(row, column) - expected) <= 1.0E-12, true);
+                QCOMPARE(M::abs(productT(row, column) - expectedT) <= 1.0E-12, true);
+                QCOMPARE(M::abs(residual) <= 1.0E-12, true);
+            }
+
+            for (M::Integer column=1 ; column<=n ; ++column) {
+                M::Complex identity = 0;
+                for (M::Integer k=1 ; k<=n ; ++k) {
+                    identity += a(row, k) * inverse(k, column);
+                }
+
+                QCOMPARE(M::abs(identity - M::Complex(row == column ? 1 : 0)) <= 1.0E-12, true);
+                QCOMPARE(sum(row, column), a(row, column) + M::Complex(0, 2) * a(column, row));
+            }
+        }
+    }
+
+    M::MatrixComplex singular(2, 2);
+    singular.update(M::Integer(1), M::Integer(1), M::Complex(1, 0));
+    singular.update(M::Integer(1), M::Integer(2), M::Complex(0, 1));
+    singular.update(M::Integer(2), M::Integer(1), M::Complex(0, 1));
+    singular.update(M::Integer(2), M::Integer(2), M::Complex(-1, 0));
+
+    QCOMPARE(singular.determinant(), M::Complex(0));
+
+    bool caughtException = false;
+    try {
+        M::MatrixComplex inverse = singular.inverse();
+        (void) inverse;
+    } catch (Model::MatrixIsSingular&) {
+        caughtException = true;
+    }
+
+    QCOMPARE(caughtException, true);
+}
+
+
+void TestMatrixComplex::testSmallMatrixStorage() {
+    M::MatrixComplex a(M::Integer(2), M::Integer(3));
+    for (M::Integer row=1 ; row<=2 ; ++row) {
+        for (M::Integer column=1 ; column<=3 ; ++column) {
+            a.update(row, column, M::Complex(row, column));
+        }
+    }
+
+    M::MatrixComplex copy = a;
+    copy.update(M::Integer(1), M::Integer(1), M::Complex(-1, 0));
+    QCOMPARE(a(M::Integer(1), M::Integer(1)), M::Complex(1, 1));
+    QCOMPARE(copy(M::Integer(1), M::Integer(1)), M::Complex(-1, 0));
+
+    M::MatrixComplex moved = std::move(copy);
+    QCOMPARE(copy.numberRows(), M::Integer(0));
+    QCOMPARE(copy.numberColumns(), M::Integer(0));
+    QCOMPARE(moved(M::Integer(1), M::Integer(1)), M::Complex(-1, 0));
+    QCOMPARE(moved(M::Integer(2), M::Integer(3)), M::Complex(2, 3));
+
+    M::MatrixComplex scaledAdjoint = M::Complex(0, 1) * a.adjoint();
+    QCOMPARE(scaledAdjoint.numberRows(), M::Integer(3));
+    QCOMPARE(scaledAdjoint.numberColumns(), M::Integer(2));
+    QCOMPARE(scaledAdjoint(M::Integer(3), M::Integer(1)), M::Complex(3, 1));
+    QCOMPARE(scaledAdjoint(M::Integer(1), M::Integer(2)), M::Complex(1, 2));
+
+    M::MatrixComplex conjugateSum = a.conj() + a;
+    QCOMPARE(conjugateSum(M::Integer(2), M::Integer(3)), M::Complex(4, 0));
+
+    M::MatrixComplex resized = a;
+    resized.resize(M::Integer(4), M::Integer(4));
+    QCOMPARE(resized(M::Integer(2), M::Integer(3)), M::Complex(2, 3));
+    QCOMPARE(resized(M::Integer(4), M::Integer(4)), M::Complex(0, 0));
+
+    // Growing past the inline limit must move the coefficients into a data store without losing them.
+
+    M::MatrixComplex grown = a;
+    grown.update(M::Integer(5), M::Integer(6), M::Complex(5, 6));
+    QCOMPARE(grown.numberRows(), M::Integer(5));
+    QCOMPARE(grown.numberColumns(), M::Integer(6));
+    QCOMPARE(grown(M::Integer(1), M::Integer(2)), M::Complex(1, 2));
+    QCOMPARE(grown(M::Integer(2), M::Integer(3)), M::Complex(2, 3));
+    QCOMPARE(grown(M::Integer(4), M::Integer(4)), M::Complex(0, 0));
+    QCOMPARE(grown(M::Integer(5), M::Integer(6)), M::Complex(5, 6));
+    QCOMPARE(a.numberRows(), M::Integer(2));
+
+    M::MatrixComplex product = a * a.adjoint();
+    QCOMPARE(product(M::Integer(1), M::Integer(2)), M::Complex(20, 6));
+    QCOMPARE(product(M::Integer(2), M::Integer(1)), M::Complex(20, -6));
+
+    const M::Complex* data = a.data();
+    QCOMPARE(data[0], M::Complex(1, 1));
+    QCOMPARE(data[1], M::Complex(2, 1));
+    QCOMPARE(a.columnData(M::Integer(3))[1], M::Complex(2, 3));
+}
+
+
+void TestMatrixComplex::testSubmatrixViews() {
+    M::Integer numberRows    = 9;
+    M::Integer numberColumns = 11;
+
+    M::MatrixComplex m(numberRows, numberColumns);
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            m.update(row, column, M::Complex(row, column));
+        }
+    }
+
+    // Slices of slices compose their offsets and strides against the original coefficients.
+
+    M::MatrixComplex view = m.at(
+        M::Range(M::Integer(1), numberRows),
+        M::Range(M::Integer(11), M::Integer(10), M::Integer(2))
+    );
+    QCOMPARE(view.numberRows(), M::Integer(9));
+    QCOMPARE(view.numberColumns(), M::Integer(10));
+    QCOMPARE(view(M::Integer(4), M::Integer(3)), M::Complex(4, 9));
+
+    M::MatrixComplex nested = view.at(
+        M::Range(M::Integer(2), M::Integer(3), M::Integer(9)),
+        M::Range(M::Integer(1), M::Integer(3), M::Integer(9))
+    );
+    QCOMPARE(nested.numberRows(), M::Integer(8));
+    QCOMPARE(nested.numberColumns(), M::Integer(5));
+    for (M::Integer row=1 ; row<=nested.numberRows() ; ++row) {
+        for (M::Integer column=1 ; column<=nested.numberColumns() ; ++column) {
+            QCOMPARE(nested(row, column), M::Complex(row + 1, 13 - 2 * column));
+        }
+    }
+
+    M::MatrixComplex adjoint = nested.adjoint();
+    QCOMPARE(adjoint.numberRows(), M::Integer(5));
+    QCOMPARE(adjoint.numberColumns(), M::Integer(8));
+    QCOMPARE(adjoint(M::Integer(5), M::Integer(8)), M::Complex(9, -3));
+
+    // Writes copy the view out of the source.  Writes to the source leave existing views unchanged.
+
+    M::MatrixComplex copy = nested;
+    nested.update(M::Integer(1), M::Integer(1), M::Complex(-1, -1));
+    QCOMPARE(nested(M::Integer(1), M::Integer(1)), M::Complex(-1, -1));
+    QCOMPARE(copy(M::Integer(1), M::Integer(1)), M::Complex(2, 11));
+    QCOMPARE(m(M::Integer(2), M::Integer(11)), M::Complex(2, 11));
+
+    m.update(M::Integer(3), M::Integer(9), M::Complex(0, 0));
+    QCOMPARE(copy(M::Integer(2), M::Integer(2)), M::Complex(3, 9));
+    QCOMPARE(view(M::Integer(3), M::Integer(3)), M::Complex(3, 9));
+}
+
+
+void TestMatrixComplex::testElementwiseFunctions() {
+    M::Integer numberRows    = 11;
+    M::Integer numberColumns = 5;
+
+    M::MatrixComplex m(numberRows, numberColumns);
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            m.update(row, column, M::Complex(M::Real(row - 6) / M::Real(4), M::Real(column - 3) / M::Real(3)));
+        }
+    }
+
+    auto close = [](const M::Complex& measured, const M::Complex& expected) {
+        return M::abs(measured - expected) <= 1.0E-12 * std::max(M::Real(1), M::abs(expected));
+    };
+
+    M::MatrixComplex scaled = M::Complex(0, 2) * m.transpose();
+
+    M::MatrixComplex expM     = M::exp(scaled);
+    M::MatrixComplex lnM      = M::ln(m);
+    M::MatrixComplex sqrtM    = M::sqrt(m);
+    M::MatrixComplex powM     = M::pow(m, M::Complex(1.5, -0.5));
+    M::MatrixComplex sineM    = M::sine(m);
+    M::MatrixComplex cosineM  = M::cosine(m);
+    M::MatrixComplex tangentM = M::tangent(m);
+    M::MatrixComplex arcsineM = M::arcsine(m);
+    M::MatrixComplex arccosM  = M::arccosine(m);
+    M::MatrixComplex arctanM  = M::arctangent(m);
+    M::MatrixComplex sinhM    = M::hyperbolicSine(m);
+    M::MatrixComplex coshM    = M::hyperbolicCosine(m);
+    M::MatrixComplex tanhM    = M::hyperbolicTangent(m);
+    M::MatrixComplex gammaM   = M::gamma(m + M::Complex(4, 0) * M::MatrixComplex::ones(numberRows, numberColumns));
+
+    QCOMPARE(expM.numberRows(), numberColumns);
+    QCOMPARE(expM.numberColumns(), numberRows);
+
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            M::Complex v = m(row, column);
+            M::Complex s = M::Complex(0, 2) * v;
+
+            std::complex<M::Real> expected = std::exp(std::complex<M::Real>(s.real(), s.imag()));
+
+            QCOMPARE(close(expM(column, row), M::Complex(expected.real(), expected.imag())), true);
+            QCOMPARE(lnM(row, column), M::ln(v));
+            QCOMPARE(sqrtM(row, column), M::sqrt(v));
+            QCOMPARE(powM(row, column), M::pow(v, M::Complex(1.5, -0.5)));
+            QCOMPARE(sineM(row, column), M::sine(v));
+            QCOMPARE(cosineM(row, column), M::cosine(v));
+            QCOMPARE(tangentM(row, column), M::tangent(v));
+            QCOMPARE(arcsineM(row, column), M::arcsine(v));
+            QCOMPARE(arccosM(row, column), M::arccosine(v));
+            QCOMPARE(arctanM(row, column), M::arctangent(v));
+            QCOMPARE(sinhM(row, column), M::hyperbolicSine(v));
+            QCOMPARE(coshM(row, column), M::hyperbolicCosine(v));
+            QCOMPARE(tanhM(row, column), M::hyperbolicTangent(v));
+            QCOMPARE(close(gammaM(row, column), M::gamma(v + M::Complex(4, 0))), true);
+        }
+    }
+}
+
+
 void TestMatrixComplex::testRealImagFunctions() {
     Model::MatrixComplex m1 = Model::MatrixComplex::build(
         3, 3,
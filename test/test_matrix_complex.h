@@ -78,6 +78,10 @@ class TestMatrixComplex:public TestMatrixBase {
 
         void testMatrixTypeMethods();
 
+        void testSparseMethods();
+
+        void testAutomaticStorageMethods();
+
         void testDeterminant1();
 
         void testDeterminant2();
@@ -124,6 +128,8 @@ class TestMatrixComplex:public TestMatrixBase {
 
         void testSolve();
 
+        void testIterativeSolvers();
+
         void testLeastSquares();
 
         void testHadamardProduct();
@@ -162,6 +168,16 @@ class TestMatrixComplex:public TestMatrixBase {
 
         void testMultiplicationFunctions();
 
+        void testFusedArithmetic();
+
+        void testSmallMatrixKernels();
+
+        void testSmallMatrixStorage();
+
+        void testSubmatrixViews();
+
+        void testElementwiseFunctions();
+
         void testRealImagFunctions();
 
         void testIterator();
@@ -1140,6 +1140,105 @@ void TestMatrixInteger::testMatrixTypeMethods() {
 }
 
 
+void TestMatrixInteger::testSparseMethods() {
+    M::MatrixInteger s1 = M::MatrixInteger::sparse(3, 3);
+    QCOMPARE(s1.matrixType(), M::MatrixInteger::MatrixType::SPARSE);
+    QCOMPARE(s1.numberRows(), M::MatrixInteger::Index(3));
+    QCOMPARE(s1.numberColumns(), M::MatrixInteger::Index(3));
+
+    s1.update(M::Integer(1), M::Integer(1), M::Integer(1));
+    s1.update(M::Integer(3), M::Integer(1), M::Integer(2));
+    s1.update(M::Integer(2), M::Integer(2), M::Integer(3));
+    s1.update(M::Integer(1), M::Integer(3), M::Integer(4));
+    s1.update(M::Integer(3), M::Integer(3), M::Integer(5));
+
+    QCOMPARE(s1.matrixType(), M::MatrixInteger::MatrixType::SPARSE);
+    QCOMPARE(s1(M::Integer(1), M::Integer(1)), M::Integer(1));
+    QCOMPARE(s1(M::Integer(2), M::Integer(1)), M::Integer(0));
+    QCOMPARE(s1(M::Integer(3), M::Integer(1)), M::Integer(2));
+    QCOMPARE(s1(M::Integer(1), M::Integer(3)), M::Integer(4));
+    QCOMPARE(s1(M::Integer(2)), M::Integer(0));
+    QCOMPARE(s1.diagonalEntries()(M::Integer(2), M::Integer(1)), M::Integer(3));
+
+    // Reading coefficients that are not stored must not insert them into the sparse store.
+    QCOMPARE(s1.numberStoredCoefficients(), 5ULL);
+    QCOMPARE(s1.matrixType(), M::MatrixInteger::MatrixType::SPARSE);
+
+    M::MatrixInteger d1 = M::MatrixInteger::build(
+        3, 3,
+        M::Integer(1), M::Integer(0), M::Integer(2),
+        M::Integer(0), M::Integer(3), M::Integer(0),
+        M::Integer(4), M::Integer(0), M::Integer(5)
+    );
+
+    M::MatrixInteger d2 = M::MatrixInteger::build(
+        3, 3,
+        M::Integer(0), M::Integer(7), M::Integer(0),
+        M::Integer(6), M::Integer(0), M::Integer(0),
+        M::Integer(0), M::Integer(0), M::Integer(8)
+    );
+
+    M::MatrixInteger s2 = d2.toSparse();
+    QCOMPARE(s2.matrixType(), M::MatrixInteger::MatrixType::SPARSE);
+
+    QCOMPARE(s1 == d1, true);
+    QCOMPARE(d1 == s1, true);
+    QCOMPARE(s1 == s2, false);
+    QCOMPARE(s1.toDense().matrixType(), M::MatrixInteger::MatrixType::DENSE);
+    QCOMPARE(s1.toDense(), d1);
+
+    M::MatrixInteger sum = s1 + s2;
+    QCOMPARE(sum.matrixType(), M::MatrixInteger::MatrixType::SPARSE);
+    QCOMPARE(sum, d1 + d2);
+
+    M::MatrixInteger difference = s1 - d2;
+    QCOMPARE(difference.matrixType(), M::MatrixInteger::MatrixType::DENSE);
+    QCOMPARE(difference, d1 - d2);
+    QCOMPARE(d1 - s2, d1 - d2);
+
+    M::MatrixInteger product = s1 * s2;
+    QCOMPARE(product.matrixType(), M::MatrixInteger::MatrixType::SPARSE);
+    QCOMPARE(product, d1 * d2);
+    QCOMPARE(s1.transpose() * s2, d1.transpose() * d2);
+    QCOMPARE(s1 * d2.transpose(), d1 * d2.transpose());
+    QCOMPARE(d1 * s2, d1 * d2);
+    QCOMPARE(M::Integer(2) * s1, M::Integer(2) * d1);
+
+    QCOMPARE(s1.hadamard(d2), d1.hadamard(d2));
+    QCOMPARE(d1.hadamard(s2), d1.hadamard(d2));
+    QCOMPARE(s1.kronecker(s2), d1.kronecker(d2));
+    QCOMPARE(d1.kronecker(s2), d1.kronecker(d2));
+
+    QCOMPARE(s1.combineLeftToRight(s2), d1.combineLeftToRight(d2));
+    QCOMPARE(s1.combineTopToBottom(d2), d1.combineTopToBottom(d2));
+    QCOMPARE(s1.columnReverse(), d1.columnReverse());
+    QCOMPARE(s1.rowReverse(), d1.rowReverse());
+
+    M::MatrixReal r1(s1);
+    QCOMPARE(r1.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+    QCOMPARE(r1, M::MatrixReal(d1));
+
+    M::MatrixInteger i1(r1);
+    QCOMPARE(i1.matrixType(), M::MatrixInteger::MatrixType::SPARSE);
+    QCOMPARE(i1, d1);
+
+    bool caughtException = false;
+    try {
+        M::MatrixInteger bad = s1 * M::MatrixInteger::sparse(2, 2);
+        (void) bad;
+    } catch (Model::IncompatibleMatrixDimensions&) {
+        caughtException = true;
+    }
+    QCOMPARE(caughtException, true);
+
+    M::MatrixInteger s3 = s1;
+    const M::Integer* rawData = s3.data();
+    QCOMPARE(s3.matrixType(), M::MatrixInteger::MatrixType::DENSE);
+    QCOMPARE(rawData[0], M::Integer(1));
+    QCOMPARE(s1.matrixType(), M::MatrixInteger::MatrixType::SPARSE);
+}
+
+
 void TestMatrixInteger::testTranspose() {
     Model::MatrixInteger m = Model::MatrixInteger::build(
         2, 3,
@@ -2108,6 +2207,113 @@ void TestMatrixInteger::testMultiplicationFunctions() {
 }
 
 
+void TestMatrixInteger::testInPlaceArithmetic() {
+    M::Integer numberRows    = 11;
+    M::Integer numberColumns = 11;
+
+    M::MatrixInteger x(numberRows, numberColumns);
+    M::MatrixInteger y(numberRows, numberColumns);
+    M::MatrixInteger s = M::MatrixInteger::sparse(numberRows, numberColumns);
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            x.update(row, column, 100 * row + column);
+            y.update(row, column, row - column);
+        }
+
+        s.update(row, row, row);
+    }
+
+    M::MatrixInteger sum(numberRows, numberColumns);
+    const M::Integer* sumData = sum.data();
+
+    for (M::Integer i=0 ; i<10 ; ++i) {
+        sum += x;
+        sum -= M::Integer(2) * y;
+        sum += y.transpose();
+        sum += s;
+    }
+
+    QCOMPARE(sum.data(), sumData);
+
+    M::MatrixInteger shared = sum;
+    sum -= x;
+
+    QCOMPARE(shared.data(), sumData);
+    QVERIFY(sum.data() != sumData);
+
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            M::Integer expected = 10 * (x(row, column) - 2 * y(row, column) + y(column, row) + s(row, column));
+            QCOMPARE(shared(row, column), expected);
+            QCOMPARE(sum(row, column), expected - x(row, column));
+        }
+    }
+
+    M::MatrixInteger t = x + y;
+    const M::Integer* tData = t.data();
+
+    t = t.transpose() * M::Integer(3);
+    QCOMPARE(t.data(), tData);
+
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            QCOMPARE(t(row, column), 3 * (x(column, row) + y(column, row)));
+        }
+    }
+}
+
+
+void TestMatrixInteger::testBlockedMultiplication() {
+    // Dimensions are chosen to cross the packing block boundaries and leave partial micro-kernel tiles.  The second
+    // product is large enough to be split into column blocks calculated on separate threads.
+
+    M::Integer dimensions[2][3] = { { 150, 300, 9 }, { 160, 400, 141 } };
+
+    for (const M::Integer* d : dimensions) {
+        M::Integer numberRows    = d[0];
+        M::Integer numberTerms   = d[1];
+        M::Integer numberColumns = d[2];
+
+        M::MatrixInteger a(numberRows, numberTerms);
+        M::MatrixInteger b(numberTerms, numberColumns);
+
+        for (M::Integer row=1 ; row<=numberRows ; ++row) {
+            for (M::Integer term=1 ; term<=numberTerms ; ++term) {
+                a.update(row, term, (row * 7 + term * 13) % 19 - 9);
+            }
+        }
+
+        for (M::Integer term=1 ; term<=numberTerms ; ++term) {
+            for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+                b.update(term, column, (term * 5 + column * 11) % 23 - 11);
+            }
+        }
+
+        M::MatrixInteger at = a.transpose();
+        M::MatrixInteger bt = b.transpose();
+
+        M::MatrixInteger product1 = a * b;
+        M::MatrixInteger product2 = M::Integer(3) * (at.transpose() * b);
+        M::MatrixInteger product3 = a * bt.transpose();
+        M::MatrixInteger product4 = (at.transpose() * bt.transpose()) * M::Integer(-2);
+
+        for (M::Integer row=1 ; row<=numberRows ; ++row) {
+            for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+                M::Integer expected = 0;
+                for (M::Integer term=1 ; term<=numberTerms ; ++term) {
+                    expected += a(row, term) * b(term, column);
+                }
+
+                QCOMPARE(product1(row, column), expected);
+                QCOMPARE(product2(row, column), 3 * expected);
+                QCOMPARE(product3(row, column), expected);
+                QCOMPARE(product4(row, column), -2 * expected);
+            }
+        }
+    }
+}
+
+
 void TestMatrixInteger::testIterator() {
     M::MatrixInteger m = M::MatrixInteger::build(
         3, 3,
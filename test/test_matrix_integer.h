@@ -78,6 +78,8 @@ class TestMatrixInteger:public TestMatrixBase {
 
         void testMatrixTypeMethods();
 
+        void testSparseMethods();
+
         void testTranspose();
 
         void testComplexConjugate();
@@ -116,6 +118,10 @@ class TestMatrixInteger:public TestMatrixBase {
 
         void testMultiplicationFunctions();
 
+        void testInPlaceArithmetic();
+
+        void testBlockedMultiplication();
+
         void testIterator();
 
     private:
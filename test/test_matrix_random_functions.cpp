@@ -539,6 +539,48 @@ void TestMatrixRandomFunctions::testMatrixRealRandomGamma() {
 }
 
 
+void TestMatrixRandomFunctions::testMatrixRealRandomGammaMoments() {
+    M::PerThread::RngSeed rngSeed = {
+        0x123456789ABCDEF0ULL,
+        0x132457689BACDFE0ULL,
+        0x10FEDCBA98765432ULL,
+        0x76543210FEDCBA98ULL
+    };
+    M::PerThread pt(1, M::PerThread::RngType::MT19937, rngSeed, Q_NULLPTR);
+
+    // Shapes on either side of 1 exercise both paths through the generator.  The odd row count exercises the column
+    // residue handling.
+
+    const M::Real shapes[] = { 0.25, 3.0 };
+    const M::Real s        = 2.0;
+
+    for (M::Real k : shapes) {
+        M::MatrixReal m = M::MatrixReal::randomGamma(pt, 999, 1001, k, s);
+
+        double sum        = 0;
+        double sumSquared = 0;
+        for (M::Integer columnIndex=1 ; columnIndex<=1001 ; ++columnIndex) {
+            for (M::Integer rowIndex=1 ; rowIndex<=999 ; ++rowIndex) {
+                M::Real v = m(rowIndex, columnIndex);
+                QCOMPARE(v >= 0, true);
+
+                sum        += v;
+                sumSquared += v * v;
+            }
+        }
+
+        double n        = 999.0 * 1001.0;
+        double mean     = sum / n;
+        double variance = sumSquared / n - mean * mean;
+
+        qDebug() << "k = " << k << ", mean = " << mean << ", variance = " << variance;
+
+        QCOMPARE(std::abs(mean - k * s) < 0.02 * k * s, true);
+        QCOMPARE(std::abs(variance - k * s * s) < 0.05 * k * s * s, true);
+    }
+}
+
+
 void TestMatrixRandomFunctions::testMatrixRealRandomRayleight() {
     M::PerThread::RngSeed rngSeed = {
         0x123456789ABCDEF0ULL,
@@ -67,6 +67,8 @@ class TestMatrixRandomFunctions:public TestMatrixBase {
 
         void testMatrixRealRandomGamma();
 
+        void testMatrixRealRandomGammaMoments();
+
         void testMatrixRealRandomRayleight();
 
         void testMatrixRealRandomChiSquared();
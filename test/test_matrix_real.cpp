@@ -29,16 +29,25 @@
 #include <QObject>
 #include <QList>
 #include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include <QFile>
+#include <QByteArray>
 
 #include <limits>
 #include <complex>
 #include <cmath>
 #include <random>
 #include <algorithm>
+#include <string>
+#include <utility>
+#include <type_traits>
 
 #include <model_exceptions.h>
 #include <model_tuple.h>
 #include <m_basic_functions.h>
+#include <m_trigonometric_functions.h>
+#include <m_hyperbolic_functions.h>
+#include <m_matrix_functions.h>
 #include <model_matrix_boolean.h>
 #include <model_matrix_real.h>
 #include <m_intrinsic_types.h>
@@ -49,6 +58,8 @@
 #include <m_tuple.h>
 #include <m_matrix_integer.h>
 #include <m_matrix_complex.h>
+#include <m_iterative_solver.h>
+#include <m_matrix_memory_pool.h>
 
 #include "test_matrix_base.h"
 #include "test_matrix_real.h"
@@ -1177,6 +1188,186 @@ void TestMatrixReal::testMatrixTypeMethods() {
 }
 
 
+void TestMatrixReal::testSparseMethods() {
+    M::MatrixReal s1 = M::MatrixReal::sparse(3, 3);
+    QCOMPARE(s1.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+    QCOMPARE(s1.numberRows(), M::MatrixReal::Index(3));
+    QCOMPARE(s1.numberColumns(), M::MatrixReal::Index(3));
+
+    s1.update(M::Integer(1), M::Integer(1), M::Real(1));
+    s1.update(M::Integer(3), M::Integer(1), M::Real(2));
+    s1.update(M::Integer(2), M::Integer(2), M::Real(3));
+    s1.update(M::Integer(1), M::Integer(3), M::Real(4));
+    s1.update(M::Integer(3), M::Integer(3), M::Real(5));
+
+    QCOMPARE(s1.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+    QCOMPARE(s1(M::Integer(1), M::Integer(1)), M::Real(1));
+    QCOMPARE(s1(M::Integer(2), M::Integer(1)), M::Real(0));
+    QCOMPARE(s1(M::Integer(3), M::Integer(1)), M::Real(2));
+    QCOMPARE(s1(M::Integer(1), M::Integer(3)), M::Real(4));
+    QCOMPARE(s1(M::Integer(2)), M::Real(0));
+    QCOMPARE(s1.isSymmetric(), false);
+
+    // Reading coefficients that are not stored must not insert them into the sparse store.
+    QCOMPARE(s1.numberStoredCoefficients(), 5ULL);
+    QCOMPARE(s1.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+
+    M::MatrixReal d1 = M::MatrixReal::build(
+        3, 3,
+        M::Real(1), M::Real(0), M::Real(2),
+        M::Real(0), M::Real(3), M::Real(0),
+        M::Real(4), M::Real(0), M::Real(5)
+    );
+
+    M::MatrixReal d2 = M::MatrixReal::build(
+        3, 3,
+        M::Real(0), M::Real(7), M::Real(0),
+        M::Real(6), M::Real(0), M::Real(0),
+        M::Real(0), M::Real(0), M::Real(8)
+    );
+
+    M::MatrixReal s2 = d2.toSparse();
+    QCOMPARE(s2.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+
+    QCOMPARE(s1 == d1, true);
+    QCOMPARE(d1 == s1, true);
+    QCOMPARE(s1 == s2, false);
+    QCOMPARE(s1.toDense().matrixType(), M::MatrixReal::MatrixType::DENSE);
+    QCOMPARE(s1.toDense(), d1);
+
+    M::MatrixReal sum = s1 + s2;
+    QCOMPARE(sum.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+    QCOMPARE(sum, d1 + d2);
+
+    M::MatrixReal difference = s1 - d2;
+    QCOMPARE(difference.matrixType(), M::MatrixReal::MatrixType::DENSE);
+    QCOMPARE(difference, d1 - d2);
+    QCOMPARE(d1 - s2, d1 - d2);
+
+    M::MatrixReal product = s1 * s2;
+    QCOMPARE(product.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+    QCOMPARE(product, d1 * d2);
+    QCOMPARE(s1.transpose() * s2, d1.transpose() * d2);
+    QCOMPARE(s1 * d2.transpose(), d1 * d2.transpose());
+    QCOMPARE(d1 * s2, d1 * d2);
+    QCOMPARE(M::Real(2) * s1, M::Real(2) * d1);
+
+    QCOMPARE(s1.hadamard(d2), d1.hadamard(d2));
+    QCOMPARE(d1.hadamard(s2), d1.hadamard(d2));
+    QCOMPARE(s1.kronecker(s2), d1.kronecker(d2));
+    QCOMPARE(d1.kronecker(s2), d1.kronecker(d2));
+
+    QCOMPARE(s1.combineLeftToRight(s2), d1.combineLeftToRight(d2));
+    QCOMPARE(s1.combineTopToBottom(d2), d1.combineTopToBottom(d2));
+    QCOMPARE(s1.columnReverse(), d1.columnReverse());
+    QCOMPARE(s1.rowReverse(), d1.rowReverse());
+
+    QCOMPARE(s1.pNorm(2), d1.pNorm(2));
+    QCOMPARE(s1.oneNorm(), d1.oneNorm());
+    QCOMPARE(s1.infinityNorm(), d1.infinityNorm());
+    QCOMPARE(s1.determinant(), d1.determinant());
+
+    bool caughtException = false;
+    try {
+        M::MatrixReal bad = s1 * M::MatrixReal::sparse(2, 2);
+        (void) bad;
+    } catch (Model::IncompatibleMatrixDimensions&) {
+        caughtException = true;
+    }
+    QCOMPARE(caughtException, true);
+
+    M::MatrixReal s3 = s1;
+    const M::Real* rawData = s3.data();
+    QCOMPARE(s3.matrixType(), M::MatrixReal::MatrixType::DENSE);
+    QCOMPARE(rawData[0], M::Real(1));
+    QCOMPARE(s1.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+}
+
+
+void TestMatrixReal::testAutomaticStorageMethods() {
+    QCOMPARE(M::MatrixReal::zero(10, 10).matrixType(), M::MatrixReal::MatrixType::DENSE);
+    QCOMPARE(M::MatrixReal::zero(100, 100).matrixType(), M::MatrixReal::MatrixType::DENSE);
+
+    M::MatrixReal m1 = M::MatrixReal::sparse(100, 100);
+    QCOMPARE(m1.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+
+    for (M::MatrixReal::Index index=1 ; index<=20 ; ++index) {
+        m1.update(index, index, M::Real(1));
+    }
+
+    QCOMPARE(m1.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+    QCOMPARE(m1(M::Integer(20), M::Integer(20)), M::Real(1));
+    QCOMPARE(m1(M::Integer(20), M::Integer(21)), M::Real(0));
+
+    for (M::MatrixReal::Index column=1 ; column<=26 ; ++column) {
+        for (M::MatrixReal::Index row=1 ; row<=100 ; ++row) {
+            m1.update(row, column, M::Real(1));
+        }
+    }
+
+    QCOMPARE(m1.matrixType(), M::MatrixReal::MatrixType::DENSE);
+    QCOMPARE(m1(M::Integer(100), M::Integer(26)), M::Real(1));
+    QCOMPARE(m1(M::Integer(100), M::Integer(27)), M::Real(0));
+
+    M::MatrixReal d1 = M::MatrixReal::ones(100, 100);
+    M::MatrixReal d2 = M::MatrixReal::identity(100, 100);
+    QCOMPARE(d1.matrixType(), M::MatrixReal::MatrixType::DENSE);
+
+    M::MatrixReal difference = d1 - d1;
+    QCOMPARE(difference.matrixType(), M::MatrixReal::MatrixType::DENSE);
+    QCOMPARE(difference, M::MatrixReal::zero(100, 100));
+
+    difference.update(M::Integer(1), M::Integer(1), d1(M::Integer(1), M::Integer(1)));
+    QCOMPARE(difference.matrixType(), M::MatrixReal::MatrixType::DENSE);
+
+    M::MatrixReal movedDifference = M::MatrixReal::ones(100, 100) - d1;
+    QCOMPARE(movedDifference.matrixType(), difference.matrixType());
+    QCOMPARE(movedDifference, M::MatrixReal::zero(100, 100));
+
+    movedDifference.applyDensityThresholds();
+    QCOMPARE(movedDifference.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+    QCOMPARE(movedDifference, M::MatrixReal::zero(100, 100));
+
+    M::MatrixReal movedFrom = d1 + d2;
+    M::MatrixReal movedTo(std::move(movedFrom));
+    QCOMPARE(movedTo, d1 + d2);
+    QCOMPARE(movedFrom.numberRows(), M::Integer(0));
+    QCOMPARE(movedFrom.numberColumns(), M::Integer(0));
+
+    movedFrom = std::move(movedTo);
+    QCOMPARE(movedFrom, d1 + d2);
+    QCOMPARE(movedTo.numberRows(), M::Integer(0));
+    QCOMPARE(movedTo.numberColumns(), M::Integer(0));
+    QCOMPARE(std::is_nothrow_move_constructible<M::MatrixReal>::value, true);
+    QCOMPARE(std::is_nothrow_move_assignable<M::MatrixReal>::value, true);
+
+    M::MatrixReal product = d1.hadamard(d2);
+    QCOMPARE(product.matrixType(), M::MatrixReal::MatrixType::DENSE);
+    QCOMPARE(product, d2);
+
+    M::MatrixReal sum = d1 + d2;
+    QCOMPARE(sum.matrixType(), M::MatrixReal::MatrixType::DENSE);
+
+    M::Real sparseThreshold = M::MatrixReal::sparseDensityThreshold();
+    M::MatrixReal::setSparseDensityThreshold(0);
+    QCOMPARE(M::MatrixReal::sparseDensityThreshold(), M::Real(0));
+    QCOMPARE(M::MatrixReal::zero(100, 100).matrixType(), M::MatrixReal::MatrixType::DENSE);
+    M::MatrixReal zeros = d1 - d1;
+    zeros.applyDensityThresholds();
+    QCOMPARE(zeros.matrixType(), M::MatrixReal::MatrixType::DENSE);
+    M::MatrixReal::setSparseDensityThreshold(sparseThreshold);
+
+    unsigned long long minimumCoefficients = M::MatrixReal::automaticStorageMinimumCoefficients();
+    M::MatrixReal::setAutomaticStorageMinimumCoefficients(16);
+    M::MatrixReal small = M::MatrixReal::ones(4, 4);
+    M::MatrixReal smallZeros = small - small;
+    QCOMPARE(smallZeros.matrixType(), M::MatrixReal::MatrixType::DENSE);
+    smallZeros.applyDensityThresholds();
+    QCOMPARE(smallZeros.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+    M::MatrixReal::setAutomaticStorageMinimumCoefficients(minimumCoefficients);
+}
+
+
 void TestMatrixReal::testDeterminant1() {
     // We noted a simple test produced an incorrect determinant value (+2 rather than -2).  This test exists to verify
     // that the issue is resolved.
@@ -2303,6 +2494,203 @@ void TestMatrixReal::testSolve() {
 }
 
 
+void TestMatrixReal::testSparseSolve() {
+    std::mt19937                            rng(0x12345678);
+    std::uniform_real_distribution<M::Real> coefficientDistribution(-1, +1);
+    M::Real                                 maximumAllowedAbsoluteError = 1E-10;
+
+    M::Integer gridSize         = 20;
+    M::Integer numberRowColumns = gridSize * gridSize;
+
+    for (unsigned convection=0 ; convection<2 ; ++convection) {
+        // Five point finite difference Laplacian, optionally with a first order convection term making the system
+        // non-symmetric.
+
+        M::MatrixReal a = M::MatrixReal::sparse(numberRowColumns, numberRowColumns);
+        for (M::Integer index=0 ; index<numberRowColumns ; ++index) {
+            M::Integer x = index % gridSize;
+            M::Integer y = index / gridSize;
+
+            a.update(index + 1, index + 1, M::Real(4));
+            if (x > 0) {
+                a.update(index + 1, index, M::Real(-1));
+            }
+
+            if (x + 1 < gridSize) {
+                a.update(index + 1, index + 2, convection ? M::Real(-0.5) : M::Real(-1));
+            }
+
+            if (y > 0) {
+                a.update(index + 1, index + 1 - gridSize, M::Real(-1));
+            }
+
+            if (y + 1 < gridSize) {
+                a.update(index + 1, index + 1 + gridSize, M::Real(-1));
+            }
+        }
+
+        QCOMPARE(a.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+
+        M::MatrixReal y(numberRowColumns, 2);
+        for (M::Integer row=1 ; row<=numberRowColumns ; ++row) {
+            y.update(row, M::Integer(1), coefficientDistribution(rng));
+            y.update(row, M::Integer(2), coefficientDistribution(rng));
+        }
+
+        M::MatrixReal x = a.solve(y);
+        QCOMPARE(x.numberRows(), numberRowColumns);
+        QCOMPARE(x.numberColumns(), M::Integer(2));
+
+        M::MatrixReal yMeasured = a * x;
+        for (M::Integer column=1 ; column<=2 ; ++column) {
+            for (M::Integer row=1 ; row<=numberRowColumns ; ++row) {
+                M::Real absoluteError = M::abs(y(row, column) - yMeasured(row, column));
+                if (absoluteError > maximumAllowedAbsoluteError) {
+                    QCOMPARE(absoluteError <= maximumAllowedAbsoluteError, true);
+                }
+            }
+        }
+
+        QCOMPARE(a.solve(y.toSparse()), x);
+    }
+
+    M::MatrixReal singular = M::MatrixReal::sparse(3, 3);
+    singular.update(M::Integer(1), M::Integer(1), M::Real(1));
+    singular.update(M::Integer(1), M::Integer(2), M::Real(2));
+    singular.update(M::Integer(2), M::Integer(1), M::Real(2));
+    singular.update(M::Integer(2), M::Integer(2), M::Real(4));
+    singular.update(M::Integer(3), M::Integer(3), M::Real(1));
+
+    M::MatrixReal singularResult = singular.solve(M::MatrixReal::ones(3, 1));
+    QCOMPARE(singularResult.numberRows(), M::MatrixReal::Index(0));
+}
+
+void TestMatrixReal::testIterativeSolvers() {
+    std::mt19937                            rng(0x12345678);
+    std::uniform_real_distribution<M::Real> coefficientDistribution(-1, +1);
+
+    M::Integer gridSize         = 16;
+    M::Integer numberRowColumns = gridSize * gridSize;
+
+    M::MatrixReal y(numberRowColumns, 2);
+    for (M::Integer row=1 ; row<=numberRowColumns ; ++row) {
+        y.update(row, M::Integer(1), coefficientDistribution(rng));
+        y.update(row, M::Integer(2), coefficientDistribution(rng));
+    }
+
+    for (unsigned convection=0 ; convection<2 ; ++convection) {
+        M::MatrixReal a = M::MatrixReal::sparse(numberRowColumns, numberRowColumns);
+        for (M::Integer index=0 ; index<numberRowColumns ; ++index) {
+            M::Integer gridX = index % gridSize;
+            M::Integer gridY = index / gridSize;
+
+            a.update(index + 1, index + 1, M::Real(4));
+            if (gridX > 0) {
+                a.update(index + 1, index, M::Real(-1));
+            }
+
+            if (gridX + 1 < gridSize) {
+                a.update(index + 1, index + 2, convection ? M::Real(-0.5) : M::Real(-1));
+            }
+
+            if (gridY > 0) {
+                a.update(index + 1, index + 1 - gridSize, M::Real(-1));
+            }
+
+            if (gridY + 1 < gridSize) {
+                a.update(index + 1, index + 1 + gridSize, M::Real(-1));
+            }
+        }
+
+        M::IterativeSolver::Method methods[] = {
+            M::IterativeSolver::Method::CONJUGATE_GRADIENT,
+            M::IterativeSolver::Method::BICGSTAB,
+            M::IterativeSolver::Method::GMRES
+        };
+
+        M::IterativeSolver::Preconditioner preconditioners[] = {
+            M::IterativeSolver::Preconditioner::NONE,
+            M::IterativeSolver::Preconditioner::JACOBI,
+            M::IterativeSolver::Preconditioner::ILU0,
+            M::IterativeSolver::Preconditioner::INCOMPLETE_CHOLESKY
+        };
+
+        for (M::IterativeSolver::Method method : methods) {
+            if (convection && method == M::IterativeSolver::Method::CONJUGATE_GRADIENT) {
+                continue;
+            }
+
+            M::Integer unpreconditionedIterations = 0;
+            for (M::IterativeSolver::Preconditioner preconditioner : preconditioners) {
+                M::IterativeSolver solver(method, preconditioner, 1.0E-10);
+
+                M::MatrixReal x = solver.solve(a, y);
+                QCOMPARE(solver.converged(), true);
+                QCOMPARE(solver.relativeResidual() <= 1.0E-10, true);
+
+                if (preconditioner == M::IterativeSolver::Preconditioner::NONE) {
+                    unpreconditionedIterations = solver.numberIterations();
+                } else if (preconditioner != M::IterativeSolver::Preconditioner::JACOBI) {
+                    QCOMPARE(solver.numberIterations() < unpreconditionedIterations, true);
+                }
+
+                M::MatrixReal residual = a * x - y;
+                for (M::Integer column=1 ; column<=2 ; ++column) {
+                    M::Real residualNorm = 0;
+                    M::Real yNorm        = 0;
+                    for (M::Integer row=1 ; row<=numberRowColumns ; ++row) {
+                        residualNorm += residual(row, column) * residual(row, column);
+                        yNorm        += y(row, column) * y(row, column);
+                    }
+
+                    QCOMPARE(std::sqrt(residualNorm / yNorm) <= 1.0E-9, true);
+                }
+
+                M::MatrixReal denseX = solver.solve(a.toDense(), y);
+                QCOMPARE(solver.converged(), true);
+
+                M::MatrixReal difference = denseX - x;
+                for (M::Integer column=1 ; column<=2 ; ++column) {
+                    for (M::Integer row=1 ; row<=numberRowColumns ; ++row) {
+                        QCOMPARE(M::abs(difference(row, column)) <= 1.0E-12, true);
+                    }
+                }
+
+                // Warm starting from the previous solution should need no further iterations.
+
+                solver.solve(a, y, x);
+                QCOMPARE(solver.converged(), true);
+                QCOMPARE(solver.numberIterations(), 0UL);
+            }
+        }
+    }
+
+    M::IterativeSolver solver;
+
+    bool caughtException = false;
+    try {
+        solver.solve(M::MatrixReal(3, 4), M::MatrixReal(3, 1));
+    } catch (Model::InvalidMatrixDimensions&) {
+        caughtException = true;
+    }
+
+    QCOMPARE(caughtException, true);
+
+    caughtException = false;
+    try {
+        solver.solve(M::MatrixReal::identity(3), M::MatrixReal(3, 1), M::MatrixReal(2, 1));
+    } catch (Model::IncompatibleMatrixDimensions&) {
+        caughtException = true;
+    }
+
+    QCOMPARE(caughtException, true);
+
+    M::MatrixReal zeroResult = solver.solve(M::MatrixReal::identity(3), M::MatrixReal(3, 1));
+    QCOMPARE(zeroResult, M::MatrixReal(3, 1));
+    QCOMPARE(solver.converged(), true);
+}
+
+
 void TestMatrixReal::testLeastSquares() {
     std::mt19937                                rng(0x12345678);
     std::uniform_int_distribution<>             dimensionDistribution(1, 100);
@@ -3812,6 +4200,796 @@ void TestMatrixReal::testMultiplicationFunctions() {
 }
 
 
+void TestMatrixReal::testFusedArithmetic() {
+    std::mt19937                            rng(0x5EED1234);
+    std::uniform_real_distribution<M::Real> coefficientDistribution(-1, +1);
+
+    M::Integer numberRows    = 37;
+    M::Integer numberColumns = 23;
+    M::Integer innerSize     = 19;
+
+    M::MatrixReal a(numberRows, innerSize);
+    M::MatrixReal b(innerSize, numberColumns);
+    M::MatrixReal bt(numberColumns, innerSize);
+    M::MatrixReal c(numberRows, numberColumns);
+    M::MatrixReal ct(numberColumns, numberRows);
+    M::MatrixReal d(numberRows, numberColumns);
+
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=innerSize ; ++column) {
+            a.update(row, column, coefficientDistribution(rng));
+        }
+
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            c.update(row, column, coefficientDistribution(rng));
+            ct.update(column, row, coefficientDistribution(rng));
+            d.update(row, column, coefficientDistribution(rng));
+        }
+    }
+
+    for (M::Integer row=1 ; row<=innerSize ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            b.update(row, column, coefficientDistribution(rng));
+            bt.update(column, row, coefficientDistribution(rng));
+        }
+    }
+
+    M::MatrixReal sparseD = M::MatrixReal::sparse(numberRows, numberColumns);
+    for (M::Integer index=1 ; index<=numberColumns ; ++index) {
+        sparseD.update(index, index, M::Real(index));
+    }
+
+    // Each fused expression is compared against the same calculation performed using only named intermediate
+    // values, which forces every step to be calculated out of place.
+
+    M::MatrixReal product       = a * b;
+    M::MatrixReal scaledC       = M::Real(0.5) * c;
+    M::MatrixReal expected1     = product + c;
+    M::MatrixReal expected2     = product - scaledC;
+    M::MatrixReal scaledA       = M::Real(2) * a;
+    M::MatrixReal productT      = scaledA * bt.transpose();
+    M::MatrixReal expected3     = productT + ct.transpose();
+    M::MatrixReal sumCD         = scaledC + d;
+    M::MatrixReal scaledD       = M::Real(3) * d;
+    M::MatrixReal expected4     = sumCD - scaledD;
+    M::MatrixReal expected5     = expected4 + sparseD;
+    M::MatrixReal scaledProduct = M::Real(1.5) * product;
+    M::MatrixReal scaledSum     = M::Real(-2) * c;
+    M::MatrixReal expected6     = scaledProduct + scaledSum;
+    M::MatrixReal expected7     = productT - product;
+
+    M::MatrixReal fused1 = a * b + c;
+    M::MatrixReal fused2 = a * b - M::Real(0.5) * c;
+    M::MatrixReal fused3 = (M::Real(2) * a) * bt.transpose() + ct.transpose();
+    M::MatrixReal fused4 = M::Real(0.5) * c + d - M::Real(3) * d;
+    M::MatrixReal fused5 = M::Real(0.5) * c + d - M::Real(3) * d + sparseD;
+
+    // Shared destinations fall back to calculating the result out of place.
+
+    M::MatrixReal fused6 = c;
+    fused6.multiplyAccumulate(M::Real(1.5) * a, b, M::Real(-2));
+
+    M::MatrixReal fused7 = c * M::Real(-2);
+    fused7.multiplyAccumulate(a, b * M::Real(1.5));
+
+    // Unshared dense destinations are updated in place.
+
+    M::MatrixReal fused8 = a * b;
+    fused8.multiplyAccumulate(scaledA, bt.transpose(), M::Real(-1));
+
+    M::MatrixReal fused9 = a * b;
+    fused9 += c;
+
+    M::MatrixReal* expected[] = {
+        &expected1, &expected2, &expected3, &expected4, &expected5, &expected6, &expected6, &expected7, &expected1
+    };
+
+    M::MatrixReal* fused[] = { &fused1, &fused2, &fused3, &fused4, &fused5, &fused6, &fused7, &fused8, &fused9 };
+
+    for (unsigned i=0 ; i<9 ; ++i) {
+        QCOMPARE(fused[i]->numberRows(), numberRows);
+        QCOMPARE(fused[i]->numberColumns(), numberColumns);
+
+        for (M::Integer row=1 ; row<=numberRows ; ++row) {
+            for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+                M::Real difference = (*fused[i])(row, column) - (*expected[i])(row, column);
+                QCOMPARE(M::abs(difference) <= 1.0E-12, true);
+            }
+        }
+    }
+
+    // In-place accumulation must not disturb matrices sharing the original data.
+
+    M::MatrixReal shared = c;
+    M::MatrixReal alias  = shared;
+    shared += d;
+    shared.multiplyAccumulate(a, b);
+    QCOMPARE(alias == c, true);
+
+    // Self accumulation must use the original values for both operands.
+
+    M::MatrixReal self    = a * b;
+    M::MatrixReal doubled = M::Real(2) * product;
+    self += self;
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            QCOMPARE(M::abs(self(row, column) - doubled(row, column)) <= 1.0E-15, true);
+        }
+    }
+
+    bool caughtException = false;
+    try {
+        M::MatrixReal wrongSize(numberRows + 1, numberColumns);
+        wrongSize.multiplyAccumulate(a, b);
+    } catch (Model::IncompatibleMatrixDimensions&) {
+        caughtException = true;
+    }
+
+    QCOMPARE(caughtException, true);
+}
+
+
+void TestMatrixReal::testSmallMatrixKernels() {
+    // The leading zero forces a row exchange in the LU decomposition for every matrix size.
+
+    static const M::Real values[4][4] = {
+        { 0, 2, 1, 3 },
+        { 4, 1, 0, 2 },
+        { 1, 3, 5, 0 },
+        { 2, 0, 1, 4 }
+    };
+
+    static const M::Real determinants[4] = { 0, -8, -29, -155 };
+
+    for (M::Integer n=1 ; n<=4 ; ++n) {
+        M::MatrixReal a(n, n);
+        M::MatrixReal b(n, 4);
+
+        for (M::Integer row=1 ; row<=n ; ++row) {
+            for (M::Integer column=1 ; column<=n ; ++column) {
+                a.update(row, column, values[row - 1][column - 1]);
+            }
+
+            for (M::Integer column=1 ; column<=4 ; ++column) {
+                b.update(row, column, M::Real(row * column - 3));
+            }
+        }
+
+        QCOMPARE(M::abs(a.determinant() - determinants[n - 1]) <= 1.0E-12, true);
+
+        M::MatrixReal product  = a * b;
+        M::MatrixReal productT = a.transpose() * b;
+        M::MatrixReal sum      = a + M::Real(2) * a.transpose();
+
+        for (M::Integer row=1 ; row<=n ; ++row) {
+            for (M::Integer column=1 ; column<=4 ; ++column) {
+                M::Real expected  = 0;
+                M::Real expectedT = 0;
+                for (M::Integer k=1 ; k<=n ; ++k) {
+                    expected  += values[row - 1][k - 1] * b(k, column);
+                    expectedT += values[k - 1][row - 1] * b(k, column);
+                }
+
+                QCOMPARE(product(row, column), expected);
+                QCOMPARE(productT(row, column), expectedT);
+            }
+
+            for (M::Integer column=1 ; column<=n ; ++column) {
+                QCOMPARE(sum(row, column), values[row - 1][column - 1] + 2 * values[column - 1][row - 1]);
+            }
+        }
+
+        if (n == 1) {
+            bool caughtException = false;
+            try {
+                M::MatrixReal inverse = a.inverse();
+                (void) inverse;
+            } catch (Model::MatrixIsSingular&) {
+                caughtException = true;
+            }
+
+            QCOMPARE(caughtException, true);
+        } else {
+            M::MatrixReal inverse = a.inverse();
+            M::MatrixReal x       = a.solve(b);
+
+            for (M::Integer row=1 ; row<=n ; ++row) {
+                for (M::Integer column=1 ; column<=n ; ++column) {
+                    M::Real identity = 0;
+                    for (M::Integer k=1 ; k<=n ; ++k) {
+                        identity += values[row - 1][k - 1] * inverse(k, column);
+                    }
+
+                    QCOMPARE(M::abs(identity - (row == column ? 1 : 0)) <= 1.0E-12, true);
+                }
+
+                for (M::Integer column=1 ; column<=4 ; ++column) {
+                    M::Real residual = -b(row, column);
+                    for (M::Integer k=1 ; k<=n ; ++k) {
+                        residual += values[row - 1][k - 1] * x(k, column);
+                    }
+
+                    QCOMPARE(M::abs(residual) <= 1.0E-12, true);
+                }
+            }
+        }
+    }
+}
+
+
+void TestMatrixReal::testSmallMatrixStorage() {
+    M::MatrixReal a(M::Integer(2), M::Integer(3));
+    for (M::Integer row=1 ; row<=2 ; ++row) {
+        for (M::Integer column=1 ; column<=3 ; ++column) {
+            a.update(row, column, M::Real(10 * row + column));
+        }
+    }
+
+    M::MatrixReal copy = a;
+    copy.update(M::Integer(1), M::Integer(1), M::Real(-1));
+    QCOMPARE(a(M::Integer(1), M::Integer(1)), M::Real(11));
+    QCOMPARE(copy(M::Integer(1), M::Integer(1)), M::Real(-1));
+
+    M::MatrixReal moved = std::move(copy);
+    QCOMPARE(copy.numberRows(), M::Integer(0));
+    QCOMPARE(copy.numberColumns(), M::Integer(0));
+    QCOMPARE(moved(M::Integer(1), M::Integer(1)), M::Real(-1));
+    QCOMPARE(moved(M::Integer(2), M::Integer(3)), M::Real(23));
+
+    M::MatrixReal scaledTranspose = M::Real(3) * a.transpose();
+    QCOMPARE(scaledTranspose.numberRows(), M::Integer(3));
+    QCOMPARE(scaledTranspose.numberColumns(), M::Integer(2));
+    QCOMPARE(scaledTranspose(M::Integer(3), M::Integer(1)), M::Real(39));
+    QCOMPARE(scaledTranspose(M::Integer(1), M::Integer(2)), M::Real(63));
+
+    M::MatrixReal resized = a;
+    resized.resize(M::Integer(4), M::Integer(4));
+    QCOMPARE(resized(M::Integer(2), M::Integer(3)), M::Real(23));
+    QCOMPARE(resized(M::Integer(4), M::Integer(4)), M::Real(0));
+
+    // Growing past the inline limit must move the coefficients into a data store without losing them.
+
+    M::MatrixReal grown = a;
+    grown.update(M::Integer(5), M::Integer(6), M::Real(56));
+    QCOMPARE(grown.numberRows(), M::Integer(5));
+    QCOMPARE(grown.numberColumns(), M::Integer(6));
+    QCOMPARE(grown(M::Integer(1), M::Integer(2)), M::Real(12));
+    QCOMPARE(grown(M::Integer(2), M::Integer(3)), M::Real(23));
+    QCOMPARE(grown(M::Integer(4), M::Integer(4)), M::Real(0));
+    QCOMPARE(grown(M::Integer(5), M::Integer(6)), M::Real(56));
+    QCOMPARE(a.numberRows(), M::Integer(2));
+
+    M::MatrixReal sum = a + M::MatrixReal::ones(M::Integer(2), M::Integer(3));
+    QCOMPARE(sum(M::Integer(2), M::Integer(1)), M::Real(22));
+    QCOMPARE(sum == a, false);
+    QCOMPARE(sum - M::MatrixReal::ones(M::Integer(2), M::Integer(3)) == a, true);
+
+    const M::Real* data = a.data();
+    QCOMPARE(data[0], M::Real(11));
+    QCOMPARE(data[1], M::Real(21));
+    QCOMPARE(a.columnData(M::Integer(3))[1], M::Real(23));
+}
+
+
+void TestMatrixReal::testElementwiseFunctions() {
+    M::Integer numberRows    = 13;
+    M::Integer numberColumns = 7;
+
+    // Values in m span negative, zero, and positive values.  Values in p lie strictly between 0 and 1.
+
+    M::MatrixReal m(numberRows, numberColumns);
+    M::MatrixReal p(numberRows, numberColumns);
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            m.update(row, column, M::Real(row * numberColumns + column - 40) / M::Real(16));
+            p.update(row, column, M::Real(row + numberRows * (column - 1)) / M::Real(numberRows * numberColumns + 1));
+        }
+    }
+
+    auto close = [](M::Real measured, M::Real expected) {
+        return    measured == expected
+               || M::abs(measured - expected) <= 1.0E-12 * std::max(M::Real(1), M::abs(expected));
+    };
+
+    M::MatrixReal scaled = M::Real(2) * m.transpose();
+
+    M::MatrixReal expM       = M::exp(m);
+    M::MatrixReal sineM      = M::sine(scaled);
+    M::MatrixReal cosineM    = M::cosine(m);
+    M::MatrixReal tangentM   = M::tangent(m);
+    M::MatrixReal arcsineP   = M::arcsine(p);
+    M::MatrixReal arccosineP = M::arccosine(p);
+    M::MatrixReal arctanM    = M::arctangent(m);
+    M::MatrixReal sinhM      = M::hyperbolicSine(m);
+    M::MatrixReal coshM      = M::hyperbolicCosine(m);
+    M::MatrixReal tanhM      = M::hyperbolicTangent(m);
+    M::MatrixReal erfM       = M::erf(m);
+    M::MatrixReal erfcM      = M::erfc(m);
+    M::MatrixReal gammaP     = M::gamma(p);
+    M::MatrixReal lnGammaP   = M::lnGamma(p);
+
+    M::MatrixComplex lnM   = M::ln(m);
+    M::MatrixComplex sqrtM = M::sqrt(m);
+    M::MatrixComplex powM  = M::pow(m, M::Real(2.5));
+
+    QCOMPARE(sineM.numberRows(), numberColumns);
+    QCOMPARE(sineM.numberColumns(), numberRows);
+
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            M::Real mv = m(row, column);
+            M::Real pv = p(row, column);
+
+            QCOMPARE(close(expM(row, column), std::exp(mv)), true);
+            QCOMPARE(close(sineM(column, row), M::sine(M::Real(2) * mv)), true);
+            QCOMPARE(close(cosineM(row, column), M::cosine(mv)), true);
+            QCOMPARE(close(tangentM(row, column), M::tangent(mv)), true);
+            QCOMPARE(close(arcsineP(row, column), M::arcsine(pv)), true);
+            QCOMPARE(close(arccosineP(row, column), M::arccosine(pv)), true);
+            QCOMPARE(close(arctanM(row, column), M::arctangent(mv)), true);
+            QCOMPARE(close(sinhM(row, column), M::hyperbolicSine(mv)), true);
+            QCOMPARE(close(coshM(row, column), M::hyperbolicCosine(mv)), true);
+            QCOMPARE(close(tanhM(row, column), M::hyperbolicTangent(mv)), true);
+            QCOMPARE(close(erfM(row, column), M::erf(mv)), true);
+            QCOMPARE(close(erfcM(row, column), M::erfc(mv)), true);
+            QCOMPARE(close(gammaP(row, column), M::gamma(pv)), true);
+            QCOMPARE(close(lnGammaP(row, column), M::lnGamma(pv)), true);
+
+            M::Complex lnExpected   = M::ln(mv);
+            M::Complex sqrtExpected = M::sqrt(mv);
+            M::Complex powExpected  = M::pow(mv, M::Real(2.5));
+
+            QCOMPARE(close(lnM(row, column).real(), lnExpected.real()), true);
+            QCOMPARE(close(lnM(row, column).imag(), lnExpected.imag()), true);
+            QCOMPARE(close(sqrtM(row, column).real(), sqrtExpected.real()), true);
+            QCOMPARE(close(sqrtM(row, column).imag(), sqrtExpected.imag()), true);
+            QCOMPARE(powM(row, column), powExpected);
+        }
+    }
+
+    M::MatrixReal sparse = M::MatrixReal::sparse(numberRows, numberColumns);
+    sparse.update(M::Integer(2), M::Integer(3), M::Real(-4));
+
+    M::MatrixReal    cosineSparse = M::cosine(sparse);
+    M::MatrixComplex sqrtSparse   = M::sqrt(sparse);
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            M::Real v = sparse(row, column);
+            QCOMPARE(close(cosineSparse(row, column), M::cosine(v)), true);
+            QCOMPARE(sqrtSparse(row, column), M::sqrt(v));
+        }
+    }
+}
+
+
+void TestMatrixReal::testStridedSlicing() {
+    M::Integer numberRows    = 37;
+    M::Integer numberColumns = 29;
+
+    M::MatrixReal m(numberRows, numberColumns);
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            m.update(row, column, M::Real(1000 * row + column));
+        }
+    }
+
+    struct Slice {
+        M::Integer rowFirst;
+        M::Integer rowSecond;
+        M::Integer rowLast;
+        M::Integer columnFirst;
+        M::Integer columnSecond;
+        M::Integer columnLast;
+    };
+
+    // Covers column blocks, strided rows and columns, descending ranges, and single rows and columns.
+
+    const Slice slices[] = {
+        {  1,  2, 37,  5,  6, 12 },
+        {  3,  4, 20,  1,  2, 29 },
+        {  2,  5, 35,  4,  7, 28 },
+        { 37, 36,  1, 29, 27,  1 },
+        { 17, 18, 17,  9, 10,  9 },
+        {  1,  3, 37, 11, 12, 11 }
+    };
+
+    for (const Slice& slice : slices) {
+        M::Range rowRange(slice.rowFirst, slice.rowSecond, slice.rowLast);
+        M::Range columnRange(slice.columnFirst, slice.columnSecond, slice.columnLast);
+
+        M::MatrixReal s = m.at(rowRange, columnRange);
+
+        M::Integer rowStep    = slice.rowFirst == slice.rowLast ? 1 : slice.rowSecond - slice.rowFirst;
+        M::Integer columnStep = slice.columnFirst == slice.columnLast ? 1 : slice.columnSecond - slice.columnFirst;
+
+        QCOMPARE(s.numberRows(), rowRange.size());
+        QCOMPARE(s.numberColumns(), columnRange.size());
+
+        for (M::Integer row=1 ; row<=s.numberRows() ; ++row) {
+            for (M::Integer column=1 ; column<=s.numberColumns() ; ++column) {
+                M::Integer sourceRow    = slice.rowFirst + rowStep * (row - 1);
+                M::Integer sourceColumn = slice.columnFirst + columnStep * (column - 1);
+                QCOMPARE(s(row, column), m(sourceRow, sourceColumn));
+            }
+        }
+    }
+
+    // Selecting the entire matrix shares the data store.  Updates must not be visible in the source.
+
+    M::MatrixReal all = m.at(
+        M::Range(M::Integer(1), numberRows),
+        M::Range(M::Integer(1), numberColumns)
+    );
+    QCOMPARE(all, m);
+
+    all.update(M::Integer(1), M::Integer(1), M::Real(-1));
+    QCOMPARE(all(M::Integer(1), M::Integer(1)), M::Real(-1));
+    QCOMPARE(m(M::Integer(1), M::Integer(1)), M::Real(1001));
+
+    // Pending transforms must be honored.
+
+    M::MatrixReal transposed = M::Real(2) * m.transpose();
+    M::MatrixReal t          = transposed.at(
+        M::Range(M::Integer(3), M::Integer(7)),
+        M::Range(M::Integer(10), M::Integer(12), M::Integer(30))
+    );
+
+    QCOMPARE(t.numberRows(), M::Integer(5));
+    QCOMPARE(t.numberColumns(), M::Integer(11));
+    for (M::Integer row=1 ; row<=t.numberRows() ; ++row) {
+        for (M::Integer column=1 ; column<=t.numberColumns() ; ++column) {
+            QCOMPARE(t(row, column), M::Real(2) * m(10 + 2 * (column - 1), row + 2));
+        }
+    }
+
+    // Sparse matrices and ranges that leave the matrix use the general path.
+
+    M::MatrixReal sparse = M::MatrixReal::sparse(numberRows, numberColumns);
+    sparse.update(M::Integer(4), M::Integer(6), M::Real(3));
+
+    M::MatrixReal sparseSlice = sparse.at(
+        M::Range(M::Integer(2), M::Integer(4), M::Integer(6)),
+        M::Range(M::Integer(6), M::Integer(7))
+    );
+    QCOMPARE(sparseSlice.numberRows(), M::Integer(3));
+    QCOMPARE(sparseSlice.numberColumns(), M::Integer(2));
+    QCOMPARE(sparseSlice(M::Integer(2), M::Integer(1)), M::Real(3));
+    QCOMPARE(sparseSlice(M::Integer(1), M::Integer(1)), M::Real(0));
+
+    bool exceptionThrown = false;
+    try {
+        m.at(M::Range(M::Integer(30), M::Integer(38)), M::Range(M::Integer(1), M::Integer(2)));
+    } catch (Model::InvalidRow&) {
+        exceptionThrown = true;
+    }
+
+    QCOMPARE(exceptionThrown, true);
+}
+
+
+void TestMatrixReal::testSubmatrixViews() {
+    M::Integer numberRows    = 12;
+    M::Integer numberColumns = 10;
+
+    M::MatrixReal m(numberRows, numberColumns);
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            m.update(row, column, M::Real(100 * row + column));
+        }
+    }
+
+    // Slices of slices compose their offsets and strides against the original coefficients.
+
+    M::MatrixReal view = m.at(
+        M::Range(M::Integer(2), M::Integer(4), M::Integer(12)),
+        M::Range(M::Integer(1), numberColumns)
+    );
+    QCOMPARE(view.numberRows(), M::Integer(6));
+    QCOMPARE(view.numberColumns(), M::Integer(10));
+    QCOMPARE(view(M::Integer(3), M::Integer(5)), M::Real(605));
+    QCOMPARE(view(M::Integer(13)), M::Real(403));
+
+    M::MatrixReal nested = view.at(
+        M::Range(M::Integer(6), M::Integer(5), M::Integer(1)),
+        M::Range(M::Integer(2), M::Integer(4), M::Integer(10))
+    );
+    QCOMPARE(nested.numberRows(), M::Integer(6));
+    QCOMPARE(nested.numberColumns(), M::Integer(5));
+    for (M::Integer row=1 ; row<=nested.numberRows() ; ++row) {
+        for (M::Integer column=1 ; column<=nested.numberColumns() ; ++column) {
+            QCOMPARE(nested(row, column), m(14 - 2 * row, 2 * column));
+        }
+    }
+
+    M::MatrixReal column = view.at(M::Range(M::Integer(1), M::Integer(6)), M::Integer(7));
+    QCOMPARE(column.numberRows(), M::Integer(6));
+    QCOMPARE(column.numberColumns(), M::Integer(1));
+    QCOMPARE(column(M::Integer(4), M::Integer(1)), M::Real(807));
+
+    M::MatrixReal row = m.at(M::Integer(5), M::Range(M::Integer(1), M::Integer(3), M::Integer(9)));
+    QCOMPARE(row.numberRows(), M::Integer(1));
+    QCOMPARE(row.numberColumns(), M::Integer(5));
+    QCOMPARE(row(M::Integer(1), M::Integer(5)), M::Real(509));
+
+    M::MatrixReal small = nested.at(
+        M::Range(M::Integer(1), M::Integer(2)),
+        M::Range(M::Integer(1), M::Integer(2))
+    );
+    QCOMPARE(small(M::Integer(1), M::Integer(1)), M::Real(1202));
+    QCOMPARE(small(M::Integer(2), M::Integer(2)), M::Real(1004));
+
+    M::MatrixReal transposed = view.transpose();
+    QCOMPARE(transposed.numberRows(), M::Integer(10));
+    QCOMPARE(transposed.numberColumns(), M::Integer(6));
+    QCOMPARE(transposed(M::Integer(10), M::Integer(6)), M::Real(1210));
+
+    // Writes copy the view out of the source.  Writes to the source leave existing views unchanged.
+
+    M::MatrixReal copy = nested;
+    nested.update(M::Integer(1), M::Integer(1), M::Real(-1));
+    QCOMPARE(nested(M::Integer(1), M::Integer(1)), M::Real(-1));
+    QCOMPARE(nested(M::Integer(2), M::Integer(2)), M::Real(1004));
+    QCOMPARE(copy(M::Integer(1), M::Integer(1)), M::Real(1202));
+    QCOMPARE(m(M::Integer(12), M::Integer(2)), M::Real(1202));
+
+    m.update(M::Integer(10), M::Integer(4), M::Real(-2));
+    QCOMPARE(m(M::Integer(10), M::Integer(4)), M::Real(-2));
+    QCOMPARE(copy(M::Integer(2), M::Integer(2)), M::Real(1004));
+    QCOMPARE(view(M::Integer(5), M::Integer(4)), M::Real(1004));
+
+    M::Real* data = view.data();
+    data[0] = M::Real(-3);
+    QCOMPARE(view(M::Integer(1), M::Integer(1)), M::Real(-3));
+    QCOMPARE(column(M::Integer(1), M::Integer(1)), M::Real(207));
+    QCOMPARE(m(M::Integer(2), M::Integer(1)), M::Real(201));
+
+    // Views take part in arithmetic like any other matrix.
+
+    M::MatrixReal doubled = M::Real(2) * row;
+    QCOMPARE(doubled(M::Integer(1), M::Integer(2)), M::Real(1006));
+    QCOMPARE(row + row, doubled);
+}
+
+
+void TestMatrixReal::testColumnSpans() {
+    M::Integer numberRows    = 13;
+    M::Integer numberColumns = 6;
+
+    M::MatrixReal m(numberRows, numberColumns);
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            m.update(row, column, M::Real(100 * row + column));
+        }
+    }
+
+    unsigned long long columnSpacing = m.columnSpacingInMemory();
+    QVERIFY(columnSpacing >= static_cast<unsigned long long>(numberRows));
+
+    for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+        const M::Real* columnData = m.columnData(column);
+        QCOMPARE(columnData, m.data() + columnSpacing * (column - 1));
+
+        for (M::Integer row=1 ; row<=numberRows ; ++row) {
+            QCOMPARE(columnData[row - 1], m(row, column));
+        }
+    }
+
+    M::Integer visited = 0;
+    bool       inOrder = true;
+    m.forEach([&](M::Real coefficient) {
+        M::Integer row    = 1 + visited % numberRows;
+        M::Integer column = 1 + visited / numberRows;
+
+        inOrder = inOrder && coefficient == M::Real(100 * row + column);
+        ++visited;
+    });
+
+    QCOMPARE(visited, numberRows * numberColumns);
+    QCOMPARE(inOrder, true);
+
+    // Writes through the span API must not be visible in matrices sharing the same data store.
+
+    M::MatrixReal copy = m;
+    copy.transform([](M::Real coefficient) {
+        return -coefficient;
+    });
+
+    copy.columnData(M::Integer(2))[0] = M::Real(7);
+
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            M::Real expected = (row == 1 && column == 2) ? M::Real(7) : -M::Real(100 * row + column);
+
+            QCOMPARE(copy(row, column), expected);
+            QCOMPARE(m(row, column), M::Real(100 * row + column));
+        }
+    }
+
+    // Pending transforms must be applied.
+
+    M::MatrixReal t       = M::Real(2) * m.transpose();
+    M::Real       sum     = 0;
+    M::Integer    entries = 0;
+    t.forEach([&](M::Real coefficient) {
+        sum += coefficient;
+        ++entries;
+    });
+
+    M::Real expectedSum = 0;
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            expectedSum += M::Real(2 * (100 * row + column));
+        }
+    }
+
+    QCOMPARE(entries, numberRows * numberColumns);
+    QCOMPARE(sum, expectedSum);
+    QCOMPARE(t.columnData(M::Integer(3))[1], M::Real(2) * m(M::Integer(3), M::Integer(2)));
+
+    // Sparse matrices are visited without conversion.
+
+    M::MatrixReal sparse = M::MatrixReal::sparse(numberRows, numberColumns);
+    sparse.update(M::Integer(4), M::Integer(5), M::Real(3));
+
+    M::Real sparseSum = 0;
+    sparse.forEach([&](M::Real coefficient) {
+        sparseSum += coefficient;
+    });
+
+    QCOMPARE(sparseSum, M::Real(3));
+    QCOMPARE(sparse.matrixType(), M::MatrixReal::MatrixType::SPARSE);
+
+    bool exceptionThrown = false;
+    try {
+        m.columnData(numberColumns + 1);
+    } catch (Model::InvalidColumn&) {
+        exceptionThrown = true;
+    }
+
+    QCOMPARE(exceptionThrown, true);
+}
+
+
+void TestMatrixReal::testBinaryFileFormat() {
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    static const unsigned   numberCases                 = 3;
+    static const M::Integer rowCounts[numberCases]      = { 1, 13, 37 };
+    static const M::Integer columnCounts[numberCases]   = { 5,  1, 23 };
+
+    for (unsigned i=0 ; i<numberCases ; ++i) {
+        M::Integer numberRows    = rowCounts[i];
+        M::Integer numberColumns = columnCounts[i];
+
+        M::MatrixReal m(numberRows, numberColumns);
+        for (M::Integer row=1 ; row<=numberRows ; ++row) {
+            for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+                m.update(row, column, M::Real(31 * row) + M::Real(0.25) * column);
+            }
+        }
+
+        QByteArray filename = directory.filePath(QString("matrix_%1.bin").arg(i)).toLocal8Bit();
+        QCOMPARE(m.toFile(filename.constData(), Model::DataFileFormat::BINARY), true);
+
+        // Header plus the padded column major image written in a single block.
+
+        QFile file(QString::fromLocal8Bit(filename));
+        QVERIFY(file.open(QIODevice::ReadOnly));
+        QByteArray header = file.read(8);
+        QCOMPARE(header.left(6), QByteArray("INEBIN"));
+        QCOMPARE(int(header.at(6)), 2);
+        QCOMPARE(header.at(7), 'R');
+        QCOMPARE(
+            static_cast<unsigned long long>(file.size()),
+            64ULL + m.columnSpacingInMemory() * numberColumns * sizeof(M::Real)
+        );
+        file.close();
+
+        M::MatrixReal loaded = M::MatrixReal::fromFile(filename.constData());
+        QCOMPARE(loaded, m);
+
+        // Updates to a loaded matrix must never reach the file.
+
+        loaded.update(M::Integer(1), M::Integer(1), M::Real(-1));
+        QCOMPARE(loaded(M::Integer(1), M::Integer(1)), M::Real(-1));
+
+        M::MatrixReal reloaded = M::MatrixReal::fromFile(filename.constData());
+        QCOMPARE(reloaded, m);
+
+        // A loaded matrix may be saved over the file backing it.  Other matrices loaded from the same file must keep
+        // their values.
+
+        QCOMPARE(loaded.toFile(filename.constData(), Model::DataFileFormat::BINARY), true);
+        QCOMPARE(loaded(M::Integer(1), M::Integer(1)), M::Real(-1));
+        QCOMPARE(reloaded, m);
+        QCOMPARE(M::MatrixReal::fromFile(filename.constData()), loaded);
+
+        QCOMPARE(reloaded.toFile(filename.constData(), Model::DataFileFormat::CSV), true);
+        QCOMPARE(M::MatrixReal::fromFile(filename.constData()), m);
+    }
+
+    // Pending transforms must be applied before the matrix is written.
+
+    M::MatrixReal m = M::MatrixReal::build(
+        2, 3,
+        M::Real(1), M::Real(2),
+        M::Real(3), M::Real(4),
+        M::Real(5), M::Real(6)
+    );
+
+    M::MatrixReal t        = M::Real(2) * m.transpose();
+    QByteArray    filename = directory.filePath("transposed.bin").toLocal8Bit();
+    QCOMPARE(t.toFile(filename.constData(), Model::DataFileFormat::BINARY), true);
+
+    M::MatrixReal loaded = M::MatrixReal::fromFile(filename.constData());
+    QCOMPARE(loaded.numberRows(), M::MatrixReal::Index(3));
+    QCOMPARE(loaded.numberColumns(), M::MatrixReal::Index(2));
+    QCOMPARE(loaded, M::Real(2) * m.transpose());
+}
+
+
+void TestMatrixReal::testCsvFileFormat() {
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    // Values must survive a round trip exactly.
+
+    M::Integer    numberRows    = 29;
+    M::Integer    numberColumns = 11;
+    M::MatrixReal m(numberRows, numberColumns);
+
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            M::Real value = M::Real(row - 15) / M::Real(3 * column) + std::pow(M::Real(10), M::Real(row - 15) * 20);
+            m.update(row, column, value);
+        }
+    }
+
+    QByteArray filename = directory.filePath("matrix.csv").toLocal8Bit();
+    QCOMPARE(m.toFile(filename.constData(), Model::DataFileFormat::CSV), true);
+
+    M::MatrixReal loaded = M::MatrixReal::fromFile(filename.constData());
+    QCOMPARE(loaded.numberRows(), M::MatrixReal::Index(numberRows));
+    QCOMPARE(loaded.numberColumns(), M::MatrixReal::Index(numberColumns));
+    QCOMPARE(loaded, m);
+
+    // Ragged rows, mixed separators, DOS line endings, trailing separators and a missing final newline.
+
+    QByteArray handWrittenFilename = directory.filePath("hand_written.csv").toLocal8Bit();
+    QFile      file(QString::fromLocal8Bit(handWrittenFilename));
+
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write("1,2.5;3\r\n");
+    file.write("\n");
+    file.write("-4e2\t5|\n");
+    file.write("6:7 8 9");
+    file.close();
+
+    M::MatrixReal expected = M::MatrixReal::build(
+        4, 4,
+        M::Real(   1), M::Real(2.5), M::Real(3), M::Real(0),
+        M::Real(   0), M::Real(  0), M::Real(0), M::Real(0),
+        M::Real(-400), M::Real(  5), M::Real(0), M::Real(0),
+        M::Real(   6), M::Real(  7), M::Real(8), M::Real(9)
+    );
+
+    QCOMPARE(M::MatrixReal::fromFile(handWrittenFilename.constData()), expected);
+
+    // Empty files produce empty matrices.
+
+    QByteArray emptyFilename = directory.filePath("empty.csv").toLocal8Bit();
+    QFile      emptyFile(QString::fromLocal8Bit(emptyFilename));
+
+    QVERIFY(emptyFile.open(QIODevice::WriteOnly));
+    emptyFile.close();
+
+    M::MatrixReal empty = M::MatrixReal::fromFile(emptyFilename.constData());
+    QCOMPARE(empty.numberRows(), M::MatrixReal::Index(0));
+    QCOMPARE(empty.numberColumns(), M::MatrixReal::Index(0));
+}
+
+
 void TestMatrixReal::testIterator() {
     M::MatrixReal m = M::MatrixReal::build(
         3, 3,
@@ -3892,3 +5070,111 @@ void TestMatrixReal::dumpMatrix(const Model::MatrixReal& matrix) {
         qDebug() << t;
     }
 }
+
+void TestMatrixReal::testMemoryPool() {
+    unsigned long long originalMaximumCachedBytes = M::MatrixMemoryPool::maximumCachedBytes();
+
+    M::MatrixMemoryPool::trim();
+    M::MatrixMemoryPool::resetStatistics();
+
+    M::MatrixMemoryPool::Statistics statistics = M::MatrixMemoryPool::statistics();
+    QCOMPARE(statistics.numberAllocations, 0ULL);
+    QCOMPARE(statistics.cachedBytes, 0ULL);
+
+    // Temporaries created by expressions should be served from the pool after the first pass.
+
+    M::MatrixReal a = M::MatrixReal::ones(32, 32);
+    M::MatrixReal b = M::MatrixReal::identity(32);
+    for (unsigned i=0 ; i<100 ; ++i) {
+        M::MatrixReal c = a * b + a;
+        QCOMPARE(c(M::Integer(1), M::Integer(1)), M::Real(2));
+    }
+
+    statistics = M::MatrixMemoryPool::statistics();
+    QCOMPARE(statistics.numberAllocations > 0, true);
+    QCOMPARE(statistics.numberPoolHits >= statistics.numberAllocations / 2, true);
+    QCOMPARE(statistics.cachedBytes > 0, true);
+
+    M::MatrixMemoryPool::trim();
+    QCOMPARE(M::MatrixMemoryPool::statistics().cachedBytes, 0ULL);
+
+    // Disabling the pool forces every block back to the matrix API.
+
+    M::MatrixMemoryPool::setMaximumCachedBytes(0);
+    M::MatrixMemoryPool::resetStatistics();
+
+    for (unsigned i=0 ; i<10 ; ++i) {
+        M::MatrixReal c = a + a;
+        QCOMPARE(c(M::Integer(32), M::Integer(32)), M::Real(2));
+    }
+
+    statistics = M::MatrixMemoryPool::statistics();
+    QCOMPARE(statistics.numberPoolHits, 0ULL);
+    QCOMPARE(statistics.numberPooledReleases, 0ULL);
+    QCOMPARE(statistics.cachedBytes, 0ULL);
+
+    M::MatrixMemoryPool::setMaximumCachedBytes(originalMaximumCachedBytes);
+}
+
+
+void TestMatrixReal::testOutOfCoreMatrices() {
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    unsigned long long originalThreshold = M::MatrixMemoryPool::outOfCoreThresholdBytes();
+    std::string        originalDirectory = M::MatrixMemoryPool::outOfCoreDirectory();
+
+    M::MatrixMemoryPool::setOutOfCoreDirectory(directory.path().toLocal8Bit().constData());
+    M::MatrixMemoryPool::setOutOfCoreThresholdBytes(1024 * 1024);
+    M::MatrixMemoryPool::resetStatistics();
+
+    // Each 512x512 matrix needs 2 MiB so every matrix below, including temporaries, lives in a scratch file.
+
+    M::Integer    numberRows    = 512;
+    M::Integer    numberColumns = 512;
+    M::MatrixReal a(numberRows, numberColumns);
+
+    for (M::Integer row=1 ; row<=numberRows ; ++row) {
+        for (M::Integer column=1 ; column<=numberColumns ; ++column) {
+            a.update(row, column, M::Real(row - column));
+        }
+    }
+
+    M::MatrixReal b = M::MatrixReal::identity(numberRows);
+    M::MatrixReal c = M::Real(2) * a * b + a;
+
+    QCOMPARE(M::MatrixMemoryPool::statistics().numberOutOfCoreAllocations >= 3, true);
+
+    for (M::Integer row=1 ; row<=numberRows ; row+=37) {
+        for (M::Integer column=1 ; column<=numberColumns ; column+=41) {
+            QCOMPARE(c(row, column), M::Real(3 * (row - column)));
+        }
+    }
+
+    // Small matrices are unaffected by the threshold.
+
+    M::MatrixMemoryPool::resetStatistics();
+
+    M::MatrixReal small = M::MatrixReal::ones(8, 8);
+    QCOMPARE(small(M::Integer(8), M::Integer(8)), M::Real(1));
+    QCOMPARE(M::MatrixMemoryPool::statistics().numberOutOfCoreAllocations, 0ULL);
+
+    // With scratch files disabled, allocations the matrix API can not satisfy are reported rather than spilled to
+    // disk.
+
+    M::MatrixMemoryPool::setOutOfCoreThresholdBytes(0);
+    M::MatrixMemoryPool::resetStatistics();
+
+    bool exceptionThrown = false;
+    try {
+        M::MatrixReal huge(M::Integer(1) << 24, M::Integer(1) << 24);
+    } catch (Model::InsufficientMemory&) {
+        exceptionThrown = true;
+    }
+
+    QCOMPARE(exceptionThrown, true);
+    QCOMPARE(M::MatrixMemoryPool::statistics().numberOutOfCoreAllocations, 0ULL);
+
+    M::MatrixMemoryPool::setOutOfCoreThresholdBytes(originalThreshold);
+    M::MatrixMemoryPool::setOutOfCoreDirectory(originalDirectory);
+}
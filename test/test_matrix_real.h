@@ -78,6 +78,10 @@ class TestMatrixReal:public TestMatrixBase {
 
         void testMatrixTypeMethods();
 
+        void testSparseMethods();
+
+        void testAutomaticStorageMethods();
+
         void testDeterminant1();
 
         void testDeterminant2();
@@ -122,6 +126,10 @@ class TestMatrixReal:public TestMatrixBase {
 
         void testSolve();
 
+        void testSparseSolve();
+
+        void testIterativeSolvers();
+
         void testLeastSquares();
 
         void testHadamardProduct();
@@ -168,8 +176,30 @@ class TestMatrixReal:public TestMatrixBase {
 
         void testMultiplicationFunctions();
 
+        void testFusedArithmetic();
+
+        void testSmallMatrixKernels();
+
+        void testSmallMatrixStorage();
+
+        void testElementwiseFunctions();
+
+        void testStridedSlicing();
+
+        void testSubmatrixViews();
+
+        void testColumnSpans();
+
+        void testBinaryFileFormat();
+
+        void testCsvFileFormat();
+
         void testIterator();
 
+        void testMemoryPool();
+
+        void testOutOfCoreMatrices();
+
     private:
         static void dumpMatrix(const Model::MatrixReal& matrix);
 
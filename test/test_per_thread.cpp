@@ -1099,7 +1099,10 @@ static const PeriodicAutocorrelationLimits autocorrelationThreshold[numberGenera
     { 2.0E-8, 0.06 }, // MT216091
     { 5.0E-8, 0.06 }, // XORSHIRO256+
     { 1.0E-6, 0.06 }, // XORSHIRO256**
-    { 1.0E-5, 0.06 }  // TRNG
+    { 1.0E-5, 0.06 }, // TRNG
+    { 1.0E-6, 0.06 }, // PHILOX4X32-10
+    { 1.0E-6, 0.06 }, // XORSHIRO256+ X8
+    { 1.0E-6, 0.06 }  // XORSHIRO256** X8
 };
 
 
@@ -1242,6 +1245,89 @@ void TestPerThread::testTRNG() {
 }
 
 
+void TestPerThread::testPhilox() {
+    // A zero seed selects key 0 and stream 0 so the first block must match the published Philox4x32-10 known answer.
+
+    M::PerThread::RngSeed zeroSeed = { 0, 0, 0, 0 };
+    M::PerThread          pt1(0, M::PerThread::RngType::PHILOX4X32_10, zeroSeed, nullptr);
+
+    QCOMPARE(pt1.random64(), 0xE169C58D6627E8D5ULL);
+    QCOMPARE(pt1.random64(), 0x9B00DBD8BC57AC4CULL);
+
+    // Bulk fills, including fills that start and end part way through a block, must match single draws.
+
+    M::PerThread::RngSeed rngSeed = { 1, 2, 3, 4 };
+    M::PerThread          pt2(0, M::PerThread::RngType::PHILOX4X32_10, rngSeed, nullptr);
+    M::PerThread          pt3(0, M::PerThread::RngType::PHILOX4X32_10, rngSeed, nullptr);
+
+    std::uint64_t values[1001];
+    values[0] = pt3.random64();
+    pt3.fillArray(values + 1, 37);
+    pt3.fillArray(values + 38, 963);
+
+    for (unsigned i=0 ; i<1001 ; ++i) {
+        QCOMPARE(values[i], pt2.random64());
+    }
+
+    // Threads are given distinct streams and must therefore produce distinct sequences.
+
+    M::PerThread pt4(0, M::PerThread::RngType::PHILOX4X32_10, rngSeed, nullptr);
+    M::PerThread pt5(1, M::PerThread::RngType::PHILOX4X32_10, rngSeed, nullptr);
+
+    unsigned numberMatches = 0;
+    for (unsigned i=0 ; i<1000 ; ++i) {
+        if (pt4.random64() == pt5.random64()) {
+            ++numberMatches;
+        }
+    }
+
+    QCOMPARE(numberMatches, 0U);
+}
+
+
+void TestPerThread::testXorShiRo256X8() {
+    M::PerThread::RngSeed rngSeed = { 1, 2, 3, 4 };
+
+    const M::PerThread::RngType rngTypes[][2] = {
+        { M::PerThread::RngType::XORSHIRO256_PLUS,  M::PerThread::RngType::XORSHIRO256_PLUS_X8  },
+        { M::PerThread::RngType::XORSHIRO256_STARS, M::PerThread::RngType::XORSHIRO256_STARS_X8 }
+    };
+
+    for (const M::PerThread::RngType* rngType : rngTypes) {
+        // Lane 0 must reproduce the single lane generator.  Fills that start and end part way through a step must
+        // match single draws.
+
+        M::PerThread pt1(5, rngType[0], rngSeed, nullptr);
+        M::PerThread pt2(5, rngType[1], rngSeed, nullptr);
+        M::PerThread pt3(5, rngType[1], rngSeed, nullptr);
+
+        std::uint64_t values[1001];
+        values[0] = pt2.random64();
+        pt2.fillArray(values + 1, 13);
+        pt2.fillArray(values + 14, 987);
+
+        for (unsigned i=0 ; i<1001 ; ++i) {
+            QCOMPARE(values[i], pt3.random64());
+
+            if (i % 8 == 0) {
+                QCOMPARE(values[i], pt1.random64());
+            }
+        }
+
+        // The remaining lanes must not repeat lane 0.
+
+        unsigned numberMatches = 0;
+        for (unsigned i=0 ; i<1001 ; ++i) {
+            if (i % 8 != 0 && values[i] == values[i - i % 8]) {
+                ++numberMatches;
+            }
+        }
+
+        QCOMPARE(numberMatches, 0U);
+    }
+}
+
+
 void TestPerThread::testMT19937Array() {
     M::PerThread::RngSeed rngSeed = {
         0x123456789ABCDEF0ULL,
@@ -1408,6 +1494,72 @@ void TestPerThread::testTRNGArray() {
 }
 
 
+void TestPerThread::testJump() {
+    M::PerThread::RngSeed rngSeed = { 1, 2, 3, 4 };
+
+    const M::PerThread::RngType jumpRngTypes[] = {
+        M::PerThread::RngType::MT19937,
+        M::PerThread::RngType::XORSHIRO256_PLUS,
+        M::PerThread::RngType::XORSHIRO256_STARS,
+        M::PerThread::RngType::XORSHIRO256_PLUS_X8,
+        M::PerThread::RngType::XORSHIRO256_STARS_X8
+    };
+
+    for (M::PerThread::RngType rngType : jumpRngTypes) {
+        // Jumping must commute with drawing values.
+
+        M::PerThread pt1(0, rngType, rngSeed, nullptr);
+        M::PerThread pt2(0, rngType, rngSeed, nullptr);
+
+        for (unsigned i=0 ; i<1000 ; ++i) {
+            pt1.random64();
+        }
+
+        QCOMPARE(pt1.jump(), true);
+        QCOMPARE(pt2.jump(), true);
+
+        for (unsigned i=0 ; i<1000 ; ++i) {
+            pt2.random64();
+        }
+
+        for (unsigned i=0 ; i<1000 ; ++i) {
+            QCOMPARE(pt1.random64(), pt2.random64());
+        }
+
+        // Substreams must match explicit jumps and must differ from one another.
+
+        M::PerThread pt3(0, rngType, rngSeed, nullptr);
+        M::PerThread pt4(5, rngType, rngSeed, nullptr);
+        M::PerThread pt5(6, rngType, rngSeed, nullptr);
+
+        pt3.setRngSeed(rngSeed);
+        pt3.jump();
+        pt3.jump();
+
+        QCOMPARE(pt4.selectSubstream(rngSeed, 2), true);
+        QCOMPARE(pt5.selectSubstream(rngSeed, 3), true);
+
+        unsigned numberMatches = 0;
+        for (unsigned i=0 ; i<1000 ; ++i) {
+            unsigned long long v4 = pt4.random64();
+            QCOMPARE(pt3.random64(), v4);
+
+            if (pt5.random64() == v4) {
+                ++numberMatches;
+            }
+        }
+
+        QCOMPARE(numberMatches < 2, true);
+
+        QCOMPARE(pt3.longJump(), true);
+    }
+
+    M::PerThread pt(0, M::PerThread::RngType::MT216091, rngSeed, nullptr);
+    QCOMPARE(pt.jump(), false);
+    QCOMPARE(pt.selectSubstream(rngSeed, 1), false);
+}
+
+
 void TestPerThread::testSpeed() {
     M::PerThread::RngSeed rngSeed = {
         0x123456789ABCDEF0ULL,
@@ -1429,6 +1581,23 @@ void TestPerThread::testSpeed() {
         double          averageTime = (1000000.0 * (endTime - startTime)) / (1.0 * numberSpeedIterations);
         qDebug() << "RNG: " << r << " time: " << averageTime << " nSec";
     }
+
+    QVector<std::uint64_t> buffer(65536);
+    unsigned long          numberFills = numberSpeedIterations / static_cast<unsigned long>(buffer.size());
+
+    for (unsigned r=0 ; r<static_cast<unsigned>(M::PerThread::RngType::NUMBER_RNGS) ; ++r) {
+        M::PerThread::RngType rngType = static_cast<M::PerThread::RngType>(r);
+        M::PerThread pt(1, rngType, rngSeed, Q_NULLPTR);
+
+        std::uint64_t startTime = QDateTime::currentMSecsSinceEpoch();
+        for (unsigned long i=0 ; i<numberFills ; ++i) {
+            pt.fillArray(buffer.data(), static_cast<unsigned long>(buffer.size()));
+        }
+        std::uint64_t endTime = QDateTime::currentMSecsSinceEpoch();
+
+        double averageTime = (1000000.0 * (endTime - startTime)) / (1.0 * numberFills * buffer.size());
+        qDebug() << "RNG: " << r << " fill time: " << averageTime << " nSec";
+    }
 }
 
 
@@ -1591,6 +1760,48 @@ void TestPerThread::testNormal() {
 }
 
 
+void TestPerThread::testNormalTail() {
+    // The normal generator handles values beyond the base of the ziggurat separately.  Confirm the tail holds the
+    // expected fraction of values and that the moments of the distribution are correct.
+
+    M::PerThread::RngSeed rngSeed = {
+        0x123456789ABCDEF0ULL,
+        0x132457689BACDFE0ULL,
+        0x10FEDCBA98765432ULL,
+        0x76543210FEDCBA98ULL
+    };
+
+    M::PerThread pt(1, M::PerThread::RngType::MT19937, rngSeed, Q_NULLPTR);
+
+    const unsigned numberValues = 20000000;
+    const double   tailStart    = 3.6541528853610088;
+
+    unsigned long numberInTail = 0;
+    double        sum          = 0;
+    double        sumSquared   = 0;
+
+    for (unsigned i=0 ; i<numberValues ; ++i) {
+        double v = pt.randomNormal();
+
+        sum        += v;
+        sumSquared += v * v;
+
+        if (std::abs(v) > tailStart) {
+            ++numberInTail;
+        }
+    }
+
+    double mean              = sum / numberValues;
+    double variance          = sumSquared / numberValues - mean * mean;
+    double expectedTail      = std::erfc(tailStart / std::sqrt(2.0)) * numberValues;
+    double tailRelativeError = (numberInTail - expectedTail) / expectedTail;
+
+    QCOMPARE(std::abs(mean) < 1.0E-3, true);
+    QCOMPARE(std::abs(variance - 1.0) < 2.0E-3, true);
+    QCOMPARE(std::abs(tailRelativeError) < 0.1, true);
+}
+
+
 void TestPerThread::testWeibull() {
     // Code below is essentially the Anderson-Darling test.
 
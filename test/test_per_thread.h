@@ -53,6 +53,10 @@ class TestPerThread:public QObject {
 
         void testTRNG();
 
+        void testPhilox();
+
+        void testXorShiRo256X8();
+
         void testMT19937Array();
 
         void testMT216091Array();
@@ -63,6 +67,8 @@ class TestPerThread:public QObject {
 
         void testTRNGArray();
 
+        void testJump();
+
         void testSpeed();
 
         void testAutoCorrelation();
@@ -73,6 +79,8 @@ class TestPerThread:public QObject {
 
         void testNormal();
 
+        void testNormalTail();
+
         void testWeibull();
 
         void testExponential();
@@ -29,6 +29,9 @@
 #include <QObject>
 #include <QtTest/QtTest>
 
+#include <thread>
+#include <vector>
+
 #include <m_reference_counter.h>
 
 #include "test_reference_counter.h"
@@ -61,3 +64,49 @@ void TestReferenceCounter::testReferenceCounter() {
     QCOMPARE(referenceCounter.referenceCount(), 0U);
     QCOMPARE(noReferences, true);
 }
+
+
+void TestReferenceCounter::testThreadSafety() {
+    static constexpr unsigned numberThreads          = 8;
+    static constexpr unsigned numberThreadIterations = 100000;
+
+    M::ReferenceCounter first;
+    M::ReferenceCounter second;
+    unsigned long       lockedCount = 0;
+
+    std::vector<std::thread> threads;
+    for (unsigned threadIndex=0 ; threadIndex<numberThreads ; ++threadIndex) {
+        threads.emplace_back([&, threadIndex]() {
+            for (unsigned i=0 ; i<numberThreadIterations ; ++i) {
+                first.addReference();
+
+                // Alternate the argument order to confirm lockPair can not deadlock.
+
+                if (threadIndex % 2) {
+                    M::ReferenceCounter::lockPair(&first, &second);
+                } else {
+                    M::ReferenceCounter::lockPair(&second, &first);
+                }
+
+                first.lock();
+                ++lockedCount;
+                first.unlock();
+
+                second.unlock();
+                first.unlock();
+
+                first.removeReference();
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    QCOMPARE(lockedCount, static_cast<unsigned long>(numberThreads) * numberThreadIterations);
+    QCOMPARE(first.referenceCount(), 1U);
+
+    M::ReferenceCounter copy(first);
+    QCOMPARE(copy.referenceCount(), 1U);
+}
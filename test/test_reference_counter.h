@@ -43,6 +43,8 @@ class TestReferenceCounter:public QObject {
         void testConstructor();
 
         void testReferenceCounter();
+
+        void testThreadSafety();
 };
 
 #endif